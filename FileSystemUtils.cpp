@@ -35,12 +35,15 @@
 // NB Libs
 #include <ctype.h>
 #include <stdio.h>
+#include <string.h>
+#include <ucos.h>
 #include <utils.h>
 
 // EFFS Files
 #include <effs_fat/fat.h>
 #include <effs_fat/effs_utils.h>
 
+#include "cardindex.h"
 #include "cardtype.h"
 #include "FileSystemUtils.h"
 
@@ -116,42 +119,69 @@ void DisplayEffsErrorCode(int code)
     }
 }
 
+/**
+ * @brief Returns 1 if a card is in the socket. Drives without card detection always report one.
+ */
+BYTE ExtFlashPresent()
+{
+#if (defined MULTI_MMC)
+    return (get_cd(flashDriveNum) != 0) ? 1 : 0;
+#elif (defined USE_MMC)
+    return (get_cd() != 0) ? 1 : 0;
+#else
+    return 1;
+#endif
+}
+
+/**
+ * @brief Returns 1 if the card's write protect switch is set.
+ */
+BYTE ExtFlashWriteProtected()
+{
+#if (defined MULTI_MMC)
+    return (get_wp(flashDriveNum) == 1) ? 1 : 0;
+#elif (defined USE_MMC)
+    return (get_wp() == 1) ? 1 : 0;
+#else
+    return 0;
+#endif
+}
+
 /**
  * @brief Initialization function for setting up EFFS on
  * MultiMedia/Secure Digital cards or Comact Flash cards.
+ *
+ * Waits on the console until a writable card is inserted. See mount.h for a
+ * manager that mounts in the background instead.
  */
 BYTE InitExtFlash()
 {
     // Card detection check
-#if (defined MULTI_MMC)
-    while (get_cd(flashDriveNum) == 0)
+    while (ExtFlashPresent() == 0)
     {
+#if (defined MULTI_MMC)
         iprintf("No MMC/SD card detected on drive %d. Insert a card and then press <Enter>\r\n", flashDriveNum);
-        getchar();
-    }
-#elif (defined USE_MMC)
-    while (get_cd() == 0)
-    {
+#else
         iprintf("No MMC/SD card detected. Insert a card and then press <Enter>\r\n");
+#endif
         getchar();
     }
-#endif
 
     // Write protection check
-#if (defined MULTI_MMC)
-    while (get_wp(flashDriveNum) == 1)
-    {
-        iprintf("SD/MMC Card is write-protected. Disable write protection then press <Enter>\r\n");
-        getchar();
-    }
-#elif (defined USE_MMC)
-    while (get_wp() == 1)
+    while (ExtFlashWriteProtected() == 1)
     {
         iprintf("SD/MMC Card is write-protected. Disable write protection then press <Enter>\r\n");
         getchar();
     }
-#endif
 
+    return MountExtFlash();
+}
+
+/**
+ * @brief Mounts the card and makes it the calling task's current drive. Does not wait for a card.
+ */
+BYTE MountExtFlash()
+{
     int rv;
 
     /**
@@ -413,6 +443,126 @@ DWORD AppendFile(BYTE *pDataToWrite, char *pFileName, DWORD NumBytes)
     return rvA;
 }
 
+BufferedFileWriter::BufferedFileWriter()
+    : m_file(nullptr), m_fileOffset(0), m_len(0), m_maxAgeTicks(0), m_dirtyTick(0), m_dirty(false), m_commits(0),
+      m_lastError(F_NO_ERROR)
+{
+}
+
+/**
+ * @brief Opens the file and positions the buffer at its end. Returns false if it cannot be opened.
+ */
+bool BufferedFileWriter::Open(const char *fileName, DWORD maxAgeTicks, bool truncate)
+{
+    Close();
+    m_file = f_open((char *)fileName, truncate ? "w" : "a");
+    if (m_file == nullptr)
+    {
+        m_lastError = f_getlasterror();
+        return false;
+    }
+    f_seek(m_file, 0, F_SEEK_END);
+    m_fileOffset = f_tell(m_file);
+    if (m_fileOffset == 0) { CardIndexInvalidate(); }   // The file may be new
+    m_len = 0;
+    m_maxAgeTicks = maxAgeTicks;
+    m_dirty = false;
+    m_lastError = F_NO_ERROR;
+    return true;
+}
+
+/**
+ * @brief Writes the first len buffered bytes to the file. On a short write the
+ * bytes that did not make it stay buffered for the next attempt.
+ */
+bool BufferedFileWriter::WriteOut(DWORD len)
+{
+    if (len == 0) { return true; }
+    long written = f_write(m_buffer, 1, len, m_file);
+    if (written < 0) { written = 0; }
+    if ((DWORD)written < len) { m_lastError = f_getlasterror(); }
+
+    memmove(m_buffer, m_buffer + written, m_len - written);
+    m_len -= written;
+    m_fileOffset += written;
+    return ((DWORD)written == len);
+}
+
+/**
+ * @brief Copies data into the buffer. Each time it fills, the sector aligned part
+ * is written out and the unaligned tail is kept for the next pass.
+ */
+DWORD BufferedFileWriter::Write(const void *data, DWORD len)
+{
+    if (m_file == nullptr) { return 0; }
+    if (!m_dirty)
+    {
+        m_dirty = true;
+        m_dirtyTick = TimeTick;
+    }
+
+    const BYTE *src = (const BYTE *)data;
+    DWORD accepted = 0;
+    while (accepted < len)
+    {
+        DWORD n = sizeof(m_buffer) - m_len;
+        if (n > len - accepted) { n = len - accepted; }
+        memcpy(m_buffer + m_len, src + accepted, n);
+        m_len += n;
+        accepted += n;
+
+        if (m_len == sizeof(m_buffer))
+        {   // Only the first write after Open() or Flush() can start mid-sector
+            DWORD aligned = ((m_fileOffset + m_len) & ~(DWORD)(FS_SECTOR_SIZE - 1)) - m_fileOffset;
+            if (!WriteOut(aligned) && (m_len == sizeof(m_buffer))) { break; }
+        }
+    }
+
+    Poll();
+    return accepted;
+}
+
+bool BufferedFileWriter::Flush()
+{
+    if (m_file == nullptr) { return false; }
+    bool ok = WriteOut(m_len);
+    int rv = f_flush(m_file);
+    if (rv != F_NO_ERROR)
+    {
+        m_lastError = rv;
+        ok = false;
+    }
+    if (ok) { m_dirty = false; }
+    m_commits++;
+    return ok;
+}
+
+bool BufferedFileWriter::Poll()
+{
+    if ((m_file == nullptr) || !m_dirty || (m_maxAgeTicks == 0)) { return true; }
+    if ((DWORD)(TimeTick - m_dirtyTick) < m_maxAgeTicks) { return true; }
+    return Flush();
+}
+
+/**
+ * @brief Writes out and commits everything, then closes the file.
+ */
+bool BufferedFileWriter::Close()
+{
+    if (m_file == nullptr) { return true; }
+    bool ok = WriteOut(m_len);
+    int rv = f_close(m_file);
+    if (rv != F_NO_ERROR)
+    {
+        m_lastError = rv;
+        ok = false;
+    }
+    m_file = nullptr;
+    m_len = 0;
+    m_dirty = false;
+    return ok;
+}
+
 /**
  * @brief Opens a file, reads its contents into a buffer, then closes the file, and prints the status.
  * Returns 0 for success
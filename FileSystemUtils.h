@@ -47,7 +47,10 @@ extern "C"
 
 void DisplayEffsErrorCode( int code );
 BYTE InitExtFlash();
+BYTE MountExtFlash();
 BYTE UnmountExtFlash();
+BYTE ExtFlashPresent();
+BYTE ExtFlashWriteProtected();
 BYTE FormatExtFlash( long FATtype = F_FAT32_FORMAT );
 BYTE DisplayEffsSpaceStats();
 BYTE DumpDir();
@@ -68,5 +71,70 @@ void fputs_test( char *FileName );
 #endif
 
 
+#ifdef __cplusplus
+
+#define FS_SECTOR_SIZE ( 512 )
+#define BUFFERED_WRITER_SECTORS ( 8 )   // 4 KB of RAM per writer
+
+/**
+ * Buffered append writer.
+ *
+ * AppendFile() opens, writes and closes the file on every call, and each
+ * close updates the FAT and directory entry. This writer keeps the file
+ * open instead. Appends are copied into a RAM buffer and reach the card as
+ * whole, sector aligned writes, so a small append costs a memcpy.
+ *
+ * Written data is committed (f_flush(), which updates the FAT and
+ * directory entry) whenever Flush() is called. With a non-zero maxAgeTicks
+ * it is also committed once the oldest uncommitted byte is that old. A
+ * power cut or card removal loses at most the data appended since the last
+ * commit: the buffer plus maxAgeTicks worth.
+ *
+ * The age is checked on each Write(). Call Poll() from a periodic task if
+ * appends can stop for longer than maxAgeTicks. Not thread safe; use one
+ * writer per task.
+ */
+class BufferedFileWriter
+{
+  public:
+    BufferedFileWriter();
+    ~BufferedFileWriter() { Close(); }
+
+    // Opens fileName for appending, or empties it first when truncate is set.
+    // maxAgeTicks of 0 commits only on Flush() and Close().
+    bool Open( const char *fileName, DWORD maxAgeTicks = 0, bool truncate = false );
+    bool Close();
+    bool IsOpen() const { return m_file != nullptr; }
+
+    // Returns the number of bytes accepted, less than len only after a write error
+    DWORD Write( const void *data, DWORD len );
+
+    // Writes out everything buffered and commits it
+    bool Flush();
+
+    // Commits if the periodic policy is due
+    bool Poll();
+
+    DWORD Buffered() const { return m_len; }
+    DWORD Commits() const { return m_commits; }
+    int LastError() const { return m_lastError; }
+
+  private:
+    bool WriteOut( DWORD len );
+
+    F_FILE *m_file;
+    DWORD m_fileOffset;    // File position of m_buffer[0]
+    DWORD m_len;
+    DWORD m_maxAgeTicks;
+    DWORD m_dirtyTick;     // TimeTick of the oldest uncommitted append
+    bool m_dirty;
+    DWORD m_commits;
+    int m_lastError;
+    BYTE m_buffer[FS_SECTOR_SIZE * BUFFERED_WRITER_SECTORS] __attribute__( ( aligned( 4 ) ) );
+};
+
+#endif
+
+
 #endif
 
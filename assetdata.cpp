@@ -0,0 +1,7980 @@
+/* Generated by host/assetembed from SdCardFiles. Do not edit. */
+
+#include "embedded.h"
+
+// index.html: 9529 bytes, 3219 gzipped
+static const char NotModified0[] =
+    "HTTP/1.0 304 Not Modified\r\n"
+    "ETag: \"a3f5bbdee7695852\"\r\n"
+    "\r\n";
+
+// The 200 header, followed by the body
+/*
+HTTP/1.0 200 OK
+Content-Type: text/html
+Content-Length: 3219
+Content-Encoding: gzip
+Vary: Accept-Encoding
+ETag: "a3f5bbdee7695852"
+Cache-Control: no-cache
+
+*/
+static const uint8_t Response0[3383] = {
+    72,84,84,80,47,49,46,48,32,50,48,48,32,79,75,13,10,67,111,110,116,101,110,116,
+    45,84,121,112,101,58,32,116,101,120,116,47,104,116,109,108,13,10,67,111,110,116,101,110,
+    116,45,76,101,110,103,116,104,58,32,51,50,49,57,13,10,67,111,110,116,101,110,116,45,
+    69,110,99,111,100,105,110,103,58,32,103,122,105,112,13,10,86,97,114,121,58,32,65,99,
+    99,101,112,116,45,69,110,99,111,100,105,110,103,13,10,69,84,97,103,58,32,34,97,51,
+    102,53,98,98,100,101,101,55,54,57,53,56,53,50,34,13,10,67,97,99,104,101,45,67,
+    111,110,116,114,111,108,58,32,110,111,45,99,97,99,104,101,13,10,13,10,31,139,8,0,
+    0,0,0,0,2,3,173,90,235,82,219,72,22,254,207,83,244,80,53,131,156,216,242,133,
+    64,178,96,152,34,64,146,153,130,9,131,153,91,165,168,84,91,106,219,10,178,164,116,75,
+    24,207,12,79,182,63,246,145,246,21,246,59,221,146,172,43,201,110,173,139,50,182,250,244,
+    233,115,253,206,233,110,255,251,159,255,26,127,115,246,254,244,230,143,171,115,182,136,151,254,
+    241,214,56,251,39,184,123,188,197,240,26,47,69,204,153,179,224,82,137,248,40,137,103,189,
+    87,233,64,236,197,190,56,158,136,64,133,146,157,113,80,253,234,169,132,251,222,159,60,246,
+    194,128,157,68,209,184,111,136,204,4,21,175,179,207,244,154,134,238,154,253,149,127,165,215,
+    146,203,185,23,28,176,193,97,254,248,49,255,228,240,224,158,171,202,140,149,231,198,139,3,
+    54,28,12,190,61,44,13,44,132,55,95,196,102,164,194,108,220,79,37,25,247,141,158,99,
+    18,37,19,210,145,94,20,51,37,157,163,237,79,170,31,47,164,16,246,210,11,236,79,106,
+    251,24,51,245,112,51,173,23,204,124,30,127,45,245,219,139,155,55,23,33,119,133,252,10,
+    226,247,114,234,197,167,97,16,203,208,87,237,244,27,227,246,251,236,71,47,142,133,100,211,
+    100,54,195,63,120,47,246,130,185,178,217,27,201,151,66,49,46,5,139,124,190,22,46,155,
+    114,231,142,113,166,22,161,140,187,140,187,60,138,189,123,193,92,129,97,54,21,11,47,112,
+    139,140,227,5,141,221,123,142,96,142,31,58,119,93,166,66,253,112,25,98,10,222,239,193,
+    94,45,195,48,94,248,107,38,238,69,192,86,11,188,205,178,133,37,113,79,2,26,241,215,
+    69,206,60,112,25,143,33,202,50,113,22,204,15,87,16,92,194,164,224,206,3,179,174,167,
+    72,104,38,197,76,10,181,16,202,206,231,223,115,201,126,124,253,241,242,228,247,143,111,174,
+    79,46,207,39,236,136,237,191,56,220,132,4,22,72,117,191,19,176,237,12,97,235,5,48,
+    81,20,250,58,98,107,156,126,248,233,227,217,249,197,201,31,31,47,137,215,238,224,176,192,
+    233,39,72,47,181,1,201,8,10,159,83,25,61,197,98,99,142,64,172,132,138,141,218,77,
+    82,22,120,239,13,10,33,95,32,57,255,253,230,250,228,234,253,197,201,205,185,33,28,129,
+    144,150,127,23,174,216,12,116,17,199,10,213,197,216,10,174,149,194,245,156,24,238,131,158,
+    130,45,66,223,133,251,183,74,139,172,212,97,249,193,156,187,115,17,151,37,241,41,70,221,
+    183,122,4,2,204,184,175,68,97,26,100,57,19,14,28,79,1,180,228,190,15,41,122,58,
+    107,32,155,115,135,232,250,156,192,131,50,32,72,176,20,30,211,119,123,193,194,160,16,72,
+    157,210,146,147,155,143,215,39,63,189,61,199,114,3,251,229,224,229,112,176,255,242,213,97,
+    149,4,246,1,193,112,48,218,221,12,205,146,192,209,224,243,75,64,171,255,140,165,44,35,
+    70,151,133,73,220,169,160,135,214,15,152,67,150,59,202,228,61,62,62,38,95,215,8,29,
+    144,124,24,116,89,250,119,91,167,80,11,111,22,107,39,53,140,37,75,82,167,60,64,33,
+    104,209,168,167,199,240,111,204,16,177,222,243,231,85,73,233,229,205,152,5,194,163,76,228,
+    14,115,128,8,94,144,136,195,26,173,243,193,187,5,79,203,42,40,165,197,235,176,239,82,
+    227,117,216,51,102,141,240,150,155,187,159,143,244,242,135,117,214,164,201,243,35,179,194,51,
+    253,175,129,70,91,162,71,238,41,15,62,110,149,165,76,85,209,178,18,227,49,27,118,216,
+    247,236,146,199,11,91,125,150,177,53,132,44,24,232,176,131,170,241,224,79,27,168,102,57,
+    31,6,183,93,176,26,234,247,145,126,223,189,237,20,75,72,49,90,111,60,32,64,204,151,
+    81,207,37,28,10,216,167,34,78,218,136,102,141,108,113,70,166,152,181,244,28,137,20,135,
+    181,93,213,101,43,201,163,8,185,4,164,42,242,221,29,49,96,180,234,104,96,77,2,77,
+    5,195,3,97,66,182,244,124,223,203,25,16,202,81,232,135,179,25,228,71,134,198,43,33,
+    138,217,80,100,171,17,86,79,137,132,68,188,44,121,224,8,59,8,87,86,135,17,212,72,
+    227,223,153,12,151,154,195,12,128,64,225,28,78,129,73,247,24,1,36,67,77,185,46,3,
+    165,81,250,181,169,13,71,149,96,51,64,125,192,62,220,118,75,207,125,240,158,136,207,7,
+    44,72,124,191,62,116,205,87,100,92,56,170,60,102,148,186,84,181,1,99,128,38,118,26,
+    151,239,185,127,0,100,44,143,24,193,107,172,104,253,27,201,3,229,53,242,35,156,126,205,
+    149,200,198,202,131,137,66,11,145,67,7,64,234,115,23,101,71,43,211,101,81,8,151,17,
+    102,53,165,36,153,18,190,32,240,168,122,231,112,171,70,77,88,41,195,136,185,73,228,123,
+    14,80,81,105,199,166,117,17,245,35,206,138,35,159,81,72,114,141,234,18,80,41,26,193,
+    128,138,141,157,58,133,125,3,96,32,229,216,119,223,33,237,161,3,18,167,72,208,97,127,
+    179,65,135,141,143,232,93,138,56,145,65,131,136,53,182,71,41,219,38,237,233,165,137,51,
+    15,195,14,169,221,128,37,232,188,6,117,100,120,100,2,5,164,133,25,165,231,166,185,208,
+    245,31,38,66,14,120,34,136,119,148,233,5,116,47,129,76,35,244,11,132,241,25,170,146,
+    175,210,86,165,219,198,58,237,82,178,216,162,244,89,10,174,18,73,45,80,33,9,83,127,
+    160,136,114,39,70,67,235,83,187,225,8,248,165,145,179,70,247,88,68,26,110,51,245,11,
+    182,79,211,162,163,49,24,182,111,179,76,221,154,64,89,98,252,4,105,174,203,115,194,79,
+    18,162,87,30,208,203,237,55,184,97,171,145,95,238,117,244,139,159,15,219,105,82,157,54,
+    254,110,142,246,27,66,39,109,83,3,99,41,226,229,96,229,195,252,113,79,247,153,34,205,
+    131,46,3,44,207,168,85,101,10,1,0,219,171,176,137,181,97,168,238,196,170,1,64,115,
+    136,157,202,112,69,189,25,246,14,65,8,168,77,60,223,101,73,212,152,199,177,129,15,232,
+    68,25,221,43,251,226,176,61,83,82,165,178,68,97,127,255,157,179,26,179,2,197,147,25,
+    148,49,201,166,254,151,137,83,228,65,161,144,9,208,43,11,208,154,148,141,222,251,129,98,
+    72,3,18,2,44,173,146,40,45,222,18,89,136,42,166,144,73,236,250,205,41,219,221,219,
+    27,60,13,36,41,50,231,24,245,164,41,210,149,72,13,221,6,240,169,170,234,83,224,217,
+    201,158,153,105,255,67,188,223,228,126,207,109,223,76,108,112,193,166,114,97,253,197,80,103,
+    74,17,162,43,197,193,166,92,28,232,119,246,216,121,34,116,82,142,190,8,230,241,130,29,
+    151,183,47,157,210,170,186,163,178,42,204,30,43,149,76,103,82,177,148,181,213,44,151,180,
+    45,1,200,51,54,180,247,216,243,146,11,158,161,25,173,77,55,165,195,116,104,216,233,90,
+    149,205,76,55,29,225,15,86,101,11,133,204,238,124,65,126,4,221,111,210,211,251,61,65,
+    150,20,186,67,214,248,145,72,137,26,144,239,255,168,61,51,189,21,200,116,186,235,109,69,
+    149,219,181,22,86,153,93,11,186,178,216,243,13,196,123,50,223,44,45,120,182,39,117,203,
+    243,21,186,63,95,20,205,249,197,94,96,150,217,213,120,173,217,245,179,204,225,71,133,90,
+    92,219,88,21,180,152,248,64,57,109,18,168,142,182,23,58,67,117,108,51,87,92,186,74,
+    215,194,152,250,104,0,220,154,246,207,203,16,202,13,217,82,81,87,2,254,129,43,80,227,
+    154,56,167,144,139,202,232,96,247,138,78,156,114,186,208,155,134,178,154,248,138,5,122,231,
+    171,22,0,201,36,34,24,224,236,83,178,108,193,84,35,214,81,25,160,178,196,129,54,214,
+    83,233,145,117,109,133,38,164,242,60,93,160,165,82,229,116,192,146,60,42,123,195,238,38,
+    120,241,57,21,177,87,158,210,105,234,223,180,70,77,189,94,117,246,19,189,95,185,217,19,
+    12,65,237,73,129,50,151,26,158,54,244,93,118,39,132,222,98,160,243,203,118,240,113,141,
+    229,106,225,249,162,16,78,199,108,68,205,223,12,59,33,59,166,70,15,97,58,219,0,199,
+    23,99,113,168,75,23,77,156,97,75,101,183,22,44,100,129,237,132,209,218,210,100,248,214,
+    105,238,80,116,70,110,8,117,222,52,83,166,41,16,203,166,173,236,99,179,35,56,51,114,
+    118,217,84,127,26,222,182,68,18,236,50,251,144,235,217,99,195,39,84,131,151,174,154,78,
+    84,14,152,120,64,117,208,39,69,162,208,191,104,218,85,216,213,56,197,141,71,26,25,27,
+    105,11,82,140,110,155,77,49,173,18,14,91,8,41,16,243,56,70,200,76,109,202,172,198,
+    115,163,206,87,27,85,69,60,0,95,226,213,99,220,110,72,44,109,122,63,90,112,189,99,
+    39,114,221,212,126,79,134,214,83,168,2,235,231,7,108,88,159,158,199,14,215,129,3,53,
+    101,100,77,109,13,172,154,109,131,172,55,239,174,207,207,237,159,243,99,36,91,233,89,92,
+    71,20,41,110,254,155,247,54,38,173,33,182,233,12,30,91,142,181,166,94,192,37,74,142,
+    240,197,82,196,248,100,234,134,62,204,202,31,62,125,162,117,245,126,242,113,114,122,114,65,
+    71,90,47,6,255,216,111,56,177,122,135,34,230,11,125,64,105,221,123,98,85,13,81,138,
+    101,122,110,79,215,177,184,48,209,49,102,163,17,37,173,126,14,20,251,5,101,225,149,5,
+    119,124,131,202,242,240,122,184,217,232,53,114,202,103,140,204,140,156,220,24,224,125,0,88,
+    10,167,159,176,199,98,3,218,45,17,230,7,181,147,45,42,192,71,148,45,169,163,126,5,
+    125,40,119,243,37,208,70,14,247,173,225,168,171,141,79,225,145,91,163,121,171,214,184,201,
+    42,51,123,241,255,100,182,223,192,172,83,63,193,211,237,92,81,209,77,68,86,171,88,225,
+    244,177,104,232,221,145,53,124,149,46,150,246,17,135,13,135,27,230,84,198,244,153,149,233,
+    47,242,217,149,129,13,219,77,143,210,118,2,246,155,152,78,176,121,66,209,187,228,115,207,
+    169,135,226,169,20,208,44,39,179,154,66,113,59,31,222,166,210,181,194,198,59,92,181,157,
+    90,90,43,197,242,18,142,120,197,119,27,107,184,235,73,76,120,138,161,156,155,125,122,241,
+    126,114,126,214,105,67,232,85,22,108,27,241,182,87,234,160,223,223,6,250,25,41,108,108,
+    13,245,129,190,189,64,35,20,80,174,62,103,219,125,248,246,124,187,165,0,65,30,147,229,
+    55,235,136,218,138,109,52,132,124,109,142,4,183,91,167,132,65,24,9,194,203,82,195,77,
+    56,210,58,1,181,95,241,185,40,205,17,247,173,245,136,94,69,96,32,197,233,170,237,87,
+    120,159,230,217,46,190,116,90,148,122,108,23,67,95,89,124,141,224,143,109,88,89,62,83,
+    213,183,100,159,76,35,14,199,188,189,96,243,48,116,3,40,91,143,46,30,232,70,178,22,
+    85,14,20,148,28,206,11,239,78,98,171,142,39,233,185,123,85,91,41,62,39,168,211,39,
+    154,43,248,27,67,165,139,84,219,30,200,106,8,209,225,38,217,125,71,45,182,139,87,30,
+    77,158,41,165,169,217,37,88,134,21,21,50,143,164,232,166,188,237,205,237,71,117,239,179,
+    85,81,67,119,233,210,54,31,44,229,136,0,157,185,49,74,107,42,79,128,215,17,43,209,
+    110,206,151,51,150,165,74,100,136,74,56,118,37,164,138,232,32,237,94,156,234,81,235,229,
+    94,55,203,37,47,8,132,252,141,110,89,1,143,197,103,239,244,5,43,28,98,163,137,166,
+    99,133,65,65,202,212,151,153,53,236,53,221,138,216,175,218,9,254,164,75,176,202,109,148,
+    86,171,36,233,132,158,148,122,89,125,131,67,130,148,232,222,137,37,246,137,11,40,127,65,
+    99,214,224,97,166,95,144,246,225,133,126,21,100,213,211,55,146,208,149,2,226,108,52,208,
+    193,214,180,212,153,39,203,246,163,221,88,117,33,148,187,225,30,88,12,171,43,97,118,125,
+    177,189,202,90,90,117,155,187,174,165,231,20,120,84,70,192,173,42,163,147,94,19,151,100,
+    44,93,32,91,181,168,202,230,216,73,228,234,220,172,240,204,66,169,196,83,39,250,117,58,
+    82,44,129,121,44,67,189,137,247,167,176,106,177,212,109,8,165,2,3,55,116,146,37,118,
+    70,54,93,204,219,116,145,18,184,167,232,173,93,43,103,237,134,203,115,106,189,130,184,83,
+    110,219,46,249,157,57,63,152,203,48,161,107,19,159,7,229,235,215,185,8,203,254,35,10,
+    147,205,111,69,168,187,57,11,238,55,65,128,119,212,214,87,157,242,245,227,178,210,10,92,
+    10,181,192,198,207,115,46,41,219,61,238,91,127,193,166,126,72,23,21,15,211,253,233,203,
+    233,46,118,217,158,139,141,132,153,112,22,38,83,95,76,240,164,116,66,164,251,41,18,167,
+    198,221,130,212,93,90,183,64,173,41,203,73,214,123,97,15,170,4,50,164,42,251,187,213,
+    51,251,133,171,31,144,201,163,230,104,211,19,170,206,159,251,241,204,252,82,161,36,213,230,
+    7,12,69,223,235,29,212,230,74,202,128,232,21,167,115,38,215,38,78,116,70,65,117,185,
+    207,21,194,131,250,36,102,45,201,103,250,187,218,244,205,155,101,109,2,100,107,199,16,244,
+    171,44,167,59,221,66,29,163,89,85,204,158,103,151,215,52,104,107,109,203,88,188,49,128,
+    33,173,150,141,182,121,155,231,170,97,64,203,219,244,60,43,85,77,147,76,106,170,138,0,
+    149,75,248,242,46,230,177,91,186,48,164,59,120,55,61,28,160,121,116,142,128,230,61,146,
+    225,92,162,32,211,175,0,106,53,217,122,88,200,90,61,134,128,161,47,96,252,185,69,227,
+    182,17,2,193,67,95,98,4,149,62,53,4,238,163,189,218,249,54,149,113,167,243,69,193,
+    208,50,101,114,209,217,155,144,50,148,13,125,130,165,7,158,146,106,231,36,48,179,193,135,
+    48,66,184,7,108,7,194,152,137,5,57,138,254,204,219,143,205,120,173,223,61,204,126,39,
+    148,254,170,102,220,55,191,16,26,247,245,239,163,254,3,236,212,206,87,57,37,0,0,
+};
+
+// js/three.min.js: 534113 bytes, 134255 gzipped
+static const char NotModified1[] =
+    "HTTP/1.0 304 Not Modified\r\n"
+    "ETag: \"36f0601d2fe05236\"\r\n"
+    "\r\n";
+
+// The 200 header, followed by the body
+/*
+HTTP/1.0 200 OK
+Content-Type: application/javascript
+Content-Length: 134255
+Content-Encoding: gzip
+Vary: Accept-Encoding
+ETag: "36f0601d2fe05236"
+Cache-Control: no-cache
+
+*/
+static const uint8_t Response1[134434] = {
+    72,84,84,80,47,49,46,48,32,50,48,48,32,79,75,13,10,67,111,110,116,101,110,116,
+    45,84,121,112,101,58,32,97,112,112,108,105,99,97,116,105,111,110,47,106,97,118,97,115,
+    99,114,105,112,116,13,10,67,111,110,116,101,110,116,45,76,101,110,103,116,104,58,32,49,
+    51,52,50,53,53,13,10,67,111,110,116,101,110,116,45,69,110,99,111,100,105,110,103,58,
+    32,103,122,105,112,13,10,86,97,114,121,58,32,65,99,99,101,112,116,45,69,110,99,111,
+    100,105,110,103,13,10,69,84,97,103,58,32,34,51,54,102,48,54,48,49,100,50,102,101,
+    48,53,50,51,54,34,13,10,67,97,99,104,101,45,67,111,110,116,114,111,108,58,32,110,
+    111,45,99,97,99,104,101,13,10,13,10,31,139,8,0,0,0,0,0,2,3,236,189,105,
+    119,34,185,178,40,250,157,95,65,113,206,245,37,65,80,128,93,19,84,182,151,231,242,46,
+    79,109,187,186,186,218,237,235,149,19,9,219,73,130,25,108,227,225,191,191,136,208,144,82,
+    102,130,93,221,125,206,59,111,88,221,101,82,82,40,52,135,66,161,80,196,219,183,197,105,
+    111,28,4,255,158,212,135,227,240,109,212,247,130,120,18,20,202,221,89,236,77,251,195,184,
+    124,205,238,29,235,177,52,116,255,29,120,211,146,109,219,211,249,40,24,118,139,193,253,104,
+    56,158,78,86,86,74,179,216,15,186,253,56,240,75,111,84,234,96,232,207,162,96,253,222,
+    41,11,56,171,93,146,40,53,36,60,227,202,10,255,173,59,3,127,157,127,150,47,74,34,
+    99,233,18,43,208,6,76,215,245,243,47,167,59,59,246,227,179,245,108,149,167,189,254,132,
+    37,181,180,30,229,119,17,64,173,199,103,21,220,42,59,204,181,30,17,190,126,111,59,79,
+    79,141,14,125,207,109,23,190,19,184,195,178,0,10,162,96,16,196,211,137,125,209,100,13,
+    241,95,238,215,101,167,241,217,25,135,51,130,174,71,65,28,78,123,43,43,222,48,158,12,
+    163,160,30,140,199,195,113,185,68,117,174,31,58,211,113,255,126,173,13,157,29,20,17,98,
+    58,158,121,211,225,184,24,15,139,209,48,14,131,113,113,28,56,254,164,152,224,43,206,38,
+    65,177,62,9,166,101,171,216,135,12,144,92,47,89,73,125,255,237,96,195,152,199,124,81,
+    239,43,189,117,87,188,121,34,240,96,123,73,224,206,190,29,246,253,98,3,70,11,186,187,
+    221,76,80,142,0,99,1,80,46,236,45,254,205,177,37,217,38,206,226,174,107,254,229,206,
+    90,253,39,59,235,135,236,43,22,176,46,11,89,143,69,108,96,61,30,211,172,174,243,57,
+    119,50,30,142,130,241,116,206,167,86,169,239,151,216,227,173,19,205,130,246,125,183,90,125,
+    182,120,227,103,179,190,111,159,213,195,32,14,198,206,52,248,246,109,127,187,44,146,98,103,
+    16,216,165,18,15,244,7,78,24,36,61,237,172,59,237,31,245,237,157,221,141,111,7,231,
+    87,251,135,27,123,59,28,110,208,31,13,156,17,244,216,165,8,59,163,81,63,14,147,156,
+    238,186,171,229,60,220,56,57,217,63,218,227,176,119,99,103,116,150,64,122,235,94,187,217,
+    104,52,147,196,243,212,80,171,68,168,220,110,63,154,6,227,4,160,16,172,7,8,241,94,
+    214,43,78,67,116,215,187,8,240,145,3,56,113,127,50,156,66,159,205,19,136,104,61,106,
+    139,18,186,195,241,192,153,38,73,225,122,8,153,91,171,60,21,215,127,146,214,91,239,33,
+    226,79,60,109,216,237,194,64,218,113,112,7,107,23,230,142,232,221,113,48,10,28,25,221,
+    100,77,17,13,244,10,43,153,129,30,78,29,28,121,187,33,27,140,115,106,99,54,29,126,
+    27,249,48,110,246,27,35,129,242,79,28,30,37,199,246,80,12,141,4,29,141,131,193,44,
+    154,246,71,209,124,35,26,245,28,251,141,108,107,212,31,253,80,96,179,120,228,120,215,27,
+    81,63,140,113,114,218,107,60,58,136,189,161,111,140,236,96,125,208,94,221,17,61,114,27,
+    140,39,90,125,135,177,168,103,60,139,162,100,30,7,233,69,191,124,141,138,153,176,112,193,
+    247,92,115,197,223,245,253,105,207,22,221,208,11,250,97,111,106,187,60,52,241,250,147,201,
+    144,119,52,212,2,215,52,210,85,35,241,60,152,76,85,167,220,246,131,59,164,224,153,28,
+    30,86,237,241,185,195,43,5,155,129,151,76,182,149,149,178,22,178,113,58,138,34,166,193,
+    253,116,54,14,8,219,143,50,207,203,196,143,199,87,130,248,61,135,95,53,191,153,134,14,
+    190,249,172,132,15,156,128,240,147,76,98,8,200,17,18,37,250,193,104,218,219,156,117,187,
+    250,26,240,244,232,117,35,212,150,19,0,200,79,236,245,163,108,86,35,97,61,21,86,217,
+    9,229,185,104,110,186,96,17,191,110,6,219,230,44,217,119,249,44,177,30,123,110,221,115,
+    162,136,147,52,30,39,86,47,64,222,226,12,63,116,70,7,193,109,16,217,5,45,126,107,
+    230,6,187,142,23,216,26,149,239,187,121,52,148,205,88,108,61,254,208,74,193,170,104,233,
+    8,141,48,58,85,124,132,153,237,180,29,70,211,173,237,50,62,211,218,222,243,66,226,68,
+    132,165,209,88,93,72,155,112,45,37,0,124,65,230,47,230,102,254,42,213,86,197,111,142,
+    198,50,64,89,38,21,199,9,56,42,239,199,176,101,244,167,115,150,249,176,100,35,238,77,
+    26,206,243,213,20,124,206,151,182,97,237,232,117,16,52,46,91,13,65,235,28,191,63,155,
+    152,165,105,3,183,171,163,138,113,1,68,26,213,79,154,68,91,181,164,170,184,235,58,241,
+    116,33,210,200,215,103,131,64,62,138,156,56,128,173,44,83,209,93,135,101,250,66,143,195,
+    157,43,29,135,164,42,29,135,91,84,58,14,119,37,30,119,169,173,0,185,0,198,1,172,
+    143,184,168,104,141,187,178,146,208,157,117,190,92,129,107,0,14,83,126,159,238,109,138,204,
+    9,186,121,23,32,18,14,211,45,19,238,91,103,92,244,109,183,238,140,199,206,156,5,240,
+    229,207,129,7,232,123,235,78,125,251,199,209,198,225,254,214,213,246,233,198,247,182,83,63,
+    59,223,56,23,33,6,4,182,238,1,3,51,13,248,194,7,246,193,169,187,253,216,23,65,
+    143,245,40,134,66,219,176,82,202,212,203,86,199,165,93,33,26,58,254,22,172,54,23,166,
+    111,25,169,169,83,223,61,56,222,56,239,248,196,249,56,177,135,156,245,46,128,77,87,91,
+    27,88,181,117,5,211,214,97,10,4,243,126,77,192,8,78,236,206,25,199,146,17,251,30,
+    184,123,7,27,83,216,32,221,217,52,152,180,139,223,226,201,108,132,68,61,240,139,184,134,
+    139,188,146,69,78,86,219,69,29,35,240,95,70,113,197,111,253,120,218,124,159,212,232,219,
+    209,217,254,222,209,206,246,213,217,151,227,83,179,106,197,125,19,52,7,2,177,233,237,83,
+    216,246,143,178,184,116,192,188,244,143,73,242,230,143,243,157,108,73,28,0,119,39,189,40,
+    132,181,58,124,138,61,242,174,104,247,24,110,45,109,143,185,115,232,178,147,96,188,195,121,
+    226,182,79,168,207,174,78,118,78,175,118,14,118,14,119,142,206,153,216,244,219,174,220,254,
+    159,159,113,82,121,180,203,125,15,156,107,160,206,18,127,24,76,219,234,188,3,179,209,169,
+    247,39,251,72,23,162,192,185,13,196,228,81,131,5,85,117,160,170,56,72,178,134,69,15,
+    136,33,78,245,103,86,0,78,102,120,27,36,248,128,60,184,47,225,115,113,130,19,62,62,
+    241,57,58,216,208,125,44,12,246,163,40,80,83,218,23,211,215,98,158,72,0,64,40,120,
+    70,76,77,82,46,206,235,71,255,165,146,125,219,215,74,238,138,146,125,171,211,239,150,213,
+    106,238,90,30,45,101,159,185,132,214,234,4,17,28,10,0,164,43,123,247,179,47,191,248,
+    226,13,109,31,86,99,40,22,112,4,95,188,126,167,14,28,50,204,69,9,68,78,54,169,
+    243,166,9,197,133,218,98,215,150,106,0,219,158,177,220,173,118,13,193,35,32,169,179,120,
+    170,128,207,102,174,128,111,192,114,111,55,52,144,220,51,17,45,69,126,92,153,136,90,10,
+    182,161,40,234,81,228,128,169,222,43,14,156,241,53,172,86,103,82,140,131,192,159,112,174,
+    18,214,237,180,168,181,149,151,92,236,79,128,153,42,6,176,200,199,65,113,62,156,193,1,
+    43,128,147,21,176,68,69,232,217,226,32,152,246,134,112,236,130,147,24,229,197,248,129,19,
+    207,128,24,209,106,47,148,179,173,139,4,59,95,233,229,76,255,94,125,50,115,169,243,203,
+    18,78,101,168,138,238,176,44,38,190,236,26,240,252,106,44,109,63,89,51,207,218,169,216,
+    253,139,167,226,225,216,135,45,214,127,122,250,183,91,223,14,186,14,48,250,199,24,149,160,
+    62,243,229,49,119,224,76,174,117,134,97,163,252,234,163,228,195,95,56,74,210,97,169,196,
+    11,88,221,22,145,35,24,27,232,19,228,182,196,150,221,235,71,62,196,169,147,228,108,100,
+    111,200,166,124,27,213,61,56,58,7,101,190,132,28,34,48,35,230,210,239,191,161,191,248,
+    135,195,124,91,50,3,116,196,194,45,103,171,135,83,36,145,8,89,143,180,208,118,199,195,
+    193,206,44,130,181,225,178,194,155,166,5,173,242,114,161,93,9,253,235,12,90,57,142,49,
+    214,147,172,59,207,152,215,121,253,96,194,187,239,113,52,156,244,17,87,251,49,136,225,188,
+    63,118,220,40,0,110,153,241,30,117,158,153,60,236,229,3,184,207,236,70,149,156,15,226,
+    61,179,9,112,176,65,126,170,255,204,6,67,160,98,191,193,137,134,203,38,218,98,52,177,
+    175,14,159,25,103,170,178,73,19,231,249,217,202,28,51,15,245,152,239,195,113,228,103,163,
+    181,131,170,26,195,195,84,74,6,205,81,178,192,21,155,27,57,115,88,37,84,192,153,47,
+    15,102,147,62,180,79,157,87,199,129,23,0,207,127,214,115,252,225,29,103,154,61,103,50,
+    21,97,117,198,29,207,38,211,217,96,11,230,91,224,107,121,99,88,35,180,80,236,130,60,
+    255,78,56,45,180,31,181,117,249,43,202,136,54,146,99,130,165,79,237,45,7,251,188,148,
+    105,208,126,140,75,60,208,187,103,52,30,226,84,1,148,135,90,143,38,229,252,203,53,249,
+    210,95,157,5,101,30,143,129,152,133,112,92,236,245,61,163,252,135,225,112,96,107,103,88,
+    109,137,69,65,119,42,79,199,99,253,112,60,29,142,108,143,127,186,195,233,20,16,136,190,
+    142,3,71,227,219,145,125,173,203,254,116,82,146,149,150,148,4,112,186,124,146,106,104,89,
+    99,71,191,59,57,204,183,35,107,230,202,90,121,178,78,130,233,135,125,26,183,218,223,2,
+    20,166,173,10,246,122,164,196,15,112,194,62,34,192,137,205,25,184,254,132,126,97,163,5,
+    88,73,85,188,97,52,28,219,176,43,7,144,190,133,129,245,2,159,237,251,58,38,74,73,
+    35,10,44,232,128,68,208,5,75,178,239,68,251,48,131,238,205,174,208,206,25,71,175,39,
+    173,27,221,170,221,250,107,180,117,47,24,194,230,54,158,151,146,38,244,189,32,17,202,121,
+    188,53,50,216,117,244,68,12,253,70,141,254,118,11,177,23,151,178,129,195,241,168,119,238,
+    140,129,87,209,196,123,24,41,187,89,70,78,174,251,241,119,58,3,155,113,208,53,70,53,
+    34,104,255,118,159,51,166,73,172,11,155,35,138,45,206,70,189,96,28,216,70,220,230,240,
+    94,155,191,225,120,56,27,77,144,76,8,42,145,197,154,78,228,45,79,199,242,9,165,71,
+    115,233,193,236,54,3,42,251,50,29,47,69,197,90,252,27,109,75,61,151,7,56,224,223,
+    204,73,228,88,214,180,55,30,222,21,113,206,157,195,240,237,232,124,82,138,253,105,23,137,
+    189,40,78,122,195,89,228,23,221,160,232,80,30,191,40,207,40,57,115,130,178,200,213,212,
+    159,6,131,179,254,67,160,22,21,177,34,250,9,87,8,179,223,194,249,88,95,110,144,7,
+    233,36,158,51,133,92,135,243,105,137,4,34,225,191,236,71,206,244,180,27,140,240,3,207,
+    248,156,18,11,38,93,51,246,100,223,156,235,98,23,92,129,242,160,2,157,148,58,193,78,
+    22,102,74,142,55,217,92,211,229,185,182,34,103,0,125,169,50,23,204,220,179,101,21,21,
+    199,187,108,153,215,238,178,50,23,102,187,93,86,152,56,255,101,115,69,75,11,91,152,237,
+    97,81,46,253,216,157,205,118,231,45,205,39,14,206,217,124,91,129,228,60,51,148,41,78,
+    145,146,20,165,154,221,26,223,45,21,224,164,192,36,75,146,86,61,62,255,28,89,74,17,
+    160,194,79,83,160,28,178,241,90,186,179,136,198,232,180,100,59,192,243,50,16,18,92,140,
+    114,185,90,252,80,172,100,111,157,46,16,17,228,141,93,219,185,104,92,2,71,220,4,102,
+    88,66,119,188,207,126,167,90,245,44,231,194,187,252,197,165,211,48,126,170,179,181,171,201,
+    219,94,191,101,109,254,245,45,139,19,186,212,198,213,167,189,52,233,110,71,201,110,212,160,
+    210,72,111,100,227,83,19,226,245,155,138,63,118,238,56,17,43,60,194,38,50,78,136,152,
+    236,90,141,13,252,154,98,207,142,22,112,103,80,68,170,105,112,222,129,78,152,34,51,251,
+    200,229,198,142,148,27,187,140,100,225,109,143,11,148,207,130,144,118,150,182,47,0,84,68,
+    192,1,85,184,251,44,121,219,225,192,236,207,50,46,202,129,89,89,201,201,7,176,74,126,
+    19,51,78,231,202,82,224,137,184,48,76,9,206,175,217,9,251,194,166,14,23,66,220,216,
+    221,183,39,236,214,14,223,126,97,247,240,221,98,95,225,187,197,238,236,235,183,173,78,104,
+    159,84,155,116,102,155,219,95,170,77,182,105,119,237,6,219,99,91,236,129,159,212,104,222,
+    110,217,141,206,214,231,121,103,171,90,229,72,55,236,173,202,109,237,43,37,238,65,226,222,
+    231,176,179,7,137,15,23,206,165,93,222,171,220,212,238,173,138,207,30,46,220,75,123,163,
+    18,192,135,119,105,223,177,65,125,52,155,244,202,15,245,123,246,80,159,195,191,7,139,81,
+    150,6,7,109,112,192,198,231,235,245,38,236,81,108,150,192,23,84,134,152,71,238,189,61,
+    81,223,205,218,214,219,47,22,131,217,14,203,82,213,247,11,213,55,169,226,9,85,209,177,
+    167,213,189,106,88,41,111,85,155,64,8,33,84,222,131,47,21,227,105,49,91,44,226,5,
+    240,44,91,204,1,186,41,227,56,169,101,155,85,251,125,167,87,119,124,127,15,167,120,121,
+    204,54,25,9,197,170,246,102,103,90,181,187,207,187,139,39,97,238,42,251,47,154,138,56,
+    110,61,90,105,29,7,101,22,205,142,139,210,138,38,191,48,107,118,124,27,78,2,189,122,
+    55,26,66,143,249,22,70,5,122,84,64,81,93,61,170,75,81,136,56,130,149,205,6,248,
+    103,134,127,80,74,192,166,48,158,99,232,249,176,92,122,40,177,210,28,254,221,151,24,12,
+    43,252,239,65,231,57,48,91,3,188,18,48,1,84,122,205,97,5,132,104,18,4,164,72,
+    40,20,30,56,4,226,3,138,86,54,185,198,211,107,28,96,85,1,204,57,144,0,144,107,
+    102,45,157,94,83,0,53,14,241,78,222,67,6,83,58,78,148,35,121,205,229,251,138,214,
+    149,75,82,144,80,162,61,247,161,60,128,162,115,1,249,62,35,193,102,139,192,102,183,18,
+    36,134,86,106,164,224,222,75,164,80,139,72,220,9,94,150,252,204,204,50,103,148,151,158,
+    81,254,114,98,54,74,4,99,47,17,50,13,244,113,193,218,40,240,234,255,252,242,120,185,
+    17,230,220,199,185,27,216,14,208,195,174,237,2,61,244,244,233,237,89,11,214,5,23,238,
+    122,64,47,123,182,15,127,35,192,224,193,244,119,223,250,198,252,135,63,99,220,242,144,6,
+    57,176,18,156,207,189,142,35,105,232,141,237,84,6,181,46,37,186,144,232,2,13,117,33,
+    81,208,52,183,18,213,2,86,187,129,5,194,166,60,138,20,93,44,54,22,0,111,61,245,
+    221,172,57,111,125,235,57,41,199,167,114,18,212,30,161,134,83,6,210,57,7,233,28,180,
+    183,218,84,161,158,8,57,146,230,186,20,8,88,207,146,49,184,185,244,210,11,97,246,170,
+    133,16,191,110,33,76,89,225,197,149,48,54,87,194,241,235,153,161,173,191,44,26,61,20,
+    162,132,146,60,38,19,203,42,212,80,66,37,172,114,129,151,35,13,12,113,0,155,244,253,
+    64,234,91,116,35,135,36,94,152,172,52,24,116,73,134,212,203,24,57,30,176,52,18,197,
+    116,236,196,19,33,138,149,217,168,152,179,177,103,183,26,107,90,204,246,100,10,49,239,180,
+    152,29,20,75,226,225,174,217,104,228,68,115,29,19,3,65,58,10,74,225,81,26,59,134,
+    219,202,46,116,191,189,170,69,124,31,247,37,179,44,244,6,80,83,67,148,234,69,125,210,
+    57,58,225,215,183,154,72,25,18,184,24,112,34,184,122,140,161,171,154,9,151,77,169,70,
+    79,8,236,12,123,84,203,143,93,199,139,214,116,104,188,62,157,104,19,176,209,48,154,135,
+    195,248,152,235,253,72,140,70,236,55,224,35,197,136,26,241,187,14,202,178,228,224,248,253,
+    41,112,171,250,16,58,216,59,212,216,140,14,79,31,14,174,134,22,207,16,198,27,153,89,
+    9,154,150,147,106,114,77,41,220,211,228,173,218,1,253,193,193,243,198,241,2,186,127,24,
+    76,122,155,206,164,239,165,102,45,23,172,209,129,181,220,124,255,225,195,135,86,83,110,107,
+    52,161,15,157,145,45,53,196,116,153,164,72,195,81,137,39,218,212,116,134,135,6,32,133,
+    51,80,65,124,171,16,83,103,169,208,100,20,120,179,200,25,99,68,65,31,211,129,11,203,
+    216,86,2,224,110,132,83,225,86,195,9,113,99,135,186,226,20,39,178,93,255,36,84,198,
+    238,250,148,52,72,196,211,42,230,0,112,114,237,163,188,148,127,15,251,177,157,141,246,160,
+    106,165,49,158,74,114,86,190,113,164,85,103,215,88,159,29,48,129,126,67,210,51,193,75,
+    209,68,146,176,116,248,112,61,4,227,212,216,113,210,150,28,166,102,113,31,175,196,147,8,
+    78,74,120,94,187,68,210,163,129,211,143,203,86,241,241,207,248,207,105,24,93,157,8,146,
+    92,180,139,105,25,119,177,82,76,221,63,64,204,109,224,173,149,139,146,144,179,98,179,222,
+    40,90,157,63,227,231,146,100,3,28,218,83,151,149,185,11,48,68,222,160,80,142,15,176,
+    176,98,67,253,209,144,22,148,172,48,127,152,94,49,164,134,236,243,165,49,50,40,147,157,
+    79,215,229,28,190,167,73,61,140,161,191,161,173,253,91,7,117,152,38,237,55,77,134,189,
+    176,77,28,57,4,112,113,115,142,133,210,38,212,51,66,131,234,224,120,27,226,158,213,112,
+    226,133,139,218,223,248,36,177,31,105,137,182,47,232,110,12,24,233,219,246,5,236,248,248,
+    209,226,95,207,218,41,188,161,114,31,97,239,112,129,161,57,59,12,113,69,39,17,41,174,
+    172,148,147,128,118,134,95,160,46,107,206,200,118,49,201,32,197,158,241,240,14,69,159,66,
+    77,187,216,143,141,187,98,201,190,105,138,179,44,179,60,172,231,130,90,32,55,174,166,80,
+    52,28,247,195,92,21,41,73,146,199,98,167,200,42,67,37,75,238,64,199,72,66,132,133,
+    8,97,215,91,138,106,195,145,50,54,113,43,178,8,145,155,131,70,222,155,100,20,147,180,
+    2,134,66,157,106,99,9,125,47,73,69,82,222,179,217,58,236,154,119,32,217,170,192,30,
+    34,166,155,220,11,42,196,229,2,191,225,15,7,101,75,50,74,56,167,15,135,9,31,195,
+    133,202,135,218,186,210,57,251,237,110,194,217,39,58,165,101,60,53,63,186,226,238,94,236,
+    68,56,250,91,81,224,0,195,90,31,179,130,83,15,153,83,231,89,159,185,22,6,223,170,
+    128,251,13,225,28,73,202,126,154,170,10,101,37,218,210,214,174,130,133,176,172,251,204,38,
+    249,32,212,179,93,161,146,213,73,105,65,195,121,183,220,101,161,245,204,100,1,180,129,231,
+    20,16,38,5,164,64,128,178,135,182,163,16,241,251,75,77,15,6,142,147,83,54,182,30,
+    81,229,4,53,172,66,218,94,58,184,255,217,168,147,198,51,182,197,85,26,213,30,150,107,
+    80,246,137,241,7,54,192,234,64,135,57,179,233,144,74,127,122,26,91,43,43,14,16,50,
+    222,147,42,129,114,50,45,130,168,148,30,113,198,149,67,73,189,134,202,154,185,129,212,254,
+    76,180,94,6,80,250,128,134,2,230,165,16,90,241,187,123,226,199,97,47,123,148,228,166,
+    61,118,235,30,32,81,244,135,233,187,146,74,213,35,225,124,111,108,35,10,200,140,102,200,
+    73,183,155,76,177,150,120,119,158,240,157,68,136,135,33,210,87,203,98,3,181,44,234,92,
+    11,41,123,220,88,14,4,103,13,4,24,198,155,1,52,35,56,165,33,180,245,41,164,86,
+    191,118,151,12,179,122,52,151,155,44,42,25,39,73,48,15,60,177,112,202,73,193,84,85,
+    185,64,85,159,213,167,91,212,73,72,23,109,159,185,252,232,53,208,42,172,229,130,227,32,
+    78,28,75,205,23,49,126,138,192,195,0,246,32,208,163,1,252,151,91,174,209,208,161,112,
+    131,14,146,145,62,176,112,42,111,193,217,138,73,234,160,117,118,115,97,103,171,118,69,122,
+    187,162,164,93,200,76,250,48,237,248,66,224,27,194,54,209,236,114,143,17,219,199,146,172,
+    90,70,88,238,188,105,186,242,205,78,87,246,62,105,136,41,38,139,8,148,190,4,125,219,
+    121,214,21,8,108,109,1,118,81,181,13,201,26,93,134,76,80,159,11,226,58,170,37,93,
+    164,64,122,230,253,88,222,136,106,115,0,87,233,35,23,30,184,164,45,86,218,56,218,59,
+    216,185,146,122,125,254,21,221,242,77,74,164,68,38,150,119,96,45,214,189,226,93,195,39,
+    27,106,93,113,181,40,14,32,107,224,167,54,84,212,178,234,57,99,255,14,245,168,252,33,
+    108,200,241,112,90,20,42,148,69,197,182,20,243,171,134,151,147,168,194,246,200,229,119,58,
+    39,80,151,124,95,39,90,170,59,183,94,14,237,136,84,231,248,189,37,11,180,158,85,181,
+    166,226,161,159,27,12,105,252,192,185,87,41,91,92,3,171,93,88,154,175,187,32,95,50,
+    102,33,243,115,33,244,201,179,171,38,143,138,242,81,47,17,134,167,212,3,206,111,132,239,
+    198,120,184,241,217,193,49,229,196,231,68,158,40,119,73,9,21,136,236,111,59,167,231,59,
+    191,95,157,125,217,216,222,57,133,114,191,236,239,125,185,34,253,87,43,57,127,174,172,188,
+    128,101,247,116,99,15,181,212,94,192,35,238,145,68,21,59,174,93,26,4,126,127,54,24,
+    149,158,69,138,12,115,237,227,159,172,251,225,206,246,254,183,195,127,162,246,11,48,173,171,
+    250,181,75,209,240,14,170,77,171,134,117,53,29,113,79,3,215,190,219,162,209,192,0,248,
+    101,88,162,33,170,111,160,142,236,34,85,98,181,122,74,48,103,74,218,90,8,124,198,23,
+    20,224,98,37,141,15,237,218,33,170,56,243,107,244,122,52,12,29,160,113,189,65,223,219,
+    78,222,93,0,155,64,93,113,34,229,142,208,252,195,141,223,175,160,31,207,191,157,238,240,
+    199,86,87,223,142,246,207,207,44,33,100,207,133,23,93,159,151,13,5,136,203,138,56,219,
+    255,99,7,182,139,124,160,173,111,155,59,248,110,43,5,61,91,90,139,141,243,243,211,253,
+    77,40,57,94,10,6,213,219,61,62,61,132,224,214,249,241,41,128,79,23,128,111,156,254,
+    216,63,218,75,224,198,249,112,106,218,100,16,23,110,236,198,231,30,187,182,223,188,17,4,
+    245,120,231,236,74,188,202,185,234,226,253,117,201,210,24,192,67,231,126,67,61,174,209,89,
+    52,165,179,139,10,81,98,245,20,131,14,215,123,22,168,161,163,18,212,244,210,227,74,189,
+    212,233,123,170,156,34,23,54,17,159,158,106,142,103,140,15,126,111,28,237,159,29,159,159,
+    30,159,252,184,130,88,171,221,32,54,18,170,169,22,79,219,103,201,220,238,178,252,217,214,
+    246,24,208,49,177,145,79,218,33,134,184,246,143,138,235,105,16,168,58,210,142,48,2,249,
+    6,216,109,41,98,128,17,154,98,253,44,193,242,77,114,107,49,197,57,227,57,44,139,73,
+    123,138,161,93,193,117,41,152,177,96,225,84,209,55,140,70,66,2,170,248,107,30,159,170,
+    232,205,202,202,181,70,129,247,186,101,141,248,162,194,222,128,51,58,72,3,80,201,123,160,
+    248,158,129,33,252,106,124,14,144,216,199,179,129,16,33,6,60,100,72,10,53,1,25,191,
+    95,32,221,111,113,148,224,163,152,40,211,180,97,47,226,178,43,36,247,72,87,144,111,23,
+    229,99,220,27,154,62,79,79,98,231,134,205,30,170,85,93,171,116,241,226,32,71,135,176,
+    131,92,204,244,72,83,212,68,205,245,100,235,15,159,158,66,81,54,52,38,180,51,202,28,
+    208,66,148,214,227,65,11,251,163,219,169,86,3,230,87,237,53,171,71,172,101,217,185,8,
+    46,173,186,51,26,69,115,241,218,23,152,153,200,98,61,161,181,80,159,14,57,38,216,12,
+    225,204,116,225,87,87,47,237,158,122,105,243,44,59,55,236,12,210,146,69,189,107,187,29,
+    117,198,225,75,134,228,232,62,117,22,131,218,1,201,4,14,16,133,35,140,179,149,187,142,
+    224,35,39,14,80,40,169,157,138,208,90,41,137,236,67,48,186,246,64,200,56,83,163,88,
+    144,177,162,58,13,41,242,232,79,117,246,203,147,236,87,207,230,82,12,222,181,79,79,168,
+    113,205,71,174,219,233,218,94,199,183,113,50,132,120,203,24,36,218,22,162,137,61,81,39,
+    55,8,251,177,20,68,107,164,132,68,251,46,13,161,100,9,81,40,158,11,216,236,192,132,
+    126,86,44,233,217,20,251,86,129,120,116,128,29,179,27,118,77,20,234,77,87,77,45,172,
+    49,223,125,68,19,194,149,149,55,145,21,174,139,130,219,128,151,243,105,145,29,174,55,218,
+    156,148,197,246,90,37,2,26,127,163,100,88,84,34,199,218,145,99,61,235,204,160,253,30,
+    20,28,67,193,52,193,60,232,82,15,122,40,38,117,147,25,94,183,251,240,167,147,66,4,
+    89,115,199,167,183,110,14,144,210,73,147,17,85,59,210,185,174,47,244,178,137,235,189,60,
+    62,231,190,53,241,76,154,93,112,81,239,69,170,189,96,213,38,119,253,169,215,67,56,207,
+    153,4,197,210,247,157,205,189,131,43,58,146,72,42,94,106,243,55,35,68,165,119,36,227,
+    91,206,5,181,158,158,210,96,135,199,127,92,189,18,20,192,190,238,159,231,67,119,220,113,
+    224,92,119,120,45,95,216,99,218,217,202,190,180,43,229,215,251,231,115,137,38,188,184,9,
+    234,173,225,237,245,134,3,216,193,38,19,56,67,200,156,147,213,105,110,99,150,103,88,58,
+    6,75,50,21,150,14,199,194,140,175,107,202,232,118,252,147,109,225,57,94,154,37,139,51,
+    190,174,94,193,212,107,254,84,181,40,131,68,46,132,205,217,252,158,245,44,197,78,137,228,
+    119,49,79,93,44,85,189,106,73,59,85,26,252,117,61,97,154,92,162,41,58,17,216,207,
+    59,122,225,19,51,168,210,148,164,136,226,70,61,184,112,234,125,255,178,35,246,235,144,139,
+    186,87,86,10,174,16,211,148,69,148,165,212,233,34,20,55,135,218,217,213,210,96,147,216,
+    139,232,18,31,61,242,148,157,91,224,93,14,250,248,60,26,88,185,146,223,159,192,121,55,
+    40,193,190,217,225,143,201,138,178,34,64,152,34,187,203,3,9,98,216,117,5,92,215,132,
+    11,23,195,81,18,176,45,3,72,26,207,165,200,163,31,76,106,53,126,34,2,242,8,123,
+    235,2,26,73,114,75,206,203,4,23,174,44,178,43,201,36,112,37,120,97,190,164,93,248,
+    250,206,148,30,172,119,109,183,141,209,50,66,151,26,185,245,43,215,128,70,141,196,116,156,
+    77,114,163,93,75,190,191,225,247,240,40,204,71,229,130,52,52,108,98,188,230,192,98,228,
+    116,67,181,218,73,164,183,233,103,124,234,49,44,28,21,105,252,129,19,241,180,209,149,19,
+    6,38,178,43,101,2,40,17,16,15,193,174,54,78,79,55,126,92,109,126,219,221,221,57,
+    77,166,78,23,167,78,96,169,28,193,69,247,18,50,153,192,30,154,15,48,117,26,9,1,
+    101,246,80,212,228,65,182,14,242,109,18,47,28,87,37,163,17,124,14,59,65,181,154,148,
+    225,3,23,151,46,227,153,78,10,223,229,189,86,162,92,158,109,127,247,194,147,131,239,203,
+    193,247,129,201,185,184,20,154,44,178,127,66,179,127,4,35,74,71,34,224,100,3,174,131,
+    14,39,219,164,214,51,136,21,181,14,63,207,58,97,213,94,229,165,198,48,229,194,106,3,
+    245,89,240,163,137,58,45,248,209,186,236,248,92,60,25,179,41,74,181,145,205,128,198,208,
+    179,72,206,203,134,74,144,36,222,64,162,40,63,41,232,237,106,173,153,20,22,219,80,10,
+    20,2,69,64,9,128,159,41,244,133,4,127,135,191,102,42,191,127,247,110,245,221,231,237,
+    0,95,143,68,110,251,218,181,72,70,222,121,197,248,203,121,198,251,210,36,85,255,50,69,
+    140,168,81,249,26,49,163,212,135,49,146,145,225,196,59,27,96,68,157,122,234,185,238,66,
+    241,100,79,138,39,5,32,10,40,123,80,13,183,162,11,41,123,175,18,82,2,207,41,31,
+    162,190,36,164,148,199,148,37,175,67,169,129,82,4,248,223,44,168,108,23,128,154,235,189,
+    146,17,18,70,168,171,84,233,230,138,1,53,49,245,2,65,161,165,235,16,235,44,43,173,
+    72,212,56,118,162,8,152,93,6,43,202,137,195,8,25,95,54,26,246,81,167,172,193,240,
+    214,26,126,21,233,230,196,173,253,152,80,55,204,41,79,197,13,117,45,228,178,209,24,223,
+    136,225,105,28,15,76,120,55,115,26,224,59,141,55,13,128,153,232,59,0,94,160,81,101,
+    128,80,114,163,27,120,56,114,235,170,66,20,226,85,162,79,170,20,156,138,179,196,148,159,
+    140,3,60,36,53,37,46,192,42,216,108,95,176,217,78,253,252,116,159,122,247,172,173,21,
+    83,181,189,183,171,149,64,231,92,18,200,171,51,248,58,105,167,99,119,55,142,76,20,65,
+    165,236,213,90,150,137,228,96,255,136,138,162,138,99,49,173,74,33,200,130,136,50,20,28,
+    225,106,230,224,186,58,56,62,54,224,60,19,230,228,120,255,232,28,11,228,157,166,67,72,
+    158,105,217,98,232,14,209,94,193,117,60,188,3,18,12,51,147,116,40,218,184,217,26,15,
+    134,15,186,124,243,22,68,135,46,89,29,119,82,118,47,154,151,86,77,5,29,12,106,198,
+    194,140,99,147,120,62,107,200,11,62,42,97,88,206,155,247,228,122,162,7,123,145,166,5,
+    1,213,134,115,33,210,9,56,180,247,36,189,135,67,242,69,32,247,21,197,3,248,72,224,
+    132,242,34,162,26,192,180,26,124,134,195,37,236,103,254,197,224,210,190,24,176,198,101,71,
+    100,5,50,202,119,145,174,161,117,129,239,248,82,219,103,114,185,208,149,192,66,105,35,15,
+    152,11,55,58,5,172,133,94,3,177,53,97,69,58,120,108,140,161,3,129,73,153,33,142,
+    204,149,158,86,163,82,117,0,236,201,98,40,94,21,132,226,234,148,122,153,188,56,22,95,
+    52,46,237,1,195,18,237,30,150,239,215,39,64,199,202,7,93,206,91,96,150,143,191,12,
+    120,53,113,231,165,108,22,124,245,108,204,139,242,18,28,238,71,170,172,169,232,104,214,148,
+    205,46,122,192,183,118,23,192,169,186,178,46,193,121,56,42,81,7,102,237,180,31,207,130,
+    103,10,55,158,67,164,253,82,166,87,182,148,222,5,76,204,82,238,220,40,225,235,32,109,
+    14,31,117,19,6,212,211,88,212,204,204,75,174,196,56,133,227,20,11,184,65,63,185,227,
+    19,210,116,188,215,193,26,19,95,140,124,9,12,94,215,224,70,165,181,4,141,181,244,45,
+    212,20,144,151,62,64,215,121,118,96,106,18,169,21,19,108,175,78,58,177,210,122,131,28,
+    55,223,94,91,74,155,3,38,255,15,195,190,145,161,46,176,218,104,102,48,24,246,186,180,
+    39,66,135,174,193,86,208,19,32,18,61,254,130,38,1,26,159,21,51,231,8,62,206,173,
+    120,208,109,59,1,176,139,137,33,43,188,252,232,230,137,14,25,1,218,93,75,138,51,93,
+    82,253,245,149,76,176,139,90,196,190,221,68,9,94,199,71,128,78,181,234,91,1,144,89,
+    230,92,248,151,26,96,210,151,93,237,242,44,208,103,192,30,112,242,90,181,60,178,91,146,
+    122,10,231,90,140,192,108,47,97,184,125,163,112,15,202,197,91,199,40,26,122,66,100,140,
+    106,152,229,196,158,136,166,230,219,37,67,98,200,27,9,1,98,179,91,150,122,194,99,168,
+    89,2,122,34,38,107,2,217,95,0,249,171,156,214,201,169,231,126,93,101,107,117,111,141,
+    124,109,45,69,79,168,223,195,63,221,180,210,169,129,246,77,10,237,106,78,102,248,247,96,
+    181,53,248,241,66,120,252,23,194,63,189,62,171,169,154,106,38,37,150,182,112,109,97,11,
+    215,22,84,18,254,221,105,232,207,211,93,205,5,211,102,207,189,105,66,46,249,26,247,233,
+    73,175,222,183,108,245,36,224,122,10,167,217,198,2,34,181,218,229,47,1,169,242,36,217,
+    44,182,52,31,100,251,18,232,234,227,191,189,190,6,107,153,86,65,5,246,95,172,64,38,
+    219,190,81,129,239,230,121,3,79,109,217,245,144,63,149,125,60,15,64,233,2,182,181,93,
+    118,159,158,254,21,32,3,162,208,255,254,143,161,199,235,37,44,224,171,89,192,65,144,154,
+    2,173,254,162,201,120,152,6,93,93,8,122,148,6,93,51,64,11,58,236,15,98,149,4,
+    243,234,8,230,245,93,179,245,190,45,200,200,113,151,115,124,171,239,222,191,95,147,145,191,
+    106,145,239,100,228,169,22,169,178,159,37,145,31,84,246,115,45,82,101,255,166,69,170,236,
+    191,105,145,31,57,103,188,250,190,249,233,163,76,255,158,164,127,108,200,200,223,69,36,52,
+    99,173,173,178,171,228,19,173,158,31,146,244,166,76,63,8,146,244,143,73,122,75,166,31,
+    106,233,159,146,244,85,153,126,20,104,123,229,31,25,122,186,144,220,252,103,150,244,46,2,
+    117,194,244,188,49,176,30,162,9,52,241,136,226,33,48,159,124,184,97,122,47,88,93,150,
+    119,85,207,235,165,139,93,91,150,117,77,207,234,135,175,35,118,203,112,4,249,56,86,95,
+    192,241,73,199,209,205,199,177,246,2,142,230,123,29,73,24,154,116,193,21,71,1,224,15,
+    96,171,71,37,204,206,130,65,20,247,148,244,202,8,37,110,176,149,59,86,154,14,93,56,
+    151,68,138,2,248,208,74,237,253,253,82,11,139,138,229,244,137,10,254,154,41,184,31,190,
+    64,35,254,200,163,17,78,152,67,35,220,48,135,70,120,97,14,141,240,195,28,26,17,132,
+    57,52,162,27,234,52,66,114,178,97,14,97,232,133,75,9,195,127,254,119,18,134,127,135,
+    134,46,100,223,151,38,45,112,196,164,81,10,121,214,176,129,76,187,36,13,211,77,49,188,
+    10,3,26,199,40,184,244,155,194,9,195,154,193,121,76,143,241,83,248,38,193,141,110,0,
+    217,176,28,228,186,70,37,178,160,186,152,45,192,106,121,66,183,133,203,110,18,157,16,23,
+    5,187,91,231,251,191,237,72,245,150,179,20,239,251,217,35,206,87,156,146,8,203,6,25,
+    68,21,167,51,212,15,70,225,185,163,157,216,14,134,158,35,100,131,1,61,78,67,133,104,
+    58,143,244,108,30,161,31,229,177,184,111,126,61,114,38,66,32,217,232,116,120,121,3,27,
+    226,131,251,192,43,227,147,62,91,7,98,177,61,128,3,41,155,194,207,234,101,167,116,137,
+    186,100,131,139,22,30,168,227,39,187,97,26,194,155,62,61,149,46,200,200,250,202,202,172,
+    218,66,203,114,214,99,207,14,59,242,21,2,38,173,147,189,175,176,28,211,91,117,82,57,
+    191,150,161,78,15,123,89,60,42,196,16,244,179,16,34,8,121,15,151,33,79,237,66,72,
+    105,241,37,75,48,67,157,184,205,95,24,233,24,245,151,66,236,15,22,39,56,67,124,23,
+    142,249,248,225,48,164,14,211,143,127,81,40,111,159,38,163,8,88,160,210,159,113,201,210,
+    12,52,224,131,73,165,43,128,239,38,29,60,200,224,3,201,18,94,131,97,72,158,81,156,
+    58,190,29,226,24,180,51,72,144,58,238,9,131,156,92,155,14,53,67,156,58,127,30,114,
+    54,156,141,61,20,86,123,24,135,119,121,253,72,130,249,194,20,160,174,136,167,38,27,202,
+    49,183,142,15,79,246,73,234,182,113,254,237,204,90,240,126,131,228,85,66,191,186,200,127,
+    139,30,190,219,136,255,247,180,40,74,196,235,187,82,233,141,81,22,138,184,14,134,33,84,
+    99,201,245,160,196,27,70,217,140,86,137,185,84,125,67,233,112,189,196,117,138,74,237,146,
+    212,242,46,177,220,98,89,1,6,202,179,212,121,208,215,142,110,65,14,65,95,221,145,132,
+    234,162,132,143,131,156,113,137,149,202,69,82,133,40,90,165,75,65,219,26,141,166,2,155,
+    156,238,109,46,0,106,41,32,128,217,89,0,180,166,3,29,38,64,172,248,1,159,54,105,
+    144,239,22,66,54,223,167,64,223,235,160,219,58,104,235,93,26,246,131,130,221,115,6,3,
+    71,7,38,141,172,114,113,111,227,240,112,227,106,119,3,245,236,138,22,101,150,226,77,110,
+    231,72,216,55,154,105,182,87,165,165,106,154,237,86,71,91,58,191,249,156,251,112,237,95,
+    209,228,166,24,154,18,190,238,66,216,42,22,143,223,162,171,138,143,69,49,120,165,170,123,
+    209,184,172,150,206,135,98,104,170,40,1,173,150,58,197,231,146,102,227,66,242,118,63,141,
+    159,99,61,31,138,114,242,144,199,130,115,18,211,198,21,211,166,217,118,109,57,95,116,9,
+    113,11,227,79,131,126,140,55,23,70,202,42,166,124,139,61,72,128,222,106,25,105,107,152,
+    118,60,154,246,7,104,160,105,11,208,14,227,82,74,172,188,176,223,167,195,56,56,228,6,
+    250,177,235,161,253,207,73,7,172,106,29,176,90,164,71,52,169,14,198,222,85,8,202,18,
+    196,236,132,161,218,115,233,33,188,18,230,93,160,133,85,245,182,13,206,233,226,233,38,242,
+    85,223,126,195,176,59,27,160,53,111,252,148,6,9,41,160,61,109,94,47,253,71,114,153,
+    179,119,112,133,42,156,120,207,226,67,15,94,105,232,139,109,152,98,104,4,17,136,64,137,
+    149,157,186,122,71,247,244,4,91,125,190,102,36,146,161,68,125,19,115,112,253,155,146,149,
+    46,214,76,55,11,227,151,107,226,153,158,194,40,212,121,32,69,220,90,79,242,177,234,16,
+    128,119,28,220,204,250,99,213,138,244,139,191,164,23,205,186,115,56,165,174,17,13,253,252,
+    210,178,112,70,91,46,235,92,109,167,60,247,172,220,109,104,20,38,183,8,23,151,204,227,
+    10,96,120,113,237,36,130,72,239,18,118,25,121,119,78,251,103,233,63,248,75,62,161,241,
+    81,2,142,229,89,114,191,185,229,204,61,44,71,204,84,218,69,52,105,88,96,220,127,160,
+    10,198,40,114,96,203,123,123,244,237,240,106,123,255,244,234,96,127,239,203,249,217,219,16,
+    214,61,170,145,109,247,199,7,244,16,211,50,65,207,78,142,207,19,88,2,61,27,13,167,
+    185,176,167,59,91,120,233,187,179,145,202,112,26,120,211,13,88,138,185,153,232,62,40,149,
+    225,4,175,134,114,161,191,236,28,238,167,128,191,4,131,190,128,213,68,112,75,219,191,117,
+    176,79,254,54,174,78,14,54,142,118,20,166,45,227,197,188,86,50,240,149,199,71,175,203,
+    85,83,113,186,2,159,46,122,242,147,81,211,235,245,127,46,138,127,78,47,43,255,209,143,
+    189,104,230,7,197,234,231,242,197,159,119,127,250,245,203,170,245,203,219,112,192,116,61,76,
+    36,35,191,225,28,210,57,68,199,50,40,220,150,195,149,133,198,1,240,16,183,65,81,97,
+    254,140,19,172,80,250,37,209,29,162,58,61,235,34,198,32,191,146,255,49,66,222,193,41,
+    206,226,241,48,138,96,105,12,71,23,127,78,46,171,235,48,197,139,127,150,97,142,79,139,
+    253,162,93,44,255,233,87,129,2,246,139,159,147,207,63,171,127,86,139,127,90,197,63,31,
+    161,97,147,63,207,32,151,85,94,183,255,124,182,254,124,134,190,52,212,76,233,170,212,65,
+    123,16,92,121,114,228,64,79,66,135,2,95,210,241,62,171,16,10,203,144,79,172,218,65,
+    82,199,63,47,176,176,75,64,89,186,16,107,233,50,105,170,163,55,243,38,52,109,59,241,
+    75,123,100,8,99,92,253,104,102,68,62,2,7,110,63,245,136,110,96,103,30,204,205,236,
+    18,114,91,199,223,233,93,192,143,147,157,171,205,141,179,253,173,82,7,249,201,174,176,166,
+    0,116,9,109,21,174,103,129,79,182,118,75,237,86,22,20,47,216,242,128,175,206,142,119,
+    207,75,150,208,76,45,237,28,253,166,82,241,117,66,9,78,22,50,242,240,120,123,7,214,
+    231,238,1,44,81,152,203,37,86,24,171,180,205,131,157,163,109,156,215,135,223,14,206,247,
+    79,14,126,148,72,203,73,210,80,185,113,251,34,66,250,178,145,236,31,240,117,226,163,213,
+    206,171,133,177,133,3,151,37,62,62,228,1,95,125,251,45,5,191,42,225,215,210,240,59,
+    191,126,219,7,138,147,130,127,151,6,59,59,249,178,115,186,83,122,126,169,21,173,164,160,
+    108,183,157,110,240,110,75,176,8,131,9,34,123,163,189,180,59,181,26,54,115,33,247,127,
+    79,241,64,57,64,27,219,219,37,110,72,254,218,166,103,66,200,121,114,75,25,235,70,168,
+    221,100,183,54,178,242,218,19,122,214,5,106,200,238,237,2,108,78,112,16,29,217,161,56,
+    27,137,227,116,217,234,224,75,198,83,231,206,124,119,190,94,238,217,23,247,11,182,60,214,
+    248,220,83,62,159,202,189,170,205,99,97,215,187,101,75,242,184,73,30,87,228,177,218,88,
+    78,73,189,211,128,117,219,77,94,36,193,10,38,174,186,3,124,246,98,16,160,61,8,32,
+    119,81,126,236,185,58,218,56,220,1,80,113,100,191,103,176,180,56,223,55,49,95,77,172,
+    171,140,230,131,161,51,226,50,84,162,193,214,151,170,215,73,10,62,70,217,60,134,125,129,
+    42,54,112,238,55,135,72,54,186,104,96,100,119,24,174,172,116,209,186,65,82,204,183,179,
+    157,171,221,227,61,66,159,2,218,185,31,37,112,0,3,92,201,73,75,0,194,180,53,113,
+    192,28,17,73,124,98,155,169,124,18,149,218,133,92,136,82,117,202,179,74,115,35,102,102,
+    218,103,19,252,100,106,196,132,216,56,214,138,31,244,39,19,244,62,147,169,195,225,254,217,
+    217,254,111,59,9,168,224,105,77,176,205,111,135,39,9,136,226,117,77,160,163,227,211,195,
+    141,131,4,12,111,157,145,236,35,17,6,96,236,192,151,198,23,209,108,239,159,193,38,190,
+    69,106,106,9,50,205,54,138,9,126,118,178,179,245,237,96,227,52,1,29,15,103,97,15,
+    198,119,146,129,61,61,254,182,247,5,166,193,89,2,60,8,166,78,148,11,124,184,115,190,
+    113,96,2,75,115,45,169,142,62,56,249,178,145,0,233,54,140,76,192,173,227,131,227,83,
+    1,165,31,17,10,201,132,58,216,16,239,7,183,101,187,133,117,142,84,163,191,238,31,29,
+    1,225,73,102,168,209,163,9,48,206,122,185,92,100,139,53,93,148,84,139,143,79,79,190,
+    156,111,156,238,237,156,159,233,192,74,23,229,13,223,43,205,227,77,26,1,159,6,18,129,
+    63,156,1,111,142,86,138,252,4,118,251,248,219,38,10,105,246,147,118,162,130,64,10,106,
+    23,120,58,3,70,109,188,59,196,240,251,169,62,145,123,240,139,208,165,234,76,128,192,129,
+    116,99,10,116,152,155,127,74,225,219,255,99,103,227,252,124,231,232,219,6,237,47,98,53,
+    230,30,196,82,107,243,120,111,123,231,228,252,203,230,183,221,165,185,72,139,123,209,241,45,
+    31,31,30,130,56,213,19,151,2,197,129,51,93,227,198,106,248,173,71,39,55,45,49,100,
+    147,73,79,219,190,201,0,220,46,202,187,90,212,205,240,235,137,252,60,78,54,222,165,1,
+    0,76,86,234,183,28,96,180,56,73,232,56,165,19,90,197,217,45,109,36,253,46,244,143,
+    182,168,88,233,207,105,10,5,157,245,9,24,109,144,117,205,92,198,84,207,201,172,45,146,
+    70,231,5,128,230,75,0,173,151,0,86,1,160,0,16,233,10,202,165,132,185,243,243,243,
+    165,41,170,184,12,164,249,50,72,235,101,144,85,14,242,31,40,140,94,2,204,91,181,214,
+    121,17,228,221,203,32,239,95,6,249,32,107,37,199,57,103,192,21,197,204,140,196,90,81,
+    88,88,14,238,59,139,82,185,77,102,99,50,1,107,180,136,141,34,38,235,103,25,166,194,
+    95,227,152,148,185,181,132,100,208,126,116,190,115,118,78,5,43,128,229,188,210,255,16,94,
+    104,1,43,20,183,151,243,72,217,132,241,255,115,153,167,194,255,43,25,158,16,125,230,113,
+    78,208,4,218,59,221,216,222,55,120,189,92,254,34,203,26,253,143,102,45,178,86,15,19,
+    160,147,211,29,113,254,220,223,217,230,189,41,71,125,212,155,79,250,168,95,57,223,26,142,
+    209,38,12,151,158,105,121,191,252,56,219,223,218,56,56,248,1,189,123,74,82,61,46,114,
+    251,47,225,79,254,50,123,34,151,164,129,98,129,144,87,160,146,150,3,14,142,183,23,112,
+    57,249,140,72,62,175,65,47,216,235,218,237,129,86,16,242,196,194,171,47,149,146,133,253,
+    141,66,66,12,113,133,50,173,43,41,78,202,207,16,135,229,146,22,198,14,208,130,150,60,
+    16,9,99,153,218,116,221,63,255,178,115,74,21,225,19,96,56,155,142,102,211,29,113,219,
+    244,244,68,148,84,15,242,126,53,98,18,250,36,163,161,1,242,194,106,146,173,190,129,115,
+    253,55,191,92,130,48,28,29,130,72,93,69,153,48,150,62,164,70,70,30,149,201,107,66,
+    90,25,58,106,226,72,226,179,136,178,121,4,54,179,163,214,7,48,0,145,184,240,58,166,
+    36,194,149,133,148,99,129,51,249,196,241,174,205,225,192,121,124,117,178,177,5,220,194,30,
+    138,249,13,56,154,145,139,247,125,171,19,217,223,125,52,132,29,217,167,248,176,166,139,95,
+    103,226,107,128,105,3,252,133,180,1,143,57,195,175,2,129,157,227,219,72,136,130,95,2,
+    114,171,3,136,61,65,67,62,97,202,68,77,175,74,144,34,45,109,118,6,114,211,43,79,
+    199,235,137,75,243,17,139,114,226,0,46,113,252,153,103,64,113,61,36,111,124,60,78,169,
+    92,140,88,131,229,130,91,109,50,25,147,126,235,176,16,73,98,17,25,43,7,67,119,45,
+    197,93,35,171,211,181,67,77,159,68,222,127,143,44,124,49,131,242,176,128,167,155,215,227,
+    145,74,158,229,37,15,84,242,212,142,209,140,1,26,29,224,126,5,243,84,87,70,208,183,
+    7,251,71,95,165,42,129,133,150,119,217,98,117,2,129,160,93,228,84,174,72,16,237,98,
+    137,17,122,46,247,183,88,41,140,234,191,109,28,236,111,3,131,38,48,3,235,191,184,6,
+    41,88,142,32,211,51,37,50,27,63,75,252,47,210,149,83,215,90,168,163,160,42,155,135,
+    13,181,20,186,58,46,155,172,71,208,239,204,226,230,130,81,229,132,27,155,116,194,120,56,
+    153,246,189,137,253,56,158,197,180,31,146,33,21,97,27,211,151,15,186,0,113,187,107,218,
+    191,123,132,109,167,29,160,5,152,110,255,190,221,123,102,41,211,119,148,62,147,233,46,122,
+    118,11,133,111,75,49,141,163,76,204,128,139,220,239,164,57,72,245,202,67,55,78,161,174,
+    101,238,160,29,119,164,58,227,186,176,154,70,204,73,116,43,238,184,127,128,77,133,73,115,
+    225,145,103,92,7,208,109,90,143,82,101,6,109,22,195,65,96,241,200,10,181,40,110,117,
+    232,27,176,235,22,43,144,37,138,207,46,93,156,136,219,200,48,209,136,226,229,67,102,160,
+    58,200,255,119,240,153,130,0,72,175,47,223,122,222,180,29,121,71,185,169,172,172,78,166,
+    227,225,220,176,211,33,186,79,91,124,210,235,27,134,133,254,210,243,11,254,2,149,193,67,
+    243,141,182,245,248,242,12,84,118,254,208,23,38,154,77,77,61,205,73,174,135,210,35,90,
+    198,103,194,201,139,222,191,82,182,102,184,85,43,61,25,232,220,242,245,228,103,229,110,176,
+    239,219,227,176,90,149,38,155,253,64,106,235,193,145,201,63,239,15,96,214,52,205,174,29,
+    229,24,42,46,68,185,182,132,7,122,29,52,23,83,97,158,21,1,198,77,182,57,150,147,
+    216,63,36,71,187,74,135,5,19,52,83,6,156,88,47,51,35,38,122,140,154,47,48,202,
+    253,20,223,34,193,238,220,46,250,67,212,158,130,214,22,185,98,96,145,219,49,152,160,35,
+    84,249,210,179,94,252,134,90,108,189,160,63,46,74,255,242,40,128,34,251,244,186,53,92,
+    172,174,72,215,156,196,19,73,226,15,110,86,119,86,59,240,143,191,181,113,233,185,13,234,
+    254,104,47,101,184,70,225,197,37,154,16,64,11,177,196,216,42,155,189,37,206,202,50,74,
+    17,174,216,180,68,17,115,186,183,185,193,97,148,29,35,1,33,205,244,103,108,139,183,75,
+    46,6,121,202,129,51,112,161,105,73,90,196,35,120,234,73,111,24,135,73,218,8,131,176,
+    27,96,210,249,144,196,113,102,10,38,156,9,221,17,61,145,31,25,36,78,30,202,75,71,
+    182,42,191,174,152,178,237,76,122,129,134,215,167,112,137,209,133,255,68,195,71,225,18,59,
+    19,135,32,25,207,15,69,165,103,22,218,154,96,35,95,226,15,252,252,168,168,49,152,69,
+    206,48,138,31,124,85,94,52,89,200,162,60,200,23,233,176,94,212,248,194,98,14,143,88,
+    20,7,113,37,160,28,21,83,183,17,69,237,124,93,212,15,208,69,253,128,92,212,78,173,
+    69,121,24,46,138,251,197,162,126,240,45,118,135,97,145,75,71,138,92,52,82,212,142,177,
+    197,148,164,185,152,127,224,42,74,105,127,81,222,81,21,211,162,125,93,238,53,209,69,115,
+    216,167,247,135,70,162,8,203,244,236,145,180,168,43,151,20,77,229,142,162,161,77,82,52,
+    148,57,138,25,197,145,98,250,72,92,52,110,201,117,53,174,226,130,51,110,81,73,170,138,
+    218,201,190,168,78,239,197,140,62,71,49,71,155,163,168,51,236,69,117,226,42,73,189,214,
+    34,208,243,130,164,228,39,137,223,20,205,222,64,192,66,54,99,49,183,74,204,95,12,119,
+    47,184,86,53,41,117,140,129,122,158,225,64,193,106,129,21,103,9,107,161,227,250,228,26,
+    183,210,97,92,119,113,232,16,212,171,231,24,129,179,34,187,217,104,173,37,150,70,7,220,
+    157,202,0,14,18,154,95,21,178,152,155,50,81,87,107,53,172,183,107,104,78,86,184,84,
+    195,135,184,226,123,253,21,86,32,139,103,162,138,197,30,80,229,82,85,230,173,150,138,84,
+    231,122,241,28,186,166,184,119,242,77,45,92,128,26,84,75,72,147,35,187,97,181,35,123,
+    32,236,89,68,248,12,216,214,140,83,74,147,35,174,110,52,179,60,224,190,195,117,171,127,
+    101,13,194,98,131,116,150,151,118,33,115,228,218,37,166,229,94,100,227,114,160,219,184,132,
+    25,192,175,234,73,199,86,223,3,213,75,203,71,206,197,239,111,183,123,154,133,194,1,203,
+    39,103,109,175,110,90,5,100,230,153,179,237,151,175,215,175,229,134,38,44,27,112,181,0,
+    126,86,133,94,128,45,20,237,60,194,47,211,8,35,228,228,113,2,124,63,38,104,78,28,
+    41,3,255,100,9,229,108,187,154,236,197,84,168,96,38,81,37,228,34,127,30,126,174,232,
+    168,149,2,195,185,218,120,207,223,4,26,136,159,158,86,27,31,114,226,97,210,8,186,77,
+    88,100,128,17,17,167,40,250,98,26,9,231,197,37,97,150,67,222,121,197,53,24,179,246,
+    130,248,19,38,241,173,28,70,243,88,21,98,133,212,190,64,201,169,56,166,239,15,4,160,
+    71,48,125,195,224,99,168,69,48,109,159,161,68,45,204,228,142,194,123,66,4,152,182,231,
+    80,130,22,102,98,235,129,49,22,95,76,223,132,32,90,15,114,171,212,111,102,140,239,75,
+    144,10,17,140,239,78,237,217,202,202,12,8,217,46,133,90,76,219,172,218,134,2,43,75,
+    109,93,109,55,125,109,186,208,108,231,2,177,34,147,187,28,162,18,159,104,93,151,108,118,
+    210,174,215,142,88,122,223,107,231,146,82,166,239,134,128,78,15,50,125,115,148,105,34,200,
+    10,169,205,178,77,38,80,14,141,236,230,246,169,65,72,36,250,238,217,14,18,199,11,142,
+    36,171,204,220,82,1,134,152,39,45,53,217,97,33,113,2,1,45,205,220,97,219,168,70,
+    199,35,52,152,100,79,134,244,30,4,180,52,115,179,132,67,121,206,118,217,158,50,181,71,
+    182,221,68,66,201,210,251,121,219,73,164,222,117,174,112,235,175,172,140,77,87,230,56,138,
+    210,166,39,51,24,0,35,59,238,164,76,87,236,118,116,97,41,91,192,31,0,212,130,20,
+    150,229,108,218,110,142,4,158,21,146,203,48,55,185,24,99,26,187,65,42,126,46,249,169,
+    98,138,243,104,55,147,72,67,30,168,189,79,55,228,137,102,16,45,125,62,43,41,130,216,
+    196,182,12,203,73,218,195,152,11,52,137,38,119,159,117,97,239,41,137,177,218,101,17,231,
+    166,14,137,22,83,9,250,145,210,210,158,42,137,154,146,210,164,37,37,21,1,106,63,39,
+    209,190,124,133,148,160,19,73,104,109,53,177,200,170,6,154,172,121,201,122,94,132,0,117,
+    105,117,84,94,233,51,96,75,188,170,153,14,207,166,56,193,202,150,2,50,119,66,245,180,
+    133,75,86,165,77,39,199,35,189,114,209,123,182,97,186,135,76,187,200,230,244,144,79,33,
+    5,80,81,189,232,115,97,208,137,164,68,101,102,7,23,17,177,113,51,126,74,39,75,182,
+    61,123,214,169,86,123,201,89,93,60,186,122,206,113,26,32,20,83,67,82,77,237,194,94,
+    201,91,209,75,36,71,61,245,64,46,10,156,73,182,206,137,107,220,90,205,73,202,148,122,
+    233,1,23,175,162,129,7,178,16,119,9,85,150,173,169,53,47,59,72,69,70,244,72,93,
+    200,115,80,12,97,136,22,38,118,160,121,148,14,203,28,179,67,213,255,14,237,130,149,150,
+    107,83,79,153,179,224,246,72,92,43,109,209,226,241,25,182,90,122,222,207,180,87,72,30,
+    154,111,66,203,49,6,38,71,72,150,224,59,107,113,73,120,68,145,229,112,251,136,121,118,
+    74,140,74,235,47,214,102,97,70,139,28,249,184,227,49,252,225,22,35,146,240,122,193,72,
+    174,25,137,72,87,120,183,145,186,191,252,84,177,130,61,165,239,117,21,91,239,251,53,87,
+    11,208,246,32,60,60,244,201,162,135,30,94,55,82,107,70,26,228,124,32,248,7,128,122,
+    128,180,7,148,207,32,80,95,123,222,117,251,51,205,93,222,90,89,26,252,131,233,151,91,
+    218,93,50,103,46,46,153,11,11,202,195,15,162,78,98,226,12,71,206,205,12,182,101,166,
+    57,228,107,251,12,205,18,27,38,186,80,164,41,38,47,190,247,84,159,207,12,151,77,2,
+    170,108,198,200,183,153,142,97,81,101,176,14,39,137,71,232,45,124,21,201,134,36,141,108,
+    195,73,77,216,198,105,119,19,145,115,40,69,206,237,80,14,16,43,232,93,16,232,29,194,
+    30,128,197,39,87,204,237,8,102,55,46,183,1,16,89,28,83,155,202,26,212,121,105,118,
+    160,185,28,177,187,154,211,17,59,68,55,190,98,149,39,101,14,244,98,108,179,208,65,253,
+    193,238,33,62,44,216,142,172,78,153,110,79,66,221,189,225,186,223,246,44,225,237,196,194,
+    71,151,207,12,141,42,233,189,219,252,236,41,133,93,143,155,92,154,133,86,167,249,217,87,
+    209,194,18,211,109,104,216,47,186,79,6,120,129,125,77,218,146,208,178,119,223,175,150,88,
+    169,138,150,1,241,157,239,2,59,55,119,33,239,59,79,167,10,185,235,217,180,59,52,127,
+    185,34,166,49,100,135,155,204,84,214,129,132,237,79,249,130,141,63,126,22,102,145,183,19,
+    142,140,56,5,110,19,217,179,11,143,138,87,227,190,166,24,119,252,68,6,123,4,227,34,
+    253,149,13,239,54,251,14,90,171,227,129,83,96,138,103,147,118,51,97,111,200,188,60,230,
+    220,122,54,140,215,42,214,174,212,6,194,41,111,187,68,121,203,202,151,194,71,242,234,29,
+    195,206,73,150,245,128,219,30,184,99,135,135,252,192,115,230,170,78,127,187,170,9,143,154,
+    87,215,5,117,251,219,117,16,113,91,116,117,127,20,56,99,5,198,163,118,49,102,103,213,
+    172,42,50,188,19,242,144,158,212,55,221,153,147,235,249,150,86,103,238,80,74,139,121,238,
+    20,116,148,6,159,77,8,245,22,167,58,163,231,68,221,239,228,98,55,9,127,225,174,118,
+    185,215,178,103,115,98,218,158,62,219,31,204,189,120,30,2,109,69,162,182,17,86,171,128,
+    10,232,33,190,199,131,131,29,18,83,116,112,135,206,238,180,115,69,251,194,8,74,17,236,
+    104,65,60,170,74,96,18,30,44,228,175,145,71,143,144,192,242,148,129,223,116,92,81,31,
+    70,86,35,70,230,197,19,8,252,74,243,124,35,198,77,147,30,178,128,255,42,233,10,252,
+    140,146,37,78,148,95,202,209,144,121,67,147,168,13,22,219,13,233,49,155,93,195,191,91,
+    216,64,122,118,47,207,215,128,228,254,238,1,108,100,119,37,239,119,255,121,212,185,151,172,
+    223,157,93,232,94,220,95,178,77,251,142,59,92,99,123,240,213,151,254,57,217,87,8,201,
+    249,205,78,32,48,17,135,26,249,69,74,109,122,192,144,232,32,79,9,232,38,27,124,248,
+    104,54,89,81,213,222,172,143,43,123,108,128,31,33,124,204,240,195,173,236,169,251,85,204,
+    147,38,84,188,194,95,4,31,118,103,117,190,8,23,113,228,247,64,84,223,170,139,243,205,
+    252,12,206,68,206,184,172,53,6,115,168,9,33,173,17,243,113,82,30,185,238,12,143,92,
+    220,180,81,46,24,191,200,49,161,13,244,51,23,31,127,233,81,180,141,161,200,82,181,12,
+    24,100,236,161,47,162,251,112,12,156,137,152,64,214,166,234,109,38,1,144,140,96,79,193,
+    143,138,227,212,4,123,148,62,84,188,32,43,144,32,220,125,116,220,122,222,50,185,136,47,
+    237,194,73,126,34,182,13,211,181,241,37,77,35,3,24,1,190,116,98,216,138,245,209,83,
+    148,222,122,52,134,76,89,250,125,85,255,107,240,134,75,139,94,106,244,55,51,227,190,199,
+    251,158,207,92,251,235,255,200,161,199,38,208,94,198,101,221,222,112,2,216,201,248,41,181,
+    60,217,221,50,233,149,114,179,118,167,32,44,42,12,183,30,155,46,240,85,187,215,27,237,
+    59,158,176,108,154,21,254,241,121,102,208,212,139,241,165,125,146,138,164,137,53,206,155,88,
+    8,133,41,95,58,227,212,140,50,182,36,43,153,84,236,197,153,192,126,114,218,177,197,211,
+    142,33,251,11,148,12,200,73,25,165,1,130,246,24,185,125,77,204,50,231,121,128,36,162,
+    47,226,211,225,212,17,38,48,161,12,181,109,210,233,177,254,174,114,87,39,71,181,184,195,
+    201,116,190,141,18,64,131,17,8,119,85,159,64,112,12,70,53,131,84,238,116,162,171,164,
+    102,23,215,176,248,191,176,235,106,213,32,189,9,239,243,223,178,122,95,77,187,197,106,78,
+    38,248,223,154,247,255,236,180,87,41,9,239,6,137,92,7,179,142,58,120,41,128,93,61,
+    189,235,140,165,89,230,100,221,76,249,186,201,48,21,152,144,93,56,4,134,73,95,58,83,
+    185,114,112,44,83,204,33,28,78,180,165,83,248,89,178,200,94,164,106,6,4,191,83,128,
+    222,41,99,188,228,65,151,143,58,173,87,141,63,149,208,90,84,94,30,151,68,189,23,183,
+    208,1,236,22,216,155,103,183,46,152,70,180,195,27,117,146,96,19,78,179,90,176,117,105,
+    207,204,29,77,158,199,99,65,143,100,24,199,40,37,111,182,175,101,215,203,136,105,199,213,
+    133,206,246,45,134,129,139,77,78,141,49,253,157,210,223,49,253,189,166,191,183,244,87,138,
+    16,225,96,139,30,118,80,197,75,177,202,155,38,171,252,128,172,50,90,108,72,203,33,50,
+    2,135,68,216,160,228,14,5,83,240,192,11,123,228,206,173,201,54,107,219,21,39,15,17,
+    244,128,51,70,215,158,34,232,243,107,172,73,219,33,47,183,179,145,144,72,235,102,126,73,
+    46,54,27,9,201,22,151,110,16,152,225,9,87,216,147,112,4,0,159,234,6,132,151,130,
+    160,122,24,16,190,130,208,186,107,235,159,62,208,111,254,197,3,189,231,46,243,229,158,81,
+    196,81,238,220,19,121,185,189,218,106,52,58,175,245,40,159,186,171,227,80,242,46,77,56,
+    207,66,171,101,196,162,103,114,224,154,10,236,28,84,68,31,27,63,239,113,125,145,199,244,
+    124,199,247,254,203,157,149,210,77,42,73,209,114,23,168,28,196,75,218,101,107,222,180,145,
+    2,203,124,178,94,93,61,106,103,245,31,234,222,127,162,119,127,174,199,190,5,121,62,75,
+    19,171,211,82,99,131,94,86,114,89,93,135,159,43,227,14,151,43,162,63,229,201,116,56,
+    48,166,33,186,124,46,71,246,148,105,233,169,158,183,58,131,245,200,30,180,203,3,82,4,
+    78,233,57,151,123,43,43,189,172,71,153,1,30,87,77,251,237,8,183,200,254,59,94,160,
+    45,78,149,158,250,68,81,154,35,26,85,140,170,143,194,35,98,164,194,8,110,30,134,250,
+    138,120,213,235,105,87,177,75,77,155,113,1,128,240,110,161,225,41,222,245,167,189,162,146,
+    107,43,77,38,24,198,226,116,88,236,58,176,73,163,174,6,62,143,203,84,33,41,157,245,
+    80,0,128,253,249,100,55,1,150,127,181,80,251,36,34,139,238,176,27,13,97,90,201,203,
+    205,29,121,21,73,242,211,130,71,62,219,132,63,58,232,5,116,84,169,220,184,241,139,80,
+    205,42,130,29,213,103,51,20,241,2,16,125,184,246,24,10,73,76,235,97,241,228,110,0,
+    163,109,168,59,108,109,104,239,62,117,45,20,65,17,112,186,129,141,31,83,237,30,214,22,
+    24,191,168,126,219,159,244,161,122,128,94,124,65,92,66,77,188,228,27,226,241,122,81,184,
+    101,244,4,199,131,183,143,235,122,160,125,125,225,17,224,101,39,210,91,106,27,237,22,105,
+    73,147,51,125,32,32,12,63,118,94,38,74,175,108,66,232,188,156,72,128,140,52,0,245,
+    141,203,10,253,37,231,81,50,92,112,89,58,198,57,160,0,85,156,12,50,214,133,8,157,
+    134,133,106,91,138,158,11,137,53,217,178,39,47,17,72,187,159,134,95,116,61,69,65,221,
+    156,57,52,176,14,235,106,90,14,69,200,194,93,79,84,243,233,9,191,176,101,252,139,171,
+    63,146,181,170,132,163,6,248,55,94,189,59,6,66,49,27,108,193,152,5,62,190,196,233,
+    203,206,155,8,235,252,158,101,225,142,158,122,130,173,56,58,10,122,64,225,242,100,90,204,
+    244,152,174,168,151,176,245,239,161,161,71,79,221,65,32,243,79,204,10,74,160,200,220,124,
+    108,169,43,222,169,45,110,26,38,66,150,54,85,110,31,63,95,227,225,147,83,205,27,27,
+    143,163,236,214,142,47,110,20,98,122,24,11,28,194,202,202,173,236,73,116,139,101,251,208,
+    213,183,44,98,51,116,183,137,44,127,15,199,199,90,228,216,156,116,158,6,144,195,99,55,
+    150,197,89,246,56,131,48,254,73,132,5,142,81,248,69,71,199,84,94,175,31,249,144,161,
+    51,16,142,156,98,229,71,178,51,248,28,147,7,10,232,60,92,196,124,162,112,179,45,220,
+    135,64,228,179,80,8,44,249,93,239,150,112,228,185,5,117,243,208,221,48,151,106,206,196,
+    111,108,243,174,94,67,47,192,234,115,140,4,227,218,126,108,180,155,172,217,110,176,86,187,
+    245,12,157,122,65,121,202,77,126,228,229,129,154,17,106,112,31,244,73,160,166,133,154,58,
+    28,230,179,46,217,189,68,154,74,126,101,32,91,218,37,155,115,148,129,195,94,254,185,84,
+    238,51,215,112,161,145,251,76,33,105,69,194,91,246,86,0,255,166,252,6,26,190,71,253,
+    6,28,226,163,161,31,1,252,94,211,212,228,185,75,116,132,54,159,173,78,140,247,195,123,
+    29,254,82,3,120,166,199,20,112,193,128,158,34,244,29,13,235,87,98,43,164,159,82,218,
+    41,20,127,129,174,133,148,195,87,201,56,105,78,96,155,26,43,214,92,228,155,138,110,177,
+    37,169,249,154,40,198,200,136,164,144,167,39,17,165,21,98,241,29,74,30,89,164,7,23,
+    56,74,224,9,165,19,35,207,132,8,203,202,236,85,157,76,14,65,143,212,133,201,61,33,
+    91,128,93,118,43,130,69,3,211,139,254,211,33,168,175,185,93,104,160,121,111,26,152,134,
+    254,88,189,254,100,50,28,243,200,102,98,236,117,42,104,132,187,128,70,184,64,35,58,83,
+    251,70,108,75,68,151,70,246,205,202,202,141,33,77,49,13,228,90,175,224,41,74,236,134,
+    149,80,47,53,30,10,237,97,124,124,161,180,100,239,128,106,113,17,66,71,248,255,157,74,
+    121,132,213,41,112,245,217,136,100,204,35,94,213,19,96,138,238,217,23,248,59,239,204,225,
+    96,76,146,165,86,229,132,125,97,240,207,130,184,230,165,144,54,169,152,22,143,89,213,161,
+    86,121,156,22,179,150,64,53,100,220,59,9,37,98,160,236,138,189,6,63,243,138,221,146,
+    110,37,169,198,248,118,138,51,205,48,155,123,110,25,107,9,96,236,17,90,176,75,15,11,
+    219,205,70,99,149,13,156,80,15,118,201,209,60,124,183,86,159,129,222,232,247,15,244,28,
+    8,70,4,127,170,165,68,106,83,98,119,98,187,56,73,25,249,64,245,155,169,46,186,150,
+    251,218,84,238,47,55,86,231,132,215,183,243,197,150,18,224,206,108,129,228,228,198,220,171,
+    238,18,158,149,70,106,102,117,70,235,229,169,253,158,125,1,192,235,224,28,165,41,17,151,
+    15,214,102,208,126,248,51,199,63,15,104,110,106,106,3,57,88,88,80,142,72,154,21,238,
+    128,43,28,94,111,76,203,3,75,181,249,48,129,224,34,25,146,60,34,193,101,244,147,252,
+    161,31,241,69,68,241,139,218,162,203,119,245,180,129,148,84,114,118,231,182,200,152,113,74,
+    179,248,132,172,25,211,26,229,107,237,6,232,230,205,231,105,231,6,150,214,136,92,125,11,
+    225,143,236,58,216,111,208,236,119,249,246,226,230,146,183,138,67,220,139,240,75,45,198,237,
+    53,184,67,117,229,242,28,179,88,44,204,114,30,217,230,177,220,38,225,171,119,125,64,208,
+    164,52,25,168,103,119,108,4,155,232,215,20,241,52,110,61,189,172,111,33,235,209,244,35,
+    148,78,206,33,200,154,59,243,109,174,131,85,240,52,151,230,210,227,144,212,221,103,215,192,
+    27,220,179,57,84,112,147,237,177,175,236,164,147,248,96,254,47,83,166,65,241,74,13,53,
+    106,104,255,217,98,177,203,254,96,15,108,67,112,12,187,244,251,111,135,237,235,7,246,244,
+    190,114,195,70,108,192,55,22,220,31,110,212,254,160,211,212,63,120,187,167,78,214,253,209,
+    69,13,38,115,45,153,218,248,217,84,179,28,55,136,154,156,240,77,152,74,115,142,226,27,
+    144,238,230,123,129,1,89,133,22,164,183,216,42,28,186,182,240,84,76,54,233,56,23,6,
+    83,56,118,179,113,46,61,246,21,65,215,112,233,201,182,40,153,243,112,206,212,73,39,79,
+    97,64,234,248,200,117,127,235,106,251,116,227,123,6,89,158,227,74,86,136,221,12,218,92,
+    192,121,6,61,244,155,155,177,179,55,79,34,165,97,114,243,241,53,103,195,127,205,66,165,
+    158,97,99,173,12,115,230,80,1,211,134,94,144,111,18,38,207,224,11,151,1,202,115,211,
+    159,241,82,243,78,169,228,140,117,167,36,157,202,44,142,197,61,141,150,64,134,150,188,0,
+    15,51,233,216,9,74,116,210,145,179,219,227,110,23,168,67,54,254,76,128,167,140,56,41,
+    195,79,153,148,217,45,196,65,23,207,81,116,64,49,183,223,126,211,162,120,157,187,67,110,
+    26,25,19,112,57,12,28,212,20,45,62,254,25,255,57,5,248,162,173,170,84,172,194,103,
+    177,162,85,5,32,16,173,19,245,195,56,240,229,190,130,118,81,85,181,138,53,209,250,162,
+    5,89,39,102,70,234,175,36,35,37,164,226,234,247,128,14,111,48,85,231,18,162,84,145,
+    0,85,43,78,160,226,203,161,230,185,37,204,161,132,151,243,222,67,243,95,174,199,92,54,
+    14,38,211,173,209,174,36,8,197,165,38,26,32,194,44,229,98,163,222,96,218,159,38,154,
+    99,79,229,174,223,207,139,85,59,183,235,194,232,74,43,35,61,91,161,144,84,149,228,208,
+    3,112,77,75,171,63,64,234,115,233,210,48,199,80,72,173,193,95,255,249,37,168,89,26,
+    75,34,39,206,96,20,5,227,214,54,62,113,204,44,184,225,200,241,250,211,185,22,143,150,
+    121,161,93,168,39,223,73,161,134,232,173,20,118,109,9,208,117,97,94,18,222,200,229,197,
+    239,230,68,43,61,248,191,189,242,112,6,201,71,189,182,252,106,109,151,177,27,24,162,19,
+    19,3,198,124,119,236,240,134,1,32,159,70,220,52,123,69,102,131,41,243,192,84,192,129,
+    4,209,111,2,71,191,11,11,86,71,4,48,159,181,39,132,22,62,248,244,156,177,159,64,
+    139,46,46,254,82,108,20,69,149,97,62,37,93,131,246,89,161,58,48,139,59,60,205,200,
+    101,219,197,102,146,141,38,162,202,50,25,12,135,211,222,100,26,140,202,178,247,153,232,110,
+    166,186,76,84,252,207,233,115,145,164,31,10,19,30,141,166,162,127,15,142,247,90,128,176,
+    89,95,91,107,189,255,244,174,147,87,90,112,63,106,149,97,246,39,83,0,122,39,27,192,
+    34,141,79,194,109,229,162,196,69,11,68,47,130,137,91,78,58,35,179,162,161,238,252,199,
+    232,248,113,232,34,121,0,158,176,152,142,103,106,2,51,173,143,57,178,231,220,5,107,250,
+    251,152,59,184,145,154,113,191,98,148,97,204,4,120,7,14,152,142,37,80,221,180,200,20,
+    192,254,176,167,78,231,43,119,255,156,178,155,240,135,97,149,228,100,17,204,236,22,125,163,
+    240,212,180,75,26,74,230,123,15,26,54,89,2,68,27,18,192,244,22,194,72,170,93,66,
+    3,49,139,128,248,78,85,34,155,49,11,64,38,162,164,217,98,36,56,68,232,243,122,33,
+    4,44,225,18,90,78,89,148,46,86,39,90,75,88,140,195,220,65,0,246,122,17,108,161,
+    148,222,10,208,150,246,66,204,98,145,2,204,253,50,24,177,66,0,108,190,12,12,215,47,
+    192,220,45,131,217,37,144,205,101,32,91,162,83,151,86,136,236,105,117,246,22,226,81,20,
+    173,68,44,171,63,244,102,120,129,38,216,79,225,251,251,232,172,92,234,77,167,163,246,219,
+    183,119,119,119,245,187,213,250,112,28,190,109,126,250,244,233,237,125,111,58,136,96,83,243,
+    28,160,228,19,66,194,53,111,236,143,248,201,53,108,224,27,56,223,41,169,74,108,113,65,
+    83,185,212,242,177,159,28,180,117,20,157,77,231,81,96,151,238,122,176,9,150,100,36,42,
+    41,145,224,240,35,251,104,117,30,248,53,189,135,107,236,217,195,87,45,114,209,253,129,10,
+    102,120,77,175,27,206,128,40,46,44,75,60,248,126,5,2,144,141,61,65,80,33,7,251,
+    22,227,99,153,20,26,41,35,115,235,91,223,14,14,208,166,225,78,130,29,98,133,196,236,
+    197,179,9,127,52,197,145,147,24,11,224,190,194,249,7,120,251,131,227,141,115,116,32,215,
+    124,207,26,139,64,79,50,160,31,95,119,134,225,71,152,140,231,186,107,196,50,240,51,199,
+    243,196,175,38,52,210,33,195,48,226,53,36,20,32,108,168,53,52,140,205,126,57,198,90,
+    211,0,219,141,78,249,87,123,132,247,172,214,122,217,213,60,170,110,178,95,133,40,113,172,
+    190,66,245,229,90,240,73,143,69,181,92,205,110,121,14,209,40,171,199,91,197,36,246,14,
+    98,187,102,100,191,124,139,114,21,94,137,166,213,254,53,121,122,186,178,82,48,112,222,67,
+    110,95,104,66,165,48,180,36,134,22,138,137,204,180,134,76,131,182,254,42,100,255,120,86,
+    59,80,199,231,206,175,159,15,58,191,74,65,230,142,125,115,241,235,101,103,231,229,203,25,
+    24,132,156,219,153,29,83,226,181,83,127,176,107,89,100,114,176,46,154,107,151,207,55,252,
+    41,198,23,126,136,252,23,106,178,156,147,42,139,172,111,94,93,69,61,49,199,169,189,99,
+    220,247,144,64,249,52,185,223,218,81,175,237,184,228,169,236,144,28,65,220,86,178,83,241,
+    161,79,142,110,121,143,157,38,79,33,115,103,34,249,78,92,220,52,108,187,214,21,168,139,
+    6,251,245,112,18,148,55,216,46,219,183,58,255,66,165,164,253,250,61,124,52,241,99,222,
+    57,247,49,170,176,83,231,155,87,253,190,86,127,135,145,144,172,226,230,24,71,242,112,244,
+    19,71,83,118,101,229,148,255,148,33,14,119,252,41,58,62,140,81,220,110,206,133,216,183,
+    24,202,69,96,92,132,77,130,83,210,221,78,192,90,221,114,151,81,100,125,72,155,117,253,
+    222,12,234,115,15,128,67,145,58,14,70,64,119,21,176,8,206,141,233,72,184,233,90,199,
+    196,128,98,121,179,239,167,128,70,108,156,90,2,172,198,25,36,200,213,120,170,86,227,169,
+    90,141,6,150,30,36,72,86,65,75,65,55,156,17,76,176,84,212,128,253,75,40,252,110,
+    70,104,203,54,14,203,167,117,87,124,50,241,185,115,35,158,118,139,240,217,216,147,159,219,
+    147,105,26,138,63,174,77,64,141,48,192,203,112,246,69,46,81,252,252,123,138,83,30,230,
+    179,50,7,232,208,153,92,75,160,239,120,56,211,161,212,165,136,128,162,176,128,242,77,207,
+    156,52,144,79,79,15,156,178,163,55,35,177,169,78,144,158,158,238,111,28,237,29,236,156,
+    177,247,48,152,223,142,206,246,247,142,118,182,175,206,190,28,159,158,99,6,92,113,27,93,
+    152,174,203,23,220,243,179,182,31,25,187,212,56,64,169,180,161,201,181,19,46,210,112,145,
+    94,18,165,176,238,163,186,114,236,42,127,122,114,47,64,105,51,238,61,106,111,64,147,110,
+    100,83,73,153,206,232,147,123,70,105,118,243,112,255,232,106,119,255,224,28,118,36,167,126,
+    180,179,113,186,115,118,254,66,142,141,189,156,28,72,199,184,191,64,159,59,10,68,12,251,
+    3,39,196,206,246,170,46,172,12,167,142,118,149,88,161,73,66,73,17,114,146,238,221,252,
+    113,190,147,239,116,29,31,147,62,190,65,153,232,221,133,139,190,24,29,213,175,22,195,40,
+    251,77,67,119,12,75,224,77,29,92,113,11,18,190,169,251,128,69,111,147,74,142,28,179,
+    153,245,200,93,219,227,13,28,231,35,218,93,245,137,36,248,29,121,150,71,185,172,139,151,
+    123,79,79,51,248,1,210,148,114,168,214,106,207,214,33,159,177,106,206,130,17,244,235,20,
+    81,239,126,59,218,66,31,34,44,249,196,123,111,2,223,133,202,105,160,199,71,59,44,243,
+    23,201,79,10,123,121,1,42,136,63,59,221,226,70,103,101,102,211,145,219,63,85,211,63,
+    118,78,143,153,250,33,155,171,251,71,223,206,174,176,120,50,12,204,10,233,104,170,213,207,
+    53,102,49,122,179,93,107,255,116,187,146,102,24,81,127,189,9,217,138,75,231,120,255,248,
+    220,73,119,57,91,146,150,211,150,191,86,122,82,90,225,47,84,226,249,193,254,195,142,93,
+    123,203,254,98,159,144,154,20,233,144,60,70,118,244,244,228,195,225,119,240,244,20,194,249,
+    53,126,122,234,225,194,196,39,216,39,79,79,184,247,3,131,189,168,1,30,222,171,35,55,
+    143,175,20,146,64,100,89,236,196,246,129,53,183,137,209,10,1,203,23,64,12,63,91,79,
+    79,248,34,252,143,167,167,24,126,30,172,188,182,38,136,66,29,107,79,15,12,244,64,12,
+    229,125,177,67,182,101,247,216,31,246,128,193,89,234,249,171,237,34,207,62,211,124,69,35,
+    57,217,120,35,180,210,214,209,69,32,156,213,118,209,177,150,83,223,250,110,181,83,49,16,
+    197,54,108,221,197,120,132,24,56,69,43,19,136,218,138,24,146,175,29,192,75,166,46,0,
+    183,7,61,44,16,109,110,108,125,181,184,97,12,51,97,247,244,248,232,28,139,77,199,93,
+    109,28,1,21,199,108,22,39,152,218,158,87,216,177,93,205,187,165,166,67,193,233,40,34,
+    57,57,62,248,177,119,124,116,117,188,187,123,182,115,142,155,204,129,197,118,81,199,228,233,
+    105,31,237,213,66,183,143,134,209,60,28,198,92,212,66,158,178,217,174,237,177,125,219,231,
+    202,69,221,5,120,52,11,2,100,239,192,84,245,83,187,91,163,122,80,107,90,157,67,209,
+    221,78,250,168,101,177,67,236,90,174,176,129,27,178,110,94,148,204,56,160,146,168,45,244,
+    101,124,154,177,226,21,100,224,148,249,69,115,195,210,222,67,34,167,146,232,85,195,238,239,
+    219,212,94,247,233,137,212,63,128,129,33,102,198,99,244,159,5,56,61,139,212,209,15,134,
+    222,117,224,155,106,230,54,215,84,39,157,16,93,5,220,103,226,173,229,27,169,189,232,86,
+    96,226,249,248,167,91,65,173,58,79,216,119,224,102,53,184,187,221,160,30,192,202,137,38,
+    80,45,234,11,186,198,38,241,134,2,100,1,191,156,246,96,169,50,226,106,76,43,0,133,
+    55,205,14,239,133,78,64,37,112,213,39,134,204,209,51,155,46,235,66,236,57,209,129,33,
+    199,144,244,26,217,114,209,159,138,243,189,154,219,113,70,31,8,124,254,105,97,234,23,179,
+    179,97,250,121,208,74,95,118,182,207,53,131,161,179,145,42,216,62,207,131,75,60,253,42,
+    221,79,182,255,244,150,223,104,11,68,130,202,31,237,252,70,215,130,186,187,49,19,98,227,
+    224,251,198,143,51,203,116,54,102,130,0,39,122,150,218,174,211,0,191,126,219,56,72,237,
+    124,38,72,22,226,93,10,98,47,11,242,62,13,114,186,179,113,158,106,207,135,116,139,143,
+    207,5,162,130,185,159,229,86,153,175,218,252,214,248,64,50,126,118,170,91,143,161,90,187,
+    52,95,73,214,134,11,55,196,133,155,55,71,97,138,134,54,44,43,190,189,64,137,227,159,
+    154,150,168,51,136,63,17,255,25,240,159,152,255,204,94,57,115,207,206,119,142,182,246,15,
+    180,185,107,196,188,98,246,78,166,65,236,245,163,151,230,47,16,145,32,153,195,176,121,114,
+    242,138,123,92,96,41,44,52,16,28,22,26,235,66,75,61,116,178,78,8,143,71,237,28,
+    77,184,136,163,195,77,178,224,241,93,210,79,240,29,203,7,50,208,75,46,234,93,67,255,
+    248,63,63,180,51,115,104,207,56,114,28,220,217,146,193,133,49,176,7,118,100,247,108,115,
+    152,133,33,192,196,62,179,83,71,143,113,226,226,159,91,104,62,179,80,47,214,60,120,93,
+    163,179,190,108,220,60,39,238,14,117,66,55,249,84,216,227,63,95,249,15,103,102,96,251,
+    167,159,45,49,105,92,254,251,7,255,121,224,63,192,14,192,212,219,224,129,29,254,243,43,
+    255,217,229,63,251,252,231,32,191,65,91,199,135,155,251,120,192,146,39,184,125,56,194,237,
+    92,125,59,218,63,135,230,29,97,23,93,195,201,45,167,59,160,43,206,246,143,143,172,78,
+    13,15,83,215,202,64,81,137,84,248,74,214,122,249,154,251,1,37,53,148,242,219,255,67,
+    241,197,242,69,163,246,233,210,122,91,15,238,3,15,186,225,2,181,77,10,71,118,243,179,
+    125,109,181,211,184,142,71,65,12,153,118,206,74,184,203,164,16,170,196,124,164,71,118,11,
+    113,146,192,232,144,119,194,49,118,249,185,220,129,255,37,63,190,227,251,168,239,23,201,49,
+    182,181,125,105,251,101,61,204,140,0,112,1,58,56,185,194,60,220,56,49,51,201,88,150,
+    141,186,58,57,62,219,39,91,223,191,179,247,66,247,146,235,106,74,117,179,206,84,211,223,
+    4,158,64,131,176,58,169,237,140,195,210,178,92,181,58,61,210,220,140,48,151,201,207,117,
+    146,19,107,39,36,164,156,240,8,1,73,91,154,184,224,246,204,218,83,38,214,103,123,252,
+    204,76,81,189,190,138,18,227,230,13,230,218,183,82,86,233,124,118,59,14,28,245,111,47,
+    156,75,124,95,151,18,225,27,92,205,45,42,231,22,154,29,100,63,70,240,173,157,225,127,
+    211,164,234,124,225,0,151,131,48,54,212,31,185,214,57,135,23,30,69,72,48,115,133,86,
+    61,241,65,128,127,229,96,150,73,201,50,164,243,219,253,219,254,100,56,38,88,96,157,80,
+    72,140,8,129,235,72,215,114,35,246,5,112,91,55,46,38,106,252,243,21,198,114,184,15,
+    233,191,83,97,95,84,24,105,248,130,75,144,188,1,226,22,155,70,114,128,92,161,158,237,
+    90,163,11,23,107,117,155,18,135,100,91,226,98,75,92,189,167,218,129,172,65,27,24,62,
+    188,40,26,140,128,206,162,245,50,206,20,239,146,130,170,81,31,216,15,132,230,235,38,138,
+    249,55,201,154,148,238,95,220,83,72,148,91,152,209,237,120,234,149,44,244,20,190,28,112,
+    178,250,58,184,96,234,53,95,3,231,76,16,95,242,106,194,203,210,65,160,160,39,167,192,
+    131,105,52,116,23,29,55,33,253,68,49,181,175,236,49,117,124,88,16,155,210,42,158,127,
+    169,164,89,155,207,44,185,27,51,54,53,1,176,199,207,103,142,126,133,230,162,238,188,203,
+    222,52,44,52,38,200,52,225,109,59,228,28,129,176,125,101,190,246,76,140,25,174,155,167,
+    176,118,138,90,112,211,131,137,153,195,14,190,3,245,237,55,62,146,24,248,67,167,5,215,
+    48,78,21,194,180,86,98,99,55,37,54,118,19,177,113,193,77,228,198,110,158,220,216,77,
+    201,141,221,148,220,56,207,146,163,213,14,145,54,38,180,208,77,248,70,17,77,66,100,87,
+    23,34,79,149,64,216,53,196,198,177,22,175,11,138,7,104,167,88,63,101,178,84,88,104,
+    73,164,98,191,1,249,156,8,150,75,89,144,236,17,31,35,142,201,237,136,24,158,126,28,
+    112,75,66,6,23,8,163,255,43,116,254,17,90,160,139,36,8,78,128,95,137,179,129,140,
+    39,122,105,104,147,216,208,229,207,227,41,183,246,207,206,142,79,117,158,82,143,121,102,198,
+    217,182,61,99,154,224,56,53,163,196,106,62,92,89,153,149,229,180,57,190,56,212,94,16,
+    251,52,115,10,143,248,110,66,24,200,100,210,76,142,112,38,193,48,7,144,52,146,211,208,
+    3,11,206,51,250,82,159,29,201,149,149,150,95,3,51,249,29,40,18,218,156,160,55,25,
+    46,83,240,182,247,204,60,157,28,9,121,179,78,138,166,227,249,163,83,207,131,226,6,27,
+    202,14,115,198,225,140,95,105,61,123,14,158,229,78,19,39,18,89,135,47,103,244,138,188,
+    196,78,209,13,197,116,73,153,211,127,180,164,9,31,106,99,152,233,144,126,46,15,233,46,
+    63,164,11,64,152,196,247,48,69,231,240,239,1,254,221,89,236,156,159,212,93,60,169,75,
+    13,241,44,186,127,165,208,41,93,242,12,190,127,105,248,10,25,206,91,219,146,58,238,231,
+    100,75,2,242,216,164,45,245,245,59,81,7,185,232,206,161,205,249,232,14,50,120,157,29,
+    123,195,254,106,115,150,26,86,178,184,79,129,181,46,191,198,121,119,44,187,161,169,145,174,
+    221,181,244,18,7,26,92,81,226,23,152,153,82,81,226,23,158,82,242,157,169,83,234,199,
+    69,103,137,151,145,196,232,122,31,71,31,173,172,162,134,178,180,227,223,159,20,167,195,97,
+    209,237,135,197,114,169,42,202,170,150,238,241,155,23,86,45,105,222,71,158,221,183,194,74,
+    188,115,47,107,198,36,36,95,137,222,63,160,29,226,9,229,16,205,14,189,40,172,226,98,
+    170,208,23,49,146,121,92,165,64,0,105,13,18,186,81,163,233,15,253,218,160,235,30,179,
+    238,20,41,138,101,158,106,208,235,187,245,85,253,88,60,13,208,106,181,143,79,145,209,244,
+    65,2,37,139,100,142,102,232,64,62,12,208,69,167,142,218,161,207,232,161,211,93,48,62,
+    238,158,223,13,101,7,193,50,201,36,136,214,232,242,78,243,225,65,24,196,1,202,140,15,
+    251,163,129,51,154,144,43,19,124,237,131,134,14,235,234,61,16,197,189,55,227,12,57,38,
+    30,208,89,151,219,83,213,17,162,9,87,159,216,30,207,170,95,93,161,1,235,254,232,32,
+    184,13,34,62,132,209,48,108,149,213,180,66,20,90,93,117,166,4,235,100,19,145,134,175,
+    53,245,245,14,223,92,163,84,88,92,255,181,29,244,153,5,223,154,249,89,218,135,144,121,
+    160,119,48,100,86,4,109,197,238,220,146,145,52,60,119,0,107,85,18,150,37,74,12,198,
+    222,105,11,51,180,190,52,67,139,2,182,58,141,55,190,195,189,186,162,207,171,171,187,192,
+    13,35,177,160,208,88,189,37,109,206,202,93,99,25,44,127,89,166,191,168,64,104,2,219,
+    135,45,220,34,153,85,209,233,228,225,212,145,89,207,190,104,18,90,186,197,167,237,191,193,
+    150,63,20,169,43,43,60,119,113,83,24,170,12,235,3,0,30,207,229,222,53,169,213,146,
+    206,186,254,201,206,186,86,43,95,244,20,11,228,167,196,207,59,79,10,186,81,186,147,170,
+    63,50,26,102,11,211,16,116,49,206,249,40,145,195,12,215,69,125,128,218,22,248,72,101,
+    189,11,81,151,75,227,209,239,127,9,200,106,180,44,120,23,57,108,126,52,77,186,87,139,
+    68,203,211,76,37,144,32,207,21,30,42,37,10,94,86,26,135,6,74,214,171,149,140,241,
+    53,165,254,237,34,113,237,201,153,145,12,135,62,91,150,78,134,27,88,215,49,151,57,94,
+    167,151,130,49,199,56,204,152,76,187,176,27,59,20,239,137,234,220,178,192,230,197,24,143,
+    124,55,176,203,226,167,125,195,212,27,114,88,237,248,196,232,51,105,180,113,231,27,215,208,
+    14,17,160,151,77,226,219,66,191,39,182,88,131,137,249,131,177,245,10,58,173,60,215,56,
+    227,107,116,232,50,28,23,121,249,69,56,191,38,84,124,22,115,189,123,191,196,112,43,145,
+    54,186,136,25,25,19,227,134,157,254,15,22,216,143,37,82,52,75,33,30,154,202,150,93,
+    235,180,0,197,81,122,216,126,211,128,78,116,124,127,49,17,99,215,169,69,148,213,208,96,
+    153,209,135,37,145,81,234,211,110,164,98,82,113,209,152,98,67,78,117,157,89,181,78,125,
+    212,191,15,162,51,56,164,4,253,50,42,88,160,103,203,43,114,126,251,227,138,206,193,204,
+    37,247,184,63,22,2,39,190,106,127,240,171,88,149,79,51,252,38,116,121,22,160,216,56,
+    216,223,59,66,189,71,210,135,26,57,222,245,6,190,64,65,214,4,53,142,123,146,180,179,
+    66,128,219,144,168,62,127,215,91,134,77,166,73,19,241,110,236,140,206,104,211,73,194,231,
+    20,94,229,214,182,51,155,165,22,103,9,43,39,81,57,70,110,54,46,74,41,204,176,91,
+    252,114,126,120,64,12,138,96,151,158,158,50,201,91,196,30,229,167,83,214,205,254,20,118,
+    91,68,173,38,208,30,4,246,254,62,71,6,7,127,193,146,157,113,134,75,227,47,98,193,
+    120,0,136,224,203,242,96,4,15,2,64,75,120,179,152,216,48,81,148,194,103,177,159,97,
+    195,208,243,206,8,75,46,66,183,76,239,134,200,143,197,26,167,21,47,228,199,10,123,26,
+    152,44,28,104,31,139,237,61,84,40,199,97,235,220,216,93,117,97,142,158,76,80,216,100,
+    137,215,231,122,10,25,128,238,220,154,139,195,101,99,14,123,79,211,130,152,45,73,74,183,
+    181,173,140,147,210,175,182,148,185,162,192,231,248,8,230,46,2,55,27,205,119,92,14,66,
+    54,166,145,56,221,89,211,222,120,120,87,228,254,61,75,36,173,46,242,7,23,146,10,13,
+    227,104,158,120,36,194,99,0,117,96,171,222,0,126,59,167,164,213,214,174,176,104,7,51,
+    40,39,189,249,222,234,52,27,45,238,134,135,119,195,202,202,87,219,206,66,226,74,104,182,
+    222,200,26,83,112,77,11,190,198,97,20,250,235,251,22,79,232,197,216,89,15,154,64,143,
+    97,128,162,202,200,253,152,71,33,149,165,134,115,49,96,81,239,85,244,30,229,10,75,10,
+    80,35,150,51,96,192,58,64,163,62,24,141,210,90,47,46,193,24,192,52,254,70,11,160,
+    178,173,181,143,102,125,197,229,209,75,213,110,53,114,171,141,36,89,83,112,51,38,93,131,
+    125,101,98,1,176,56,57,238,224,235,94,178,88,162,76,126,210,44,76,206,134,22,109,202,
+    247,202,80,209,56,57,69,159,216,13,54,183,101,82,231,228,243,188,115,2,187,198,87,251,
+    254,226,228,146,45,174,202,9,148,250,85,84,229,171,89,149,175,117,60,205,242,103,10,198,
+    97,132,238,131,82,167,134,123,229,135,130,87,126,89,227,111,22,54,158,151,200,210,200,11,
+    141,142,222,35,25,1,179,245,120,34,20,165,23,119,1,154,71,120,163,79,34,136,104,105,
+    17,235,53,180,153,191,68,124,93,182,212,141,212,141,181,238,229,74,140,94,213,183,162,95,
+    219,175,152,162,232,76,105,48,34,59,89,64,64,124,96,133,18,122,145,148,175,222,214,241,
+    150,32,37,1,70,14,51,40,150,162,4,197,253,157,57,240,210,112,103,39,230,203,35,178,
+    188,66,55,172,0,197,255,151,204,62,154,106,217,89,214,64,193,46,67,150,96,150,222,35,
+    210,243,149,119,136,96,129,19,102,152,111,28,195,88,24,113,73,62,145,63,23,226,154,127,
+    142,141,211,124,128,112,235,86,214,99,15,175,7,76,197,92,79,187,121,252,126,186,113,114,
+    117,198,18,98,21,114,238,201,66,213,188,23,178,157,103,178,157,191,144,77,83,3,214,179,
+    42,235,37,47,101,79,244,142,11,70,126,197,187,113,13,196,23,155,235,212,183,14,54,14,
+    161,5,199,87,59,219,123,59,175,106,107,38,15,178,151,228,135,131,58,140,88,201,36,12,
+    236,230,79,156,62,114,56,162,186,76,228,232,139,78,236,27,49,231,197,73,111,56,139,252,
+    162,27,72,187,121,188,136,45,124,153,121,62,220,241,195,224,251,152,187,201,170,151,80,235,
+    234,149,3,19,255,181,1,137,205,113,96,130,217,14,115,152,109,35,238,159,234,37,133,114,
+    81,191,224,75,189,96,50,21,64,176,163,243,104,188,90,113,198,60,182,142,254,213,97,155,
+    126,83,22,15,45,203,37,104,168,186,244,235,18,208,149,19,247,39,195,233,120,56,234,227,
+    21,32,30,43,136,213,11,5,159,33,174,61,68,254,227,157,179,36,63,114,124,87,17,21,
+    88,226,25,223,191,42,35,218,172,206,228,126,83,110,126,14,235,170,50,115,188,19,193,156,
+    33,74,239,188,217,24,111,222,54,84,170,69,250,62,250,72,118,97,36,123,218,4,248,253,
+    106,227,104,255,236,248,252,244,248,228,199,21,196,50,229,104,84,47,133,5,194,67,103,130,
+    186,12,171,142,45,43,219,214,17,104,52,106,36,28,168,42,119,14,201,154,14,148,185,34,
+    193,188,179,65,110,42,103,224,13,218,142,118,194,35,168,38,39,207,65,178,121,145,158,62,
+    242,82,226,185,131,46,211,65,101,212,141,195,29,105,42,196,69,152,110,146,158,60,1,49,
+    1,81,253,159,183,92,85,201,74,209,100,212,220,124,169,60,206,225,37,126,110,248,253,25,
+    207,101,72,142,156,250,233,206,209,246,206,169,200,71,82,116,63,241,150,8,39,87,79,106,
+    79,241,24,36,254,99,13,3,158,183,73,190,110,34,202,57,56,100,229,236,204,232,146,84,
+    189,244,230,72,108,27,231,231,27,91,95,232,52,159,169,56,50,31,70,205,255,94,197,37,
+    207,255,247,43,45,85,232,180,202,23,114,106,255,202,218,225,115,149,181,156,43,139,151,199,
+    150,207,9,110,204,172,148,200,187,128,124,226,156,7,234,199,79,134,28,5,208,120,113,90,
+    95,89,113,116,137,67,62,16,219,68,125,167,61,101,59,87,77,111,251,38,29,135,178,88,
+    221,136,93,174,144,145,159,47,233,112,47,205,15,189,86,86,248,120,189,88,236,14,36,235,
+    53,146,179,5,185,255,1,33,90,97,9,251,165,180,184,174,151,221,27,252,148,88,45,70,
+    61,197,220,211,140,122,161,170,228,170,23,141,75,130,21,223,230,161,144,221,160,242,204,136,
+    164,231,163,206,8,90,121,115,49,186,196,247,14,227,245,241,186,204,53,186,228,31,237,36,
+    162,173,4,108,16,96,36,98,195,118,40,211,121,92,42,114,3,5,178,59,59,42,223,91,
+    236,107,158,164,5,142,157,203,165,44,170,243,92,118,199,159,129,233,149,69,77,32,165,89,
+    179,201,246,108,172,189,148,196,48,60,214,110,217,123,201,9,98,139,78,16,155,246,222,63,
+    125,166,251,106,173,23,94,60,212,229,168,238,85,71,112,92,249,202,54,197,170,223,76,182,
+    160,205,255,142,115,158,185,120,151,29,244,126,170,238,95,217,92,214,159,31,189,199,235,63,
+    133,22,49,208,64,114,204,244,105,32,167,24,209,63,63,139,88,230,207,30,75,227,245,61,
+    117,18,108,243,243,220,93,234,60,167,205,198,123,81,187,194,253,95,63,214,201,243,230,146,
+    67,29,251,91,84,229,57,143,72,111,207,99,103,208,247,12,231,244,104,79,120,97,45,130,
+    87,208,54,73,228,51,231,76,85,131,217,72,191,185,179,211,238,65,131,228,182,177,155,189,
+    109,92,74,221,175,129,48,188,120,47,210,201,33,233,29,110,213,93,232,161,45,184,95,100,
+    177,29,137,221,11,216,207,32,231,74,207,46,92,92,38,134,78,137,60,77,209,133,136,149,
+    7,140,14,70,100,229,116,62,79,76,134,92,252,185,240,162,66,47,142,76,55,115,131,147,
+    79,95,101,191,192,198,77,141,209,27,50,42,47,104,10,195,167,187,244,190,80,99,131,26,
+    203,245,149,171,83,174,5,151,148,183,104,145,41,16,87,44,54,55,209,228,120,169,217,154,
+    44,116,137,92,36,211,57,44,45,226,215,170,201,242,187,1,14,1,47,116,66,107,27,78,
+    37,75,90,108,148,147,105,43,91,82,127,126,74,33,18,163,241,200,48,77,19,174,171,251,
+    194,252,214,114,43,137,40,68,117,205,59,8,97,31,85,7,163,35,182,113,5,129,232,138,
+    156,219,45,242,12,168,253,131,248,57,183,146,127,127,111,148,99,222,114,144,245,127,47,139,
+    85,30,240,85,233,165,151,143,78,121,67,71,149,123,99,182,30,206,203,41,69,132,212,101,
+    142,81,223,177,214,26,179,119,6,179,201,20,69,11,78,114,177,135,162,8,190,133,235,8,
+    161,238,5,73,240,140,97,200,168,84,164,235,69,108,52,191,199,163,203,75,252,90,0,37,
+    174,242,16,140,127,18,203,188,16,93,50,9,23,227,146,152,210,64,166,121,85,171,115,147,
+    42,8,207,185,137,66,201,178,22,243,235,49,113,41,101,148,33,216,199,87,29,189,115,15,
+    153,218,26,226,21,18,130,104,117,93,244,183,139,203,57,30,166,138,45,200,114,141,25,245,
+    45,190,142,135,119,113,209,152,76,188,2,48,83,148,196,188,203,245,94,114,20,68,144,163,
+    239,18,241,238,118,186,164,15,243,243,11,227,162,123,105,177,60,228,144,160,182,35,227,80,
+    10,172,124,121,65,6,169,7,81,252,75,75,52,183,26,63,87,7,230,190,86,178,34,216,
+    21,174,216,161,83,42,126,127,144,195,181,36,132,187,171,248,132,1,87,122,123,236,46,166,
+    186,232,60,60,189,103,181,245,249,65,188,73,40,150,73,118,101,152,123,2,61,170,157,193,
+    207,203,91,101,87,182,52,145,34,253,22,232,250,131,143,226,56,102,60,176,193,149,177,131,
+    186,122,158,114,145,92,63,221,57,217,217,16,87,216,36,207,214,210,12,1,184,0,105,153,
+    32,135,251,167,167,199,167,59,219,87,6,158,84,25,66,3,80,36,174,229,38,94,29,238,
+    159,32,135,97,194,190,91,10,203,245,9,5,232,123,19,212,72,251,144,151,150,95,226,199,
+    101,160,2,105,129,131,126,50,65,13,27,37,66,39,224,195,2,16,178,18,115,181,198,255,
+    19,176,31,151,194,190,163,255,154,2,246,211,11,176,239,175,222,9,200,134,9,169,213,45,
+    53,216,148,85,36,181,150,161,23,48,169,49,222,87,122,16,107,11,50,239,27,154,18,26,
+    4,25,70,19,73,124,20,31,249,235,129,165,162,113,206,147,8,27,78,190,196,230,215,191,
+    108,28,236,94,17,202,43,200,248,204,119,131,84,91,73,91,73,236,75,169,182,158,238,109,
+    138,132,213,76,194,134,24,249,86,170,137,7,223,14,247,143,54,142,182,68,207,182,222,45,
+    72,190,210,203,77,205,215,92,157,146,214,135,60,32,177,39,137,9,155,234,75,97,105,67,
+    116,103,78,226,217,183,205,243,211,141,45,89,66,14,196,41,62,71,63,219,49,32,91,233,
+    130,208,50,9,79,72,21,2,213,231,241,41,212,202,134,9,79,93,205,228,74,27,105,225,
+    112,107,89,44,170,23,91,105,250,144,99,30,132,195,165,59,27,104,136,150,250,97,17,150,
+    4,174,64,128,31,179,104,180,170,126,90,134,38,129,75,47,73,85,213,171,179,13,216,54,
+    54,248,2,93,93,253,240,225,61,55,243,128,159,31,146,207,143,201,39,47,17,159,202,216,
+    175,123,17,199,212,122,121,212,203,72,86,143,246,138,13,38,252,213,217,234,249,214,213,246,
+    239,231,77,188,33,146,213,250,176,44,203,70,126,158,143,175,203,179,170,231,249,244,186,60,
+    239,48,15,174,243,213,119,31,215,26,162,115,224,179,153,124,182,146,207,213,215,119,153,120,
+    109,200,10,102,167,201,82,22,118,218,201,111,167,80,179,181,205,147,147,223,154,87,251,135,
+    123,29,145,171,249,138,92,173,76,174,214,242,94,88,84,216,234,107,178,37,165,81,255,189,
+    111,126,122,47,28,61,190,220,59,252,233,100,50,161,22,54,108,231,124,171,201,69,223,84,
+    183,15,31,27,114,6,195,231,39,245,217,108,36,159,205,228,179,149,124,174,38,159,107,201,
+    231,187,228,243,125,242,249,33,249,76,74,107,38,165,181,146,210,196,230,240,170,41,193,223,
+    129,106,51,66,62,11,225,212,84,212,176,41,168,150,142,18,47,150,233,241,226,213,160,31,
+    15,156,251,244,90,108,54,82,35,134,119,237,98,49,52,77,42,232,211,139,125,156,244,234,
+    5,70,171,145,63,110,116,252,144,181,215,139,92,247,141,141,249,170,181,118,245,145,15,82,
+    187,161,115,149,145,35,95,67,89,143,191,58,11,156,81,158,4,227,201,40,32,193,35,119,
+    234,43,60,81,118,135,183,182,122,91,224,172,59,237,119,194,153,210,195,112,56,144,142,147,
+    240,126,59,129,242,214,189,118,61,241,75,153,36,248,235,126,187,37,157,83,118,135,222,108,
+    98,55,5,54,135,10,79,64,221,117,183,45,80,224,203,52,205,1,101,183,31,13,246,156,
+    89,24,216,171,239,146,24,254,90,82,250,156,92,228,20,71,83,190,247,241,193,79,100,244,
+    6,119,38,202,125,16,77,108,231,233,233,226,50,201,240,61,192,12,42,232,38,175,159,249,
+    43,112,31,223,6,225,83,180,120,218,143,67,105,74,132,14,13,59,243,64,221,224,79,202,
+    165,40,232,2,227,195,2,229,135,132,158,128,118,92,21,230,174,174,59,183,226,125,50,94,
+    70,157,226,131,218,50,42,201,82,220,25,185,33,230,94,104,182,199,206,29,148,200,229,77,
+    148,208,170,192,225,131,53,149,204,77,121,173,90,0,127,35,197,251,82,140,112,203,47,49,
+    61,242,174,165,25,55,194,159,174,50,137,162,249,81,59,236,228,94,119,66,57,228,116,168,
+    244,219,41,29,247,182,197,179,58,25,95,230,6,147,120,176,174,1,89,210,167,39,149,49,
+    144,78,85,18,191,108,228,205,205,65,39,88,232,72,121,162,219,93,66,15,40,248,232,87,
+    56,2,20,246,3,155,28,229,84,230,156,166,114,66,174,130,204,59,77,229,109,241,188,215,
+    4,11,19,231,34,102,83,186,181,200,20,113,157,159,243,134,221,46,239,32,209,3,89,201,
+    250,237,152,187,85,157,143,248,212,242,122,78,28,226,123,6,134,134,33,114,253,158,205,38,
+    114,6,217,205,250,123,30,7,83,102,59,184,237,123,218,181,176,122,250,229,39,23,3,105,
+    24,71,123,86,228,16,97,114,180,107,132,147,225,36,72,95,33,164,115,116,147,28,120,220,
+    166,165,101,64,39,22,4,20,29,118,58,62,151,249,144,223,113,238,112,92,70,237,82,76,
+    151,34,66,244,87,36,38,76,89,92,116,226,138,155,76,157,80,91,112,29,119,61,68,195,
+    105,3,241,220,180,62,233,79,113,137,158,15,207,166,14,61,111,63,151,190,191,173,118,33,
+    204,248,175,194,215,139,73,159,146,25,81,59,64,39,78,65,135,223,238,10,26,208,93,239,
+    182,157,206,88,216,202,229,111,102,209,139,165,140,72,236,230,142,149,11,40,54,174,227,91,
+    249,96,28,243,0,89,114,87,70,109,221,250,112,140,110,189,29,238,58,182,60,48,154,161,
+    165,89,6,158,196,121,213,192,210,112,37,62,104,203,202,249,214,169,48,43,155,248,124,154,
+    25,101,36,174,170,102,252,109,243,175,170,20,180,112,151,52,132,28,89,205,44,108,110,142,
+    171,170,142,124,231,147,34,146,106,192,99,190,131,136,177,158,26,161,152,246,16,62,232,83,
+    237,251,218,176,74,76,221,237,152,54,155,175,115,236,58,231,0,74,23,88,157,66,156,151,
+    33,233,15,84,148,232,78,19,19,201,72,41,94,200,48,198,57,163,231,232,225,180,21,144,
+    56,61,114,139,84,3,216,91,80,132,14,224,216,48,12,100,179,65,142,181,67,174,87,181,
+    114,204,126,97,203,203,140,184,243,185,101,0,169,106,235,69,197,185,61,59,93,4,62,205,
+    5,143,179,86,209,211,163,144,222,219,177,140,165,153,104,36,178,185,174,179,185,104,134,100,
+    171,0,243,195,225,251,249,1,209,120,218,127,149,175,97,199,118,80,195,66,142,0,213,113,
+    147,118,152,149,149,53,219,140,81,185,228,246,165,85,84,135,179,18,116,84,123,19,159,22,
+    165,16,78,243,16,106,128,150,122,3,125,157,80,101,73,6,121,51,115,118,136,80,210,252,
+    153,59,232,115,154,171,67,101,152,31,12,107,176,101,185,3,136,107,98,61,239,107,118,197,
+    220,39,178,11,55,70,75,99,124,127,247,51,60,219,53,247,133,246,165,91,222,134,193,119,
+    150,240,217,42,53,163,14,138,215,68,11,19,149,182,103,110,126,67,244,181,28,32,31,17,
+    94,95,249,206,216,191,66,229,176,91,7,217,245,73,10,68,24,110,191,34,149,152,171,89,
+    63,214,203,90,100,164,168,211,231,29,243,91,80,222,102,215,192,128,157,10,191,115,93,10,
+    227,235,121,151,199,236,132,60,166,79,81,202,12,197,111,194,62,164,99,41,74,129,30,80,
+    156,113,153,12,222,106,6,38,134,46,7,253,145,11,233,243,82,190,210,0,253,78,223,211,
+    176,211,21,181,17,101,187,14,251,157,157,98,29,152,15,213,184,225,169,115,202,51,230,129,
+    125,172,248,13,79,159,240,168,163,110,121,204,35,238,120,196,33,101,24,242,192,36,44,111,
+    32,238,83,72,159,241,168,251,176,51,226,95,91,97,103,224,216,5,252,220,238,2,28,84,
+    0,80,157,88,157,123,209,41,162,155,16,249,3,143,250,151,22,181,193,163,182,177,136,109,
+    204,220,229,229,248,14,146,25,52,1,52,177,135,201,119,103,67,250,131,181,183,241,219,25,
+    57,110,63,130,141,54,152,216,167,14,196,64,10,122,80,24,198,19,251,26,195,144,113,20,
+    140,41,253,119,8,242,99,4,46,150,137,61,195,116,242,55,107,187,248,217,143,187,67,219,
+    215,44,31,120,184,70,176,236,0,87,216,54,183,225,88,78,44,52,68,195,112,129,186,147,
+    208,76,44,30,12,39,83,180,100,177,99,248,112,132,125,255,241,245,56,78,131,9,234,219,
+    249,2,79,179,227,234,167,53,58,123,1,137,149,239,230,157,23,222,205,195,30,210,133,44,
+    157,223,229,91,108,199,176,26,238,200,227,217,239,180,40,96,202,138,158,239,168,49,16,39,
+    209,142,226,102,11,238,202,202,16,203,141,2,71,55,220,164,91,23,23,118,221,165,158,105,
+    89,103,116,55,12,55,215,251,131,65,224,247,201,112,50,229,121,182,116,59,192,188,122,48,
+    103,156,132,115,199,237,6,79,112,58,161,37,223,149,55,51,232,186,141,184,63,32,78,142,
+    83,220,200,106,43,226,153,159,158,178,124,65,70,212,111,145,113,216,116,32,204,122,101,43,
+    109,213,130,121,137,39,100,199,112,186,238,24,78,215,93,233,116,221,162,36,244,181,142,151,
+    95,127,144,173,44,250,198,2,28,195,219,58,79,228,161,178,147,220,1,59,228,194,150,204,
+    53,57,166,59,246,149,149,55,61,71,115,200,206,161,32,239,211,147,64,38,35,12,100,170,
+    223,249,12,228,110,220,45,111,101,229,200,93,224,144,214,228,157,56,23,44,124,103,148,71,
+    232,154,246,129,27,1,115,184,199,114,71,121,240,96,71,104,65,135,171,133,232,85,224,78,
+    232,29,229,132,222,73,156,208,203,22,163,183,235,192,71,64,58,179,95,163,57,2,224,177,
+    229,171,126,246,198,73,251,166,55,250,66,56,167,119,208,55,253,95,111,153,176,254,52,113,
+    100,185,14,202,44,156,37,30,233,131,196,182,26,41,142,113,143,244,161,221,96,61,187,43,
+    117,63,195,207,240,79,58,105,137,236,238,69,8,92,147,29,92,68,105,143,244,49,242,71,
+    202,129,188,234,101,159,197,188,103,35,165,167,149,7,20,104,221,255,140,148,67,57,142,15,
+    197,139,182,158,237,164,235,4,243,28,171,67,11,82,183,191,162,164,103,178,121,129,93,104,
+    144,83,6,129,32,248,220,37,131,23,143,252,170,216,185,8,46,161,205,97,125,72,35,193,
+    34,248,12,131,33,156,71,199,115,38,73,11,30,135,214,67,213,234,182,15,53,11,121,167,
+    97,215,122,178,91,249,161,217,122,60,183,61,165,218,54,179,61,41,167,98,83,242,230,61,
+    147,85,153,126,190,38,69,49,97,51,98,118,49,189,36,253,52,99,141,142,213,26,21,78,
+    191,199,130,113,76,111,212,104,89,233,166,126,95,249,23,187,169,207,43,223,225,239,3,125,
+    223,85,190,231,238,222,113,185,135,111,177,233,221,70,136,87,219,52,68,231,194,234,41,37,
+    122,42,81,179,68,163,89,107,66,250,153,242,115,179,161,165,118,254,176,71,156,151,113,25,
+    62,216,66,46,252,69,23,63,94,158,135,159,212,105,17,142,155,168,218,17,9,28,80,194,
+    145,22,46,103,74,225,198,80,22,19,149,71,174,210,40,151,252,202,74,227,23,39,229,72,
+    7,70,126,208,143,157,24,183,91,215,169,107,134,254,202,1,235,161,235,56,180,7,142,106,
+    208,33,180,29,72,217,145,93,42,117,112,159,233,193,22,199,251,214,220,87,182,251,99,92,
+    250,50,19,118,153,195,61,131,152,142,76,150,246,168,110,220,71,16,126,78,11,228,118,9,
+    107,250,15,206,83,212,35,36,232,147,142,135,236,139,110,76,113,2,57,67,14,195,36,44,
+    247,91,206,103,53,160,221,131,30,159,13,78,34,39,14,38,34,176,47,105,24,138,67,60,
+    75,104,133,10,212,124,203,221,130,81,0,220,30,90,24,246,229,110,13,139,234,77,195,240,
+    72,31,193,134,177,68,81,53,72,104,114,4,188,150,143,38,233,122,86,87,110,23,100,55,
+    89,180,237,139,51,233,209,3,56,222,136,30,4,173,223,21,77,100,133,82,2,86,98,6,
+    148,42,34,145,140,11,135,165,251,219,66,246,209,25,160,47,237,1,190,116,87,73,235,229,
+    200,30,187,23,73,196,37,243,197,183,253,136,46,224,219,14,201,236,153,240,250,51,105,111,
+    163,157,228,97,12,251,186,244,4,4,103,71,110,117,148,59,75,108,71,117,61,200,186,99,
+    39,196,51,130,74,53,35,158,173,246,11,37,58,170,32,179,28,103,105,57,78,186,28,150,
+    44,245,45,238,4,178,44,11,102,27,56,194,67,52,204,127,51,131,89,45,57,46,71,117,
+    6,76,224,30,62,98,147,28,27,110,190,234,27,248,87,59,74,220,59,10,111,114,180,96,
+    7,195,241,168,199,5,151,19,75,238,4,48,249,206,164,10,227,161,6,0,155,69,239,243,
+    6,62,170,208,99,59,61,160,176,141,207,118,193,187,40,105,232,74,213,222,37,238,216,139,
+    144,85,171,90,13,56,117,89,82,3,1,144,170,129,136,149,53,144,21,224,209,11,43,32,
+    114,65,5,208,150,20,239,63,53,132,36,158,35,198,131,226,37,13,2,22,11,35,79,157,
+    59,51,254,233,137,212,88,113,206,245,233,169,170,229,99,129,91,34,196,23,180,109,172,110,
+    63,189,184,237,188,245,174,16,38,40,68,21,59,62,146,51,219,237,232,139,210,88,146,40,
+    139,161,20,90,74,206,192,237,211,194,135,24,238,172,244,214,137,102,129,202,33,210,25,122,
+    23,28,243,226,157,136,160,39,41,72,45,29,160,129,122,76,13,176,130,132,195,20,134,254,
+    158,188,233,198,56,112,114,113,201,68,128,27,33,195,151,11,68,41,244,234,108,0,196,170,
+    7,167,164,92,48,76,54,171,207,185,231,67,103,180,184,5,10,36,63,39,237,123,47,102,
+    70,40,209,21,139,138,52,210,82,176,57,133,164,147,101,255,44,66,111,38,166,161,115,10,
+    200,164,163,212,84,17,14,205,51,39,9,245,108,23,249,158,155,239,253,105,239,55,68,131,
+    182,54,131,27,220,142,124,181,100,112,75,177,11,142,110,217,77,49,137,14,186,97,228,92,
+    226,239,194,54,31,240,138,169,13,115,136,118,84,35,7,216,127,216,22,142,173,149,149,61,
+    218,255,201,20,104,57,189,18,196,210,200,89,45,188,81,19,216,228,97,163,135,69,121,140,
+    143,50,251,232,90,228,87,225,219,195,211,181,128,117,3,70,129,108,255,186,151,82,20,110,
+    123,220,13,31,106,219,146,147,133,60,8,185,218,2,115,155,236,106,107,50,155,77,43,60,
+    67,49,158,158,114,34,209,208,146,70,72,176,184,52,37,177,115,104,201,211,83,57,93,54,
+    89,114,49,187,130,248,36,70,158,129,12,88,113,87,24,162,53,254,30,254,137,80,32,209,
+    77,122,172,83,192,116,124,221,108,76,29,60,199,100,104,171,107,24,122,238,74,20,104,75,
+    138,123,42,64,197,108,28,51,97,24,248,87,27,3,88,110,131,246,171,80,78,145,71,186,
+    181,225,51,114,155,101,253,231,242,221,47,37,178,62,117,80,246,226,192,81,184,55,232,123,
+    219,250,227,93,19,93,36,156,213,66,234,238,86,137,181,222,150,165,1,201,50,93,183,84,
+    155,214,91,138,57,56,106,65,87,30,67,149,202,192,44,58,216,142,99,27,191,24,54,71,
+    84,218,203,108,38,192,87,10,70,248,164,55,36,89,115,42,250,76,8,54,245,148,32,190,
+    133,5,110,133,246,128,188,49,242,19,143,60,191,50,197,85,193,84,13,245,198,188,242,196,
+    107,117,202,47,212,233,0,246,9,96,103,146,132,130,76,217,116,38,125,239,117,141,200,235,
+    137,9,158,240,113,231,76,15,195,109,226,61,153,229,94,82,61,83,239,202,252,242,46,239,
+    120,196,105,52,160,240,89,9,149,140,165,83,101,182,52,93,96,5,48,164,135,82,208,64,
+    146,27,56,197,194,153,16,137,15,204,33,18,72,115,211,189,66,123,121,98,25,166,53,57,
+    172,122,181,18,114,243,163,147,27,56,69,174,85,66,249,192,24,78,184,103,117,47,232,71,
+    154,1,179,16,99,149,137,210,144,173,241,197,199,175,250,201,222,214,106,139,139,23,194,74,
+    88,129,212,25,29,74,121,129,242,128,167,95,208,247,221,242,140,133,240,31,170,127,50,212,
+    84,197,91,30,147,24,116,204,236,246,172,99,52,192,190,54,195,168,37,1,91,253,179,57,
+    86,26,0,14,150,222,1,157,133,144,136,42,5,77,207,116,249,97,46,61,88,14,207,43,
+    235,137,222,196,229,144,43,228,83,2,32,154,185,115,15,167,27,170,206,70,61,39,90,76,
+    134,188,156,223,209,243,51,73,161,82,121,147,4,36,147,138,197,234,1,183,29,231,176,89,
+    122,55,163,157,157,44,123,149,134,208,57,161,116,154,198,110,165,147,82,140,86,58,57,195,
+    61,25,0,22,115,113,159,20,190,102,235,210,151,183,224,26,132,149,120,230,10,143,200,5,
+    14,130,218,8,10,2,111,102,24,69,239,106,177,232,20,185,237,234,174,143,121,86,225,151,
+    92,193,73,247,199,216,165,57,244,100,253,166,140,167,223,246,2,50,180,94,230,233,144,25,
+    91,57,233,223,226,96,81,89,90,88,20,102,192,88,9,78,131,226,105,24,121,234,249,144,
+    182,16,145,120,43,19,97,227,242,113,192,101,113,90,88,21,167,197,65,113,60,107,82,108,
+    154,64,102,74,62,233,205,161,39,72,234,34,14,33,80,142,240,71,230,76,85,41,42,134,
+    105,169,167,195,89,216,3,138,53,201,130,169,36,188,253,30,103,224,84,12,222,141,7,83,
+    39,210,82,129,230,171,40,166,129,202,78,208,35,178,8,177,27,152,134,65,230,210,35,84,
+    46,61,242,175,12,47,190,79,156,13,70,18,92,124,43,80,17,102,60,5,165,118,129,145,
+    70,49,196,13,9,193,23,71,163,66,10,88,197,48,153,170,33,19,247,128,122,2,77,116,
+    126,95,235,209,221,164,68,157,138,83,5,164,226,153,9,105,214,60,147,146,130,222,236,59,
+    147,92,96,76,160,94,38,46,131,119,48,125,34,39,169,47,216,130,151,78,208,102,244,54,
+    119,38,151,153,206,255,51,155,171,213,187,207,175,128,255,31,83,117,34,250,192,185,6,80,
+    105,201,209,153,51,46,147,140,121,144,82,203,182,38,19,88,139,100,164,96,148,1,209,226,
+    172,182,226,251,148,72,56,221,103,255,255,186,251,43,19,17,111,192,204,173,143,42,215,237,
+    194,145,41,33,226,180,27,199,210,147,186,138,23,97,38,17,109,195,145,51,240,141,141,195,
+    135,40,100,175,146,122,136,8,64,55,29,2,177,205,77,172,194,46,198,173,167,176,66,204,
+    117,242,20,12,215,208,227,181,231,183,118,127,167,234,128,93,175,0,6,42,167,204,44,179,
+    254,174,242,157,84,182,180,125,194,25,73,213,32,10,64,91,223,112,3,247,8,197,79,13,
+    27,179,233,80,157,116,93,145,52,228,126,110,122,34,200,221,219,195,193,141,7,189,0,143,
+    208,76,199,130,252,226,183,91,165,32,169,156,131,244,224,183,87,159,11,88,233,157,158,69,
+    16,29,213,145,177,137,235,179,36,155,57,65,19,236,150,232,72,37,154,209,182,124,141,33,
+    123,177,31,173,228,44,24,215,163,169,119,213,36,28,244,37,96,15,234,7,231,91,87,205,
+    12,100,75,65,182,12,200,150,197,10,174,43,236,111,2,179,28,24,162,31,22,179,13,18,
+    40,228,200,76,249,64,72,232,35,224,59,147,97,88,142,144,229,101,35,113,132,201,183,167,
+    46,162,74,204,207,222,77,153,57,244,155,45,4,215,195,185,216,53,204,250,29,89,214,99,
+    251,13,127,176,234,164,134,198,149,225,142,224,166,133,15,24,125,121,136,20,52,41,34,153,
+    24,148,93,203,111,125,210,36,16,153,91,199,36,41,217,157,1,35,95,21,142,182,108,40,
+    142,236,151,160,53,243,67,145,46,3,10,72,70,160,87,211,58,62,74,152,65,41,18,90,
+    11,171,12,90,28,53,69,114,19,142,248,84,128,60,136,198,205,162,254,104,39,47,13,45,
+    6,136,76,253,9,190,77,22,39,196,245,90,179,221,100,168,236,209,141,232,137,134,222,209,
+    122,36,135,25,59,52,54,244,102,64,7,211,227,73,186,160,44,238,8,168,223,133,37,0,
+    33,119,49,173,242,96,227,232,252,39,155,39,3,170,8,25,193,146,180,52,43,229,102,83,
+    104,72,134,106,60,134,198,96,12,57,58,250,205,226,50,163,133,245,13,28,101,254,122,129,
+    190,249,37,156,49,76,235,158,57,108,112,100,75,109,124,235,5,4,73,69,2,152,218,128,
+    9,133,10,65,138,216,227,41,94,124,67,172,126,12,160,36,61,2,210,117,134,159,210,245,
+    136,118,50,25,41,77,6,218,110,234,96,128,137,250,49,160,99,92,57,162,97,154,156,167,
+    239,148,207,51,188,136,168,61,196,220,63,208,99,137,39,182,14,161,20,226,201,173,131,136,
+    51,109,27,29,239,133,45,195,135,95,159,182,12,181,93,4,16,21,192,118,241,236,44,219,
+    45,136,72,61,235,102,114,5,201,145,67,152,89,138,248,48,166,215,143,251,218,41,78,73,
+    152,220,36,137,53,119,106,107,58,249,161,238,44,148,157,156,131,86,170,135,93,141,225,115,
+    82,12,159,74,99,78,134,225,115,53,134,175,227,26,12,159,147,97,248,180,116,230,44,98,
+    248,92,147,225,235,184,57,12,159,179,128,225,203,192,50,103,33,195,231,230,48,124,206,34,
+    134,207,205,50,124,207,47,233,2,150,88,233,83,19,173,199,224,203,171,199,103,97,183,46,
+    121,77,82,231,46,19,214,229,71,251,111,251,94,96,243,4,125,193,145,42,151,235,234,171,
+    77,90,43,119,122,29,104,13,174,139,223,246,155,38,219,212,83,73,131,120,93,252,182,223,
+    52,216,158,158,42,108,101,174,171,47,132,248,106,96,143,167,192,67,244,169,145,234,27,75,
+    57,209,161,178,238,18,215,243,34,17,251,151,84,190,73,48,190,13,140,7,96,235,11,226,
+    177,212,45,35,55,138,108,79,212,17,107,61,19,211,46,9,255,223,37,233,207,248,15,237,
+    213,158,63,28,136,1,178,239,121,140,212,112,77,96,38,195,241,148,43,207,76,108,254,40,
+    16,104,208,150,230,0,58,21,75,71,239,84,28,9,242,82,113,40,240,229,69,154,119,75,
+    23,151,226,201,95,52,132,233,44,47,158,118,82,239,169,66,103,48,112,184,43,72,187,197,
+    163,70,66,72,21,205,183,134,99,148,68,114,33,163,157,192,31,207,166,163,217,84,139,216,
+    143,49,44,113,230,10,88,237,116,146,148,219,102,18,228,179,203,148,86,130,253,209,140,150,
+    10,4,107,180,150,54,248,107,62,84,174,77,185,147,254,213,174,53,25,170,22,177,99,30,
+    33,244,181,134,174,116,170,252,155,252,248,198,83,240,138,147,253,203,150,150,247,190,219,210,
+    244,30,59,181,155,236,135,254,28,239,95,236,59,48,182,78,38,234,223,228,236,186,199,19,
+    34,159,237,241,175,189,46,27,250,116,231,70,233,35,95,188,1,60,226,117,25,117,208,231,
+    226,157,253,200,23,224,157,240,111,188,169,252,27,239,177,100,225,124,101,57,171,226,132,229,
+    207,247,47,172,144,158,208,91,207,157,251,28,37,34,178,254,34,102,111,52,156,192,124,247,
+    232,53,222,75,176,99,161,226,12,92,53,147,119,140,219,246,252,233,233,222,240,220,66,89,
+    74,236,206,74,39,4,247,35,56,99,224,18,114,162,154,130,234,36,47,232,182,245,39,169,
+    121,72,45,211,98,22,253,20,137,122,66,63,112,187,179,69,81,89,110,240,107,62,156,141,
+    139,147,0,249,203,192,47,58,74,149,6,181,180,95,141,10,129,159,213,77,209,54,61,57,
+    161,67,19,116,181,215,71,45,246,93,233,16,100,113,98,246,89,202,227,24,95,124,28,246,
+    99,96,141,249,167,115,15,159,35,153,175,221,124,126,150,238,55,247,194,101,254,55,19,109,
+    116,116,85,131,214,9,39,19,39,12,248,35,88,122,17,128,42,251,62,190,57,232,58,248,
+    166,96,236,176,137,195,134,14,155,57,108,228,176,129,195,238,28,118,239,176,7,135,109,224,
+    163,4,84,94,167,225,141,249,164,254,30,148,55,196,107,205,219,177,29,59,148,182,197,211,
+    190,65,26,98,59,117,50,206,145,56,81,148,122,14,246,150,147,60,164,20,180,51,251,86,
+    103,251,57,13,148,40,64,229,129,231,2,170,23,59,192,142,121,129,72,62,24,78,12,12,
+    92,69,221,124,66,3,203,33,184,18,195,94,18,10,235,24,39,231,97,30,94,161,249,255,
+    87,80,139,21,149,198,110,60,154,206,105,244,169,246,134,53,129,43,44,124,196,122,106,59,
+    76,102,160,7,211,64,192,112,5,107,229,209,13,97,118,138,18,121,108,255,139,113,226,216,
+    254,254,156,148,108,230,48,212,44,83,106,255,153,247,85,235,175,48,69,187,229,196,255,123,
+    90,228,175,162,138,40,87,42,222,245,250,81,80,252,237,180,232,19,98,52,220,55,82,40,
+    97,141,182,203,255,130,118,126,183,149,65,85,219,169,156,178,123,101,99,14,2,164,251,143,
+    22,10,128,201,159,206,35,105,162,206,169,150,70,247,37,38,35,101,6,138,181,84,207,253,
+    38,213,138,201,75,40,26,228,78,186,47,243,38,125,113,95,66,53,100,111,86,78,181,254,
+    92,130,66,116,46,52,175,3,205,235,156,218,94,39,105,98,1,3,170,141,94,103,97,117,
+    181,133,197,141,229,75,136,156,25,54,116,159,51,136,82,245,65,77,161,31,252,42,155,125,
+    175,185,53,159,162,94,255,80,74,155,73,252,5,86,14,126,207,201,45,224,85,79,182,50,
+    248,209,249,180,241,116,155,107,44,107,169,101,216,211,141,231,222,9,67,150,237,162,129,99,
+    130,148,181,18,243,51,14,28,51,77,120,91,30,24,238,150,205,194,105,203,95,94,56,129,
+    96,225,5,163,244,76,78,173,116,74,91,82,58,221,58,46,88,219,166,150,50,234,127,89,
+    254,19,108,138,220,104,41,183,128,119,181,185,127,110,128,185,79,79,46,7,227,198,163,22,
+    128,121,168,188,77,96,210,226,161,6,184,205,171,85,246,141,90,102,58,57,73,42,195,249,
+    1,56,48,160,115,122,6,206,115,47,200,0,208,141,116,6,201,186,47,206,130,185,140,44,
+    25,163,2,114,62,203,17,210,229,24,168,178,173,33,228,144,139,31,156,222,231,191,28,203,
+    242,116,5,201,212,189,8,159,230,235,102,142,230,48,117,164,7,126,215,190,39,122,66,172,
+    7,110,145,243,21,45,200,125,51,150,153,90,46,190,254,233,155,170,206,166,198,126,199,65,
+    141,60,121,47,54,89,89,121,227,235,6,1,146,0,76,30,126,156,222,20,134,28,69,86,
+    113,150,160,140,92,224,64,217,248,231,162,76,223,110,121,134,217,45,1,207,110,23,1,210,
+    52,228,176,82,90,44,190,114,114,184,220,60,142,209,218,116,243,128,147,68,45,39,145,105,
+    187,190,113,122,186,241,67,44,7,230,107,118,13,0,142,63,156,64,35,18,41,184,130,163,
+    0,249,155,5,88,127,63,142,54,14,247,183,174,182,79,55,224,12,227,58,194,250,134,170,
+    139,97,51,97,91,40,195,243,84,58,227,5,99,13,130,173,2,8,89,185,195,69,0,251,
+    140,37,52,212,147,254,182,30,151,55,132,247,63,151,222,229,170,118,144,123,145,124,221,11,
+    45,201,188,214,84,151,24,221,200,33,110,28,53,213,146,167,79,248,242,105,181,130,82,146,
+    89,60,21,79,159,236,79,234,237,147,168,19,239,177,158,93,14,47,130,106,227,178,138,63,
+    171,252,231,253,165,245,118,149,69,60,169,201,227,214,248,207,7,74,26,240,164,22,143,123,
+    199,127,62,98,82,135,99,179,123,29,158,215,142,58,28,210,30,116,120,9,34,105,77,38,
+    189,147,73,239,101,210,7,153,244,17,146,158,95,152,0,122,99,82,195,223,201,29,126,57,
+    34,139,6,159,167,103,135,254,57,89,49,242,78,111,249,208,207,110,151,207,94,148,169,254,
+    196,180,229,232,242,235,60,187,101,173,236,84,53,86,46,127,221,194,179,203,184,23,26,192,
+    111,127,94,104,3,1,253,68,51,20,210,252,150,240,139,196,156,117,231,18,5,70,108,223,
+    226,217,36,240,13,234,82,216,38,87,170,84,141,9,212,241,252,116,159,222,209,159,145,191,
+    123,90,7,216,29,244,97,55,114,72,55,127,150,149,217,209,248,115,55,190,110,2,237,157,
+    88,240,250,119,98,62,218,155,229,207,164,184,10,186,143,111,155,28,82,34,174,150,174,74,
+    213,158,252,224,226,125,31,24,95,186,10,26,4,210,200,210,155,102,7,53,140,143,96,192,
+    142,108,84,227,69,37,222,64,127,38,179,31,119,163,25,138,68,112,80,239,212,131,208,128,
+    218,208,179,68,150,16,11,197,183,155,29,174,29,237,213,53,129,129,164,121,64,189,155,157,
+    116,77,0,107,104,143,137,39,251,46,227,146,65,245,96,168,237,22,54,234,222,209,204,133,
+    10,27,91,177,125,227,8,63,86,0,241,224,112,163,88,244,134,180,28,147,186,108,100,61,
+    70,242,57,55,106,207,146,138,252,100,95,154,64,224,35,180,39,158,103,42,151,94,47,25,
+    76,176,94,150,39,112,95,11,191,105,19,17,187,162,93,156,77,80,70,194,51,44,168,6,
+    121,178,238,1,177,134,35,94,80,244,135,129,97,101,189,168,222,255,23,243,171,135,34,151,
+    130,233,240,58,34,133,243,6,77,160,92,102,97,102,12,88,167,103,247,50,187,44,183,160,
+    133,51,146,4,189,42,141,238,142,39,244,58,245,43,90,159,239,201,215,167,189,139,175,244,
+    250,180,241,217,30,203,167,166,51,17,167,142,216,55,60,101,100,223,8,226,136,142,131,217,
+    45,4,251,211,96,64,106,24,247,114,144,111,204,203,173,123,158,245,206,190,23,68,132,109,
+    194,39,62,85,235,220,99,220,28,234,125,18,140,133,228,25,179,222,208,208,195,226,1,110,
+    241,86,246,186,106,8,71,55,135,162,209,167,9,219,179,231,112,166,29,247,253,160,115,3,
+    113,226,10,12,230,200,92,159,64,25,116,235,229,44,105,218,136,253,237,254,109,31,143,93,
+    99,54,71,17,83,239,68,47,56,241,185,142,212,255,94,33,223,66,154,66,111,154,50,177,
+    118,22,77,101,46,168,145,213,46,228,144,199,49,110,75,139,73,242,221,162,93,107,204,110,
+    217,38,27,177,189,202,61,43,71,149,189,234,141,85,185,23,42,203,55,217,181,164,10,124,
+    177,35,110,254,153,142,200,162,169,220,168,142,200,237,7,182,188,31,216,242,126,104,176,168,
+    114,139,61,240,156,121,225,137,85,28,217,83,152,227,137,166,201,200,178,38,119,125,148,67,
+    142,164,38,60,28,205,33,99,171,109,150,211,234,222,66,25,120,189,8,44,239,117,135,96,
+    86,83,48,171,57,48,107,41,152,53,130,41,40,32,177,94,83,80,77,129,233,249,249,121,
+    217,238,247,44,233,237,202,74,170,211,118,14,118,208,152,254,149,209,121,177,88,137,144,207,
+    134,125,3,73,205,92,26,166,10,215,99,59,228,3,211,86,189,131,143,95,99,123,32,183,
+    81,220,69,112,179,61,69,201,21,62,38,26,79,43,110,103,160,89,89,147,145,109,254,202,
+    234,171,254,122,96,128,94,54,84,184,145,248,67,140,89,88,213,17,83,105,21,151,13,170,
+    101,13,179,136,109,203,138,91,86,173,89,251,90,109,18,213,193,202,118,73,196,46,247,106,
+    75,94,154,235,187,42,223,160,81,33,141,236,58,150,181,52,140,36,185,83,69,138,236,119,
+    215,79,219,77,114,216,137,155,58,62,109,222,38,115,229,103,226,241,176,152,55,1,213,28,
+    211,197,204,105,180,245,28,138,31,145,3,94,32,160,102,46,208,213,25,124,157,24,243,167,
+    149,15,184,187,113,164,108,44,112,21,187,245,178,111,227,19,76,209,140,100,173,250,100,29,
+    176,73,76,153,217,250,76,83,37,174,179,128,94,2,227,93,103,186,237,109,9,115,48,28,
+    142,50,233,87,7,199,199,39,86,59,19,205,219,197,51,115,213,60,97,241,82,0,157,28,
+    239,31,157,67,23,45,103,0,214,27,159,115,9,143,52,234,34,227,39,101,143,125,5,246,
+    77,121,21,44,99,72,10,36,61,254,154,217,224,248,172,71,245,208,30,67,157,63,104,31,
+    166,195,235,116,236,112,123,104,186,124,77,217,78,129,190,253,25,235,41,214,51,108,254,127,
+    112,230,131,95,76,150,221,252,66,92,154,205,174,178,65,97,101,76,122,104,105,234,4,232,
+    217,141,142,247,57,73,145,150,39,188,106,213,154,106,57,46,188,75,84,118,26,134,202,235,
+    132,158,170,146,158,45,126,215,79,98,15,182,233,104,23,194,14,89,173,49,13,82,2,128,
+    35,233,201,166,179,126,235,60,61,149,123,101,216,54,28,100,66,219,89,225,73,142,28,137,
+    92,205,144,119,153,254,68,152,215,120,5,55,199,209,181,139,252,25,154,116,124,147,235,84,
+    134,35,69,46,76,110,16,111,118,172,71,178,222,128,151,173,29,126,207,218,17,239,168,29,
+    77,85,211,201,181,159,168,220,204,114,67,127,168,39,150,7,86,136,157,196,216,107,217,21,
+    23,9,188,50,48,216,154,165,135,244,4,204,24,220,224,146,165,206,200,207,26,211,112,51,
+    239,12,153,155,107,198,175,231,152,239,240,200,170,76,228,216,11,239,220,59,67,31,31,115,
+    82,173,114,46,236,89,68,213,126,176,103,90,35,30,100,35,184,145,162,13,93,139,192,226,
+    61,108,196,161,149,24,12,66,14,124,131,11,197,185,65,216,143,197,67,90,136,221,82,11,
+    58,215,110,133,232,185,212,234,18,168,32,95,130,136,90,128,230,182,104,128,79,131,9,42,
+    93,37,145,120,247,130,181,72,248,29,82,201,226,6,131,114,37,157,48,30,3,85,185,7,
+    26,34,232,80,223,46,60,160,182,229,205,44,16,175,142,31,112,169,199,19,97,20,146,36,
+    74,67,24,18,228,99,229,185,145,51,186,104,193,38,157,130,79,236,133,53,193,25,156,46,
+    177,144,46,30,7,147,200,64,68,242,173,33,3,142,20,62,5,140,6,208,50,157,74,246,
+    153,244,78,133,246,119,157,133,14,95,176,245,174,35,152,139,9,87,177,225,238,244,38,211,
+    242,155,70,126,226,161,51,185,78,39,114,205,226,84,34,153,179,141,230,225,48,230,134,164,
+    203,40,200,205,26,77,161,122,234,139,12,190,13,75,135,176,194,184,242,139,220,8,156,8,
+    38,186,184,213,253,6,19,53,123,205,233,192,145,245,23,219,184,254,157,188,206,197,246,120,
+    142,231,200,233,16,14,148,1,94,93,59,213,146,242,45,57,131,178,38,226,206,15,43,82,
+    220,59,249,38,143,143,147,226,48,142,230,144,195,44,20,26,236,84,225,116,46,173,178,62,
+    231,248,154,205,212,254,141,130,215,156,24,162,72,122,129,159,49,212,70,195,215,217,47,53,
+    207,40,182,13,39,96,188,206,196,118,166,220,143,57,19,217,228,73,189,248,141,60,56,5,
+    253,113,81,234,53,22,133,101,188,57,17,233,192,65,251,114,140,118,10,230,218,154,87,195,
+    174,99,20,88,230,38,160,202,86,186,11,94,223,1,175,106,101,91,247,252,137,59,10,204,
+    220,113,224,193,2,240,25,181,86,175,84,166,9,57,181,46,228,87,219,244,8,252,87,199,
+    14,177,252,133,241,195,108,250,8,230,121,145,251,135,134,81,250,226,77,84,167,159,158,210,
+    12,13,121,78,179,86,86,178,14,144,215,141,254,36,71,172,216,31,237,76,180,240,219,153,
+    154,37,161,73,174,115,174,29,119,159,115,9,187,193,223,148,119,109,124,84,175,118,5,101,
+    162,48,235,144,139,232,101,198,159,39,222,246,20,184,121,67,210,213,242,72,192,7,71,241,
+    101,168,152,179,100,192,161,139,47,28,225,148,20,163,118,29,47,184,68,188,208,253,242,142,
+    58,185,182,182,216,111,50,74,92,52,91,236,155,173,2,72,175,173,246,210,187,109,182,236,
+    98,26,112,253,27,90,184,143,118,41,148,136,89,119,38,182,109,56,19,131,237,104,223,118,
+    211,247,234,230,53,184,220,1,244,171,236,111,180,31,193,126,44,58,77,205,49,182,157,239,
+    122,206,44,118,59,199,11,229,246,82,87,156,233,14,102,94,218,41,189,132,128,253,240,208,
+    17,58,249,150,98,117,29,95,31,57,210,107,153,232,58,45,186,196,25,89,2,110,75,50,
+    51,228,82,28,189,100,174,144,85,10,105,222,12,230,22,154,8,217,127,197,80,132,150,176,
+    106,129,42,124,92,244,172,186,149,13,236,72,248,246,67,47,175,92,132,39,252,66,15,86,
+    86,250,142,114,77,61,176,222,8,37,50,101,107,12,202,217,63,60,225,194,136,141,243,253,
+    227,35,238,168,231,234,116,103,99,251,106,247,248,244,112,227,220,90,127,21,131,159,215,137,
+    237,162,238,89,82,178,253,253,184,136,62,88,138,195,113,177,63,24,113,249,162,195,237,158,
+    114,123,198,194,81,32,42,214,8,55,99,241,211,147,214,142,216,178,127,170,29,231,63,78,
+    118,44,116,75,66,206,82,240,210,118,137,125,226,167,167,130,169,61,69,76,207,21,31,22,
+    9,196,177,189,231,216,36,56,186,56,49,128,117,139,197,235,219,117,175,23,120,215,218,24,
+    163,193,154,217,196,28,105,222,50,45,130,92,98,29,236,156,239,192,225,154,252,165,127,134,
+    145,39,9,66,13,120,40,180,98,5,12,15,198,113,61,156,90,128,162,38,28,13,62,2,
+    101,57,117,141,105,192,140,206,196,147,248,223,26,98,89,88,17,77,103,155,67,222,117,128,
+    139,242,235,69,173,217,52,7,240,144,31,193,192,225,24,255,243,211,235,91,60,233,135,48,
+    145,54,231,211,224,28,150,195,146,169,134,171,5,42,241,12,33,84,74,126,4,206,187,240,
+    210,106,220,87,214,25,255,225,170,103,242,11,151,172,37,165,227,1,180,93,171,215,249,48,
+    195,91,25,26,51,174,238,14,149,188,166,232,190,79,89,215,214,230,129,242,102,159,101,93,
+    97,18,53,80,190,141,165,107,78,225,183,117,71,160,222,211,83,131,117,129,208,222,195,191,
+    57,77,185,134,94,107,129,108,81,141,81,180,32,93,81,234,117,238,166,235,28,234,117,246,
+    100,157,129,58,26,209,56,170,92,219,161,63,193,203,81,249,24,76,34,195,43,138,182,8,
+    228,180,215,35,175,166,219,72,97,207,102,110,110,123,125,108,175,108,45,236,12,44,100,61,
+    211,130,250,177,203,37,87,220,203,15,26,126,47,149,100,127,160,118,6,89,218,86,42,56,
+    194,174,133,233,197,167,85,127,183,83,91,75,80,158,184,114,124,95,135,212,244,45,164,249,
+    5,234,166,125,14,53,119,86,147,98,198,104,127,122,99,129,179,163,51,47,136,3,81,102,
+    250,0,108,11,13,213,144,127,184,142,119,141,70,89,99,95,23,76,41,137,141,97,242,58,
+    112,145,131,59,94,84,40,157,120,101,49,57,45,110,190,255,240,225,67,11,237,213,8,53,
+    254,145,86,164,124,52,37,93,28,69,218,147,3,172,172,124,90,32,159,114,78,208,230,181,
+    218,255,139,27,30,55,66,189,172,106,37,89,174,232,8,195,237,19,233,239,187,162,210,244,
+    226,139,27,70,71,207,57,245,119,154,205,208,77,111,73,199,31,28,111,151,58,92,18,83,
+    231,212,235,68,153,46,39,104,246,24,33,99,51,105,63,6,241,12,229,86,112,206,198,151,
+    44,244,174,168,125,113,249,172,91,202,222,242,196,83,48,238,172,137,23,68,70,139,144,223,
+    140,80,125,182,97,37,177,202,220,79,198,180,80,243,125,37,201,171,172,21,25,42,120,150,
+    112,14,21,225,11,179,105,32,132,92,40,231,145,34,190,12,6,58,96,8,100,42,81,102,
+    196,231,106,178,134,132,1,197,171,121,199,170,51,97,149,169,168,231,70,98,11,71,164,226,
+    221,120,24,135,69,94,70,93,42,219,26,197,20,46,46,25,190,214,112,237,76,253,58,206,
+    103,183,227,160,212,54,157,139,219,81,166,151,23,90,119,79,150,45,169,77,200,94,210,44,
+    199,250,124,104,134,154,135,45,46,62,209,167,93,98,232,90,204,61,50,77,53,244,33,205,
+    153,78,29,96,54,124,61,129,59,168,224,14,167,82,177,162,230,34,81,200,24,81,50,136,
+    245,226,102,253,104,186,122,138,174,96,222,178,80,236,54,30,57,115,170,35,111,162,177,142,
+    223,3,46,232,211,250,226,219,178,149,158,49,107,240,242,98,87,119,42,242,109,15,70,252,
+    123,216,143,109,21,242,128,30,148,136,18,149,12,18,240,194,202,159,57,154,245,118,195,125,
+    97,222,108,195,170,183,139,35,201,146,22,147,216,147,126,224,145,26,66,49,130,57,7,73,
+    202,229,123,189,184,69,42,122,190,6,45,111,119,244,3,59,54,220,113,184,216,118,99,73,
+    215,149,228,121,154,223,200,100,233,208,238,34,66,133,187,3,61,170,40,63,82,95,183,101,
+    47,87,232,34,112,236,196,254,112,80,54,172,237,139,10,61,206,150,77,84,189,69,218,36,
+    159,249,175,204,139,247,88,90,190,47,206,178,217,99,154,149,248,217,125,98,66,182,202,154,
+    73,96,99,58,5,82,202,247,142,55,141,151,103,142,170,229,175,98,239,223,88,90,207,191,
+    63,88,208,27,175,30,173,219,101,36,104,15,109,167,107,221,252,195,215,143,189,196,220,68,
+    168,116,111,140,85,42,89,182,38,134,173,103,26,112,209,51,118,84,130,245,212,205,98,101,
+    3,54,99,177,137,155,123,203,83,233,8,141,48,226,90,0,217,49,91,188,105,112,229,139,
+    6,79,240,154,3,81,172,147,95,27,190,231,71,253,209,15,163,98,219,184,27,22,50,53,
+    179,30,7,73,159,15,214,7,109,244,91,44,253,23,243,227,53,58,41,198,47,243,121,216,
+    118,214,237,125,113,48,155,76,139,110,80,12,250,176,251,72,234,64,128,252,153,22,30,82,
+    180,72,161,252,205,211,74,230,93,135,112,159,76,182,175,109,244,87,157,73,254,160,37,183,
+    96,155,204,244,110,210,206,1,154,149,207,235,91,71,246,173,124,145,1,137,187,253,8,217,
+    151,196,126,228,122,136,103,244,85,217,249,113,26,160,183,222,211,0,94,57,28,103,196,12,
+    238,46,152,171,74,207,77,222,59,151,132,255,58,216,174,197,0,218,23,13,214,184,132,195,
+    194,227,51,28,13,46,74,78,137,149,92,124,190,92,34,253,41,33,193,145,249,165,67,133,
+    2,154,235,4,66,45,148,240,184,175,3,223,86,183,180,131,207,126,103,32,253,3,204,236,
+    232,98,112,73,32,120,171,187,250,139,71,183,184,66,177,110,118,209,187,240,46,47,133,218,
+    23,134,202,94,181,105,253,175,85,136,235,94,52,46,109,77,187,2,142,92,221,139,230,101,
+    162,123,65,81,177,141,112,85,168,116,21,83,147,1,14,47,226,75,212,250,131,31,251,145,
+    148,6,155,109,4,101,244,221,106,35,244,51,30,68,160,102,120,193,90,12,173,1,101,98,
+    104,42,27,15,72,200,200,93,12,184,194,97,243,146,185,156,101,145,118,105,122,245,7,43,
+    23,180,149,11,170,244,120,68,167,154,42,1,120,45,222,147,174,39,165,71,46,194,134,154,
+    133,78,174,154,227,76,130,8,203,148,142,112,135,209,193,214,95,39,126,195,174,237,139,71,
+    210,103,105,55,24,87,140,153,113,45,20,102,184,195,104,55,158,47,145,135,225,195,25,40,
+    12,192,194,5,157,106,213,161,203,249,129,93,184,190,112,80,50,59,224,58,50,204,151,122,
+    53,108,96,195,172,178,189,170,47,38,128,189,106,165,71,29,6,28,101,64,191,151,7,85,
+    15,56,201,36,36,70,221,98,217,65,103,217,65,103,169,65,103,63,57,232,157,156,49,39,
+    127,102,41,229,178,50,208,54,49,252,86,254,240,47,207,213,178,22,207,4,172,194,130,145,
+    133,158,108,48,92,79,212,175,111,87,213,130,74,119,103,104,175,86,160,39,23,86,35,204,
+    175,53,207,38,186,252,149,153,11,50,183,56,157,250,137,2,87,185,36,43,94,34,254,235,
+    161,236,178,85,221,183,207,142,39,217,195,163,69,251,60,103,6,225,232,148,208,42,254,12,
+    94,57,123,176,201,201,26,16,91,58,210,76,96,71,131,249,231,93,79,212,142,150,180,66,
+    226,160,211,197,185,148,5,72,86,38,24,135,193,111,98,201,234,236,182,2,92,72,80,147,
+    90,154,229,252,84,93,185,196,9,72,112,128,127,186,248,39,196,63,114,245,71,226,119,32,
+    126,77,135,180,35,54,101,215,236,198,118,171,77,154,196,228,142,248,179,237,37,254,88,110,
+    237,233,91,238,197,229,26,210,174,63,219,110,231,90,166,221,219,215,111,225,56,86,190,103,
+    183,184,149,5,124,120,133,69,45,248,7,163,219,248,108,223,215,154,59,181,119,235,101,128,
+    171,21,240,19,160,7,232,158,115,50,115,127,11,208,72,193,4,167,184,101,181,17,164,186,
+    0,98,192,208,137,35,160,187,77,208,49,254,141,176,113,62,54,118,91,205,133,224,216,122,
+    117,111,60,156,76,100,36,242,58,201,41,10,14,96,221,236,100,239,132,60,238,30,61,14,
+    63,39,93,198,123,44,233,38,222,75,112,168,171,220,84,175,171,104,148,187,60,133,245,33,
+    66,81,18,194,167,61,136,144,0,129,187,139,44,25,227,104,220,157,210,15,247,95,181,96,
+    2,92,48,121,128,188,117,18,172,187,8,108,118,43,65,66,214,210,151,222,174,151,200,13,
+    23,46,190,97,52,135,83,48,28,243,147,9,93,200,204,104,185,203,193,172,6,218,38,166,
+    53,26,98,157,193,180,102,126,48,117,250,81,219,95,190,22,71,137,151,240,151,86,163,6,
+    250,104,250,104,235,137,222,22,50,69,7,41,170,230,120,141,95,47,87,236,213,142,87,191,
+    183,157,11,183,218,184,132,207,57,125,54,241,243,129,62,91,151,25,183,106,88,86,227,23,
+    31,24,67,210,153,186,71,117,246,11,247,18,63,107,77,171,195,21,134,33,150,127,60,200,
+    100,255,109,139,219,45,63,217,175,162,152,106,247,197,126,126,145,124,188,182,179,61,114,35,
+    223,241,109,20,179,138,55,26,64,75,34,180,59,98,40,250,37,138,117,156,138,248,226,55,
+    20,191,61,114,1,82,144,178,164,78,15,119,239,71,232,205,139,30,244,31,170,105,241,111,
+    216,107,125,249,13,124,142,120,24,130,135,143,107,216,253,231,182,207,238,236,144,109,242,237,
+    122,52,188,43,183,152,99,177,61,172,15,103,31,26,176,153,217,155,156,61,220,3,198,16,
+    83,184,138,237,181,112,48,99,65,29,198,163,242,29,27,188,221,180,216,137,61,207,141,255,
+    98,111,214,6,29,190,137,54,58,209,103,251,75,39,2,156,136,242,34,186,180,197,115,132,
+    1,252,108,174,127,109,127,53,113,156,176,232,237,23,235,57,169,209,166,218,94,57,182,86,
+    165,12,232,173,90,147,144,94,243,230,116,163,33,2,188,133,93,157,208,255,175,214,122,57,
+    40,83,137,64,35,46,45,70,1,248,186,184,150,1,250,4,202,182,0,44,147,11,72,148,
+    133,36,35,119,236,132,121,18,198,149,35,123,137,78,36,12,149,11,115,29,56,105,28,43,
+    23,230,58,126,18,199,250,64,159,196,145,106,132,50,125,229,13,67,84,224,185,109,52,165,
+    197,115,219,100,132,145,114,195,231,3,84,204,211,43,150,212,203,17,245,114,161,94,110,82,
+    47,23,235,229,80,189,112,13,226,98,165,207,38,126,62,208,39,212,43,226,171,153,58,216,
+    153,58,113,11,22,246,3,171,65,62,203,88,86,172,89,211,129,106,184,244,19,3,240,0,
+    94,129,127,85,200,91,65,130,96,233,11,82,10,230,70,29,105,224,101,209,106,224,178,189,
+    45,116,64,79,191,215,226,247,30,248,177,57,180,238,62,105,221,125,213,254,196,230,85,251,
+    61,89,9,11,166,229,222,197,61,182,18,127,154,252,167,117,137,166,178,100,218,42,143,92,
+    227,63,239,46,209,180,163,76,123,207,35,63,240,159,143,151,184,53,99,90,116,49,71,156,
+    248,3,51,5,182,55,25,217,226,145,171,228,34,94,70,174,241,72,68,45,157,85,91,228,
+    52,219,229,63,158,85,247,251,183,125,63,16,163,190,42,148,56,238,108,173,99,125,236,125,
+    31,122,191,19,194,174,4,197,195,22,119,135,129,46,4,90,64,37,41,112,13,129,53,32,
+    152,119,124,17,225,161,193,249,172,206,127,14,118,139,11,231,62,135,104,7,125,64,141,125,
+    250,88,67,206,71,49,248,156,234,178,250,167,207,137,245,52,138,90,89,169,55,127,65,205,
+    144,122,235,23,151,40,45,34,171,162,254,55,196,120,34,166,165,98,124,17,179,70,49,22,
+    204,214,87,109,188,189,215,109,188,61,33,72,183,94,222,128,35,220,128,59,220,245,158,210,
+    211,198,7,76,244,44,66,188,185,45,91,109,83,4,172,226,147,77,105,79,220,60,44,218,
+    182,207,97,239,112,210,251,118,102,39,17,155,134,35,55,13,119,249,14,253,205,37,1,207,
+    139,219,243,55,33,184,27,233,98,201,139,38,195,255,106,244,127,234,79,13,22,197,69,139,
+    209,91,72,182,202,240,107,21,190,90,240,23,9,66,74,160,169,181,237,197,189,50,219,66,
+    77,10,250,66,31,30,123,211,127,188,11,39,188,107,94,234,193,201,130,30,196,254,169,241,
+    159,6,91,16,132,174,196,174,91,131,192,26,117,227,42,123,7,127,223,81,183,182,224,183,
+    9,255,86,169,139,215,224,239,26,107,101,187,56,105,122,186,135,11,63,213,197,251,47,116,
+    241,190,55,156,252,227,125,252,219,235,250,88,128,61,114,90,95,110,86,147,29,3,182,133,
+    183,173,142,217,249,208,207,30,245,178,199,59,189,198,67,244,67,17,11,82,61,61,181,102,
+    36,211,72,53,155,98,120,154,4,241,1,254,126,96,77,26,80,74,196,228,79,152,140,67,
+    133,97,28,220,38,2,189,71,64,246,17,198,241,19,141,244,26,45,152,22,196,175,194,63,
+    140,255,72,41,159,104,236,41,243,123,158,247,35,229,253,4,191,57,203,75,27,147,191,55,
+    248,255,122,97,240,183,135,126,224,253,227,163,255,253,117,163,255,253,133,209,135,13,169,9,
+    71,229,204,28,208,255,215,9,24,203,33,111,198,7,140,187,47,198,223,167,217,32,66,24,
+    88,156,210,48,18,106,70,138,15,243,103,21,71,245,3,12,53,76,5,90,213,48,81,40,
+    240,137,53,63,224,47,159,38,239,41,225,3,76,130,143,248,243,145,230,22,77,51,156,40,
+    240,141,63,77,156,29,31,249,12,129,168,150,152,145,205,143,172,208,192,191,144,254,158,79,
+    63,154,70,56,201,154,84,98,11,147,154,148,243,35,205,192,85,74,128,28,48,199,154,56,
+    9,155,132,166,41,104,206,26,34,167,63,13,34,83,148,34,230,248,59,170,122,19,255,82,
+    43,222,17,248,39,252,75,191,107,84,111,170,29,82,47,248,195,9,218,167,236,68,214,231,
+    215,223,218,40,190,122,166,250,226,194,77,119,230,6,75,138,24,57,116,31,48,157,185,104,
+    35,86,94,231,233,103,55,252,112,34,149,2,195,140,86,199,252,118,240,156,248,1,239,230,
+    235,230,235,101,183,139,83,103,20,192,113,207,153,20,221,32,136,139,220,132,12,249,54,231,
+    220,238,239,218,29,146,108,2,62,75,132,82,201,201,57,255,20,235,61,22,102,28,165,49,
+    138,137,186,191,86,9,234,123,225,210,116,94,90,144,70,149,30,181,51,59,132,80,152,141,
+    90,95,120,225,183,49,45,7,111,93,54,227,135,203,174,29,202,90,93,4,151,29,116,185,
+    167,234,130,17,154,168,203,79,68,93,3,251,250,173,95,17,167,128,74,139,197,194,93,20,
+    240,156,3,171,51,176,107,20,4,58,136,193,8,78,41,131,74,23,14,16,113,37,168,223,
+    67,120,78,225,57,133,231,16,126,160,240,3,133,31,32,172,75,157,110,114,196,104,61,192,
+    56,3,124,94,5,162,33,52,135,208,156,66,115,8,61,64,232,129,66,15,157,113,142,128,
+    120,161,8,1,167,192,139,243,252,47,76,194,66,50,11,93,52,5,245,126,205,16,45,124,
+    132,94,15,158,158,222,52,59,210,0,139,96,106,119,199,65,28,240,135,41,168,66,153,153,
+    104,97,50,209,140,121,22,46,154,103,218,216,10,113,70,158,84,116,43,145,138,178,107,54,
+    70,145,199,13,254,185,197,63,247,82,216,128,122,76,241,103,183,19,227,209,190,28,163,216,
+    130,220,21,6,235,110,187,97,105,32,182,128,73,79,164,1,12,98,12,19,113,0,195,7,
+    179,137,221,242,161,130,104,140,202,30,134,175,237,102,34,112,229,232,155,136,222,39,244,226,
+    69,68,217,71,65,226,117,181,28,215,224,228,226,169,112,12,199,34,254,93,190,134,148,106,
+    220,185,231,197,233,145,60,147,131,29,125,47,133,142,30,250,105,78,206,59,74,242,120,255,
+    170,3,208,152,21,94,117,2,186,121,249,228,115,107,138,30,15,60,243,18,123,9,81,29,
+    142,103,147,175,241,112,250,26,226,61,197,167,30,110,102,118,231,76,234,81,59,96,55,237,
+    174,70,88,195,5,132,53,93,126,187,200,111,116,201,4,117,66,99,147,151,51,252,1,9,
+    247,161,81,46,222,179,226,156,21,31,138,150,166,137,178,148,129,249,97,220,239,191,200,200,
+    164,192,31,179,114,75,22,200,215,118,138,202,57,168,215,233,189,117,43,14,44,101,69,236,
+    240,153,44,204,106,191,82,40,183,170,158,85,169,11,69,8,76,67,199,212,48,211,253,10,
+    79,234,66,34,68,60,216,130,140,34,82,23,115,44,166,78,178,31,95,191,21,255,133,209,
+    36,77,188,38,167,83,245,53,217,56,46,156,243,44,162,93,190,30,231,91,138,128,181,58,
+    93,187,251,244,180,106,74,74,129,168,192,159,25,254,137,133,200,103,196,198,226,247,70,252,
+    222,138,223,123,241,59,23,191,119,154,72,73,80,19,175,83,173,198,124,60,54,129,126,120,
+    149,32,217,135,58,97,121,147,150,131,195,110,80,144,178,89,173,55,154,34,226,214,234,204,
+    245,59,143,91,4,185,195,229,102,196,220,155,151,32,115,148,200,220,153,113,247,108,142,112,
+    250,38,117,103,132,10,88,221,77,168,238,38,82,167,106,117,147,87,119,207,222,52,54,205,
+    175,118,205,77,230,199,158,213,217,179,221,100,50,236,161,240,233,222,190,129,109,174,252,181,
+    114,7,63,123,149,123,148,28,93,215,209,188,201,156,199,206,41,118,142,177,15,16,251,192,
+    99,31,40,246,1,183,94,34,99,128,136,65,54,248,7,113,99,189,23,174,161,205,70,221,
+    7,60,199,24,114,140,33,199,24,115,204,132,54,225,91,79,125,67,75,196,133,207,38,80,
+    225,77,28,150,205,60,178,44,41,242,166,32,174,174,10,107,20,121,147,40,50,235,25,20,
+    121,211,164,200,50,21,151,100,144,38,198,189,87,17,227,232,117,210,168,193,203,180,120,102,
+    210,226,67,78,139,11,130,84,44,37,196,63,177,108,83,139,212,203,172,99,159,57,99,15,
+    185,138,101,212,240,15,157,45,124,137,22,26,192,143,75,41,209,79,83,161,215,55,231,37,
+    26,244,49,75,130,222,11,18,36,151,151,224,109,147,235,223,132,26,229,95,252,2,163,163,
+    243,186,158,226,50,198,16,49,198,233,60,150,92,198,141,61,134,117,28,0,209,186,6,242,
+    83,72,168,15,176,164,118,217,169,106,139,250,214,178,146,192,13,174,158,249,34,8,92,243,
+    4,241,160,83,129,91,117,197,10,200,25,100,135,127,15,184,74,239,109,199,192,140,92,148,
+    99,96,50,110,120,103,108,96,174,115,177,156,98,192,26,215,209,143,85,66,45,160,117,9,
+    229,128,53,255,172,113,95,122,191,52,147,126,113,12,230,106,12,103,118,215,140,81,139,253,
+    26,190,187,250,66,191,38,112,90,226,221,37,75,188,251,170,37,30,190,82,224,252,74,65,
+    179,118,184,10,140,195,149,184,225,232,178,66,104,55,96,118,185,232,130,171,230,119,122,159,
+    61,188,220,243,173,176,10,227,124,17,93,214,156,139,222,37,244,130,67,183,123,85,136,162,
+    91,169,200,238,161,6,88,0,252,114,227,51,55,205,24,0,103,27,64,246,0,179,119,237,
+    31,104,157,205,129,19,24,254,193,59,143,174,166,101,30,80,97,193,47,152,165,182,16,28,
+    14,186,83,183,220,133,110,141,131,251,41,250,121,62,242,160,31,25,236,210,60,38,199,27,
+    212,177,16,57,161,193,11,71,170,25,59,29,88,136,101,215,6,22,198,31,10,129,15,156,
+    86,200,46,1,112,100,253,56,24,195,241,101,138,180,195,145,101,33,67,56,118,202,228,156,
+    226,150,169,4,152,41,252,139,26,243,120,68,218,220,142,237,114,239,22,183,132,147,174,135,
+    9,90,88,184,193,39,26,207,244,18,190,236,113,103,218,174,170,187,171,189,75,201,176,196,
+    136,141,183,5,120,211,174,124,241,72,142,174,161,37,69,97,148,35,226,151,205,176,240,254,
+    240,213,57,83,240,142,120,131,6,245,250,195,230,191,144,51,162,170,253,97,23,248,71,135,
+    215,11,85,202,122,180,106,16,90,128,144,78,175,68,64,129,158,29,113,181,62,212,36,165,
+    195,85,19,187,20,235,195,41,75,143,195,225,32,207,240,174,180,3,103,247,106,181,195,205,
+    171,69,226,150,55,166,91,85,180,177,10,91,44,27,217,35,94,30,218,148,194,139,86,65,
+    199,198,157,198,231,248,233,169,241,249,122,101,101,212,177,200,99,26,100,33,245,53,24,174,
+    209,211,19,52,249,51,100,126,176,214,1,105,148,180,141,197,181,154,213,134,184,145,134,252,
+    26,226,216,205,250,141,104,219,160,221,179,7,112,80,227,141,187,1,78,110,208,137,236,209,
+    243,141,222,246,113,197,110,137,129,107,126,158,113,66,2,253,223,225,131,253,70,142,115,135,
+    107,225,209,4,24,201,56,24,181,174,229,180,31,111,0,254,26,200,12,215,176,9,128,53,
+    236,118,102,192,234,16,116,108,223,116,198,246,141,202,129,102,234,28,212,92,97,99,203,186,
+    193,73,202,109,232,209,61,28,80,208,95,128,222,173,227,239,152,255,182,225,183,29,139,112,
+    204,195,108,19,165,9,0,57,95,199,223,49,255,133,148,57,64,206,127,41,96,68,204,35,
+    58,3,156,50,128,231,179,192,251,57,133,247,179,142,23,176,124,22,88,63,167,176,126,214,
+    144,194,180,32,14,243,26,113,223,177,77,25,198,206,187,23,109,253,163,115,191,178,114,143,
+    195,119,221,161,9,126,143,102,248,168,79,32,158,190,17,108,101,229,206,87,27,135,36,245,
+    146,181,3,102,146,33,235,72,239,55,161,215,238,249,12,199,72,190,84,31,169,3,105,13,
+    22,157,103,52,199,71,69,63,203,138,208,208,139,138,252,2,195,255,223,88,17,42,250,249,
+    134,8,3,81,69,167,141,166,1,97,105,203,169,1,27,251,13,147,83,131,45,152,23,124,
+    57,113,24,62,135,6,170,250,188,57,90,181,11,233,122,75,73,133,172,55,95,12,12,87,
+    69,94,189,7,54,143,231,213,198,234,90,174,148,109,245,223,122,74,31,208,49,66,35,30,
+    34,66,137,250,176,98,61,170,55,75,16,193,144,98,246,4,157,179,128,10,30,19,112,66,
+    9,155,201,19,39,148,208,132,232,222,221,5,90,228,193,138,117,144,16,142,36,121,187,17,
+    36,128,247,26,146,116,56,163,65,3,255,8,224,3,40,4,143,199,152,95,61,145,4,31,
+    55,64,121,80,45,52,169,113,207,98,97,210,182,36,116,195,67,208,154,136,255,229,61,5,
+    164,199,177,111,44,69,129,52,162,74,219,67,212,73,209,246,86,162,240,219,162,22,1,161,
+    8,169,45,143,156,198,132,218,152,246,80,54,161,141,105,4,161,62,210,235,122,31,9,79,
+    8,52,135,118,99,213,120,76,132,86,172,172,240,94,161,112,97,132,208,46,210,163,8,139,
+    225,150,40,223,224,238,1,128,55,73,70,17,86,56,110,82,56,161,43,129,90,242,142,140,
+    160,227,104,150,52,196,44,113,159,111,196,116,20,100,243,6,49,90,29,156,72,56,111,110,
+    104,222,216,55,212,237,17,117,59,13,68,68,104,34,32,140,48,225,98,27,119,177,234,136,
+    148,60,160,113,16,154,67,104,142,33,24,108,56,59,254,50,82,43,19,3,170,146,115,138,
+    70,19,170,159,203,34,234,190,6,39,80,96,96,70,240,11,24,100,244,156,130,213,27,82,
+    227,130,82,103,176,55,72,58,156,170,249,236,57,178,111,132,25,87,199,254,207,0,152,180,
+    30,90,9,132,89,26,178,80,112,34,142,77,156,135,216,247,113,184,67,77,38,147,26,126,
+    75,173,41,180,113,74,189,21,138,17,23,221,22,210,204,121,38,176,231,103,253,202,58,228,
+    252,141,228,108,160,125,110,253,94,187,111,13,245,91,45,56,211,249,168,159,6,220,43,106,
+    196,116,237,154,50,136,200,167,64,0,28,49,246,23,176,98,158,232,24,180,77,167,58,19,
+    18,165,61,6,15,15,242,65,13,99,42,101,79,118,174,135,131,36,131,115,74,37,235,12,
+    159,209,32,95,248,11,138,163,96,130,98,12,170,60,112,219,133,54,199,43,223,128,117,84,
+    28,71,162,18,120,135,112,158,7,202,249,44,11,93,247,218,34,237,217,19,185,36,119,197,
+    89,43,36,36,61,137,134,54,114,136,241,109,52,158,40,34,123,124,57,185,104,144,27,134,
+    224,94,24,34,70,17,251,32,49,26,201,21,170,249,8,117,8,55,95,128,254,47,92,211,
+    15,254,252,130,82,67,255,141,80,253,3,106,27,124,142,214,253,118,23,134,57,132,229,129,
+    161,110,27,7,29,210,25,182,90,62,123,224,74,53,238,68,116,233,219,178,79,125,217,41,
+    207,62,15,158,158,102,252,225,9,22,0,181,227,171,196,99,104,150,5,104,131,7,117,4,
+    102,68,181,93,182,73,59,6,251,218,67,28,156,181,171,173,15,239,63,0,23,95,243,172,
+    74,0,205,22,97,183,230,99,24,78,63,206,147,243,249,243,71,107,165,249,254,67,179,249,
+    105,245,157,138,91,179,86,90,239,90,239,215,222,53,181,200,150,181,242,241,221,199,79,159,
+    86,215,222,125,2,108,101,247,201,53,115,203,56,35,183,140,52,114,243,202,115,180,77,192,
+    176,182,218,124,255,238,221,135,247,239,158,202,28,218,136,180,32,172,221,47,135,228,41,135,
+    148,223,28,230,241,189,192,165,153,114,207,189,82,114,235,60,218,170,118,57,73,150,83,44,
+    193,117,151,121,170,165,22,25,236,142,48,74,161,133,253,213,179,106,208,139,248,221,133,111,
+    218,57,69,216,167,52,79,193,241,52,79,193,214,4,14,132,211,30,137,171,183,145,162,35,
+    92,88,69,142,88,99,180,182,33,35,252,37,149,55,140,155,67,220,92,67,48,117,211,4,
+    1,166,78,193,197,14,64,149,58,124,0,60,215,38,70,144,232,178,138,28,2,1,157,181,
+    48,254,233,137,98,124,25,227,90,235,111,26,237,198,103,85,211,55,120,230,19,33,159,154,
+    9,1,236,55,71,37,97,200,213,31,242,121,70,37,27,191,228,156,172,214,57,19,130,88,
+    147,67,152,136,18,176,174,213,230,89,9,6,163,160,182,34,134,231,49,74,253,207,64,167,
+    133,120,44,254,79,31,185,19,105,112,192,18,154,125,16,235,66,172,112,19,106,17,177,36,
+    100,104,54,129,232,4,15,195,242,231,97,152,104,124,233,217,1,106,201,99,140,215,241,121,
+    140,7,73,20,227,119,248,41,21,62,124,30,211,149,211,206,215,132,247,218,128,56,170,142,
+    220,244,161,191,94,22,5,115,220,162,205,182,207,120,88,212,69,132,96,90,183,11,162,87,
+    109,217,31,218,92,119,146,66,137,25,123,116,116,36,178,157,196,47,240,156,124,217,240,168,
+    63,200,135,167,126,54,228,201,127,88,162,111,56,0,125,137,35,149,0,215,199,195,55,236,
+    46,244,229,235,194,123,91,188,234,159,219,158,180,184,128,69,112,137,28,33,163,207,7,91,
+    37,38,105,250,195,83,126,148,55,222,192,57,93,141,68,72,13,196,214,103,23,86,199,133,
+    91,107,94,214,131,155,25,106,214,57,23,141,75,11,151,204,104,56,210,5,138,110,151,207,
+    161,180,233,81,205,226,168,195,89,67,247,194,187,132,53,202,244,160,190,80,187,238,114,101,
+    152,157,251,233,120,230,47,83,31,152,244,156,17,41,125,15,71,228,100,228,37,69,152,125,
+    231,117,218,122,251,226,1,114,105,22,11,123,46,37,180,35,13,181,26,118,139,232,126,76,
+    151,163,178,108,149,83,146,84,96,231,77,139,103,142,181,238,180,241,89,152,20,88,157,97,
+    67,208,149,13,149,203,150,232,65,106,181,60,125,81,225,241,126,217,13,33,185,83,69,103,
+    121,50,234,165,222,251,207,215,169,17,9,176,71,18,246,10,167,177,232,14,185,59,228,150,
+    47,223,120,79,79,228,229,100,23,34,210,239,222,13,131,55,122,3,218,69,204,175,189,130,
+    95,102,235,21,49,203,215,237,71,228,121,65,62,16,165,142,158,208,44,160,151,216,64,223,
+    188,217,248,86,189,36,39,207,215,3,178,96,158,60,138,22,54,98,214,229,71,251,93,35,
+    121,54,233,214,93,180,142,113,222,235,123,215,232,193,24,141,179,165,162,236,102,195,202,100,
+    64,35,250,9,44,121,71,251,152,133,218,73,76,199,26,17,228,130,126,127,217,27,119,236,
+    188,212,60,212,30,194,190,250,174,249,108,212,11,198,193,107,46,5,232,113,175,166,61,33,
+    174,132,147,219,129,81,175,127,70,207,42,125,252,60,32,122,209,14,96,178,7,83,135,39,
+    116,121,64,36,133,203,167,227,44,245,232,251,197,137,57,115,83,143,177,23,223,135,240,86,
+    191,254,66,228,191,162,237,234,206,68,105,122,175,50,237,142,196,197,107,19,75,94,165,96,
+    114,139,165,111,118,209,18,173,154,198,62,112,225,141,78,144,68,4,235,65,59,185,94,233,
+    38,9,93,224,208,27,112,12,48,94,99,235,215,48,61,187,91,13,249,19,123,187,193,98,
+    188,133,201,222,3,235,250,37,108,158,122,209,226,37,15,158,239,48,125,211,30,136,87,120,
+    226,121,138,75,47,73,196,45,107,244,214,165,171,211,154,118,67,226,87,247,42,129,118,211,
+    210,173,110,86,66,126,151,170,65,137,216,2,94,166,106,151,41,11,50,223,230,95,174,6,
+    83,35,202,184,117,185,207,185,93,157,243,184,61,214,172,109,226,77,50,191,237,129,230,60,
+    199,252,251,78,127,75,227,165,222,210,240,150,3,235,67,79,115,232,5,145,248,198,151,0,
+    49,127,251,18,225,53,152,252,70,24,50,133,63,64,225,112,215,194,211,191,184,119,65,95,
+    52,172,140,50,48,175,214,124,122,234,125,22,195,152,192,224,90,8,211,119,51,55,175,186,
+    155,185,125,221,221,204,253,203,119,51,115,243,110,230,252,149,218,133,167,253,56,92,178,60,
+    209,146,205,248,84,174,209,194,112,54,85,65,87,44,61,115,133,38,247,150,218,194,12,140,
+    133,217,93,78,148,28,239,167,52,85,82,224,11,233,209,169,114,163,249,234,230,254,83,173,
+    37,50,84,127,199,239,110,155,105,250,209,72,211,141,132,160,120,186,37,48,141,134,121,86,
+    251,163,73,151,84,98,19,152,254,182,84,154,75,93,242,18,141,113,128,216,192,89,210,177,
+    222,66,165,13,138,179,197,110,216,45,17,144,27,88,69,55,120,141,121,131,4,132,216,84,
+    187,0,27,54,18,157,91,90,89,65,245,246,173,87,1,130,11,36,229,90,215,231,129,152,
+    185,140,225,58,65,82,73,1,64,49,17,254,61,88,242,13,22,169,4,91,40,60,182,49,
+    253,173,91,109,162,150,244,24,111,132,1,86,134,77,253,11,160,80,85,59,126,78,42,202,
+    235,137,97,215,190,169,208,35,115,160,155,88,95,89,221,219,170,139,39,176,42,36,193,1,
+    12,127,91,216,21,16,10,229,50,15,216,181,146,200,226,214,118,157,94,208,225,63,249,186,
+    39,122,121,65,15,204,5,253,237,21,207,106,15,160,215,151,234,10,147,109,27,124,36,158,
+    236,179,106,91,245,180,109,245,133,71,181,110,98,147,229,197,245,233,106,245,222,93,86,239,
+    151,149,76,127,162,246,174,157,218,231,155,45,174,94,218,224,234,165,201,26,243,237,179,186,
+    23,57,131,17,144,241,6,83,241,150,176,58,159,122,48,223,124,235,102,20,67,175,23,60,
+    125,143,109,175,122,93,233,85,124,97,106,68,173,137,24,102,124,162,31,23,27,122,161,242,
+    60,89,107,146,170,80,68,15,138,99,56,4,86,166,120,5,203,3,164,241,43,227,149,234,
+    128,174,13,140,247,48,248,242,158,20,73,227,183,229,4,173,154,228,242,166,230,57,253,34,
+    61,169,77,170,50,158,29,87,11,215,21,25,11,221,225,85,85,32,210,2,176,174,6,54,
+    174,53,241,220,223,67,91,54,150,12,113,251,61,169,213,21,188,106,117,189,246,53,122,103,
+    201,241,79,202,109,147,161,230,182,100,56,214,196,52,6,95,176,117,114,61,38,158,105,142,
+    196,51,205,228,17,51,156,202,84,127,84,86,129,180,242,142,84,82,1,232,79,22,227,171,
+    84,82,129,188,136,241,117,34,105,60,194,103,19,63,31,232,179,5,179,140,0,188,42,129,
+    116,9,4,3,168,181,64,64,24,192,231,207,186,114,30,110,120,58,43,197,120,9,10,143,
+    29,194,24,243,162,20,58,136,155,51,94,166,194,10,113,15,154,53,170,60,161,66,65,103,
+    237,241,4,152,44,212,210,144,44,31,150,108,117,190,199,215,147,185,70,255,244,140,237,226,
+    49,23,57,104,39,210,156,183,5,36,108,77,29,48,23,75,49,12,192,151,78,227,119,175,
+    59,141,11,176,68,7,214,147,226,31,152,215,182,52,179,254,118,21,247,249,58,122,206,117,
+    60,254,168,128,116,95,249,203,0,167,78,85,196,77,167,222,131,110,153,208,49,30,47,30,
+    127,71,203,60,91,209,208,187,254,222,159,4,229,129,37,140,222,12,234,227,128,59,182,177,
+    200,210,161,167,91,199,241,200,192,161,144,250,163,117,28,238,18,36,133,107,134,162,125,76,
+    181,103,9,50,235,153,235,77,252,142,174,115,250,78,28,146,225,71,26,25,216,114,174,19,
+    115,60,70,129,5,94,34,47,140,13,200,0,79,236,57,83,40,67,203,48,72,215,112,102,
+    15,16,62,48,181,181,26,74,171,73,236,255,166,54,151,142,113,148,198,56,176,71,136,81,
+    216,191,24,160,73,30,160,45,23,77,254,211,130,31,96,46,96,193,45,212,24,166,150,190,
+    184,215,44,158,80,156,137,107,45,49,170,210,96,17,119,136,77,227,155,22,91,89,164,221,
+    163,180,150,164,61,171,65,66,51,240,44,3,64,112,94,177,148,116,139,140,192,9,202,201,
+    122,85,82,76,105,252,215,219,253,40,252,140,225,15,79,136,53,93,62,215,39,120,94,205,
+    184,94,114,12,143,75,204,79,4,168,30,240,113,40,250,148,217,5,99,134,34,207,217,172,
+    239,139,62,75,165,138,164,172,222,147,39,36,123,139,166,193,142,31,6,203,244,78,167,189,
+    113,48,129,149,234,111,196,97,20,224,192,243,42,67,155,220,100,239,62,171,111,239,236,181,
+    78,55,182,43,101,211,150,175,37,93,85,115,107,103,1,90,59,235,230,88,59,203,90,229,
+    18,55,163,92,238,22,230,63,122,226,247,252,244,40,134,219,152,0,192,20,249,234,132,234,
+    193,140,227,37,111,189,97,105,133,202,122,88,7,47,136,185,89,53,57,38,124,246,22,66,
+    101,148,227,115,212,233,9,158,128,79,213,240,162,135,199,8,180,8,117,173,243,58,131,139,
+    238,197,181,50,171,134,161,242,181,52,171,230,103,205,170,249,121,102,213,124,105,97,203,55,
+    204,170,5,192,232,172,7,186,125,45,95,179,175,133,176,12,91,209,108,247,232,183,37,188,
+    240,61,183,49,15,53,176,101,247,18,163,107,129,69,28,0,38,106,174,222,56,220,211,83,
+    120,193,63,155,151,146,3,240,135,211,178,140,109,201,88,11,88,61,11,142,18,16,47,141,
+    181,121,124,78,194,70,142,251,55,110,219,168,86,168,32,90,185,16,175,89,178,158,105,219,
+    234,222,205,222,42,46,58,17,108,205,35,44,252,101,9,220,249,112,132,7,124,30,216,28,
+    78,167,195,129,102,193,49,251,54,34,37,158,11,216,112,20,196,59,80,148,47,197,112,156,
+    47,15,141,195,112,111,249,134,252,195,201,180,236,197,135,42,217,44,201,70,29,149,133,189,
+    245,64,217,215,136,148,170,115,3,206,136,220,35,248,186,3,77,189,147,129,102,187,198,207,
+    207,27,246,141,176,75,7,103,118,60,13,7,104,78,78,110,92,247,149,59,220,200,166,50,
+    76,33,241,178,142,27,143,102,55,66,73,241,65,33,106,36,136,168,94,59,118,240,214,175,
+    244,170,33,219,77,136,202,142,213,217,73,14,11,59,252,173,224,109,101,135,222,8,66,177,
+    244,54,240,182,178,219,137,115,94,1,26,245,233,32,83,89,127,87,217,173,214,223,117,144,
+    167,132,239,157,202,29,134,198,198,84,4,74,15,149,125,78,42,201,235,216,181,55,170,1,
+    116,217,3,252,21,189,115,45,202,132,77,182,137,222,9,100,24,45,86,65,152,205,96,239,
+    237,12,146,45,107,206,102,76,117,108,203,234,204,171,246,108,225,222,44,103,235,43,165,198,
+    124,206,254,215,79,89,78,248,176,18,64,62,13,75,176,40,91,78,25,113,87,143,24,115,
+    222,3,105,81,1,158,73,211,146,31,116,59,98,138,140,27,157,158,105,176,211,84,230,191,
+    166,23,68,248,103,138,127,196,179,196,134,148,26,123,111,91,100,68,166,156,114,146,212,133,
+    177,146,186,254,133,175,226,227,4,242,125,17,162,33,67,142,28,36,114,228,45,196,187,97,
+    71,111,3,246,96,111,84,8,184,234,16,112,23,121,54,156,220,221,100,114,119,223,250,48,
+    177,119,104,130,239,39,83,122,215,234,104,211,29,66,95,97,154,62,84,246,225,119,110,215,
+    54,42,94,245,30,62,31,32,74,205,113,128,96,144,10,255,232,233,13,202,147,247,217,23,
+    182,107,74,146,167,57,175,2,196,68,223,97,205,218,134,213,217,18,42,119,40,73,22,162,
+    234,45,126,2,230,245,231,213,79,26,207,219,62,179,111,73,68,124,209,189,100,95,213,55,
+    158,205,190,96,72,124,139,165,192,35,46,97,222,127,177,100,220,140,125,197,208,73,213,126,
+    111,46,142,19,92,165,176,38,78,232,53,37,49,140,93,212,71,254,236,172,172,68,232,198,
+    141,53,240,94,57,66,207,109,233,35,243,245,171,54,143,248,37,126,175,192,225,166,47,31,
+    173,199,38,191,247,91,230,6,236,222,213,110,211,26,166,29,98,115,161,3,215,242,154,75,
+    33,105,229,54,251,78,38,181,152,125,109,49,47,189,19,210,108,53,100,170,255,195,249,137,
+    234,191,254,102,235,191,178,17,191,191,66,42,184,213,31,123,209,146,238,46,36,85,213,36,
+    107,90,241,158,81,252,11,178,65,223,123,181,193,61,255,21,162,65,94,249,215,119,246,43,
+    91,160,110,6,53,234,173,9,216,93,20,176,123,166,31,142,70,250,38,208,36,197,153,99,
+    32,202,221,213,203,42,97,214,171,163,157,123,27,234,21,19,63,5,203,215,71,156,121,232,
+    112,174,186,33,8,241,170,122,51,78,167,91,78,96,167,182,87,141,223,186,21,63,253,244,
+    105,154,121,250,52,85,150,42,133,216,143,21,6,154,169,74,81,3,188,32,44,119,129,126,
+    189,117,72,240,78,87,129,24,1,228,77,70,245,140,11,62,78,59,35,224,144,212,133,99,
+    160,115,8,141,127,88,206,103,30,82,195,151,105,86,207,164,89,243,229,190,76,200,203,233,
+    18,27,245,178,57,154,39,82,101,125,62,223,220,124,32,132,69,186,154,129,121,47,229,220,
+    97,177,193,88,21,171,233,24,44,176,168,207,53,106,96,218,159,157,111,28,109,111,156,110,
+    183,75,165,103,29,41,250,158,128,153,31,251,206,216,207,109,78,33,223,230,62,172,145,136,
+    212,45,132,115,150,89,216,163,32,48,140,137,133,253,67,103,100,231,152,232,151,105,251,241,
+    84,56,204,17,118,248,157,225,161,1,72,225,12,84,48,232,79,38,253,219,32,213,211,50,
+    58,3,239,206,6,35,85,19,9,101,22,132,32,244,158,94,230,225,179,199,4,226,113,28,
+    140,187,126,105,226,82,224,253,220,159,140,34,56,245,33,69,49,115,233,41,70,17,122,194,
+    102,223,153,72,41,77,16,223,170,218,58,209,168,231,36,189,40,59,93,197,168,126,55,203,
+    228,40,50,29,65,22,215,105,190,156,162,59,4,187,254,233,35,79,80,14,218,149,71,132,
+    172,203,118,229,83,193,72,74,60,116,24,209,25,87,29,131,225,120,212,19,178,5,59,137,
+    225,174,177,68,204,4,189,161,244,227,240,5,183,12,15,180,48,207,156,197,115,253,228,203,
+    143,179,253,173,141,131,188,185,126,210,155,79,250,30,14,173,49,215,161,238,17,122,116,190,
+    197,238,146,115,24,182,19,103,188,53,116,166,167,106,122,155,241,246,210,5,253,175,165,94,
+    46,120,101,134,113,248,122,71,23,147,81,128,206,119,84,106,179,249,113,237,163,156,129,147,
+    94,63,238,83,29,87,27,255,117,75,176,240,255,245,53,40,199,192,44,192,27,14,92,232,
+    124,153,221,152,77,255,200,226,251,191,119,237,105,110,180,104,241,253,107,201,226,59,63,62,
+    62,202,91,120,231,67,242,150,174,79,245,16,121,177,204,96,229,47,166,77,247,165,197,116,
+    36,166,139,81,132,156,119,255,51,167,217,207,12,253,79,141,226,235,61,164,37,190,196,178,
+    29,92,72,245,240,129,51,112,129,57,255,25,167,78,255,99,152,128,215,173,232,37,228,233,
+    255,229,75,60,241,162,67,243,224,219,162,121,128,197,111,59,147,94,144,230,22,39,198,132,
+    7,8,210,178,149,46,99,156,17,5,151,150,236,4,166,227,75,98,129,177,203,224,176,212,
+    96,220,82,0,63,86,9,199,133,49,29,217,82,113,7,67,199,151,170,253,195,248,100,60,
+    12,199,184,41,186,50,134,156,251,72,77,255,254,52,24,112,36,186,77,235,176,90,85,151,
+    114,129,116,69,141,71,57,89,164,165,190,160,198,116,228,39,63,136,9,78,56,153,27,24,
+    187,28,163,129,73,86,205,210,3,18,31,62,223,182,201,38,84,153,122,192,200,137,77,180,
+    44,249,85,182,244,130,169,117,122,209,233,98,9,194,82,95,56,2,114,246,78,134,209,109,
+    240,237,244,192,200,47,159,119,173,23,122,16,108,59,137,11,111,128,60,28,250,253,110,63,
+    48,75,196,39,234,242,117,15,128,234,134,12,137,35,18,196,32,118,66,221,199,16,10,73,
+    7,218,43,17,191,251,18,44,175,200,21,28,174,38,232,140,17,86,170,166,75,20,252,157,
+    220,63,188,215,215,211,11,94,15,123,239,191,30,118,167,44,32,133,116,3,111,151,197,82,
+    115,198,30,151,79,108,3,249,153,160,98,132,221,106,104,110,56,251,57,55,29,59,139,110,
+    55,163,168,63,154,4,6,250,223,81,228,33,22,148,243,195,46,184,42,116,207,117,28,185,
+    224,154,63,154,17,49,190,138,225,130,20,186,12,69,155,50,18,15,44,9,30,215,213,117,
+    170,120,26,41,34,220,245,39,129,29,146,33,63,30,123,42,61,126,246,0,139,246,146,37,
+    165,198,217,119,50,14,205,212,67,87,173,161,27,99,143,55,82,155,98,65,89,26,190,67,
+    255,144,168,57,129,247,204,13,49,123,31,241,25,230,150,51,29,192,220,56,29,14,218,106,
+    142,107,206,212,2,59,170,148,195,90,96,161,109,138,74,185,87,235,226,197,105,183,227,218,
+    65,199,179,107,171,149,110,117,181,18,214,90,149,160,214,235,248,118,171,210,133,239,176,26,
+    84,123,207,12,209,31,13,227,89,220,71,231,98,75,11,66,23,6,88,88,185,220,133,178,
+    222,70,53,42,243,109,57,170,14,172,42,124,119,173,183,3,171,50,128,74,148,69,168,70,
+    117,121,91,30,84,175,1,162,87,11,173,183,215,8,241,218,202,161,163,79,173,34,210,130,
+    91,33,168,4,234,73,87,213,173,4,85,15,176,248,149,110,37,208,223,9,255,158,136,235,
+    22,77,188,164,189,52,44,171,82,84,71,234,48,186,63,83,110,253,17,117,41,228,204,32,
+    77,11,116,9,141,243,176,132,206,88,199,253,17,158,141,5,14,218,250,97,222,248,168,75,
+    171,9,88,186,186,17,26,23,175,184,202,126,13,141,206,209,103,80,243,164,77,79,167,34,
+    41,88,185,85,241,160,83,252,170,91,13,172,138,3,109,45,67,191,121,208,111,62,68,187,
+    48,8,16,229,86,156,170,246,150,243,15,47,237,14,185,89,83,20,17,250,175,226,86,91,
+    149,50,196,33,66,175,10,133,85,180,39,121,255,233,101,237,230,1,44,236,127,26,150,110,
+    5,255,115,113,248,224,63,135,42,36,49,2,54,194,233,192,144,36,246,14,157,87,140,200,
+    204,237,123,155,193,3,208,115,157,28,220,54,236,2,12,7,151,74,242,152,38,142,134,30,
+    209,194,145,208,35,86,177,243,41,66,83,52,255,11,117,88,77,42,33,234,48,74,215,97,
+    148,174,195,40,93,135,145,166,161,37,30,155,237,44,113,191,105,52,190,105,59,233,166,186,
+    153,150,29,190,22,235,106,6,237,40,141,86,171,236,145,122,157,187,8,241,175,51,199,31,
+    3,145,204,31,182,215,143,154,166,60,156,95,102,225,133,66,255,210,56,105,118,147,136,49,
+    216,89,248,64,40,74,13,139,78,37,180,133,231,148,151,205,44,200,126,2,219,78,73,35,
+    34,164,121,164,60,90,111,33,165,49,222,111,158,80,189,254,112,22,250,220,210,209,161,140,
+    151,180,249,132,4,223,89,89,145,172,210,238,120,56,16,138,126,58,199,27,18,175,125,146,
+    39,242,69,109,37,251,76,61,165,251,246,109,127,187,156,213,78,19,133,147,158,160,173,119,
+    133,231,44,247,93,122,128,167,175,37,78,199,251,137,196,39,207,245,248,56,240,2,56,33,
+    113,41,184,224,97,52,209,185,122,105,235,153,123,179,103,212,225,11,30,180,232,237,151,81,
+    27,103,50,53,240,202,17,231,114,127,238,59,100,163,190,29,116,157,89,52,253,54,146,253,
+    69,222,200,185,47,100,217,81,220,109,249,150,214,60,253,125,246,142,171,152,49,207,65,79,
+    219,242,212,224,106,39,116,126,91,164,206,224,226,24,195,69,2,239,154,45,246,14,221,118,
+    230,156,110,7,154,171,102,77,116,137,222,91,119,244,171,79,4,136,156,242,59,52,116,94,
+    127,199,222,53,26,250,29,196,134,111,178,58,222,82,103,210,163,225,84,239,200,191,210,99,
+    83,58,48,82,181,55,58,133,60,63,229,115,94,120,105,52,188,11,198,37,246,8,224,109,
+    77,103,64,227,251,147,57,36,185,189,103,54,209,161,101,239,39,115,205,145,158,113,158,159,
+    19,97,11,61,55,77,95,176,241,53,75,252,164,113,211,38,242,191,21,231,206,17,58,81,
+    119,199,78,250,29,141,16,89,121,206,220,84,171,144,231,83,62,255,232,94,72,219,154,55,
+    253,100,3,91,58,20,180,212,197,88,252,245,78,92,171,252,229,110,44,175,41,149,245,215,
+    117,101,170,47,10,216,151,217,206,128,37,35,38,236,167,252,9,187,149,59,193,255,229,150,
+    107,0,10,255,213,222,229,100,218,22,94,164,151,118,233,118,127,28,16,184,19,253,163,147,
+    60,221,196,45,109,188,119,94,83,177,141,129,139,50,204,165,36,76,115,121,247,218,41,116,
+    10,173,221,24,7,142,142,151,203,137,140,225,107,138,241,227,250,1,230,90,104,106,229,238,
+    105,229,250,217,3,147,175,13,199,23,105,189,37,15,82,131,139,53,118,206,188,101,63,17,
+    131,162,28,56,95,121,228,202,158,238,117,19,1,218,4,6,138,95,215,155,245,166,119,67,
+    168,53,62,153,142,103,248,124,161,44,247,141,137,51,24,69,1,23,29,73,137,206,45,134,
+    136,42,107,44,248,190,214,220,120,121,115,157,215,247,204,191,94,15,26,122,175,6,253,250,
+    82,93,69,31,14,187,93,88,247,71,202,252,196,213,29,141,185,22,193,33,78,208,44,133,
+    14,65,17,53,109,50,184,139,74,44,100,107,119,240,250,158,244,181,9,161,164,78,104,141,
+    210,116,171,205,31,120,124,13,230,36,206,60,31,59,222,117,187,136,79,33,174,97,74,13,
+    2,180,53,144,88,130,176,58,58,38,20,68,208,115,125,174,115,252,10,188,241,176,120,45,
+    98,38,168,209,155,148,227,23,75,85,201,237,96,88,206,213,105,31,64,237,46,122,17,136,
+    81,253,153,43,163,187,92,191,254,28,18,249,148,197,227,167,165,205,192,108,22,143,103,161,
+    217,154,201,67,90,14,176,84,70,195,136,100,28,101,56,170,80,130,32,96,70,98,82,78,
+    31,169,153,164,99,104,135,99,64,234,108,201,24,244,94,63,239,54,29,195,30,10,245,65,
+    193,81,90,11,222,245,68,74,73,253,217,152,11,98,12,86,176,214,92,198,169,54,126,49,
+    178,10,86,24,22,125,48,221,22,113,203,218,113,232,191,78,126,55,229,238,217,39,246,163,
+    38,125,8,126,66,36,215,247,96,199,210,132,75,148,181,228,14,129,163,118,98,237,161,146,
+    179,224,161,210,191,206,142,143,80,10,27,140,219,197,73,111,120,119,54,117,166,179,101,15,
+    149,138,168,13,85,212,168,27,190,92,146,12,138,226,37,151,52,249,174,63,237,109,141,3,
+    31,54,157,62,138,251,245,243,74,183,251,83,221,134,231,23,187,84,210,238,247,66,222,254,
+    100,1,38,61,224,193,110,52,13,246,209,185,252,102,127,10,236,110,190,191,2,13,64,246,
+    75,38,103,217,34,115,34,147,217,104,52,28,79,185,99,152,220,50,187,193,212,235,189,186,
+    28,130,206,195,253,114,135,8,155,54,153,253,186,23,152,98,88,58,117,105,199,190,201,204,
+    197,80,114,142,148,231,64,236,89,83,168,220,79,102,37,199,133,134,83,74,242,190,100,10,
+    199,15,109,251,232,190,126,6,255,251,39,102,123,175,107,52,167,80,58,131,41,26,12,183,
+    232,252,35,197,191,120,33,54,85,247,102,243,224,44,24,217,245,198,251,181,142,118,86,58,
+    176,57,35,104,196,213,35,103,30,140,241,174,13,205,166,148,229,133,169,76,229,103,162,13,
+    56,104,127,35,174,76,93,68,113,128,211,28,148,167,41,148,45,203,76,205,65,169,157,129,
+    213,49,116,99,177,180,41,144,109,231,119,78,58,123,75,44,153,15,44,36,41,17,115,79,
+    119,24,17,13,135,215,27,83,238,51,184,76,94,239,52,213,50,124,91,197,133,126,25,84,
+    65,26,85,96,162,170,101,112,5,82,32,153,193,213,77,112,145,62,94,215,68,69,222,248,
+    116,76,93,171,147,188,22,226,152,10,2,85,168,163,66,87,194,97,26,87,45,133,76,56,
+    214,237,101,171,213,75,55,177,151,198,133,181,213,80,245,132,143,222,44,170,40,141,42,202,
+    162,170,25,184,164,123,107,88,127,64,14,206,19,46,127,31,13,201,121,12,205,19,192,132,
+    1,190,184,213,98,64,61,118,251,17,204,126,8,54,222,179,65,63,214,130,207,57,152,36,
+    205,228,27,165,49,117,180,147,134,118,17,134,39,7,97,34,91,178,199,64,24,196,70,168,
+    159,75,190,15,199,17,156,155,196,179,177,76,193,248,64,90,21,46,119,217,195,254,8,8,
+    223,164,179,48,5,23,151,87,199,219,232,219,0,235,138,111,187,208,17,170,64,93,70,219,
+    156,40,143,201,192,52,117,152,32,23,164,165,131,116,115,65,86,117,144,48,23,100,77,7,
+    233,113,144,69,141,25,100,179,191,211,179,71,152,157,92,221,158,106,61,87,198,238,151,215,
+    155,164,180,101,12,143,240,223,45,222,171,5,57,61,143,154,254,239,127,233,146,166,127,144,
+    174,64,151,101,11,12,208,0,27,149,36,60,197,46,172,84,66,166,174,113,139,89,68,161,
+    54,102,126,127,136,182,202,176,67,148,188,46,198,126,178,35,236,167,233,22,15,41,153,151,
+    35,53,6,4,88,157,239,190,123,16,175,195,96,114,12,116,190,108,192,250,193,100,218,143,
+    5,211,201,101,190,93,90,22,169,189,236,223,116,65,186,180,210,169,202,58,242,235,47,86,
+    147,28,176,237,199,163,25,180,212,74,68,182,35,216,31,212,62,226,242,195,164,166,99,50,
+    28,142,84,42,63,29,9,93,8,188,162,68,102,94,158,70,17,143,11,60,239,41,174,97,
+    145,161,63,57,129,88,93,99,2,120,185,19,1,136,221,62,30,70,137,78,239,112,54,246,
+    248,165,84,41,24,140,166,82,245,156,119,159,41,156,29,208,142,253,111,47,71,236,59,114,
+    208,174,76,94,207,156,80,74,217,128,51,7,17,251,75,63,159,11,251,147,66,84,230,68,
+    115,188,232,118,82,104,55,68,130,242,72,44,194,245,110,119,74,167,106,83,254,219,106,172,
+    125,212,88,22,242,202,219,143,167,31,249,145,39,133,97,28,220,204,130,216,155,111,246,227,
+    45,180,242,134,171,1,70,241,120,54,165,97,52,107,47,179,105,45,24,6,198,9,197,69,
+    111,243,113,40,15,106,218,193,191,227,216,187,209,208,153,190,95,163,122,116,38,192,35,3,
+    39,72,162,155,73,80,44,221,204,80,87,37,70,181,241,182,43,206,198,19,116,182,222,17,
+    46,18,8,10,24,114,64,95,106,243,16,30,1,74,109,97,76,176,163,114,5,168,245,35,
+    178,249,252,172,166,80,34,198,103,99,38,162,145,162,242,90,69,202,47,174,6,253,123,126,
+    20,60,13,66,60,80,185,74,113,8,216,176,216,11,168,155,56,182,217,68,15,121,179,1,
+    190,190,7,250,243,157,75,122,52,30,245,223,93,37,110,199,171,149,27,167,78,74,13,116,
+    2,62,130,45,170,44,37,75,87,92,242,69,47,138,148,104,70,244,42,122,81,4,102,118,
+    226,141,251,110,112,133,219,131,46,235,185,49,207,138,232,196,79,214,157,202,242,137,223,93,
+    90,120,60,244,3,27,146,129,197,247,143,224,27,16,166,242,19,8,230,177,158,158,68,237,
+    198,195,225,20,129,117,222,248,90,241,176,75,238,72,174,184,165,137,137,120,84,63,26,15,
+    167,67,36,78,220,85,54,95,120,208,25,51,221,76,68,188,69,82,42,46,176,157,92,161,
+    89,32,210,13,120,20,59,200,21,246,148,23,76,54,231,88,146,237,168,167,208,92,117,64,
+    161,83,62,230,81,70,215,169,86,93,203,185,80,137,23,46,127,164,126,41,251,239,106,100,
+    156,31,174,146,254,208,34,213,32,101,98,246,101,157,104,4,132,5,72,174,59,37,205,146,
+    58,208,13,143,162,63,218,40,107,46,66,95,56,81,34,104,246,85,119,137,170,63,179,2,
+    130,245,227,111,104,7,194,16,234,83,214,154,159,238,172,231,103,134,57,100,173,78,130,49,
+    79,49,10,145,169,178,20,109,19,140,186,198,4,195,133,130,196,74,138,15,163,254,72,245,
+    87,52,132,209,59,133,137,65,247,136,72,235,29,219,21,18,139,142,102,102,213,179,133,232,
+    198,82,3,229,219,143,1,85,129,191,245,105,173,53,26,140,71,236,196,62,5,159,25,189,
+    106,37,99,219,213,170,186,128,71,215,48,130,96,42,201,76,44,182,242,142,7,137,54,48,
+    9,184,211,79,105,148,252,103,57,97,20,236,153,74,235,100,210,148,160,229,106,36,238,7,
+    54,229,120,171,38,232,2,61,173,10,130,242,160,208,138,52,78,179,73,238,124,11,122,143,
+    70,139,203,95,53,137,44,143,72,237,151,133,86,171,209,84,125,61,28,113,42,36,165,61,
+    87,201,214,153,228,155,106,59,233,85,0,244,205,211,40,21,23,90,104,223,9,196,185,172,
+    182,173,208,24,122,179,227,96,20,76,133,40,89,153,69,23,84,99,54,33,195,156,82,187,
+    83,24,234,108,72,102,207,25,140,190,247,2,96,234,227,62,42,43,42,200,135,96,60,60,
+    139,160,151,55,166,168,164,151,142,227,202,128,111,52,234,58,74,142,215,87,72,142,212,164,
+    196,218,28,6,131,225,120,126,200,143,221,234,126,1,123,131,195,56,158,55,51,164,222,90,
+    19,181,123,126,113,207,32,119,160,151,165,78,223,184,206,80,187,136,12,71,218,78,107,49,
+    26,198,80,29,96,0,2,159,27,198,113,108,87,151,85,234,212,244,6,23,248,238,162,171,
+    254,125,97,237,213,207,125,86,55,112,238,21,192,150,102,198,85,179,47,30,164,238,8,184,
+    160,67,83,190,196,253,219,53,24,52,79,87,193,134,100,159,63,183,215,238,101,174,61,157,
+    179,193,21,34,81,98,7,250,10,161,103,154,150,117,214,37,109,120,235,170,123,175,57,28,
+    231,250,158,154,30,252,92,118,138,126,97,129,102,82,133,218,64,220,17,81,187,214,20,27,
+    1,218,199,193,221,91,107,232,68,177,42,215,94,238,173,206,0,159,123,4,99,245,242,140,
+    84,232,52,59,234,42,255,249,95,201,62,232,166,250,25,251,4,185,143,27,110,145,72,218,
+    181,134,19,144,167,84,242,186,16,242,159,158,212,194,210,188,171,195,134,129,10,223,237,199,
+    103,134,186,43,244,123,188,141,63,92,139,161,157,88,61,105,55,159,217,217,104,12,131,9,
+    201,207,185,215,157,253,96,82,214,112,179,71,66,178,21,13,103,126,59,125,247,153,55,219,
+    79,157,57,94,169,161,136,143,99,168,39,8,116,249,42,23,235,79,135,6,212,4,5,128,
+    250,14,198,99,97,243,209,121,229,110,202,140,189,188,44,173,185,234,83,179,109,27,24,23,
+    29,111,154,228,138,9,85,49,129,8,145,37,242,49,175,49,30,2,45,110,212,192,183,208,
+    194,58,112,223,189,126,228,67,85,59,190,120,177,201,207,158,106,215,242,63,7,29,31,31,
+    146,67,25,23,254,37,21,243,166,161,159,23,135,137,108,16,79,64,186,14,180,144,248,73,
+    42,24,68,112,118,14,252,115,69,143,96,184,146,64,66,200,11,242,74,110,38,21,196,53,
+    242,103,110,204,66,31,34,101,218,128,15,110,175,111,94,16,72,146,135,239,105,211,151,206,
+    186,126,112,66,139,94,93,86,10,167,86,218,252,85,37,221,234,103,163,65,63,54,11,225,
+    234,29,114,93,48,249,161,228,200,247,102,201,28,92,249,54,97,234,75,191,27,243,243,15,
+    204,3,161,68,47,9,24,23,63,216,218,130,208,239,53,252,212,42,231,92,155,34,126,72,
+    75,83,218,58,169,142,39,15,25,239,63,26,15,148,197,93,191,139,214,31,132,248,137,227,
+    5,198,90,88,26,66,87,32,125,101,3,105,221,181,87,43,30,55,7,36,166,109,219,227,
+    32,230,54,129,134,180,109,47,199,82,158,199,79,131,220,43,194,46,20,205,95,224,190,175,
+    184,108,149,36,69,11,158,252,2,33,115,244,75,45,143,212,11,190,149,31,73,133,169,237,
+    176,72,190,166,104,251,207,150,165,171,226,228,136,157,57,173,215,111,157,34,111,145,214,20,
+    189,86,145,29,77,129,92,17,158,174,251,227,136,15,74,123,161,42,92,5,203,237,56,170,
+    71,46,232,225,55,253,215,212,126,229,119,77,15,224,87,242,13,73,205,203,142,105,58,171,
+    217,89,109,253,226,161,209,44,230,75,163,27,176,238,189,183,171,45,205,163,110,215,246,141,
+    136,142,112,162,165,94,139,7,22,83,239,196,225,187,201,18,211,207,90,10,124,55,173,103,
+    231,133,135,219,46,189,200,230,67,15,35,216,29,134,109,160,59,202,30,99,204,5,232,142,
+    163,237,95,40,228,85,201,214,162,65,28,107,62,23,224,184,228,160,91,5,152,153,144,101,
+    101,69,250,8,179,58,166,71,133,132,46,235,174,21,56,116,221,25,141,34,188,1,70,196,
+    10,238,194,187,180,242,172,137,13,72,50,150,156,12,169,54,76,204,116,166,155,129,19,15,
+    151,132,93,59,21,68,89,55,154,134,235,244,18,63,15,61,57,102,145,237,94,244,46,209,
+    41,162,16,38,203,47,213,194,178,175,219,13,96,102,40,144,166,124,198,172,208,173,135,172,
+    91,119,85,100,8,145,97,29,93,74,185,150,245,236,189,48,122,62,141,94,26,138,166,177,
+    105,62,206,151,3,124,75,182,53,73,25,111,210,110,49,63,24,77,123,231,193,100,10,163,
+    206,3,223,137,135,128,144,246,100,30,182,178,231,204,154,151,26,17,58,55,238,14,227,68,
+    37,228,167,22,160,198,4,120,198,246,243,51,75,158,175,95,79,172,223,153,11,179,101,141,
+    181,228,244,126,112,202,143,234,253,22,52,137,169,201,62,204,87,1,18,13,208,74,126,61,
+    41,201,46,136,97,30,85,43,252,247,147,53,125,149,187,146,208,45,157,103,231,116,215,67,
+    162,189,213,22,63,10,55,223,89,137,41,7,36,247,188,199,29,232,113,39,77,38,48,121,
+    33,153,24,121,139,111,7,255,91,186,69,206,150,137,139,231,123,224,25,241,185,75,240,163,
+    44,189,222,163,101,97,147,71,88,62,151,148,150,76,82,6,144,3,3,67,93,95,132,112,
+    208,183,72,94,2,28,120,222,8,168,65,210,187,127,181,226,202,221,219,89,188,248,207,5,
+    117,87,195,129,145,67,71,138,252,100,117,172,133,131,211,245,117,191,68,104,128,165,33,204,
+    105,54,4,215,176,95,54,24,155,181,181,15,171,159,90,107,146,222,104,169,200,221,124,252,
+    180,246,225,227,218,71,121,51,235,190,197,189,206,121,235,2,217,117,222,182,96,28,46,46,
+    53,187,134,100,6,189,193,6,240,239,218,174,133,202,94,9,187,174,218,93,116,92,68,244,
+    178,22,2,77,189,102,244,23,59,131,219,58,193,253,55,100,248,19,74,195,44,120,1,24,
+    64,21,253,78,92,159,14,121,55,162,145,227,206,0,13,160,253,141,184,231,215,45,162,7,
+    232,74,218,106,243,199,171,160,91,35,247,242,169,117,154,6,155,138,128,199,41,45,101,115,
+    192,222,115,59,103,31,185,53,237,247,107,157,32,61,66,168,146,171,198,175,155,78,69,181,
+    92,99,252,52,163,57,11,124,88,12,208,135,69,37,109,255,76,241,39,3,171,226,116,6,
+    137,89,49,10,135,121,230,118,112,28,7,106,28,87,154,80,209,110,226,250,123,204,98,216,
+    47,227,186,107,229,197,61,107,117,243,120,221,18,28,220,38,143,83,115,222,122,21,222,10,
+    100,191,221,207,126,199,37,203,181,238,91,63,169,63,51,235,142,23,194,122,221,167,204,168,
+    45,203,169,11,228,40,147,129,124,29,107,225,111,163,125,150,236,170,243,42,191,226,206,50,
+    110,129,207,191,240,117,243,207,129,213,165,41,203,252,19,199,162,15,239,63,189,207,216,109,
+    250,201,83,81,250,76,148,35,202,208,76,172,126,9,162,17,138,52,134,113,52,23,174,148,
+    36,46,148,227,37,10,76,197,111,147,64,0,24,6,202,57,2,70,46,153,2,135,20,157,
+    126,250,68,85,248,175,62,82,221,252,223,191,205,38,234,163,116,32,109,90,157,215,206,219,
+    139,154,11,117,111,48,249,183,134,63,181,228,215,69,139,189,75,142,49,212,166,147,200,73,
+    184,148,156,195,76,2,244,19,21,211,78,135,151,201,86,203,239,247,14,250,75,203,75,128,
+    36,23,152,29,181,30,137,43,18,133,97,225,109,241,209,35,215,140,29,175,236,26,170,164,
+    130,193,204,53,89,230,2,193,112,129,96,184,72,39,213,80,244,46,156,75,244,38,138,38,
+    199,47,46,129,128,194,135,60,156,72,43,233,181,38,183,64,238,139,195,83,96,27,83,83,
+    218,154,96,6,173,128,190,55,108,171,61,62,11,67,174,100,156,226,221,187,86,163,97,9,
+    91,107,20,67,226,16,75,88,93,219,47,175,173,126,248,0,28,102,156,182,103,33,28,160,
+    236,151,87,87,223,189,91,91,131,53,229,150,75,113,179,196,74,113,171,196,34,30,108,97,
+    112,77,5,215,48,184,170,130,171,24,108,202,96,23,243,118,85,94,252,42,117,85,94,252,
+    42,117,85,94,252,162,28,81,82,174,22,108,25,168,168,160,36,47,85,35,193,60,18,181,
+    40,12,146,32,100,213,66,171,70,104,77,134,102,88,232,12,64,175,121,16,11,157,173,170,
+    32,22,138,32,60,232,65,104,10,147,85,225,129,136,41,79,161,202,123,88,166,140,88,165,
+    136,53,21,65,93,227,117,19,8,106,190,215,229,16,254,171,12,194,249,203,246,26,177,29,
+    233,100,15,31,219,118,114,222,130,241,144,88,33,39,227,225,191,249,35,20,78,160,132,46,
+    215,82,152,191,65,191,232,145,35,26,33,233,45,34,174,187,174,38,198,84,187,94,154,222,
+    137,205,13,169,75,65,42,108,52,223,115,102,242,130,203,142,90,240,223,42,252,215,128,99,
+    43,190,211,121,15,255,125,128,255,214,40,166,9,49,45,136,89,101,31,46,165,154,90,230,
+    100,0,204,155,112,104,186,11,189,175,172,248,241,227,128,67,90,127,254,11,135,61,47,111,
+    92,140,53,239,254,149,45,168,239,107,189,196,239,181,54,135,247,171,124,251,148,118,130,134,
+    48,54,157,148,72,89,177,5,174,253,207,246,27,108,200,169,14,114,169,131,94,146,186,92,
+    52,169,212,154,250,169,25,17,73,84,77,251,191,201,10,244,113,153,237,221,244,102,175,122,
+    87,242,56,210,50,252,38,62,164,196,123,115,122,174,169,119,238,191,77,175,170,226,253,27,
+    238,102,70,255,142,104,19,204,114,100,56,75,215,155,109,119,33,71,246,218,51,206,69,210,
+    114,179,111,150,119,88,83,151,176,138,189,124,81,163,59,51,243,12,148,237,187,159,168,236,
+    178,186,106,149,124,169,74,233,19,54,175,21,10,9,36,255,86,24,142,28,175,63,157,183,
+    235,173,148,100,205,20,187,65,253,181,97,221,115,205,51,157,193,188,37,166,240,81,222,168,
+    17,24,149,224,145,255,235,166,22,19,144,37,155,122,11,117,161,84,36,26,48,238,98,100,
+    160,69,158,32,214,19,185,233,159,248,175,101,133,154,98,0,217,29,103,20,126,56,192,137,
+    212,223,209,42,108,98,44,183,197,137,62,76,80,167,24,82,148,82,179,249,138,208,205,145,
+    46,157,164,8,81,194,11,35,212,98,106,148,39,139,82,194,109,24,175,187,32,53,96,9,
+    98,4,123,5,98,77,22,142,111,107,228,51,73,148,113,23,100,44,183,22,3,244,21,199,
+    82,187,71,39,46,79,24,184,21,2,115,222,151,14,107,104,255,165,66,151,175,102,83,221,
+    151,207,125,23,114,5,214,223,171,165,8,159,250,157,7,6,83,108,246,75,199,67,253,157,
+    247,132,238,3,242,14,99,244,222,223,215,172,11,172,38,183,201,176,54,160,39,157,212,249,
+    43,109,180,68,63,123,253,190,208,112,171,199,115,141,135,131,146,97,210,68,87,51,153,46,
+    172,229,63,85,191,194,171,42,168,25,43,10,150,215,40,235,130,233,159,236,168,103,69,15,
+    142,102,104,117,174,190,115,114,182,127,112,124,4,180,193,140,224,66,139,209,240,174,220,98,
+    181,119,232,209,43,157,179,63,65,173,168,48,24,39,121,85,84,142,169,171,82,76,48,166,
+    22,78,127,130,154,68,168,165,1,199,126,205,56,191,99,225,3,71,93,250,42,100,42,97,
+    12,165,169,239,60,139,90,141,95,156,245,90,179,221,248,236,192,6,88,69,28,100,112,172,
+    132,90,12,165,62,48,119,34,75,162,188,184,178,146,255,152,60,11,201,56,150,165,207,243,
+    81,117,0,213,141,202,22,82,25,175,87,126,251,127,254,156,84,36,48,124,150,47,254,207,
+    159,229,63,39,151,21,235,173,117,209,188,196,135,228,5,213,76,81,19,103,194,155,170,149,
+    97,164,228,155,34,195,62,227,186,123,218,243,80,98,132,160,238,226,57,231,150,19,227,59,
+    46,241,164,50,121,18,90,28,142,139,152,19,245,60,132,59,49,75,211,196,20,106,135,116,
+    231,214,196,155,189,180,86,166,39,165,132,126,162,177,121,225,93,154,230,217,86,86,176,8,
+    252,82,254,108,2,124,62,234,91,162,117,137,66,41,172,130,227,187,88,142,5,159,218,120,
+    154,64,222,27,21,3,125,248,99,61,171,139,194,103,216,180,141,30,42,223,59,218,184,61,
+    2,169,220,185,165,247,228,92,231,191,109,62,40,49,133,252,87,145,128,154,72,73,127,18,
+    3,39,95,227,73,73,146,162,109,211,252,20,238,201,83,120,173,41,34,185,31,154,227,46,
+    236,133,43,43,158,58,155,3,89,101,5,104,240,178,26,234,131,156,42,88,248,31,127,211,
+    92,80,47,209,73,9,35,72,213,171,53,223,100,42,245,204,56,205,121,185,171,222,228,117,
+    149,147,142,67,71,97,137,10,8,29,155,28,173,56,70,117,112,241,38,121,50,66,5,98,
+    206,175,67,53,208,178,39,46,30,170,72,123,145,221,189,116,63,136,219,233,76,37,136,12,
+    154,83,209,197,11,7,97,177,128,148,122,209,201,29,41,49,163,205,75,243,150,223,205,56,
+    200,66,151,88,58,177,125,70,181,39,234,253,51,251,81,56,164,82,54,51,154,31,27,12,
+    194,45,136,111,195,183,180,197,193,116,253,106,157,152,200,194,225,88,121,113,137,246,211,58,
+    173,119,239,127,113,73,132,237,92,184,151,118,185,9,193,245,82,163,212,46,149,172,170,155,
+    80,156,230,123,171,142,28,13,44,153,45,7,85,140,149,93,43,211,251,136,107,175,181,62,
+    173,125,122,255,161,245,73,92,138,1,7,231,15,7,101,235,9,219,187,36,49,88,150,216,
+    93,146,168,140,155,93,184,43,173,119,239,46,171,240,241,203,47,31,181,239,230,123,45,208,
+    90,227,129,82,173,4,17,190,76,241,85,22,145,64,217,154,239,158,222,175,137,100,51,99,
+    176,242,126,245,169,217,250,136,137,65,42,111,160,23,25,36,57,157,139,174,250,208,106,216,
+    213,193,187,10,28,9,15,35,181,216,182,249,6,74,109,10,202,169,129,203,148,3,46,15,
+    230,12,204,242,96,230,69,125,63,112,226,195,161,63,139,134,58,134,130,210,154,43,59,255,
+    203,173,186,214,255,114,159,25,190,201,237,163,182,97,59,253,222,10,109,154,73,133,240,106,
+    217,169,185,22,26,94,243,173,183,101,175,134,203,26,159,80,44,168,96,185,89,243,44,180,
+    180,86,129,18,38,131,225,112,218,131,133,147,133,70,103,105,232,114,75,110,179,228,61,237,
+    23,219,147,17,40,253,167,146,121,153,106,192,43,78,165,188,90,107,85,96,149,8,244,176,
+    38,255,225,2,160,8,248,255,125,197,169,53,223,89,213,102,3,9,25,76,189,125,131,118,
+    232,138,136,85,141,215,48,102,42,121,212,169,54,45,129,129,68,49,75,113,24,25,245,92,
+    103,192,72,58,126,59,135,67,129,170,214,223,213,140,220,72,242,130,240,124,120,186,40,71,
+    65,57,186,195,34,252,243,225,118,16,230,67,158,213,5,177,121,102,253,201,9,90,194,57,
+    238,158,223,13,243,128,113,47,41,59,43,208,107,176,29,17,137,126,102,94,208,143,150,231,
+    210,24,67,126,177,5,57,120,39,70,195,16,224,56,129,59,56,66,183,15,140,186,248,231,
+    240,105,163,146,69,184,88,19,118,75,223,238,249,205,202,50,54,237,126,129,185,159,123,232,
+    132,103,233,49,102,25,130,249,2,4,115,68,240,156,230,70,140,218,245,39,220,127,108,11,
+    165,5,38,18,37,80,187,151,82,157,185,93,112,13,109,75,204,129,186,238,6,25,80,133,
+    171,204,233,44,191,231,182,53,3,246,35,183,69,25,176,173,225,96,4,39,228,204,2,19,
+    79,196,28,241,68,172,209,22,5,185,250,147,176,102,91,224,117,83,47,190,12,195,35,196,
+    39,224,149,221,112,54,45,194,113,97,140,218,227,109,110,94,228,217,168,79,152,95,159,156,
+    218,24,51,64,86,198,24,213,191,80,23,88,52,232,4,50,103,162,32,239,45,165,9,202,
+    234,14,47,156,171,108,204,97,137,160,112,36,111,108,10,14,84,81,14,0,84,204,104,50,
+    240,179,139,24,68,226,110,4,112,222,49,83,206,189,34,9,59,208,172,195,29,191,44,117,
+    60,47,24,77,161,141,112,8,149,60,60,63,124,234,46,143,139,14,43,186,69,75,59,121,
+    42,31,169,18,36,185,29,187,175,218,73,43,170,185,205,88,52,149,49,107,146,49,147,77,
+    148,181,96,233,64,110,215,232,61,8,230,23,29,8,76,185,136,168,246,21,87,175,127,37,
+    189,24,103,238,223,31,8,64,242,202,129,0,200,37,3,81,144,198,51,114,70,162,166,141,
+    68,45,59,18,144,105,225,72,212,212,72,212,50,164,64,149,181,112,36,106,230,72,212,50,
+    35,49,128,229,214,31,69,121,139,160,162,85,186,146,173,180,204,185,176,230,21,85,243,74,
+    186,230,126,255,22,120,175,156,60,111,181,50,223,102,203,228,249,114,74,212,201,136,89,177,
+    114,243,45,178,6,164,240,202,175,175,86,141,156,218,177,229,158,137,243,219,156,59,179,142,
+    200,185,129,120,115,136,158,232,27,151,21,23,56,208,213,75,52,113,123,241,254,82,109,18,
+    206,69,147,39,173,241,164,15,151,169,190,234,199,121,84,70,241,164,162,120,104,187,37,113,
+    154,105,115,72,155,91,41,164,206,253,98,164,192,243,46,68,42,211,242,144,102,217,233,44,
+    98,192,152,176,211,174,36,167,247,86,182,24,192,175,67,206,37,225,205,43,52,61,170,210,
+    140,53,247,92,234,10,3,164,233,67,21,87,167,35,163,26,30,26,76,112,233,211,103,190,
+    249,64,134,74,160,214,36,135,6,225,15,45,117,194,78,78,241,252,224,89,54,17,233,51,
+    176,236,61,61,21,154,86,122,194,37,173,215,218,14,117,83,44,153,222,70,189,111,57,243,
+    37,58,211,232,75,45,37,51,96,192,1,46,66,72,220,97,30,190,36,33,141,142,204,139,
+    46,194,71,137,185,8,181,148,92,140,231,195,63,130,241,48,7,175,176,169,117,191,158,169,
+    112,123,113,159,136,76,243,245,76,99,218,47,117,87,28,132,112,236,207,169,72,77,240,37,
+    162,136,154,32,4,38,249,25,78,23,82,157,251,10,242,12,85,65,240,28,100,81,249,4,
+    58,187,89,200,6,87,196,78,39,50,73,214,54,74,77,76,147,91,159,220,140,133,121,129,
+    252,252,22,82,134,184,231,76,167,78,124,176,20,147,227,78,100,207,86,205,8,68,162,30,
+    43,46,170,190,177,20,140,21,243,244,212,68,146,75,190,195,51,235,153,151,4,149,107,73,
+    42,36,71,183,241,11,138,169,156,170,221,74,180,133,229,209,138,196,82,244,102,237,124,241,
+    65,38,233,154,4,248,236,102,230,140,241,149,145,16,109,153,209,11,183,130,26,238,67,66,
+    166,54,175,105,27,145,139,116,190,226,104,157,188,253,114,197,146,158,174,225,44,201,116,55,
+    22,96,17,111,159,33,74,102,159,107,254,94,211,100,199,201,19,53,36,204,20,82,109,49,
+    199,45,141,171,66,18,45,230,186,149,102,175,16,91,30,131,161,9,88,210,60,15,106,172,
+    167,43,230,89,196,236,98,253,2,232,245,104,146,123,118,134,37,40,132,138,247,40,147,156,
+    203,16,172,7,180,46,71,42,10,139,4,199,92,41,68,90,154,195,157,218,85,123,51,124,
+    87,155,169,237,88,168,29,47,66,71,179,144,132,199,217,18,72,8,40,72,5,71,109,155,
+    148,194,225,245,229,175,198,212,13,161,41,94,34,127,48,74,34,156,111,11,78,49,168,252,
+    197,238,2,155,123,245,156,178,96,106,148,146,174,64,85,248,223,213,253,239,156,71,252,40,
+    187,25,42,141,154,250,27,41,242,175,109,137,74,143,214,197,59,75,165,101,235,90,154,117,
+    6,190,108,88,160,47,27,81,15,191,226,213,208,75,128,118,174,242,33,24,32,187,148,34,
+    179,153,243,251,161,121,126,231,92,220,90,222,249,93,247,15,194,61,76,176,152,77,217,152,
+    221,176,17,111,200,76,248,67,146,188,221,12,152,58,224,78,103,192,185,193,137,120,118,241,
+    241,210,246,224,167,217,186,180,125,252,189,180,3,248,121,135,198,16,102,23,159,46,237,16,
+    35,87,47,237,30,252,2,76,4,63,239,47,237,1,198,2,162,107,252,5,76,49,252,2,
+    208,20,126,62,92,218,99,140,5,76,133,27,252,0,92,35,179,239,251,100,247,112,58,207,
+    236,74,200,202,52,51,111,230,140,175,12,39,149,123,24,38,85,138,67,171,174,86,82,217,
+    232,133,188,131,176,70,12,85,103,25,92,177,75,61,7,127,224,171,137,95,77,252,106,225,
+    87,11,191,86,241,107,21,191,214,240,107,13,191,222,225,215,59,252,122,143,95,239,241,235,
+    3,126,125,192,175,143,248,245,17,191,62,225,215,39,194,76,133,52,121,41,188,24,42,167,
+    73,5,53,169,164,38,21,213,164,178,154,84,88,147,74,107,82,113,240,55,213,71,208,84,
+    105,206,247,103,155,252,114,177,70,81,193,61,218,240,152,110,58,147,254,36,75,2,28,105,
+    70,159,207,232,173,97,52,27,196,194,255,178,224,100,243,83,155,22,215,182,202,79,109,101,
+    206,9,215,65,166,6,137,122,19,78,50,92,181,200,200,123,240,175,129,167,2,134,204,186,
+    7,255,48,244,0,161,7,8,61,44,156,118,162,157,210,187,77,62,19,63,202,48,239,38,
+    191,45,187,153,110,125,84,32,176,225,0,151,219,88,23,122,73,177,28,172,187,4,174,153,
+    192,1,237,90,12,215,210,224,60,156,222,62,30,249,2,248,110,226,119,147,127,35,105,128,
+    63,244,189,134,223,112,232,235,194,247,59,252,126,199,191,223,227,247,123,254,253,17,191,63,
+    194,249,176,83,240,112,102,251,240,7,2,30,205,109,31,255,166,54,94,60,161,224,160,201,
+    238,196,154,238,204,162,192,60,242,138,71,160,148,240,244,36,183,144,64,55,28,44,41,101,
+    177,158,139,78,136,61,130,123,52,142,57,41,58,69,138,45,142,5,92,113,236,224,125,1,
+    212,201,129,109,173,200,55,164,213,162,19,227,125,181,31,160,145,215,78,206,146,65,179,65,
+    48,141,124,60,189,51,180,2,240,0,99,163,118,15,52,137,151,236,30,158,124,254,162,210,
+    125,124,238,164,210,125,105,149,81,123,174,219,9,108,237,193,46,94,84,148,126,255,241,7,
+    170,54,56,117,170,23,170,255,116,43,61,97,132,177,91,9,208,218,96,165,199,174,225,111,
+    192,201,86,8,201,68,151,106,33,69,225,16,113,50,22,85,7,21,95,80,170,218,53,125,
+    194,144,213,188,74,200,137,219,117,205,161,72,36,250,213,136,62,113,24,187,149,240,57,136,
+    38,65,233,199,239,122,85,214,129,143,8,43,5,216,139,224,7,235,225,83,61,124,248,230,
+    228,179,122,93,241,24,213,100,0,27,100,196,168,42,221,138,207,168,50,93,130,195,205,7,
+    178,137,138,48,170,70,4,208,3,70,213,184,6,118,20,99,69,53,172,118,233,143,223,127,
+    100,234,176,184,10,53,85,133,26,47,239,35,111,154,199,84,135,120,169,90,96,39,136,138,
+    212,120,101,161,30,169,58,252,248,61,85,135,46,213,33,53,28,76,14,135,236,4,95,118,
+    2,186,252,185,230,85,8,101,55,92,163,27,32,94,5,232,122,234,0,172,130,172,64,37,
+    52,170,240,227,143,108,21,66,170,130,79,85,8,169,10,126,170,10,216,54,217,11,149,160,
+    26,241,42,100,199,129,190,168,116,250,122,143,85,10,170,3,81,3,236,213,66,0,149,248,
+    253,15,125,44,136,177,124,77,45,106,162,10,28,57,238,123,128,252,58,85,9,40,80,246,
+    1,84,149,58,142,186,161,39,42,113,13,121,28,139,111,197,13,190,211,54,196,54,218,16,
+    123,89,67,236,99,13,177,135,53,196,182,217,204,110,33,58,249,248,85,25,159,123,105,3,
+    37,106,112,197,201,193,21,167,7,87,72,16,224,231,142,133,182,87,245,88,207,246,171,62,
+    244,72,80,13,96,187,197,149,198,31,188,65,67,58,94,5,88,44,254,214,13,186,162,227,
+    99,48,192,63,97,5,56,178,30,254,233,98,144,122,175,89,43,95,87,3,139,175,236,65,
+    173,203,23,182,87,237,241,165,61,168,118,249,194,6,56,135,195,33,53,174,137,149,237,213,
+    122,124,93,251,213,80,172,106,2,188,254,185,30,44,44,232,66,110,232,117,193,206,40,196,
+    91,35,241,168,62,187,83,10,149,85,78,44,77,14,197,211,207,95,164,243,79,106,48,117,
+    41,125,40,163,218,14,108,222,54,113,13,218,1,178,227,212,189,241,112,50,145,121,201,234,
+    41,157,127,204,188,77,169,1,134,231,213,110,253,193,90,247,240,64,217,220,169,173,181,1,
+    47,255,98,6,106,150,131,26,203,211,75,119,77,16,188,150,239,132,68,145,224,136,16,18,
+    63,78,31,56,132,244,129,171,0,142,10,33,14,161,75,31,159,48,9,63,144,43,171,63,
+    192,199,123,76,194,15,28,62,168,92,118,95,205,202,187,181,123,101,77,85,62,215,70,149,
+    182,161,10,60,175,188,58,144,224,132,192,11,150,92,32,100,32,177,126,86,59,63,77,170,
+    192,176,17,156,10,243,36,249,121,114,113,13,51,233,62,39,162,124,153,146,123,0,116,242,
+    25,180,78,150,99,70,214,73,60,75,70,14,9,86,59,50,65,184,218,113,197,192,122,71,
+    126,10,22,60,178,76,72,3,97,28,145,8,226,50,98,177,141,12,22,155,218,200,67,177,
+    177,77,92,18,187,193,95,192,52,130,95,0,186,135,159,15,151,108,142,177,112,26,240,240,
+    247,29,47,242,142,120,54,182,73,108,25,219,35,206,139,125,69,54,11,176,158,16,19,199,
+    190,16,159,198,182,136,19,99,27,24,9,72,31,136,171,99,59,196,184,177,93,206,153,177,
+    125,252,5,76,7,240,11,64,191,194,15,148,124,132,177,80,178,143,191,116,158,193,121,91,
+    185,131,243,236,73,181,91,121,168,134,149,3,113,240,169,108,66,228,23,136,220,129,200,95,
+    197,41,167,178,7,145,91,16,185,91,45,132,149,35,121,176,168,124,133,232,13,136,222,7,
+    88,193,144,244,0,107,4,88,7,128,245,154,176,190,195,200,77,136,252,2,145,59,16,249,
+    43,167,100,61,192,26,1,214,1,96,189,230,72,241,160,10,72,35,64,58,0,164,156,159,
+    129,146,98,64,58,5,164,99,64,122,67,72,223,99,228,38,68,126,129,200,29,136,252,85,
+    208,192,24,176,78,1,235,24,176,222,112,172,120,192,5,172,83,192,58,6,172,55,132,21,
+    138,26,1,214,123,192,58,7,172,30,97,253,128,145,155,16,249,5,34,119,32,242,87,65,
+    61,71,128,245,30,176,206,1,171,199,177,226,185,24,176,222,3,214,57,96,133,61,241,213,
+    247,77,121,7,55,28,18,188,119,194,81,224,191,31,197,47,116,181,248,16,191,239,196,239,
+    39,25,191,42,62,36,224,123,153,32,81,54,37,78,9,249,65,38,72,156,77,142,212,188,
+    245,196,59,168,243,225,66,209,144,220,18,10,11,79,75,105,221,56,50,91,160,84,227,80,
+    134,230,114,121,143,135,36,120,206,67,63,120,232,129,135,254,224,33,237,62,108,141,63,129,
+    96,116,224,4,86,26,73,49,221,27,225,253,208,131,102,16,6,233,167,143,54,249,6,253,
+    216,137,115,246,50,115,231,119,73,58,128,12,0,46,69,159,206,246,200,0,208,82,236,146,
+    192,0,141,21,224,82,236,209,113,31,72,2,157,167,129,38,160,12,1,104,2,138,8,128,
+    36,144,0,0,104,130,113,194,166,123,184,50,44,152,94,229,26,152,176,8,254,6,149,176,
+    18,195,204,137,224,175,15,223,83,100,211,42,83,139,110,228,0,214,197,80,205,165,244,160,
+    210,173,196,53,244,242,57,173,98,238,65,13,49,13,16,22,7,17,129,17,165,75,104,16,
+    248,26,221,130,2,48,22,50,168,97,33,28,24,6,186,92,243,41,18,241,95,87,93,170,
+    5,98,190,174,97,22,172,17,98,126,22,111,85,134,147,224,133,174,235,20,248,140,38,153,
+    138,195,165,43,107,248,69,66,42,151,75,88,28,46,107,249,136,95,31,101,252,123,12,189,
+    23,210,19,252,35,226,87,49,180,42,101,23,244,87,164,124,192,224,7,41,201,160,191,34,
+    165,201,11,111,74,201,6,253,181,179,250,48,175,150,165,8,42,7,155,185,16,158,192,222,
+    45,68,39,169,157,154,145,97,108,180,73,24,44,190,159,211,182,35,71,223,126,252,100,251,
+    33,114,223,229,132,61,228,20,188,199,119,134,136,239,1,3,78,237,175,57,89,143,249,118,
+    49,229,27,195,88,108,1,55,156,216,195,230,195,119,145,123,177,97,204,249,214,160,54,1,
+    190,253,76,43,115,24,247,251,202,24,102,194,125,101,80,185,169,69,16,115,83,155,194,183,
+    15,148,120,12,188,254,38,80,58,72,175,197,4,59,66,168,106,15,190,11,55,213,24,193,
+    106,61,2,219,3,50,123,79,0,83,64,54,130,25,119,3,41,247,240,55,134,111,31,178,
+    76,1,234,171,141,233,131,26,194,14,106,8,53,174,34,212,184,138,80,243,26,66,205,97,
+    235,227,219,211,38,236,46,123,176,187,124,197,131,51,61,77,226,246,254,72,200,157,231,124,
+    40,97,121,146,49,1,166,199,115,226,255,141,214,116,73,145,157,191,232,97,69,141,56,160,
+    190,78,3,95,239,47,229,162,254,18,74,195,31,159,16,157,150,173,103,20,236,156,112,177,
+    205,29,23,175,92,218,101,28,135,176,134,99,18,194,152,116,161,159,3,28,13,216,187,224,
+    252,5,203,26,186,217,34,96,152,152,229,72,128,13,42,97,245,158,150,111,64,3,20,33,
+    48,100,28,72,96,152,187,101,28,207,176,22,9,252,72,30,2,26,115,4,190,169,33,240,
+    13,7,134,233,189,73,31,176,193,149,99,42,2,71,63,132,1,69,72,167,82,152,211,136,
+    118,201,199,173,170,16,44,226,242,136,202,232,137,60,88,134,131,21,130,225,197,218,59,73,
+    133,96,253,150,123,84,149,152,106,31,83,237,29,154,100,61,106,182,147,84,8,136,197,30,
+    125,124,162,34,166,148,235,158,138,8,8,18,102,24,96,8,168,136,169,44,2,121,129,114,
+    79,192,69,84,253,128,202,184,167,50,2,170,125,164,160,155,212,216,136,170,207,75,8,168,
+    250,83,170,126,64,13,143,100,141,144,44,124,229,95,171,148,15,122,159,102,125,151,74,25,
+    83,41,99,194,49,39,28,115,145,111,141,90,0,93,78,235,162,75,45,24,80,11,6,84,
+    202,156,74,145,208,239,168,5,128,149,214,79,151,218,56,160,54,14,168,5,99,106,193,56,
+    115,15,54,65,85,165,87,29,116,133,216,139,164,198,15,130,5,241,4,11,226,235,44,8,
+    252,22,60,193,122,248,26,235,209,18,25,222,139,120,197,113,172,138,132,15,50,161,153,229,
+    47,96,53,29,58,247,164,88,117,28,111,220,235,2,223,252,109,38,115,119,154,168,46,96,
+    213,241,79,149,84,91,240,79,21,55,156,10,109,204,164,231,130,127,170,184,123,87,240,15,
+    233,195,84,104,191,198,237,168,130,127,170,184,1,85,240,79,149,118,240,10,253,181,44,46,
+    79,56,23,47,23,205,157,35,37,152,110,170,199,122,77,178,86,193,111,63,188,5,98,104,
+    93,76,241,123,206,128,41,41,162,131,15,199,149,20,209,73,222,26,106,215,45,46,171,57,
+    162,116,119,161,224,91,47,241,199,79,149,168,30,50,162,28,91,60,71,228,133,83,177,175,
+    43,242,143,191,214,200,252,166,189,170,68,115,90,253,196,253,96,179,230,145,244,231,158,132,
+    63,114,137,112,129,6,10,35,97,95,174,116,147,42,134,232,134,157,133,176,86,221,138,3,
+    191,232,152,189,139,38,168,184,111,114,6,84,13,69,71,21,7,210,3,138,199,175,46,198,
+    160,11,119,230,163,102,122,213,91,218,166,179,212,186,78,95,138,104,83,65,126,189,128,176,
+    151,125,31,96,76,102,116,65,64,221,206,231,48,2,44,185,203,67,181,218,201,130,10,46,
+    150,200,169,187,94,34,91,137,159,201,132,81,195,185,96,234,181,4,153,178,242,196,83,135,
+    121,218,87,137,71,119,147,28,134,54,215,202,234,226,25,160,75,124,24,144,14,237,194,166,
+    167,0,80,68,128,204,88,23,168,135,6,16,41,128,143,152,246,137,208,52,52,8,229,144,
+    47,225,17,72,96,21,218,181,16,101,93,247,118,151,216,93,15,78,66,93,98,111,81,12,
+    214,229,183,131,252,93,52,127,252,237,1,235,16,118,240,6,169,39,100,143,205,183,81,39,
+    145,113,72,58,158,68,52,211,17,173,116,4,146,252,174,30,129,164,190,96,196,188,79,131,
+    224,246,48,208,35,62,165,35,104,63,24,112,99,20,56,236,114,10,8,195,28,228,145,235,
+    222,14,225,239,220,238,193,223,7,59,202,189,90,58,1,158,107,196,13,214,231,94,160,107,
+    218,16,221,124,253,4,243,110,73,195,7,156,156,166,171,32,95,56,226,173,17,70,59,164,
+    151,141,215,250,14,121,69,42,158,68,1,106,130,123,189,192,187,134,58,6,69,127,232,77,
+    228,213,82,90,214,73,242,193,86,37,120,75,15,62,184,148,176,193,101,132,101,183,234,88,
+    42,158,75,102,73,102,216,224,18,67,202,229,213,124,139,203,13,203,94,149,191,208,161,8,
+    46,192,37,57,98,131,75,17,27,66,134,88,43,119,171,1,0,118,107,1,1,162,108,190,
+    5,28,85,160,162,68,214,15,34,15,148,88,107,226,199,59,140,48,150,89,1,123,234,120,
+    60,237,13,195,177,51,234,245,189,69,93,159,109,57,172,150,38,111,28,44,139,38,175,55,
+    195,105,42,107,65,253,210,51,122,164,33,250,161,86,166,190,169,244,172,84,135,68,188,43,
+    26,162,3,0,14,59,165,18,89,249,61,209,170,12,100,15,148,169,87,224,76,155,219,254,
+    134,104,126,74,2,158,163,252,243,226,141,187,110,210,182,249,158,155,251,181,224,188,130,175,
+    0,241,205,12,154,172,85,47,48,197,71,227,103,52,134,114,11,48,42,4,69,96,57,85,
+    247,175,42,17,21,178,165,230,156,98,185,102,17,137,78,133,94,145,199,79,255,110,21,47,
+    39,248,137,223,173,174,94,146,8,148,190,215,46,73,190,74,223,239,46,73,156,74,223,120,
+    9,196,37,1,110,245,195,37,201,74,233,27,37,233,92,94,224,86,81,116,206,101,4,80,
+    86,227,146,203,89,121,136,23,45,202,110,82,225,77,81,122,147,138,111,138,242,155,84,129,
+    166,168,65,147,170,160,105,91,56,89,77,158,127,59,236,113,146,243,30,14,149,120,165,178,
+    62,39,204,142,85,39,64,110,149,139,209,247,110,228,44,82,247,225,83,9,37,203,126,181,
+    193,101,203,62,244,33,73,151,253,106,139,203,136,125,232,61,56,173,7,23,221,170,144,16,
+    92,83,160,137,39,127,252,0,184,128,62,86,233,193,170,135,134,28,159,158,122,248,102,250,
+    233,9,159,78,95,63,61,13,224,39,182,30,97,179,168,241,139,170,145,221,163,131,253,117,
+    117,64,162,158,128,141,237,198,103,187,48,90,111,182,107,77,118,3,128,163,202,168,115,243,
+    75,230,209,255,141,157,112,222,55,22,27,233,170,145,55,12,14,137,150,188,57,39,19,212,
+    149,145,245,246,134,133,73,76,72,49,176,151,87,128,226,247,108,100,137,252,202,184,19,217,
+    120,184,185,134,175,129,61,160,99,206,24,155,15,95,112,196,129,93,206,198,170,211,54,217,
+    124,155,84,160,87,233,65,35,240,182,119,0,141,240,96,127,6,172,44,194,63,3,252,227,
+    193,31,235,153,38,105,79,206,208,72,78,207,129,154,155,218,152,103,94,137,253,219,120,21,
+    126,191,244,133,215,213,162,55,98,87,234,113,214,48,222,234,225,83,160,45,39,138,208,125,
+    89,217,122,126,102,243,229,88,23,61,28,187,154,47,197,250,176,28,235,195,34,172,15,202,
+    251,112,46,218,187,229,104,239,22,161,189,91,86,217,156,69,167,119,123,158,202,92,166,107,
+    175,230,202,53,209,131,114,228,115,39,253,252,100,75,125,149,18,218,146,23,89,87,226,13,
+    193,149,80,6,190,122,16,191,119,11,223,104,93,221,39,79,69,174,248,35,45,89,97,60,
+    88,168,142,170,223,189,174,210,130,161,74,235,217,136,71,69,111,156,167,167,55,74,221,38,
+    79,78,166,93,137,23,235,58,178,180,150,77,252,23,212,108,10,242,10,46,125,147,78,187,
+    37,129,9,175,170,242,24,166,209,9,224,29,128,150,189,109,33,235,208,45,251,240,1,68,
+    160,91,14,240,195,179,67,74,2,178,24,242,164,0,62,40,73,105,213,172,203,49,178,61,
+    18,155,0,185,3,34,39,59,30,67,93,18,135,203,184,7,136,67,93,8,15,83,228,56,
+    82,28,194,65,94,212,205,248,253,111,225,174,229,224,174,74,220,82,253,37,133,187,150,131,
+    187,250,179,245,150,106,45,127,17,247,210,122,75,125,149,4,119,97,97,167,188,22,185,170,
+    184,212,67,81,70,53,150,212,252,181,163,41,106,222,145,254,98,92,235,103,86,26,74,18,
+    54,204,39,2,180,218,220,183,118,171,163,201,20,132,20,65,91,244,21,79,95,246,42,68,
+    11,191,146,80,43,93,34,241,51,21,51,207,84,57,252,170,163,11,253,92,226,216,108,148,
+    241,9,73,135,203,239,185,92,126,247,128,50,62,88,140,40,226,131,133,136,18,62,134,30,
+    15,80,245,213,38,249,158,212,118,169,118,171,110,167,241,121,176,94,40,123,118,253,157,182,
+    53,15,170,77,75,245,124,189,245,238,173,199,100,111,148,35,56,234,86,60,53,126,101,191,
+    214,75,194,15,118,57,128,35,3,236,230,109,239,23,60,199,253,130,122,13,242,121,5,225,
+    110,86,189,90,183,230,38,248,9,163,86,2,148,167,227,71,197,153,183,26,126,191,218,131,
+    176,213,238,230,161,134,153,100,160,198,202,233,149,55,144,205,141,162,0,117,88,141,8,117,
+    6,173,11,104,187,26,90,108,163,142,246,255,98,239,207,219,155,72,146,69,113,248,127,125,
+    10,181,239,249,113,85,86,89,150,228,5,80,185,240,99,192,208,244,152,101,176,161,161,61,
+    190,60,181,105,25,107,67,146,23,25,252,126,246,55,34,114,207,202,146,101,99,186,251,156,
+    51,61,131,85,185,71,70,70,70,70,102,70,68,50,152,20,204,172,34,89,49,53,115,59,
+    146,248,48,236,205,114,150,16,214,17,137,219,52,205,218,15,80,94,60,32,75,106,233,104,
+    86,73,189,106,35,104,236,175,161,79,145,18,110,13,124,169,104,147,212,46,189,39,90,232,
+    202,219,101,199,33,107,9,169,230,94,250,117,175,21,137,215,164,19,82,208,157,123,24,101,
+    169,213,164,198,220,185,113,193,52,206,190,117,133,29,58,59,232,217,151,114,166,200,2,11,
+    251,191,207,58,204,87,165,47,3,57,189,246,47,151,171,234,241,189,185,246,125,165,190,111,
+    26,153,69,182,88,80,63,46,149,85,209,0,46,152,85,209,2,46,155,60,112,129,129,139,
+    155,13,181,190,112,75,43,173,74,254,43,107,229,191,178,98,41,193,45,107,204,5,109,148,
+    238,216,72,145,177,150,118,228,175,142,204,244,21,230,42,20,212,32,40,164,46,103,85,3,
+    38,94,132,186,210,190,28,50,241,57,87,159,87,234,243,2,62,151,156,85,63,166,132,101,
+    72,90,119,212,195,82,117,20,27,213,187,242,58,148,177,244,228,59,233,99,153,245,151,44,
+    157,44,45,181,64,45,203,41,19,126,185,224,2,97,140,233,29,252,153,227,250,131,233,232,
+    110,233,203,69,160,228,0,180,104,195,189,99,23,53,40,36,135,72,41,190,131,154,18,168,
+    71,33,185,5,153,241,192,110,49,89,237,172,201,51,123,20,181,87,99,212,119,64,93,8,
+    212,165,88,146,193,58,76,214,248,205,180,180,223,39,31,81,16,217,176,35,197,81,129,225,
+    123,11,177,33,54,19,226,205,74,212,56,229,96,2,46,218,52,237,1,126,98,18,41,99,
+    15,25,49,134,160,254,164,35,102,199,69,184,70,90,170,2,79,107,145,182,79,161,144,220,
+    173,80,232,202,167,131,231,150,1,25,130,189,3,59,103,115,99,23,182,101,173,106,157,42,
+    165,178,58,38,124,201,235,27,90,246,214,58,171,29,170,175,86,175,55,212,202,16,121,118,
+    221,181,173,213,74,91,240,8,79,45,228,16,157,240,232,75,79,45,186,16,157,10,142,227,
+    169,69,18,162,51,193,120,88,180,174,138,207,14,41,240,205,130,64,59,144,0,32,99,60,
+    103,92,143,140,43,32,22,35,187,14,36,37,56,70,172,17,161,136,149,62,31,136,4,59,
+    146,25,198,26,1,118,36,75,140,151,35,179,69,134,135,95,164,229,225,23,50,61,252,34,
+    109,15,191,204,41,124,37,195,87,20,190,144,225,139,91,27,39,126,209,173,19,191,48,243,
+    196,82,227,68,45,197,116,160,162,230,20,29,171,44,215,199,123,177,106,252,98,154,53,126,
+    153,139,35,30,14,160,56,232,225,0,106,86,143,2,188,252,86,221,6,220,190,183,182,211,
+    91,198,83,129,246,113,198,216,229,205,103,195,109,13,152,247,231,195,233,5,79,53,150,245,
+    235,195,87,201,159,228,222,167,148,207,247,135,11,134,159,237,6,136,98,155,45,222,218,223,
+    209,57,16,135,80,143,188,250,147,61,6,177,159,171,5,142,131,44,191,65,98,240,108,253,
+    182,210,15,251,16,218,248,171,124,8,177,46,85,243,125,90,222,159,144,172,226,94,60,11,
+    41,28,87,227,2,152,238,224,104,72,235,230,189,187,29,218,248,203,220,14,177,94,173,229,
+    7,111,121,23,68,178,138,123,113,70,164,6,111,45,55,120,5,219,132,59,32,251,142,187,
+    132,155,166,140,157,79,67,125,222,121,18,235,233,106,30,245,183,116,164,36,234,177,23,14,
+    11,152,194,81,88,53,71,97,213,28,133,213,252,20,66,77,113,235,88,92,63,250,248,119,
+    228,210,84,143,241,97,210,197,214,169,26,31,147,77,220,199,97,185,190,64,80,205,154,110,
+    76,100,30,205,227,179,160,120,172,65,217,28,7,146,55,245,211,246,132,81,216,156,172,155,
+    121,2,82,141,46,237,146,74,236,106,174,130,210,114,206,169,86,83,229,2,195,246,78,37,
+    210,174,72,149,156,210,182,88,218,163,19,219,238,66,183,20,184,13,152,6,148,76,29,187,
+    177,94,33,0,99,6,68,194,117,237,83,166,70,47,125,86,84,100,103,54,21,80,85,82,
+    90,247,86,51,209,171,138,236,22,7,253,49,207,181,161,114,93,97,46,222,193,109,222,96,
+    157,103,219,164,108,249,174,222,108,219,232,232,173,174,218,70,170,79,172,255,23,124,207,4,
+    91,227,42,170,236,118,86,19,84,107,2,64,58,176,89,206,200,4,52,34,221,226,100,173,
+    189,138,106,247,232,36,3,62,147,181,142,24,163,203,144,233,180,149,214,178,106,127,117,173,
+    179,54,88,93,107,11,36,244,41,105,173,93,133,200,108,173,11,201,162,227,3,150,210,169,
+    66,100,123,13,10,90,125,29,179,71,125,220,180,254,218,53,165,163,188,5,89,92,27,91,
+    111,3,249,145,174,212,29,235,79,3,121,142,169,41,44,80,34,54,37,206,134,247,4,150,
+    214,172,13,145,13,241,18,96,145,221,70,123,52,25,200,167,40,238,60,17,236,233,170,81,
+    120,110,186,18,93,151,24,97,231,230,171,78,206,133,71,182,183,113,180,199,26,88,207,175,
+    79,119,119,186,119,95,110,239,120,223,205,180,43,195,58,233,126,93,226,25,13,138,52,87,
+    131,63,217,93,94,73,250,203,179,33,66,183,10,90,214,43,177,51,185,173,103,61,105,122,
+    124,131,103,61,195,183,222,159,230,93,239,47,112,174,167,35,90,75,185,186,119,183,123,122,
+    67,42,193,110,167,116,47,14,249,244,182,180,148,171,191,155,171,62,14,39,47,116,181,155,
+    67,78,235,166,113,185,173,127,63,222,226,26,231,213,183,112,247,103,122,251,171,114,177,28,
+    230,229,93,29,255,137,42,216,15,12,253,143,249,1,52,171,187,31,175,128,86,196,213,125,
+    184,9,252,235,157,222,137,173,62,50,85,78,8,127,130,47,60,186,166,189,225,6,172,84,
+    112,5,166,182,78,84,203,146,219,90,227,98,184,104,79,107,100,210,174,187,140,120,121,207,
+    165,199,22,92,79,153,54,81,252,181,114,146,149,113,231,25,147,191,6,233,36,46,94,139,
+    86,165,112,27,145,78,139,58,177,165,187,37,183,24,251,118,152,59,224,81,218,26,120,211,
+    78,183,106,235,186,103,139,192,113,145,100,15,87,236,105,45,208,11,128,183,112,109,21,105,
+    38,6,53,11,78,203,255,30,157,6,113,97,115,146,181,251,78,9,184,216,44,60,87,147,
+    120,244,205,238,79,147,113,3,68,72,236,137,109,40,110,75,45,223,149,252,214,24,243,137,
+    39,0,20,187,81,40,92,213,241,233,25,230,100,17,42,222,28,74,201,0,223,253,51,29,
+    112,254,89,78,60,165,64,190,198,136,144,31,95,105,82,46,122,244,76,80,152,254,1,175,
+    158,133,78,61,109,142,137,13,123,82,175,132,222,60,236,193,216,20,217,113,145,229,86,109,
+    220,237,121,232,94,118,18,165,189,51,185,135,136,87,181,44,179,110,54,139,44,105,3,109,
+    192,88,89,179,232,149,40,202,114,240,162,46,189,151,103,243,126,111,152,230,33,148,167,73,
+    172,218,98,64,140,51,112,61,243,141,77,179,45,152,211,182,220,189,161,106,52,53,159,159,
+    13,113,105,118,229,114,203,103,52,113,184,200,186,211,229,39,46,50,252,206,37,139,50,234,
+    142,231,162,69,25,117,207,115,242,186,70,220,16,37,65,225,29,144,93,149,123,61,161,226,
+    202,247,163,166,191,182,185,26,223,209,45,43,134,228,197,232,213,253,56,105,149,35,70,119,
+    160,63,223,101,171,126,181,121,181,188,3,215,91,248,111,221,184,179,255,214,210,205,14,92,
+    229,196,34,183,30,150,71,215,220,189,233,52,114,185,81,221,184,217,141,42,155,16,3,203,
+    92,101,192,28,167,14,200,53,34,252,52,209,55,234,224,152,188,71,12,208,10,41,131,31,
+    116,85,3,63,104,144,2,63,15,209,139,234,0,77,147,250,119,112,128,218,184,131,203,83,
+    251,54,239,191,129,7,212,18,185,244,40,158,231,155,55,176,66,178,92,69,155,75,242,186,
+    66,62,87,200,211,10,249,89,33,47,43,220,132,155,44,181,209,158,242,110,78,106,254,92,
+    31,53,27,183,241,81,115,123,79,88,127,7,63,90,165,27,28,105,109,48,71,90,219,220,
+    145,22,243,163,181,201,108,157,30,50,75,167,38,243,163,181,197,204,157,30,177,178,67,230,
+    17,107,204,220,159,76,152,195,147,175,204,53,202,57,115,134,114,201,220,159,204,153,163,148,
+    11,114,141,66,110,77,30,73,215,86,232,48,231,107,181,189,58,231,116,189,58,134,136,115,
+    136,184,224,164,188,58,129,136,75,60,229,14,184,211,198,97,181,11,69,250,84,100,19,35,
+    198,16,113,14,17,23,140,230,59,204,81,9,247,162,73,78,12,135,213,83,40,146,80,145,
+    45,140,24,67,196,57,68,92,4,220,35,227,4,34,46,239,209,57,212,134,237,226,201,114,
+    26,245,208,114,5,181,101,56,147,178,172,168,239,226,26,9,70,161,148,50,127,71,25,177,
+    11,114,141,180,105,184,70,218,102,174,145,208,140,47,212,217,67,188,218,38,179,247,206,106,
+    31,54,74,25,61,36,215,89,237,86,97,151,4,49,232,129,168,187,192,149,14,119,32,203,
+    217,138,90,197,28,46,100,55,108,95,45,195,81,25,216,110,7,111,226,162,211,12,205,122,
+    121,53,106,207,185,34,212,242,12,231,60,230,56,48,133,121,36,115,63,99,68,221,102,100,
+    220,97,4,175,145,56,119,21,183,205,72,252,161,69,226,201,106,119,173,191,122,10,84,222,
+    39,231,76,29,32,244,83,114,62,50,64,90,39,242,29,3,113,78,132,219,155,175,75,185,
+    189,217,184,127,183,55,119,174,178,180,192,239,205,215,0,233,41,28,194,102,153,220,69,85,
+    152,239,169,204,163,8,230,219,38,91,3,114,96,17,228,171,45,102,254,164,42,48,151,32,
+    101,192,82,182,168,44,250,181,73,89,4,76,237,9,125,160,139,25,116,151,114,42,82,30,
+    145,55,21,116,162,211,201,157,150,44,237,232,42,239,231,74,120,170,178,253,92,9,207,86,
+    44,158,44,93,183,78,52,255,85,113,206,23,202,27,58,54,114,88,113,24,219,101,99,109,
+    197,35,0,109,112,216,214,93,118,166,162,187,240,122,53,204,139,164,5,50,3,14,13,51,
+    19,193,46,198,172,139,232,128,139,117,10,59,203,16,128,238,181,152,65,47,186,184,100,93,
+    131,46,151,98,134,7,236,37,235,57,250,251,114,137,9,31,206,143,196,85,213,13,134,178,
+    197,14,149,165,20,129,142,100,209,156,21,8,169,210,37,235,209,142,87,109,87,97,51,159,
+    146,131,141,46,126,84,208,55,26,176,113,72,234,84,185,127,22,47,239,50,167,192,117,23,
+    185,107,66,70,154,112,70,156,112,70,156,16,35,102,238,147,216,239,67,250,117,188,89,112,
+    43,23,40,110,247,97,146,1,45,94,99,153,115,169,152,60,29,117,152,27,168,24,93,236,
+    162,159,90,34,77,192,68,180,218,103,174,167,208,79,52,186,130,99,30,160,208,169,48,186,
+    159,99,190,154,240,144,11,253,203,57,38,77,63,178,31,139,40,70,92,21,111,146,145,52,
+    16,20,22,192,165,31,64,97,129,71,39,4,74,21,0,227,217,54,121,128,178,61,228,1,
+    155,142,126,212,78,255,241,79,54,211,127,252,83,172,244,255,110,70,250,37,221,138,30,65,
+    185,108,67,223,63,215,158,239,191,216,251,112,112,244,229,213,235,189,151,251,33,131,90,139,
+    126,189,247,238,221,171,55,47,195,141,58,198,202,13,159,249,182,121,133,135,146,73,134,182,
+    58,250,107,221,158,255,77,219,47,181,62,251,189,233,81,118,137,174,58,112,163,120,187,189,
+    150,58,254,44,210,151,196,23,221,129,140,240,135,241,157,222,32,234,96,12,253,178,168,65,
+    111,60,136,198,83,136,228,95,234,169,104,238,9,103,60,238,13,81,231,130,127,177,232,139,
+    73,52,62,68,21,12,252,85,81,71,60,234,72,20,238,188,232,245,97,173,165,226,252,91,
+    180,59,84,73,226,155,37,69,195,222,116,52,155,64,151,32,77,5,88,34,50,223,104,6,
+    9,236,131,69,210,24,176,183,176,185,50,55,157,10,240,115,103,30,226,29,154,100,99,24,
+    22,145,196,66,226,60,32,1,42,204,38,34,141,133,68,49,174,34,133,7,109,252,83,244,
+    17,215,182,189,51,124,157,58,133,241,166,174,154,81,122,70,81,57,11,241,202,197,123,217,
+    175,229,96,88,49,44,155,182,125,218,235,143,187,200,34,236,40,142,164,126,111,252,25,113,
+    132,191,44,234,108,56,142,146,211,189,62,208,39,206,53,72,180,98,88,182,108,152,140,82,
+    54,222,226,211,158,241,191,29,190,125,227,96,95,106,210,127,255,190,50,165,87,187,209,36,
+    22,199,100,212,46,71,100,198,10,147,95,189,153,94,155,49,202,159,30,51,0,207,122,169,
+    96,99,101,103,34,103,25,223,6,217,44,2,180,70,173,111,40,71,224,241,229,102,109,203,
+    199,134,90,43,124,54,173,136,39,200,97,146,137,184,26,3,125,229,218,199,218,90,178,94,
+    191,132,19,164,37,103,140,207,9,189,165,211,191,207,8,165,117,172,211,16,215,53,224,161,
+    249,137,207,8,141,103,226,52,200,51,241,16,100,98,100,197,51,113,138,227,153,120,8,50,
+    9,26,107,25,196,231,227,220,226,37,105,230,249,106,230,193,218,74,51,162,165,77,19,95,
+    206,172,150,57,233,124,57,27,91,230,68,245,213,124,107,89,147,209,39,106,106,41,2,187,
+    14,114,47,214,19,99,97,20,145,106,49,138,253,167,132,114,88,3,216,71,120,88,211,223,
+    138,199,107,14,131,78,200,93,58,85,49,61,78,57,137,124,99,91,118,17,143,14,72,217,
+    56,118,248,7,86,145,210,205,27,222,48,0,241,253,122,244,250,224,89,52,60,143,166,251,
+    108,165,241,152,148,86,74,3,124,85,226,91,55,76,71,9,219,86,49,158,205,179,189,57,
+    172,172,116,103,179,113,107,125,253,226,226,162,118,177,81,27,77,58,235,141,199,143,31,175,
+    95,118,103,131,254,138,191,146,80,181,176,127,232,214,232,97,102,0,129,126,33,204,30,90,
+    134,8,246,193,31,204,232,214,72,107,127,136,244,93,89,105,166,80,212,128,245,21,118,234,
+    57,80,247,110,191,54,62,155,201,96,37,69,233,207,107,245,107,233,36,186,160,104,22,229,
+    243,22,125,209,144,119,221,13,155,245,205,71,59,28,164,239,223,121,136,37,239,118,97,34,
+    96,141,31,222,31,84,86,8,135,235,255,30,103,157,21,191,182,237,181,28,137,99,152,200,
+    32,197,30,183,79,194,111,52,115,58,254,217,164,223,234,94,95,39,124,65,97,104,191,142,
+    191,127,175,56,39,110,152,200,35,164,132,46,152,236,189,139,184,143,26,71,179,164,187,127,
+    14,168,175,124,99,243,153,103,94,185,22,155,3,36,236,15,231,6,255,129,225,134,245,88,
+    28,150,243,9,139,23,132,185,19,46,201,117,75,184,79,125,18,213,46,191,127,111,236,224,
+    237,18,183,152,80,51,139,155,78,52,246,55,90,120,203,173,107,172,144,126,147,110,236,81,
+    175,55,48,83,72,53,238,214,91,13,43,181,73,169,134,163,127,171,186,255,175,233,105,218,
+    24,24,131,119,94,212,178,149,243,154,67,62,103,144,207,115,144,31,25,144,207,45,200,231,
+    46,200,231,4,249,188,0,242,249,2,200,231,57,200,231,8,249,156,90,182,114,94,43,206,
+    129,98,33,214,203,30,230,43,114,106,51,175,104,34,150,191,50,204,178,116,202,22,212,21,
+    219,209,138,247,237,23,46,111,82,35,124,93,168,86,243,231,244,153,126,78,95,146,22,78,
+    133,239,157,45,180,113,98,72,15,211,165,141,157,46,194,63,193,230,233,206,38,79,191,187,
+    0,254,107,44,163,40,118,163,197,97,248,139,237,165,74,203,27,76,113,184,245,200,139,191,
+    198,138,138,139,6,119,50,166,226,104,215,100,181,139,93,248,215,106,220,243,75,237,155,127,
+    7,43,43,214,217,42,233,147,231,172,200,110,109,114,37,107,251,25,198,87,98,74,66,3,
+    177,13,237,125,217,98,105,232,184,119,203,172,205,123,180,204,186,179,97,22,235,224,90,126,
+    188,23,27,105,149,220,86,90,178,182,159,97,175,165,198,123,45,55,222,119,180,107,18,16,
+    187,159,207,184,189,33,138,112,2,112,177,180,34,62,51,53,81,150,38,197,134,38,202,206,
+    100,129,153,137,200,116,17,46,48,126,177,245,218,238,166,116,95,138,152,110,145,52,55,90,
+    240,88,23,135,137,187,214,137,152,66,206,133,120,210,79,119,60,128,19,141,146,240,161,39,
+    244,243,195,113,215,240,77,89,1,132,255,138,162,158,245,216,87,180,35,2,68,57,235,113,
+    94,229,199,128,120,129,7,166,156,85,17,187,74,19,87,77,202,11,147,122,109,132,221,168,
+    109,177,27,181,199,39,194,36,7,15,235,216,142,135,46,23,152,142,3,123,106,148,156,44,
+    104,62,22,146,181,204,123,240,192,136,66,87,70,86,84,103,173,239,17,195,169,233,69,171,
+    84,84,47,89,237,90,49,232,159,200,140,137,171,237,234,96,109,195,116,237,160,41,67,120,
+    134,127,136,119,175,240,242,24,10,53,188,245,102,208,14,43,109,246,53,8,201,117,20,124,
+    37,33,1,178,190,25,164,220,61,210,102,208,225,142,145,54,131,24,125,67,197,79,6,187,
+    216,29,24,222,126,88,135,105,212,13,107,15,235,15,27,245,237,135,143,208,23,76,95,35,
+    137,24,189,55,39,235,125,200,149,174,247,209,249,19,43,219,198,178,170,20,100,194,138,140,
+    106,186,90,53,109,244,72,151,172,119,33,79,103,189,235,181,176,138,193,46,100,49,42,73,
+    136,174,18,173,220,0,203,165,235,248,114,92,103,93,243,111,93,233,251,80,151,111,41,148,
+    233,78,52,152,187,44,250,91,101,174,178,232,111,181,146,173,37,240,141,127,189,192,246,175,
+    65,71,196,13,101,157,70,14,178,164,176,205,156,90,69,210,222,12,235,16,65,238,131,140,
+    230,22,31,83,28,14,219,104,229,199,173,100,74,55,154,201,232,240,200,180,11,159,166,245,
+    159,110,66,99,0,35,210,92,192,252,100,243,154,59,88,215,216,160,3,204,122,206,11,33,
+    212,222,194,14,231,22,174,195,178,136,155,235,100,120,179,197,109,115,74,121,243,156,255,157,
+    6,58,250,216,104,41,23,127,158,233,142,14,129,74,184,112,153,217,252,168,73,79,169,216,
+    166,71,135,66,75,185,248,31,97,237,195,59,199,11,93,236,230,112,221,186,105,252,127,208,
+    68,136,3,176,198,133,202,251,176,24,170,114,137,23,152,201,50,198,67,165,155,205,125,68,
+    141,236,103,121,47,116,203,152,18,153,117,255,36,195,34,43,226,226,127,180,165,145,216,209,
+    226,106,194,233,106,89,3,164,210,15,88,32,253,184,218,55,134,164,55,172,139,159,161,4,
+    46,119,78,228,7,235,207,86,9,215,157,93,93,252,20,5,241,205,63,85,65,92,110,215,
+    33,226,119,135,198,120,55,254,113,149,129,110,236,247,166,191,103,241,203,131,247,217,48,205,
+    38,71,209,4,157,156,179,211,235,67,99,250,138,19,26,6,22,94,5,253,66,183,179,20,
+    102,151,65,202,173,48,187,189,226,222,38,249,213,21,223,85,242,59,24,97,59,113,222,203,
+    46,198,163,201,140,59,71,165,119,118,228,155,56,189,233,116,52,49,82,174,239,93,173,129,
+    131,202,47,218,116,128,35,113,215,102,2,202,175,220,69,152,3,203,47,170,212,69,116,141,
+    0,173,136,177,79,179,241,172,203,104,3,173,220,84,136,247,117,150,13,147,94,95,102,48,
+    194,129,170,225,72,54,163,7,237,227,136,187,93,137,1,77,189,114,208,20,167,34,157,220,
+    204,140,58,198,195,87,177,153,230,32,175,103,103,113,22,254,82,15,122,197,141,125,214,219,
+    234,21,181,213,139,205,180,222,20,47,27,5,138,160,5,115,86,124,180,140,42,158,142,220,
+    22,21,226,213,166,222,80,122,134,228,215,125,151,194,86,207,237,36,59,167,97,40,52,161,
+    226,176,244,106,216,238,13,123,179,57,108,145,229,103,170,62,179,112,77,126,183,181,239,142,
+    246,141,59,244,190,124,240,59,232,238,244,131,110,53,220,16,38,31,209,113,151,61,195,218,
+    101,143,100,224,7,48,229,193,14,227,164,3,47,56,221,73,240,121,241,240,212,11,134,59,
+    116,109,30,14,189,96,240,36,131,207,140,50,224,225,66,165,77,25,158,176,103,39,134,252,
+    166,13,177,193,158,35,83,94,138,17,33,24,199,148,21,157,56,41,102,188,58,118,238,17,
+    57,204,130,129,225,166,42,81,195,216,110,215,67,252,48,142,11,223,67,193,108,187,222,79,
+    194,82,105,89,52,189,27,245,134,179,105,158,57,225,35,68,251,131,49,234,14,7,10,93,
+    117,122,191,144,147,65,188,147,4,177,212,176,187,28,71,195,244,233,156,234,171,224,202,89,
+    96,43,72,170,33,123,195,244,208,233,134,184,192,94,4,87,202,36,228,6,171,73,78,90,
+    169,109,121,129,57,115,98,143,14,232,147,252,4,34,185,38,241,114,239,93,113,248,216,196,
+    93,140,15,93,142,18,253,102,229,152,201,246,61,175,19,138,29,224,167,221,35,84,193,186,
+    244,28,79,72,17,180,57,86,140,149,93,134,242,115,174,62,175,36,217,171,22,68,78,248,
+    156,171,207,43,69,253,150,133,214,52,215,168,113,16,141,53,238,40,48,248,18,78,181,171,
+    232,185,22,125,165,162,175,216,189,39,83,58,50,206,245,117,81,206,37,66,17,183,37,117,
+    122,86,186,226,149,103,180,28,224,173,37,94,224,76,64,196,237,77,178,116,197,243,165,239,
+    117,67,141,126,202,71,126,55,146,34,1,185,85,215,174,233,4,156,190,128,221,69,164,212,
+    5,75,184,185,85,7,14,105,211,81,12,126,233,118,240,107,155,0,1,182,47,58,130,146,
+    191,62,167,221,116,57,208,222,140,196,1,163,35,29,219,171,46,175,198,97,123,175,88,23,
+    89,182,171,122,216,230,195,93,79,209,77,17,214,35,175,58,43,107,86,117,114,131,230,174,
+    212,158,247,176,72,240,207,114,36,110,143,218,196,182,71,131,108,54,153,27,58,99,109,212,
+    98,110,3,158,95,242,84,15,89,102,59,108,163,6,199,12,109,188,124,102,231,214,22,188,
+    83,24,186,101,108,18,183,81,245,217,207,44,183,82,134,91,44,63,182,120,44,170,228,247,
+    167,89,153,55,205,214,59,1,192,131,7,37,106,63,18,235,223,180,54,230,70,210,190,6,
+    54,193,41,64,51,77,240,50,231,158,162,237,227,206,240,86,80,94,211,210,193,108,11,138,
+    156,8,121,223,216,205,92,144,212,206,72,51,230,181,170,179,242,75,29,159,105,156,77,34,
+    102,110,17,229,121,55,76,154,89,212,27,78,243,132,170,118,170,6,223,129,240,19,197,146,
+    48,108,50,32,8,171,116,10,235,156,136,194,42,253,106,247,151,70,11,21,213,5,24,48,
+    95,139,47,227,16,128,29,166,44,204,118,205,140,43,42,238,122,201,149,127,8,20,145,115,
+    46,114,206,181,156,115,45,231,149,200,9,187,237,82,196,153,167,198,178,137,245,188,139,38,
+    209,32,155,229,158,46,50,182,190,139,57,144,172,98,17,27,138,45,46,196,206,156,213,225,
+    7,245,221,91,175,168,62,235,241,190,58,14,161,174,235,25,141,120,95,29,144,80,207,245,
+    140,70,60,240,178,30,114,254,41,186,139,44,24,157,200,177,60,241,81,178,72,37,191,94,
+    241,49,178,72,198,94,192,68,62,23,233,40,240,200,217,195,109,44,105,213,209,61,155,113,
+    49,87,191,133,197,64,14,64,228,240,146,33,242,121,59,97,44,156,46,136,15,254,138,135,
+    128,201,242,105,194,116,21,235,59,17,63,9,131,49,147,94,84,68,204,170,194,163,52,240,
+    179,210,16,159,215,196,194,98,119,162,159,20,84,168,53,61,223,173,196,85,149,109,174,178,
+    129,76,239,72,192,193,241,90,206,50,152,228,44,67,196,166,55,122,101,54,122,165,242,93,
+    25,21,92,169,154,175,172,70,245,36,103,25,34,92,57,129,118,72,248,37,245,218,25,190,
+    208,163,5,117,226,57,154,244,34,219,55,105,126,29,203,216,75,97,104,41,130,252,63,147,
+    34,253,218,70,208,222,9,179,160,77,155,187,174,238,12,194,111,139,183,86,7,48,22,242,
+    216,181,139,199,180,3,192,148,22,51,199,152,43,61,230,10,175,98,99,114,20,67,59,161,
+    68,124,14,195,148,127,226,122,42,47,133,214,228,87,223,63,245,135,158,186,35,98,97,239,
+    73,71,26,10,93,75,67,33,70,130,204,93,93,194,127,83,254,203,87,30,216,196,177,223,
+    14,255,237,242,223,62,255,29,240,223,211,130,249,214,85,39,81,82,170,82,54,75,220,8,
+    66,200,153,125,216,188,57,101,172,62,93,195,169,4,192,19,198,37,102,92,140,113,169,25,
+    151,96,92,166,199,37,120,106,213,214,99,82,188,230,235,152,39,188,176,37,236,134,165,227,
+    186,191,150,161,174,11,16,58,124,182,225,179,205,62,59,240,217,129,79,76,165,76,151,126,
+    155,125,182,225,179,195,62,59,240,185,150,81,174,75,150,4,187,98,246,137,101,49,153,169,
+    69,252,18,1,162,20,90,186,225,113,206,61,131,43,223,169,233,62,10,95,185,197,178,167,
+    80,239,41,212,127,90,187,82,175,134,66,65,117,73,105,175,251,183,89,211,52,206,121,171,
+    21,77,248,130,98,151,166,121,241,95,247,64,100,193,119,35,75,151,92,91,236,89,139,26,
+    33,185,57,86,94,97,8,37,208,131,167,120,105,215,27,118,138,22,147,98,39,81,183,16,
+    5,204,70,110,198,222,126,228,217,51,68,174,65,129,88,121,240,73,17,145,137,118,59,145,
+    151,187,99,142,205,229,169,96,103,66,215,238,230,134,153,118,43,108,191,108,78,97,33,72,
+    185,55,249,215,254,153,91,47,74,238,128,236,118,88,219,185,125,185,91,55,77,12,202,49,
+    99,61,75,255,61,113,141,95,17,119,98,207,227,148,80,11,138,132,49,181,154,250,218,138,
+    169,45,61,166,148,31,123,100,150,124,99,81,90,233,28,69,155,5,69,105,205,93,220,234,
+    198,205,69,139,90,221,212,139,146,68,177,116,95,183,110,46,90,212,234,118,65,209,37,250,
+    250,240,230,162,238,86,117,43,117,118,164,231,218,39,149,92,198,195,230,238,249,230,93,248,
+    130,235,64,172,131,165,203,225,242,196,198,197,136,71,254,152,51,105,216,95,248,2,173,16,
+    116,117,211,70,97,211,200,56,71,188,212,1,167,206,124,63,22,56,107,215,236,190,88,123,
+    129,186,166,219,77,197,41,100,43,178,48,30,123,26,107,75,213,185,105,22,226,22,27,61,
+    25,242,221,127,182,211,14,50,216,99,39,74,67,8,182,199,46,25,253,56,59,241,204,94,
+    170,171,120,199,33,230,221,143,30,75,238,179,199,69,150,164,12,30,233,52,206,164,146,130,
+    115,192,250,147,80,43,124,189,204,206,61,143,21,13,50,111,71,175,111,213,168,187,112,253,
+    117,215,110,84,187,102,212,84,188,59,51,245,138,89,254,170,141,18,129,184,27,187,18,175,
+    198,75,237,84,109,120,196,32,46,218,177,217,58,22,122,215,153,248,163,195,2,192,148,204,
+    129,42,148,179,148,46,88,97,47,35,235,118,221,37,87,112,204,222,90,32,147,146,88,144,
+    60,41,32,5,188,95,33,73,73,239,161,174,197,225,199,246,97,173,86,154,221,24,24,200,
+    81,130,136,46,108,217,195,117,227,185,174,236,178,89,201,205,231,211,31,165,94,159,6,150,
+    110,122,139,201,230,113,169,209,35,77,71,161,80,93,94,31,81,203,219,125,160,147,198,42,
+    187,203,122,29,49,23,137,111,135,168,163,157,123,116,172,120,221,17,77,220,114,169,225,197,
+    244,85,133,119,29,23,28,206,155,66,131,217,228,22,156,23,203,44,56,124,91,110,44,56,
+    98,235,237,88,114,164,97,214,180,200,4,143,87,72,30,216,72,7,196,170,51,117,46,99,
+    204,77,205,222,48,125,54,26,195,220,142,38,174,185,120,51,192,107,177,244,115,203,51,22,
+    92,211,233,173,76,139,54,16,139,188,194,251,153,247,13,93,250,106,219,208,12,112,192,93,
+    17,199,230,22,54,245,140,249,104,136,51,238,158,179,93,238,253,173,127,5,158,39,116,92,
+    74,132,153,40,85,39,49,150,2,97,241,99,171,141,117,189,118,211,165,39,143,204,233,149,
+    153,173,230,204,94,10,212,21,85,126,241,98,46,175,159,229,207,61,151,123,243,146,169,87,
+    194,60,255,86,75,70,83,134,235,221,252,114,105,170,226,153,43,144,148,48,214,34,185,240,
+    112,151,200,119,218,226,179,85,176,92,211,235,184,195,46,95,159,45,246,192,172,185,59,226,
+    41,253,57,185,40,31,244,134,183,187,241,150,253,75,110,232,159,209,196,162,14,38,162,131,
+    252,13,242,90,154,245,103,120,46,40,204,159,180,129,77,61,225,5,45,147,143,173,58,59,
+    11,115,25,26,156,201,157,102,194,143,45,120,244,181,184,165,202,194,210,154,136,205,113,161,
+    170,65,67,222,122,230,255,82,169,63,201,208,58,60,179,107,78,115,163,144,49,116,203,38,
+    205,227,107,19,241,166,200,150,39,65,86,133,112,66,151,79,207,134,74,109,190,254,4,72,
+    175,190,19,125,255,94,127,18,225,215,109,229,55,26,193,188,248,86,60,111,10,11,39,5,
+    235,194,18,114,136,32,35,163,138,219,220,146,71,203,206,19,57,190,104,149,186,240,48,68,
+    95,95,166,145,219,244,33,13,211,239,223,201,21,168,238,196,13,247,69,66,32,53,58,20,
+    89,219,102,200,151,26,84,111,248,89,72,29,43,146,90,70,197,195,236,185,21,104,145,164,
+    195,75,175,105,206,230,221,139,240,34,193,135,195,170,11,62,188,14,20,124,36,132,97,104,
+    50,229,156,240,211,79,23,9,63,194,21,28,27,142,14,171,12,145,153,77,131,14,158,33,
+    9,241,162,131,167,66,66,55,173,131,231,60,124,119,12,129,141,19,49,95,33,176,201,3,
+    25,136,143,29,60,94,97,23,223,63,228,166,119,225,2,174,180,150,52,224,241,30,62,216,
+    230,174,193,208,239,152,88,219,89,50,94,195,47,240,170,91,196,68,100,221,145,211,47,107,
+    202,188,196,101,204,105,101,155,121,144,235,48,159,113,93,230,180,178,207,252,201,13,152,151,
+    214,83,114,238,229,15,225,231,49,250,100,77,208,222,208,159,224,111,3,189,178,38,104,121,
+    234,159,227,239,6,250,101,77,200,121,57,186,186,108,108,49,95,172,53,67,20,173,180,215,
+    34,127,176,214,241,39,107,167,126,178,246,213,36,237,152,31,236,233,249,171,144,191,10,249,
+    171,144,191,154,203,223,204,231,79,33,127,23,242,15,33,255,185,157,127,35,15,79,9,10,
+    172,65,129,53,40,176,150,43,176,153,47,144,65,254,62,228,31,67,254,75,59,255,86,30,
+    32,200,95,133,252,85,200,95,181,242,155,58,75,146,157,230,85,64,20,43,218,119,62,95,
+    200,246,190,177,82,10,25,158,245,251,184,94,215,98,227,108,252,193,3,92,185,6,227,179,
+    89,102,31,154,7,66,169,205,42,98,31,241,25,90,22,166,118,143,125,24,16,217,235,223,
+    225,120,210,43,114,206,236,238,152,220,95,41,117,161,64,238,170,148,213,101,227,209,246,214,
+    230,195,237,32,250,97,96,75,203,30,177,104,83,141,31,205,69,161,148,22,229,137,91,74,
+    179,60,13,82,225,96,48,61,201,173,228,137,183,19,185,220,13,22,172,223,75,62,135,165,
+    248,78,106,0,156,17,68,25,29,251,113,101,162,244,56,59,9,200,223,206,78,91,94,115,
+    239,38,236,144,187,149,176,3,224,32,118,100,192,132,22,207,24,144,223,27,149,97,206,107,
+    152,243,26,230,80,67,62,3,38,240,26,230,1,218,106,104,25,174,120,13,87,188,134,43,
+    168,33,159,1,19,120,13,87,252,102,184,237,144,131,131,182,35,58,102,162,229,147,82,7,
+    100,166,39,109,199,93,238,98,173,158,155,89,59,85,79,252,221,33,154,231,7,157,59,79,
+    252,24,126,139,208,251,220,32,26,127,105,79,162,14,114,242,214,202,255,233,181,211,172,93,
+    254,112,184,255,101,239,224,221,175,123,175,247,222,253,107,248,175,89,218,107,183,207,166,217,
+    179,81,127,52,169,69,229,213,176,204,245,239,155,207,43,101,170,230,117,52,246,203,231,31,
+    206,203,94,173,19,252,107,248,127,64,114,236,181,255,53,92,241,101,35,227,104,50,189,185,
+    165,179,97,15,221,69,129,28,52,24,247,179,73,243,185,172,62,95,235,44,155,206,242,53,
+    82,109,71,251,135,71,88,93,175,93,174,148,45,232,119,84,150,178,7,137,211,36,154,164,
+    102,237,163,98,172,188,229,128,182,251,163,104,86,142,6,113,15,178,188,77,146,254,25,186,
+    47,42,135,208,158,142,155,145,64,76,19,48,51,41,175,149,27,181,58,180,186,202,82,94,
+    193,252,27,78,123,179,121,185,138,9,1,86,204,95,187,201,210,3,52,139,0,46,146,210,
+    19,139,207,89,39,16,247,118,163,84,12,96,44,51,87,76,105,133,32,221,127,243,17,64,
+    133,182,30,60,80,9,239,126,253,124,248,234,217,222,65,217,195,50,162,23,32,161,189,249,
+    8,160,79,35,128,27,183,202,24,83,41,11,86,207,231,130,175,34,208,44,227,121,111,2,
+    149,123,1,171,168,0,234,195,113,150,156,129,76,140,96,243,85,65,68,73,240,43,172,125,
+    63,215,47,31,157,63,103,147,30,158,32,241,66,239,71,103,157,46,76,128,41,111,88,140,
+    153,26,187,18,27,188,5,212,246,182,152,212,70,140,206,84,26,31,101,99,172,36,169,172,
+    248,113,214,233,13,191,160,226,99,118,217,90,249,215,240,60,75,54,202,210,231,89,150,2,
+    78,49,170,82,22,10,137,4,54,47,199,176,106,151,30,209,202,204,132,124,89,156,101,21,
+    133,167,105,123,218,90,97,160,141,145,85,128,120,76,104,151,32,30,141,94,77,112,153,64,
+    102,240,34,34,127,67,228,226,5,189,106,243,62,245,177,128,120,210,199,183,83,147,179,217,
+    168,221,46,76,78,179,36,154,239,95,50,9,4,168,224,27,155,107,21,43,225,73,185,78,
+    212,14,201,26,121,150,21,25,30,124,254,242,236,237,251,247,251,207,142,190,28,188,122,249,
+    235,209,161,69,151,188,253,23,81,191,15,224,0,58,112,246,172,151,241,18,9,80,122,81,
+    177,123,97,193,229,99,251,13,73,163,172,82,40,44,10,60,163,94,50,4,65,229,80,99,
+    179,162,77,2,108,108,13,99,55,173,134,0,4,19,65,56,17,180,169,64,235,164,13,252,
+    106,81,203,68,79,253,105,102,148,166,222,41,80,214,110,104,191,202,248,74,14,3,26,91,
+    251,215,236,154,177,23,170,159,113,155,107,78,116,79,223,63,127,241,133,115,152,47,7,48,
+    15,129,38,53,138,161,60,58,23,21,67,206,43,131,1,124,245,238,253,91,24,208,47,239,
+    94,65,71,245,172,90,43,47,190,28,38,221,126,47,57,181,171,22,179,155,10,228,137,109,
+    52,59,248,85,180,200,162,218,147,108,58,204,112,126,100,151,99,24,51,64,208,86,109,11,
+    228,179,13,108,157,242,175,149,183,107,143,31,109,52,182,137,219,242,58,2,13,104,49,190,
+    70,227,148,89,212,94,53,211,88,79,24,0,47,191,188,124,249,233,203,225,160,55,235,230,
+    102,22,173,77,174,94,188,57,112,198,126,52,251,22,53,37,41,82,77,28,106,150,216,193,
+    62,83,85,8,29,222,140,98,254,170,236,12,4,176,7,172,56,203,231,153,21,156,243,10,
+    62,46,89,193,71,89,129,162,28,160,191,10,130,178,138,213,121,5,120,121,54,154,76,50,
+    60,29,72,255,92,12,157,75,12,173,222,178,131,22,138,63,46,89,193,129,141,161,122,109,
+    75,48,41,128,166,10,53,250,229,253,119,135,175,14,222,190,49,177,245,28,177,117,11,236,
+    252,122,11,60,164,217,112,52,144,233,162,244,106,153,122,35,196,16,93,234,112,206,100,200,
+    187,46,170,160,10,61,155,107,136,229,220,234,202,171,97,66,47,50,208,186,4,17,90,72,
+    235,26,87,225,239,37,220,187,170,148,48,252,91,113,136,137,146,10,12,252,16,82,4,10,
+    38,150,232,64,245,118,163,126,27,5,153,176,172,54,205,38,180,181,84,188,112,141,35,153,
+    19,128,116,140,19,45,220,44,69,21,85,239,229,106,251,33,153,76,39,155,155,171,17,136,
+    200,149,62,112,148,46,232,65,190,22,198,246,161,2,141,245,91,67,169,115,102,206,67,32,
+    127,1,31,225,83,131,115,10,62,123,181,162,207,161,40,159,84,90,86,139,241,191,160,89,
+    240,18,254,62,215,200,185,89,62,56,122,246,229,195,185,189,54,189,177,73,241,227,205,228,
+    199,210,89,226,193,135,163,47,135,175,254,216,47,3,104,219,155,124,182,229,50,192,132,219,
+    167,189,131,204,46,166,232,186,140,114,150,124,250,106,239,16,171,102,60,199,200,186,144,142,
+    160,91,31,245,97,106,150,207,206,153,184,169,79,21,159,51,64,198,249,76,110,73,249,225,
+    207,170,214,131,170,132,73,71,248,217,185,206,244,16,205,207,250,189,241,56,75,217,241,199,
+    11,32,193,156,144,74,168,110,155,243,25,25,51,191,64,196,36,189,9,98,182,32,165,1,
+    52,184,110,183,107,87,132,186,10,133,184,104,68,178,168,198,190,16,144,253,180,147,177,171,
+    217,98,40,206,27,54,9,224,102,78,7,236,146,173,24,21,202,138,137,26,254,231,144,134,
+    58,40,144,73,143,142,104,204,30,109,109,110,60,126,180,69,171,75,189,182,249,120,123,171,
+    177,133,33,20,91,55,183,154,245,109,232,207,156,216,246,92,43,27,67,217,141,218,102,227,
+    225,214,227,205,58,149,221,172,53,182,27,219,15,155,155,16,202,231,199,129,138,0,27,177,
+    22,71,239,76,126,153,246,134,244,65,164,119,41,229,245,93,40,210,34,146,90,101,207,240,
+    76,51,70,7,132,102,70,12,151,144,118,233,151,27,217,218,67,146,126,215,202,231,250,128,
+    176,171,111,137,16,200,108,182,104,143,195,121,212,63,35,234,188,197,236,163,136,119,90,4,
+    108,23,55,202,131,87,195,115,59,19,50,168,103,163,209,36,157,30,151,55,203,39,98,244,
+    248,240,66,239,245,12,13,200,176,102,196,212,203,39,138,157,157,55,173,252,27,139,243,147,
+    228,46,247,115,22,94,2,185,113,66,242,209,178,250,229,119,249,74,1,238,29,62,68,226,
+    93,100,218,30,10,202,230,45,30,65,229,71,77,10,31,53,204,165,237,35,84,250,134,201,
+    195,21,196,229,27,57,157,143,176,91,107,2,62,192,251,145,216,56,49,172,2,205,132,132,
+    91,28,74,241,228,207,107,72,170,16,218,43,188,85,189,74,2,38,81,104,231,12,76,117,
+    39,164,106,145,27,219,29,93,131,238,123,70,254,70,97,254,134,51,127,179,48,127,211,153,
+    127,163,48,255,134,51,63,131,95,67,173,158,224,2,221,145,181,145,203,218,44,202,218,204,
+    101,221,40,202,186,33,179,50,122,181,216,155,60,84,48,168,198,204,82,13,23,114,71,217,
+    81,223,209,149,187,85,214,208,43,107,254,96,101,77,189,178,141,31,172,108,67,175,76,13,
+    46,95,250,179,233,89,31,103,198,194,85,45,215,176,177,118,177,209,224,53,45,148,175,191,
+    236,15,207,123,147,17,189,253,81,249,179,164,232,31,22,68,89,51,0,192,102,57,169,51,
+    234,219,172,160,124,227,195,31,32,194,230,195,45,246,181,245,176,73,171,116,179,233,40,217,
+    144,37,27,148,105,179,9,165,96,41,218,228,181,108,170,65,222,44,35,145,171,238,172,98,
+    187,85,168,66,95,127,235,80,2,230,123,111,8,168,175,225,98,134,47,122,240,227,132,181,
+    242,227,90,243,17,99,147,76,226,97,233,80,201,164,54,87,34,211,222,83,41,50,173,49,
+    80,26,4,8,110,156,176,126,204,126,117,161,143,181,121,216,176,10,53,80,173,240,51,55,
+    183,209,79,251,189,225,240,93,119,52,236,124,121,53,24,131,228,220,3,156,155,167,46,245,
+    90,115,203,220,77,170,66,185,77,229,180,219,27,246,152,72,183,104,99,89,176,13,172,168,
+    242,16,66,193,160,42,15,178,233,164,138,42,241,181,92,197,116,236,4,242,79,221,46,106,
+    80,106,114,192,125,111,5,255,91,238,186,220,100,151,219,97,233,99,168,81,214,114,155,45,
+    222,222,203,79,242,48,255,104,68,21,138,99,203,28,241,118,58,151,239,109,230,36,79,241,
+    154,116,30,197,246,248,70,70,18,163,235,120,254,11,19,186,169,132,127,86,167,209,226,209,
+    72,7,39,215,126,172,231,181,0,96,130,113,147,31,138,153,57,171,172,89,209,240,138,95,
+    138,207,6,227,197,215,19,79,63,188,126,87,120,65,129,197,221,87,20,152,66,74,201,138,
+    59,165,191,166,151,243,47,237,11,244,213,255,141,29,46,179,248,195,163,148,118,44,47,82,
+    144,230,233,206,46,176,146,231,44,121,110,38,179,150,126,237,163,28,43,219,67,113,80,221,
+    119,113,0,197,85,224,165,81,50,125,122,185,100,201,42,7,18,106,128,177,131,22,173,122,
+    230,183,170,103,158,171,71,173,188,120,176,245,20,159,23,133,58,89,63,175,229,20,194,7,
+    77,206,38,49,87,202,157,196,21,206,92,206,38,237,47,32,253,250,90,16,39,52,133,57,
+    218,203,58,202,65,6,59,236,117,6,209,39,41,122,49,212,139,138,0,56,60,185,55,227,
+    230,142,184,43,237,150,65,171,247,179,94,239,220,81,239,220,81,239,124,97,189,111,144,253,
+    136,142,233,41,239,27,218,38,134,181,238,99,118,163,248,251,166,150,9,182,18,162,251,38,
+    33,181,159,103,51,185,113,102,57,124,172,223,132,228,229,36,194,107,52,210,227,98,69,216,
+    41,38,161,153,22,110,40,82,229,193,57,6,155,246,77,140,198,207,105,39,46,107,145,61,
+    196,221,43,53,36,73,64,187,80,76,80,172,235,1,71,100,119,239,230,180,45,191,249,240,
+    250,203,179,131,87,244,198,224,151,119,7,123,111,246,15,113,31,45,69,17,42,196,238,42,
+    199,88,48,42,159,13,39,163,126,255,75,127,52,26,19,95,5,65,0,153,59,240,27,60,
+    19,8,224,103,167,252,225,205,171,183,111,236,122,49,169,90,85,164,69,85,35,166,57,128,
+    239,152,94,23,228,58,225,8,96,215,223,132,224,143,176,76,189,19,110,81,24,84,181,203,
+    57,142,252,19,30,186,48,110,195,249,68,192,46,58,129,1,32,29,93,103,205,198,163,81,
+    159,65,69,87,160,179,201,89,198,1,42,192,129,141,133,194,238,59,27,181,241,178,12,102,
+    64,184,148,240,221,14,69,15,30,136,174,241,170,174,53,92,139,74,77,76,58,110,169,109,
+    162,202,47,8,139,40,11,147,127,113,221,234,35,116,70,194,219,55,47,197,157,234,121,52,
+    153,67,139,252,8,75,239,172,1,164,90,89,152,224,109,161,208,5,213,137,161,61,225,236,
+    154,184,229,94,208,177,28,236,55,119,106,97,151,138,33,250,73,192,232,237,211,97,202,224,
+    92,4,145,142,2,147,0,80,16,115,139,0,207,222,30,188,125,159,83,187,153,116,98,212,
+    162,56,23,119,145,66,7,129,85,84,44,80,200,218,76,100,153,213,16,150,84,69,26,130,
+    110,85,141,168,100,97,121,214,29,156,88,168,19,194,191,141,42,6,131,209,16,10,51,36,
+    151,97,7,178,81,107,108,54,182,30,55,183,183,54,182,30,67,78,153,210,44,111,195,78,
+    109,163,241,104,107,163,254,176,241,72,79,250,242,235,222,193,11,216,165,108,61,172,63,124,
+    188,189,209,220,126,248,120,83,43,107,110,113,234,53,168,99,163,254,248,209,163,109,189,22,
+    35,83,19,114,1,16,141,173,205,199,155,42,203,193,219,151,77,104,101,115,179,185,253,120,
+    75,69,139,251,190,70,182,182,173,98,165,68,31,121,101,230,231,0,95,201,1,49,213,103,
+    219,41,149,243,162,219,155,101,168,228,217,239,209,110,31,10,200,11,107,185,45,136,112,221,
+    22,2,45,147,128,45,201,245,18,185,162,56,44,188,92,189,12,202,215,90,254,141,27,243,
+    219,37,54,11,74,240,111,92,247,169,140,168,161,185,122,217,212,106,64,183,86,248,10,162,
+    181,93,75,132,78,129,40,71,252,56,97,91,21,113,88,181,1,255,145,156,130,213,117,97,
+    15,52,22,231,22,209,48,53,107,164,203,12,227,46,70,207,143,167,221,141,102,237,241,163,
+    199,143,124,58,75,127,248,168,214,220,216,128,109,34,124,111,110,60,220,122,84,219,218,220,
+    218,32,166,168,151,75,165,180,114,118,14,36,235,115,241,49,242,241,149,35,16,170,166,56,
+    233,7,35,128,37,133,77,43,16,149,177,17,130,185,153,204,42,248,232,246,116,136,178,71,
+    194,55,5,76,195,219,218,0,127,211,142,79,217,252,226,65,185,235,163,40,90,103,207,123,
+    211,94,76,114,255,117,32,171,123,111,168,99,105,245,25,202,100,118,189,98,143,174,226,45,
+    237,179,124,130,86,68,107,62,183,81,87,0,140,245,53,135,98,152,120,166,29,88,178,13,
+    53,175,209,84,169,122,46,250,95,209,244,82,38,62,63,252,223,44,51,101,92,107,139,166,
+    201,127,21,145,99,149,31,38,81,105,118,164,238,177,197,94,59,184,224,119,31,71,247,215,
+    122,174,209,85,89,40,215,58,183,228,122,59,100,182,47,162,197,49,170,118,250,101,35,200,
+    243,104,177,24,228,151,14,230,105,158,208,24,226,164,172,101,244,89,93,164,242,164,234,52,
+    169,120,77,85,176,106,52,82,101,133,244,29,246,20,8,250,109,155,1,95,254,81,232,197,
+    110,155,182,1,12,114,7,176,190,85,84,71,103,31,95,169,196,212,87,66,233,185,98,131,
+    129,198,83,10,10,44,240,92,157,178,220,21,100,163,26,182,117,113,35,94,32,124,77,7,
+    135,174,49,243,5,204,74,61,82,229,208,74,177,110,211,197,141,117,87,99,221,149,9,88,
+    89,214,1,59,89,128,95,113,191,193,152,239,128,130,120,62,58,160,147,122,254,213,196,47,
+    78,31,84,166,145,47,51,151,101,230,178,204,92,47,211,204,151,185,146,101,174,100,153,43,
+    147,14,25,168,146,212,16,29,209,228,104,244,30,21,5,122,231,217,193,217,160,55,68,42,
+    45,92,105,36,183,185,32,239,227,83,237,86,164,217,104,110,227,244,124,216,216,98,231,209,
+    15,229,129,180,190,60,241,130,62,151,97,80,60,83,231,60,201,89,156,125,57,59,255,194,
+    213,98,97,144,242,194,25,83,208,253,114,244,249,29,72,71,31,158,238,127,249,240,81,173,
+    255,88,193,135,143,95,248,193,6,122,7,42,87,26,245,230,102,173,14,11,62,18,126,39,
+    155,189,136,18,122,28,76,177,37,115,141,208,187,9,27,95,69,47,236,70,90,229,99,183,
+    144,80,105,59,34,206,176,214,144,247,146,122,185,26,222,16,27,17,87,106,211,5,153,23,
+    231,157,139,125,8,176,34,214,76,106,100,70,126,184,11,227,223,42,111,240,141,149,82,138,
+    116,20,153,203,34,13,40,178,169,118,172,100,130,89,0,212,213,109,128,186,146,45,52,161,
+    133,173,31,2,74,8,1,80,128,209,136,53,206,131,232,242,96,148,78,27,229,114,165,63,
+    234,52,43,249,225,95,197,227,126,143,169,133,120,185,242,244,18,233,51,148,40,203,21,186,
+    195,168,108,147,172,136,153,129,231,52,225,199,227,106,46,175,123,227,131,236,60,235,191,26,
+    182,71,252,68,11,254,248,246,37,16,229,241,23,95,13,77,233,248,141,43,97,218,61,89,
+    179,234,50,78,184,181,99,90,126,16,41,51,27,249,230,86,190,185,157,143,81,188,118,156,
+    153,37,120,176,195,207,5,245,118,244,252,218,249,166,153,127,110,231,231,112,208,213,240,37,
+    103,221,41,158,23,178,179,53,10,2,103,195,51,70,94,34,165,115,7,148,237,83,146,234,
+    253,252,24,233,85,15,248,112,112,29,158,213,50,141,127,106,223,16,54,43,236,253,30,145,
+    29,26,103,18,165,140,240,22,17,86,243,102,186,106,58,233,42,25,31,25,44,136,206,185,
+    243,181,8,226,226,15,15,124,248,104,177,162,197,228,37,251,192,23,35,133,18,51,63,204,
+    46,187,91,107,176,55,36,190,81,67,206,33,74,90,138,54,13,156,12,171,238,62,169,243,
+    114,164,98,216,254,38,167,116,40,196,110,2,45,125,40,14,181,4,208,80,160,130,122,191,
+    152,117,176,210,66,143,75,75,211,224,131,77,213,161,54,141,120,6,58,216,212,195,186,62,
+    143,152,118,86,131,236,22,211,138,155,211,125,93,115,203,164,184,183,236,129,21,36,185,135,
+    91,171,21,182,175,204,21,245,28,245,93,170,141,71,252,62,155,210,21,170,24,45,172,142,
+    233,183,9,8,89,158,7,15,202,21,22,179,83,142,80,187,40,130,161,154,234,151,21,27,
+    229,137,194,35,123,253,197,94,147,156,235,157,181,132,113,26,75,198,239,20,82,27,226,122,
+    72,221,142,224,186,198,106,5,136,229,2,38,21,35,180,101,201,47,175,105,235,129,175,115,
+    122,113,198,60,18,168,164,193,6,4,84,37,126,125,196,46,195,161,0,200,44,85,163,123,
+    12,129,34,25,183,131,115,113,85,98,74,196,91,75,156,222,139,198,162,94,204,117,184,47,
+    245,192,149,187,19,52,52,90,55,202,127,90,63,154,139,250,113,85,216,143,130,193,192,214,
+    255,186,190,108,220,64,89,63,70,88,63,216,7,198,46,151,232,197,230,109,40,107,237,46,
+    164,245,51,123,178,144,152,214,238,133,154,126,18,248,166,30,194,68,231,111,176,236,102,125,
+    141,131,111,221,188,180,77,233,150,99,82,155,95,1,47,164,59,48,212,102,193,77,163,190,
+    68,121,76,183,67,21,139,163,41,178,80,142,7,145,89,111,223,16,83,40,123,181,60,101,
+    10,35,196,127,217,197,251,106,174,76,161,160,178,113,179,160,178,65,130,10,93,78,240,100,
+    93,228,144,134,136,207,11,101,15,83,136,149,209,31,35,67,226,88,181,33,211,151,24,188,
+    5,101,2,153,94,220,88,133,72,77,180,161,153,88,240,209,195,146,36,185,229,75,18,210,
+    129,186,80,52,135,108,134,164,238,234,215,164,225,151,157,114,51,95,151,177,160,33,57,244,
+    177,186,186,150,120,105,39,54,72,199,154,114,41,200,205,148,6,136,97,91,36,116,109,17,
+    241,178,72,149,177,142,122,117,164,88,197,48,84,102,170,24,91,40,48,111,233,58,135,120,
+    76,251,165,81,103,139,59,31,195,162,110,178,154,53,21,47,218,117,83,225,108,120,254,58,
+    66,186,207,250,71,163,3,58,9,168,40,133,0,150,234,179,166,60,179,237,230,18,109,55,
+    139,218,110,222,170,237,166,214,246,166,82,27,28,160,15,23,214,19,95,84,235,151,103,182,
+    244,191,89,97,37,240,148,129,54,21,98,14,169,251,36,152,77,17,228,176,140,74,109,131,
+    84,169,135,60,212,188,200,192,252,212,173,78,3,178,214,196,19,138,23,7,175,222,125,57,
+    124,245,124,255,57,29,215,56,170,89,203,87,110,220,41,225,195,103,125,88,74,240,224,67,
+    234,189,56,110,135,158,191,58,124,119,176,247,108,255,245,254,155,163,66,237,23,189,50,183,
+    22,140,158,67,201,123,197,121,158,246,162,233,66,120,151,3,85,183,248,173,26,250,99,134,
+    53,47,83,92,208,116,85,172,14,249,116,109,65,98,124,174,35,168,226,96,1,110,88,119,
+    2,5,100,131,222,116,218,59,207,10,109,215,247,95,191,58,60,124,245,113,159,67,77,148,
+    40,10,49,133,68,195,174,95,36,41,125,30,194,166,81,130,142,189,66,61,171,57,23,172,
+    250,61,204,207,206,254,70,179,168,191,207,19,223,115,83,101,188,223,204,85,111,116,82,239,
+    99,241,149,167,213,209,60,37,105,240,154,213,15,147,17,250,37,209,235,45,151,59,253,47,
+    47,32,40,80,36,14,27,223,158,205,198,103,51,234,111,197,204,195,236,180,85,101,22,164,
+    124,241,58,224,245,8,84,177,51,202,205,50,154,66,100,214,33,50,197,201,195,236,205,242,
+    203,104,48,136,10,138,250,154,226,28,102,19,58,199,102,133,116,17,65,186,155,84,8,111,
+    31,196,93,155,89,10,184,54,203,113,161,29,167,43,232,9,146,251,134,128,109,218,150,130,
+    99,250,254,229,211,37,113,72,13,34,199,213,91,165,107,117,88,158,30,111,62,124,180,253,
+    176,249,248,209,54,19,116,152,130,252,86,179,177,209,124,88,111,108,82,243,20,219,172,109,
+    234,208,136,242,245,135,15,55,30,63,222,120,84,127,36,50,246,81,179,177,27,13,247,209,
+    125,149,214,156,186,210,172,111,214,55,183,152,237,248,77,104,198,110,222,177,123,170,189,205,
+    198,246,246,54,23,244,0,197,91,91,168,247,36,187,186,101,119,10,47,73,155,183,232,77,
+    125,163,177,81,127,180,184,63,208,141,253,219,12,151,14,15,63,146,161,152,8,79,53,183,
+    182,216,33,103,243,17,179,240,106,24,22,94,10,121,216,104,65,99,210,39,128,116,168,36,
+    142,250,232,15,111,94,244,165,163,186,21,27,7,132,237,253,203,177,60,247,43,211,227,219,
+    236,32,207,172,154,208,178,70,240,2,180,205,135,82,26,42,232,243,58,239,51,85,15,69,
+    249,87,85,116,25,50,48,36,88,40,126,125,51,107,0,184,222,227,129,228,2,172,227,133,
+    228,170,28,197,85,89,100,33,162,95,47,223,164,138,125,249,84,96,157,183,236,235,161,142,
+    134,115,3,235,175,203,244,159,196,59,175,106,93,131,84,233,86,80,57,94,66,150,163,129,
+    122,45,105,73,34,116,241,160,176,34,170,59,62,132,173,17,120,126,47,35,192,232,158,93,
+    91,243,204,235,26,168,98,42,44,38,253,231,127,226,136,60,23,152,21,83,72,0,205,234,
+    212,135,226,185,57,20,250,134,225,185,26,8,189,196,2,4,61,167,191,12,51,235,122,183,
+    0,53,82,241,156,93,5,210,85,103,114,48,234,28,156,157,191,102,38,95,236,218,175,89,
+    127,236,147,158,201,227,186,79,204,242,209,38,254,54,26,27,143,240,119,251,225,35,138,127,
+    184,209,120,204,28,139,212,155,60,157,226,155,143,183,31,83,75,230,226,78,237,228,153,143,
+    118,53,247,105,252,229,243,151,79,159,255,64,6,162,247,74,192,72,125,215,51,33,110,101,
+    152,243,95,212,51,34,107,76,254,87,223,109,156,191,167,205,3,139,96,223,48,183,161,34,
+    89,9,6,215,181,224,149,54,164,7,120,4,192,118,241,196,209,84,174,57,57,16,64,46,
+    102,84,125,33,119,184,7,252,56,68,164,160,198,23,68,2,203,230,183,25,178,200,42,13,
+    157,231,173,179,223,245,252,36,148,125,112,14,228,43,166,169,161,198,115,27,150,163,6,218,
+    6,53,107,15,235,184,38,175,53,106,15,31,63,222,166,143,141,13,220,101,109,212,96,4,
+    97,40,215,182,106,15,31,54,201,170,104,67,100,173,63,122,212,196,221,234,118,115,251,145,
+    54,168,212,214,13,203,151,134,53,54,154,87,146,189,84,5,51,13,242,131,111,142,50,29,
+    28,177,139,60,194,23,97,153,38,69,141,111,68,181,193,50,70,114,46,249,194,220,202,119,
+    41,33,194,29,134,61,216,236,34,144,205,123,149,102,80,162,64,114,126,50,34,69,158,211,
+    252,134,121,97,114,35,220,152,12,207,139,247,36,116,9,238,116,96,197,45,33,0,175,223,
+    191,155,41,111,222,190,127,189,119,144,79,51,213,93,233,190,63,26,100,19,16,148,63,210,
+    62,206,180,237,57,39,159,125,82,97,115,141,103,126,167,187,106,146,21,93,96,94,185,237,
+    93,160,24,36,76,123,80,139,137,111,175,69,69,230,189,255,235,183,207,247,191,188,223,127,
+    113,176,255,236,232,213,219,55,226,78,89,63,196,250,152,37,100,107,76,129,138,213,25,223,
+    128,73,182,161,223,79,59,235,162,153,185,168,46,95,228,130,254,188,143,224,175,86,185,80,
+    17,214,154,201,55,114,206,181,207,44,181,226,2,181,7,89,203,38,158,166,88,251,80,60,
+    153,169,148,197,57,10,147,52,219,253,222,120,159,98,240,232,85,54,140,75,148,22,154,43,
+    163,6,0,86,167,45,29,128,253,127,126,120,245,126,255,153,70,51,77,190,77,252,240,209,
+    244,108,198,186,166,145,143,22,47,240,35,74,210,236,141,80,215,79,72,38,58,96,62,187,
+    151,247,181,83,87,83,25,181,42,79,97,181,42,145,120,163,89,52,52,234,186,50,186,124,
+    153,175,171,105,84,86,128,100,218,236,115,20,139,246,110,70,221,225,187,95,247,223,239,11,
+    204,221,2,75,6,193,192,44,49,11,84,244,153,35,180,244,84,45,166,178,158,182,83,211,
+    69,61,189,169,155,58,172,1,130,171,160,176,110,164,243,202,32,79,234,70,117,12,56,101,
+    71,173,104,93,203,228,58,34,84,149,120,65,126,106,60,61,216,127,243,28,213,209,95,127,
+    56,56,122,245,238,224,51,191,82,56,155,117,70,189,97,135,169,116,178,179,195,178,17,233,
+    155,65,220,50,13,149,186,181,47,141,0,15,97,184,208,141,134,154,63,189,115,116,66,184,
+    104,204,21,80,175,62,137,65,95,6,162,159,0,193,222,243,231,110,8,170,161,209,28,42,
+    118,44,110,175,200,58,131,175,88,14,163,12,183,139,69,115,17,210,93,44,154,103,143,185,
+    182,205,100,70,42,121,71,131,242,64,54,191,98,22,218,40,84,238,105,49,117,91,143,24,
+    75,231,109,248,188,117,22,135,252,157,119,219,158,108,142,83,59,61,159,109,172,194,247,225,
+    114,109,48,208,139,122,4,32,163,188,214,213,67,238,79,222,88,48,252,14,2,208,87,214,
+    28,131,49,144,236,90,70,11,136,212,113,78,253,19,37,171,27,73,97,137,14,45,135,25,
+    187,211,188,207,127,110,119,77,57,49,100,178,146,101,217,147,23,137,22,137,158,185,26,238,
+    75,250,204,221,198,252,128,32,202,71,235,199,36,80,163,146,123,18,61,115,51,161,61,234,
+    104,110,84,53,162,120,241,246,229,191,134,144,250,60,27,3,239,15,203,107,154,69,150,110,
+    114,132,21,20,205,35,170,163,92,22,148,204,249,12,175,211,184,61,192,90,156,155,28,170,
+    66,162,29,66,95,246,63,189,107,26,182,176,163,142,244,206,98,155,254,72,167,20,212,40,
+    115,23,188,234,8,140,105,121,211,62,201,52,201,203,139,49,249,38,167,131,209,104,214,157,
+    206,50,16,85,33,254,13,200,40,62,203,192,126,89,141,182,144,163,223,121,240,139,32,146,
+    0,236,120,170,130,59,30,80,173,122,57,220,21,95,232,112,4,106,134,137,27,178,206,64,
+    55,74,203,141,78,1,214,173,85,67,226,178,104,17,146,249,16,53,65,65,218,11,158,228,
+    160,208,14,122,227,213,239,64,115,221,60,122,203,166,94,126,217,19,101,197,162,70,189,239,
+    100,179,151,60,94,185,250,229,234,188,114,11,42,221,79,233,166,2,223,108,207,207,7,194,
+    22,100,40,141,11,204,34,186,119,0,114,132,35,85,27,133,159,77,41,51,251,154,52,44,
+    81,143,35,248,242,253,222,243,87,234,198,84,179,206,214,100,114,173,167,220,229,142,118,99,
+    104,113,22,233,255,129,242,193,222,7,61,99,61,100,206,203,248,158,0,67,45,237,70,41,
+    207,75,140,43,116,234,118,225,65,5,249,39,230,208,223,224,162,27,196,80,242,154,162,245,
+    140,234,214,93,129,51,241,84,68,187,68,62,160,26,9,81,241,204,208,193,202,147,142,168,
+    223,33,107,22,55,205,49,49,253,210,103,142,128,77,101,2,110,147,42,237,37,4,98,11,
+    125,179,64,154,244,123,50,86,139,104,206,54,214,114,142,98,46,152,121,221,3,79,47,34,
+    124,176,24,101,214,204,38,220,80,198,81,114,250,82,65,170,7,117,104,115,61,176,243,74,
+    160,215,172,126,216,25,21,168,54,244,120,202,72,4,245,98,50,26,206,114,110,186,248,160,
+    63,127,251,1,54,66,74,43,131,21,121,10,77,228,75,112,74,50,109,11,25,173,210,119,
+    32,236,103,104,30,11,99,59,45,3,49,216,47,202,248,79,24,76,191,123,251,234,141,116,
+    217,45,108,210,111,225,222,192,174,195,182,224,7,238,70,47,24,60,87,160,232,92,142,44,
+    157,40,150,217,244,251,154,35,32,13,122,57,225,13,46,151,115,194,163,149,208,189,177,138,
+    178,5,216,40,243,73,174,151,86,198,154,98,92,216,80,86,45,95,62,228,50,120,117,17,
+    162,53,238,105,15,184,170,156,6,221,168,123,109,249,202,93,60,80,12,239,225,187,183,63,
+    58,186,90,21,142,193,61,28,143,138,198,118,10,73,255,25,218,159,54,180,207,95,189,255,
+    193,145,85,53,56,6,86,74,13,81,191,96,124,83,149,227,63,195,252,211,134,249,215,253,
+    215,175,126,112,156,181,42,236,129,182,48,3,227,254,43,106,84,145,223,195,220,128,119,205,
+    36,123,188,109,97,241,102,100,221,169,57,125,13,190,73,16,44,113,249,135,164,46,122,170,
+    163,181,98,108,61,248,67,37,106,104,196,210,9,160,237,105,105,58,92,166,29,106,174,6,
+    195,38,181,39,203,149,67,103,99,132,173,33,162,171,240,37,13,110,0,169,106,90,69,114,
+    183,118,112,92,136,86,185,184,90,105,33,179,224,246,253,207,173,73,108,56,187,50,125,20,
+    228,252,24,48,171,158,105,55,74,71,23,134,63,40,22,197,85,50,237,232,247,236,209,43,
+    253,154,134,226,65,130,149,170,238,215,134,152,155,131,209,193,121,172,78,114,175,189,248,134,
+    228,82,188,76,142,233,141,109,45,231,196,112,116,102,59,130,48,120,161,192,114,142,97,233,
+    54,168,188,65,131,147,185,249,163,163,144,61,116,122,65,238,103,66,247,231,228,96,60,46,
+    201,144,19,205,59,41,181,25,228,98,56,132,112,80,139,233,183,192,140,196,199,78,126,50,
+    81,153,37,158,209,217,149,118,8,144,79,20,167,0,38,53,106,157,55,164,215,28,206,76,
+    26,92,36,5,75,138,114,214,125,175,20,199,78,18,152,143,92,122,80,65,180,162,246,72,
+    107,206,61,210,34,234,211,182,106,162,106,211,65,156,249,230,141,242,253,110,231,118,205,7,
+    13,196,162,153,192,178,2,91,92,254,13,37,235,185,33,173,145,212,25,137,244,233,4,83,
+    77,166,74,94,254,40,255,98,236,228,242,78,233,22,200,233,124,174,29,10,41,250,198,169,
+    118,35,183,94,114,254,241,119,163,70,195,236,217,200,156,107,227,108,120,54,136,39,145,138,
+    255,115,22,0,133,3,125,79,97,227,205,156,111,11,54,38,114,58,57,234,189,143,201,86,
+    56,219,100,43,127,139,201,198,173,170,135,157,62,14,180,16,201,157,205,250,26,232,121,177,
+    156,252,229,201,122,158,104,121,57,17,233,14,253,56,37,64,150,253,118,155,221,39,232,103,
+    214,185,178,122,211,26,253,249,170,65,79,58,2,116,177,15,189,66,53,21,10,248,135,6,
+    214,234,221,153,137,142,43,71,156,193,74,110,92,153,97,46,148,117,11,72,119,47,109,63,
+    240,197,21,183,163,190,220,120,92,23,112,35,18,62,247,222,239,239,185,89,210,123,168,118,
+    111,146,69,121,182,100,108,186,138,248,20,58,57,254,189,151,242,67,125,45,242,215,140,31,
+    101,217,243,95,59,6,157,37,95,26,65,81,74,211,40,101,130,57,209,67,156,123,228,250,
+    121,18,44,181,1,227,120,176,246,46,55,139,206,211,211,249,51,27,67,157,9,190,160,171,
+    162,205,158,219,77,228,247,68,54,136,39,198,205,194,130,237,149,228,115,174,54,150,230,133,
+    11,175,33,242,94,178,69,213,14,46,194,202,99,14,190,59,254,61,227,202,40,204,48,86,
+    188,149,102,40,65,89,59,44,186,180,82,141,104,184,213,219,22,195,224,59,90,211,246,176,
+    203,236,202,10,246,101,250,206,204,189,55,91,180,81,29,68,227,233,34,29,149,226,103,64,
+    197,176,83,63,223,77,70,113,246,138,223,104,56,71,126,25,47,236,66,225,226,213,59,225,
+    40,227,219,93,174,179,115,164,112,227,101,182,165,110,194,27,252,122,150,77,230,92,57,49,
+    175,67,168,129,83,51,239,163,107,243,43,141,53,138,155,186,253,79,71,31,222,239,127,57,
+    120,251,252,11,124,138,84,165,30,6,181,58,212,24,15,70,41,228,86,138,103,2,38,110,
+    158,92,177,240,165,53,171,95,123,221,212,202,157,234,87,68,71,154,107,162,102,97,220,87,
+    160,192,38,1,176,238,232,138,20,6,185,143,43,229,113,233,30,135,102,49,82,62,124,172,
+    104,232,48,175,2,77,117,89,187,18,91,195,207,57,69,233,20,209,198,219,170,67,155,139,
+    175,157,220,50,46,147,206,19,197,176,184,29,207,31,10,7,251,194,175,252,50,243,76,90,
+    114,136,36,180,34,141,38,204,108,61,71,13,150,84,63,133,25,152,202,212,208,81,13,50,
+    212,135,143,155,155,143,216,195,29,194,54,128,59,33,117,131,45,222,27,180,221,115,115,21,
+    89,171,89,174,207,153,111,218,246,210,238,100,92,239,239,198,182,126,20,235,63,170,225,189,
+    102,223,9,250,54,11,188,181,162,247,205,85,46,163,116,99,41,248,46,96,217,186,170,174,
+    131,91,11,65,222,36,124,102,134,159,159,14,69,35,225,34,222,165,215,129,247,134,174,250,
+    45,85,202,127,230,98,240,94,67,93,14,67,247,179,30,44,221,196,95,190,36,220,207,40,
+    221,184,46,228,176,178,232,93,16,55,57,122,222,205,29,181,236,12,220,150,6,63,197,128,
+    224,158,77,8,126,132,240,155,207,109,178,23,160,221,15,189,187,236,24,254,22,100,110,154,
+    74,252,52,11,8,252,103,218,63,220,239,104,21,155,74,220,255,248,221,185,173,123,29,209,
+    156,168,183,180,148,231,216,164,209,171,74,74,137,75,189,161,4,67,157,77,122,176,182,15,
+    248,71,64,190,123,233,179,102,60,187,30,150,237,39,1,244,172,230,227,98,161,196,147,43,
+    143,228,98,152,79,124,59,51,10,203,137,48,103,76,17,72,173,57,209,59,75,79,109,241,
+    243,12,124,175,252,226,96,239,232,203,225,175,123,66,159,201,40,147,115,41,195,15,81,28,
+    200,147,215,167,230,187,9,129,138,182,95,115,231,210,136,74,56,212,16,145,79,84,189,38,
+    191,228,120,98,12,51,138,137,62,203,188,106,166,157,172,221,242,77,179,5,164,130,198,220,
+    120,174,108,57,124,55,53,20,133,128,106,169,154,186,206,66,10,244,74,151,85,185,40,84,
+    167,200,169,31,47,251,90,118,81,67,94,225,113,142,80,74,45,2,68,179,83,185,151,43,
+    116,67,23,52,167,9,170,23,103,47,225,241,196,47,7,76,189,178,82,118,207,117,97,243,
+    238,168,94,8,202,238,250,157,47,237,25,196,167,72,204,205,59,28,241,135,218,155,121,171,
+    229,66,46,193,61,16,240,185,241,202,84,140,117,79,18,107,0,255,162,169,113,179,74,239,
+    15,13,228,181,254,166,8,231,25,98,65,116,49,17,35,187,133,70,94,166,24,185,170,176,
+    192,201,23,181,67,6,9,64,1,10,34,201,172,130,222,244,244,101,106,62,237,193,78,91,
+    99,227,239,120,212,143,172,83,228,159,129,249,153,133,33,140,250,72,74,154,33,64,142,160,
+    116,191,207,66,4,22,81,172,28,123,5,84,29,231,112,230,118,120,180,247,230,249,222,251,
+    231,220,171,189,123,101,164,19,95,38,56,61,223,127,177,247,225,0,86,160,119,251,207,62,
+    28,236,189,7,30,176,255,226,197,171,103,168,172,78,46,158,173,142,248,78,248,37,123,91,
+    166,201,215,123,159,94,189,166,107,72,71,147,171,252,12,197,52,139,92,30,18,13,132,164,
+    159,97,251,244,114,179,98,179,42,22,178,59,50,59,48,159,79,203,33,223,33,238,112,58,
+    178,100,2,161,12,98,211,212,162,229,219,90,137,37,20,11,215,118,193,222,117,130,144,215,
+    212,162,67,129,51,214,108,64,244,13,87,125,57,177,22,13,97,189,214,208,222,252,89,72,
+    96,136,69,161,132,45,155,127,254,235,251,189,241,120,50,186,172,20,62,209,235,124,197,245,
+    192,242,36,179,176,229,170,156,143,139,103,0,77,92,114,40,197,114,83,67,220,145,163,120,
+    253,149,251,143,86,192,25,207,94,222,116,63,104,73,82,226,2,238,139,32,17,13,11,11,
+    46,231,110,185,110,20,242,180,91,173,26,198,11,54,186,74,191,246,166,141,249,170,141,91,
+    239,63,119,243,89,96,114,160,180,3,136,159,211,253,187,129,133,218,194,171,211,92,238,27,
+    46,85,157,249,181,251,86,29,24,193,231,204,2,121,69,146,137,198,94,138,185,190,233,42,
+    64,189,197,190,41,31,240,179,95,140,15,21,78,214,180,30,175,25,119,196,86,185,134,89,
+    174,90,88,46,215,98,179,184,100,117,113,201,141,98,88,29,37,197,99,86,236,129,241,15,
+    231,166,127,17,58,205,157,88,47,22,240,29,246,172,97,110,172,233,14,156,121,152,52,178,
+    53,243,217,154,70,54,246,80,204,171,225,185,240,173,163,159,98,84,160,29,60,127,67,167,
+    165,13,122,91,212,76,133,255,240,156,202,167,143,92,42,20,185,18,101,47,196,241,136,33,
+    216,183,39,217,116,72,231,195,149,2,89,21,237,172,154,244,136,118,69,183,72,66,57,195,
+    157,223,99,37,230,218,53,196,13,34,182,70,223,171,18,162,85,246,116,60,58,212,161,101,
+    53,55,46,99,249,146,36,34,207,215,200,120,113,203,154,200,105,52,236,150,180,110,3,6,
+    57,70,106,48,87,121,57,104,180,51,11,139,33,59,248,240,125,109,108,239,135,11,223,231,
+    134,242,214,219,201,123,217,68,46,37,171,128,88,160,243,76,37,199,173,58,69,135,5,146,
+    157,47,196,5,247,214,220,106,81,60,234,112,195,158,87,159,49,66,36,48,106,194,137,183,
+    96,183,250,242,229,167,31,223,166,218,207,183,220,52,195,110,1,232,173,182,237,238,1,189,
+    221,102,222,57,210,203,227,108,185,237,205,34,249,223,180,247,94,176,175,119,112,136,31,219,
+    213,223,15,95,248,249,123,122,27,33,114,96,138,48,226,192,7,83,129,147,216,255,43,17,
+    182,136,13,33,199,248,184,4,123,205,217,228,122,182,122,129,210,245,122,243,49,248,239,197,
+    233,236,87,47,23,178,144,69,156,238,203,254,240,188,55,25,13,153,131,135,123,96,116,75,
+    49,28,23,248,57,202,91,154,243,20,245,225,39,48,158,37,206,206,196,12,112,100,150,91,
+    74,179,68,110,163,121,135,67,183,133,69,5,178,172,178,57,38,225,56,175,123,234,188,105,
+    214,15,238,64,160,214,239,166,143,70,198,197,117,101,33,197,56,26,124,38,70,225,62,155,
+    118,13,173,60,237,24,13,198,103,179,76,32,227,109,146,244,207,166,164,65,226,56,217,248,
+    152,59,239,224,86,113,178,152,95,120,84,98,191,32,42,249,23,29,93,48,182,86,117,212,
+    39,188,174,240,199,195,84,125,107,242,222,157,125,229,11,107,190,47,249,105,152,56,255,18,
+    230,132,183,247,151,176,150,187,64,43,114,152,112,163,99,4,243,161,114,132,117,145,135,128,
+    255,67,138,250,46,219,46,75,169,84,206,44,182,147,115,90,37,5,247,237,41,64,85,109,
+    24,253,48,179,207,224,150,222,4,110,178,66,214,252,110,224,133,229,219,223,165,55,19,167,
+    93,64,212,71,21,38,230,41,69,179,10,98,118,43,230,70,68,104,218,123,228,192,68,0,
+    124,72,57,121,225,67,97,238,194,45,90,115,53,114,75,24,71,10,154,212,56,162,153,73,
+    13,48,108,173,49,218,19,22,181,160,172,223,10,19,95,160,134,94,185,37,159,142,49,111,
+    209,37,137,220,40,233,251,57,17,197,101,4,85,113,153,65,45,38,75,135,245,78,112,207,
+    14,14,100,197,186,33,137,77,145,203,184,64,248,137,244,168,44,75,150,34,71,65,137,88,
+    204,38,68,187,42,73,135,118,2,35,67,59,86,82,225,161,172,91,17,225,159,78,75,166,
+    201,243,98,82,186,209,234,55,184,95,255,10,118,245,14,11,94,155,202,110,239,143,225,39,
+    210,92,206,220,248,86,164,167,149,182,41,176,160,98,73,136,5,233,140,30,11,18,37,89,
+    62,183,219,253,11,169,211,117,133,82,68,163,82,190,101,196,186,224,234,228,78,100,106,131,
+    98,19,171,209,130,125,47,96,144,105,30,226,138,125,181,115,87,172,233,88,177,68,119,205,
+    244,197,86,128,41,114,225,224,112,218,32,61,137,86,92,86,95,226,72,187,0,183,119,115,
+    190,97,28,38,222,155,247,141,107,151,227,186,34,20,202,253,163,194,161,134,65,219,170,208,
+    125,192,81,232,173,202,33,52,59,76,155,138,6,180,192,53,154,126,83,133,234,122,250,136,
+    223,205,77,219,173,204,189,28,237,22,153,125,153,131,155,47,152,63,57,190,149,189,151,17,
+    189,64,21,59,71,99,139,141,195,244,9,42,221,236,90,251,120,39,85,21,130,92,72,110,
+    55,194,245,222,1,213,45,54,214,206,46,56,79,87,242,52,125,39,144,110,179,245,94,6,
+    191,142,9,4,41,75,206,159,124,124,197,56,198,93,146,19,223,142,131,56,18,42,250,81,
+    105,254,112,244,150,96,172,248,253,81,39,69,151,160,241,89,123,145,71,239,131,183,47,159,
+    239,191,59,250,245,233,135,23,22,61,90,169,168,69,205,128,231,222,78,201,225,40,70,134,
+    220,20,234,92,198,210,105,96,159,251,36,125,122,214,126,241,76,62,180,42,61,46,106,224,
+    45,112,246,168,218,119,56,116,212,27,8,108,94,104,66,110,58,103,102,229,21,188,133,84,
+    101,3,233,240,150,107,129,120,47,32,220,212,83,23,18,239,1,52,53,126,33,63,231,129,
+    161,150,30,37,47,236,19,101,61,241,74,82,1,189,131,180,255,238,240,213,193,219,55,190,
+    89,129,176,134,115,144,199,154,38,85,154,245,194,178,225,130,194,30,171,66,55,166,250,219,
+    143,244,40,175,67,7,127,96,62,248,104,100,27,228,180,231,181,100,150,223,188,159,14,181,
+    12,230,42,191,216,177,105,161,79,211,129,245,102,35,175,102,214,3,54,113,83,159,185,46,
+    69,5,126,164,237,26,51,177,216,168,48,188,130,44,246,140,57,148,245,249,185,190,25,13,
+    28,167,193,141,47,212,3,75,2,41,14,52,74,69,10,27,43,121,68,202,90,188,226,254,
+    45,141,47,210,218,208,122,25,44,137,76,161,81,104,18,16,183,38,181,212,13,67,21,19,
+    24,110,183,95,239,31,237,29,188,217,63,60,204,81,219,107,81,192,66,149,136,182,222,26,
+    181,91,20,212,36,171,169,197,22,77,233,240,47,64,150,5,160,3,49,26,68,26,139,25,
+    140,38,227,174,245,198,174,94,239,219,247,239,126,101,78,229,73,246,51,158,127,165,187,34,
+    170,128,69,32,113,13,213,203,176,148,114,20,77,64,128,120,53,108,247,207,50,88,232,152,
+    110,83,112,99,85,141,165,170,106,44,83,85,115,169,170,154,203,84,181,177,84,85,27,134,
+    255,12,142,226,25,101,43,92,101,8,207,71,123,239,95,238,51,25,91,200,103,174,49,48,
+    215,142,2,32,30,241,254,72,126,190,84,169,77,89,74,231,191,72,134,90,31,150,0,223,
+    122,63,184,162,183,135,84,34,175,1,150,160,147,69,117,53,150,172,171,177,68,93,205,37,
+    235,106,46,81,215,198,146,117,109,8,124,47,24,238,69,237,108,46,217,206,230,18,48,111,
+    45,89,215,214,18,117,109,47,89,215,246,18,117,61,92,178,174,135,78,218,37,38,202,249,
+    155,125,103,37,31,5,55,237,181,72,77,47,189,148,251,249,244,69,122,105,221,49,161,89,
+    169,239,76,152,23,37,92,153,26,89,237,116,174,55,48,47,106,96,94,212,192,252,134,6,
+    92,78,199,147,201,104,58,173,96,231,124,2,192,51,85,253,11,203,157,27,47,98,20,250,
+    53,181,138,146,162,53,119,206,64,123,138,209,112,6,203,30,74,199,56,140,77,246,212,109,
+    238,173,41,53,110,246,176,201,83,19,49,85,228,107,39,88,94,182,62,6,254,116,54,137,
+    57,247,223,155,196,149,242,154,129,42,191,172,185,30,176,172,92,141,231,85,138,171,93,80,
+    43,140,206,175,233,229,252,75,251,34,173,120,246,65,16,203,178,120,45,55,122,149,95,200,
+    197,67,247,166,15,124,146,5,89,146,122,39,158,105,96,231,209,65,241,217,28,164,47,244,
+    32,198,124,50,157,77,218,95,176,188,165,9,254,181,110,205,3,94,76,159,1,34,106,158,
+    143,186,178,13,219,190,54,44,178,183,235,155,231,235,155,23,214,215,44,79,103,8,32,159,
+    112,31,206,107,211,153,157,222,96,233,115,87,250,70,249,208,164,244,175,120,51,14,101,106,
+    51,160,77,128,21,3,245,154,85,230,200,114,203,47,11,161,222,180,44,52,53,11,189,49,
+    11,105,248,214,115,1,101,188,49,37,73,57,220,92,140,228,39,120,114,246,72,165,230,241,
+    27,246,6,170,70,4,164,249,66,241,186,234,243,108,58,148,175,138,30,250,229,35,31,96,
+    179,60,152,232,15,21,64,110,86,77,254,68,26,8,122,28,37,167,48,163,249,91,10,24,
+    98,132,70,15,245,218,202,98,82,118,210,245,23,180,182,52,217,74,90,71,203,39,128,65,
+    250,31,98,253,244,60,58,107,36,167,140,214,137,173,202,217,51,175,16,207,223,36,98,8,
+    147,47,174,50,97,232,29,212,250,97,60,37,140,133,229,230,214,118,141,63,214,27,232,185,
+    62,80,235,207,71,23,67,149,115,139,229,220,174,5,162,70,130,3,43,100,2,254,84,82,
+    59,85,187,170,255,248,102,128,133,60,189,166,77,222,168,170,203,6,98,157,91,211,107,45,
+    226,54,79,171,134,1,127,216,237,181,103,239,241,24,233,17,109,254,21,216,212,12,85,138,
+    187,117,26,182,189,156,202,202,185,230,205,121,179,172,252,8,113,151,44,231,208,9,189,207,
+    248,166,184,208,87,173,205,175,46,202,107,97,89,60,96,167,65,18,200,97,154,240,10,248,
+    40,176,33,98,77,203,65,223,59,26,17,136,230,160,111,42,216,120,93,164,197,119,238,91,
+    168,243,244,58,81,137,228,143,163,209,219,201,172,59,234,76,162,113,183,151,216,85,107,25,
+    115,154,56,67,210,23,176,34,219,209,196,2,132,185,61,248,3,200,24,11,208,11,208,21,
+    246,185,198,114,235,32,141,108,88,142,70,184,184,252,145,3,169,79,155,235,103,253,222,248,
+    206,128,105,85,208,26,173,195,132,59,28,230,12,216,198,214,187,108,130,154,87,179,222,121,
+    246,51,144,197,193,168,114,164,33,15,104,11,172,85,232,115,77,224,113,85,228,209,161,28,
+    91,224,21,225,175,55,60,255,33,228,113,56,53,232,202,57,240,68,27,230,64,35,183,156,
+    100,131,179,254,172,55,238,247,178,244,75,212,31,119,163,188,12,240,238,253,62,127,39,243,
+    213,254,243,47,123,7,239,126,221,115,62,78,197,78,206,84,92,100,136,26,227,201,8,119,
+    178,250,91,55,155,218,27,53,184,2,140,210,172,255,49,239,153,67,19,198,149,61,164,118,
+    70,135,178,16,171,28,2,178,172,170,154,188,40,164,189,89,55,155,244,134,157,162,195,233,
+    231,175,142,126,221,127,255,138,189,74,87,46,59,158,222,146,85,228,31,224,178,196,42,213,
+    216,162,7,46,141,22,165,127,74,217,134,242,220,105,59,29,235,76,122,233,23,77,115,13,
+    240,147,106,48,209,225,218,220,92,199,89,189,95,166,200,236,190,176,55,168,197,229,96,115,
+    75,61,5,191,102,6,245,144,230,101,57,87,21,153,222,178,165,205,78,165,7,194,221,9,
+    102,55,108,159,101,212,241,106,174,152,99,201,151,138,131,174,35,53,203,166,25,177,165,153,
+    192,105,82,238,251,183,31,94,254,234,60,82,211,237,117,53,65,72,214,99,29,169,217,45,
+    138,35,53,89,77,173,99,16,139,1,126,177,20,110,195,151,23,196,117,128,180,19,53,166,
+    109,177,184,114,67,209,164,248,113,2,87,171,110,173,17,167,223,127,195,247,200,102,177,226,
+    135,179,176,121,35,91,224,156,219,5,160,165,81,229,118,79,109,131,150,83,149,114,23,203,
+    3,229,114,207,239,130,202,214,56,44,112,83,111,195,149,87,36,44,40,168,32,99,243,64,
+    18,46,190,123,24,77,80,226,87,67,136,235,19,219,120,225,249,61,247,103,73,10,196,144,
+    83,215,56,97,10,190,228,17,154,167,250,46,129,72,155,37,162,110,60,166,215,61,173,231,
+    224,98,157,58,200,38,227,66,208,166,164,107,116,19,148,82,90,109,150,71,237,246,52,155,
+    201,199,244,212,251,213,250,142,140,38,39,170,49,201,124,236,210,104,157,218,51,158,230,131,
+    105,51,25,245,210,15,31,153,151,71,244,49,125,134,178,38,102,20,79,90,155,229,184,140,
+    20,235,172,67,142,128,232,156,86,111,85,3,103,149,195,95,187,188,244,85,55,205,138,103,
+    63,86,241,188,168,226,201,143,65,60,47,132,120,242,99,16,207,29,16,211,216,180,113,72,
+    152,244,159,27,18,211,177,186,88,175,250,177,15,248,3,50,210,44,85,185,123,74,145,101,
+    2,89,38,206,44,137,200,18,249,101,124,126,179,118,153,91,192,92,238,72,133,146,167,98,
+    78,130,3,8,18,55,245,234,108,183,253,102,140,212,160,67,214,48,85,76,193,150,23,88,
+    18,187,100,21,175,222,171,220,180,15,90,15,245,10,106,23,142,108,87,244,142,146,253,130,
+    64,76,141,247,134,47,38,103,211,217,217,128,121,19,100,145,21,163,202,203,242,147,144,205,
+    64,51,118,39,100,174,246,244,216,185,51,239,156,231,149,152,142,71,163,190,106,186,204,117,
+    33,13,88,60,13,76,32,18,150,112,148,77,103,10,208,166,86,196,108,240,202,217,160,86,
+    137,104,210,170,215,112,192,175,103,215,221,152,42,57,80,46,190,76,79,232,221,179,23,150,
+    23,195,5,28,202,241,154,138,52,3,187,172,147,85,131,44,93,67,177,216,241,214,131,44,
+    48,183,11,204,111,40,112,137,103,89,213,219,180,96,23,40,108,65,210,108,69,57,182,115,
+    172,97,106,250,152,20,205,220,246,161,74,236,37,80,17,246,204,179,199,214,43,87,127,172,
+    106,34,208,159,83,53,96,246,231,85,93,231,14,14,239,171,234,159,211,251,123,5,209,38,
+    135,198,207,35,135,198,207,35,7,87,213,162,98,79,250,127,90,47,63,54,253,111,47,230,
+    53,95,14,223,190,56,250,15,195,89,204,112,12,225,212,30,46,101,142,113,63,44,232,135,
+    26,187,45,83,250,193,158,53,254,204,198,110,199,184,238,210,216,159,133,179,159,220,141,59,
+    179,187,251,32,189,198,159,73,122,119,100,137,202,93,174,156,246,63,178,224,57,180,204,175,
+    205,45,179,122,139,235,90,106,202,37,103,113,118,52,194,167,19,152,255,42,33,220,75,102,
+    245,217,186,251,140,226,41,238,60,225,167,82,62,183,29,190,227,61,197,209,8,157,110,115,
+    109,202,117,166,26,137,133,80,215,78,5,0,126,250,213,239,46,169,106,124,105,73,85,35,
+    118,87,86,180,230,103,144,29,236,233,224,234,59,178,113,63,26,210,123,8,231,234,190,143,
+    111,193,250,131,209,116,182,39,52,250,26,244,188,129,170,198,145,247,237,80,244,106,205,40,
+    109,188,116,197,250,244,36,212,202,232,54,29,152,231,28,51,176,217,167,8,146,1,74,206,
+    187,55,169,5,0,216,124,227,73,213,127,89,88,63,31,134,94,103,248,9,173,18,225,23,
+    155,187,212,92,39,107,237,32,28,171,60,115,149,227,145,66,69,237,206,151,104,247,179,214,
+    238,188,168,221,75,163,189,207,44,100,103,157,27,32,126,102,67,29,184,8,91,204,252,70,
+    115,139,31,23,147,207,58,54,244,138,49,108,60,164,228,135,91,249,3,32,219,20,247,39,
+    239,141,205,92,186,189,173,243,161,73,99,6,46,18,140,42,38,120,236,242,2,210,55,145,
+    41,54,13,159,225,202,80,230,104,164,221,97,88,91,114,211,165,199,152,148,106,229,147,113,
+    86,97,188,37,179,59,100,64,165,250,227,202,72,110,219,160,9,215,254,158,128,141,211,141,
+    231,214,19,119,54,4,193,146,27,219,242,247,239,183,149,70,173,83,188,53,244,118,214,32,
+    58,211,135,90,103,33,181,185,164,104,113,75,182,164,0,174,120,50,245,185,170,78,202,128,
+    107,234,82,36,106,130,140,111,33,217,23,85,60,255,89,21,95,226,25,220,207,129,248,94,
+    43,254,73,189,191,252,89,227,245,179,42,190,188,252,89,227,85,80,241,173,196,36,62,141,
+    126,116,92,111,120,22,220,186,170,114,40,246,222,250,162,106,16,205,54,93,119,84,120,75,
+    252,55,184,166,34,240,244,27,42,5,215,95,118,73,69,48,25,247,83,10,168,159,113,69,
+    229,36,128,187,143,253,253,185,3,88,104,153,30,22,83,21,38,243,151,213,222,233,222,98,
+    175,151,38,144,123,244,149,225,246,250,16,58,136,238,150,96,187,136,232,62,29,207,184,157,
+    166,8,39,52,119,0,221,65,103,211,83,251,82,220,186,171,121,13,89,42,134,23,204,220,
+    101,202,237,41,244,239,238,214,130,119,17,246,125,120,225,81,232,86,226,191,155,255,136,229,
+    167,223,223,194,133,141,61,10,182,91,151,191,149,231,152,91,240,136,191,143,219,42,27,195,
+    57,143,75,255,211,124,69,217,163,164,121,97,52,143,169,152,118,224,244,180,55,140,163,105,
+    230,92,140,255,241,234,205,155,87,111,94,242,247,16,54,1,133,195,12,216,241,39,230,225,
+    227,41,11,77,240,138,28,171,121,53,76,179,75,121,26,162,23,248,188,168,192,220,81,224,
+    143,69,5,174,28,5,126,95,84,224,66,83,221,91,241,49,126,40,245,246,110,232,182,33,
+    47,197,189,97,202,106,15,22,164,189,98,207,58,234,235,198,211,183,111,246,191,240,215,195,
+    138,148,133,176,35,71,76,244,14,204,60,56,43,180,84,237,86,134,90,182,186,109,171,158,
+    230,207,145,254,141,111,79,194,82,186,169,29,10,177,148,75,166,161,89,41,255,91,190,119,
+    107,53,108,60,139,198,10,205,149,162,204,191,97,123,177,116,57,178,118,98,91,146,162,50,
+    185,155,158,229,75,96,214,116,78,219,158,185,165,35,194,245,254,206,45,223,238,90,93,190,
+    60,128,166,10,46,69,5,126,121,110,116,132,213,211,188,77,61,141,226,122,54,110,83,79,
+    179,184,158,205,219,212,179,225,170,71,206,44,102,179,177,89,1,100,65,217,38,252,219,240,
+    177,1,207,62,123,193,204,166,19,28,185,177,52,167,137,160,84,50,159,123,189,247,233,11,
+    206,13,181,205,184,45,69,235,144,154,117,195,172,169,244,60,89,241,2,72,243,146,163,224,
+    16,55,48,7,118,238,8,153,63,82,62,4,65,114,129,197,154,205,90,217,97,150,58,158,
+    72,22,41,213,80,49,221,85,189,45,22,96,47,167,243,163,236,124,153,207,11,202,204,11,
+    202,252,177,160,204,85,65,153,223,23,148,185,200,25,91,226,41,103,142,93,242,66,88,175,
+    199,143,70,213,136,80,74,161,189,120,110,153,194,236,124,20,4,253,154,152,229,137,120,22,
+    170,33,17,64,16,184,94,156,115,174,114,126,94,156,243,74,229,252,99,113,206,11,149,243,
+    119,59,167,65,88,38,190,36,177,89,107,147,97,82,46,200,203,40,192,162,244,124,198,155,
+    152,166,9,161,112,127,235,210,190,118,188,94,166,15,14,247,92,156,211,184,150,206,107,12,
+    102,37,95,165,52,245,173,29,239,40,26,149,212,38,186,77,169,35,55,147,142,164,8,160,
+    117,103,129,194,180,9,186,75,235,88,2,171,85,62,131,81,132,138,199,11,236,16,142,80,
+    30,128,106,223,45,50,69,152,17,53,80,61,55,26,35,232,109,230,59,68,102,222,194,101,
+    47,241,60,238,184,88,186,241,141,60,241,74,85,228,107,42,180,170,9,211,146,95,3,13,
+    253,43,77,153,204,82,152,231,247,110,111,150,145,200,27,112,171,58,230,173,227,72,239,97,
+    222,20,66,156,71,230,27,67,23,230,220,21,138,176,211,123,159,245,134,221,104,146,222,80,
+    167,116,169,232,238,130,195,193,49,43,177,110,61,140,82,149,213,90,15,211,125,24,38,0,
+    198,44,75,155,191,102,253,113,54,193,85,214,99,23,179,21,90,114,113,225,173,215,26,120,
+    29,202,228,138,70,157,153,30,178,106,235,181,38,11,215,155,252,118,199,81,196,206,187,33,
+    60,41,83,177,117,138,241,117,207,112,56,148,132,12,5,222,189,35,42,223,115,81,225,186,
+    35,141,191,93,227,34,18,169,68,46,198,246,237,120,214,27,128,120,151,62,3,12,143,134,
+    63,10,121,34,189,240,200,199,228,184,174,6,75,33,52,214,55,229,227,23,212,79,242,115,
+    45,186,132,3,178,93,107,10,50,148,106,225,108,192,138,242,52,106,15,249,176,213,183,201,
+    92,145,217,104,214,154,170,187,192,106,207,206,23,26,20,113,47,53,214,37,155,97,65,158,
+    75,145,198,221,142,52,141,201,57,82,201,16,204,157,180,255,250,213,225,225,171,143,251,238,
+    84,221,146,197,145,172,187,142,225,150,81,234,124,185,137,140,95,99,168,2,35,218,210,255,
+    191,18,31,11,253,18,105,139,53,224,235,127,23,170,62,20,187,163,66,27,18,205,213,148,
+    34,169,230,141,179,76,120,190,116,245,237,109,225,56,53,93,173,20,14,199,114,109,68,32,
+    62,247,226,179,89,38,236,98,154,193,77,77,151,176,237,31,108,150,188,119,134,188,57,81,
+    49,157,191,3,51,45,174,92,58,162,212,171,126,254,10,189,62,62,219,55,162,203,21,243,
+    68,93,218,72,110,154,199,252,194,110,116,153,157,149,154,7,120,85,73,227,219,90,177,68,
+    55,82,113,154,113,253,39,75,106,121,209,239,141,115,177,163,113,148,48,135,165,230,195,218,
+    191,91,151,17,244,146,205,32,234,13,197,117,130,46,182,41,65,23,91,174,48,0,196,42,
+    64,237,98,207,140,42,81,167,203,138,153,43,141,46,211,16,23,87,60,5,39,91,75,8,
+    5,56,80,246,43,226,54,224,255,167,55,76,250,103,105,86,222,73,70,131,193,104,248,196,
+    209,23,179,16,246,70,224,95,30,206,87,244,135,210,180,17,19,62,92,68,35,228,11,135,
+    83,208,19,51,201,52,33,126,194,251,105,248,4,180,93,247,81,95,201,184,136,15,55,146,
+    36,185,34,252,242,110,239,217,63,80,198,14,195,242,70,179,94,207,251,164,82,24,83,206,
+    54,115,168,208,160,99,158,39,140,56,123,193,54,18,115,59,12,35,149,140,177,23,103,41,
+    244,105,105,228,74,128,122,152,240,223,143,134,217,52,151,51,55,152,197,69,181,82,124,46,
+    90,143,18,179,201,167,249,208,89,132,109,211,101,95,13,13,179,20,202,205,219,4,29,101,
+    6,16,14,124,45,74,159,101,211,89,81,6,151,3,211,39,75,116,194,154,199,12,5,106,
+    63,176,102,26,102,95,161,116,199,187,169,30,77,42,104,161,225,108,33,231,28,195,110,192,
+    126,220,7,102,59,155,2,108,186,47,164,98,83,160,50,146,210,222,20,232,32,201,16,49,
+    150,142,134,73,215,110,255,114,70,30,215,65,251,98,218,118,228,113,82,182,204,183,128,174,
+    165,20,100,145,128,117,225,241,196,186,222,133,133,234,221,193,222,179,253,215,251,111,148,219,
+    107,139,115,25,71,81,79,236,44,121,239,134,185,44,185,243,172,39,69,147,97,1,167,204,
+    187,199,115,244,84,59,198,180,82,237,145,94,150,27,187,135,207,153,193,30,59,153,137,211,
+    107,111,58,67,71,196,72,224,130,115,139,231,158,185,184,160,22,98,254,136,109,59,155,160,
+    235,53,109,233,50,249,57,30,43,60,231,245,230,18,219,70,218,173,87,196,191,114,25,88,
+    154,193,151,127,10,135,255,121,188,153,223,236,244,200,208,82,232,190,90,162,198,90,126,224,
+    165,63,88,42,87,97,21,172,25,195,207,119,227,218,160,231,50,232,117,104,79,242,245,164,
+    195,174,155,184,178,204,234,160,104,206,136,115,20,253,3,116,247,119,97,220,255,97,202,127,
+    91,166,108,237,207,150,229,200,14,241,254,194,220,137,208,149,0,35,243,236,235,25,123,106,
+    196,185,187,106,62,47,207,246,121,142,187,176,217,252,198,131,57,183,17,143,12,155,94,34,
+    77,168,229,221,90,147,67,243,129,61,142,41,2,100,245,16,77,123,248,64,30,59,239,150,
+    245,162,201,204,26,51,83,87,14,197,223,239,63,123,245,238,253,219,103,123,7,95,222,189,
+    146,190,225,180,250,240,134,41,130,57,175,87,116,165,169,51,161,58,132,93,79,83,171,200,
+    189,65,196,155,16,137,67,95,118,69,113,26,57,2,255,205,55,119,226,121,191,97,150,70,
+    211,110,150,90,20,197,71,158,22,167,5,155,114,51,30,107,226,58,18,246,141,196,44,234,
+    243,20,203,101,62,222,71,104,162,193,66,38,76,199,185,11,150,234,246,168,243,183,221,207,
+    145,177,17,105,120,24,93,246,21,110,128,92,159,72,20,234,234,133,211,36,154,164,134,117,
+    219,70,121,116,54,235,140,160,45,161,131,229,120,180,166,64,184,224,145,185,109,210,50,59,
+    53,115,32,140,68,27,32,99,243,57,233,196,174,57,199,47,66,245,146,126,217,218,181,218,
+    208,45,242,169,102,65,233,186,14,180,178,128,96,51,74,33,125,90,148,1,73,74,75,202,
+    205,26,198,5,76,106,23,78,13,213,225,161,242,229,231,144,130,127,108,34,56,100,4,57,
+    13,254,236,141,31,3,75,95,217,244,78,149,185,161,35,61,72,100,244,85,60,67,176,140,
+    187,58,197,9,149,148,124,59,111,117,247,179,145,178,137,196,98,172,131,108,218,5,177,170,
+    151,220,141,175,138,171,99,219,89,181,177,218,188,17,207,165,46,117,128,118,19,243,92,184,
+    139,202,157,218,223,239,30,43,26,221,112,20,135,172,97,113,150,108,120,190,56,195,226,197,
+    161,80,47,225,191,197,145,224,125,240,244,5,27,72,7,187,191,199,147,65,151,134,203,19,
+    246,228,223,162,55,223,67,235,77,120,235,66,121,169,128,233,226,60,255,232,90,193,251,227,
+    226,197,169,234,221,31,95,211,180,244,110,110,68,83,127,40,60,187,101,83,200,192,223,13,
+    21,175,22,44,210,78,249,98,113,93,129,189,170,158,231,128,249,31,178,244,43,190,254,99,
+    167,189,214,5,101,33,43,115,45,207,119,94,252,255,251,30,29,171,59,213,39,55,136,28,
+    75,159,108,176,203,82,199,6,202,113,18,113,211,97,198,141,71,25,234,152,33,107,71,64,
+    195,127,245,105,199,143,157,46,223,249,164,35,71,227,183,17,167,250,209,32,134,216,229,4,
+    42,246,230,193,160,55,157,246,206,179,165,111,149,137,15,209,203,21,74,149,210,126,248,194,
+    81,226,105,148,156,254,200,61,102,129,67,227,255,85,226,27,31,170,31,20,242,226,105,218,
+    158,230,219,230,28,136,230,83,97,42,190,55,114,27,137,209,237,248,215,153,199,54,132,252,
+    159,47,122,254,105,178,27,77,67,58,67,217,231,36,164,189,208,171,49,128,255,246,210,176,
+    123,174,220,70,224,187,227,227,208,185,89,124,75,33,243,233,251,231,47,190,240,240,151,3,
+    198,196,43,57,209,243,166,215,134,172,118,236,158,57,222,28,218,213,249,121,185,101,242,234,
+    69,18,184,93,183,185,44,152,134,125,11,10,222,162,235,176,77,176,108,162,131,27,165,251,
+    101,196,116,107,39,81,190,105,171,225,158,72,127,142,116,255,19,68,246,59,110,30,242,143,
+    25,56,229,16,243,150,241,96,239,245,211,253,247,71,127,129,68,241,115,118,25,247,186,146,
+    254,197,91,22,167,227,147,255,158,155,154,251,217,161,228,183,69,63,190,127,249,219,239,90,
+    150,218,151,44,222,218,44,218,181,240,9,160,115,135,124,247,44,7,44,203,109,124,198,221,
+    17,231,69,138,221,188,251,245,45,154,221,221,113,23,196,222,128,227,146,70,110,119,52,21,
+    47,184,47,60,160,254,207,30,231,47,218,227,116,80,104,211,117,77,238,112,220,125,175,220,
+    93,36,18,153,254,216,134,41,62,27,140,23,231,40,120,82,241,63,59,170,255,236,168,238,
+    190,163,114,190,24,123,67,30,62,13,150,218,152,21,204,149,197,121,22,66,99,231,113,64,
+    99,103,1,89,242,201,95,179,171,112,150,151,86,200,133,21,104,57,254,179,47,185,121,95,
+    194,104,202,220,149,112,49,193,220,97,232,207,216,254,156,187,230,59,110,73,150,213,164,252,
+    123,95,144,252,103,183,241,179,119,27,69,20,251,198,241,152,181,102,170,246,70,127,6,250,
+    127,139,194,63,160,69,159,239,244,34,132,82,135,145,174,144,239,99,7,116,215,221,205,124,
+    218,75,248,202,170,115,174,207,135,175,158,237,29,220,121,143,99,61,80,152,75,25,100,176,
+    164,220,184,203,97,132,134,10,228,207,247,222,63,207,91,177,37,125,124,91,21,190,130,5,
+    105,239,245,55,17,57,229,253,217,44,249,63,123,178,159,185,39,187,237,110,139,204,67,1,
+    117,92,242,129,81,95,208,131,31,220,149,241,233,245,119,216,152,21,63,198,105,18,134,152,
+    154,255,217,192,253,103,3,103,81,77,17,112,58,201,252,125,118,121,218,210,246,159,141,222,
+    143,109,244,254,119,109,229,56,225,216,187,57,33,19,253,15,219,208,253,103,199,246,159,29,
+    219,127,118,108,63,103,199,118,251,93,153,182,6,42,222,195,220,17,45,220,42,41,159,51,
+    218,48,223,213,231,81,158,99,217,92,78,242,173,31,227,118,183,182,40,191,31,81,120,145,
+    240,186,128,87,44,33,167,253,144,152,227,92,101,17,69,12,131,100,125,93,225,179,213,246,
+    181,97,80,143,185,114,9,234,249,111,75,37,127,127,199,29,119,88,96,254,179,88,252,157,
+    23,139,159,50,87,110,94,89,76,207,54,228,250,126,122,87,35,182,91,158,71,221,116,214,
+    196,103,215,172,151,244,179,187,91,122,45,113,218,241,151,159,44,252,213,6,190,6,166,239,
+    188,233,207,111,234,255,55,89,9,243,169,227,180,16,118,25,201,11,179,225,159,100,249,251,
+    23,111,114,110,218,179,220,130,107,42,55,209,175,254,216,223,59,58,218,127,243,97,239,232,
+    213,219,55,210,157,23,123,227,131,189,35,57,101,207,69,86,184,237,241,186,201,242,148,59,
+    47,169,12,236,40,95,104,116,247,103,232,156,221,94,126,103,37,92,60,91,184,110,190,55,
+    142,125,191,90,70,63,104,82,113,147,15,72,198,72,8,7,138,57,170,247,118,237,87,169,
+    188,28,87,113,77,115,142,108,219,26,240,46,51,113,193,236,185,237,20,249,57,164,117,237,
+    151,158,71,225,183,65,6,146,82,171,125,54,100,206,73,34,239,27,16,83,5,68,233,114,
+    28,126,187,246,147,176,30,36,59,81,141,185,148,10,146,106,213,251,134,137,105,56,235,246,
+    166,181,164,15,12,183,18,29,39,39,158,159,5,88,50,195,23,38,82,47,62,206,78,194,
+    20,254,92,139,247,34,160,46,204,108,52,165,154,161,178,9,150,133,232,24,234,131,216,64,
+    64,146,82,60,54,66,37,178,16,191,143,211,147,32,123,240,160,146,213,122,83,34,138,239,
+    223,241,147,185,9,216,208,3,155,44,240,17,16,59,154,52,245,192,134,30,224,217,248,27,
+    31,222,110,204,26,9,51,222,75,175,181,55,153,68,115,200,66,191,21,35,203,180,223,75,
+    48,139,140,185,86,29,191,246,255,209,9,191,69,152,35,238,159,101,173,198,214,195,199,205,
+    141,71,27,126,52,156,245,190,158,101,23,232,178,187,213,216,222,220,220,196,199,127,163,175,
+    103,81,107,123,107,107,131,125,14,162,9,72,128,173,71,27,143,30,109,109,111,250,209,21,
+    0,71,85,108,54,32,115,156,245,58,88,182,209,120,220,220,174,251,113,111,250,21,91,216,
+    126,248,176,222,220,220,244,99,16,101,79,91,117,252,29,38,221,44,197,103,145,135,41,165,
+    55,235,155,91,126,137,0,106,110,65,69,240,113,222,27,245,179,89,235,113,125,107,171,89,
+    111,250,241,100,116,49,108,53,234,143,154,155,205,13,168,235,108,210,159,95,140,70,80,124,
+    115,235,241,118,115,163,225,39,81,154,205,168,138,237,230,246,246,86,243,145,79,254,201,39,
+    25,172,230,4,241,198,86,19,162,70,48,77,35,236,226,198,195,71,143,55,31,214,253,100,
+    52,137,250,8,197,230,102,243,97,19,131,67,224,94,23,217,132,213,181,245,184,241,248,81,
+    131,162,167,189,254,41,129,187,5,181,249,201,164,55,152,142,0,38,40,183,209,168,67,69,
+    243,104,200,113,149,70,147,83,134,222,141,199,20,160,180,141,173,135,205,13,10,118,70,253,
+    52,27,78,16,252,102,253,113,243,49,207,213,129,161,108,53,224,191,199,245,198,67,30,147,
+    101,67,192,201,54,212,207,195,86,142,211,110,116,218,131,106,54,55,54,154,91,172,154,65,
+    212,1,62,18,181,30,55,234,143,183,55,89,139,163,126,239,60,99,181,109,109,61,126,248,
+    248,49,203,10,125,31,210,152,61,220,124,8,120,230,113,73,183,7,144,213,235,155,245,122,
+    163,73,113,147,44,165,234,182,234,155,20,158,210,224,193,208,111,212,31,109,54,88,185,105,
+    22,177,6,128,26,30,3,214,88,36,34,155,80,177,249,112,99,115,99,243,161,138,165,222,
+    34,230,54,31,195,224,107,209,153,138,198,88,160,220,175,103,163,30,140,226,86,243,241,38,
+    139,19,212,177,253,248,241,22,34,47,203,112,53,164,209,105,108,63,198,86,32,102,122,58,
+    103,45,63,110,108,53,252,180,55,160,22,183,31,3,17,109,111,177,112,166,133,71,105,135,
+    15,122,179,94,223,128,46,248,237,222,36,139,39,61,160,218,6,98,168,177,185,237,3,105,
+    0,185,136,89,2,164,240,24,176,6,188,1,4,82,62,86,205,237,141,71,155,77,191,125,
+    150,116,167,189,136,32,106,60,6,154,232,0,255,157,198,163,201,8,41,6,136,13,102,72,
+    167,59,154,206,68,93,27,141,109,200,234,35,105,96,33,8,64,205,26,161,108,110,52,31,
+    55,48,10,59,1,45,52,112,44,88,155,27,205,135,219,143,216,247,60,235,3,241,2,188,
+    155,245,13,152,58,62,117,81,228,238,2,235,152,167,217,5,159,178,0,65,119,52,19,120,
+    219,120,244,112,179,238,227,205,73,52,196,225,110,108,108,110,61,218,106,110,82,84,103,68,
+    88,220,216,128,28,231,163,201,156,250,14,0,214,125,78,127,91,15,31,1,200,117,191,31,
+    157,131,56,147,77,32,166,177,209,68,210,16,49,128,217,105,151,202,109,108,0,186,251,209,
+    197,144,65,255,8,136,249,241,195,109,191,212,207,128,166,128,246,218,109,36,45,68,46,176,
+    25,159,86,118,54,153,96,54,1,145,111,178,40,62,111,183,30,110,3,92,219,60,14,167,
+    89,3,176,11,52,254,152,69,73,12,10,204,0,107,123,212,68,184,40,149,102,28,76,231,
+    230,6,76,77,30,197,104,248,241,35,152,118,50,202,206,37,176,182,245,104,115,155,195,40,
+    230,4,68,194,120,52,121,164,152,20,205,198,102,243,209,99,222,172,160,76,136,168,111,108,
+    242,86,212,164,120,248,104,3,152,239,134,17,157,217,209,179,44,235,115,180,0,16,48,185,
+    88,188,236,38,140,79,227,17,70,14,144,139,53,31,213,233,147,19,12,208,18,142,37,186,
+    203,25,18,74,182,182,129,21,10,198,33,105,22,248,253,8,186,132,220,115,187,254,200,31,
+    100,105,239,108,160,45,4,64,53,15,55,154,77,158,192,231,206,22,15,10,62,210,108,54,
+    144,180,121,236,248,108,50,238,103,48,115,129,75,195,178,195,34,37,150,54,30,63,124,4,
+    196,128,151,85,20,47,185,199,163,250,163,135,15,1,125,60,126,140,87,92,172,200,246,102,
+    3,72,130,197,43,86,177,9,212,185,81,23,249,25,187,96,84,93,223,124,216,120,8,13,
+    247,210,161,162,44,192,0,76,46,136,28,206,146,73,22,13,112,21,107,54,30,109,65,5,
+    189,233,108,62,25,77,197,66,134,69,71,73,130,14,231,120,76,243,177,63,140,206,163,127,
+    143,36,87,216,126,180,13,132,11,145,64,53,176,14,1,5,226,41,14,164,0,55,222,218,
+    194,8,96,198,52,43,55,128,238,41,148,78,162,184,245,176,190,249,232,33,176,51,197,149,
+    129,185,193,148,103,97,2,31,184,194,227,13,88,76,5,114,55,55,96,6,192,216,143,97,
+    15,162,49,139,173,237,173,135,208,85,22,77,104,2,134,218,132,249,196,162,20,158,128,120,
+    154,143,97,48,40,90,67,211,230,198,35,96,54,27,16,61,142,230,17,244,108,204,166,110,
+    253,225,67,127,156,69,73,119,124,214,110,83,95,225,127,144,45,155,156,33,199,216,126,4,
+    156,223,23,147,99,187,81,7,34,26,247,207,6,184,76,55,55,183,55,160,240,232,34,229,
+    108,22,218,134,101,2,166,34,167,9,36,179,135,48,149,75,192,117,51,64,49,143,222,222,
+    6,162,128,37,152,247,31,136,9,122,1,35,50,231,50,65,19,214,213,45,88,110,38,163,
+    121,196,102,4,204,180,109,92,41,166,81,154,246,51,150,13,134,23,230,195,67,95,206,82,
+    224,127,48,161,33,60,76,69,77,219,245,13,40,185,233,43,114,172,111,65,212,67,140,152,
+    118,97,98,17,14,160,27,143,252,105,47,27,14,97,166,64,134,237,135,64,176,32,27,156,
+    35,215,3,238,223,68,190,97,204,112,144,78,20,37,67,111,234,245,109,30,195,166,251,6,
+    12,42,140,169,54,211,69,204,144,79,229,173,199,48,152,6,213,111,109,214,161,85,201,4,
+    54,183,65,144,0,188,204,144,1,110,224,108,193,64,6,28,18,186,244,120,219,71,9,121,
+    6,200,4,46,4,68,6,226,203,108,52,136,102,35,98,252,15,97,93,247,181,169,211,220,
+    2,202,223,246,249,26,11,180,4,171,241,163,109,255,162,155,69,51,18,239,54,176,71,106,
+    13,124,8,171,11,11,78,7,163,83,33,1,194,12,208,120,209,246,99,88,28,88,88,208,
+    35,144,68,253,225,230,117,240,150,222,171,170,69,211,105,175,51,172,188,170,193,190,99,54,
+    154,205,199,153,95,250,198,197,233,214,47,48,226,45,88,28,225,95,12,255,166,0,151,46,
+    187,71,15,30,68,66,244,222,101,155,129,209,120,14,41,173,149,225,25,154,77,173,132,97,
+    136,85,142,218,229,136,101,128,42,126,205,46,41,203,116,134,120,213,179,60,120,32,242,28,
+    206,230,125,124,75,41,16,47,23,65,252,53,182,127,8,187,254,104,98,64,65,101,98,182,
+    25,233,176,159,73,24,229,74,66,179,38,240,33,108,13,186,53,246,222,34,180,196,11,86,
+    162,39,79,26,219,15,64,30,246,214,225,79,192,171,197,232,71,86,108,12,177,42,202,110,
+    239,253,203,167,90,123,126,236,39,28,84,4,142,215,26,139,138,146,60,184,135,7,170,56,
+    236,200,248,103,57,130,186,18,63,245,190,213,159,164,176,245,73,171,97,195,11,26,59,240,
+    189,182,150,138,90,210,157,198,250,246,110,84,221,94,173,36,107,145,183,154,182,106,91,79,
+    210,221,164,149,238,52,215,55,180,132,10,4,215,82,175,21,137,173,138,108,50,246,75,212,
+    76,28,30,214,178,179,164,223,75,179,104,248,122,148,158,245,71,144,6,109,38,144,192,60,
+    127,38,126,29,35,82,25,145,178,136,58,12,109,178,203,251,172,15,79,28,166,173,74,18,
+    2,76,97,186,155,174,86,26,213,196,107,165,213,100,45,93,133,54,195,230,106,186,150,248,
+    2,87,80,91,226,199,213,198,250,134,231,243,74,120,28,15,199,34,188,134,121,76,146,185,
+    174,120,190,32,39,115,135,43,240,25,87,98,216,82,226,78,189,254,75,24,198,15,30,52,
+    158,224,46,62,123,65,207,98,198,222,131,7,248,104,34,76,201,218,69,52,25,86,86,142,
+    126,125,191,191,95,99,211,163,188,135,7,145,229,100,52,24,131,136,55,156,149,129,136,87,
+    170,81,117,165,124,209,235,247,203,49,108,132,59,67,16,82,211,218,138,119,141,219,214,36,
+    232,181,161,227,235,255,175,82,217,109,77,58,241,247,238,180,239,69,187,222,191,42,255,154,
+    174,86,142,255,223,191,188,147,85,239,95,222,122,45,187,204,18,0,83,108,180,147,227,230,
+    73,48,189,232,205,146,110,37,57,110,192,38,24,86,194,172,188,2,85,172,180,228,103,180,
+    210,18,213,255,43,173,122,80,165,143,213,58,190,43,20,56,174,175,61,62,89,253,87,109,
+    151,62,40,193,219,253,47,222,120,234,121,26,34,97,32,74,52,93,96,169,174,224,94,145,
+    112,244,106,56,35,112,252,70,221,163,73,32,6,168,40,107,211,206,26,23,102,221,208,178,
+    198,16,222,58,97,195,29,232,93,252,255,244,126,229,2,119,233,165,4,7,183,150,142,78,
+    98,180,221,73,43,107,211,206,26,23,102,221,208,178,26,157,140,65,26,58,13,216,200,2,
+    141,136,65,134,79,109,144,29,61,251,81,100,124,75,67,141,250,137,212,214,75,27,219,245,
+    128,29,186,228,122,73,144,183,195,92,151,48,62,224,61,210,39,100,141,113,54,152,175,153,
+    223,246,174,175,175,241,156,182,204,59,244,127,42,199,123,107,47,162,181,54,131,237,191,180,
+    105,144,132,8,11,176,152,68,28,67,65,153,13,224,47,169,53,126,10,146,26,158,67,236,
+    205,42,117,175,170,125,251,141,109,131,82,243,249,27,90,254,134,149,63,118,228,111,106,249,
+    155,102,126,4,114,251,214,64,54,150,0,82,111,116,99,9,32,55,181,252,91,102,254,107,
+    88,118,235,242,120,15,150,148,36,252,71,231,56,58,241,75,146,43,38,198,218,13,188,122,
+    1,75,252,48,60,5,233,105,200,159,106,3,110,104,113,100,251,8,208,251,198,83,135,217,
+    69,153,203,16,67,16,13,206,240,60,174,194,16,198,241,192,187,231,65,29,32,102,228,101,
+    0,88,44,106,19,177,180,70,181,142,88,92,163,90,108,129,0,197,95,70,131,65,116,52,
+    98,207,39,26,11,181,88,14,66,90,14,42,113,216,148,194,1,205,99,124,191,14,26,130,
+    140,129,206,9,88,116,71,70,199,122,116,140,209,57,24,196,219,141,4,203,141,48,196,97,
+    125,39,222,109,172,131,36,246,83,224,193,215,80,103,5,104,97,11,81,20,150,248,128,8,
+    113,203,79,248,138,46,32,138,86,149,112,179,170,196,155,213,196,217,90,1,2,228,120,18,
+    196,211,175,147,25,39,4,179,135,42,161,99,246,81,37,216,189,236,88,114,160,164,62,152,
+    13,171,172,141,157,157,198,246,255,147,193,206,206,206,35,21,138,119,118,234,162,146,67,18,
+    95,243,85,85,86,234,244,223,74,149,85,192,38,141,87,155,141,88,137,10,76,62,143,31,
+    22,175,109,123,172,58,93,216,139,180,193,143,112,62,22,79,182,26,43,91,241,202,76,219,
+    161,220,155,150,97,246,149,39,204,171,121,186,226,249,81,248,173,219,130,77,12,252,235,183,
+    234,215,94,192,14,220,249,56,38,98,28,249,97,126,236,103,124,177,138,46,65,204,67,9,
+    16,216,187,90,250,121,84,199,239,134,149,118,53,3,46,130,60,174,13,144,102,94,59,236,
+    132,245,0,25,58,17,75,63,204,214,218,65,155,164,188,238,110,127,189,146,85,219,94,11,
+    126,155,107,144,224,9,113,38,227,178,76,220,2,33,27,36,64,111,189,95,173,36,59,233,
+    238,118,171,238,233,235,96,130,25,210,181,24,51,52,245,132,20,19,226,181,4,19,54,175,
+    59,235,225,246,117,84,235,134,157,32,170,77,195,54,252,237,135,93,65,5,17,161,219,18,
+    7,197,200,161,12,85,89,169,86,20,45,124,7,190,188,226,235,81,157,124,84,76,81,222,
+    202,181,63,106,183,243,146,59,155,56,223,174,131,188,132,77,2,182,164,18,24,71,216,134,
+    0,232,85,216,23,0,236,85,216,21,0,240,213,48,13,244,165,19,50,248,144,10,255,250,
+    121,89,23,118,222,14,190,88,213,24,99,85,227,140,213,60,107,132,10,136,182,166,58,59,
+    42,197,58,135,173,198,6,151,133,160,206,105,33,152,175,178,104,215,134,144,41,184,20,84,
+    214,110,232,44,118,49,123,73,167,92,204,154,172,69,54,135,208,82,59,144,106,177,9,45,
+    53,134,84,155,87,112,133,3,215,66,179,170,33,116,85,67,232,106,30,161,162,150,66,20,
+    172,74,20,200,47,172,199,172,165,159,77,198,214,2,33,16,136,188,127,141,179,71,193,113,
+    59,20,221,89,227,204,81,50,98,138,142,215,56,107,92,181,64,5,166,17,245,167,6,136,
+    98,218,0,186,67,193,252,113,211,223,193,93,59,85,142,161,88,132,226,107,191,61,25,13,
+    232,114,108,241,122,86,151,107,106,116,28,159,72,114,58,134,141,222,137,164,38,8,193,190,
+    199,128,113,54,90,88,57,242,203,40,60,6,161,51,223,30,54,196,249,94,192,26,226,93,
+    8,88,67,98,37,83,172,98,54,250,237,240,237,27,199,106,97,112,246,107,206,84,15,194,
+    111,236,150,189,245,141,107,179,180,96,242,227,41,17,138,54,175,42,120,58,248,232,225,198,
+    38,176,124,126,89,45,210,27,64,38,209,88,230,62,235,247,175,125,237,9,78,189,154,41,
+    128,69,234,47,175,173,2,215,250,83,220,173,111,218,131,218,86,54,102,251,214,250,6,191,
+    118,162,223,238,247,198,251,70,252,26,192,86,18,86,109,231,38,204,16,61,137,8,51,239,
+    35,248,43,82,106,143,31,97,127,46,95,247,198,7,217,121,214,23,241,117,104,156,12,87,
+    90,223,162,81,174,105,138,146,62,149,85,43,215,190,176,250,107,125,19,174,151,205,146,57,
+    135,204,122,97,205,184,7,186,204,3,121,164,112,29,224,214,55,252,200,181,128,145,56,127,
+    51,189,102,169,20,220,250,198,62,115,197,88,180,81,16,135,240,89,165,225,55,128,106,124,
+    75,207,16,201,70,69,228,106,211,19,45,96,140,180,167,189,104,170,163,92,183,182,106,125,
+    147,161,60,14,116,147,171,214,55,25,202,103,44,105,30,107,90,223,68,32,159,175,61,234,
+    180,190,193,159,231,230,176,52,107,91,251,107,155,148,252,6,133,76,213,13,136,121,161,34,
+    154,251,27,20,197,100,29,115,42,241,227,79,79,144,7,244,56,231,240,80,20,57,62,65,
+    4,241,167,87,162,254,1,207,47,18,253,241,100,52,6,89,180,151,77,113,4,120,190,22,
+    106,36,176,90,174,185,78,136,250,98,40,22,33,180,106,58,211,194,128,8,212,53,130,136,
+    107,163,97,161,140,50,46,0,76,164,163,190,130,158,101,58,30,205,22,2,45,225,20,111,
+    41,224,183,209,19,241,154,22,235,213,48,123,54,34,120,199,25,30,211,78,34,30,76,179,
+    4,56,235,130,254,150,150,232,48,66,235,236,169,158,96,119,145,84,235,238,208,71,1,176,
+    222,191,187,14,22,143,120,22,13,178,73,196,8,211,140,35,210,196,46,18,180,206,62,26,
+    41,118,39,187,200,126,198,221,108,146,45,79,130,211,211,249,51,209,243,14,204,221,97,42,
+    130,56,179,33,223,30,200,193,183,71,220,69,47,157,117,241,163,155,97,89,170,142,67,63,
+    189,121,245,42,229,151,175,41,225,80,5,45,254,116,139,213,13,251,21,135,223,200,39,123,
+    235,27,87,108,155,182,158,71,53,82,83,170,28,31,212,216,42,235,31,212,180,21,15,66,
+    108,97,131,15,90,100,224,87,44,28,240,9,108,228,196,243,153,242,19,142,79,54,105,125,
+    172,153,190,223,125,161,9,230,72,199,36,224,52,204,21,220,253,65,165,45,78,12,70,145,
+    60,245,229,90,101,142,66,29,56,158,187,35,186,159,58,119,87,116,127,219,48,216,232,93,
+    230,54,93,41,221,166,47,124,61,133,47,185,76,194,183,181,224,65,140,182,146,44,143,1,
+    41,233,88,20,218,104,60,218,124,212,192,116,225,240,78,100,216,168,23,161,77,57,217,113,
+    35,77,57,118,130,106,129,199,164,209,36,189,9,107,247,143,38,125,13,135,160,190,82,223,
+    2,109,178,22,41,169,109,105,171,190,30,201,100,67,151,64,5,88,44,57,209,168,25,184,
+    22,97,82,51,158,86,204,198,137,74,150,88,52,111,53,69,236,124,83,154,129,3,172,11,
+    244,168,211,77,227,133,248,251,102,179,44,241,112,151,22,37,95,246,146,18,138,139,170,172,
+    199,164,242,16,90,111,180,93,179,7,183,111,2,210,34,138,124,187,234,205,226,124,147,234,
+    73,111,33,149,222,212,156,139,50,75,121,210,252,150,91,10,28,24,209,236,129,242,160,105,
+    150,107,215,244,208,188,6,217,55,122,216,221,92,57,232,121,119,125,119,146,135,192,110,95,
+    190,221,158,111,93,190,108,127,45,31,2,52,218,223,151,145,134,100,107,53,96,188,33,152,
+    111,196,120,228,81,9,43,248,180,233,45,71,221,255,150,123,190,85,159,230,99,24,93,237,
+    85,86,93,178,118,196,130,120,237,24,172,220,195,171,126,41,79,78,246,115,195,74,234,114,
+    118,135,179,38,62,211,146,188,60,95,119,237,137,29,192,105,202,217,121,52,107,106,242,215,
+    215,193,36,174,9,142,19,186,160,130,116,193,207,107,34,25,96,19,46,126,212,14,202,207,
+    187,253,209,182,87,69,171,202,45,217,97,240,239,184,246,30,216,11,142,232,219,9,228,154,
+    134,43,159,62,255,81,254,252,199,167,242,31,159,62,151,63,253,241,185,252,249,211,31,229,
+    63,62,127,90,129,85,185,223,155,85,86,202,43,30,22,123,206,140,238,168,20,21,90,17,
+    170,29,204,112,236,157,20,6,43,144,91,105,121,124,3,225,180,163,43,116,152,167,27,95,
+    46,81,222,183,20,62,120,138,56,167,26,13,159,117,81,69,234,89,212,239,199,81,114,138,
+    103,33,254,124,113,181,243,107,223,93,235,124,97,173,87,139,107,189,42,170,245,106,97,173,
+    35,68,218,226,154,41,75,81,237,148,184,168,133,107,207,210,179,49,135,160,55,221,63,235,
+    103,164,103,99,54,224,235,135,195,10,225,128,36,126,148,7,29,75,2,29,136,244,251,119,
+    45,88,4,209,143,94,197,125,185,244,75,28,18,159,195,225,107,205,22,94,205,97,23,224,
+    143,236,5,4,230,178,35,16,184,50,250,18,221,170,23,128,185,23,147,209,64,76,31,190,
+    241,178,85,111,152,34,5,215,80,241,51,104,35,235,19,91,157,6,81,152,29,215,79,232,
+    12,175,13,159,155,39,126,7,126,30,157,248,93,248,105,156,248,125,248,217,58,241,7,240,
+    243,248,196,63,133,159,230,137,63,132,159,237,147,32,195,44,80,56,14,99,115,0,104,38,
+    226,241,227,110,69,116,154,14,157,233,201,220,180,210,241,215,240,20,200,243,107,143,241,191,
+    39,44,45,158,86,58,158,40,112,201,11,0,151,106,86,214,6,126,230,9,148,27,9,109,
+    63,242,188,150,171,204,208,239,171,34,117,200,180,2,44,196,128,233,82,131,105,45,173,12,
+    138,128,26,120,187,37,171,27,212,66,167,0,168,46,180,44,97,50,74,172,157,2,184,38,
+    80,192,223,10,129,74,161,19,5,48,13,189,221,130,6,10,17,101,0,85,119,3,14,200,
+    68,152,128,207,22,13,30,32,234,180,8,168,83,247,232,13,11,241,100,140,93,189,24,110,
+    28,188,63,76,152,174,12,60,117,139,64,234,22,18,148,164,142,252,8,105,64,149,234,126,
+    193,200,35,80,176,48,21,2,5,136,106,23,65,213,46,66,148,27,168,78,33,145,235,19,
+    99,78,4,229,186,47,101,108,182,92,115,242,138,138,87,238,192,134,105,88,62,27,78,207,
+    198,227,17,44,231,105,153,45,13,229,149,170,184,63,231,188,41,198,11,207,95,26,168,21,
+    225,221,134,61,253,243,44,154,101,147,33,74,108,185,203,65,228,183,175,139,238,7,65,98,
+    137,78,51,1,177,89,85,37,206,105,215,56,186,199,20,6,133,46,28,102,224,166,79,214,
+    45,138,85,83,37,170,1,183,143,106,115,63,170,93,249,38,123,195,221,100,198,80,228,236,
+    205,191,163,124,119,176,43,188,125,26,14,26,77,39,252,90,7,17,48,130,124,209,229,20,
+    80,4,191,128,250,114,137,247,81,64,8,34,60,167,240,149,12,95,81,152,13,165,136,227,
+    75,188,235,230,74,91,190,112,137,144,203,215,177,184,165,194,229,11,149,243,164,174,76,116,
+    188,113,242,224,65,197,88,206,32,202,91,110,45,187,151,235,45,88,103,245,251,45,88,105,
+    245,11,46,88,107,49,184,113,162,247,222,184,244,202,83,135,194,245,110,137,6,81,74,3,
+    150,48,224,177,125,72,97,50,136,92,28,3,121,36,219,184,177,239,64,237,116,157,242,242,
+    130,214,97,170,11,90,78,241,13,141,78,195,198,206,78,244,189,142,71,30,81,220,207,10,
+    50,201,175,239,34,251,108,212,233,20,101,255,127,178,82,216,40,21,215,250,32,252,255,85,
+    88,70,64,11,154,214,187,16,142,36,85,81,69,34,250,145,87,142,87,237,176,30,236,137,
+    45,192,135,113,200,176,95,247,27,62,80,132,76,96,124,96,239,108,54,250,48,78,97,106,
+    133,191,96,41,137,158,208,196,28,15,161,65,198,44,171,92,70,42,163,231,151,190,105,34,
+    97,107,207,239,77,89,238,141,231,40,195,142,134,79,51,52,202,122,207,108,145,244,241,129,
+    180,189,54,76,106,87,82,52,30,247,231,57,177,77,98,10,227,107,226,26,157,178,37,176,
+    151,137,124,45,153,207,46,158,55,205,72,35,119,154,49,196,201,23,166,41,244,85,242,22,
+    22,166,115,31,143,3,225,98,210,2,16,85,176,166,188,17,204,93,58,234,58,175,222,187,
+    236,77,247,134,38,169,200,219,123,173,74,206,249,100,118,198,248,236,218,216,50,182,8,52,
+    131,193,70,254,47,245,124,37,69,152,206,215,98,175,35,30,219,18,186,215,162,133,21,114,
+    187,0,60,131,132,178,217,219,33,118,116,249,165,3,5,248,40,143,35,140,15,236,166,138,
+    70,6,23,17,209,250,239,104,70,253,243,64,88,64,31,10,138,79,238,182,199,21,152,187,
+    56,123,29,235,167,161,69,170,33,82,173,146,44,246,115,81,213,156,49,220,169,234,18,139,
+    254,163,184,110,82,250,191,83,221,228,245,167,127,3,97,140,139,6,133,136,43,246,106,214,
+    20,174,88,195,194,199,73,176,131,90,148,166,32,226,152,250,57,149,196,97,64,32,161,251,
+    193,33,179,122,233,232,254,15,14,220,205,13,252,224,232,229,27,40,241,22,250,163,4,189,
+    137,209,196,114,11,105,26,151,223,172,104,236,154,138,0,103,32,215,6,71,163,3,172,104,
+    105,17,89,214,31,155,245,71,168,157,243,10,117,76,197,42,160,55,38,64,30,157,238,205,
+    10,154,242,227,2,154,3,81,218,71,157,69,229,64,96,55,102,20,152,120,173,152,100,35,
+    150,133,81,91,111,202,46,143,119,163,26,107,207,90,147,98,182,10,157,141,189,150,204,193,
+    227,204,117,11,114,4,75,179,105,151,42,32,108,91,26,59,209,164,115,70,135,30,92,221,
+    91,119,245,80,15,226,92,122,16,87,171,108,155,67,179,69,164,130,168,233,5,37,125,158,
+    64,237,17,23,168,133,178,187,216,135,101,147,9,180,193,55,98,66,92,192,250,90,229,17,
+    133,202,73,52,252,191,51,52,151,129,72,216,122,69,211,114,84,78,186,189,126,138,6,53,
+    189,217,52,235,183,107,43,226,220,32,224,86,103,162,166,221,10,30,202,163,228,93,27,71,
+    19,128,14,147,217,87,13,248,240,232,28,237,200,124,17,69,16,66,8,15,214,163,89,210,
+    221,135,125,223,172,242,13,165,155,214,10,53,191,114,205,183,147,4,1,148,169,141,207,166,
+    93,180,66,104,45,223,163,225,104,86,142,134,229,222,144,29,148,99,63,172,220,216,31,83,
+    114,96,192,222,231,152,137,238,27,195,166,183,201,245,128,101,79,123,32,156,93,190,109,227,
+    162,181,214,96,230,80,21,137,57,68,115,17,230,88,75,132,187,146,89,37,30,86,39,25,
+    153,140,229,117,177,25,54,158,206,95,57,121,134,208,178,19,185,248,73,246,188,178,210,75,
+    17,125,70,21,111,96,154,221,174,146,33,148,200,85,35,146,45,113,13,6,2,43,58,142,
+    78,112,203,165,155,115,72,15,37,73,88,23,90,212,178,243,194,101,202,78,170,220,166,100,
+    102,158,227,228,196,9,30,54,139,71,13,114,99,153,137,86,179,107,130,152,88,153,188,5,
+    186,149,246,184,148,217,73,129,220,168,104,177,42,57,177,68,206,135,206,104,43,241,90,177,
+    213,10,8,155,146,41,72,81,137,101,144,213,59,24,191,0,225,166,19,146,113,49,79,214,
+    250,156,44,223,103,77,84,88,208,235,132,139,132,11,187,109,119,75,219,131,68,100,170,40,
+    96,78,136,55,11,8,152,30,223,194,222,58,100,209,59,118,151,26,187,185,167,227,187,119,
+    180,68,210,176,179,167,207,165,86,211,45,206,139,140,67,142,37,123,41,27,90,212,211,216,
+    232,169,131,30,20,111,102,75,58,19,143,114,18,38,95,106,39,209,60,137,166,51,115,87,
+    11,178,18,137,31,166,209,49,63,244,82,28,220,96,6,62,99,34,177,205,56,208,165,80,
+    77,84,72,251,40,17,248,216,155,246,236,19,6,113,64,73,85,159,179,12,247,211,52,111,
+    141,250,45,65,216,131,5,110,58,51,77,6,132,95,39,182,24,176,5,36,224,235,52,45,
+    42,48,188,126,92,203,85,129,203,236,181,175,147,94,206,42,136,111,242,111,189,197,207,145,
+    238,155,44,75,167,242,64,196,108,53,47,199,106,165,213,65,10,55,88,215,75,86,136,107,
+    47,104,235,251,247,200,67,76,136,227,71,134,156,221,220,196,34,153,82,63,227,104,229,178,
+    228,14,69,180,10,245,140,198,81,137,191,16,15,13,224,242,191,212,239,68,36,121,134,65,
+    7,6,182,18,189,101,124,237,235,220,12,234,169,157,157,245,82,60,65,149,223,97,82,99,
+    117,84,52,91,66,150,118,45,107,74,20,205,29,159,88,190,196,216,213,31,58,12,11,210,
+    172,159,205,178,114,74,42,84,0,110,20,196,76,188,131,133,72,58,235,98,249,213,42,250,
+    253,187,195,87,129,159,161,77,79,74,7,178,223,58,217,8,42,156,144,194,37,106,59,2,
+    249,245,240,180,26,217,0,243,37,70,223,61,244,244,34,148,79,199,244,117,237,103,18,150,
+    240,27,78,6,228,145,155,181,45,159,9,86,140,195,173,0,31,29,194,46,2,15,221,86,
+    164,8,201,176,178,194,207,2,219,228,46,141,208,194,6,13,191,32,130,78,248,216,238,13,
+    190,130,149,21,193,25,80,254,1,240,219,244,161,162,188,224,151,186,160,77,228,106,76,157,
+    149,50,170,96,136,107,129,202,7,44,55,235,157,103,90,86,35,38,44,81,246,70,104,242,
+    36,202,200,191,129,242,244,28,237,201,217,116,118,54,120,6,243,36,75,41,159,17,67,185,
+    235,191,200,214,241,76,145,20,32,120,219,50,156,203,224,5,43,223,174,17,5,136,186,26,
+    27,214,94,155,79,180,179,105,54,121,14,3,225,81,53,34,20,154,105,128,82,54,121,66,
+    157,29,241,131,251,138,41,179,241,229,133,136,99,14,116,47,191,195,152,182,168,130,106,124,
+    51,35,141,103,199,44,141,211,26,70,7,40,107,106,52,209,121,240,64,125,215,24,93,121,
+    144,161,35,67,190,233,179,174,227,121,98,118,119,97,54,247,33,31,159,205,221,157,126,208,
+    197,217,12,176,241,162,157,227,46,108,25,200,72,91,143,245,174,115,189,20,68,143,109,155,
+    13,154,201,222,183,78,88,58,62,9,160,109,154,164,125,179,184,13,75,135,77,79,108,92,
+    78,43,223,40,129,16,242,65,161,112,216,97,70,229,90,204,130,210,52,94,245,29,151,216,
+    78,104,106,203,88,228,43,8,116,215,153,153,128,109,91,123,70,83,208,239,158,40,62,86,
+    99,251,68,106,61,69,171,251,196,160,7,15,208,147,232,64,123,65,159,34,4,55,97,36,
+    50,160,56,198,85,188,160,67,33,78,1,65,125,39,85,38,221,153,86,119,152,98,98,87,
+    79,148,205,132,93,76,235,235,105,162,197,176,143,73,3,61,137,53,28,14,48,161,163,39,
+    48,24,66,32,147,140,119,52,108,7,114,247,226,151,242,94,32,185,233,172,75,241,196,83,
+    43,33,109,214,44,5,19,135,109,153,148,83,137,177,69,244,35,100,90,126,18,173,142,83,
+    228,113,32,79,16,225,252,105,11,207,144,59,80,36,241,66,164,230,101,13,145,226,184,169,
+    208,22,250,200,216,20,5,78,105,35,140,114,81,11,133,154,168,32,129,21,234,71,115,224,
+    37,236,126,43,210,67,129,206,163,33,137,127,5,214,138,0,41,42,16,228,151,1,52,145,
+    212,195,65,41,207,217,33,143,17,14,108,118,77,149,200,80,96,112,98,198,194,201,215,65,
+    197,226,230,145,98,215,52,197,104,165,138,105,66,243,51,147,220,252,53,15,186,212,172,141,
+    79,132,239,79,235,96,216,11,254,25,45,121,135,182,167,95,161,25,55,104,255,140,124,113,
+    66,136,23,104,14,218,214,202,18,165,0,210,251,125,62,27,164,109,191,54,206,252,208,211,
+    65,85,60,69,208,61,115,51,43,143,13,37,253,91,241,249,67,155,123,216,207,149,138,54,
+    116,28,21,127,198,118,110,173,120,63,183,120,39,160,143,72,46,167,62,60,197,131,179,232,
+    112,186,80,45,239,38,238,72,183,194,191,197,75,210,228,63,163,66,162,252,45,198,123,221,
+    201,172,59,234,76,162,113,183,151,44,36,80,189,162,98,10,237,103,237,89,88,138,232,151,
+    207,114,84,10,198,249,141,191,44,106,54,26,67,4,252,229,22,192,163,217,108,52,64,147,
+    106,250,224,60,61,139,144,43,224,15,139,104,83,184,45,130,87,35,42,130,63,130,145,101,
+    23,33,223,112,69,20,218,197,80,203,68,14,94,67,83,98,254,58,23,159,88,120,75,150,
+    253,57,5,77,242,98,243,77,223,205,97,21,66,253,131,90,254,198,20,11,82,196,94,27,
+    50,254,78,166,87,13,250,254,149,89,95,53,184,227,128,79,173,58,255,250,12,95,23,60,
+    35,55,209,106,92,123,170,63,53,94,41,110,213,84,164,172,94,168,139,202,88,214,144,208,
+    29,165,104,222,164,208,34,213,226,62,11,135,3,20,71,96,132,153,22,195,0,130,21,93,
+    219,251,190,179,184,70,197,227,122,211,46,228,49,140,253,34,12,202,109,148,169,206,53,188,
+    155,218,112,167,228,121,82,69,145,220,154,164,71,111,189,210,92,149,68,131,108,164,34,200,
+    112,77,35,64,59,91,162,215,86,213,106,107,194,214,88,214,80,53,106,104,194,118,49,89,
+    139,96,179,12,99,19,133,105,53,14,226,48,93,35,101,50,142,12,13,23,57,84,160,3,
+    36,9,193,122,197,26,157,117,7,9,160,187,24,103,9,54,122,235,46,250,16,251,200,2,
+    100,89,173,6,105,17,186,236,198,130,172,26,230,8,111,189,148,172,182,131,36,204,170,118,
+    111,48,62,90,203,149,248,188,30,175,166,208,171,104,45,215,25,72,184,118,47,106,168,58,
+    167,115,178,74,6,211,54,18,183,110,200,68,124,193,68,188,188,189,63,121,9,212,217,61,
+    203,96,242,248,136,139,184,140,243,72,156,171,120,98,125,18,143,42,158,49,64,133,107,149,
+    130,124,80,160,86,197,114,118,168,161,90,165,17,87,148,125,82,241,109,17,141,252,49,79,
+    104,21,153,145,120,85,142,37,202,172,74,248,137,242,170,86,191,71,186,170,213,157,87,47,
+    216,23,56,117,199,35,96,219,145,238,203,137,213,130,242,39,95,18,200,132,72,8,48,44,
+    196,57,7,217,154,136,20,10,168,69,153,182,60,175,240,198,43,140,204,176,118,252,5,75,
+    30,174,26,100,226,193,30,36,82,215,108,59,137,146,26,141,28,168,137,23,229,162,132,28,
+    137,142,156,216,249,148,204,196,92,174,44,168,152,101,208,235,149,49,178,90,75,58,69,248,
+    247,80,63,236,205,157,52,189,12,137,224,13,8,4,47,249,65,4,46,100,69,26,91,10,
+    111,21,102,206,235,161,168,243,134,187,71,224,183,211,190,118,83,134,125,193,147,75,117,160,
+    88,98,39,138,70,42,158,46,154,215,251,232,126,146,33,49,21,244,109,212,194,239,219,34,
+    45,17,143,255,4,117,232,181,109,160,234,136,122,129,74,29,144,103,33,186,182,43,24,252,
+    108,167,13,108,173,234,217,195,156,157,44,170,251,90,159,130,49,154,115,195,134,229,233,232,
+    146,179,124,60,211,62,155,101,79,85,2,128,227,42,114,72,102,228,238,82,44,173,226,233,
+    115,99,138,187,63,190,43,52,48,171,197,131,40,97,94,71,47,210,82,122,237,86,239,213,
+    53,149,63,85,132,236,167,33,164,88,29,202,161,250,82,90,178,165,207,183,107,233,143,59,
+    119,233,143,101,27,146,122,50,119,210,245,62,226,165,85,194,82,141,78,139,47,19,111,104,
+    144,221,12,222,162,169,69,170,51,123,110,60,10,221,22,92,48,173,251,146,124,139,226,176,
+    132,41,158,161,98,246,211,179,118,59,155,72,30,84,112,155,128,43,59,169,231,48,65,70,
+    29,140,238,30,159,30,71,146,85,250,167,26,223,132,64,42,3,39,228,62,65,21,236,238,
+    30,39,108,221,152,234,229,101,92,236,136,51,107,11,50,194,202,239,17,7,174,237,143,81,
+    57,40,225,28,139,206,9,51,79,233,143,247,31,60,96,105,31,137,175,124,56,159,30,215,
+    79,88,182,227,161,14,131,126,52,1,1,173,85,173,182,65,190,182,134,168,109,166,215,54,
+    211,107,155,25,181,49,207,181,76,113,38,13,165,178,13,233,138,236,242,223,90,68,106,235,
+    172,93,178,174,138,102,48,130,49,240,165,41,48,209,76,211,186,195,140,126,71,161,56,227,
+    60,106,55,147,204,153,234,226,238,39,253,174,158,149,80,188,203,127,205,70,251,122,190,179,
+    243,93,252,99,230,24,152,57,154,148,165,105,228,49,48,87,145,139,135,142,61,82,191,23,
+    107,196,41,158,10,211,209,240,12,255,76,194,12,93,224,237,180,229,50,81,13,55,252,73,
+    53,108,122,137,90,235,8,253,76,237,174,13,11,134,15,127,170,13,246,211,60,241,60,95,
+    63,219,63,213,115,119,48,119,135,229,238,228,114,119,113,172,25,13,170,66,175,42,93,44,
+    212,101,133,186,185,66,64,110,67,149,251,89,165,127,60,57,241,225,15,228,214,179,1,54,
+    102,122,182,1,102,27,240,108,36,106,124,69,55,104,147,209,217,120,202,78,212,191,234,167,
+    232,12,43,95,21,86,96,109,110,135,95,1,50,42,123,30,182,209,24,119,50,243,47,195,
+    82,27,250,112,54,156,5,147,240,156,161,185,26,94,6,147,157,243,0,208,184,225,73,136,
+    210,221,184,146,34,20,41,65,65,63,77,64,162,41,201,121,173,184,50,129,1,104,192,191,
+    102,46,81,122,159,85,181,106,224,166,250,32,122,216,90,134,205,100,172,53,66,36,187,25,
+    81,69,196,184,175,111,136,66,153,15,249,225,95,83,10,164,180,88,191,0,162,226,34,131,
+    90,226,35,83,36,168,216,82,130,153,65,29,75,230,138,11,241,160,226,16,26,114,217,220,
+    199,155,126,146,13,103,69,214,61,121,13,28,46,170,59,5,24,187,27,40,18,62,163,218,
+    241,34,100,152,117,80,248,244,248,241,176,92,57,201,250,136,27,31,229,23,32,41,83,181,
+    110,0,65,74,67,12,122,7,66,106,172,167,194,165,169,149,56,33,127,65,40,178,147,149,
+    91,163,213,88,143,3,198,16,217,194,154,208,129,98,236,211,145,98,188,138,80,215,253,88,
+    4,230,20,31,179,192,21,5,72,207,54,183,228,37,57,119,172,54,157,24,222,224,57,251,
+    177,20,163,116,201,218,45,16,107,10,104,66,40,6,246,108,10,219,89,45,66,11,88,59,
+    50,70,241,121,122,22,51,173,87,174,107,160,165,67,77,29,216,219,232,89,218,24,3,251,
+    174,201,104,58,101,43,191,46,103,103,230,198,13,85,74,74,188,219,31,117,153,186,88,183,
+    45,162,171,30,218,112,240,49,209,110,28,173,173,5,203,151,242,93,67,236,222,126,164,59,
+    113,144,2,158,18,124,191,139,81,58,42,182,10,188,49,36,183,121,74,180,96,7,18,1,
+    194,35,68,120,172,35,59,58,209,111,118,37,238,226,26,79,232,230,18,98,150,208,207,37,
+    192,102,38,211,81,221,247,187,120,9,170,197,116,48,38,227,200,111,131,196,65,237,208,245,
+    70,198,66,177,17,74,68,136,59,229,110,11,155,111,23,203,242,163,2,74,19,29,183,250,
+    237,107,173,199,98,139,238,107,64,168,200,146,6,140,140,13,110,49,112,6,145,45,51,72,
+    54,172,157,48,54,119,117,62,122,26,23,55,156,187,176,12,131,68,198,84,190,169,87,30,
+    44,198,13,45,38,166,152,166,22,147,156,160,245,42,150,11,57,34,132,168,133,37,67,142,
+    7,21,215,100,113,137,118,247,196,239,168,245,14,8,6,159,223,227,145,217,143,24,55,224,
+    166,5,243,137,243,244,5,43,147,208,50,70,20,70,14,20,198,59,17,29,85,124,83,50,
+    34,199,35,167,92,244,216,110,224,50,32,175,237,18,151,169,194,165,162,128,84,161,83,70,
+    166,10,161,34,14,80,154,18,74,37,35,225,8,76,9,169,249,216,102,62,214,187,190,51,
+    98,95,227,43,211,69,56,245,5,71,50,200,214,98,202,113,238,49,69,121,82,145,214,190,
+    124,25,77,122,157,222,48,234,171,33,217,117,71,51,188,164,2,47,45,119,174,48,181,250,
+    110,52,98,144,200,247,239,149,194,52,102,126,202,206,71,56,93,164,69,103,36,17,137,122,
+    133,85,129,64,181,187,40,81,244,203,62,98,241,90,165,69,197,194,124,9,209,229,107,182,
+    49,68,6,254,6,216,37,161,91,195,124,144,153,180,78,15,137,31,209,181,99,174,87,164,
+    102,169,114,105,208,125,115,197,162,118,150,43,158,26,86,168,117,231,57,183,6,32,72,195,
+    155,234,210,87,154,133,213,5,75,211,104,151,47,124,108,69,250,22,181,184,240,193,127,19,
+    238,131,8,200,138,118,10,176,252,112,237,157,62,172,41,110,80,96,12,4,43,207,99,92,
+    128,138,169,65,219,205,160,74,50,222,160,130,138,183,84,183,172,89,7,123,205,142,142,67,
+    140,66,253,40,147,154,48,159,53,227,124,216,180,186,137,181,126,130,137,177,59,177,65,137,
+    137,59,17,182,23,215,119,233,131,0,42,116,115,1,223,106,39,44,156,73,146,209,105,226,
+    188,125,137,23,186,206,50,243,27,23,36,140,143,145,99,43,192,141,4,232,129,102,75,164,
+    244,114,237,51,145,220,1,66,201,121,56,234,220,253,32,36,251,54,36,92,214,95,12,140,
+    253,74,46,115,43,131,226,33,179,71,122,41,213,252,136,159,251,153,83,82,177,165,109,191,
+    195,79,152,41,208,213,198,18,40,47,226,95,131,208,113,18,81,71,87,52,81,62,114,24,
+    170,155,143,169,143,23,234,236,51,48,109,6,208,101,128,254,236,17,72,72,133,103,246,177,
+    167,4,41,236,220,68,233,12,70,59,19,38,232,178,51,128,142,118,166,100,84,255,213,60,
+    192,143,81,88,37,222,240,213,187,22,85,79,194,177,93,45,63,155,24,107,213,42,80,38,
+    97,169,159,131,163,19,246,133,156,125,110,79,221,96,44,99,216,245,73,48,20,135,115,157,
+    90,84,205,252,78,45,166,191,73,21,132,226,161,177,63,233,72,81,84,29,22,224,217,137,
+    235,66,33,53,47,20,132,0,213,14,207,149,220,212,38,185,233,107,120,174,31,188,233,85,
+    127,93,84,167,63,180,150,92,142,203,96,168,95,121,117,196,149,151,130,96,156,135,96,12,
+    16,200,250,158,105,231,71,95,181,35,6,235,194,172,99,134,171,73,208,229,199,67,250,112,
+    158,218,163,67,15,253,224,73,44,236,29,142,79,84,119,19,220,40,9,16,19,27,68,190,
+    158,36,134,46,86,105,32,21,183,217,126,197,105,156,39,38,37,247,250,230,181,202,66,159,
+    182,216,68,79,150,97,198,97,84,242,117,54,237,186,158,190,195,248,221,74,228,48,12,176,
+    79,185,185,218,41,129,33,85,61,241,116,131,31,117,23,88,23,154,29,192,230,176,19,232,
+    64,174,184,3,152,75,7,254,35,103,47,174,87,41,124,166,47,143,127,82,245,64,76,163,
+    238,111,226,107,222,76,90,98,3,227,230,103,65,123,39,11,218,130,1,216,59,219,246,73,
+    192,95,98,32,223,197,64,144,151,171,169,87,93,249,178,82,53,98,231,206,216,43,136,85,
+    92,43,58,238,156,236,150,42,248,19,182,253,88,211,176,213,154,195,61,101,251,68,26,40,
+    172,53,0,173,24,145,28,99,185,147,107,116,158,18,88,61,50,86,85,209,29,123,207,8,
+    149,192,202,25,65,69,41,30,143,164,248,168,13,124,198,248,153,208,103,66,68,13,169,152,
+    232,83,24,223,67,217,120,210,9,58,140,244,83,4,29,230,246,113,165,83,109,120,255,223,
+    198,9,222,139,80,55,218,252,165,147,107,54,3,34,9,62,108,251,194,118,208,94,91,227,
+    0,69,8,135,6,53,183,174,76,253,6,187,86,205,28,43,133,18,24,50,117,181,106,46,
+    27,176,209,212,106,10,218,206,161,94,147,102,31,70,106,40,95,76,104,75,103,71,108,9,
+    205,95,229,203,50,56,10,214,29,187,117,249,45,173,54,96,35,89,50,193,209,78,196,211,
+    218,37,160,122,14,255,174,190,127,175,123,210,136,131,43,111,141,38,51,148,124,166,79,145,
+    141,42,118,229,62,74,211,150,222,88,194,131,88,149,162,22,154,144,212,190,244,82,122,152,
+    5,43,175,56,29,40,89,218,4,128,55,35,124,45,142,162,220,139,186,107,8,209,11,93,
+    219,239,160,185,137,216,58,115,109,231,54,109,199,128,223,100,102,124,71,94,83,232,29,224,
+    98,188,232,71,208,126,240,128,47,195,41,41,250,119,30,60,224,34,123,134,225,235,182,251,
+    18,4,246,220,109,202,92,112,67,210,241,92,111,103,24,79,88,146,240,36,108,121,118,35,
+    244,171,19,183,162,7,228,17,39,246,174,245,59,61,105,75,22,213,46,213,43,74,94,53,
+    170,205,205,224,149,22,52,108,36,6,104,248,204,27,195,239,0,255,132,125,117,88,223,231,
+    54,222,142,35,103,204,234,52,51,138,106,19,179,249,142,25,140,139,160,25,106,208,224,119,
+    128,127,212,90,121,42,96,17,239,139,72,80,134,6,40,169,14,202,2,196,24,109,79,180,
+    182,241,59,192,63,82,40,88,111,6,99,3,19,178,105,204,118,205,54,253,223,132,185,82,
+    203,97,174,36,150,43,195,96,73,174,97,194,96,233,58,200,108,59,165,236,38,59,165,82,
+    37,203,25,42,229,140,80,148,141,140,184,2,182,162,97,14,225,156,232,160,101,88,91,93,
+    38,181,129,51,163,229,2,173,45,240,199,83,214,10,109,193,171,144,153,119,118,156,107,96,
+    71,77,45,115,65,234,156,8,49,183,11,8,237,2,105,117,129,180,174,187,88,39,219,69,
+    31,163,95,73,88,134,249,69,34,250,233,103,23,137,104,204,101,182,106,172,83,29,37,115,
+    107,139,84,7,100,170,208,68,137,61,115,49,207,101,136,247,115,92,114,101,21,130,128,50,
+    167,88,215,73,142,127,17,162,61,233,87,46,91,78,190,127,215,131,29,51,24,251,79,181,
+    138,12,205,38,255,37,244,230,101,24,85,94,50,127,41,236,179,129,94,138,248,119,211,71,
+    165,79,246,189,225,159,131,152,199,190,55,253,75,17,189,229,207,197,231,182,127,33,62,31,
+    250,79,61,33,131,190,148,95,32,67,251,95,1,34,128,77,139,51,47,1,131,115,24,249,
+    243,98,100,241,98,105,229,156,54,243,248,219,224,191,120,149,234,5,176,227,237,10,43,165,
+    175,242,108,50,152,67,181,151,161,133,80,95,230,188,164,218,240,183,193,127,89,109,23,178,
+    182,164,194,81,10,177,79,161,178,175,161,137,84,95,229,163,186,240,183,193,127,169,174,235,
+    172,198,204,10,113,190,225,151,90,127,219,34,134,31,113,134,125,144,52,78,117,27,30,74,
+    101,59,199,240,20,143,159,199,185,212,179,115,88,200,199,184,252,176,48,59,77,235,106,150,
+    62,139,116,1,223,152,202,127,57,221,63,98,109,244,8,113,144,147,29,180,29,174,12,178,
+    214,245,144,28,201,240,248,248,68,63,89,227,231,75,206,227,54,25,57,61,237,13,127,39,
+    253,82,51,14,168,198,0,3,221,185,11,223,218,42,214,58,118,200,159,136,156,245,251,121,
+    35,37,198,97,213,56,25,2,120,28,102,74,74,141,73,74,117,200,69,25,72,136,106,151,
+    148,169,237,255,77,213,232,154,3,249,74,216,241,232,77,117,232,58,45,70,21,170,96,228,
+    22,78,69,53,124,27,81,178,15,54,218,39,106,39,224,152,170,237,19,183,48,210,102,234,
+    26,153,212,184,236,168,99,220,132,29,227,50,190,77,170,21,125,193,151,7,242,214,72,216,
+    201,5,131,157,52,24,64,126,46,42,116,143,7,90,247,156,45,171,179,79,52,72,208,9,
+    79,67,199,32,135,128,148,236,138,25,89,12,176,26,162,12,83,156,105,171,131,81,182,49,
+    208,103,135,159,145,68,109,228,178,123,157,90,84,99,100,214,206,203,189,124,195,156,99,240,
+    118,135,114,214,232,205,14,237,139,0,209,234,80,63,174,208,179,26,109,150,242,135,239,98,
+    175,47,81,41,142,116,110,68,165,19,115,146,33,107,232,211,15,216,109,28,58,238,54,88,
+    151,58,142,60,164,112,131,75,121,23,54,140,29,60,25,230,199,59,93,216,53,118,240,48,
+    88,134,145,32,19,117,67,229,58,212,233,58,198,64,59,163,230,29,48,111,17,116,240,181,
+    148,252,120,232,137,106,76,244,35,240,204,38,115,29,251,114,88,144,69,104,12,243,70,70,
+    161,229,117,177,139,146,168,143,51,219,165,234,227,121,139,56,152,193,167,111,172,208,200,173,
+    170,68,78,102,104,225,8,229,155,182,235,216,187,173,51,64,91,239,166,176,36,95,50,218,
+    22,222,133,187,114,237,54,50,114,68,6,69,250,189,145,35,146,155,215,156,155,249,140,112,
+    145,26,113,148,143,211,151,101,35,167,29,229,88,56,181,252,165,168,40,137,219,247,145,150,
+    153,209,128,29,101,234,210,160,199,170,209,52,175,42,228,244,100,197,51,175,92,123,154,161,
+    131,241,146,194,188,114,164,217,59,172,12,149,97,237,74,222,209,236,47,92,87,69,140,10,
+    238,151,170,213,188,13,197,145,249,44,0,83,119,221,19,58,148,204,185,234,135,113,127,20,
+    165,78,247,183,120,240,146,247,93,156,51,197,143,60,160,238,201,232,130,60,252,31,65,91,
+    251,250,89,163,221,104,153,52,35,203,211,238,232,172,159,146,123,54,42,147,150,89,165,43,
+    82,165,237,108,56,83,187,14,114,117,199,182,147,204,3,222,44,27,208,163,57,220,84,141,
+    42,13,35,2,249,249,28,22,183,94,146,63,40,74,89,2,208,66,254,213,108,135,133,8,
+    85,137,125,138,216,183,241,112,1,143,19,14,249,56,56,168,193,202,63,245,110,68,92,251,
+    80,163,122,200,145,134,154,234,18,151,71,5,136,145,248,202,67,186,55,203,221,23,69,171,
+    161,1,70,144,172,134,177,10,137,211,168,84,157,229,201,180,116,39,35,29,23,213,229,227,
+    168,154,226,97,39,11,36,16,112,192,224,246,104,205,208,68,94,190,29,15,147,179,13,70,
+    190,168,229,22,134,233,242,50,165,51,166,245,43,213,113,24,168,124,19,30,29,167,154,248,
+    214,46,176,253,181,200,175,102,1,130,231,222,236,81,249,222,180,12,156,146,166,100,186,226,
+    151,232,137,106,210,117,245,130,24,176,80,133,61,124,109,162,62,59,234,51,190,206,117,149,
+    169,75,53,255,14,157,53,64,193,238,158,83,132,213,95,217,221,103,90,119,47,213,231,188,
+    168,143,27,127,159,62,110,44,219,199,113,65,31,131,146,252,190,42,234,239,230,223,167,191,
+    155,203,246,55,139,138,58,172,250,171,62,47,174,109,91,229,229,30,93,214,38,191,31,231,
+    13,252,63,21,250,81,228,92,103,213,96,76,39,212,242,39,151,131,107,119,254,48,206,53,
+    249,249,118,77,86,75,13,214,234,231,165,91,69,119,248,249,118,255,184,101,187,77,214,236,
+    31,203,55,219,116,53,251,251,45,155,221,96,205,254,190,124,179,27,185,102,113,140,62,223,
+    188,30,25,171,75,253,68,216,140,139,24,84,172,115,212,251,135,227,237,162,59,85,109,196,
+    0,238,82,179,177,18,107,237,119,135,37,254,189,53,104,196,0,30,51,251,25,2,38,135,
+    185,30,48,48,37,52,251,1,131,219,88,198,86,52,254,100,116,202,179,61,62,76,146,188,
+    125,39,183,232,212,132,74,51,159,222,82,56,73,130,233,146,117,76,139,234,152,2,34,151,
+    172,99,86,84,199,44,9,206,150,172,163,116,86,84,201,89,18,156,198,203,85,162,231,51,
+    234,56,141,131,243,37,1,57,47,130,227,60,9,250,75,194,209,47,130,163,31,7,87,203,
+    85,113,85,80,195,85,112,177,100,71,46,138,58,114,145,88,59,149,103,153,97,237,205,84,
+    180,94,210,6,204,225,0,146,148,11,184,109,85,164,206,17,149,152,11,75,173,90,117,149,
+    137,2,173,184,176,127,201,204,211,122,116,26,145,160,55,4,43,94,41,229,180,153,167,58,
+    18,230,55,86,211,53,97,89,20,139,155,118,233,45,143,226,91,144,199,55,170,106,37,215,
+    215,215,183,169,78,219,148,134,49,123,70,198,105,167,40,238,234,216,21,115,162,235,125,165,
+    246,177,40,200,34,168,218,252,224,65,125,135,52,164,165,242,24,170,54,179,216,134,140,237,
+    88,199,139,164,198,200,81,74,182,88,93,214,120,95,191,118,199,35,206,193,78,151,157,105,
+    30,15,78,204,195,112,121,236,198,205,246,194,254,53,51,119,51,79,223,252,161,186,183,164,
+    150,134,172,165,177,104,137,181,50,164,86,198,133,173,112,133,197,241,53,83,46,51,142,126,
+    252,175,230,209,146,95,58,15,39,234,174,91,40,11,249,120,213,146,139,213,96,144,202,11,
+    3,65,100,243,48,6,136,2,199,25,122,114,60,175,145,205,194,28,21,60,240,39,225,58,
+    207,23,225,220,161,206,126,33,212,217,245,179,18,86,213,5,94,233,95,224,253,253,5,94,
+    202,180,42,88,3,203,225,59,114,251,240,63,188,4,146,205,112,61,181,124,43,250,113,189,
+    179,17,202,224,231,243,242,38,232,96,2,181,36,47,136,210,0,19,74,29,235,98,87,156,
+    11,21,212,239,146,126,153,167,38,121,215,171,79,3,148,123,63,8,105,183,124,206,137,188,
+    188,226,15,184,90,148,108,137,246,53,190,246,215,19,160,150,218,28,214,70,17,172,205,159,
+    9,108,211,132,182,185,0,92,164,185,11,160,185,11,152,93,23,130,216,158,134,157,227,11,
+    77,157,185,143,33,170,227,41,35,182,167,140,216,158,50,98,187,86,149,12,169,146,167,225,
+    169,40,175,206,153,1,15,99,85,79,45,242,159,226,237,43,222,117,158,243,19,167,220,185,
+    232,132,181,54,97,173,77,56,105,95,106,217,141,99,217,175,44,251,87,150,253,43,7,78,
+    183,23,97,156,191,34,84,106,111,117,240,184,220,169,98,233,118,199,138,75,156,102,222,246,
+    4,145,107,236,60,109,135,141,224,197,143,123,211,120,225,139,3,62,221,167,6,249,4,179,
+    148,147,244,157,1,217,89,147,184,109,101,67,151,100,214,41,223,174,42,65,219,202,202,246,
+    214,214,198,214,206,115,244,220,188,219,143,91,167,177,7,130,115,131,187,20,102,249,162,107,
+    124,50,66,157,254,57,52,157,97,23,25,215,114,135,147,223,191,243,120,124,47,124,210,207,
+    162,243,44,181,178,160,246,219,10,53,131,46,116,35,175,120,247,44,167,164,1,75,249,195,
+    52,163,199,251,168,235,21,15,141,211,202,84,95,89,218,153,215,86,196,219,3,50,95,204,
+    13,116,141,13,150,180,75,71,103,254,204,17,80,96,40,144,22,3,213,42,27,96,1,28,
+    232,136,46,187,28,195,184,79,203,149,50,222,212,249,10,162,178,135,48,9,167,130,170,88,
+    68,188,226,136,124,31,51,255,247,46,172,91,251,66,29,108,241,86,132,187,24,247,113,156,
+    47,102,238,70,0,36,154,187,185,129,214,166,8,99,2,92,82,138,124,18,131,90,177,37,
+    47,41,45,222,221,164,85,191,22,158,191,108,145,208,168,24,228,0,118,0,60,137,46,222,
+    91,207,193,201,157,109,42,18,153,204,37,188,154,169,104,38,150,129,204,85,42,114,72,163,
+    159,245,72,84,72,169,198,84,128,231,79,212,28,141,44,226,101,174,202,135,134,183,112,233,
+    94,75,171,149,113,46,179,206,5,110,112,110,213,218,159,233,55,230,111,230,5,230,54,78,
+    96,74,255,241,2,243,63,213,11,204,98,127,4,165,159,224,144,224,54,254,8,184,222,51,
+    19,1,156,187,62,161,241,79,6,229,176,88,50,21,233,239,223,241,251,0,68,77,116,86,
+    133,125,185,170,108,172,198,57,171,161,13,79,115,58,192,178,36,134,102,221,134,64,160,190,
+    208,172,8,70,183,226,71,142,211,119,213,140,231,44,77,45,172,248,73,238,38,70,52,238,
+    161,189,191,113,87,139,130,128,121,117,174,180,146,237,78,145,1,63,235,143,187,16,42,181,
+    59,192,210,179,174,224,3,181,242,154,203,174,199,83,206,49,226,229,204,195,226,66,231,24,
+    185,122,10,76,221,98,167,143,14,102,162,34,44,70,0,75,76,98,18,130,5,231,200,198,
+    54,36,118,191,35,236,80,173,87,151,26,116,218,82,167,227,4,183,231,7,122,4,129,159,
+    93,100,64,208,25,16,116,198,116,231,175,23,210,15,31,39,160,51,11,44,54,139,111,73,
+    252,136,4,97,51,30,215,190,124,73,141,237,24,219,240,197,14,229,6,50,92,227,222,124,
+    74,174,12,228,51,84,170,203,224,73,128,254,86,83,14,193,137,107,191,18,187,246,43,137,
+    99,179,18,59,54,43,73,126,163,18,231,55,42,137,181,75,137,173,93,74,146,223,162,196,
+    249,45,74,236,116,227,214,8,98,151,225,58,70,231,64,163,88,19,20,138,202,181,142,177,
+    97,114,205,7,38,223,44,13,76,145,152,165,217,121,97,190,197,156,8,216,141,37,252,248,
+    206,126,150,232,193,8,6,79,174,187,78,112,248,169,203,18,192,8,21,55,39,44,46,220,
+    74,72,108,12,59,1,97,39,51,14,56,156,60,214,9,132,99,36,61,123,40,157,109,159,
+    157,23,35,160,41,155,134,122,220,237,218,180,146,91,0,110,104,94,207,235,2,196,205,198,
+    45,80,74,12,150,34,253,33,6,149,77,194,120,1,106,159,89,168,23,55,124,227,16,151,
+    127,248,206,137,96,241,191,194,227,222,40,199,215,152,129,237,179,204,51,249,144,41,89,81,
+    154,121,60,85,201,87,229,177,134,205,124,14,214,139,13,190,232,143,162,217,70,147,161,118,
+    99,53,202,123,198,89,200,249,43,98,179,186,193,175,158,204,217,18,233,66,68,125,39,178,
+    116,63,233,222,217,9,133,153,207,185,210,179,44,26,8,165,34,24,196,140,229,48,24,178,
+    81,49,8,70,54,39,4,92,4,202,225,64,159,169,145,148,134,88,227,103,231,139,91,110,
+    174,234,121,156,205,158,157,107,109,54,141,62,55,101,171,56,73,85,147,205,101,218,108,46,
+    110,180,185,92,171,77,207,186,245,144,158,223,228,91,136,244,242,146,113,200,143,22,190,218,
+    245,67,106,221,89,160,231,2,230,112,53,181,93,172,10,149,240,148,233,213,10,9,184,163,
+    137,190,177,48,178,201,211,70,199,227,146,13,181,182,167,206,67,146,147,48,190,70,228,233,
+    103,164,18,135,66,210,222,92,117,101,64,235,88,7,6,121,198,236,82,8,205,166,246,135,
+    81,147,24,58,253,200,181,176,117,51,195,130,214,89,198,69,205,243,170,188,123,244,27,247,
+    131,238,235,92,126,207,22,187,156,40,221,198,231,132,102,220,185,240,8,40,218,45,242,78,
+    97,159,208,68,252,220,84,207,138,27,232,253,193,120,134,47,64,85,122,211,55,209,155,74,
+    62,79,111,88,187,244,190,127,95,144,60,95,156,124,229,121,15,30,152,118,226,255,215,121,
+    122,234,64,99,249,25,139,75,203,80,211,250,32,186,44,119,163,243,172,12,109,149,207,163,
+    254,25,224,164,124,212,205,202,138,243,107,7,153,189,105,185,223,59,205,250,243,242,108,148,
+    43,246,127,125,105,194,115,131,187,14,181,99,255,24,21,62,230,233,118,44,34,72,179,180,
+    208,171,135,230,133,202,53,214,232,126,192,112,183,228,244,4,24,68,69,3,159,224,177,133,
+    58,44,72,109,95,209,117,191,19,38,92,129,180,189,211,33,109,242,184,118,9,113,168,85,
+    85,105,163,212,50,103,161,207,44,116,197,66,127,96,40,99,150,242,48,50,149,204,79,81,
+    59,153,68,155,163,209,225,215,179,104,146,165,228,134,163,216,71,33,43,61,253,58,153,161,
+    71,55,7,17,25,185,239,70,71,226,140,80,35,38,86,29,82,8,52,248,163,36,196,78,
+    122,22,186,62,188,209,73,160,32,51,117,181,225,231,206,106,125,78,36,202,97,105,172,30,
+    126,226,4,18,91,62,107,141,109,165,116,76,183,64,106,97,43,105,110,41,78,229,26,140,
+    123,105,233,106,143,81,81,108,248,192,229,36,165,89,40,48,154,66,75,4,244,55,106,101,
+    15,52,39,77,126,159,255,14,248,239,41,255,29,26,126,13,201,183,62,149,173,107,215,230,
+    252,56,66,220,16,84,234,126,36,101,69,1,235,12,64,155,168,139,246,217,206,36,168,86,
+    103,232,214,53,57,158,161,219,7,174,41,193,157,195,10,175,174,237,144,91,224,86,195,175,
+    188,63,225,134,247,237,107,8,242,216,113,187,90,23,158,91,88,176,193,130,151,16,44,97,
+    184,121,18,116,73,64,230,168,244,191,122,65,223,136,56,247,130,129,17,113,233,5,167,186,
+    91,196,129,223,71,119,38,90,76,23,99,78,185,163,196,33,12,201,241,215,147,106,120,90,
+    187,196,47,0,1,191,231,244,221,164,239,43,248,62,151,57,206,181,28,231,90,142,75,153,
+    227,82,203,113,41,114,92,107,94,22,217,40,167,230,40,135,143,61,179,171,109,244,21,101,
+    68,84,55,60,127,96,69,109,123,126,174,187,126,174,187,190,234,174,79,196,116,138,103,65,
+    132,112,4,148,62,155,248,121,69,159,27,42,195,166,202,176,165,50,108,171,12,15,85,134,
+    71,148,193,82,165,87,14,186,36,241,154,219,204,107,135,171,165,82,172,123,90,50,121,84,
+    94,203,213,95,226,122,81,250,131,121,11,219,151,139,9,204,243,97,167,44,220,96,73,39,
+    49,126,153,104,24,211,162,89,153,189,67,18,214,107,116,29,105,86,248,97,214,235,115,247,
+    46,70,66,47,155,242,235,202,62,224,187,159,77,167,101,202,84,91,241,10,150,43,63,101,
+    166,135,40,66,39,158,110,250,165,59,213,62,78,79,196,153,30,249,188,20,252,194,202,227,
+    227,60,100,105,93,233,96,167,45,149,9,87,227,160,187,211,209,158,48,244,37,123,193,151,
+    31,13,245,98,167,123,154,34,172,222,236,101,199,42,201,220,213,216,84,82,240,38,128,75,
+    104,176,53,187,115,231,62,226,233,90,198,135,196,185,104,84,195,35,91,90,158,19,15,207,
+    247,89,232,51,11,93,177,208,31,44,164,251,95,162,119,196,62,125,134,20,95,191,24,96,
+    247,62,163,55,35,182,15,200,82,189,7,252,173,31,33,218,208,218,36,142,39,151,32,89,
+    189,90,196,177,72,192,165,53,234,79,178,40,69,116,15,215,122,44,139,184,123,14,148,212,
+    245,66,172,132,154,207,118,255,6,2,212,136,140,28,185,11,255,237,153,36,34,190,39,107,
+    27,234,171,66,221,106,181,3,108,139,214,170,186,166,122,22,171,61,222,64,237,241,78,195,
+    24,182,120,171,29,153,113,8,133,134,192,13,135,144,163,123,220,71,165,247,82,251,248,20,
+    126,175,35,115,209,77,249,106,219,245,113,191,23,27,171,187,104,218,209,108,66,45,250,145,
+    90,234,18,174,223,199,197,56,248,181,188,5,200,103,112,28,30,78,184,83,165,69,14,50,
+    204,49,53,220,100,228,134,91,56,203,136,108,103,25,209,141,143,250,70,183,247,149,17,219,
+    209,204,71,18,82,65,172,60,101,32,190,176,126,244,104,137,223,26,66,34,238,109,64,81,
+    18,190,111,172,51,57,34,59,177,93,76,136,89,51,205,21,165,122,58,69,47,68,236,129,
+    165,132,219,109,249,172,98,174,166,82,98,118,122,73,222,208,139,58,234,51,111,254,241,53,
+    58,128,180,8,91,117,72,238,2,18,244,65,185,16,138,84,88,143,113,40,52,246,138,78,
+    61,165,117,91,170,230,3,1,152,222,0,160,226,117,105,43,213,140,203,174,175,53,31,221,
+    156,130,235,59,153,118,103,198,224,224,71,47,197,111,96,102,30,25,190,58,182,0,98,4,
+    50,85,155,181,159,250,198,111,91,197,150,72,61,111,236,51,121,191,37,246,17,215,250,140,
+    88,164,224,254,98,25,119,15,129,174,183,36,61,36,40,148,195,232,235,94,84,213,105,142,
+    244,174,42,213,75,126,212,13,67,34,158,184,208,232,213,212,46,74,212,17,70,98,172,187,
+    202,197,76,226,216,31,116,252,228,184,163,217,38,27,167,97,123,142,74,82,193,131,143,79,
+    72,1,184,115,162,249,54,109,219,238,64,51,174,152,124,156,56,13,183,181,3,176,206,73,
+    152,93,179,179,53,121,128,167,42,238,228,253,140,118,240,144,206,220,25,164,156,93,166,156,
+    93,166,54,187,236,184,205,165,59,174,19,155,142,2,184,147,55,151,46,21,21,229,99,219,
+    177,186,155,211,30,178,99,220,218,68,145,29,115,111,182,196,255,40,182,7,120,163,171,226,
+    255,163,200,30,224,31,113,48,40,174,227,133,94,199,160,168,142,65,28,92,38,203,193,113,
+    89,100,18,112,153,4,227,37,225,24,23,193,49,102,254,177,159,161,29,254,219,59,169,84,
+    150,12,157,202,183,126,111,42,124,188,49,107,233,167,25,16,114,134,231,20,61,83,33,134,
+    61,234,73,7,15,182,181,180,18,181,229,27,233,49,29,101,139,203,106,114,71,103,222,47,
+    187,36,55,9,73,249,255,174,84,227,234,202,255,45,203,101,213,176,252,67,27,106,241,6,
+    201,202,180,27,33,57,175,208,83,197,174,90,87,170,114,197,175,174,180,202,53,94,160,220,
+    141,166,229,56,203,134,101,166,21,152,178,253,201,172,155,149,227,17,212,1,226,119,173,221,
+    143,232,165,102,204,142,178,56,8,139,82,55,81,75,11,27,216,165,221,95,234,173,95,26,
+    4,152,118,88,70,30,221,69,183,211,221,37,0,20,125,167,7,123,97,27,80,30,115,3,
+    122,220,5,96,206,178,124,245,125,197,107,145,111,187,222,148,110,86,118,83,178,78,76,100,
+    44,63,211,127,240,160,148,224,43,55,50,98,151,63,159,157,176,35,89,116,102,182,2,40,
+    152,224,28,38,68,238,190,57,27,196,217,4,51,160,93,135,235,137,71,151,175,57,84,164,
+    96,30,99,180,225,79,153,250,4,215,175,4,86,199,229,60,113,253,144,74,247,131,49,127,
+    51,73,57,175,252,254,125,133,45,205,8,21,34,8,80,16,5,9,233,192,124,19,111,172,
+    131,188,228,179,71,213,81,114,18,75,195,66,121,82,80,154,33,73,138,72,77,134,76,109,
+    25,50,189,81,134,76,115,50,164,82,196,150,42,132,232,241,139,15,26,21,161,24,205,3,
+    177,230,197,206,20,63,97,249,232,116,135,176,31,166,98,50,100,37,106,165,184,83,24,192,
+    69,95,22,147,161,208,76,20,46,51,6,61,224,35,231,66,225,81,4,13,128,69,100,104,
+    102,81,96,55,4,196,34,13,213,156,135,211,222,108,110,148,151,177,5,153,197,99,241,227,
+    44,57,235,71,2,129,34,104,128,36,34,67,51,75,17,38,167,221,222,176,39,81,34,67,
+    86,162,93,138,116,116,159,141,162,25,27,54,17,178,18,11,75,189,55,134,47,31,93,148,
+    93,62,191,57,230,24,128,47,232,252,17,155,1,108,80,35,254,250,41,38,49,10,70,189,
+    60,164,90,169,225,217,31,119,163,215,178,14,17,180,42,18,209,161,153,201,174,146,59,35,
+    233,116,103,170,70,17,180,106,20,209,161,153,201,89,99,124,54,24,171,10,121,200,170,143,
+    199,134,70,22,179,54,159,229,34,229,76,149,143,130,198,19,143,170,41,25,182,26,147,241,
+    161,149,45,215,32,75,210,154,212,34,212,86,64,200,89,32,228,244,163,132,52,177,20,16,
+    86,172,5,138,149,26,58,139,88,96,149,204,98,26,116,185,104,223,204,250,180,23,77,243,
+    57,49,150,119,65,178,27,5,191,30,101,1,175,39,133,249,204,78,98,144,156,73,181,160,
+    71,217,51,64,75,10,243,153,157,45,8,134,163,26,208,98,172,250,181,148,48,151,213,89,
+    187,96,66,170,118,45,198,170,93,75,9,115,89,221,176,15,207,53,176,41,160,215,89,66,
+    144,41,54,212,115,228,200,118,146,181,251,248,250,243,185,228,194,122,140,84,89,0,73,199,
+    32,85,45,198,234,137,150,18,230,178,218,61,177,152,50,236,229,25,54,208,215,140,140,114,
+    101,131,45,89,54,60,35,69,111,89,66,139,115,102,212,150,165,24,246,105,40,187,49,134,
+    194,3,102,18,87,79,179,165,61,42,161,75,127,118,6,47,208,0,77,69,127,210,76,69,
+    105,57,116,123,69,202,169,71,228,179,64,15,158,48,171,249,113,148,136,197,148,127,135,122,
+    2,240,124,5,61,169,99,131,44,13,99,64,5,180,112,46,3,190,111,147,102,227,89,247,
+    5,8,120,124,254,139,160,72,58,202,166,51,45,9,131,34,233,247,73,79,188,150,171,194,
+    129,38,191,204,212,144,137,128,153,164,13,18,234,170,209,235,230,124,25,225,33,43,209,166,
+    142,52,154,118,15,5,33,137,128,153,100,23,233,68,99,89,130,127,27,9,57,2,68,126,
+    201,6,86,49,212,41,91,93,20,218,211,30,236,38,38,130,100,100,136,76,83,248,251,73,
+    180,188,34,254,212,210,171,144,43,131,122,165,99,216,174,156,245,103,189,113,191,151,165,123,
+    152,131,138,230,163,185,232,151,79,208,107,187,232,193,100,159,8,201,85,134,172,68,24,146,
+    29,51,230,192,24,153,124,116,88,144,221,11,86,200,79,189,148,154,141,44,9,114,23,187,
+    190,68,176,17,59,118,113,93,255,30,245,134,249,202,48,182,32,179,142,22,93,199,138,173,
+    45,186,3,84,28,63,149,23,213,131,134,98,144,69,128,229,105,132,242,221,248,105,47,230,
+    20,195,191,73,39,114,229,219,53,66,111,157,65,178,237,198,52,155,60,135,237,139,71,133,
+    68,40,52,211,2,246,40,9,108,193,106,98,55,4,91,252,136,34,216,150,200,243,235,59,
+    234,130,26,231,62,207,7,123,112,191,46,157,8,80,18,43,1,187,120,121,58,153,222,206,
+    253,198,13,135,149,185,19,67,198,57,71,120,108,5,127,53,145,114,74,158,7,201,39,162,
+    193,146,241,124,139,127,6,146,155,162,165,59,252,4,185,109,121,164,135,130,28,47,181,30,
+    133,15,116,246,9,105,252,43,176,25,36,36,105,33,13,190,195,73,34,224,131,79,45,225,
+    249,116,38,18,224,83,75,216,255,202,23,171,200,12,155,149,178,217,28,153,97,179,122,62,
+    225,35,51,194,209,146,81,151,17,25,152,172,30,79,244,36,219,55,89,189,72,34,182,111,
+    113,122,145,198,216,190,218,208,138,68,21,8,4,119,74,122,83,134,2,249,205,147,70,253,
+    121,103,52,124,203,174,143,35,51,236,200,242,34,162,35,178,200,21,235,200,254,97,216,35,
+    50,203,71,6,38,243,198,46,137,239,192,228,203,120,126,45,190,131,2,110,203,58,102,69,
+    114,90,227,71,46,72,108,252,51,208,217,5,18,40,251,10,140,105,191,224,250,34,82,188,
+    65,236,250,146,126,111,140,115,96,116,129,221,213,66,129,76,38,19,228,105,150,112,90,180,
+    163,2,97,144,130,9,99,104,233,93,63,26,146,58,16,93,4,240,11,90,188,230,82,90,
+    64,226,24,156,191,45,106,42,125,5,25,62,214,19,84,171,153,151,136,43,49,249,214,156,
+    132,74,181,36,28,14,77,9,240,67,62,231,101,224,222,206,154,175,162,194,243,217,183,134,
+    227,152,168,200,115,76,100,166,49,155,157,167,209,180,151,136,211,37,88,25,236,242,227,121,
+    168,179,201,183,86,34,187,81,163,135,196,35,253,52,137,191,0,43,94,43,18,155,127,100,
+    3,240,99,110,208,5,63,125,109,39,168,3,152,40,31,199,201,125,196,42,160,95,45,74,
+    47,106,70,228,118,63,56,92,42,20,24,39,11,98,18,201,4,190,105,137,248,135,124,103,
+    51,134,133,154,88,8,125,5,185,173,10,190,45,161,5,101,134,73,68,168,125,143,188,142,
+    229,209,99,2,83,26,128,12,242,59,40,16,98,244,60,50,50,112,202,40,118,214,68,244,
+    39,47,149,68,249,184,192,16,48,184,71,151,161,228,67,134,80,82,178,156,101,235,115,2,
+    38,240,114,132,125,94,68,216,231,145,153,214,155,34,19,201,38,58,85,159,255,40,85,67,
+    223,59,116,26,65,85,227,242,109,68,232,43,184,204,162,7,57,151,28,246,128,213,12,166,
+    225,115,225,66,58,146,113,226,240,133,238,17,166,180,88,209,215,253,18,129,83,132,17,28,
+    77,99,163,183,25,94,107,116,243,14,248,75,150,135,111,54,149,46,105,70,194,64,226,116,
+    146,129,98,226,224,251,115,99,228,162,240,109,46,131,57,122,10,193,161,49,4,129,57,62,
+    97,110,0,3,123,140,67,7,33,168,171,114,203,167,214,215,88,247,169,149,247,227,200,22,
+    89,210,78,19,175,101,139,181,125,194,86,54,22,109,219,140,222,183,200,107,128,192,67,110,
+    72,34,21,97,193,20,21,58,169,44,197,5,142,53,223,71,228,122,99,86,241,202,51,34,
+    27,118,165,116,81,158,100,95,207,160,153,116,197,19,234,228,178,177,88,117,71,3,165,198,
+    197,151,57,158,19,70,100,239,141,239,76,107,157,131,190,219,118,237,210,41,177,213,69,15,
+    213,42,141,178,198,179,127,166,31,5,96,152,211,89,145,249,186,195,86,62,135,111,174,10,
+    81,137,253,200,203,27,160,195,72,79,65,118,35,235,224,163,17,253,44,242,5,90,140,101,
+    71,69,75,161,221,120,248,61,242,117,172,4,176,141,171,165,163,153,61,24,162,19,245,39,
+    165,104,87,31,47,94,174,245,3,99,168,180,231,109,92,72,191,42,74,95,94,72,85,84,
+    226,240,171,232,118,228,105,21,201,232,91,140,161,208,35,209,48,19,27,152,113,98,5,29,
+    169,61,49,237,150,57,29,184,76,2,130,104,41,36,37,121,36,73,110,228,172,151,168,74,
+    239,252,97,70,156,172,160,251,130,16,252,164,0,29,169,159,225,19,102,104,23,201,158,187,
+    245,248,115,243,54,164,181,45,144,247,249,200,103,108,138,89,239,105,38,121,82,161,108,220,
+    0,164,27,214,182,86,117,251,9,168,198,239,135,107,214,28,70,212,199,158,63,8,19,215,
+    40,248,167,225,90,34,242,12,165,158,251,225,87,192,202,152,153,90,68,241,180,210,88,235,
+    175,246,217,144,237,140,241,193,137,254,234,233,218,32,200,224,119,176,118,26,48,127,118,221,
+    213,49,190,227,151,238,102,79,194,181,201,110,182,19,78,118,43,221,176,177,62,246,211,213,
+    176,235,103,248,167,31,166,171,149,180,218,95,205,170,205,213,129,87,205,86,43,253,213,180,
+    138,161,83,175,10,147,161,146,65,174,84,217,136,212,253,181,10,230,30,120,212,187,20,51,
+    175,86,140,252,107,183,42,0,112,1,116,21,171,4,116,176,75,69,96,183,179,147,238,174,
+    117,91,44,185,55,172,200,124,208,206,218,169,231,119,11,235,165,106,235,210,194,165,168,108,
+    201,236,64,14,118,29,144,91,195,193,244,237,177,112,31,123,113,11,212,176,103,242,150,153,
+    101,169,99,150,209,155,122,124,117,182,243,103,44,191,178,0,238,211,180,235,137,45,235,34,
+    19,170,177,203,155,11,78,47,157,219,112,253,61,147,29,11,141,51,23,217,103,60,62,242,
+    16,11,65,12,156,155,41,250,173,138,15,242,202,249,36,150,47,216,225,198,57,214,140,143,
+    226,181,12,245,14,211,181,56,72,171,202,9,113,253,73,246,224,65,253,73,186,139,5,90,
+    16,218,21,11,90,234,151,184,250,6,134,50,232,132,137,132,169,141,5,203,53,150,197,234,
+    113,31,73,157,246,118,112,143,196,180,20,245,245,0,55,226,78,47,21,220,28,161,136,39,
+    147,94,142,232,13,234,116,228,90,214,177,188,91,111,17,106,162,112,173,98,240,112,68,174,
+    176,30,170,70,76,2,139,134,51,111,93,161,106,7,31,81,160,226,215,10,13,54,220,184,
+    166,71,161,141,1,204,164,209,19,215,55,143,24,214,5,142,177,172,86,243,180,24,37,139,
+    122,24,104,184,136,191,127,175,63,89,132,193,213,152,105,21,105,205,26,182,157,204,198,131,
+    45,152,141,117,139,85,95,114,146,205,37,204,249,139,89,185,132,43,241,206,54,131,149,49,
+    232,48,17,182,196,232,91,8,141,49,215,218,181,75,111,53,193,71,24,240,168,225,146,197,
+    48,78,193,114,137,56,200,229,179,92,162,28,175,51,21,47,72,241,58,231,144,54,247,96,
+    234,164,162,78,138,97,117,118,69,157,34,151,159,138,58,41,6,235,236,60,73,191,127,239,
+    42,1,64,156,76,117,159,116,190,127,239,160,2,164,215,9,201,221,106,186,147,124,255,158,
+    208,243,201,73,152,226,18,147,225,186,194,1,185,130,10,175,188,213,204,143,68,163,34,6,
+    88,107,215,142,227,185,180,114,30,3,38,90,18,152,72,7,38,82,179,62,49,73,15,128,
+    236,236,118,90,137,69,129,150,157,239,66,91,15,245,208,170,238,226,76,39,43,146,145,77,
+    38,114,4,123,251,97,167,200,51,86,78,124,129,197,193,221,56,9,49,62,218,80,125,51,
+    36,222,182,159,161,96,162,197,116,48,38,101,118,86,74,250,75,228,235,186,166,36,146,114,
+    33,162,77,122,136,93,3,223,32,42,92,11,45,193,250,147,182,215,13,215,26,64,223,107,
+    109,195,187,33,227,54,58,4,218,4,240,137,39,119,87,29,45,39,38,136,17,58,37,100,
+    50,104,102,64,209,113,23,143,185,37,89,36,74,1,97,100,213,14,128,169,23,70,89,100,
+    53,18,61,85,75,130,73,28,217,122,219,239,179,129,211,61,250,109,22,110,68,141,55,229,
+    243,123,98,186,221,192,253,251,115,17,149,123,237,4,118,50,134,157,81,164,189,226,203,27,
+    97,89,12,214,135,118,104,170,25,61,131,226,120,249,55,126,14,150,217,229,147,106,178,185,
+    201,207,134,233,159,179,189,215,219,102,1,27,2,60,202,76,243,47,70,60,179,156,179,69,
+    218,118,51,42,216,110,226,81,211,6,108,56,149,61,245,130,109,102,41,178,182,247,100,178,
+    99,16,58,83,68,23,224,186,182,21,32,5,100,253,89,116,55,48,169,232,34,16,243,16,
+    218,83,17,192,242,21,168,198,222,178,200,233,43,27,145,252,254,76,118,83,85,178,108,21,
+    122,217,232,214,135,4,2,29,183,59,140,225,103,149,136,193,120,225,254,93,96,198,113,10,
+    241,78,104,80,23,45,20,133,30,5,184,143,67,109,56,18,125,28,204,163,11,215,72,5,
+    9,63,192,136,213,103,228,173,39,248,30,119,37,9,15,107,73,63,26,140,161,214,186,223,
+    80,103,51,201,82,7,51,36,179,11,109,201,226,78,179,151,90,148,218,249,13,195,115,203,
+    83,156,164,120,188,146,165,198,107,49,183,102,36,232,100,214,200,89,236,132,165,25,52,171,
+    87,103,191,12,158,7,15,74,196,168,140,36,162,248,28,79,222,139,252,111,210,55,235,45,
+    54,90,236,197,17,57,30,89,193,120,72,177,163,172,60,192,46,26,136,76,12,68,166,211,
+    100,234,147,231,9,227,24,41,193,60,98,233,13,212,51,134,120,66,161,54,18,241,110,102,
+    15,95,99,93,219,171,121,176,61,39,85,251,58,189,200,76,20,11,144,61,141,38,243,100,
+    52,154,164,63,120,218,3,91,113,115,226,145,80,116,131,224,148,146,224,36,247,161,129,216,
+    146,198,236,21,69,146,89,60,254,124,182,156,150,29,254,9,41,37,102,99,154,174,246,215,
+    178,213,76,205,153,238,82,99,36,187,190,104,152,186,98,152,248,190,112,32,132,157,46,33,
+    115,173,233,131,132,182,214,240,130,1,108,77,6,65,63,172,244,87,219,0,77,199,91,29,
+    64,215,42,233,106,7,66,109,12,25,5,27,107,253,53,216,19,8,33,8,160,157,69,189,
+    225,244,118,231,142,130,56,247,34,179,63,60,193,143,60,125,163,89,187,196,231,36,224,119,
+    254,224,65,227,9,134,241,253,120,108,222,49,87,22,201,47,210,117,116,100,74,47,177,148,
+    93,24,147,19,6,27,11,188,91,238,13,83,238,37,201,241,172,144,209,6,62,103,111,52,
+    131,22,26,82,95,64,68,165,39,63,89,112,18,224,212,172,78,71,53,171,219,81,45,201,
+    75,79,123,147,44,186,97,162,57,12,222,243,242,5,95,213,98,215,138,22,201,52,86,83,
+    109,11,253,159,17,251,128,21,89,188,1,47,230,255,235,94,58,206,29,155,223,40,42,153,
+    19,73,212,113,59,153,201,150,234,36,220,106,205,201,175,72,141,245,13,230,71,221,102,227,
+    106,177,96,147,129,51,96,94,51,119,35,197,223,200,32,7,4,144,199,113,24,114,187,142,
+    179,51,152,219,73,138,140,250,159,141,198,80,54,154,176,89,96,34,128,67,201,96,116,240,
+    103,18,223,140,206,170,153,207,235,176,170,162,45,120,1,139,49,16,103,228,41,168,172,120,
+    55,175,47,216,42,139,64,153,156,87,139,196,36,125,74,188,64,207,81,199,248,117,16,251,
+    198,207,201,50,155,119,253,186,177,125,243,112,222,82,142,146,143,22,178,99,166,87,195,118,
+    111,136,10,28,183,26,225,128,216,44,50,94,214,30,158,136,226,66,163,20,53,205,1,129,
+    253,122,91,50,85,233,84,38,198,103,131,112,77,49,167,145,31,227,195,65,50,94,54,10,
+    241,77,45,158,179,146,136,78,219,131,76,189,158,67,206,26,132,150,83,14,53,137,255,75,
+    29,189,135,179,19,177,196,177,113,129,196,238,14,106,152,118,194,174,223,22,87,65,210,112,
+    174,77,28,104,145,204,23,25,66,93,68,91,241,216,136,139,41,46,49,226,18,18,253,70,
+    186,242,72,105,145,169,233,94,225,227,29,163,200,103,186,80,104,101,202,95,48,120,61,74,
+    51,199,117,49,79,193,151,53,114,203,198,222,205,74,36,170,188,252,212,188,213,233,90,20,
+    64,103,253,179,140,249,223,174,216,26,23,42,177,168,16,115,119,96,24,150,25,57,159,247,
+    8,236,8,253,84,231,170,87,137,150,237,238,55,216,21,184,51,186,93,72,191,214,180,66,
+    10,188,121,217,110,164,109,71,64,145,195,140,158,157,100,115,208,78,179,57,137,203,37,58,
+    107,19,68,173,25,247,194,164,57,49,92,101,36,100,8,188,0,167,199,220,36,222,141,18,
+    68,66,88,7,142,37,29,101,69,59,113,16,9,143,39,232,128,34,58,33,21,226,239,223,
+    15,73,247,81,202,77,238,161,34,67,211,122,62,139,106,19,164,29,160,184,107,121,98,152,
+    216,175,131,233,110,119,149,74,245,207,234,167,187,139,254,205,93,244,111,234,162,63,137,230,
+    182,82,133,180,229,141,212,195,144,236,218,57,191,38,150,88,250,57,110,164,44,129,226,188,
+    118,9,155,141,124,236,28,54,26,249,216,43,172,1,197,147,54,147,82,58,146,190,165,147,
+    204,107,221,200,88,7,12,119,72,202,47,80,165,65,190,229,80,9,124,55,173,229,14,175,
+    97,251,4,219,37,228,177,93,175,229,74,103,85,54,127,17,149,64,62,207,56,135,157,51,
+    142,219,245,224,203,220,118,243,199,22,126,31,77,250,41,238,39,147,26,122,47,201,41,30,
+    84,230,74,195,102,7,221,50,71,147,239,223,227,39,73,173,29,77,216,97,238,55,121,32,
+    21,251,76,136,156,11,44,248,35,230,34,30,200,83,226,35,169,8,92,12,252,83,127,232,
+    143,189,111,29,242,105,102,59,95,108,251,167,30,247,254,150,79,26,10,63,112,249,36,182,
+    75,67,211,130,68,243,230,227,151,176,81,58,201,247,47,61,111,128,156,205,89,1,64,229,
+    249,147,130,164,161,231,127,45,72,26,163,215,234,179,243,48,170,92,242,102,102,254,196,255,
+    234,121,220,35,223,239,81,133,117,215,55,68,83,150,117,32,46,8,253,132,222,5,12,7,
+    252,131,188,106,132,167,234,136,137,113,17,122,221,131,31,30,124,141,185,24,178,31,249,29,
+    46,16,45,233,20,208,159,177,135,165,253,9,255,253,202,127,207,121,250,37,255,157,23,8,
+    88,99,255,140,49,182,115,147,97,251,23,194,162,151,99,127,46,195,130,230,12,174,123,1,
+    195,193,167,196,121,206,5,232,121,145,87,74,33,79,216,69,48,193,32,246,185,231,151,126,
+    65,219,172,49,17,185,125,211,12,243,152,217,79,33,91,66,147,251,12,75,176,117,186,66,
+    69,60,179,190,212,243,115,208,130,12,252,253,59,53,146,213,12,201,184,98,228,129,249,201,
+    31,136,35,4,56,22,181,11,168,148,57,162,33,135,25,16,114,185,54,157,155,241,103,231,
+    148,123,79,83,105,191,96,237,92,113,15,47,123,225,5,247,111,114,181,179,23,92,145,23,
+    198,115,136,35,87,104,87,76,132,219,151,225,106,131,197,188,80,49,77,154,87,79,195,132,
+    73,45,99,152,78,207,252,185,127,238,239,251,47,60,239,169,70,174,116,222,212,238,3,219,
+    173,92,193,78,205,63,227,15,214,121,106,145,146,35,255,140,214,33,0,210,223,11,159,217,
+    0,98,198,240,202,223,15,1,30,255,5,252,109,250,197,237,51,47,66,231,90,107,178,49,
+    237,229,13,239,219,60,44,153,207,167,93,120,193,21,96,83,62,213,183,7,1,246,108,233,
+    62,255,146,207,116,130,184,16,212,119,246,149,233,209,179,112,95,217,7,188,130,94,28,132,
+    123,98,69,124,181,115,16,188,18,43,255,63,195,189,227,87,39,193,211,112,190,123,113,252,
+    79,211,107,206,73,235,194,152,13,79,189,111,208,101,200,21,157,4,47,232,35,102,126,49,
+    223,80,32,57,145,187,131,167,150,203,109,204,244,26,128,54,214,255,183,97,241,226,11,203,
+    155,58,13,12,186,122,160,175,7,68,23,143,160,139,135,225,107,209,197,163,157,195,224,72,
+    116,241,99,248,246,248,136,96,195,78,124,100,145,159,194,215,16,169,144,219,193,21,147,140,
+    182,249,190,191,50,208,207,46,62,81,175,253,125,207,255,136,224,216,121,79,237,188,176,9,
+    124,65,121,251,185,188,67,59,111,114,226,151,222,96,230,235,107,130,162,178,207,155,168,188,
+    224,229,43,111,60,24,243,14,32,189,27,188,9,251,215,68,239,76,227,211,127,74,20,7,
+    180,230,191,193,5,228,217,131,7,207,96,64,129,4,94,135,248,225,243,123,180,215,64,34,
+    184,126,240,64,227,4,87,12,30,104,66,224,169,88,35,88,77,98,141,96,211,39,252,167,
+    175,207,163,87,250,204,185,190,22,215,11,183,124,83,90,242,100,131,35,231,158,149,142,138,
+    61,252,124,214,21,237,163,34,15,63,81,108,166,245,166,207,206,226,140,155,87,163,150,61,
+    175,148,41,174,191,227,174,97,42,122,25,127,133,25,242,173,208,25,125,225,195,136,152,135,
+    78,16,243,123,48,74,67,113,152,177,175,223,216,18,249,217,47,253,131,125,69,177,191,79,
+    142,181,94,210,223,87,89,222,117,126,99,219,243,127,117,196,63,246,130,183,153,238,51,142,
+    59,21,10,205,35,25,233,18,159,219,88,102,95,125,166,10,39,37,229,20,215,136,160,90,
+    229,154,36,109,242,181,8,210,167,168,16,235,57,110,215,122,233,137,199,221,233,125,72,195,
+    245,202,241,191,46,254,149,126,57,169,122,149,127,157,120,187,149,127,29,127,255,87,205,219,
+    93,239,4,113,124,19,84,120,84,27,75,31,27,202,177,15,123,180,46,214,91,230,7,1,
+    147,12,40,112,146,77,188,235,92,245,111,199,36,149,247,29,45,196,232,46,71,175,90,56,
+    80,83,181,199,172,198,51,122,56,61,204,159,246,154,14,182,213,49,4,62,205,76,102,87,
+    92,163,39,102,143,3,36,199,29,68,84,64,11,111,87,247,44,139,90,120,90,203,165,110,
+    141,124,79,251,120,41,132,16,192,192,252,222,155,117,23,15,33,144,8,27,188,168,112,240,
+    34,54,120,61,114,159,25,163,179,34,254,80,244,181,148,217,152,90,104,7,215,56,248,19,
+    36,241,114,38,45,73,209,76,75,98,51,141,157,79,60,71,235,69,221,170,197,42,127,123,
+    171,22,178,135,124,23,37,167,220,150,80,11,254,176,1,8,25,24,13,110,180,168,178,29,
+    135,68,118,76,224,246,8,98,101,164,56,126,75,144,243,20,18,229,162,238,205,168,198,176,
+    86,73,151,28,247,180,104,220,211,216,76,227,227,206,183,95,250,208,167,63,58,244,208,19,
+    152,254,80,235,59,225,19,157,95,103,228,18,132,83,26,216,24,10,72,80,181,82,11,114,
+    19,41,35,189,109,39,255,84,82,42,221,63,45,45,77,74,6,9,92,37,203,45,178,87,
+    69,174,248,174,146,160,31,45,233,62,239,159,197,47,18,247,241,80,243,29,236,81,198,100,
+    115,152,61,3,170,157,68,120,194,105,29,92,34,59,252,103,180,128,94,124,113,225,213,30,
+    157,147,49,252,57,11,94,141,70,3,8,227,143,34,16,78,24,146,32,24,33,136,242,201,
+    217,148,106,128,95,62,148,4,30,14,36,125,8,11,227,236,34,20,106,174,20,98,199,16,
+    142,195,72,76,20,119,131,237,94,127,240,50,58,235,16,241,137,239,64,38,73,91,109,21,
+    200,223,87,142,160,223,7,180,12,152,15,63,161,253,1,23,181,102,47,160,252,175,244,228,
+    74,197,91,143,20,106,154,171,135,181,247,123,207,155,207,247,95,174,50,107,2,32,126,121,
+    246,199,78,68,223,177,91,0,168,86,60,146,73,151,63,206,118,197,57,41,213,133,85,1,
+    12,135,53,168,189,9,173,172,138,102,181,219,63,55,128,212,192,62,108,64,137,12,94,188,
+    253,232,16,186,220,160,223,208,240,186,164,2,222,9,104,246,119,228,137,69,82,157,28,148,
+    85,169,231,175,17,129,223,80,213,48,232,111,172,103,189,36,213,253,237,138,80,46,0,218,
+    96,227,156,187,114,246,233,218,200,160,192,245,56,208,61,121,35,97,137,163,113,162,199,111,
+    217,48,138,97,235,129,51,168,13,25,89,79,27,244,205,193,109,248,204,157,252,167,86,157,
+    127,125,134,175,11,158,177,203,51,93,123,138,202,107,188,82,100,232,42,82,86,47,158,71,
+    150,177,172,161,48,214,162,121,147,194,10,93,139,251,28,166,90,28,91,194,50,45,134,1,
+    4,50,215,13,244,73,30,223,92,200,100,207,186,252,82,128,49,213,183,198,141,83,192,157,
+    82,112,101,128,252,197,47,197,97,180,186,52,129,250,9,204,206,216,231,206,18,217,144,175,
+    38,32,244,173,161,93,145,80,44,71,168,181,211,21,173,87,185,78,9,25,181,173,6,11,
+    68,213,182,54,72,65,86,133,48,31,157,213,20,133,248,53,25,241,121,53,89,239,162,58,
+    121,155,141,11,164,38,24,96,67,178,222,189,230,16,105,172,10,197,109,188,221,132,106,163,
+    213,246,186,62,215,169,121,233,188,109,108,97,145,222,49,210,22,130,74,230,103,213,20,230,
+    65,188,150,248,252,18,17,88,180,231,116,164,25,133,123,55,154,215,178,19,96,98,129,2,
+    245,42,150,22,9,57,14,42,158,214,10,57,156,90,45,34,186,109,196,210,202,161,22,145,
+    160,36,147,248,252,213,6,54,112,80,165,204,78,115,57,183,144,200,172,158,222,33,185,158,
+    152,92,199,204,193,151,21,123,184,164,89,48,76,247,175,233,146,203,121,191,120,57,255,154,
+    250,252,48,75,46,228,164,204,99,200,138,47,70,157,253,203,113,147,237,196,245,21,29,79,
+    20,194,60,55,197,13,240,91,110,238,106,186,246,244,249,238,128,249,185,188,54,171,179,205,
+    176,69,125,220,109,5,135,98,197,167,42,91,174,218,121,197,45,189,21,216,179,189,203,117,
+    7,187,242,46,223,149,146,187,47,239,22,244,133,184,134,34,118,179,214,155,123,180,168,55,
+    88,117,75,53,210,22,33,248,128,78,77,150,29,253,226,11,234,73,234,18,218,246,110,144,
+    217,212,27,110,176,161,235,144,55,42,233,103,91,198,24,201,142,247,223,218,35,233,156,91,
+    250,66,114,100,67,23,49,147,94,42,119,40,162,140,29,239,200,106,249,248,142,206,102,35,
+    254,112,76,164,5,2,237,114,97,79,101,41,69,185,56,83,168,115,240,52,118,125,124,19,
+    95,211,153,136,129,192,88,204,126,13,137,86,46,229,72,208,172,135,33,51,86,92,173,35,
+    227,69,17,117,145,30,35,235,200,150,220,80,102,69,27,202,44,54,211,122,211,195,49,122,
+    56,210,183,146,89,252,51,61,190,104,27,55,233,83,47,146,159,230,230,105,47,185,203,92,
+    49,221,134,239,37,190,232,36,202,106,142,27,229,91,106,189,146,89,16,211,245,97,43,170,
+    216,23,87,236,11,47,52,14,162,7,34,28,122,52,104,191,132,74,177,122,69,180,207,116,
+    212,194,207,12,107,151,171,73,109,190,190,25,196,14,173,155,200,123,210,254,254,189,130,143,
+    107,186,111,117,35,207,111,239,164,252,58,183,253,36,69,118,244,253,59,127,75,64,221,232,
+    182,249,141,110,36,111,116,241,116,154,44,21,197,221,46,141,141,231,221,241,112,218,125,28,
+    125,91,245,25,77,141,133,153,130,62,120,192,53,66,217,107,22,130,248,152,153,168,233,75,
+    193,11,158,38,63,204,131,159,38,183,3,217,71,177,55,162,83,197,243,172,175,222,81,165,
+    199,172,212,97,99,188,147,4,177,210,29,33,103,244,226,61,134,3,44,137,46,52,57,136,
+    124,124,148,29,188,119,109,186,225,224,69,22,25,128,64,243,158,176,237,69,107,247,88,93,
+    252,240,227,108,6,47,30,138,6,169,230,157,239,151,10,128,138,207,82,201,198,131,20,224,
+    70,146,30,147,174,81,234,215,125,93,81,64,42,6,168,199,136,43,92,31,147,225,252,197,
+    72,30,16,153,206,219,205,103,159,56,60,73,216,240,117,223,93,59,165,20,129,138,118,240,
+    68,90,3,10,223,181,144,44,244,56,89,107,156,112,252,93,223,192,10,10,109,175,151,156,
+    250,194,185,88,209,108,12,132,200,158,235,61,218,152,115,216,168,81,154,104,108,75,116,91,
+    29,98,243,45,76,78,122,176,165,105,236,200,55,10,11,187,148,88,250,34,75,247,60,49,
+    172,138,145,164,82,212,84,148,18,55,119,41,89,215,188,172,53,92,175,2,163,78,199,147,
+    16,223,4,86,227,9,33,53,132,178,174,210,47,64,12,152,47,223,6,221,8,199,48,155,
+    79,169,57,89,185,51,123,227,154,191,238,245,35,27,31,134,101,253,37,100,155,114,235,38,
+    229,178,103,202,248,11,48,116,161,98,213,197,121,52,159,65,153,72,100,62,145,197,148,201,
+    36,146,174,37,31,136,242,214,48,207,18,93,195,31,122,128,142,206,102,25,215,130,152,230,
+    60,209,197,192,100,68,162,222,39,166,11,38,179,76,157,202,111,108,21,125,29,168,108,199,
+    209,9,94,152,104,122,23,70,154,73,72,57,0,24,34,112,70,248,182,219,60,130,201,47,
+    197,252,101,31,241,198,77,30,64,241,216,77,37,210,18,209,164,0,85,74,181,230,157,48,
+    10,64,200,4,97,153,86,80,141,209,106,39,170,9,239,198,226,11,85,66,32,117,87,170,
+    104,233,109,203,76,58,106,124,153,83,168,170,89,234,93,94,75,230,224,75,161,187,120,154,
+    161,166,205,136,181,195,167,52,164,162,179,205,108,50,100,1,230,43,248,122,33,11,122,205,
+    89,208,235,5,239,246,37,26,34,252,52,204,33,213,207,84,28,49,153,4,226,218,42,142,
+    95,44,251,120,173,214,85,151,171,157,157,18,252,161,135,254,4,50,68,233,10,190,195,180,
+    75,143,49,105,221,135,197,8,159,88,66,44,8,79,247,153,223,216,94,237,104,98,5,30,
+    173,180,173,103,43,23,74,60,180,225,124,150,104,228,236,231,58,200,53,251,33,230,233,252,
+    13,108,219,11,150,185,186,159,56,40,202,146,12,52,154,98,239,213,240,183,60,240,97,27,
+    233,16,23,167,255,244,199,247,155,83,60,108,64,176,217,41,195,108,217,26,71,197,231,23,
+    51,172,242,16,175,125,178,84,168,90,163,34,61,182,226,208,13,62,62,241,99,236,164,161,
+    222,0,34,159,229,25,91,60,172,71,120,17,44,200,152,164,102,22,123,182,234,184,53,115,
+    210,53,55,49,104,28,231,41,62,208,71,188,8,247,90,12,241,12,255,16,146,111,10,107,
+    207,182,98,36,230,84,243,202,72,5,36,125,213,136,15,61,117,195,150,57,99,51,207,200,
+    9,9,222,245,173,250,84,212,29,127,173,65,77,9,102,196,55,166,42,66,137,216,199,34,
+    242,100,87,251,102,18,28,114,180,150,18,232,48,120,173,157,238,190,86,211,174,130,110,166,
+    213,75,114,113,111,152,58,173,227,79,241,241,29,220,20,6,134,164,90,92,41,183,242,17,
+    5,107,185,69,13,31,243,12,243,114,10,155,66,0,198,107,141,81,198,185,120,94,139,206,
+    147,209,172,198,233,183,85,194,64,44,85,127,238,20,105,253,119,58,206,205,147,183,131,178,
+    205,49,211,148,217,112,220,97,237,133,117,214,204,50,85,245,203,165,88,80,180,77,39,90,
+    94,88,115,3,225,146,37,6,244,12,187,209,12,132,136,3,110,45,22,8,251,22,212,37,
+    223,141,243,46,199,90,49,179,106,244,185,117,169,80,192,187,161,59,182,6,36,91,60,178,
+    40,112,77,64,77,233,81,65,30,48,68,148,16,19,252,105,58,234,48,62,198,158,50,5,
+    198,136,61,198,158,178,215,94,35,246,24,123,202,94,123,165,208,5,11,253,142,161,2,4,
+    248,183,68,128,159,242,87,99,127,71,146,174,93,34,4,216,46,182,134,98,75,142,128,141,
+    53,64,103,152,121,90,55,229,205,21,132,51,233,102,233,138,184,163,34,146,29,165,220,237,
+    210,66,2,206,77,134,214,74,154,253,96,117,42,135,215,114,217,92,233,220,190,252,97,56,
+    1,201,163,51,196,247,48,203,162,165,86,153,63,47,38,34,188,235,31,209,126,43,45,86,
+    127,251,176,220,81,218,135,130,147,180,15,70,74,111,138,42,32,57,231,201,31,126,214,73,
+    90,95,211,66,233,219,30,93,133,55,223,190,238,196,183,175,124,247,138,79,243,176,237,44,
+    250,97,65,225,12,149,12,16,17,76,175,128,84,184,49,40,118,182,211,219,219,192,106,130,
+    163,110,27,148,228,153,136,178,177,40,37,252,229,101,41,84,165,32,46,58,116,170,65,226,
+    132,157,41,200,152,13,122,157,157,191,95,79,143,179,163,56,233,82,251,79,253,246,90,3,
+    153,71,65,34,127,109,29,254,192,62,149,190,171,185,237,112,98,62,23,186,210,215,80,180,
+    194,158,57,166,25,195,149,17,237,86,50,116,65,193,56,109,145,131,136,154,11,249,248,162,
+    244,51,138,167,163,214,242,104,216,159,151,1,21,180,249,45,95,244,102,93,253,113,233,178,
+    253,124,183,122,199,48,177,23,36,68,175,208,247,101,122,143,122,187,128,133,250,9,41,247,
+    49,52,243,229,73,224,57,143,175,148,2,58,210,32,230,36,239,17,181,240,0,167,164,111,
+    73,190,198,252,52,119,63,114,31,231,178,227,85,246,102,203,59,233,215,191,189,26,182,185,
+    145,167,201,86,186,121,195,6,78,119,157,156,33,67,167,200,144,65,120,184,180,139,16,113,
+    232,134,7,93,102,24,202,100,53,167,41,67,226,225,25,142,198,141,187,120,88,195,204,46,
+    29,150,12,145,112,172,96,216,137,4,220,126,36,96,175,116,11,155,17,236,41,95,189,217,
+    196,230,46,66,167,187,205,86,131,188,135,57,22,115,172,98,6,200,32,66,242,39,240,229,
+    152,122,236,237,100,253,122,29,68,168,112,198,163,59,218,91,226,95,195,25,39,153,181,6,
+    108,246,190,194,94,47,28,74,27,148,227,78,181,113,194,45,131,152,144,60,241,75,27,171,
+    51,220,224,5,3,35,122,99,245,28,250,30,198,53,135,207,211,74,159,140,147,240,125,30,
+    58,71,63,53,145,150,91,47,253,243,194,131,246,83,72,148,7,237,231,133,7,237,231,252,
+    160,189,43,14,114,111,106,145,208,217,234,104,231,241,82,111,220,125,60,47,13,133,113,195,
+    252,53,156,112,44,174,111,232,120,236,91,40,234,120,190,141,181,78,117,3,251,187,24,111,
+    254,223,22,111,165,219,34,78,176,185,142,205,230,250,64,202,146,205,13,194,62,71,40,30,
+    72,0,66,7,136,86,68,105,33,170,128,38,253,62,17,236,223,28,101,183,38,181,159,107,
+    167,176,172,96,114,182,224,245,224,72,136,38,130,131,253,181,34,202,109,36,20,20,80,234,
+    57,1,37,108,22,75,40,11,228,147,106,131,75,40,184,175,110,239,214,91,106,229,5,186,
+    12,105,1,254,243,229,21,49,40,63,71,110,41,221,85,112,17,120,55,36,22,66,60,91,
+    94,81,42,241,99,25,168,162,237,207,109,145,107,9,53,64,239,103,233,157,232,221,148,196,
+    83,78,238,7,163,209,152,29,219,253,186,228,187,26,191,22,189,171,241,107,100,166,245,152,
+    119,138,169,190,225,249,53,250,147,116,7,232,209,197,136,126,2,215,243,137,60,77,139,9,
+    74,198,118,231,159,241,15,111,119,254,25,251,2,7,55,170,22,44,45,141,74,179,233,54,
+    57,234,228,210,105,236,116,94,15,20,121,74,26,36,46,13,131,8,109,151,45,7,154,125,
+    116,77,83,180,154,64,246,72,174,38,81,225,106,18,105,158,150,241,65,1,229,107,12,248,
+    14,91,104,134,242,114,154,173,36,73,94,137,160,131,235,134,18,175,133,84,45,151,132,126,
+    78,202,134,21,151,206,30,163,193,180,198,144,94,155,117,39,217,180,59,82,18,120,55,39,
+    129,119,11,37,240,18,23,193,187,55,137,224,125,140,97,94,166,171,225,224,214,226,120,255,
+    38,113,124,176,30,86,212,163,140,181,203,170,22,152,235,129,43,111,125,131,11,232,131,213,
+    65,48,208,68,118,110,222,77,142,123,11,69,242,46,183,50,238,134,221,101,69,114,230,222,
+    94,136,229,51,67,44,23,2,101,48,3,97,114,38,14,27,207,195,201,241,236,196,16,189,
+    187,76,244,110,87,6,254,185,46,151,66,117,176,61,232,74,185,20,42,154,80,69,118,225,
+    153,231,99,225,153,167,202,14,160,156,228,220,172,162,129,130,135,85,3,101,0,20,44,246,
+    163,2,202,13,71,73,231,63,126,199,114,142,12,251,229,100,116,198,185,245,231,101,171,252,
+    92,88,229,103,172,242,99,47,205,70,252,230,12,153,84,209,37,158,178,165,12,208,228,39,
+    74,231,135,176,220,102,232,46,238,215,189,143,251,95,158,125,120,255,126,255,205,209,151,231,
+    123,71,123,226,52,62,119,61,230,5,239,151,180,41,125,95,164,160,246,62,54,211,240,213,
+    244,193,24,166,249,52,75,53,203,210,231,75,154,213,60,47,50,171,121,158,152,105,189,233,
+    115,246,78,160,108,226,48,118,184,18,226,109,188,208,219,56,44,234,203,97,28,236,23,195,
+    249,70,175,99,191,8,206,253,36,56,42,198,169,1,199,81,17,28,71,113,240,98,73,56,
+    94,20,193,241,34,9,198,209,114,112,140,139,4,136,113,20,188,92,18,142,151,69,112,188,
+    76,130,15,197,248,208,155,246,140,140,230,217,109,28,252,186,36,32,165,95,139,32,249,53,
+    9,166,203,66,50,45,130,100,26,7,175,150,132,228,85,17,32,175,146,224,227,178,128,124,
+    44,2,228,99,28,252,182,36,32,191,21,1,242,91,18,252,190,44,32,191,23,1,242,123,
+    28,252,99,73,64,254,81,4,200,63,146,224,211,146,147,230,83,17,28,165,79,113,112,176,
+    36,32,7,69,128,28,36,193,231,37,1,249,92,4,200,231,56,120,189,36,28,175,139,224,
+    120,157,4,127,44,9,199,31,69,112,252,193,116,107,14,58,225,183,25,121,35,162,59,214,
+    156,131,208,36,76,190,127,111,10,245,55,180,53,231,167,36,89,152,238,162,247,173,213,164,
+    37,212,29,97,131,245,9,77,181,235,126,230,163,99,57,15,118,91,199,204,215,133,116,46,
+    223,97,174,230,72,197,129,45,86,253,48,9,82,204,71,94,96,185,64,196,4,147,129,210,
+    171,58,221,25,4,167,66,40,25,134,241,241,233,201,106,159,50,143,195,83,60,172,1,96,
+    78,97,87,182,218,151,224,4,67,24,117,132,103,232,143,253,62,105,108,14,65,168,28,194,
+    66,119,137,143,94,15,107,211,89,6,123,170,9,189,152,156,50,193,248,183,14,8,206,222,
+    117,90,155,142,64,4,254,181,195,20,40,17,160,83,169,100,199,0,137,195,20,128,8,250,
+    97,27,59,211,15,95,117,42,177,15,194,68,28,254,23,72,137,126,236,249,111,19,136,137,
+    169,57,244,132,11,193,182,223,102,193,235,107,242,136,198,234,123,242,168,190,154,8,225,172,
+    27,70,232,164,132,201,100,168,50,218,96,90,90,136,166,254,78,22,244,171,97,226,157,66,
+    124,255,4,246,32,240,67,231,79,59,19,232,208,36,60,133,253,235,206,87,248,252,26,66,
+    251,167,79,208,195,73,151,98,159,160,114,59,140,160,7,226,162,52,171,235,174,77,252,116,
+    237,43,198,161,102,64,119,183,177,222,109,213,175,223,33,160,29,24,194,137,255,21,207,80,
+    197,208,93,95,251,159,162,240,91,100,120,63,53,116,93,36,37,112,173,184,181,134,112,71,
+    8,67,140,122,122,73,149,236,237,107,151,171,17,106,236,205,215,232,7,67,16,57,87,198,
+    142,201,53,8,59,207,250,163,228,244,247,222,212,249,146,76,253,201,167,168,134,160,144,218,
+    169,70,194,135,221,104,156,185,223,41,33,111,0,240,7,79,97,130,168,77,126,152,219,149,
+    196,143,132,82,182,82,220,173,65,167,246,163,164,91,137,218,94,160,110,233,99,253,54,62,
+    21,158,2,252,118,21,40,50,58,17,189,167,74,49,2,149,113,15,58,53,13,58,242,109,
+    238,174,48,220,240,248,238,44,230,14,254,34,63,170,110,40,155,129,236,250,58,104,199,203,
+    241,142,118,209,188,111,195,18,181,228,202,255,170,104,229,127,21,153,105,228,18,23,164,251,
+    105,88,228,6,112,166,157,55,137,13,202,10,105,80,239,50,95,62,154,135,10,236,58,59,
+    74,136,216,70,197,107,113,238,16,187,170,59,59,95,65,52,199,139,42,138,69,69,165,99,
+    161,32,193,223,32,193,13,20,240,184,69,133,19,13,10,110,56,36,186,0,187,231,179,243,
+    86,44,246,197,48,62,6,94,208,163,13,82,227,1,236,176,45,23,21,226,165,57,73,111,
+    17,67,160,236,32,5,43,74,127,155,107,108,147,90,182,80,208,161,202,201,93,178,180,226,
+    158,226,78,21,128,17,93,230,125,84,90,218,174,129,160,67,191,43,85,68,30,87,110,120,
+    206,130,128,114,187,200,217,185,223,4,190,233,238,191,237,158,67,185,146,19,158,71,190,127,
+    23,103,137,217,100,2,61,230,135,137,251,151,64,114,105,38,118,190,173,242,121,150,148,211,
+    81,134,126,92,103,229,236,18,240,186,162,63,32,201,207,195,221,79,233,1,159,144,150,101,
+    229,84,52,45,222,214,186,92,139,249,179,69,120,16,53,135,208,92,89,106,172,69,60,173,
+    3,33,96,90,53,188,55,100,143,142,101,200,253,165,194,189,240,19,254,228,205,217,32,206,
+    38,181,253,119,135,175,14,222,190,17,43,157,58,92,233,162,91,57,237,172,101,181,93,237,
+    160,202,98,23,150,188,203,181,108,189,79,47,121,205,171,233,58,62,228,82,169,32,16,157,
+    245,193,90,215,131,22,32,52,175,182,33,20,123,208,214,186,108,21,22,153,110,21,3,8,
+    46,176,95,0,15,191,231,1,140,0,52,128,239,131,1,176,205,39,161,122,40,6,213,28,
+    129,219,167,232,181,93,129,147,173,55,249,230,60,10,81,25,219,234,206,110,219,138,64,27,
+    76,92,69,91,233,206,154,157,213,142,145,121,89,115,184,5,206,60,88,151,85,176,227,137,
+    60,126,180,91,105,135,107,153,159,25,168,243,90,104,25,3,188,220,74,0,168,213,67,90,
+    172,103,235,153,159,174,151,50,205,159,99,166,124,196,252,166,38,96,125,39,92,91,251,45,
+    16,19,243,55,46,241,252,182,214,8,234,124,237,140,228,189,37,91,46,50,144,119,158,86,
+    155,171,151,52,71,217,58,199,180,209,185,249,112,20,173,102,48,202,240,83,201,240,160,30,
+    196,150,106,90,237,248,99,250,197,19,159,184,154,192,47,48,124,248,197,193,7,217,3,254,
+    12,228,215,152,7,59,225,169,58,86,233,132,251,192,33,64,110,193,197,174,151,102,191,3,
+    147,250,240,177,114,228,159,250,157,181,109,248,183,1,255,154,240,15,224,236,87,58,232,207,
+    138,126,27,252,119,195,10,55,85,252,181,230,231,177,45,102,200,132,45,74,232,133,158,47,
+    79,242,43,209,240,218,17,249,41,43,229,194,12,192,227,53,216,35,13,246,163,209,152,131,
+    29,1,200,17,128,28,49,144,35,14,114,196,65,140,16,68,213,16,214,255,109,200,0,80,
+    85,123,193,41,139,154,28,111,172,226,202,171,5,75,17,158,229,27,25,170,70,149,125,242,
+    63,197,251,137,174,68,229,247,156,29,107,162,36,202,56,221,174,248,104,217,172,218,63,13,
+    7,138,117,14,33,192,174,204,103,240,5,236,113,130,66,199,32,84,222,149,106,209,0,47,
+    128,118,197,71,171,81,175,115,185,79,203,20,163,205,192,81,183,151,156,14,179,41,182,110,
+    70,180,182,253,243,92,246,195,222,85,182,171,125,183,190,2,114,47,243,217,196,237,191,21,
+    110,109,248,243,92,230,125,102,26,191,107,6,241,12,234,66,207,155,156,77,206,51,173,98,
+    35,220,106,160,255,63,45,55,8,224,99,204,69,191,173,134,255,18,226,50,198,243,223,193,
+    180,246,247,144,251,236,235,37,62,124,124,201,200,103,52,217,53,66,45,144,120,232,96,89,
+    139,35,183,193,47,217,116,252,53,124,137,131,117,56,142,146,44,229,222,188,159,122,193,30,
+    158,13,205,161,25,238,45,81,107,138,92,1,33,116,236,163,245,82,156,61,191,152,64,3,
+    179,23,20,91,121,74,27,11,230,61,80,29,224,190,209,190,15,216,247,245,252,251,247,202,
+    121,248,53,188,68,35,45,114,244,231,31,209,122,31,92,176,39,178,241,109,120,14,217,5,
+    206,155,139,218,20,87,79,202,251,22,66,93,88,31,201,222,231,151,79,232,76,89,138,199,
+    104,137,74,174,148,39,25,59,163,102,213,255,147,239,162,94,135,111,5,151,251,231,206,235,
+    224,159,130,65,29,134,111,143,255,121,18,88,117,29,34,243,197,132,240,80,213,7,140,129,
+    57,8,132,204,182,168,13,211,254,173,231,127,10,163,96,65,131,172,45,31,129,132,133,62,
+    137,102,208,14,243,140,230,71,145,218,54,124,246,211,40,252,40,10,95,136,93,225,111,33,
+    155,24,191,135,159,68,26,6,223,135,191,3,123,198,22,63,132,191,85,27,193,111,59,191,
+    7,191,85,171,126,233,61,252,249,0,173,190,135,101,229,119,232,206,123,192,184,255,129,7,
+    62,96,224,226,248,183,147,48,173,124,130,31,255,211,241,123,252,243,1,56,196,75,209,98,
+    22,145,183,77,130,212,91,212,177,111,28,139,180,108,160,102,123,128,192,254,14,200,227,25,
+    139,128,188,25,198,36,98,64,30,34,144,135,8,228,33,3,146,243,94,124,105,37,10,51,
+    137,81,136,184,198,118,160,166,224,253,206,101,240,30,193,251,61,124,191,206,68,151,118,20,
+    126,101,62,53,146,209,180,242,59,251,124,247,10,214,204,224,67,120,190,202,151,223,161,153,
+    242,27,239,185,134,121,222,1,254,138,98,20,38,12,139,136,81,255,3,94,11,116,129,131,
+    250,93,148,145,214,218,0,210,2,228,97,52,167,12,192,221,75,252,133,6,125,13,123,162,
+    49,106,135,16,65,88,129,134,252,92,67,31,194,210,121,192,150,245,58,20,140,34,81,114,
+    190,11,130,38,150,202,120,217,22,253,238,237,194,150,137,78,254,95,112,239,189,232,30,52,
+    39,61,98,43,158,255,74,228,140,123,139,243,206,61,255,128,229,253,149,114,48,175,148,244,
+    243,10,129,62,0,152,15,0,228,131,218,21,200,49,122,39,184,151,206,223,195,70,240,251,
+    78,248,52,248,157,99,232,7,186,243,251,45,186,243,251,141,221,249,253,86,221,25,172,63,
+    93,253,157,117,233,125,120,137,114,212,78,248,62,120,191,182,38,136,242,254,8,178,164,17,
+    137,78,140,6,141,12,170,64,36,193,207,162,198,189,93,173,173,234,175,199,79,81,229,113,
+    238,243,143,75,108,187,149,131,230,186,146,219,47,107,178,18,48,250,185,208,248,175,175,194,
+    248,43,98,72,25,49,124,14,63,98,243,157,202,103,144,144,170,177,255,25,4,38,250,169,
+    195,15,110,138,81,244,36,17,213,91,88,184,110,20,198,170,152,244,255,109,113,139,84,132,
+    90,187,177,122,0,228,41,107,129,127,53,217,151,119,125,132,180,68,55,101,176,144,168,222,
+    175,69,104,127,224,1,243,93,128,163,210,134,31,163,216,93,249,132,251,223,184,170,104,226,
+    230,165,8,86,58,60,163,131,66,114,120,139,65,105,48,80,132,232,7,11,185,185,217,30,
+    114,55,36,139,247,215,167,184,159,246,23,238,167,103,184,139,246,232,152,199,22,102,194,111,
+    134,224,236,240,122,133,66,64,12,194,109,122,130,155,63,252,64,101,74,174,113,0,193,236,
+    36,200,216,7,198,179,125,210,49,219,39,97,108,114,226,211,15,233,189,176,232,200,79,197,
+    39,62,251,117,130,22,111,246,198,163,192,253,22,3,133,219,89,117,66,81,51,62,199,71,
+    159,205,19,254,232,8,131,216,239,43,136,5,240,60,203,128,3,15,242,53,3,190,212,80,
+    29,225,121,134,20,108,159,224,222,10,63,176,154,152,127,54,69,95,107,245,198,19,185,83,
+    239,172,245,189,221,99,209,205,198,90,34,58,218,133,128,236,245,0,2,153,8,12,33,16,
+    123,39,45,94,170,163,151,234,235,165,78,245,82,99,86,234,250,58,120,191,228,185,255,251,
+    162,115,255,247,73,240,95,197,231,127,175,140,27,153,255,42,58,0,252,175,56,56,92,18,
+    144,195,34,64,14,147,224,108,201,11,136,179,34,56,206,226,224,104,73,56,142,138,224,40,
+    29,37,65,148,44,7,72,84,84,73,148,4,31,150,4,228,67,81,29,31,146,32,94,18,
+    142,184,168,142,56,9,206,151,60,221,61,47,66,234,121,108,166,229,93,31,49,22,250,102,
+    129,249,187,122,15,147,27,126,141,197,155,150,83,182,33,65,245,174,235,224,98,73,2,184,
+    40,130,245,34,54,211,138,96,125,177,16,214,210,82,192,38,75,14,78,82,52,56,73,18,
+    92,46,57,56,151,69,29,190,140,131,207,75,30,189,127,46,58,122,255,28,5,31,139,251,
+    162,55,237,25,25,205,219,225,36,248,125,129,198,133,121,179,91,84,201,239,73,240,105,201,
+    105,243,169,168,142,79,73,144,46,57,50,105,33,15,72,19,246,208,66,36,138,183,39,89,
+    118,149,85,190,253,46,252,249,202,243,227,195,216,231,15,180,78,122,137,140,221,79,180,88,
+    83,215,170,117,20,251,71,240,17,117,179,116,50,26,202,232,151,137,30,109,149,249,16,251,
+    111,147,153,93,228,215,68,139,181,74,76,99,255,21,8,193,118,145,87,137,30,109,149,249,
+    24,251,207,71,105,150,216,133,126,75,140,120,171,212,239,128,129,81,127,110,149,121,145,104,
+    177,86,137,113,228,31,157,197,10,135,255,72,40,108,229,250,4,120,26,77,206,166,255,24,
+    142,102,50,242,32,81,145,86,254,207,60,191,140,120,205,243,90,249,254,64,252,95,170,42,
+    223,39,20,182,114,253,87,236,151,152,194,158,26,234,196,103,49,86,214,179,216,127,223,27,
+    118,212,0,39,20,182,114,69,128,16,124,21,80,70,92,242,8,27,57,177,127,0,18,133,
+    202,247,33,97,17,86,190,24,160,65,110,36,35,206,99,22,97,229,187,136,125,251,206,163,
+    45,163,172,188,175,34,127,63,237,100,10,133,73,226,63,27,105,48,127,100,97,155,2,32,
+    118,222,199,163,73,21,119,25,203,56,123,156,34,255,89,111,146,244,85,173,159,18,30,99,
+    229,76,19,255,233,232,82,145,73,140,65,43,207,32,190,246,130,249,146,94,207,230,69,124,
+    116,30,155,105,189,41,160,50,29,93,72,205,229,18,158,233,253,12,183,103,134,202,113,86,
+    204,185,206,13,22,154,21,177,174,44,49,211,122,211,247,209,5,246,37,155,232,90,216,135,
+    75,170,122,31,22,45,26,135,145,153,198,252,142,31,206,162,97,26,77,210,162,166,238,232,
+    114,30,31,135,152,134,223,14,143,246,222,60,223,123,255,188,181,178,114,125,131,46,56,236,
+    184,58,93,60,204,38,207,113,252,155,171,137,103,179,168,207,147,228,183,83,131,188,143,102,
+    228,232,21,188,20,201,111,51,229,213,112,198,124,81,134,81,62,142,95,115,142,184,227,241,
+    145,44,77,159,122,81,51,130,63,138,61,232,77,167,189,243,76,244,78,132,61,51,153,85,
+    174,133,204,100,189,149,92,28,247,99,112,54,24,179,90,248,151,138,22,174,206,229,55,119,
+    219,77,199,59,172,140,252,214,147,40,175,0,92,139,242,130,191,208,233,186,73,23,172,93,
+    61,104,81,7,31,119,61,124,195,187,4,217,240,156,143,6,125,232,145,198,48,152,49,210,
+    183,62,30,213,195,164,120,143,166,8,116,240,110,196,220,219,243,3,249,204,204,20,220,142,
+    114,100,228,198,225,185,184,31,246,214,143,49,236,237,51,153,129,7,45,87,249,197,108,254,
+    208,96,143,87,69,124,254,42,54,211,24,219,122,215,157,79,123,9,146,177,198,237,175,22,
+    114,251,195,232,22,140,235,221,175,159,15,95,61,219,59,80,140,11,48,216,39,239,202,140,
+    38,244,32,231,108,232,67,251,217,40,66,255,243,242,219,74,122,175,49,185,124,164,137,186,
+    223,150,100,248,191,21,49,252,223,34,51,77,96,110,52,236,232,220,254,183,159,102,222,131,
+    174,154,207,250,145,76,19,97,145,220,237,13,123,28,25,242,123,49,91,191,153,171,151,254,
+    195,214,255,91,176,117,65,11,172,89,45,116,23,150,157,140,6,113,111,72,174,130,249,231,
+    146,115,246,63,76,124,25,38,190,87,204,196,127,51,152,248,94,17,19,223,139,205,52,198,
+    138,142,70,228,192,94,114,162,189,133,252,251,183,5,252,187,36,125,111,162,77,151,164,102,
+    45,100,246,232,233,146,187,143,167,69,29,122,26,155,105,172,67,111,248,28,84,93,122,250,
+    163,27,144,255,85,76,225,30,230,89,233,207,154,20,207,150,36,161,103,69,36,244,44,54,
+    211,24,9,29,68,168,38,55,211,105,232,217,159,229,187,251,22,203,236,223,126,149,45,21,
+    46,179,63,101,229,249,207,194,243,51,230,216,243,226,57,246,193,176,8,44,52,248,121,30,
+    155,137,204,128,254,121,52,237,102,198,145,199,243,133,115,236,195,205,115,108,202,89,224,84,
+    99,123,208,202,33,51,105,23,159,124,145,138,198,60,158,127,153,189,38,173,176,142,125,142,
+    109,158,110,181,230,177,111,122,249,111,101,177,159,59,56,106,101,116,228,168,199,156,71,190,
+    105,226,223,250,53,242,93,91,170,214,85,236,187,78,136,90,135,34,191,182,145,104,253,198,
+    34,245,37,189,181,199,42,48,87,197,214,83,22,107,49,186,214,51,22,109,188,127,216,74,
+    120,164,245,56,94,43,101,241,134,111,182,214,85,228,231,7,183,245,60,246,75,57,63,110,
+    173,15,190,252,124,123,237,249,191,198,218,227,79,13,191,221,235,103,211,214,55,114,183,110,
+    249,179,36,51,113,206,15,40,191,124,58,3,203,28,71,39,97,204,92,194,26,230,42,194,
+    190,92,47,232,89,239,93,81,233,107,127,146,13,70,231,166,177,75,138,14,40,51,59,35,
+    237,31,115,222,42,41,61,252,118,125,125,237,15,152,151,130,40,243,255,43,130,24,203,105,
+    244,63,34,221,105,52,190,227,217,202,191,227,41,189,117,70,164,140,189,178,162,121,52,229,
+    23,109,244,128,114,164,66,85,244,155,45,12,253,135,81,39,155,0,107,155,142,250,231,217,
+    135,247,7,194,83,21,243,10,236,183,195,95,99,212,199,196,104,253,233,100,105,40,150,201,
+    58,128,210,7,64,137,19,204,139,47,127,29,245,6,217,232,108,166,235,133,160,97,90,165,
+    141,46,89,245,66,251,67,230,147,190,84,247,252,182,209,202,127,69,104,156,67,127,133,55,
+    238,225,1,226,33,246,71,195,119,147,81,7,45,148,91,9,4,246,209,28,161,149,94,51,
+    119,105,66,177,27,109,199,147,110,101,253,255,165,209,44,106,85,106,171,187,94,37,136,163,
+    105,182,189,233,237,250,16,246,254,107,157,250,213,65,11,58,84,181,230,202,14,191,252,130,
+    250,214,65,39,68,117,107,248,185,232,13,97,106,147,223,230,20,176,244,10,173,163,71,67,
+    116,47,132,234,224,128,94,153,37,154,141,98,136,4,158,51,153,115,107,130,10,95,79,166,
+    80,100,154,29,193,104,126,255,14,227,84,155,141,14,70,23,217,228,89,68,170,160,211,139,
+    30,194,218,7,72,32,162,188,66,42,44,49,157,203,175,180,88,84,220,31,197,43,45,166,
+    107,129,116,243,1,152,196,35,102,175,223,17,142,229,73,157,166,27,214,131,238,142,136,11,
+    186,104,220,127,220,61,9,59,181,164,139,39,26,105,182,135,250,249,220,136,143,213,11,36,
+    212,223,197,90,159,66,168,114,60,168,177,182,79,124,246,252,78,114,237,181,68,92,192,60,
+    187,51,160,210,81,114,134,50,226,74,235,52,36,163,254,231,111,95,191,139,38,211,108,226,
+    225,37,239,52,67,239,245,135,179,9,44,62,149,142,159,120,70,225,127,79,71,67,44,88,
+    162,235,98,202,142,24,101,89,210,172,29,157,245,103,144,220,185,230,216,93,64,86,167,69,
+    100,85,247,174,19,34,131,153,247,109,97,53,192,40,82,200,228,172,198,142,36,235,23,94,
+    59,211,193,34,42,69,197,210,219,145,171,114,35,241,233,245,193,175,179,217,248,125,246,245,
+    44,155,206,130,97,109,52,206,134,149,149,151,251,71,43,248,144,69,221,131,40,224,118,251,
+    231,128,108,180,84,66,13,159,202,10,178,133,21,95,61,151,96,56,70,18,52,23,192,36,
+    38,211,26,196,63,179,152,32,40,3,206,183,88,0,109,78,234,117,225,136,20,248,249,236,
+    108,170,172,6,157,94,121,132,122,41,58,15,60,97,110,48,88,151,61,241,129,182,7,206,
+    113,17,222,129,176,193,146,209,162,203,93,209,11,96,154,88,93,54,105,149,127,61,58,122,
+    87,62,164,204,229,122,121,146,37,25,136,144,41,186,28,106,115,117,50,7,156,8,27,65,
+    233,187,64,12,10,65,252,182,116,157,52,166,158,252,66,195,138,219,80,210,53,179,124,117,
+    12,241,152,83,142,57,204,202,191,59,141,94,238,241,235,157,140,108,208,244,167,175,1,222,
+    118,77,81,162,167,7,208,187,114,49,8,100,237,229,34,51,7,25,105,150,112,126,91,7,
+    168,173,0,234,48,128,74,228,239,77,160,174,163,161,238,250,86,147,144,84,251,141,85,79,
+    231,182,100,67,172,71,228,179,216,197,209,189,213,179,73,150,2,18,64,0,153,82,13,86,
+    156,51,35,98,79,62,173,5,28,134,53,159,143,171,152,205,13,120,244,174,17,106,173,204,
+    178,203,217,58,236,194,123,104,132,73,140,29,31,191,230,208,19,155,248,53,195,57,225,13,
+    145,165,189,215,163,42,93,63,159,15,214,0,132,112,154,1,58,209,219,140,141,102,177,124,
+    75,227,172,107,122,195,19,109,60,242,79,192,163,40,17,70,185,215,91,223,107,104,205,23,
+    50,134,161,148,47,253,187,137,207,124,5,246,40,228,171,16,56,206,151,21,136,117,66,173,
+    161,201,5,182,150,108,21,207,61,246,145,182,151,144,219,52,59,183,204,251,214,175,97,182,
+    10,90,89,251,230,3,40,237,218,23,90,22,129,208,105,13,232,64,150,240,27,123,206,52,
+    98,239,86,138,71,77,35,254,114,165,223,70,113,30,195,236,195,31,244,198,131,104,60,197,
+    199,41,216,215,117,48,168,134,141,96,27,88,239,0,104,187,65,79,252,178,180,103,104,226,
+    132,230,232,248,50,44,112,93,16,193,195,70,189,190,237,1,143,99,213,133,178,222,174,229,
+    139,198,167,133,184,235,161,3,105,124,255,157,177,30,146,35,209,195,128,207,188,157,190,143,
+    131,82,151,57,189,9,59,154,87,212,127,68,21,93,38,245,130,126,141,211,94,69,210,27,
+    143,212,105,172,98,72,74,36,205,49,35,97,254,82,35,90,221,8,150,52,0,150,116,10,
+    255,134,202,160,240,116,103,24,84,171,167,94,70,2,4,174,73,98,44,110,24,8,114,12,
+    208,155,62,59,139,51,64,155,167,216,177,196,178,208,76,54,80,235,235,6,194,223,58,192,
+    5,195,111,98,124,142,79,174,181,215,121,208,78,209,40,74,54,139,88,66,54,192,141,223,
+    120,240,56,93,53,242,87,179,19,207,167,252,246,192,81,164,58,145,64,26,162,40,254,24,
+    173,32,36,182,70,243,177,178,242,139,88,171,136,223,21,208,40,60,4,14,250,42,229,9,
+    44,200,17,88,96,19,88,192,9,140,209,151,152,133,221,219,49,169,220,124,141,179,101,246,
+    89,250,158,8,201,181,23,3,81,59,233,182,115,19,137,118,92,20,70,111,214,100,138,200,
+    60,79,123,109,141,112,189,219,230,179,134,135,91,90,6,220,224,208,227,41,174,177,106,23,
+    140,149,136,199,194,188,14,216,129,213,46,38,209,248,48,212,42,167,136,93,254,139,230,143,
+    13,158,235,200,206,117,196,115,29,137,92,80,63,31,99,153,147,94,139,228,177,187,218,55,
+    22,217,198,34,146,44,180,202,101,228,174,246,141,37,30,65,137,104,216,155,142,102,19,60,
+    19,210,138,168,216,93,61,208,106,248,90,38,70,104,132,57,139,248,60,61,219,140,137,17,
+    109,250,224,97,35,3,39,117,202,147,155,0,158,239,226,176,237,28,135,109,59,249,105,27,
+    53,99,13,130,111,231,105,248,179,249,192,212,100,52,157,190,37,87,131,173,149,189,225,104,
+    56,31,140,206,64,126,252,235,207,16,74,63,251,16,129,206,16,146,80,236,74,249,97,228,
+    126,159,238,49,222,28,86,86,186,176,199,106,173,175,95,92,92,212,46,54,106,163,73,103,
+    189,241,248,241,227,245,203,238,108,208,95,241,87,122,131,206,10,247,189,186,120,167,229,125,
+    147,155,42,166,225,76,112,177,79,55,104,40,165,38,203,9,215,180,21,189,229,6,130,234,
+    95,161,147,142,21,162,201,233,89,60,157,77,42,117,127,203,211,222,149,97,135,226,138,64,
+    96,92,19,61,156,203,96,55,40,133,196,164,54,157,36,138,185,38,196,134,159,105,164,151,
+    227,198,122,51,14,225,239,238,44,60,201,126,128,252,53,81,44,129,37,89,136,98,137,41,
+    138,113,102,137,143,248,0,52,221,106,149,196,167,174,227,197,42,62,109,81,12,98,88,87,
+    178,16,157,246,137,133,227,115,226,90,56,52,4,86,242,67,209,113,201,68,108,11,206,182,
+    169,248,74,81,178,35,197,155,106,53,241,176,91,138,117,220,106,144,238,115,140,46,53,223,
+    138,232,38,250,150,60,74,62,3,245,153,47,192,57,244,181,111,70,95,219,133,190,118,110,
+    57,6,50,200,248,90,155,224,131,115,59,248,90,99,52,193,163,196,127,213,42,255,30,119,
+    190,255,123,156,117,240,240,240,251,119,226,155,50,153,157,52,82,209,127,173,99,166,117,156,
+    62,124,105,73,118,27,245,102,19,86,173,230,6,190,95,101,138,54,202,162,29,169,39,179,
+    88,126,246,215,141,219,190,62,181,128,141,211,221,132,126,170,237,58,175,121,134,254,4,90,
+    229,154,200,95,241,200,21,76,111,48,102,156,152,157,215,8,163,16,220,139,210,145,60,229,
+    221,155,89,39,250,202,61,209,135,217,232,8,150,208,49,30,38,70,134,158,175,106,9,139,
+    168,202,204,45,164,181,210,109,121,218,107,145,176,65,97,147,7,16,146,208,155,70,36,94,
+    155,149,39,235,145,254,56,180,111,185,42,184,215,198,246,156,205,177,55,146,90,133,30,156,
+    88,58,186,36,18,175,126,29,43,143,40,39,90,21,11,129,101,23,173,147,132,101,125,222,
+    59,167,231,57,166,158,124,52,43,193,103,139,246,68,6,241,92,133,21,203,219,197,90,171,
+    141,7,15,126,177,253,151,26,23,44,86,89,174,39,96,204,146,70,160,97,207,28,24,124,
+    4,138,156,152,113,76,114,43,237,20,182,185,41,34,89,59,11,51,11,166,235,184,164,86,
+    97,127,167,57,101,198,99,106,249,212,92,18,182,175,23,0,26,198,226,129,41,21,151,187,
+    244,177,38,123,110,176,104,92,52,234,110,185,220,80,229,74,249,169,58,95,67,215,90,113,
+    43,90,77,142,211,181,198,137,190,143,196,87,94,215,26,126,7,246,147,97,59,96,143,99,
+    146,125,101,187,63,66,143,56,213,74,123,45,243,214,155,232,7,48,57,142,78,214,98,191,
+    254,164,227,101,56,104,242,245,153,250,78,199,107,135,209,26,139,249,6,159,236,148,254,58,
+    98,142,245,176,32,190,25,39,134,52,90,175,164,232,38,38,163,42,57,45,86,162,106,37,
+    198,182,48,123,181,113,2,159,30,203,71,253,63,138,134,157,108,56,115,188,19,95,130,134,
+    247,215,54,209,251,26,253,214,159,200,103,148,27,59,140,98,27,104,72,109,14,109,92,196,
+    33,60,233,130,10,100,36,200,86,147,15,198,85,12,72,246,102,214,115,180,203,241,33,94,
+    154,132,50,135,47,18,231,216,178,231,14,164,219,59,24,51,248,211,225,209,93,238,204,188,
+    207,93,12,214,131,62,210,116,95,208,244,32,236,175,3,137,31,247,79,66,11,6,224,33,
+    3,143,82,140,62,210,219,64,204,245,73,91,125,246,67,238,2,234,245,222,167,47,31,247,
+    14,62,236,7,3,245,72,53,61,39,124,41,46,141,204,232,57,122,77,50,163,174,188,96,
+    176,19,246,97,108,250,225,192,79,212,123,109,192,208,78,69,194,41,79,168,251,13,74,24,
+    82,130,136,43,65,52,138,60,180,178,125,204,80,95,128,85,238,39,198,144,5,216,29,71,
+    46,244,10,233,78,201,164,49,124,31,24,132,68,102,134,24,132,63,232,11,64,62,196,142,
+    113,109,51,46,7,18,166,250,136,101,76,235,243,87,236,242,206,183,58,58,212,192,194,24,
+    198,208,173,194,33,212,29,13,198,188,170,90,58,154,85,88,117,48,113,27,30,190,111,0,
+    35,104,62,81,4,130,207,105,246,126,196,158,103,216,187,236,77,233,122,205,99,16,231,0,
+    60,161,42,216,179,70,244,184,163,199,164,197,60,8,132,76,4,32,195,203,87,1,64,178,
+    30,70,126,125,39,21,137,22,10,50,134,85,40,128,126,105,146,16,45,174,115,168,189,177,
+    3,4,103,41,89,237,223,212,11,238,223,111,198,136,124,218,74,249,147,143,211,86,230,75,
+    87,25,45,216,39,223,202,253,184,225,96,60,255,208,124,193,154,136,71,13,185,72,83,254,
+    178,159,182,22,107,246,55,180,132,32,137,241,27,122,240,65,79,133,155,181,45,159,46,92,
+    87,72,132,90,17,150,252,163,9,143,225,182,181,43,215,215,129,171,225,162,149,59,96,135,
+    22,44,25,191,180,71,65,209,237,123,238,237,237,59,247,22,4,200,94,177,98,252,190,174,
+    21,212,43,82,140,47,245,34,51,177,55,221,239,247,123,227,105,70,56,192,37,180,103,121,
+    182,36,214,110,121,48,132,53,241,251,119,50,239,15,212,249,108,83,248,41,17,175,33,71,
+    176,175,222,27,118,250,217,26,11,210,6,151,34,132,219,58,98,106,222,142,57,159,209,225,
+    92,224,165,85,216,34,208,27,231,233,147,4,130,107,232,38,119,39,55,243,211,48,219,173,
+    183,64,172,248,69,238,193,35,114,230,116,209,155,102,223,191,195,255,33,75,138,79,212,236,
+    174,37,173,20,166,79,192,215,123,13,156,106,180,154,138,83,151,232,19,123,163,224,242,61,
+    61,145,160,28,180,36,194,73,42,203,246,153,101,155,235,217,208,91,11,100,83,144,136,73,
+    72,83,87,214,100,166,161,176,33,75,219,73,32,43,112,228,125,242,219,107,162,105,63,10,
+    179,213,100,173,189,154,86,101,34,196,164,213,246,106,194,99,62,107,110,33,145,233,71,126,
+    169,237,93,219,132,97,41,123,237,223,172,236,21,125,66,66,253,196,3,159,49,240,57,208,
+    17,134,174,36,217,87,160,35,8,125,74,234,209,26,246,177,14,21,10,76,210,193,68,241,
+    29,88,195,139,105,50,16,152,168,195,52,241,109,234,152,25,40,40,178,185,223,95,104,115,
+    143,24,16,212,130,129,207,98,96,2,217,249,80,199,73,32,59,31,234,56,9,140,142,231,
+    168,50,208,186,110,77,168,64,239,185,77,245,129,214,117,174,1,144,67,69,100,225,65,112,
+    170,66,114,16,25,254,71,146,68,187,216,146,181,103,104,249,183,139,44,89,219,137,153,134,
+    119,100,137,100,169,228,141,46,229,50,231,156,157,182,164,153,127,37,191,246,196,87,240,105,
+    57,6,255,169,200,161,128,145,210,155,62,139,102,131,179,126,255,253,104,64,192,108,144,177,
+    216,167,91,48,248,177,238,46,152,158,195,153,234,155,163,104,21,182,64,124,227,138,143,246,
+    164,192,140,133,123,80,125,47,132,167,218,107,97,22,232,57,97,111,88,223,65,238,93,209,
+    50,202,101,1,54,51,162,21,175,218,240,86,69,160,197,247,210,248,54,60,108,112,128,179,
+    102,240,219,244,105,163,34,55,209,212,194,247,239,80,191,39,244,52,42,25,108,135,254,191,
+    244,132,237,188,254,153,226,22,69,72,64,9,201,190,232,110,147,78,158,49,8,130,82,248,
+    207,84,56,189,61,206,176,36,59,15,196,170,170,172,42,163,177,172,218,220,73,119,19,150,
+    222,196,244,86,197,110,6,183,144,62,254,52,101,83,24,133,50,235,63,83,130,127,37,1,
+    193,107,210,27,163,41,167,124,188,152,188,72,114,5,183,164,59,154,164,174,52,225,100,183,
+    56,199,110,169,182,213,170,53,183,2,190,226,140,71,23,21,125,123,126,248,245,44,154,100,
+    105,165,3,50,166,116,136,139,153,58,142,76,93,202,212,87,153,186,142,76,9,101,194,173,
+    229,147,140,134,170,193,67,204,165,108,198,67,108,211,130,54,239,64,180,195,222,236,205,104,
+    120,54,236,225,233,158,34,96,128,244,18,54,1,151,126,23,254,37,240,15,29,45,65,229,
+    87,11,139,204,161,200,28,138,204,161,200,92,20,217,91,88,228,10,138,92,65,145,43,40,
+    114,197,139,208,141,237,74,194,178,1,43,204,227,22,122,192,129,95,0,50,19,18,81,37,
+    31,23,247,43,71,126,19,94,51,255,158,35,191,9,172,145,31,143,90,112,233,159,147,31,
+    239,4,47,126,74,87,234,123,79,126,106,7,97,22,99,185,189,124,192,88,4,170,235,169,
+    51,185,186,143,151,247,44,69,158,170,236,36,65,44,92,121,243,36,126,235,206,66,199,177,
+    220,22,122,250,60,35,243,81,252,8,76,252,99,188,248,14,116,60,224,173,34,251,50,153,
+    254,167,123,16,3,138,122,171,247,202,234,112,100,244,86,203,136,29,158,141,152,106,133,135,
+    149,243,254,106,125,15,180,62,90,228,23,200,94,134,122,231,181,245,190,244,233,158,214,251,
+    219,14,177,116,49,46,251,25,228,70,157,182,141,99,79,123,40,43,245,188,235,159,49,236,
+    7,75,110,161,14,138,182,80,7,145,153,70,170,42,189,228,105,118,213,203,38,114,201,63,
+    184,221,46,74,91,100,207,235,98,255,116,142,175,71,176,175,166,207,247,29,231,27,124,86,
+    255,23,58,143,39,54,8,255,50,248,215,70,191,150,60,22,56,29,252,203,224,95,9,88,
+    138,49,193,15,126,116,7,112,94,23,134,74,231,117,17,213,144,81,13,17,213,148,81,77,
+    17,181,33,163,54,188,226,65,185,243,100,60,175,11,4,170,121,132,209,13,129,77,51,186,
+    41,80,107,70,111,8,60,107,209,106,18,29,220,151,208,12,64,42,90,55,81,105,196,107,
+    248,52,226,53,164,26,241,54,102,75,71,75,210,251,81,17,189,31,69,102,90,158,222,55,
+    144,224,143,162,187,74,149,247,75,240,72,239,34,22,86,111,248,151,193,191,54,186,103,213,
+    102,193,209,223,113,22,28,253,180,89,80,186,231,105,112,244,223,109,26,92,44,57,11,46,
+    138,102,193,69,100,166,49,107,58,201,238,47,110,199,238,73,109,105,55,86,199,162,216,147,
+    86,197,138,160,75,20,142,14,124,152,215,242,78,28,177,29,132,200,160,147,183,19,156,189,
+    89,88,50,33,42,190,230,205,213,192,175,61,194,220,129,111,89,18,186,118,243,35,96,50,
+    238,70,108,228,222,97,210,221,52,195,10,199,252,238,211,233,22,211,70,205,143,139,123,155,
+    31,203,207,3,163,239,175,163,226,215,30,13,130,127,93,68,240,175,35,51,77,35,120,226,
+    247,175,111,199,239,127,54,197,191,46,160,248,165,9,254,245,159,75,156,175,255,108,226,44,
+    41,234,124,253,87,83,231,155,37,185,241,155,34,226,124,19,153,105,189,233,63,207,162,116,
+    18,205,114,114,248,155,123,150,195,185,48,242,135,37,140,120,254,31,150,32,98,80,231,155,
+    191,66,220,48,229,192,55,127,19,17,91,145,225,155,191,145,16,97,224,234,195,146,228,249,
+    161,136,60,63,68,102,154,155,60,137,141,126,184,103,177,217,166,207,82,49,129,138,24,41,
+    37,27,36,251,225,47,39,217,15,127,59,138,253,240,119,165,216,183,75,82,108,233,109,17,
+    201,190,141,140,74,208,167,232,184,175,75,184,111,239,204,72,229,173,65,37,81,47,136,173,
+    70,129,161,44,149,122,65,186,22,70,252,230,32,57,166,83,254,221,168,21,225,129,121,155,
+    116,157,152,22,213,19,89,73,115,87,213,215,138,152,111,125,35,195,134,153,161,121,194,39,
+    71,214,174,164,98,7,73,199,179,9,206,15,30,75,59,72,58,132,77,44,38,254,54,250,
+    91,158,141,22,18,66,225,156,41,253,133,199,154,106,50,189,141,254,238,231,145,207,236,243,
+    200,156,175,146,55,57,95,37,226,218,175,213,78,124,251,242,173,245,201,183,143,78,90,7,
+    81,46,110,163,117,20,249,186,86,70,171,199,220,123,176,192,133,22,216,104,189,142,124,215,
+    218,210,122,227,142,223,104,125,136,208,85,180,156,218,173,183,209,181,23,252,225,224,31,92,
+    75,185,152,155,248,223,52,6,210,250,35,178,92,134,8,237,105,108,69,208,175,71,122,67,
+    211,204,84,154,54,52,109,89,126,212,134,210,85,80,99,35,81,175,88,106,224,170,252,13,
+    164,225,236,235,89,212,71,235,235,239,223,115,112,224,224,94,68,149,24,72,72,211,104,118,
+    168,71,70,171,166,106,40,41,151,137,40,194,159,210,10,86,111,218,202,219,81,50,62,67,
+    214,245,68,233,111,198,66,21,212,236,111,116,66,20,171,183,20,233,10,203,117,82,97,169,
+    183,26,107,241,58,62,42,88,173,94,219,58,222,55,41,48,91,240,150,220,106,204,119,210,
+    184,37,205,93,161,182,139,0,5,238,70,9,78,61,74,175,221,208,128,118,168,63,231,116,
+    159,243,100,144,215,123,22,74,207,130,53,224,19,101,62,227,15,82,126,50,170,8,146,157,
+    148,105,142,87,141,1,74,78,172,193,145,79,65,22,52,25,70,183,210,98,223,172,223,81,
+    103,158,41,57,156,205,70,207,112,102,225,11,229,12,50,210,196,52,52,220,29,64,192,98,
+    16,125,255,222,104,90,77,115,167,7,90,255,209,239,129,244,56,160,84,190,51,244,54,208,
+    14,219,18,168,105,165,253,224,65,219,82,43,219,109,174,70,45,30,47,121,215,110,67,68,
+    105,236,104,55,90,109,155,108,187,21,41,188,116,0,37,157,157,182,128,163,163,220,100,180,
+    143,59,176,252,163,134,43,159,247,93,152,247,21,142,138,46,206,218,174,119,125,109,163,170,
+    33,159,159,126,240,224,151,248,56,214,152,137,96,31,136,197,66,156,230,52,25,151,16,2,
+    24,58,93,171,149,73,134,134,16,96,48,81,65,145,185,11,82,217,51,212,116,17,223,203,
+    41,76,222,40,18,168,186,205,166,196,149,100,145,180,224,238,84,100,244,72,159,102,36,45,
+    96,243,134,176,224,214,164,92,86,63,201,137,150,59,13,134,20,29,36,180,65,110,124,104,
+    117,121,211,57,78,73,27,244,196,147,160,229,68,8,88,120,223,45,187,240,234,43,180,181,
+    242,190,139,208,14,9,189,1,57,38,56,247,58,119,142,198,23,17,41,154,251,17,83,44,
+    215,186,92,106,248,250,91,220,58,229,225,204,164,162,49,43,26,99,209,107,159,213,104,41,
+    220,11,84,76,178,33,99,6,92,243,16,205,134,88,61,133,26,250,23,81,37,95,90,104,
+    133,139,71,170,98,207,203,163,59,81,113,174,118,191,10,33,136,216,139,5,1,179,128,99,
+    190,194,222,44,7,1,255,196,130,14,96,162,34,96,200,109,131,31,43,65,204,1,137,120,
+    55,12,91,56,184,53,52,252,19,235,184,13,96,25,233,133,250,83,98,193,71,221,201,153,
+    67,10,58,46,4,229,68,188,189,25,161,145,8,66,240,54,170,196,142,246,99,87,251,108,
+    227,175,139,31,0,73,52,73,10,48,195,38,115,60,133,28,149,168,154,175,238,210,143,29,
+    177,115,89,1,212,77,133,111,168,62,99,11,23,79,84,133,121,188,179,180,223,241,187,142,
+    26,110,15,36,85,68,128,222,220,28,163,148,94,148,75,9,234,59,121,222,75,102,61,145,
+    33,84,151,98,177,204,229,32,18,82,51,159,254,49,194,77,219,97,23,101,69,122,189,141,
+    226,145,118,233,254,255,17,45,181,100,218,85,153,192,46,183,198,253,17,221,176,198,233,117,
+    134,249,150,29,39,66,238,117,233,143,104,185,133,201,168,93,63,223,41,238,28,44,25,157,
+    120,201,37,227,93,241,146,209,137,253,146,148,216,126,197,103,149,141,14,216,114,168,16,148,
+    233,1,230,156,156,140,134,219,42,153,11,202,92,24,140,116,113,201,120,226,217,104,144,155,
+    157,208,131,101,45,67,200,197,42,124,170,216,138,39,168,153,127,175,28,81,189,91,130,168,
+    168,78,215,202,111,116,210,88,11,89,10,23,194,88,103,139,14,98,10,137,240,221,77,68,
+    120,118,214,227,216,198,175,32,42,2,52,63,32,74,184,210,0,213,6,198,16,173,74,55,
+    208,240,187,37,105,152,192,101,80,223,5,175,82,160,18,32,6,54,166,73,156,122,23,45,
+    22,163,146,101,197,168,189,194,41,145,68,62,110,78,208,223,211,47,245,60,73,237,253,128,
+    175,233,158,230,0,90,126,47,38,23,218,154,237,45,32,21,108,53,170,141,120,231,176,177,
+    80,3,2,102,201,175,217,101,69,203,162,96,40,153,48,89,30,73,58,147,209,217,48,125,
+    134,181,224,182,84,20,215,162,115,249,100,107,182,119,19,161,14,172,87,36,226,204,28,118,
+    201,8,117,251,245,98,145,102,4,129,159,185,166,178,36,154,27,237,96,132,150,150,243,188,
+    146,13,207,6,241,36,210,203,136,56,51,135,93,114,74,222,136,245,114,44,70,79,117,237,
+    97,240,229,175,116,73,50,77,138,89,247,60,5,58,253,21,29,124,211,235,110,197,20,155,
+    44,247,104,128,26,70,78,185,90,148,119,131,3,131,216,112,14,226,52,235,75,162,65,54,
+    161,103,239,233,67,112,75,238,202,159,121,196,143,213,139,71,194,48,100,162,217,133,12,152,
+    167,104,1,31,15,90,252,246,238,230,136,133,54,132,215,202,144,11,33,164,17,39,136,101,
+    148,23,72,207,198,12,96,202,51,209,44,125,216,55,41,246,111,53,154,210,45,33,239,209,
+    229,247,239,142,216,185,39,59,105,38,232,55,85,28,175,26,142,5,205,253,210,240,56,97,
+    10,247,145,18,249,3,178,16,213,120,63,12,233,213,178,52,169,143,182,69,147,255,255,234,
+    222,180,187,141,27,89,0,253,206,95,65,243,220,231,97,91,45,90,148,108,39,67,186,227,
+    35,201,114,226,25,111,215,178,227,100,52,186,62,232,133,75,72,118,211,92,100,41,18,255,
+    251,171,42,236,104,52,73,201,158,204,123,115,38,22,27,107,161,80,40,20,128,90,254,68,
+    154,60,157,22,11,162,70,238,174,27,105,146,223,37,122,78,20,6,216,33,26,14,158,182,
+    222,31,62,223,127,126,242,243,3,198,215,183,148,56,228,208,201,223,214,67,43,137,251,218,
+    34,225,83,178,145,155,155,184,213,99,51,50,155,71,135,31,173,94,113,113,115,147,210,79,
+    134,238,238,23,55,55,140,103,176,89,64,217,81,18,202,188,40,13,41,35,2,121,186,197,
+    65,127,55,43,16,5,67,242,236,13,168,107,6,136,178,195,239,176,140,15,45,148,221,122,
+    1,51,29,177,130,179,83,141,132,174,230,146,145,192,102,215,98,104,232,40,76,254,238,106,
+    14,137,77,224,95,161,69,77,94,235,81,137,154,126,216,235,86,48,60,38,185,157,204,116,
+    184,197,209,119,192,211,17,226,137,36,190,255,16,162,60,99,223,114,120,199,223,97,229,28,
+    163,171,226,231,223,1,79,207,17,79,207,135,51,78,173,108,252,141,251,194,247,152,254,147,
+    239,48,172,19,28,214,225,36,30,102,154,0,160,233,23,223,161,233,23,216,244,123,40,123,
+    8,69,191,141,184,44,175,128,66,130,181,93,2,110,33,237,37,108,91,113,143,119,167,123,
+    214,57,162,87,3,2,75,254,248,121,91,180,165,22,218,106,22,222,126,78,195,95,217,120,
+    73,22,23,111,128,133,119,26,115,114,66,222,224,201,60,226,41,249,137,165,221,42,124,206,
+    189,141,99,40,146,217,180,24,147,249,101,103,255,96,111,47,84,73,249,226,5,195,182,175,
+    94,103,139,65,145,226,19,1,155,9,47,140,149,165,78,39,69,177,24,136,82,48,184,95,
+    238,54,56,107,108,191,148,198,22,23,197,248,191,61,50,123,48,185,21,189,32,187,0,208,
+    214,108,178,42,28,248,187,2,164,125,244,41,32,207,142,159,233,177,42,125,153,167,217,37,
+    108,183,120,140,15,51,252,131,94,110,88,231,58,238,92,39,157,235,180,131,142,45,154,236,
+    105,13,142,93,134,207,242,100,103,191,203,223,55,213,59,86,202,125,109,62,205,2,114,96,
+    83,23,7,66,179,159,40,137,228,35,139,245,110,198,122,0,225,73,158,126,110,66,239,33,
+    11,179,96,133,123,120,132,174,12,185,207,250,44,74,187,8,228,206,78,66,254,182,217,211,
+    84,116,19,175,82,221,40,79,74,176,54,251,41,146,144,48,233,91,39,198,72,4,236,105,
+    143,236,241,247,97,184,61,126,13,14,227,217,45,141,199,246,162,100,13,99,143,91,218,197,
+    25,84,206,200,80,249,115,115,15,224,230,38,156,38,220,105,148,117,17,171,187,187,132,87,
+    27,46,4,157,252,160,173,86,228,233,0,175,84,130,12,112,155,254,244,211,79,128,135,167,
+    241,89,118,254,12,154,232,36,81,182,211,238,242,89,234,170,89,250,46,208,26,243,87,217,
+    66,77,207,91,232,153,176,12,61,105,122,38,91,31,127,103,64,166,199,3,212,33,199,42,
+    80,33,181,206,240,188,12,173,161,140,231,51,186,48,159,103,139,5,176,150,121,7,223,148,
+    229,122,59,21,137,159,49,76,9,190,176,170,239,10,229,116,217,138,184,211,116,155,225,23,
+    72,167,12,93,168,209,66,255,92,181,152,102,217,28,42,114,62,32,151,209,92,215,155,43,
+    133,60,252,162,232,54,104,31,109,187,30,6,241,51,237,238,236,0,9,160,195,105,116,215,
+    148,157,27,119,100,38,34,236,167,247,89,241,181,206,125,82,54,112,91,168,47,138,58,67,
+    63,148,192,57,234,19,226,27,141,160,43,26,48,176,109,54,178,218,192,76,76,10,233,228,
+    238,198,103,98,8,36,5,73,1,235,11,66,143,47,183,101,204,121,53,99,126,153,86,96,
+    198,227,71,216,158,166,158,103,154,250,158,105,234,119,227,8,136,57,38,191,89,113,32,124,
+    62,178,157,126,23,79,12,9,122,200,122,20,252,1,50,207,24,160,120,1,80,52,179,112,
+    47,236,133,108,183,143,255,134,177,225,82,16,6,205,190,195,110,196,74,187,209,23,100,245,
+    179,28,6,222,168,220,125,218,155,118,159,242,197,107,29,79,201,47,133,98,253,98,56,1,
+    20,105,4,137,223,176,208,126,149,248,106,6,40,41,174,182,222,192,254,241,29,144,241,143,
+    18,50,232,170,171,129,55,226,201,183,55,223,79,220,230,115,114,53,131,237,255,243,59,16,
+    240,63,83,15,251,202,242,20,126,209,122,235,236,63,2,185,129,39,192,170,162,207,117,139,
+    153,232,94,94,159,86,237,244,232,61,6,13,233,216,78,27,67,140,160,19,124,29,81,68,
+    241,253,126,32,66,228,200,121,86,16,54,131,150,1,162,8,160,3,144,181,59,20,99,160,
+    15,39,247,120,55,49,3,207,64,230,62,100,166,74,71,19,10,197,59,216,243,46,252,131,
+    58,154,118,8,26,128,16,213,58,87,38,60,131,205,240,0,134,76,104,208,105,222,0,128,
+    129,229,91,2,166,23,181,33,15,182,84,216,250,119,209,203,150,3,1,249,222,3,180,196,
+    43,22,181,30,63,32,22,208,45,241,113,190,185,125,37,145,250,221,44,187,136,216,195,102,
+    188,219,15,172,140,55,217,229,2,51,6,187,242,81,250,115,209,235,161,143,80,172,145,61,
+    72,173,68,42,221,123,144,174,254,243,156,141,235,200,32,167,26,71,46,92,225,36,114,161,
+    10,71,145,59,222,48,143,220,145,134,181,169,197,48,147,104,250,96,10,152,75,224,223,56,
+    218,29,61,72,119,246,31,140,96,78,70,144,48,138,154,237,157,81,0,105,205,221,118,235,
+    241,46,228,4,15,18,248,104,61,198,228,41,8,55,208,218,110,123,55,167,50,80,100,39,
+    199,2,48,35,211,110,30,229,15,210,221,252,65,162,29,241,2,75,238,115,31,188,248,250,
+    20,63,232,157,141,65,48,220,25,193,143,1,254,152,194,15,134,63,114,248,49,65,153,209,
+    100,206,241,119,88,208,113,250,23,206,155,179,55,37,81,27,40,157,187,225,220,235,166,2,
+    25,105,128,218,88,17,98,32,61,7,220,33,6,224,71,108,13,253,213,119,24,250,171,52,
+    172,85,140,221,22,188,92,97,160,201,208,35,165,8,206,212,99,209,53,185,239,63,29,15,
+    147,172,196,217,164,95,101,140,5,129,76,57,149,65,39,40,150,22,51,239,115,155,228,146,
+    155,218,106,198,218,121,124,242,44,233,72,221,130,32,232,224,214,13,29,53,177,117,20,249,
+    242,139,108,182,160,70,43,250,190,199,110,110,238,37,247,239,91,125,161,135,191,103,76,237,
+    14,168,133,8,192,21,189,122,220,58,250,253,195,201,233,231,119,39,239,63,159,188,58,121,
+    125,242,230,3,65,26,3,200,252,188,104,72,73,4,9,63,221,227,62,106,142,208,135,76,
+    202,224,212,3,216,248,117,152,125,133,204,251,247,225,88,86,31,230,252,50,11,32,120,206,
+    22,12,243,184,150,229,63,179,43,138,92,249,118,230,6,94,209,15,115,18,59,32,203,114,
+    236,198,65,40,41,42,38,138,194,104,66,32,175,38,173,121,49,51,156,197,199,97,77,79,
+    17,42,5,237,162,91,239,85,96,186,44,135,10,229,33,113,252,234,72,70,10,2,238,0,
+    201,158,214,20,125,240,96,112,172,189,110,95,136,205,61,21,15,4,253,240,244,128,186,67,
+    242,218,41,0,30,195,18,232,239,236,156,71,12,22,193,216,88,244,97,15,40,117,145,229,
+    206,189,139,242,84,174,36,244,54,110,151,184,75,104,103,250,210,199,59,158,234,80,221,17,
+    221,181,194,94,182,115,238,4,238,19,1,152,122,34,34,148,202,233,7,165,208,41,125,56,
+    75,167,133,40,172,41,182,143,74,26,252,217,179,71,114,88,16,38,244,201,29,60,194,193,
+    168,143,14,28,101,247,95,7,195,113,102,66,160,98,127,233,22,229,163,193,182,253,169,10,
+    208,153,242,191,100,244,89,243,119,122,171,209,52,55,140,2,254,231,70,254,97,225,53,197,
+    239,112,67,75,106,37,90,30,58,194,58,38,113,143,217,114,33,124,128,147,210,168,83,199,
+    3,211,168,142,133,235,75,56,165,246,64,38,78,195,122,194,114,242,163,77,157,52,2,225,
+    14,25,228,197,207,104,251,140,85,112,133,190,40,102,150,144,216,20,189,118,29,72,80,130,
+    150,218,109,103,231,228,124,182,11,140,204,160,65,168,57,202,174,230,164,182,211,32,174,223,
+    192,11,62,170,137,135,13,33,122,71,169,60,37,107,47,230,60,154,223,51,241,23,185,139,
+    96,51,173,28,64,10,69,35,161,108,34,100,198,225,26,221,2,121,175,31,37,63,48,150,
+    159,69,195,181,88,92,73,6,113,36,127,82,200,4,156,251,56,186,198,174,59,2,2,234,
+    191,211,163,198,20,143,109,74,184,56,53,134,28,56,79,41,1,53,47,182,234,202,208,63,
+    48,13,214,73,167,25,144,16,192,90,190,99,16,17,158,53,234,8,120,126,44,131,140,88,
+    115,104,156,189,215,206,181,133,46,33,160,50,59,212,164,140,48,57,39,107,101,25,92,50,
+    45,150,241,56,147,95,189,113,193,22,242,67,108,34,226,11,1,238,227,167,128,168,159,136,
+    96,142,23,228,62,76,22,227,95,251,246,231,129,253,249,72,53,50,144,141,240,211,146,76,
+    254,71,42,146,141,19,165,204,99,50,143,238,62,59,250,119,198,116,161,95,210,110,77,140,
+    150,223,254,202,140,159,211,213,230,69,248,49,159,47,167,83,218,33,104,41,18,130,235,13,
+    12,126,226,9,251,197,236,103,102,45,136,0,91,192,56,38,198,197,236,11,68,239,193,62,
+    191,159,117,111,109,173,204,219,31,159,159,15,231,32,27,57,87,173,198,1,250,213,173,14,
+    208,235,206,207,235,15,234,241,119,235,71,156,211,43,250,249,103,101,63,181,170,142,230,206,
+    42,245,46,26,121,114,59,216,219,235,24,151,107,155,208,110,157,236,96,158,58,27,234,113,
+    36,58,181,246,55,213,226,40,177,206,163,100,216,216,88,26,36,107,177,150,58,8,15,64,
+    186,212,170,197,49,118,26,245,145,32,123,177,235,32,123,76,101,89,252,176,54,14,17,108,
+    2,165,111,3,58,114,43,47,85,4,124,68,27,200,59,78,155,63,86,151,231,14,16,205,
+    69,138,71,10,79,172,9,123,209,54,194,90,44,36,12,63,164,17,183,50,169,32,0,53,
+    255,21,195,228,68,177,21,37,72,86,131,20,212,221,92,77,172,38,93,169,189,69,37,177,
+    52,116,165,253,21,141,78,81,124,213,101,51,95,34,50,68,157,94,64,34,5,214,200,96,
+    216,43,133,200,166,96,87,129,150,204,141,133,199,245,47,213,11,71,34,36,225,132,20,47,
+    119,74,17,73,48,8,187,219,122,251,142,173,63,112,91,175,1,175,159,56,74,252,218,1,
+    180,209,172,118,17,26,170,64,9,252,238,251,254,253,228,44,59,127,202,186,193,206,78,198,
+    29,60,239,182,185,152,141,2,253,79,113,55,216,221,237,161,168,223,21,120,201,110,110,122,
+    88,51,200,126,194,82,205,30,183,27,158,176,203,102,47,108,163,143,228,30,28,43,67,109,
+    232,102,114,37,13,83,212,67,15,219,242,188,73,143,12,189,192,100,107,78,1,147,225,101,
+    15,88,216,123,192,28,157,35,200,28,218,10,46,82,119,8,99,21,249,192,33,141,162,120,
+    215,176,123,142,201,173,187,88,124,217,154,45,243,101,78,221,213,9,162,250,28,154,163,144,
+    165,152,217,106,240,72,89,128,130,123,194,249,170,57,25,50,124,3,31,139,8,83,172,108,
+    20,233,229,103,75,24,232,79,125,56,175,103,147,233,226,10,186,173,153,253,234,67,20,189,
+    214,80,124,95,34,167,158,25,157,150,95,62,150,207,207,112,90,24,206,223,176,55,116,54,
+    218,10,24,24,27,194,130,98,59,171,115,228,240,86,5,62,80,27,30,149,211,239,181,69,
+    68,13,232,23,33,67,146,186,127,63,251,169,191,93,63,111,151,139,58,192,87,224,57,26,
+    25,250,220,104,62,204,172,14,178,168,191,50,165,230,248,254,125,247,254,34,230,65,51,123,
+    164,20,171,150,93,143,158,24,240,120,11,213,241,149,175,119,30,114,108,164,91,98,131,136,
+    108,19,58,82,11,90,173,1,92,76,129,80,28,158,166,13,38,141,101,109,81,82,88,75,
+    188,75,46,141,144,93,202,13,173,44,184,135,226,148,173,204,62,224,132,223,70,187,62,64,
+    64,95,26,244,221,107,195,193,158,161,85,31,96,4,167,12,126,239,180,207,49,168,42,30,
+    45,111,110,48,109,140,246,120,132,178,96,128,182,168,42,68,253,40,234,63,72,194,105,52,
+    218,77,194,60,26,237,36,58,190,135,192,244,152,119,4,155,214,217,8,111,10,208,248,20,
+    103,236,108,10,95,55,55,252,119,14,191,131,107,106,154,163,108,133,211,59,32,158,138,55,
+    18,25,205,37,6,151,37,80,195,1,117,59,66,231,236,161,221,25,239,5,154,164,107,9,
+    224,124,212,210,222,83,52,248,225,213,97,93,12,162,222,131,164,75,213,61,240,150,155,200,
+    232,0,164,204,59,42,89,29,11,247,128,80,215,176,186,24,11,60,72,130,146,10,207,32,
+    249,14,10,35,131,210,211,138,56,208,148,36,253,35,239,49,223,177,70,128,67,23,146,60,
+    238,49,237,135,112,4,235,77,231,55,55,180,13,88,97,177,17,57,61,254,208,202,47,29,
+    16,68,58,49,227,254,19,180,104,163,196,229,213,53,68,222,35,166,143,209,233,114,70,4,
+    75,102,100,149,71,102,11,36,88,93,214,73,88,54,209,49,90,227,37,59,241,202,138,231,
+    109,6,24,71,194,162,203,55,13,184,56,112,227,109,156,101,22,121,76,216,71,211,191,215,
+    197,108,58,248,64,202,90,167,24,83,57,79,178,181,247,92,234,57,95,196,195,65,195,218,
+    204,180,168,133,212,49,222,91,12,132,26,126,127,135,252,103,103,192,244,224,55,254,194,152,
+    193,60,36,20,5,153,233,214,248,202,235,209,97,221,186,126,132,37,131,196,205,90,198,165,
+    96,115,0,181,70,232,64,218,73,31,243,116,244,222,13,152,24,192,18,191,185,105,14,100,
+    208,168,80,244,201,151,126,183,103,24,9,244,147,102,163,53,209,120,120,153,247,198,132,136,
+    249,89,99,39,134,245,73,147,178,211,56,111,132,131,112,28,72,18,104,63,76,180,65,129,
+    36,2,140,206,130,70,95,189,97,158,30,93,57,231,127,109,186,200,186,110,72,100,128,149,
+    95,87,20,147,108,49,187,194,219,99,249,27,99,165,78,136,8,128,96,153,241,229,245,29,
+    192,96,42,132,247,0,130,219,140,1,101,68,126,18,230,255,156,16,142,209,100,172,130,26,
+    230,107,110,97,175,87,64,128,15,255,175,121,246,239,175,187,231,15,158,5,240,35,61,223,
+    9,254,231,161,184,127,85,166,161,189,167,125,189,155,15,136,107,133,181,113,52,32,8,81,
+    189,56,161,192,94,200,178,209,186,122,44,47,16,5,83,30,163,250,13,176,181,244,108,116,
+    142,152,194,191,17,82,153,34,37,180,210,102,210,122,100,132,18,78,26,8,83,251,35,214,
+    90,75,238,205,81,136,237,209,216,204,53,66,139,254,80,34,219,153,70,84,110,98,10,173,
+    190,125,86,213,68,228,118,234,111,138,186,154,56,4,15,215,229,171,2,163,151,215,49,222,
+    76,171,17,132,228,255,128,211,71,217,120,79,73,251,137,133,27,177,10,203,247,132,9,137,
+    25,41,151,28,123,138,217,103,218,145,5,250,177,64,73,7,45,161,68,152,43,206,126,110,
+    110,26,226,145,179,97,108,183,55,55,180,225,10,190,121,176,71,10,212,131,97,54,195,56,
+    139,87,55,55,134,229,14,134,190,28,232,144,151,3,57,241,184,49,15,206,233,2,147,226,
+    206,194,92,35,116,106,182,49,9,109,140,141,181,56,7,114,67,141,122,217,244,8,154,30,
+    41,250,232,142,56,177,143,97,254,236,90,178,252,20,202,79,159,150,242,101,253,41,212,239,
+    157,149,178,207,166,231,231,17,28,60,100,43,52,99,61,185,243,3,170,102,146,212,168,125,
+    146,40,42,122,216,217,153,242,122,95,168,76,119,193,39,224,11,191,216,238,206,228,167,81,
+    23,86,108,254,172,221,217,11,86,169,158,173,74,38,5,60,42,39,222,180,8,103,48,151,
+    61,53,217,15,154,125,220,223,248,201,123,20,53,90,113,145,11,150,54,48,88,90,210,132,
+    125,118,180,211,104,77,197,243,127,35,28,135,13,248,104,160,113,112,210,100,41,229,154,26,
+    36,144,15,123,182,200,23,181,137,39,82,214,60,25,55,12,53,45,58,39,8,144,158,213,
+    144,198,59,130,89,102,36,89,174,60,187,185,121,111,55,203,230,217,226,185,220,16,189,130,
+    230,94,104,152,182,241,125,82,233,245,9,49,40,182,84,30,120,25,180,26,99,250,76,200,
+    194,148,75,65,103,169,117,242,38,243,98,174,242,45,160,64,15,29,246,129,214,130,6,184,
+    177,7,18,38,173,1,69,231,192,158,177,141,166,80,178,147,109,59,71,197,245,18,246,246,
+    93,201,118,154,27,76,115,94,167,183,10,189,222,109,138,128,235,42,34,49,108,143,158,88,
+    234,49,20,224,66,20,169,39,203,23,8,244,162,83,75,164,198,222,135,236,18,32,203,60,
+    126,8,22,34,39,146,108,217,150,243,100,184,224,216,114,143,130,155,221,253,251,190,251,169,
+    215,72,202,67,54,230,252,23,111,149,197,123,78,93,116,212,8,245,145,29,155,89,153,71,
+    99,1,75,200,227,178,188,238,159,241,199,28,227,229,143,155,53,98,160,10,211,204,49,48,
+    11,224,242,163,2,180,69,243,111,171,64,194,45,233,82,97,152,55,231,166,114,202,62,208,
+    40,57,43,150,253,1,172,236,57,181,167,190,204,28,171,60,134,56,27,171,242,234,203,204,
+    177,202,163,201,216,124,120,145,33,48,242,183,134,71,166,88,85,208,44,102,57,102,4,191,
+    252,173,171,200,20,148,252,140,58,131,97,62,84,96,169,47,51,199,70,208,56,99,179,227,
+    130,98,197,167,250,203,204,241,151,127,111,225,171,156,236,45,107,53,37,130,127,240,6,228,
+    135,145,110,21,198,55,170,236,18,109,155,178,25,85,48,19,156,124,171,34,136,193,125,140,
+    204,107,84,181,147,74,101,60,253,146,57,222,220,232,151,39,56,249,118,191,69,159,119,86,
+    244,249,151,157,11,50,6,246,54,204,69,41,253,109,231,90,181,226,49,215,191,162,42,242,
+    3,237,137,228,111,155,124,134,41,95,28,248,67,124,91,5,138,41,75,134,139,43,42,35,
+    126,235,84,171,36,112,192,124,14,44,3,112,68,165,141,111,59,215,170,197,198,211,1,251,
+    144,205,121,29,245,101,230,88,229,211,108,186,24,168,242,234,203,204,41,151,255,52,27,46,
+    50,93,129,62,173,188,50,63,208,85,244,167,149,103,85,249,58,156,101,116,150,162,26,234,
+    203,204,241,151,199,139,111,50,16,177,43,170,100,111,217,234,166,18,54,45,55,4,137,56,
+    255,110,90,117,43,127,20,195,188,220,12,166,250,74,58,28,82,69,211,75,213,135,145,206,
+    205,49,25,57,173,208,227,30,27,195,29,123,71,153,178,249,0,239,174,248,36,138,15,35,
+    221,42,220,231,230,135,84,86,252,214,169,54,249,163,40,197,233,31,127,201,20,171,204,180,
+    24,95,245,139,252,45,233,222,81,89,43,197,45,81,93,151,63,94,148,91,224,233,254,210,
+    213,173,125,204,135,139,121,185,49,74,246,150,117,246,128,209,48,207,37,155,144,31,70,186,
+    189,143,25,210,54,223,202,140,4,39,223,158,182,225,98,144,205,100,55,234,203,204,177,57,
+    233,112,62,140,197,140,136,223,58,213,222,24,230,217,12,181,169,248,198,32,62,140,116,123,
+    154,43,184,104,59,50,114,29,190,248,167,228,139,127,102,226,187,84,224,16,143,128,75,77,
+    239,78,90,185,148,141,84,177,86,225,111,20,115,163,233,160,204,26,95,139,82,242,131,138,
+    202,143,32,180,217,236,189,61,123,43,88,78,166,84,191,134,91,1,255,160,250,226,119,80,
+    42,125,170,214,131,250,50,115,108,185,138,226,6,72,248,212,23,117,160,190,130,192,210,81,
+    145,57,188,53,33,221,90,137,221,123,56,41,246,149,77,22,80,92,178,179,44,204,206,131,
+    110,106,22,143,202,94,64,179,96,101,81,224,124,58,102,73,134,91,183,132,213,73,35,136,
+    157,180,192,33,99,157,169,81,84,74,245,149,172,108,231,136,219,171,167,165,68,79,57,191,
+    16,42,135,99,38,208,88,204,132,192,94,246,74,238,148,149,205,4,78,134,70,66,224,149,
+    78,101,85,227,155,106,26,223,254,138,47,165,67,11,171,250,75,195,245,70,41,205,43,235,
+    74,0,140,111,2,192,248,118,0,200,47,20,208,244,147,195,75,63,237,146,176,183,141,209,
+    62,247,66,66,105,38,56,249,86,197,49,234,92,203,78,228,7,117,35,63,2,111,121,27,
+    39,165,84,95,73,155,73,20,138,67,20,138,61,20,229,137,167,52,187,51,59,169,84,198,
+    222,82,209,75,130,177,132,140,111,234,210,248,214,55,123,105,249,208,155,101,127,245,161,151,
+    159,121,203,71,89,254,54,128,205,191,160,231,1,186,26,28,162,81,156,30,119,66,70,136,
+    88,102,217,59,75,248,217,179,153,240,103,25,140,125,65,26,29,80,131,160,252,208,76,48,
+    90,120,208,149,106,179,212,34,91,44,102,195,120,185,200,184,127,211,30,191,47,21,67,36,
+    59,15,213,65,38,58,200,68,7,221,24,67,105,28,202,6,154,189,80,118,147,181,64,0,
+    157,160,52,3,63,85,252,22,116,186,195,47,42,107,162,115,244,19,50,165,155,108,250,76,
+    103,236,43,42,52,235,20,110,80,48,119,180,100,133,10,63,28,187,123,101,165,131,44,234,
+    161,25,42,193,246,51,182,15,240,206,209,246,36,68,203,178,101,142,127,39,226,212,79,200,
+    225,206,199,168,187,24,221,150,160,173,10,249,69,49,232,139,84,6,120,236,85,83,16,207,
+    240,85,18,29,144,90,158,183,40,21,209,111,55,71,245,79,24,160,73,250,247,48,93,131,
+    11,141,246,101,47,186,6,10,255,145,43,61,171,95,225,199,161,74,212,63,121,234,49,70,
+    134,151,106,210,13,165,144,218,184,167,222,197,75,197,158,149,43,26,173,66,175,237,39,10,
+    0,241,147,250,146,201,198,111,44,45,244,225,58,250,39,149,150,201,198,239,176,102,42,208,
+    217,218,116,244,241,228,145,145,35,62,86,221,97,210,250,133,229,233,56,131,227,234,245,64,
+    252,234,156,157,59,238,162,149,3,73,89,68,56,218,162,231,55,144,253,42,158,4,173,42,
+    37,109,22,114,81,22,237,203,37,17,159,37,59,220,108,22,181,91,90,176,110,208,115,97,
+    160,180,196,205,39,21,87,5,121,152,88,90,136,179,98,62,127,59,27,246,135,185,180,230,
+    46,114,188,135,226,198,92,166,205,165,200,120,55,43,250,51,216,249,124,121,199,5,218,72,
+    216,138,36,104,22,52,92,200,43,174,117,175,55,116,229,191,215,205,244,77,61,190,122,162,
+    205,149,169,82,38,91,162,231,106,106,66,115,210,208,46,226,113,15,123,253,166,56,18,71,
+    252,206,94,248,134,184,130,74,104,135,135,41,136,220,176,181,170,164,253,240,116,25,147,109,
+    170,153,122,16,190,22,1,125,84,210,163,240,120,57,95,20,19,149,240,120,21,114,206,249,
+    50,228,204,235,50,149,87,116,169,132,88,193,71,30,15,141,155,67,162,23,242,132,72,254,
+    17,123,59,60,160,192,40,50,136,16,95,39,81,117,89,168,130,140,158,177,104,36,216,126,
+    208,1,6,12,60,235,88,207,46,198,194,101,248,88,195,11,24,251,86,204,157,253,100,83,
+    64,157,193,67,226,32,108,147,242,192,222,57,21,248,58,131,163,97,212,62,57,144,233,109,
+    157,254,129,210,141,54,83,124,47,228,124,211,114,61,175,75,160,116,216,224,157,162,242,76,
+    230,233,166,49,25,226,3,150,47,123,111,111,31,242,205,234,37,104,204,234,53,55,31,235,
+    27,192,12,40,143,229,195,121,177,152,97,64,132,1,186,1,61,5,12,231,217,12,136,233,
+    227,199,151,207,155,65,119,124,22,159,107,77,178,120,197,223,144,128,194,71,209,53,222,168,
+    118,220,26,33,46,178,78,227,117,54,31,188,98,168,194,162,214,65,3,118,91,254,96,131,
+    123,157,144,242,115,24,199,244,188,43,244,11,167,82,13,251,121,220,63,230,74,207,234,155,
+    246,12,249,141,119,233,176,99,61,231,18,137,210,194,30,143,151,147,97,78,71,170,70,199,
+    208,30,197,250,248,16,220,232,140,248,109,111,110,234,150,54,228,13,24,102,171,155,49,118,
+    150,159,91,165,232,138,71,248,51,145,61,194,217,76,167,120,174,185,249,245,182,179,140,59,
+    141,112,26,54,72,223,167,62,46,114,16,94,234,74,63,181,213,8,202,157,62,31,246,122,
+    112,126,69,240,184,187,184,216,160,176,60,208,46,227,120,205,154,81,245,84,136,190,88,87,
+    138,193,27,170,27,181,79,132,216,141,181,165,8,190,85,109,217,213,113,145,245,168,107,117,
+    151,108,99,94,28,177,27,157,70,204,230,195,4,9,55,183,21,243,129,76,71,92,249,159,
+    104,234,8,139,41,138,10,186,141,233,0,48,184,185,222,59,44,102,214,67,211,171,148,205,
+    210,205,85,79,69,73,163,182,57,4,32,1,99,126,240,208,62,104,230,36,235,200,244,247,
+    180,102,173,36,126,253,98,37,125,130,101,106,37,28,170,181,89,213,33,111,216,160,69,171,
+    245,114,58,118,81,78,213,253,200,53,83,83,69,124,4,240,218,28,162,44,96,142,81,166,
+    153,131,148,105,122,148,50,101,205,48,237,198,13,200,237,30,60,25,206,72,203,125,217,236,
+    1,138,144,23,33,28,166,58,163,169,49,82,150,57,64,74,48,71,71,9,122,104,244,185,
+    102,92,70,131,6,144,70,171,110,170,51,28,167,253,210,88,14,223,226,64,248,185,79,141,
+    226,240,173,57,132,195,183,38,252,135,111,9,248,154,248,88,3,186,108,197,100,128,111,75,
+    64,243,246,172,132,53,224,30,45,39,83,98,189,226,38,74,129,140,25,38,208,248,109,130,
+    141,223,26,235,248,181,6,242,35,121,89,37,187,226,87,51,185,175,92,105,140,186,103,39,
+    209,25,167,13,67,105,164,92,248,162,93,72,93,139,169,209,242,76,115,188,60,197,28,49,
+    79,209,99,230,223,107,70,205,11,240,59,99,221,175,61,244,154,83,186,52,122,19,142,82,
+    178,131,1,23,162,18,14,124,59,146,133,7,89,192,196,132,76,51,113,33,211,52,54,100,
+    202,26,124,216,141,27,112,219,61,120,50,156,113,150,251,42,141,244,181,188,49,163,141,193,
+    188,79,83,99,85,69,204,193,170,68,115,180,42,81,15,87,37,173,25,175,211,129,49,0,
+    167,23,95,142,51,100,79,127,229,29,67,61,215,226,160,173,27,72,53,104,85,196,28,180,
+    74,52,7,173,18,245,160,85,210,154,65,59,29,24,67,112,122,241,229,56,131,246,244,87,
+    230,183,120,237,78,44,87,94,198,107,174,139,41,22,227,197,4,139,247,98,130,30,31,125,
+    174,99,192,186,65,147,191,234,86,221,84,151,19,219,237,219,99,233,141,135,211,211,97,154,
+    165,180,56,241,229,183,109,245,207,237,33,237,18,181,125,171,136,126,118,72,174,110,35,19,
+    215,205,138,245,1,155,215,227,44,203,235,240,73,134,87,139,162,46,222,150,65,252,26,169,
+    23,103,155,123,171,151,94,101,191,169,30,114,101,138,126,167,213,71,9,222,172,248,52,47,
+    114,101,154,241,148,162,108,53,249,211,147,252,84,143,159,128,22,56,207,56,112,153,239,252,
+    141,206,61,212,140,201,73,200,180,244,1,246,65,42,237,177,36,107,248,179,219,129,227,253,
+    196,171,242,88,129,92,195,104,19,15,31,121,176,90,121,196,105,232,152,11,190,247,239,11,
+    247,179,90,234,235,122,196,104,52,46,46,85,144,60,189,219,254,105,100,104,9,140,74,15,
+    82,105,203,80,56,106,142,245,157,134,184,166,29,1,144,205,64,220,207,29,101,209,117,154,
+    37,69,154,97,13,215,72,202,123,251,134,5,159,83,149,89,96,120,20,54,147,91,188,201,
+    38,51,35,170,52,26,226,46,138,121,194,74,157,146,197,44,157,128,142,7,120,190,193,218,
+    103,137,14,45,196,91,252,248,254,37,94,12,21,57,12,182,153,205,19,54,205,208,124,68,
+    249,209,255,56,27,3,234,51,199,141,36,190,84,140,135,139,102,227,97,131,158,199,248,51,
+    164,21,30,171,209,122,216,160,40,127,83,35,150,65,11,159,219,169,214,14,252,83,186,254,
+    234,221,238,110,93,58,57,17,90,86,24,239,237,254,125,105,42,172,141,126,220,50,207,106,
+    110,74,231,8,136,211,26,47,6,4,232,71,226,234,94,120,4,230,183,247,221,62,82,195,
+    167,225,98,112,60,203,82,192,218,80,197,182,248,106,39,98,81,247,166,63,9,174,147,200,
+    184,225,79,2,101,42,133,251,46,222,49,91,87,217,164,24,22,241,40,63,161,153,218,224,
+    206,56,27,164,48,105,27,136,87,216,242,104,37,98,50,130,222,105,212,231,131,98,57,78,
+    129,125,213,17,76,224,93,56,128,58,47,205,39,70,40,29,163,255,143,140,209,145,159,207,
+    228,42,137,228,115,69,18,246,96,189,55,19,165,129,30,38,234,246,124,174,94,47,244,2,
+    178,163,242,57,74,123,152,233,209,219,211,142,90,108,245,120,83,187,98,193,35,156,241,159,
+    232,230,128,235,67,184,170,18,207,106,237,135,226,103,167,221,213,177,129,222,224,50,146,193,
+    77,0,165,200,223,184,25,219,56,226,234,80,67,153,48,138,228,3,238,60,92,70,66,189,
+    134,103,229,145,208,195,232,114,237,223,61,123,50,91,203,139,57,191,84,229,119,169,148,160,
+    108,73,96,221,82,194,89,118,174,84,176,23,59,59,93,93,126,65,133,18,2,238,87,98,
+    185,31,169,120,116,198,181,14,103,104,13,7,165,251,74,77,186,59,123,218,71,111,143,252,
+    101,34,107,93,70,227,179,217,206,206,249,3,220,245,175,204,143,63,245,71,162,198,43,13,
+    34,186,186,229,129,213,242,245,56,26,80,181,174,80,91,190,207,145,122,1,191,246,187,25,
+    252,251,35,125,95,98,206,19,250,9,189,222,63,216,239,230,240,231,201,163,238,248,126,212,
+    222,255,17,209,244,37,184,254,66,112,126,98,221,47,45,134,237,158,195,143,152,58,104,227,
+    207,132,126,30,240,190,190,202,178,95,121,89,44,242,85,148,222,199,159,170,244,108,39,122,
+    212,173,93,0,121,92,8,96,195,47,246,3,79,116,17,126,117,83,96,97,70,28,211,106,
+    134,0,72,110,140,101,206,6,241,163,163,72,206,92,183,60,59,103,23,56,65,222,12,0,
+    90,42,135,163,37,227,163,159,122,218,242,225,79,19,179,135,209,209,217,254,131,63,207,187,
+    127,242,31,56,218,195,136,71,99,58,12,255,12,186,251,194,186,213,215,59,159,197,67,161,
+    222,239,47,4,13,202,98,171,213,37,224,234,50,58,120,160,176,197,201,157,98,57,141,206,
+    46,49,77,255,57,15,0,121,162,0,185,188,151,197,185,230,196,149,194,216,163,159,50,194,
+    152,209,242,21,39,76,111,163,251,252,34,250,139,16,46,248,113,77,80,228,85,16,138,123,
+    234,175,254,236,46,202,37,121,84,19,253,228,209,242,44,199,129,88,10,178,57,66,238,164,
+    112,187,146,18,204,121,100,183,228,0,199,37,31,173,128,255,18,91,114,65,244,22,234,74,
+    26,227,170,253,206,247,87,225,248,198,93,24,72,22,114,105,236,232,165,129,196,178,150,204,
+    183,37,106,252,214,52,29,86,209,52,153,223,30,8,162,149,244,26,74,90,13,53,173,134,
+    38,173,134,235,137,244,150,196,231,16,217,129,34,178,218,86,84,246,101,45,253,40,24,44,
+    42,65,10,112,9,229,192,37,148,106,210,16,213,157,137,95,173,82,124,190,136,140,221,98,
+    168,108,203,222,101,51,142,174,103,222,212,206,62,2,195,181,224,62,145,239,60,110,212,210,
+    7,233,16,55,51,35,93,133,181,124,138,161,45,163,25,236,38,102,174,2,51,99,118,123,
+    104,121,218,126,58,123,230,36,194,220,118,246,194,125,79,198,62,102,28,120,50,14,32,131,
+    99,143,231,0,105,226,86,83,2,88,164,87,0,44,115,203,0,139,28,4,184,166,33,86,
+    169,46,196,58,195,129,88,103,8,136,19,110,20,3,224,209,95,249,125,255,254,222,83,241,
+    83,155,201,38,30,156,147,61,86,121,100,55,55,190,84,42,172,182,97,33,89,187,22,10,
+    159,6,112,240,148,250,142,161,176,196,70,59,114,89,177,222,108,236,148,154,217,105,4,97,
+    221,232,145,23,42,131,64,229,88,158,214,141,161,232,178,246,216,160,172,20,39,201,64,15,
+    69,197,62,57,204,236,11,129,200,118,24,86,178,191,66,251,212,153,147,161,140,85,159,206,
+    40,28,44,105,117,216,182,87,233,57,62,241,149,18,249,219,89,173,239,77,247,20,151,24,
+    66,158,54,138,170,243,65,222,235,87,103,130,188,23,142,163,165,4,123,241,116,220,93,236,
+    68,7,192,19,184,248,149,131,248,181,60,91,156,63,24,192,207,43,252,9,196,72,31,127,
+    210,199,62,126,140,4,73,7,62,140,73,13,253,189,167,86,130,164,15,66,144,73,33,127,
+    243,136,254,70,189,134,247,97,175,254,113,14,228,4,199,166,108,82,103,243,58,114,169,58,
+    151,113,91,127,11,96,121,10,198,5,231,35,11,8,52,198,227,197,66,62,153,3,119,254,
+    6,136,45,206,73,245,195,92,63,60,120,144,114,98,33,23,102,100,45,103,140,91,25,66,
+    222,191,47,236,223,140,180,192,91,114,142,250,162,230,183,180,40,155,69,51,25,75,210,204,
+    14,58,229,150,81,245,70,112,36,96,61,51,51,26,112,115,16,29,9,51,111,101,183,217,
+    156,33,191,17,108,32,8,208,150,69,152,154,118,19,87,249,120,22,41,43,211,181,182,180,
+    14,173,135,237,61,116,123,144,202,17,204,2,140,193,152,154,60,71,67,31,165,216,113,2,
+    39,251,229,34,123,1,211,37,246,183,166,145,124,100,41,31,53,93,7,115,234,16,119,115,
+    227,36,216,7,253,107,121,240,235,36,171,46,139,76,21,150,150,165,93,210,52,154,128,195,
+    188,80,27,81,74,16,242,108,105,180,23,170,242,29,182,18,119,44,206,141,65,111,221,141,
+    65,77,92,25,52,26,210,81,132,117,85,208,44,31,61,209,199,39,191,64,64,231,245,173,
+    49,155,115,253,184,183,61,126,107,209,22,218,113,183,80,238,75,164,241,45,15,89,62,187,
+    186,238,217,55,0,171,132,76,154,7,198,129,22,14,248,41,209,142,231,32,223,49,143,230,
+    157,250,49,203,255,38,92,10,242,99,125,171,17,14,90,147,108,62,7,120,140,243,122,79,
+    95,48,104,171,183,155,27,253,155,238,24,110,110,26,18,253,13,149,104,223,47,60,243,222,
+    46,248,128,66,76,8,152,128,167,100,117,151,25,25,247,10,29,121,157,208,35,85,172,59,
+    93,26,216,58,53,158,40,97,58,51,170,121,140,3,181,197,189,116,117,61,207,78,49,88,
+    100,147,52,236,167,176,176,187,102,222,207,28,81,67,140,16,41,111,63,134,232,237,72,222,
+    233,232,162,47,39,48,25,88,108,72,63,66,83,247,201,80,245,137,81,245,91,57,134,166,
+    154,234,218,145,25,198,132,118,17,255,2,75,77,66,229,5,249,28,169,144,114,132,229,46,
+    179,248,38,170,110,106,38,162,171,42,70,55,111,50,155,73,26,23,44,124,112,220,78,91,
+    126,41,33,71,123,58,187,185,137,155,153,225,200,62,212,152,246,232,183,94,175,108,253,251,
+    64,187,130,242,94,125,138,251,65,110,7,29,27,17,29,249,229,103,45,62,203,200,194,242,
+    60,82,170,120,177,0,65,79,168,151,42,42,33,225,154,99,189,76,248,151,205,178,45,60,
+    26,72,69,162,1,119,238,41,180,137,222,141,89,46,193,80,151,250,148,200,61,12,234,44,
+    126,51,69,135,42,118,54,16,122,183,3,30,170,7,214,63,143,203,19,138,132,211,140,12,
+    255,230,42,67,38,216,143,54,71,197,165,219,55,36,185,61,243,140,227,101,108,0,186,13,
+    36,244,196,177,17,34,89,208,15,225,241,112,150,140,75,8,226,169,46,156,30,152,184,82,
+    109,88,27,192,73,78,117,7,114,206,130,145,70,165,252,120,197,183,55,187,231,171,49,170,
+    86,151,241,32,210,183,238,253,67,49,13,229,239,163,98,177,40,38,38,146,48,157,141,215,
+    97,167,152,102,249,9,244,152,110,15,122,81,166,41,76,219,30,97,255,97,0,185,0,226,
+    130,200,83,111,3,228,6,202,130,105,159,14,134,18,26,248,201,97,217,26,204,231,5,134,
+    111,27,100,233,172,200,93,96,205,60,255,130,121,153,20,243,138,202,70,150,191,238,219,100,
+    81,81,85,231,248,107,126,128,143,138,170,70,214,109,144,156,2,118,134,99,27,51,239,65,
+    94,114,155,199,180,45,218,133,179,107,54,123,47,27,47,64,44,213,95,124,90,244,124,226,
+    236,221,118,221,126,40,102,203,121,105,232,152,88,6,174,86,61,234,5,176,59,31,245,67,
+    58,62,33,26,41,108,150,120,32,248,103,94,44,188,80,96,198,109,208,47,0,41,247,91,
+    2,13,217,204,23,27,148,87,32,41,149,214,25,37,110,1,194,148,34,98,135,22,239,244,
+    173,39,187,203,119,197,248,202,79,127,58,103,139,206,213,25,27,41,38,21,191,28,154,116,
+    246,10,18,40,74,76,5,19,61,51,143,151,240,198,19,7,23,247,220,237,91,184,15,138,
+    207,100,1,216,199,209,171,144,11,238,24,64,162,232,245,21,219,108,169,123,41,252,58,184,
+    51,139,200,183,102,17,26,203,16,125,3,245,242,86,241,236,110,222,4,216,98,186,233,33,
+    89,54,194,189,150,55,254,182,195,71,179,243,183,198,223,232,28,178,24,230,203,108,53,230,
+    78,42,6,60,22,183,214,209,150,62,42,198,252,230,101,32,124,84,36,103,3,33,108,141,
+    87,218,107,191,45,181,110,39,107,93,107,65,235,117,234,188,200,199,168,16,190,103,184,134,
+    100,58,2,120,166,35,128,163,51,248,152,59,134,36,11,1,83,155,160,214,19,114,152,108,
+    4,221,36,133,220,55,81,175,116,242,37,47,69,125,225,56,77,30,92,116,169,179,1,221,
+    239,158,245,196,216,251,220,173,142,78,80,117,130,149,139,22,45,104,175,115,79,183,7,226,
+    174,150,124,117,136,115,121,47,33,132,93,233,219,45,112,37,93,126,30,113,125,172,74,3,
+    135,4,123,76,229,145,150,91,106,225,42,111,106,71,39,189,210,49,215,173,1,34,0,133,
+    157,16,134,43,27,202,117,157,68,58,90,66,117,110,15,198,79,59,32,94,187,100,129,55,
+    97,74,239,224,154,155,116,48,84,96,232,138,35,55,124,255,158,224,119,207,53,185,40,95,
+    63,212,76,34,234,155,68,212,215,68,52,32,34,10,199,232,201,236,223,15,255,253,48,184,
+    105,158,177,221,63,207,119,58,252,243,89,240,112,200,109,126,128,242,103,227,224,25,253,233,
+    164,230,138,221,161,180,110,166,22,71,210,28,107,74,144,7,34,143,135,27,119,150,132,115,
+    177,178,159,83,229,109,140,121,125,46,155,92,192,58,102,194,201,189,160,88,31,11,67,57,
+    96,136,198,74,19,32,237,4,189,80,79,90,166,195,155,88,58,188,73,171,143,71,220,103,
+    162,66,103,246,180,167,31,78,209,122,65,121,195,193,48,81,252,216,232,92,116,123,153,215,
+    155,162,222,160,194,141,58,106,242,12,123,67,224,98,208,231,223,194,190,229,66,7,143,156,
+    103,162,221,10,31,63,46,87,148,30,126,120,243,97,77,212,14,68,172,28,162,170,166,110,
+    52,232,2,191,203,178,116,254,145,226,57,163,39,79,62,179,81,223,225,147,125,201,39,57,
+    131,20,223,214,45,230,132,77,167,220,210,127,32,127,3,125,168,244,240,109,63,176,202,23,
+    194,171,195,160,108,210,35,51,173,242,220,46,7,203,151,172,138,100,166,85,94,154,48,14,
+    196,47,171,188,176,100,180,218,215,254,51,6,218,127,70,223,240,159,97,20,70,139,31,42,
+    200,77,135,112,156,248,235,108,239,60,188,232,5,225,64,152,4,169,244,54,165,91,77,32,
+    73,146,95,159,129,248,169,210,108,180,14,243,23,195,49,141,4,17,43,191,56,106,229,87,
+    248,213,106,28,223,15,88,223,172,38,191,196,140,244,189,213,250,134,177,18,85,51,108,151,
+    204,60,123,24,227,225,244,119,62,10,252,37,83,128,49,158,245,5,151,24,172,180,45,157,
+    113,159,83,54,218,147,28,34,181,92,92,197,149,46,174,170,200,95,221,4,186,11,94,245,
+    144,89,17,82,248,70,93,138,67,195,2,103,255,226,190,72,153,126,30,200,232,121,64,109,
+    210,169,193,16,208,151,243,237,160,150,219,112,131,20,147,248,14,136,173,24,155,224,22,110,
+    191,54,183,94,115,220,126,173,116,188,14,227,70,231,20,150,72,198,175,107,248,118,52,75,
+    45,151,21,44,25,161,141,115,158,222,191,255,134,59,82,30,206,95,242,24,29,77,51,27,
+    109,125,122,198,55,183,94,180,139,120,60,51,53,94,20,164,10,71,223,4,216,179,30,57,
+    107,194,234,239,208,238,29,211,233,77,38,228,191,209,141,189,248,137,241,235,59,216,194,201,
+    229,116,223,110,133,160,145,237,188,245,181,147,10,27,252,192,57,15,100,51,228,214,104,177,
+    121,12,172,111,198,26,29,142,151,49,163,70,46,160,58,163,18,240,67,194,194,28,103,87,
+    69,178,156,11,8,224,151,76,177,202,252,89,20,19,42,130,63,196,183,221,200,112,60,249,
+    153,45,251,98,40,242,203,204,41,149,151,30,116,106,162,134,242,159,163,63,28,103,48,217,
+    87,106,30,127,56,174,141,175,87,33,47,224,32,232,237,108,49,40,250,192,236,6,195,196,
+    198,208,63,200,23,67,214,67,204,204,232,58,6,125,246,78,67,180,74,167,123,164,74,132,
+    109,68,198,93,0,53,3,166,75,16,79,82,233,117,78,68,4,18,126,24,172,107,20,39,
+    126,188,172,251,124,139,186,239,240,12,106,213,58,242,214,10,201,3,9,197,44,195,159,89,
+    194,156,134,172,144,236,178,173,23,85,109,241,187,204,154,140,179,238,222,94,21,54,72,135,
+    91,128,196,242,254,24,255,78,51,148,221,102,204,15,229,47,168,211,76,215,96,86,7,87,
+    102,7,124,237,31,175,199,219,41,234,8,100,41,42,70,251,85,221,203,18,161,120,44,8,
+    234,105,145,113,135,239,226,172,88,55,26,171,95,129,192,209,8,68,47,188,249,94,148,234,
+    247,144,43,46,51,245,163,204,120,156,0,105,60,234,105,229,137,158,165,60,65,241,236,22,
+    105,19,109,174,201,249,103,193,232,183,125,145,241,246,185,34,128,196,206,25,34,187,229,89,
+    75,214,180,64,9,45,32,66,244,250,132,190,226,220,234,175,138,98,170,154,72,157,38,106,
+    86,27,229,202,242,200,47,27,96,107,97,240,80,247,241,184,88,166,250,142,100,104,180,245,
+    191,241,246,109,157,78,185,233,128,32,201,164,185,166,44,57,193,144,69,47,210,82,236,82,
+    106,97,213,51,253,83,122,220,83,246,42,221,83,66,183,179,225,229,51,126,68,134,95,150,
+    51,12,158,20,132,42,19,245,210,39,211,130,142,212,210,205,44,228,106,159,178,240,193,125,
+    156,5,157,166,229,91,140,151,69,111,27,242,183,213,147,76,12,66,175,187,183,158,250,109,
+    213,82,114,107,104,58,163,209,208,96,69,253,101,85,213,201,86,151,194,101,155,24,133,85,
+    67,140,203,242,229,199,230,228,237,171,224,12,90,127,90,121,142,11,160,36,131,253,213,168,
+    101,165,184,37,72,89,90,150,117,124,142,21,95,91,49,119,243,212,51,191,237,92,123,116,
+    60,157,223,205,153,245,120,138,91,194,87,119,34,189,223,245,156,20,27,87,86,150,175,157,
+    132,182,79,19,6,158,226,123,18,181,10,4,214,41,192,116,234,214,219,224,212,173,55,91,
+    206,23,203,201,241,114,60,206,82,46,89,152,41,110,9,103,218,240,33,137,124,217,139,73,
+    83,223,118,110,149,27,185,158,223,141,156,237,190,44,25,12,199,41,52,22,92,247,141,47,
+    199,29,119,223,188,232,234,161,163,156,102,9,103,253,179,129,240,131,142,81,38,136,37,235,
+    16,137,220,215,60,138,43,23,217,120,46,92,255,51,83,139,230,122,192,35,111,240,135,204,
+    30,90,231,243,134,143,174,222,193,233,40,155,45,174,154,13,100,53,168,206,192,31,172,141,
+    113,143,145,56,0,172,87,216,62,93,184,202,205,85,137,249,61,233,49,231,109,63,186,254,
+    248,235,107,126,126,238,28,236,237,133,248,120,249,94,152,79,21,185,206,105,203,28,242,41,
+    98,230,236,135,181,147,47,75,146,92,96,235,230,118,153,229,250,7,97,185,80,169,169,71,
+    33,189,108,161,87,8,95,27,143,9,134,143,191,250,242,158,232,188,82,179,63,172,224,104,
+    28,93,115,131,59,52,165,163,244,246,201,65,72,94,124,62,20,39,105,63,211,233,123,48,
+    216,215,228,131,35,75,221,58,123,123,251,43,56,211,70,215,111,64,156,204,230,11,126,202,
+    197,244,131,80,36,189,30,162,1,116,41,255,145,157,207,131,98,233,236,199,161,155,242,68,
+    164,84,180,247,131,149,237,86,254,113,213,237,27,22,67,145,29,107,61,67,133,144,183,211,
+    242,93,42,81,114,193,51,220,216,83,85,26,68,90,47,138,172,76,26,13,131,22,197,202,
+    32,141,34,166,191,48,206,160,101,171,244,75,44,189,194,216,206,170,228,189,159,247,194,149,
+    148,96,134,147,172,88,26,145,113,131,107,82,22,129,243,109,230,189,115,221,131,237,180,219,
+    203,120,32,60,124,27,203,155,158,240,123,232,80,183,136,81,169,170,178,136,136,160,134,183,
+    92,71,195,5,176,90,64,73,38,113,87,174,152,4,215,191,144,91,45,40,134,175,96,8,
+    100,82,1,100,208,226,106,79,58,220,111,112,77,106,79,177,191,130,155,168,111,136,43,21,
+    127,172,152,105,84,204,175,71,52,37,5,34,219,215,121,183,102,159,130,6,150,105,218,164,
+    184,200,62,20,62,199,82,201,114,134,118,131,164,147,68,103,108,198,227,177,207,151,49,166,
+    9,133,101,183,168,136,228,110,164,180,120,23,194,53,21,186,148,221,216,95,139,151,18,85,
+    64,248,72,209,75,124,114,140,47,81,78,101,78,212,165,6,220,58,170,232,42,140,179,63,
+    135,217,172,170,45,10,115,86,110,207,170,100,149,133,217,152,18,184,131,217,210,163,169,101,
+    180,161,203,17,105,47,10,122,194,91,255,118,225,190,150,172,209,19,194,135,146,144,139,184,
+    253,184,219,227,239,118,243,168,150,137,95,242,6,169,103,92,31,153,23,108,118,112,58,21,
+    240,38,197,216,82,89,148,96,132,23,124,85,120,154,116,179,200,8,81,22,163,89,197,128,
+    199,224,194,208,38,151,187,253,214,101,56,130,95,87,240,235,10,57,4,197,26,96,241,188,
+    57,10,126,18,87,67,39,239,78,95,190,122,251,134,135,247,248,105,4,252,166,47,155,216,
+    29,83,115,25,234,47,239,142,130,240,30,200,52,87,176,143,95,161,167,188,171,159,160,93,
+    138,97,5,191,233,150,253,138,218,96,173,75,250,186,20,60,232,222,30,55,55,201,162,209,
+    3,204,68,160,130,221,49,254,38,176,136,115,33,23,204,84,133,238,222,79,25,6,89,137,
+    238,97,116,6,25,26,90,117,67,55,154,151,79,1,253,151,232,117,10,126,65,147,55,55,
+    125,59,13,138,4,26,4,117,203,201,103,232,55,12,110,6,167,162,100,244,105,56,207,84,
+    96,123,177,158,36,68,61,91,41,245,140,222,249,238,237,89,1,109,144,97,34,73,72,139,
+    213,158,21,29,5,35,75,239,157,243,0,67,3,73,16,3,73,16,125,135,30,6,129,235,
+    106,234,30,28,88,80,7,26,120,60,63,182,53,3,124,27,102,207,238,141,59,227,238,128,
+    212,154,201,122,16,104,114,138,255,228,24,158,228,44,63,23,38,31,221,41,254,54,34,163,
+    44,72,139,186,167,213,201,103,221,5,82,16,2,186,144,6,119,125,179,63,97,122,151,161,
+    29,81,243,2,187,190,232,92,4,207,154,247,64,92,194,158,238,223,207,119,118,66,234,243,
+    122,222,225,67,12,167,157,47,43,74,107,205,221,193,134,99,94,67,64,22,116,240,7,31,
+    255,245,160,211,199,170,48,226,21,9,128,247,70,24,44,201,68,53,98,249,233,72,225,120,
+    129,65,225,40,236,78,38,222,217,122,209,200,125,20,26,112,107,198,117,69,248,27,253,20,
+    73,253,2,74,93,104,97,245,2,177,51,142,250,103,23,231,221,28,95,97,176,232,23,40,
+    243,69,129,209,253,130,86,150,205,113,107,10,67,254,2,99,33,199,188,40,229,127,65,90,
+    228,67,195,83,198,188,147,1,175,153,119,190,132,131,98,156,117,46,86,65,152,63,107,230,
+    184,172,7,84,145,226,67,193,17,148,155,136,195,49,16,65,151,201,43,253,44,137,106,198,
+    176,64,166,209,0,4,229,133,24,86,166,135,181,120,154,209,180,98,242,32,26,193,204,182,
+    230,161,34,178,144,193,72,23,231,85,10,133,131,22,66,39,189,24,2,39,104,13,108,143,
+    145,142,123,65,107,19,27,206,95,20,249,162,115,15,90,22,142,209,60,172,21,31,20,244,
+    19,2,198,188,70,7,109,168,8,43,232,57,141,98,25,251,145,43,23,211,162,229,214,231,
+    40,125,8,67,113,16,152,210,135,192,31,65,190,43,198,75,108,93,60,209,54,181,23,204,
+    163,226,178,117,245,154,93,238,186,73,195,124,39,110,161,229,252,140,239,5,195,100,68,113,
+    22,30,164,93,102,174,24,110,62,180,199,195,226,61,205,36,182,198,146,239,142,162,236,140,
+    135,225,107,252,59,167,103,255,81,64,117,118,163,158,142,235,55,141,82,97,204,219,15,23,
+    17,89,200,141,0,242,254,248,106,58,152,159,141,206,111,110,212,71,227,89,227,156,55,61,
+    35,142,49,32,59,151,81,171,80,143,159,95,96,166,63,39,44,25,100,233,219,229,2,193,
+    7,98,112,147,160,76,33,17,85,111,4,1,18,118,120,25,125,81,132,253,244,178,27,136,
+    231,133,47,103,64,230,231,242,121,97,194,159,22,174,34,158,252,96,186,147,11,235,88,149,
+    176,232,206,164,48,113,21,126,181,111,126,198,141,142,85,213,169,38,4,138,82,181,47,188,
+    215,63,221,94,15,205,234,152,112,236,150,56,177,59,40,9,28,199,225,73,248,103,120,104,
+    119,23,55,58,102,87,161,217,77,104,118,17,154,205,135,230,200,66,115,100,97,109,230,136,
+    38,216,45,140,146,186,94,77,163,107,254,110,250,91,103,212,26,176,7,211,16,5,196,206,
+    76,108,111,83,201,175,251,59,209,84,188,176,254,214,21,188,99,74,194,36,236,132,177,90,
+    233,37,101,20,254,58,166,141,36,176,98,11,206,94,227,171,102,18,162,118,65,75,10,57,
+    77,237,255,53,41,175,230,126,239,182,222,18,188,254,12,72,51,2,247,210,166,18,134,49,
+    209,227,163,24,109,23,184,156,99,249,40,22,246,11,99,237,119,192,188,89,70,30,35,159,
+    209,16,82,180,29,106,253,49,87,183,201,67,244,159,130,246,70,105,54,133,147,51,19,22,
+    72,153,89,152,162,160,73,83,129,208,238,222,176,216,120,242,56,84,241,62,247,129,219,50,
+    237,164,128,14,35,181,152,68,200,42,127,202,70,116,190,33,141,235,118,39,6,190,251,190,
+    79,195,49,156,68,97,83,62,134,129,91,30,64,12,70,250,30,239,134,222,243,71,188,230,
+    215,97,142,87,79,135,203,116,88,136,74,55,55,34,241,107,22,143,134,11,51,75,147,196,
+    251,148,31,125,220,126,0,72,104,154,149,188,107,252,177,189,119,13,47,161,80,32,159,247,
+    217,124,10,179,76,113,54,155,13,114,243,28,147,62,91,3,11,120,136,6,200,65,35,163,
+    41,29,153,208,136,240,122,170,228,6,155,31,233,18,111,176,175,129,69,241,203,169,55,46,
+    178,62,101,160,43,135,80,168,117,190,6,185,152,254,150,220,187,78,184,40,44,14,242,192,
+    220,225,215,132,191,40,222,220,36,226,227,226,230,38,165,159,252,109,242,1,97,134,255,190,
+    185,201,40,7,239,38,120,16,233,9,62,192,129,144,75,63,241,173,237,230,102,32,239,9,
+    178,171,236,52,155,162,15,21,50,32,138,101,87,176,161,82,63,221,212,219,9,8,68,188,
+    135,110,143,55,223,237,139,182,197,86,53,65,204,252,33,47,140,232,34,61,25,23,57,154,
+    117,13,204,158,31,238,119,249,30,55,120,144,61,140,65,190,204,30,208,65,99,193,242,230,
+    105,235,249,201,207,251,239,15,159,63,72,30,180,30,7,15,251,221,81,43,27,147,15,255,
+    249,89,123,255,60,218,133,189,212,78,25,8,49,116,119,246,32,221,153,114,7,213,17,255,
+    157,235,146,123,231,209,62,116,215,92,238,130,96,106,164,255,120,30,53,151,59,95,2,145,
+    195,207,126,116,3,251,202,51,28,244,45,144,7,93,222,217,238,180,75,29,237,86,119,84,
+    219,170,167,247,149,61,173,44,120,248,235,196,167,98,54,78,121,129,137,153,20,180,38,194,
+    233,48,28,215,236,230,183,174,56,150,110,132,146,180,28,16,87,132,192,61,52,34,224,90,
+    229,90,198,221,87,148,164,221,81,182,101,80,93,179,197,208,186,65,27,101,33,197,14,156,
+    46,23,85,113,232,251,108,152,175,194,89,134,242,133,184,151,51,74,10,231,199,84,178,39,
+    181,104,84,61,188,177,133,238,114,188,75,54,138,136,16,194,252,163,84,38,225,124,4,184,
+    200,124,33,252,231,138,10,212,228,230,178,53,163,117,178,200,227,142,191,203,192,155,195,228,
+    197,137,219,186,5,153,111,152,207,254,3,163,132,147,70,101,155,190,242,93,115,160,226,18,
+    170,140,35,1,141,89,120,51,18,9,99,175,25,108,200,179,95,65,152,159,100,235,200,131,
+    255,67,17,161,9,129,254,122,114,99,117,106,160,89,31,103,243,175,245,146,41,123,14,231,
+    230,213,92,253,243,15,38,92,122,79,133,71,239,105,217,161,119,112,109,80,125,171,212,65,
+    11,67,12,208,240,195,26,44,51,97,66,39,49,49,30,194,0,224,188,36,206,47,148,183,
+    156,118,197,94,169,27,209,239,152,252,24,197,149,150,155,123,225,94,184,219,14,184,192,247,
+    191,234,133,144,95,123,202,39,202,223,158,53,141,15,172,71,193,173,15,233,42,24,111,102,
+    66,11,36,113,95,134,153,65,168,43,254,94,174,120,181,85,197,127,149,43,254,185,182,34,
+    72,186,32,243,165,37,72,211,13,144,138,122,191,151,235,93,109,83,239,95,229,122,235,225,
+    92,78,75,32,246,214,130,88,195,58,191,151,235,92,109,232,230,95,229,42,107,32,11,58,
+    77,18,174,222,9,252,211,12,227,100,1,222,177,61,124,200,152,161,178,13,183,53,71,172,
+    34,134,112,180,8,62,130,3,237,7,114,255,248,35,249,102,222,255,71,130,107,28,142,167,
+    27,153,63,192,246,6,4,186,211,98,57,75,60,11,122,192,230,239,198,32,35,178,100,132,
+    50,224,172,24,227,53,16,191,194,163,42,31,200,125,53,67,121,16,219,105,152,121,146,111,
+    73,142,228,196,59,133,174,185,45,69,185,91,46,147,202,250,102,79,66,90,229,25,108,185,
+    40,166,0,222,253,251,92,172,135,159,110,39,53,76,52,81,32,239,21,169,198,144,70,135,
+    177,183,124,103,31,146,114,59,117,250,131,7,29,54,6,188,167,87,245,41,175,131,154,51,
+    242,198,148,130,70,85,96,108,93,219,88,69,116,128,174,40,243,130,26,199,202,24,105,26,
+    107,203,94,4,175,180,137,144,232,128,35,145,207,96,19,181,1,4,246,12,76,66,226,184,
+    40,166,60,9,127,65,2,250,12,76,51,97,137,92,112,155,191,86,12,231,22,98,157,216,
+    142,4,229,61,116,226,46,8,133,112,89,128,47,15,10,196,66,139,162,107,127,71,85,171,
+    7,181,23,232,177,204,46,207,155,147,10,208,246,100,225,221,160,77,102,38,93,43,106,91,
+    225,236,179,165,237,137,238,47,153,171,186,188,12,47,209,153,148,160,56,228,48,92,244,175,
+    104,142,117,39,106,86,97,106,215,193,240,131,138,57,48,240,212,230,109,195,90,131,142,254,
+    91,104,168,175,31,113,180,87,6,91,64,45,166,210,1,124,239,169,33,238,204,245,5,181,
+    209,139,71,72,194,211,5,28,42,116,64,229,118,24,71,158,134,186,236,105,172,163,42,203,
+    186,108,183,125,238,111,149,157,91,226,215,252,204,211,102,169,178,98,206,205,64,4,237,174,
+    132,222,44,106,179,54,45,70,222,30,65,126,177,150,227,232,91,80,84,213,238,182,88,114,
+    235,175,71,212,186,210,206,54,160,14,9,243,245,167,132,185,113,76,176,245,14,216,205,77,
+    19,175,171,131,174,103,93,139,35,131,1,144,117,68,152,71,44,180,153,147,56,15,168,108,
+    27,220,141,71,26,61,156,102,128,111,56,21,103,27,107,1,234,42,236,25,76,72,7,134,
+    194,239,200,12,14,226,58,188,253,139,153,132,201,204,0,101,94,6,106,18,192,237,118,168,
+    90,181,208,167,208,238,71,134,141,73,179,81,12,207,68,91,167,89,184,196,207,168,105,84,
+    76,45,55,185,14,195,207,154,223,138,226,16,182,128,142,218,245,105,186,109,48,254,43,211,
+    76,178,72,197,244,90,251,163,45,180,24,211,116,203,131,107,109,94,174,82,121,102,117,239,
+    133,39,219,222,197,152,130,187,35,144,79,178,205,2,249,148,161,49,61,13,239,125,214,123,
+    46,20,226,214,151,198,120,144,178,36,205,174,183,166,190,247,118,235,224,9,29,251,43,198,
+    99,216,141,121,248,134,77,61,154,101,121,159,254,218,110,175,102,41,209,175,4,227,53,28,
+    29,198,27,250,77,205,178,212,111,69,109,167,95,171,30,121,14,162,235,143,203,45,17,60,
+    209,37,197,5,200,229,70,4,27,117,110,115,5,82,186,233,136,183,191,233,136,73,13,24,
+    88,60,122,35,163,18,234,52,234,94,109,136,157,88,192,90,117,110,245,250,235,202,173,55,
+    8,220,132,102,220,221,217,21,62,6,148,88,32,203,217,248,106,14,157,64,201,163,171,69,
+    102,149,110,170,71,103,107,175,166,20,154,163,195,139,108,198,250,186,146,217,188,150,81,246,
+    164,140,226,66,211,12,132,165,117,108,90,90,179,157,168,134,129,253,148,79,243,135,50,187,
+    252,94,81,88,163,101,73,178,156,44,199,246,38,233,56,157,226,167,173,80,28,170,136,159,
+    160,118,51,6,160,124,144,238,164,166,75,39,209,24,198,16,34,171,20,173,155,163,61,76,
+    139,152,151,89,144,156,177,157,236,60,74,208,216,54,139,98,46,9,101,59,145,112,195,246,
+    121,50,20,126,126,222,103,125,210,228,11,89,8,136,121,152,133,169,210,77,179,187,139,128,
+    154,233,14,203,227,179,201,6,62,76,236,147,36,12,37,222,137,77,31,89,110,219,161,24,
+    34,30,38,129,167,87,0,176,215,109,255,148,138,237,220,59,128,131,7,113,216,222,77,145,
+    180,81,75,65,78,121,47,194,238,241,57,167,7,184,73,81,45,42,57,75,207,209,227,230,
+    89,186,19,159,7,215,90,20,192,118,196,99,52,158,6,231,236,34,227,90,134,108,124,186,
+    240,189,62,89,211,232,193,4,192,212,53,199,134,84,199,123,34,149,73,237,82,138,67,152,
+    16,132,104,18,137,154,106,59,233,255,19,159,87,97,3,239,225,225,112,52,171,6,208,234,
+    87,141,208,4,248,224,129,13,48,200,119,159,231,217,184,108,101,138,15,108,180,241,183,30,
+    63,141,82,233,193,147,64,206,4,200,241,142,4,250,28,91,25,103,179,169,231,189,241,15,
+    96,58,152,245,2,6,67,169,252,63,254,70,251,217,91,41,52,220,52,244,34,156,96,82,
+    47,23,93,247,165,157,126,188,211,239,178,179,1,194,48,56,127,208,219,65,80,250,231,15,
+    210,85,121,157,254,209,115,184,18,97,198,214,3,54,208,39,20,173,4,89,127,22,24,21,
+    71,146,207,11,114,215,72,54,53,173,252,152,171,121,80,111,243,207,231,86,96,222,196,156,
+    251,152,139,210,165,142,45,245,66,187,63,201,37,214,245,136,58,136,202,206,86,77,14,146,
+    187,38,0,222,57,182,234,103,144,78,175,241,22,189,38,134,214,131,160,226,56,32,213,6,
+    142,63,216,210,242,191,168,67,222,81,211,243,154,252,133,133,215,20,251,2,54,175,172,243,
+    71,79,4,40,117,213,191,181,190,52,106,136,13,231,202,67,7,111,141,224,33,163,181,47,
+    172,165,154,19,119,254,29,158,46,190,96,134,89,14,27,229,159,25,222,116,98,152,199,50,
+    251,120,120,246,239,179,127,159,255,187,213,249,247,195,243,135,125,223,134,46,213,187,208,88,
+    31,67,172,55,31,254,123,254,176,31,54,62,55,2,149,196,194,70,131,54,96,225,74,98,
+    6,2,181,191,191,198,217,255,53,118,26,255,134,78,161,87,236,246,223,15,27,170,25,72,
+    111,53,176,169,157,198,121,3,230,225,97,179,249,172,243,233,120,231,236,223,15,59,231,193,
+    131,224,161,20,179,85,133,79,199,80,254,236,255,172,246,206,27,24,64,249,97,243,211,241,
+    219,231,59,193,51,95,165,183,207,201,198,156,83,249,67,232,228,223,45,40,190,19,224,175,
+    179,102,107,39,248,247,121,240,204,95,213,219,31,44,141,135,190,38,182,111,160,198,149,32,
+    96,55,57,185,156,54,27,128,164,120,135,237,0,51,219,105,252,15,100,247,162,179,134,54,
+    5,87,63,231,240,155,140,25,27,231,165,169,83,187,35,198,26,201,18,97,7,112,47,14,
+    22,131,89,241,181,206,21,218,27,210,246,229,136,83,63,185,210,68,227,75,238,224,115,161,
+    38,18,253,106,162,54,235,117,46,73,41,62,219,63,15,185,161,140,248,62,144,223,228,194,
+    20,18,30,157,135,83,209,190,40,242,88,167,200,66,79,206,87,93,169,205,44,27,191,127,
+    95,255,182,157,162,182,26,182,57,3,240,181,93,12,65,155,72,151,52,70,69,173,169,147,
+    236,180,131,46,149,235,241,136,229,208,20,153,184,235,210,254,138,123,176,140,194,184,165,135,
+    9,155,15,106,159,226,27,44,42,40,182,204,241,113,199,181,118,154,188,204,90,143,244,132,
+    229,117,141,117,179,126,29,149,67,237,121,48,28,1,196,180,230,122,208,12,174,112,135,143,
+    211,108,223,220,144,51,90,252,59,43,138,133,252,221,18,63,118,219,194,67,102,36,45,43,
+    229,111,114,105,162,188,186,144,142,245,124,132,161,140,138,92,74,144,58,133,228,101,116,241,
+    71,48,227,219,162,53,71,74,77,119,69,237,104,147,48,62,101,62,199,67,85,62,135,184,
+    6,61,69,17,224,246,159,4,62,119,177,201,127,131,36,154,66,166,234,164,34,20,54,13,
+    137,76,135,117,73,57,92,59,102,118,153,143,155,187,247,103,185,169,126,94,230,236,130,13,
+    199,44,30,59,49,175,63,207,55,22,17,148,128,79,70,157,107,110,177,222,217,11,79,242,
+    5,252,228,241,199,219,97,141,126,156,112,21,147,206,126,248,11,35,87,206,31,10,94,224,
+    96,21,254,154,205,230,208,34,146,212,245,27,152,14,140,106,173,253,196,64,19,198,81,204,
+    204,216,95,133,63,103,11,96,41,71,87,38,32,103,54,61,225,246,198,183,70,92,40,92,
+    250,48,73,21,196,174,181,130,4,169,226,94,100,169,164,126,225,151,195,35,47,160,48,183,
+    131,167,135,180,212,166,6,194,109,206,6,136,24,70,169,182,183,98,107,81,8,27,79,20,
+    76,206,195,211,50,42,14,243,212,192,237,217,153,167,85,46,45,112,74,241,224,134,220,56,
+    121,193,217,84,177,70,94,196,74,69,29,15,64,119,106,186,162,229,137,151,74,176,147,243,
+    240,236,59,77,113,194,143,24,56,207,223,141,108,140,54,111,141,175,255,80,167,183,64,229,
+    214,68,205,41,98,43,210,246,86,191,59,61,125,75,243,223,138,9,211,22,155,14,16,183,
+    175,243,125,6,189,185,209,53,67,61,15,251,254,67,151,121,216,147,183,67,155,206,106,53,
+    95,189,13,199,44,227,196,131,92,92,30,118,72,240,72,81,249,56,68,57,76,203,59,97,
+    234,8,52,97,102,36,208,148,119,241,161,73,181,24,177,232,11,58,168,225,34,9,79,71,
+    201,227,13,245,166,100,172,224,230,198,202,114,70,45,142,96,190,189,213,30,166,40,232,219,
+    97,105,135,39,49,72,185,196,151,35,227,112,11,11,135,68,25,55,40,169,186,131,178,147,
+    225,191,194,31,225,206,39,59,147,24,135,72,199,192,156,178,126,157,158,26,210,76,251,54,
+    25,176,139,172,206,84,1,56,245,112,29,6,225,62,223,238,222,136,111,247,141,128,232,150,
+    36,72,42,165,18,54,40,74,6,4,13,254,28,165,96,100,145,15,66,219,144,130,142,38,
+    2,153,90,122,188,219,24,168,177,74,76,42,73,212,193,36,51,165,84,30,71,135,162,150,
+    148,197,75,164,22,16,45,165,84,217,131,61,33,18,190,94,86,182,135,18,43,110,5,58,
+    190,188,227,136,244,42,195,24,58,52,44,21,174,211,51,14,232,105,101,91,114,95,219,144,
+    244,182,134,228,195,236,138,66,174,20,14,44,180,46,16,24,131,1,212,227,37,89,77,152,
+    160,17,37,104,47,109,4,93,239,124,181,18,222,212,76,176,122,193,109,65,226,175,6,234,
+    20,132,62,22,249,1,8,15,63,154,131,96,228,9,60,30,115,248,22,245,175,108,142,65,
+    32,122,104,201,197,125,70,146,22,146,96,112,90,124,107,161,100,108,249,147,209,60,250,89,
+    211,83,92,103,135,37,94,31,177,160,83,242,60,227,114,126,178,98,115,155,245,139,226,222,
+    30,100,20,8,67,32,109,241,51,130,117,204,226,23,164,13,35,134,203,75,21,186,139,226,
+    118,242,35,161,225,208,231,174,220,196,215,67,61,206,18,212,93,242,47,79,217,101,137,139,
+    208,129,80,229,14,29,47,217,46,196,60,64,205,225,2,80,7,179,158,205,255,27,35,112,
+    64,112,23,170,230,46,106,75,172,4,95,251,13,114,248,208,230,26,6,167,130,121,207,20,
+    167,226,6,213,62,172,201,232,87,255,45,148,201,32,91,46,5,108,70,152,19,158,171,2,
+    73,50,66,86,21,98,86,158,85,100,158,168,187,94,105,47,234,117,203,66,110,148,241,7,
+    45,205,138,181,80,120,255,190,145,42,78,150,207,154,158,190,237,227,123,88,209,123,208,177,
+    157,91,246,2,111,99,198,77,65,117,75,165,19,96,148,250,164,46,207,85,0,94,185,120,
+    196,174,77,39,101,168,134,39,21,225,142,250,110,219,0,81,150,181,5,212,180,203,147,10,
+    230,239,189,239,215,18,42,15,140,180,94,220,36,131,224,77,162,38,21,186,205,5,17,85,
+    232,152,249,10,132,176,212,176,93,78,230,150,122,27,245,108,35,107,223,123,1,26,93,179,
+    116,237,243,7,223,241,241,245,67,74,69,242,29,213,125,251,144,207,64,194,49,254,209,213,
+    199,143,47,159,203,39,212,207,56,47,42,82,246,103,125,174,64,167,76,206,67,11,6,235,
+    19,93,141,132,145,107,56,129,115,246,52,130,165,188,36,67,42,185,230,39,104,50,63,133,
+    3,247,132,139,242,185,46,114,54,57,15,23,81,78,55,128,225,44,74,209,87,129,41,128,
+    204,130,235,89,4,199,243,46,230,68,51,105,57,139,22,43,134,255,237,47,209,160,187,128,
+    78,190,64,31,139,160,143,102,241,42,212,227,23,214,204,195,140,204,226,225,31,169,215,7,
+    125,204,158,194,217,97,4,50,207,236,92,184,66,216,221,77,186,95,32,225,226,28,186,251,
+    34,28,233,66,159,80,2,154,38,8,46,186,152,29,229,170,123,187,235,107,30,190,24,33,
+    8,175,162,75,108,26,255,129,95,23,134,155,90,116,116,193,195,140,186,192,117,177,96,116,
+    37,22,29,118,12,77,143,180,211,89,107,249,121,105,165,254,124,136,123,48,224,86,136,129,
+    115,30,168,123,49,200,234,115,20,86,113,190,235,105,182,128,44,52,158,61,30,103,44,167,
+    92,50,50,159,215,97,177,130,112,66,143,91,245,171,98,137,113,183,122,51,198,85,139,150,
+    179,172,254,21,195,72,206,50,52,222,196,181,62,71,151,181,115,92,181,62,114,139,106,137,
+    180,248,218,142,124,189,52,155,120,105,54,117,41,18,56,162,164,72,225,1,193,37,68,180,
+    183,236,195,68,245,148,123,118,69,135,189,115,114,168,66,116,56,137,146,179,209,185,37,158,
+    77,238,223,159,252,20,9,245,139,41,82,100,8,84,124,54,61,239,38,103,185,160,148,9,
+    208,198,4,105,3,107,71,211,46,102,3,117,12,4,165,140,162,172,139,150,157,35,0,96,
+    16,92,231,64,236,131,115,17,250,59,135,138,221,156,106,99,155,248,79,180,128,93,207,139,
+    211,24,25,36,205,214,95,193,18,20,122,123,145,124,15,9,185,235,132,18,122,241,85,125,
+    160,95,213,71,81,77,227,183,127,46,113,155,150,112,139,2,65,138,167,60,144,66,32,51,
+    156,240,149,137,203,145,163,155,97,106,14,9,49,48,11,118,150,227,250,156,218,88,159,226,
+    250,20,73,163,46,86,136,22,200,45,80,255,187,59,21,83,176,0,129,96,138,214,119,0,
+    228,84,186,98,200,0,217,225,151,104,134,205,206,176,169,25,2,136,255,192,162,158,241,22,
+    196,130,196,54,76,48,66,221,231,36,36,48,208,205,46,213,0,62,184,23,218,253,137,174,
+    68,31,80,91,54,238,157,101,88,56,248,146,149,128,236,152,125,174,214,1,82,243,243,82,
+    206,30,221,3,165,228,173,186,52,137,118,132,121,245,182,66,78,180,181,129,154,216,6,250,
+    158,109,96,224,80,215,200,79,82,181,73,196,37,30,25,214,19,149,106,148,139,13,4,13,
+    164,151,158,240,68,18,116,69,116,12,110,213,134,191,38,120,108,26,117,185,166,136,10,13,
+    154,8,13,165,36,152,128,112,34,25,232,0,157,50,209,101,158,24,206,4,215,135,23,119,
+    150,202,81,5,230,18,242,125,238,60,129,93,27,250,71,2,59,153,7,59,61,119,205,244,
+    149,71,158,221,54,224,174,135,62,12,161,121,248,115,14,178,109,15,71,49,64,60,16,149,
+    162,160,6,36,2,69,50,145,146,98,74,138,41,169,164,195,146,4,49,182,36,8,215,254,
+    72,233,59,101,179,214,103,244,2,120,1,124,253,48,81,154,122,174,145,148,99,184,97,85,
+    79,179,77,13,160,224,154,161,45,76,88,163,95,165,166,200,64,38,85,70,93,89,142,87,
+    125,169,178,176,89,160,233,142,248,253,25,117,112,143,65,148,90,68,187,162,248,103,109,223,
+    67,82,160,165,111,14,144,191,160,45,169,25,208,199,39,54,155,210,215,42,28,206,223,47,
+    41,234,113,149,242,165,128,227,254,253,123,6,148,60,52,161,130,235,148,59,98,21,111,199,
+    14,60,134,98,25,98,10,228,56,114,90,110,226,9,193,56,197,69,178,28,219,234,219,38,
+    32,235,27,160,238,14,23,101,69,80,3,49,172,100,245,230,104,96,171,251,106,174,22,45,
+    15,78,211,108,49,228,78,14,227,82,11,39,32,81,36,90,123,172,220,255,87,174,85,198,
+    186,92,186,255,156,217,21,34,19,201,207,88,103,175,114,230,72,19,179,178,59,7,87,78,
+    47,171,176,199,210,236,101,94,105,146,240,121,46,208,47,122,67,165,197,118,192,171,189,93,
+    46,110,81,175,29,238,161,219,9,116,35,8,105,25,158,4,75,126,144,208,177,58,181,219,
+    148,207,12,28,60,241,190,142,247,214,130,138,146,241,112,218,74,151,51,166,28,29,161,7,
+    58,59,25,159,175,30,166,176,161,125,5,178,110,182,195,244,97,162,158,47,40,41,3,160,
+    98,229,118,78,24,52,73,0,75,78,248,12,183,142,214,40,132,118,47,87,63,82,243,82,
+    241,4,241,153,79,59,6,32,152,77,139,49,131,83,120,77,152,183,51,169,89,95,46,67,
+    75,55,180,168,125,193,70,217,145,54,1,48,10,99,56,136,106,114,252,32,151,165,39,218,
+    171,204,146,20,174,169,69,213,138,140,197,254,108,175,195,74,84,105,176,144,254,250,110,171,
+    40,83,21,229,26,228,98,50,215,129,235,33,137,135,107,33,155,95,229,201,167,161,55,226,
+    45,241,3,250,211,117,145,162,127,175,107,123,192,198,213,203,130,200,174,106,188,97,13,206,
+    172,208,2,22,42,187,8,51,54,83,34,1,18,221,17,34,181,131,42,240,12,98,144,2,
+    137,6,93,48,227,158,162,54,95,181,168,7,141,127,134,93,56,245,208,87,128,130,73,15,
+    95,208,224,108,4,201,82,57,125,78,94,231,225,192,52,29,103,116,114,159,195,102,188,7,
+    219,51,252,105,195,159,29,220,189,225,155,61,236,195,15,72,137,181,254,157,222,74,5,42,
+    171,214,143,15,218,110,105,5,121,199,244,109,139,8,77,18,176,214,250,109,136,202,97,208,
+    241,202,98,72,166,194,162,163,168,230,211,227,2,189,23,67,137,155,155,154,5,50,62,31,
+    174,194,207,174,107,30,165,238,11,108,210,220,57,76,255,84,198,150,215,21,26,93,252,18,
+    61,142,154,108,55,11,30,36,164,225,254,83,204,213,186,164,18,147,95,142,136,31,128,180,
+    13,255,240,76,14,142,162,228,166,190,194,55,178,144,139,51,43,149,111,66,66,81,111,239,
+    41,186,39,82,231,42,53,21,243,174,18,27,237,187,179,185,161,112,142,71,215,184,124,100,
+    69,223,157,173,12,181,173,209,250,39,9,194,12,19,180,157,64,51,197,21,103,152,45,186,
+    128,41,84,123,182,113,46,23,239,117,75,40,23,131,224,108,220,210,100,46,115,127,61,17,
+    106,145,39,26,98,22,144,199,76,192,51,236,99,63,37,158,53,7,235,72,89,100,25,66,
+    65,136,51,152,202,28,37,51,182,3,29,6,205,47,118,196,106,196,254,157,194,24,180,41,
+    248,169,65,107,70,99,142,219,187,106,183,25,250,246,35,87,44,152,134,30,63,179,100,231,
+    189,142,195,204,227,74,60,232,173,206,70,69,213,145,8,219,220,97,210,54,68,197,133,139,
+    173,241,219,114,73,170,13,230,212,145,72,73,238,216,210,254,254,30,54,86,75,3,214,193,
+    21,77,74,139,153,226,110,90,202,23,134,217,120,147,122,194,215,68,243,222,94,136,255,135,
+    153,14,227,159,0,179,49,28,154,228,245,29,172,237,0,39,143,190,233,149,160,46,29,64,
+    160,11,243,79,131,44,127,49,204,135,115,16,221,188,248,211,116,212,53,153,82,58,156,79,
+    209,67,221,201,69,6,156,243,26,79,85,157,70,79,52,212,8,185,35,117,106,33,76,101,
+    108,154,206,222,79,236,217,110,187,211,94,241,219,197,235,52,130,81,239,35,213,118,213,112,
+    247,158,70,236,25,26,218,120,135,169,108,19,13,73,28,88,160,184,246,55,11,123,75,66,
+    11,24,209,9,208,130,120,2,158,247,83,44,181,38,200,97,87,15,208,60,107,198,15,209,
+    181,221,110,148,60,64,231,168,145,242,25,220,147,113,87,220,118,119,179,238,222,79,145,52,
+    55,190,45,94,195,56,170,1,35,124,150,116,246,194,111,71,49,52,212,238,236,2,138,131,
+    14,249,227,5,168,88,4,136,47,163,147,133,247,152,31,119,0,19,252,63,21,198,210,6,
+    237,101,155,1,196,194,54,112,152,242,60,27,163,37,218,138,199,53,0,38,133,160,53,179,
+    251,109,165,143,170,69,49,216,213,118,227,85,57,153,235,152,10,24,215,10,75,198,78,130,
+    175,55,180,111,36,207,154,41,32,29,43,147,27,248,104,255,209,30,140,81,36,65,171,148,
+    0,72,179,75,49,62,121,127,102,179,226,116,12,91,209,225,130,210,159,97,225,14,252,179,
+    135,255,236,91,237,196,165,42,144,234,84,32,27,32,235,184,84,182,144,216,66,252,43,239,
+    45,37,81,175,124,176,248,190,114,30,137,119,177,20,247,24,151,242,18,215,90,119,186,173,
+    181,238,37,171,180,214,157,102,33,221,24,241,195,190,247,170,143,89,82,20,71,0,74,79,
+    161,62,41,210,11,155,115,9,206,60,114,6,234,212,216,34,9,95,251,9,191,159,29,56,
+    87,88,71,87,216,231,97,158,146,58,201,40,26,80,24,14,249,146,129,94,197,71,209,53,
+    156,20,32,57,26,113,147,52,138,10,34,84,44,133,187,236,9,240,127,140,0,50,69,199,
+    132,216,80,30,141,240,162,219,124,234,201,241,78,188,135,119,226,230,221,91,206,93,166,97,
+    190,240,131,75,143,184,208,239,206,78,142,182,197,248,214,145,100,180,140,197,34,102,105,250,
+    50,167,171,170,76,140,186,153,135,253,112,26,24,161,137,115,186,61,44,50,124,238,19,51,
+    148,132,211,16,131,16,148,113,6,48,41,75,56,125,221,23,132,147,22,145,12,190,156,18,
+    118,38,234,61,16,205,225,144,230,202,48,118,55,192,184,66,12,68,57,25,163,225,117,218,
+    114,44,220,22,193,248,185,221,221,10,150,152,125,17,87,178,175,23,220,194,190,68,194,200,
+    138,218,248,129,153,216,148,66,64,179,138,206,2,78,28,137,162,54,250,148,139,152,51,69,
+    32,21,60,44,168,215,102,131,166,113,233,99,184,134,214,40,47,190,230,60,141,123,255,40,
+    97,67,85,192,251,141,85,236,37,225,68,92,231,167,90,76,214,87,195,226,144,64,86,183,
+    100,225,138,193,109,8,245,59,59,90,234,0,46,33,241,78,78,184,74,182,154,232,1,68,
+    151,85,40,68,228,187,247,160,46,250,43,177,175,35,13,120,70,37,66,15,108,49,162,221,
+    93,61,38,116,72,222,242,153,114,74,143,32,234,92,168,135,43,7,38,115,172,193,193,54,
+    188,120,157,77,138,217,213,107,238,202,181,124,29,44,166,27,125,105,243,132,220,28,233,92,
+    93,224,90,100,17,213,174,87,93,155,181,148,26,144,168,80,45,120,153,80,164,26,74,74,
+    124,190,220,230,177,167,204,94,87,159,194,149,227,40,72,191,22,16,119,208,170,179,14,188,
+    154,141,155,198,77,153,28,144,180,224,198,131,111,125,152,127,156,103,86,41,27,27,43,174,
+    197,75,91,123,69,179,50,127,187,118,37,146,86,228,176,200,29,91,85,31,158,162,219,117,
+    231,193,223,106,69,132,98,209,183,237,187,198,230,46,221,154,97,145,195,175,54,216,83,31,
+    229,32,99,115,57,193,90,121,72,76,136,58,120,88,20,135,15,150,168,205,174,149,25,159,
+    53,123,209,181,201,130,58,248,70,198,43,113,18,235,92,175,48,128,229,231,152,90,56,86,
+    67,64,251,1,180,93,233,129,28,21,131,192,96,54,226,45,175,98,123,196,242,145,11,61,
+    38,24,72,81,219,52,62,237,136,103,176,94,203,132,5,223,126,24,160,132,63,159,87,98,
+    197,126,211,146,24,193,87,172,88,123,58,18,114,130,158,146,196,134,165,27,163,33,68,130,
+    241,42,232,225,201,6,149,95,146,88,188,95,93,137,88,40,239,226,179,99,124,46,28,15,
+    212,108,126,79,243,145,25,48,97,136,130,18,230,0,9,101,108,246,187,248,44,134,110,247,
+    53,124,165,66,4,165,124,70,182,49,185,97,95,147,27,133,140,193,32,26,73,148,45,132,
+    51,7,114,9,190,40,102,154,119,134,155,10,149,151,72,229,29,16,156,107,253,70,202,130,
+    250,201,74,131,111,5,169,35,95,200,151,40,47,48,205,148,120,188,222,209,182,160,35,139,
+    20,212,150,111,47,220,157,29,52,44,192,87,100,155,112,106,130,176,24,76,156,153,14,132,
+    70,111,157,0,139,189,9,221,1,158,221,93,31,68,126,120,54,131,83,150,203,214,50,32,
+    191,148,12,50,56,76,80,233,53,88,115,34,188,15,192,125,44,196,114,81,38,158,126,153,
+    3,173,10,230,162,30,202,171,136,108,227,19,55,225,77,124,160,110,128,178,220,144,139,57,
+    33,149,60,211,99,72,197,216,112,17,167,184,118,45,254,210,45,177,252,190,53,20,134,175,
+    222,231,176,142,37,131,17,75,12,95,192,187,172,163,36,163,1,108,68,245,94,32,175,115,
+    68,41,236,81,210,237,173,70,188,134,114,229,154,171,34,221,237,41,247,27,32,114,104,247,
+    72,107,50,221,9,34,255,217,183,234,245,193,35,18,40,239,9,213,155,63,224,43,225,252,
+    71,199,69,7,106,230,94,148,227,148,84,238,94,140,11,182,56,216,231,26,32,251,65,88,
+    243,37,182,195,74,48,222,27,199,158,32,132,173,202,28,111,76,81,47,162,196,8,118,17,
+    174,121,252,168,156,22,223,240,105,134,214,78,145,7,35,198,108,85,77,87,197,124,109,24,
+    122,167,132,182,54,96,3,54,189,53,23,5,177,115,59,144,200,5,222,224,54,241,104,74,
+    128,87,16,69,175,206,158,29,113,83,47,97,247,141,206,107,58,192,131,34,121,145,253,140,
+    87,238,48,139,45,216,135,61,70,241,208,112,231,117,140,25,122,24,21,205,218,132,211,115,
+    127,40,195,94,23,53,203,156,147,161,188,239,225,180,213,227,146,135,105,188,175,204,210,133,
+    112,66,81,225,249,217,43,212,79,227,230,25,52,14,123,213,231,77,116,35,147,26,150,249,
+    97,118,57,68,31,230,253,109,113,13,32,220,5,215,222,3,180,66,188,242,11,161,173,84,
+    158,49,27,171,241,249,205,13,162,160,67,230,238,244,234,120,56,30,187,80,151,213,3,229,
+    134,26,123,55,244,176,210,125,76,153,85,249,143,112,181,138,163,33,122,153,138,201,203,20,
+    195,16,88,66,97,168,235,115,66,5,217,242,152,27,237,217,15,152,165,39,67,144,168,30,
+    184,143,54,90,154,114,101,8,239,144,83,227,13,36,98,48,48,186,31,167,171,60,22,168,
+    205,28,223,219,104,33,255,95,212,86,174,132,18,82,122,140,81,201,81,188,178,224,99,28,
+    197,46,236,186,30,106,186,177,31,99,93,30,170,140,55,24,83,131,168,39,38,98,253,244,
+    202,47,184,107,223,92,249,211,170,80,19,181,223,112,253,146,21,237,224,60,88,183,241,214,
+    99,31,168,184,82,161,163,67,120,157,70,182,156,175,189,222,226,99,71,79,31,116,50,225,
+    68,43,147,33,244,82,116,48,198,59,42,233,150,245,249,155,4,106,153,155,12,121,228,200,
+    29,253,242,65,165,95,117,54,24,89,101,65,172,198,155,182,145,18,73,182,147,244,251,193,
+    74,29,15,24,74,37,2,199,246,108,8,9,95,225,51,246,158,150,232,14,11,37,30,205,
+    82,208,215,146,181,190,153,237,6,170,89,129,174,68,94,247,248,78,139,77,12,187,188,81,
+    108,45,79,173,154,71,132,49,13,24,77,88,200,170,238,155,106,235,78,30,44,80,168,242,
+    178,84,177,76,108,182,203,109,180,75,26,17,165,209,179,181,163,103,1,249,115,122,99,5,
+    64,193,112,55,81,121,245,224,54,242,38,213,151,210,218,195,25,175,242,76,39,116,220,60,
+    188,50,236,126,217,246,65,224,69,229,123,192,151,44,28,206,95,230,220,163,99,106,219,212,
+    161,45,8,198,133,177,72,237,133,21,217,101,122,101,56,106,100,129,140,53,113,169,90,228,
+    28,149,149,211,108,22,67,99,42,51,24,146,240,164,107,91,9,115,192,131,213,112,61,69,
+    192,181,140,135,203,141,78,133,157,208,48,155,55,103,150,147,195,4,123,165,43,171,42,70,
+    134,238,25,91,84,12,47,102,200,85,202,198,226,84,204,163,41,59,115,2,26,146,220,53,
+    206,216,133,68,178,178,212,67,44,83,72,55,143,218,164,238,226,140,61,208,41,184,229,167,
+    217,142,225,105,252,220,163,73,249,251,55,181,184,211,246,181,249,175,111,107,115,223,215,230,
+    167,111,107,179,118,80,106,180,111,163,179,106,218,54,225,148,26,250,253,219,27,2,84,82,
+    83,255,250,14,77,237,243,166,62,125,135,166,14,184,111,237,223,126,47,171,147,70,235,171,
+    118,75,61,237,208,251,101,57,185,244,140,201,123,252,151,71,1,235,14,157,214,214,245,90,
+    78,222,71,67,0,15,48,159,188,142,28,191,51,18,42,192,41,39,31,224,131,176,243,242,
+    235,227,112,87,205,145,225,148,57,108,24,198,233,141,240,218,82,136,7,18,185,39,66,196,
+    243,125,132,219,93,238,236,148,249,150,213,166,143,111,33,187,42,242,143,83,180,201,58,6,
+    214,143,30,177,109,15,85,208,53,247,51,229,60,85,217,230,169,176,81,114,79,103,200,226,
+    241,85,243,196,52,55,115,121,36,247,44,81,159,15,138,229,56,173,199,104,51,140,117,210,
+    58,111,180,17,116,165,7,116,220,110,172,19,12,151,223,30,138,167,23,156,197,142,120,242,
+    161,54,241,218,27,213,101,175,114,54,25,38,101,197,214,148,103,184,186,238,165,125,209,104,
+    17,71,36,230,211,220,183,154,34,77,186,173,21,59,99,162,95,106,57,120,145,164,182,174,
+    13,128,252,85,6,228,112,81,94,194,226,132,34,90,74,30,68,177,252,173,61,185,238,201,
+    19,149,200,73,159,194,127,50,248,129,164,199,20,136,90,124,160,199,212,210,2,114,143,171,
+    118,72,222,189,192,192,53,133,153,50,173,103,190,113,243,87,132,88,158,9,151,68,163,90,
+    201,249,249,124,91,233,105,84,237,252,124,110,137,79,222,197,82,162,20,179,185,74,17,42,
+    155,15,222,25,11,0,37,40,39,201,29,206,98,219,225,124,168,28,205,194,35,12,90,114,
+    74,105,44,31,254,35,67,177,161,159,216,209,100,137,3,102,201,16,57,88,167,237,161,64,
+    174,88,166,168,173,38,156,34,161,201,193,49,69,62,116,202,147,30,198,112,14,0,81,64,
+    75,188,120,163,98,66,19,13,91,42,232,244,81,225,132,60,182,60,144,135,170,146,210,39,
+    227,128,8,7,228,173,199,65,107,153,139,200,142,205,56,64,23,146,110,71,65,43,47,102,
+    19,54,230,138,29,29,1,224,219,217,98,80,244,103,108,58,24,38,107,32,84,61,161,203,
+    202,140,205,118,98,140,202,25,60,20,159,187,252,211,6,162,10,104,25,18,110,49,99,249,
+    28,248,198,228,185,204,118,70,29,116,188,86,195,239,217,85,66,81,245,58,245,143,185,136,
+    171,11,76,155,7,160,164,56,186,100,130,79,26,66,115,104,152,79,124,137,153,37,168,102,
+    120,118,222,37,95,85,250,214,45,105,205,161,189,102,222,51,175,103,157,182,230,101,149,48,
+    217,154,12,14,81,218,151,100,99,158,224,16,106,64,173,82,63,202,4,122,200,93,91,176,
+    92,109,78,97,226,48,93,245,218,38,57,46,142,12,159,58,214,15,174,236,198,221,90,26,
+    164,105,94,82,161,40,198,169,142,82,165,149,209,155,13,229,166,199,184,59,4,193,2,167,
+    25,215,255,179,231,120,235,101,36,32,85,126,149,119,23,217,152,77,231,25,111,89,108,167,
+    51,110,247,70,222,209,188,182,125,104,215,162,171,201,150,48,210,25,87,19,180,91,225,145,
+    69,140,10,190,246,72,37,210,14,140,102,130,198,35,49,112,181,73,247,97,162,166,21,208,
+    21,8,210,40,79,0,17,216,230,42,24,202,43,8,117,53,89,74,42,52,221,25,163,44,
+    106,198,187,230,100,5,15,219,39,7,93,107,250,226,18,222,119,34,229,126,148,149,73,99,
+    106,147,70,86,94,85,98,205,167,195,229,92,26,46,1,107,145,29,45,6,217,130,185,194,
+    251,221,119,106,191,188,36,123,23,63,52,16,12,255,53,1,97,252,175,13,206,132,141,178,
+    83,214,43,83,6,54,65,55,170,19,118,217,108,159,236,62,9,249,215,48,111,210,143,119,
+    47,119,107,148,44,75,123,44,191,144,211,255,154,225,72,14,214,0,206,215,49,204,161,86,
+    149,166,172,103,10,14,99,16,123,157,166,241,197,85,162,97,175,221,23,44,251,207,32,180,
+    161,103,73,49,111,158,114,93,104,12,145,249,208,232,0,248,114,216,14,28,184,203,14,70,
+    238,66,5,28,60,65,7,87,255,21,26,176,39,93,0,2,24,184,211,44,241,187,245,47,
+    51,218,26,31,212,224,159,29,64,246,3,68,120,119,253,124,84,245,92,194,243,69,182,14,
+    207,2,156,9,197,184,157,226,30,163,46,202,120,66,236,39,191,119,197,48,95,204,203,227,
+    66,186,63,153,76,23,87,205,160,82,141,227,105,210,141,165,40,159,93,78,25,62,7,81,
+    123,77,124,210,244,247,119,156,225,166,118,152,167,168,82,234,143,228,114,92,118,252,206,247,
+    84,198,71,146,232,176,209,248,48,194,102,77,16,120,186,246,240,133,208,147,148,177,208,98,
+    105,218,76,28,154,198,104,39,223,153,230,244,76,224,79,121,120,84,128,208,117,101,80,230,
+    53,132,243,18,179,193,198,46,35,245,243,42,122,153,163,129,193,226,74,15,79,102,195,207,
+    171,104,87,229,91,29,12,231,165,230,205,237,135,154,121,170,59,20,239,129,212,164,78,190,
+    226,118,116,52,143,246,43,140,114,254,135,143,156,30,201,230,168,184,220,239,212,91,170,118,
+    51,168,115,231,114,92,158,249,90,199,0,52,32,253,165,32,206,8,82,176,183,93,1,127,
+    51,120,198,164,236,24,116,24,206,40,95,159,243,166,132,50,148,144,251,104,133,6,96,211,
+    223,237,192,231,234,208,119,6,190,102,65,15,116,106,67,207,68,76,94,36,27,124,184,53,
+    22,150,159,204,112,207,49,215,59,238,72,204,161,45,217,12,239,202,223,14,174,24,179,29,
+    92,41,85,237,112,108,250,219,129,122,2,217,187,78,115,34,217,109,20,21,7,216,48,159,
+    151,199,168,244,55,109,186,132,239,159,52,201,226,183,73,160,244,173,243,175,158,221,107,119,
+    80,98,148,221,192,68,86,222,109,82,7,79,35,198,127,96,208,11,190,42,244,234,186,20,
+    55,92,212,149,44,121,37,75,94,25,37,249,74,121,39,109,52,92,111,185,214,53,198,122,
+    130,83,109,172,163,186,216,161,186,152,168,12,55,154,93,61,52,56,164,233,145,152,233,33,
+    238,254,58,225,202,44,104,165,155,135,169,42,84,50,15,47,17,40,117,230,205,101,46,178,
+    156,119,254,80,72,113,105,36,188,5,38,117,3,183,195,163,216,81,133,148,84,230,49,20,
+    77,148,110,52,62,20,14,124,246,198,86,171,14,105,194,212,6,85,213,11,173,79,200,151,
+    242,32,109,91,106,42,42,88,3,178,2,190,1,105,246,128,236,194,179,253,44,115,175,45,
+    191,226,48,110,51,188,233,82,51,116,144,31,187,234,12,38,115,216,204,100,190,44,217,120,
+    94,65,88,208,6,207,87,40,10,228,226,179,210,113,94,64,136,74,211,242,157,149,39,2,
+    184,85,206,220,235,163,52,181,243,134,243,151,147,73,150,14,161,133,247,24,3,122,38,92,
+    163,222,219,235,102,213,125,49,211,94,170,91,203,170,122,203,82,171,21,17,181,46,242,135,
+    188,19,164,58,13,185,186,218,156,149,36,39,169,222,121,214,96,24,157,5,254,75,26,66,
+    71,129,223,37,148,195,226,53,239,237,225,213,64,31,67,155,227,13,17,207,106,154,117,172,
+    112,120,134,50,85,57,91,234,153,40,239,152,172,236,61,84,250,65,16,181,101,81,60,3,
+    247,239,223,239,3,194,149,7,86,165,87,25,245,241,133,97,129,126,142,194,17,124,244,24,
+    254,154,68,125,242,216,55,82,158,250,158,78,187,19,16,81,101,61,52,211,34,15,125,123,
+    33,26,32,97,19,217,37,31,166,242,250,181,120,58,235,46,100,132,143,47,110,41,116,232,
+    39,150,234,224,44,63,67,39,122,231,231,1,215,106,225,152,122,212,132,9,22,60,227,139,
+    149,115,128,162,171,113,237,230,138,38,252,14,0,35,143,201,85,81,235,181,248,251,81,179,
+    31,154,225,5,187,253,157,168,221,53,50,99,200,140,33,51,150,153,202,45,160,64,161,227,
+    202,150,155,27,245,189,211,49,176,211,57,192,128,179,62,97,45,149,175,9,2,77,92,150,
+    73,145,94,126,107,46,130,144,126,253,174,126,253,11,126,149,208,19,242,173,105,160,42,13,
+    84,165,129,170,4,133,190,5,119,97,5,234,66,196,78,88,129,186,80,224,213,241,196,15,
+    140,182,59,78,182,227,35,227,164,98,101,143,19,59,15,173,114,139,185,181,180,229,57,195,
+    240,57,43,74,53,245,235,83,174,221,164,235,220,149,221,246,86,92,195,195,44,184,237,59,
+    26,162,122,248,130,21,248,141,23,146,219,222,51,79,90,167,125,114,128,42,86,15,232,208,
+    11,73,77,163,16,203,251,227,76,189,82,193,144,230,168,226,198,73,41,76,49,24,224,218,
+    120,156,188,17,139,13,197,155,203,243,29,223,19,204,147,32,24,23,197,232,112,209,140,133,
+    24,28,104,61,37,81,102,92,204,158,121,230,128,50,8,114,93,78,216,106,251,10,170,147,
+    163,0,138,151,39,18,155,36,219,110,31,147,42,34,155,36,86,43,229,89,92,79,19,175,
+    197,78,242,186,68,27,182,183,18,242,93,239,242,118,242,14,135,145,71,37,239,104,54,36,
+    79,105,136,29,229,101,142,239,194,70,32,6,123,50,52,123,223,3,174,190,215,29,60,85,
+    62,246,6,146,35,79,162,12,109,106,39,104,185,154,161,125,136,252,133,76,14,192,162,56,
+    90,146,57,208,192,97,103,104,38,225,196,126,66,169,34,175,24,120,128,228,13,35,155,113,
+    84,52,43,122,191,125,235,59,109,187,253,209,78,180,31,172,170,81,104,113,165,26,136,27,
+    219,70,183,77,57,121,229,213,228,85,88,228,149,87,81,87,158,216,121,85,44,204,195,189,
+    100,24,221,18,223,202,55,240,173,170,69,184,205,250,219,110,233,117,139,45,89,123,81,133,
+    151,34,177,243,42,89,187,8,238,117,182,119,94,137,35,179,140,15,95,181,98,27,70,223,
+    122,252,192,24,232,215,97,138,166,123,78,234,128,135,155,85,12,221,220,118,124,114,1,106,
+    223,211,27,59,119,41,192,184,47,129,93,244,41,176,127,142,241,79,207,14,120,234,35,238,
+    104,224,49,79,124,2,101,48,245,7,158,250,35,79,253,187,72,109,239,137,38,218,109,158,
+    209,222,23,77,31,200,140,71,152,145,56,123,114,53,119,166,129,108,67,29,190,130,85,36,
+    50,221,146,68,166,85,36,50,77,236,188,59,146,72,109,43,26,153,222,86,22,120,41,248,
+    254,203,202,3,132,219,175,165,90,107,160,118,139,181,201,67,97,240,221,36,213,131,180,217,
+    30,21,109,40,65,186,52,37,64,16,110,70,127,134,142,202,143,121,182,237,126,42,19,66,
+    107,239,105,191,219,147,59,201,32,130,207,135,251,207,226,78,210,205,36,87,238,129,4,58,
+    67,41,20,254,139,131,85,230,138,130,169,148,19,110,41,159,64,59,125,97,134,143,188,184,
+    183,237,73,177,87,117,80,172,245,210,238,219,109,91,121,91,213,202,219,180,219,223,182,145,
+    126,85,35,125,187,145,111,63,179,126,247,243,105,90,121,62,205,182,56,159,246,188,231,83,
+    18,119,228,33,148,220,174,208,33,212,21,98,224,80,170,12,31,71,79,39,221,145,36,191,
+    105,212,227,110,160,167,226,92,35,207,149,253,179,105,139,157,243,115,12,254,142,141,223,9,
+    252,78,135,23,195,52,19,231,158,3,231,112,5,3,174,137,53,147,127,227,225,83,173,137,
+    129,125,246,28,224,25,201,200,180,206,158,3,58,123,250,14,80,95,182,100,161,95,170,88,
+    232,151,196,206,171,98,161,180,248,222,141,153,255,24,229,22,41,243,79,51,136,218,171,225,
+    154,86,140,34,62,46,252,37,185,227,154,240,157,204,110,123,28,170,221,241,60,148,152,239,
+    17,177,210,176,50,16,38,248,95,226,63,32,53,43,241,235,221,11,194,74,68,122,139,7,
+    157,77,237,251,119,139,77,221,248,107,149,167,89,143,221,205,225,231,215,63,85,80,70,126,
+    61,219,29,108,203,92,7,85,204,117,144,218,121,101,66,146,63,235,24,106,187,6,27,87,
+    56,10,174,83,66,29,255,48,244,176,50,212,4,41,89,61,177,128,27,107,197,149,103,143,
+    144,115,51,245,246,59,120,58,162,35,153,58,205,160,127,159,48,5,78,144,2,39,72,129,
+    19,144,129,14,105,58,11,218,230,49,165,255,215,199,239,99,155,9,75,103,12,83,188,74,
+    127,205,166,93,122,249,254,131,107,133,113,114,54,102,140,107,122,149,74,192,64,65,138,104,
+    132,66,191,12,191,22,252,139,127,228,237,6,234,55,208,255,121,194,126,35,180,190,15,168,
+    128,254,126,132,249,234,179,167,234,139,111,89,93,124,202,218,226,83,84,230,95,75,168,219,
+    250,33,108,183,84,107,75,168,189,235,36,29,32,184,251,242,51,17,29,74,248,19,222,161,
+    254,132,226,181,61,13,64,130,93,238,169,46,147,92,86,151,237,229,162,190,250,166,254,244,
+    248,147,92,52,128,223,241,118,167,82,193,234,95,196,91,82,189,89,208,162,250,23,177,157,
+    183,142,125,254,202,124,145,226,21,113,199,58,220,136,243,36,244,75,54,158,162,222,160,104,
+    189,25,212,7,20,209,175,62,46,242,126,6,205,171,128,16,13,151,217,113,89,0,223,29,
+    4,151,229,163,52,165,16,30,225,156,233,119,95,164,115,122,191,232,74,39,104,248,212,155,
+    110,33,128,160,156,204,79,94,25,158,188,146,214,37,252,64,149,255,22,166,192,129,169,150,
+    180,254,132,95,104,166,66,121,143,100,222,99,252,129,89,79,100,22,30,195,40,235,71,153,
+    245,119,213,226,158,204,107,183,101,38,30,199,68,238,129,108,20,79,100,49,207,125,44,155,
+    109,63,81,185,63,168,220,31,85,238,223,101,203,251,123,50,119,191,45,91,222,223,87,185,
+    7,60,55,117,79,123,54,142,146,98,50,5,12,29,161,188,143,30,0,167,131,108,150,81,
+    52,1,135,248,236,217,137,202,42,220,34,170,29,111,95,146,129,245,24,213,29,110,203,194,
+    135,85,44,124,152,218,121,107,46,229,108,99,214,184,184,236,198,154,128,110,110,154,177,161,
+    61,33,120,36,167,145,32,172,197,74,53,129,203,114,184,35,137,157,143,239,78,101,77,136,
+    112,219,43,36,180,57,236,254,81,141,137,165,133,137,63,170,48,241,71,106,231,109,131,9,
+    254,246,60,165,205,158,218,66,247,137,237,147,221,31,127,82,14,63,227,128,12,1,48,81,
+    6,158,85,215,201,242,206,3,69,219,208,250,144,70,245,98,83,55,186,225,98,114,208,221,
+    30,59,43,90,211,239,210,240,107,214,253,57,222,78,208,253,185,138,249,253,28,219,121,104,
+    59,34,149,162,203,44,176,38,68,200,18,19,76,130,235,214,223,241,127,79,97,97,242,187,
+    145,47,232,190,119,150,155,186,215,184,129,116,118,121,193,159,170,10,182,169,224,30,136,95,
+    252,185,7,120,3,238,21,176,124,173,51,5,200,177,90,169,16,218,18,212,103,55,134,235,
+    241,240,18,67,131,245,199,60,48,48,23,149,220,33,191,34,73,35,42,185,171,177,141,63,
+    90,251,15,88,224,250,238,128,68,53,185,67,235,113,161,29,42,157,205,189,144,237,198,1,
+    110,143,186,160,57,201,77,255,243,68,66,96,24,89,42,108,226,149,228,35,148,108,55,181,
+    42,13,143,238,41,202,28,169,242,82,138,153,125,250,11,172,186,181,209,182,204,106,84,181,
+    68,71,105,247,68,84,137,108,45,11,185,139,142,139,190,220,68,143,151,179,139,76,118,192,
+    183,207,56,203,242,122,154,77,129,94,33,49,109,224,75,78,21,72,39,38,68,172,2,32,
+    214,117,34,212,145,134,133,182,199,100,43,71,81,242,95,86,196,59,222,21,87,115,84,86,
+    199,38,218,125,194,1,141,11,157,98,162,210,136,167,1,115,172,220,70,59,109,213,63,98,
+    232,73,180,52,163,38,116,209,150,165,106,217,172,147,88,59,175,7,245,33,12,50,99,24,
+    34,80,122,85,144,163,155,59,42,17,2,8,213,38,163,112,29,152,116,58,101,73,150,126,
+    243,240,124,205,124,247,65,214,244,40,205,254,182,30,235,55,140,239,63,54,38,173,27,75,
+    166,246,194,235,165,142,229,252,52,165,16,161,226,186,19,195,38,195,142,46,111,141,116,84,
+    191,105,51,131,179,83,6,103,39,56,68,222,220,236,5,42,244,73,92,214,4,126,103,17,
+    120,207,175,197,235,195,139,64,137,174,97,163,3,61,217,82,120,85,103,224,1,14,84,70,
+    159,52,210,25,41,216,204,123,149,235,251,55,235,209,114,177,101,193,203,108,187,114,54,82,
+    46,109,107,248,124,200,55,26,219,74,180,34,222,236,233,20,217,46,96,198,170,230,163,149,
+    6,87,30,21,110,147,56,30,110,217,135,183,122,85,95,179,76,184,120,158,193,6,123,116,
+    117,56,75,248,182,184,125,119,85,45,84,244,184,114,174,156,229,78,53,143,54,245,248,243,
+    108,152,202,19,149,170,229,223,20,194,250,20,102,13,163,52,78,208,21,7,69,107,212,28,
+    223,88,94,43,231,169,187,124,12,244,15,94,196,88,151,224,168,243,157,62,219,209,249,130,
+    98,142,99,164,200,241,152,143,222,161,169,161,101,169,156,93,162,79,234,197,199,217,248,136,
+    205,179,141,139,237,85,193,82,58,93,218,245,252,24,225,76,200,172,248,113,49,28,207,203,
+    117,13,214,35,24,196,81,230,150,226,235,114,157,245,64,82,214,222,94,167,54,41,181,181,
+    189,188,194,80,231,54,160,146,140,94,100,33,19,207,92,221,243,53,93,102,252,196,227,239,
+    81,29,136,104,83,241,234,88,175,66,97,87,62,231,98,179,171,167,186,166,235,82,197,74,
+    48,76,45,216,242,224,237,108,68,192,220,85,57,95,3,197,156,171,152,87,97,156,107,160,
+    123,240,77,25,62,2,248,149,221,141,0,14,254,122,2,56,248,239,17,192,193,127,148,0,
+    236,150,249,181,197,221,160,146,87,30,155,0,147,229,170,97,19,37,110,67,159,7,223,135,
+    62,95,89,231,95,34,147,104,35,83,133,77,237,214,20,89,171,36,73,103,141,156,134,215,
+    51,150,167,197,164,253,100,19,153,190,230,162,148,44,190,142,171,211,137,147,23,244,50,112,
+    43,127,21,162,5,117,54,135,115,192,215,108,246,182,247,225,107,177,113,74,4,44,165,138,
+    85,232,161,232,41,102,49,3,152,211,82,46,35,152,46,239,4,208,229,22,208,36,217,112,
+    92,9,140,147,233,99,108,115,91,26,30,179,197,34,203,69,32,251,183,228,70,197,53,188,
+    168,0,25,31,73,81,58,246,180,176,110,122,91,139,66,138,112,229,185,229,207,68,162,0,
+    158,162,87,161,188,133,243,153,20,174,135,204,169,89,121,150,185,160,124,251,241,183,206,95,
+    249,234,62,32,153,93,84,152,181,57,189,109,39,229,86,2,187,86,202,165,238,63,20,194,
+    161,197,246,8,177,234,85,162,131,143,220,46,172,159,50,234,234,194,221,57,172,154,51,88,
+    81,151,105,216,239,136,37,79,237,106,193,220,166,251,215,30,217,84,190,242,110,137,195,71,
+    90,58,85,239,195,85,171,180,152,94,233,50,46,133,91,185,136,149,77,203,48,222,4,214,
+    127,122,21,210,77,139,139,44,113,165,90,54,211,113,172,3,197,179,61,197,95,89,51,6,
+    163,143,74,226,20,51,95,241,88,191,126,213,90,117,224,188,181,156,240,231,253,240,128,219,
+    6,205,209,169,230,130,226,154,97,185,255,85,215,176,183,32,143,202,54,170,8,5,141,88,
+    171,106,184,83,178,166,44,51,56,144,32,130,45,182,100,1,180,83,177,138,237,220,141,19,
+    63,250,38,78,252,200,63,167,53,31,43,126,228,103,197,143,238,12,232,163,111,7,244,22,
+    112,222,138,25,62,186,229,150,49,67,178,201,240,29,225,22,216,208,149,54,174,71,143,59,
+    26,47,62,152,175,164,52,12,199,80,196,30,131,219,245,64,26,181,254,211,116,229,49,213,
+    219,56,73,170,206,250,153,249,237,22,77,138,26,235,27,252,253,214,13,254,190,190,193,127,
+    221,186,193,127,173,111,240,232,202,38,199,45,91,229,213,190,167,104,244,232,255,247,162,209,
+    163,91,137,70,228,56,225,197,108,57,95,44,39,30,63,139,97,111,35,151,212,245,43,81,
+    69,133,12,7,94,205,250,56,235,45,194,250,140,148,232,97,235,155,134,245,184,88,44,138,
+    73,88,199,147,88,88,239,129,44,81,41,141,184,173,33,180,41,192,139,208,162,172,247,130,
+    217,38,167,198,217,31,207,192,27,15,202,164,28,87,186,54,192,170,155,47,13,120,169,234,
+    43,3,202,167,231,198,63,76,40,29,246,189,17,68,67,30,217,126,71,21,230,218,38,3,
+    52,164,134,186,126,106,94,183,109,25,53,56,39,116,93,218,196,30,15,149,183,184,72,122,
+    15,132,254,215,221,35,241,169,190,11,76,84,115,51,84,162,88,53,92,188,0,66,86,187,
+    211,21,151,15,182,255,196,13,87,233,12,117,104,221,29,176,89,198,54,9,153,31,102,67,
+    178,93,68,6,5,197,215,220,64,29,82,182,231,10,140,103,172,194,152,205,174,146,162,152,
+    165,234,73,109,139,19,146,209,127,185,254,26,104,142,100,97,47,72,58,87,220,81,12,211,
+    105,201,23,199,6,112,100,157,53,64,188,86,69,124,215,114,42,151,110,156,72,171,228,54,
+    253,243,26,107,122,127,35,10,120,198,47,178,176,227,233,86,171,201,232,119,186,110,17,225,
+    17,208,191,122,84,142,159,46,195,235,13,228,33,125,8,255,231,137,4,22,137,75,34,162,
+    115,207,52,73,87,203,223,115,178,106,22,32,114,174,68,79,101,228,245,99,207,205,200,225,
+    120,188,229,35,249,233,128,77,51,125,49,162,42,86,75,6,234,10,69,20,171,216,242,237,
+    98,244,32,2,41,203,52,187,21,72,80,190,18,146,19,158,111,40,59,148,65,193,155,139,
+    94,172,244,214,72,118,218,90,177,66,2,98,86,170,132,134,10,111,132,229,66,195,82,154,
+    201,99,99,34,107,164,232,160,93,197,150,28,120,122,192,229,194,196,190,80,121,208,194,105,
+    213,189,56,20,114,229,216,210,186,245,21,226,32,152,94,96,94,179,124,0,210,51,219,124,
+    213,162,97,244,212,174,190,100,17,5,158,171,58,190,219,149,114,33,156,113,174,154,226,129,
+    112,19,128,78,197,141,192,73,69,131,74,192,94,41,83,137,146,107,73,107,230,49,156,248,
+    114,156,205,144,135,201,251,34,46,189,111,60,79,200,187,29,186,201,170,104,164,122,61,97,
+    121,121,205,86,170,99,168,41,132,102,227,190,123,182,91,65,87,117,201,86,5,153,85,222,
+    132,202,184,128,212,23,133,91,82,228,129,125,129,169,235,111,208,25,114,110,48,75,147,239,
+    47,198,132,83,54,84,179,188,43,168,78,229,173,224,164,58,30,113,196,83,136,73,213,31,
+    188,103,245,194,88,37,179,89,80,186,245,183,2,83,92,238,174,71,166,40,20,135,234,236,
+    253,78,217,196,220,2,147,78,205,234,109,207,185,125,170,62,235,90,5,233,117,224,142,156,
+    252,224,47,224,228,181,111,101,229,7,255,95,103,229,7,127,45,43,207,74,218,138,119,153,
+    250,71,127,221,212,223,9,169,143,254,90,164,190,177,195,14,145,57,204,7,16,174,51,75,
+    194,173,210,212,147,226,94,189,229,84,173,186,96,19,197,240,226,71,82,224,93,186,177,234,
+    87,50,22,173,233,81,85,207,216,227,202,71,39,19,51,200,111,209,103,1,15,83,184,113,
+    1,243,150,14,158,11,78,173,107,174,57,168,240,58,178,152,239,92,107,149,96,164,212,137,
+    110,227,158,103,83,191,30,103,5,68,70,173,42,142,204,139,188,157,193,63,161,37,8,248,
+    124,242,85,237,86,70,151,107,239,250,197,179,171,44,242,54,167,107,236,58,131,127,195,186,
+    100,128,213,155,130,91,145,111,91,24,119,8,141,107,164,176,181,145,200,236,41,179,234,110,
+    32,48,89,83,213,51,239,17,133,115,200,10,82,43,133,1,59,180,196,213,12,133,51,154,
+    133,82,112,175,13,8,215,53,229,69,39,127,36,64,243,146,2,147,93,44,218,185,110,176,
+    148,239,211,159,167,163,136,97,164,192,121,102,136,186,183,28,169,85,217,51,79,31,6,89,
+    125,60,140,103,108,118,69,112,65,249,185,113,187,11,197,175,234,48,13,108,57,94,72,1,
+    252,191,215,251,218,16,113,71,150,18,177,136,224,176,21,186,94,189,69,88,101,204,7,47,
+    3,26,103,23,217,120,238,82,5,79,93,85,135,117,58,182,194,58,193,232,126,37,31,135,
+    31,178,75,104,4,99,59,109,1,157,84,178,238,212,221,250,254,61,100,254,221,155,172,28,
+    222,137,57,186,207,159,153,212,121,127,62,188,160,152,46,243,237,70,72,102,36,48,3,190,
+    22,212,122,41,103,149,159,200,74,69,182,91,168,223,208,127,69,191,17,69,113,24,179,146,
+    165,221,60,218,188,49,148,162,215,200,186,8,75,73,31,7,143,38,5,28,156,56,4,117,
+    150,167,32,155,13,199,147,159,217,178,159,213,123,197,172,206,234,211,1,64,33,194,205,160,
+    205,192,114,106,89,90,199,50,66,166,170,23,197,134,33,138,110,221,84,229,44,173,191,196,
+    146,63,139,124,124,117,58,96,105,241,181,115,189,5,69,190,194,215,61,92,132,170,154,159,
+    18,195,57,101,114,188,188,40,46,58,215,219,76,176,108,221,169,172,230,150,167,75,15,7,
+    189,226,66,71,33,43,101,17,75,54,27,122,149,245,22,119,7,3,107,87,192,129,239,158,
+    218,34,168,148,85,2,228,61,53,127,103,72,168,122,5,40,244,248,90,1,11,229,149,128,
+    249,80,76,239,14,10,84,174,0,100,81,76,43,192,128,156,18,16,71,244,78,124,119,56,
+    120,253,10,80,248,35,116,21,165,240,220,18,68,111,50,54,187,59,60,88,187,2,26,124,
+    10,175,192,12,102,149,0,121,241,45,112,188,168,4,163,87,9,69,207,3,196,175,192,45,
+    227,113,118,43,14,225,169,191,209,212,144,151,230,86,74,205,58,119,61,99,65,231,8,160,
+    2,200,163,33,155,223,5,73,88,207,197,79,12,105,37,90,193,68,3,41,207,217,108,148,
+    103,243,249,29,240,33,171,174,229,154,175,217,244,19,122,40,188,203,152,100,93,119,92,19,
+    54,69,83,3,238,250,208,157,122,43,211,24,40,52,246,75,118,87,110,165,42,87,129,194,
+    253,45,86,193,194,115,17,152,53,231,140,15,86,152,58,110,9,184,141,36,83,138,117,41,
+    238,42,214,232,211,146,195,188,106,173,31,10,59,198,27,89,241,16,40,47,243,20,109,90,
+    183,83,243,41,3,228,54,177,173,26,244,11,235,5,63,77,41,26,250,102,43,22,59,10,
+    117,189,37,107,174,185,142,21,249,166,49,44,79,162,251,214,52,125,62,99,95,49,22,100,
+    199,239,178,128,7,60,223,22,24,217,152,101,180,40,194,219,193,34,198,126,185,82,52,130,
+    115,135,70,149,248,152,166,63,207,138,229,212,24,151,74,226,186,0,181,100,12,140,90,86,
+    157,111,71,106,230,221,143,85,221,232,154,50,168,39,211,196,216,74,85,55,79,235,238,182,
+    214,247,126,171,11,46,142,210,59,247,34,170,111,36,221,210,186,182,136,56,5,92,37,132,
+    234,170,165,237,89,74,6,48,170,126,197,157,21,225,182,164,142,64,169,176,148,11,129,130,
+    237,217,138,209,181,168,188,169,227,154,175,231,53,232,49,67,221,3,126,68,28,221,109,118,
+    163,143,249,16,85,115,17,43,188,86,197,158,44,124,59,22,249,81,6,229,69,96,7,231,
+    166,145,66,193,162,33,113,231,250,130,141,151,217,246,125,203,138,149,55,82,155,187,183,227,
+    85,173,193,213,91,19,85,95,225,108,117,72,110,81,183,154,207,215,194,173,8,128,172,107,
+    222,249,52,191,125,107,192,100,176,196,251,159,143,238,2,38,84,243,181,106,42,25,188,20,
+    91,252,48,239,111,183,168,26,60,12,55,98,113,167,33,182,120,168,92,49,125,104,192,30,
+    23,208,8,203,185,229,202,169,40,238,60,17,111,220,150,190,123,183,156,167,26,121,17,134,
+    35,93,47,100,252,195,58,48,195,210,6,76,111,53,45,24,114,119,0,59,149,49,63,84,
+    123,237,53,44,214,58,93,176,60,101,179,84,86,244,136,29,24,171,115,254,223,128,65,92,
+    239,85,33,235,194,66,22,172,218,225,5,195,27,146,237,24,40,78,74,54,51,96,53,26,
+    208,16,19,188,196,66,179,203,69,150,243,75,30,163,164,71,209,200,83,106,59,10,172,127,
+    63,144,214,192,98,83,160,144,228,126,75,173,91,116,124,129,89,206,208,183,62,103,135,31,
+    232,74,126,19,70,63,101,241,207,175,120,5,114,190,224,111,197,144,66,224,203,206,241,40,
+    234,217,5,232,149,226,53,187,60,204,135,243,98,49,179,162,255,109,13,148,85,223,20,138,
+    216,148,197,195,241,16,137,203,83,174,100,120,183,190,56,87,1,81,161,172,111,15,166,170,
+    91,5,226,84,22,88,11,153,42,133,143,95,64,134,63,191,58,93,84,152,157,172,3,200,
+    172,107,0,52,199,111,158,233,83,229,48,115,97,17,8,25,250,197,184,96,11,113,187,60,
+    191,45,32,222,70,12,136,12,170,71,146,169,255,237,237,201,233,231,5,47,247,185,135,149,
+    254,86,15,214,44,91,172,212,40,213,105,24,224,255,194,198,189,239,50,132,82,67,219,14,
+    99,0,21,239,52,22,93,209,28,144,228,191,207,13,22,122,199,33,121,154,218,52,168,185,
+    168,242,217,96,82,98,88,181,77,227,242,213,53,71,118,12,135,3,192,43,134,84,230,24,
+    56,61,248,112,124,215,177,121,27,91,55,186,79,39,71,63,191,250,156,168,106,106,26,230,
+    7,139,100,139,153,91,91,127,237,48,223,253,250,254,59,142,147,90,187,211,64,167,23,179,
+    111,27,41,53,128,67,173,73,232,142,198,0,241,235,97,14,236,246,174,3,52,154,88,55,
+    170,147,223,62,124,142,177,232,231,201,48,159,176,203,45,198,225,86,49,39,201,122,84,187,
+    243,2,179,91,169,218,26,46,172,82,107,247,7,187,168,6,247,101,206,213,8,82,186,18,
+    186,51,188,78,51,235,240,125,248,230,231,87,39,159,135,178,194,103,186,232,218,138,21,248,
+    107,34,242,225,12,12,243,113,10,59,224,188,152,125,200,230,155,165,48,119,32,165,22,204,
+    221,15,53,31,141,12,243,126,202,204,32,195,161,124,184,80,162,221,45,145,105,214,173,180,
+    86,76,83,144,24,222,141,151,253,225,173,165,13,179,238,186,246,139,249,226,238,29,168,202,
+    85,61,112,87,97,167,242,70,247,182,125,56,213,171,122,169,225,251,37,75,178,227,229,120,
+    140,103,210,219,210,181,85,251,246,215,77,150,164,125,173,174,175,79,136,202,202,87,5,150,
+    52,37,11,11,154,76,183,59,86,148,70,224,244,233,220,153,27,237,59,247,229,70,142,125,
+    113,255,1,198,178,37,228,56,236,111,4,27,123,243,192,76,47,234,101,128,201,147,33,66,
+    91,83,105,56,119,56,135,91,29,19,43,193,144,173,120,78,183,167,217,162,46,151,171,168,
+    112,58,76,179,234,43,137,191,180,235,117,212,249,209,118,85,247,93,16,213,74,254,123,152,
+    250,198,190,129,106,184,94,223,251,140,130,231,97,126,250,141,216,40,55,248,223,192,203,247,
+    130,66,106,84,158,14,209,186,236,251,225,199,104,239,191,135,158,111,6,98,173,114,218,32,
+    118,175,139,79,111,139,58,113,47,195,239,98,79,21,83,20,194,51,79,45,41,127,154,153,
+    183,102,197,219,246,88,238,138,152,48,254,250,240,77,163,252,224,237,243,195,186,81,126,248,
+    182,81,174,233,177,220,21,141,114,194,250,47,134,227,197,150,58,168,190,126,85,11,165,190,
+    85,78,73,40,46,149,184,251,176,183,236,222,223,45,71,193,48,255,86,20,200,22,202,48,
+    200,156,170,73,87,5,190,1,3,219,245,238,239,150,48,192,244,21,229,93,81,160,155,40,
+    65,161,179,42,233,64,23,185,59,26,182,134,160,162,103,194,4,127,153,188,51,22,120,245,
+    82,255,133,122,130,247,13,158,231,222,125,224,27,59,245,244,70,131,157,101,211,140,221,125,
+    176,188,122,169,95,158,92,53,88,158,203,143,54,119,26,237,198,94,61,221,209,104,241,145,
+    245,27,70,203,171,151,250,229,201,85,163,229,185,119,159,218,141,157,122,122,163,193,46,124,
+    199,156,109,123,93,152,167,22,217,184,60,179,248,134,121,167,147,210,118,221,213,74,29,209,
+    248,250,89,158,205,48,112,198,112,58,97,211,249,157,135,234,180,83,2,195,201,175,66,128,
+    83,236,238,184,184,3,60,235,0,217,240,132,251,201,58,66,209,5,53,61,125,111,39,143,
+    254,250,254,53,203,89,159,139,163,162,174,255,138,1,64,248,195,244,207,62,46,88,186,209,
+    239,207,225,50,29,22,168,130,6,133,55,249,66,167,178,220,33,186,245,40,172,131,36,117,
+    41,126,194,31,89,64,237,53,89,104,118,79,65,16,133,15,44,22,172,156,200,78,121,102,
+    7,22,121,206,22,44,218,128,30,2,232,48,103,227,171,185,124,35,195,106,246,131,226,139,
+    89,246,101,153,229,201,21,207,242,188,40,58,37,86,221,164,28,22,233,120,25,103,112,14,
+    216,66,51,31,75,114,93,82,117,5,37,42,27,112,73,39,248,46,52,34,157,148,189,186,
+    163,50,241,98,75,209,203,216,151,21,13,156,100,16,59,126,75,33,137,63,34,191,26,198,
+    209,12,75,8,77,152,57,38,188,50,190,201,199,125,244,156,169,26,199,131,101,62,138,126,
+    133,239,23,69,255,228,114,186,31,189,141,249,71,244,46,238,214,160,88,2,235,32,154,81,
+    31,211,217,112,145,69,135,9,252,126,245,246,121,116,132,63,78,71,195,60,207,82,124,208,
+    143,22,84,74,152,148,68,199,152,141,1,226,163,57,166,83,137,2,123,70,227,194,211,172,
+    79,129,222,34,38,83,94,21,197,52,90,166,226,43,90,98,58,247,220,17,253,47,130,68,
+    26,106,209,5,22,248,21,14,92,133,184,187,142,126,199,20,156,84,153,48,196,210,165,215,
+    140,232,61,37,3,106,101,2,163,4,150,95,176,185,76,250,19,65,38,131,63,153,242,28,
+    83,84,87,190,134,249,90,137,210,158,13,134,72,142,51,187,87,145,156,100,186,89,145,116,
+    137,227,224,236,69,164,244,176,73,121,214,20,105,175,177,148,173,5,38,114,178,140,96,39,
+    19,41,76,26,162,74,6,49,149,104,66,56,182,211,24,22,255,199,233,219,55,178,51,252,
+    126,9,226,188,132,167,246,123,34,83,142,134,11,96,129,34,189,159,17,125,228,18,202,62,
+    66,9,18,176,172,247,79,217,25,252,30,38,234,55,167,188,35,66,7,75,6,89,244,11,
+    162,223,224,54,209,31,25,209,88,177,32,45,95,126,163,27,253,153,154,137,209,97,42,169,
+    130,127,31,225,247,123,64,25,186,120,226,73,47,48,233,151,108,50,156,147,23,42,158,120,
+    69,68,34,221,69,2,54,141,46,142,125,121,209,115,76,61,156,196,195,76,246,117,194,105,
+    83,87,60,137,101,66,148,208,138,130,153,202,10,206,22,162,1,162,165,100,192,19,141,177,
+    224,219,217,98,32,173,112,68,250,63,36,117,138,239,132,186,199,7,13,145,240,37,37,204,
+    209,239,255,101,10,117,67,224,208,176,79,69,163,140,16,195,157,59,176,49,101,70,147,76,
+    150,195,248,39,64,109,209,88,165,72,142,26,229,42,41,250,35,193,21,207,205,171,255,153,
+    93,245,48,138,201,135,25,75,70,209,128,150,250,98,6,4,100,103,252,140,96,105,203,62,
+    59,147,97,230,155,229,36,206,156,230,250,9,173,164,177,219,205,63,136,186,185,130,149,157,
+    243,11,77,188,48,55,123,61,188,4,192,139,204,72,58,26,210,166,25,125,65,212,216,85,
+    83,194,86,62,156,144,57,37,167,195,158,149,198,87,29,103,48,163,158,153,195,123,154,102,
+    102,218,241,120,56,141,142,152,230,170,209,27,4,78,61,121,217,171,51,250,146,149,86,108,
+    244,2,249,153,252,120,67,149,1,129,48,234,11,89,93,41,106,71,179,204,108,188,84,48,
+    154,103,190,250,209,40,41,195,164,27,93,208,34,102,73,118,16,125,98,138,239,28,60,143,
+    106,135,184,160,216,85,194,230,120,164,157,32,54,94,177,43,160,227,232,20,71,121,114,1,
+    235,225,57,172,45,182,128,69,12,92,11,107,31,143,11,192,115,209,179,72,1,185,56,155,
+    17,96,211,98,204,242,69,244,82,50,119,59,57,230,235,111,158,192,30,153,153,25,175,82,
+    190,38,134,137,153,250,207,84,142,87,36,228,8,130,244,116,21,29,50,206,52,7,209,41,
+    113,14,0,114,152,176,113,52,69,232,142,175,198,64,39,60,225,11,45,80,116,8,22,189,
+    192,58,194,29,101,52,78,101,189,44,58,97,28,27,209,151,152,183,138,14,53,162,215,234,
+    247,65,52,103,68,177,240,235,87,241,107,63,186,200,196,56,15,162,87,88,143,92,199,68,
+    127,224,79,225,186,32,202,152,250,56,136,166,234,247,126,116,108,225,48,250,131,201,133,18,
+    189,36,110,60,201,210,33,228,242,205,95,4,217,76,105,79,164,7,93,238,170,107,206,13,
+    92,162,204,98,158,34,113,156,24,155,180,72,171,77,18,139,175,138,228,60,113,185,171,200,
+    40,146,50,143,21,89,211,132,246,106,25,153,40,234,113,142,61,70,21,115,149,248,54,21,
+    228,103,195,219,247,113,98,145,247,37,81,252,79,164,12,56,179,16,65,101,49,128,45,159,
+    9,241,61,76,229,252,138,132,63,4,75,45,190,138,132,159,105,7,186,204,100,247,35,33,
+    72,193,193,168,143,89,24,188,43,122,199,100,34,125,14,228,238,23,13,249,206,46,226,158,
+    69,255,98,242,51,58,145,53,56,175,249,141,73,145,141,127,255,138,21,63,193,40,137,71,
+    41,54,112,202,187,20,145,163,18,149,126,146,88,233,14,39,249,16,147,32,177,152,177,65,
+    150,206,138,92,101,252,156,216,25,78,189,143,88,239,109,178,112,171,213,126,73,172,12,167,
+    218,28,171,189,76,138,185,91,239,101,98,103,56,245,126,197,122,207,139,20,206,27,78,197,
+    127,36,78,142,83,243,83,204,233,231,202,169,247,34,177,210,157,90,83,226,9,176,157,170,
+    148,127,38,34,197,41,249,27,33,176,128,197,255,207,188,88,168,228,87,137,153,236,212,249,
+    93,213,81,73,175,85,121,167,236,191,98,33,233,169,148,247,82,164,116,74,254,79,172,24,
+    143,38,138,68,165,57,165,151,88,250,61,108,121,154,20,18,145,226,148,100,137,92,8,42,
+    233,82,37,57,101,107,83,146,105,128,160,117,225,143,137,76,114,10,199,137,36,116,149,116,
+    17,203,36,167,236,87,98,132,182,183,188,168,103,36,58,229,95,226,4,158,164,253,76,163,
+    56,225,66,131,49,140,95,101,138,75,51,137,226,245,70,234,101,108,164,186,51,74,171,119,
+    56,75,198,186,245,223,18,149,230,148,78,249,201,230,82,19,151,224,61,78,185,137,192,6,
+    61,47,113,49,62,186,138,213,73,74,165,101,52,151,236,171,173,9,28,101,137,58,166,169,
+    180,11,125,44,82,105,191,48,113,188,122,55,184,154,227,222,166,114,254,140,69,142,171,107,
+    29,157,234,58,134,238,118,84,251,135,76,255,80,144,227,53,158,124,40,219,225,252,90,165,
+    31,201,244,87,12,133,60,165,173,18,29,203,12,58,76,169,228,68,37,11,111,37,42,39,
+    149,57,71,12,134,160,7,32,79,135,207,217,28,22,186,74,127,30,139,116,187,248,71,227,
+    192,20,189,69,78,141,74,143,79,30,185,226,207,215,68,230,29,236,187,121,127,162,96,7,
+    248,45,231,140,99,46,121,148,115,46,18,81,169,253,196,205,26,137,74,229,156,165,172,244,
+    227,241,152,77,166,30,33,77,21,112,115,230,92,184,43,103,204,18,37,108,234,196,15,180,
+    239,37,124,115,234,241,125,116,49,89,142,199,239,139,9,37,30,68,181,223,164,168,117,148,
+    253,57,204,102,188,236,43,230,73,61,136,62,208,218,28,131,24,60,207,120,193,161,156,38,
+    254,249,213,250,60,136,94,51,46,213,164,51,16,160,173,30,222,84,229,28,68,31,105,227,
+    165,160,138,188,236,91,18,198,78,126,125,121,250,242,237,155,168,241,247,118,3,103,251,237,
+    199,211,147,232,250,213,201,139,15,157,189,240,245,203,231,207,95,157,116,218,225,251,151,63,
+    255,242,161,179,191,34,248,185,46,192,27,188,137,216,51,18,142,240,112,208,54,18,94,204,
+    112,95,223,119,83,168,220,1,73,136,240,133,201,74,68,57,254,68,45,122,50,32,7,155,
+    38,242,84,202,73,84,248,221,241,11,157,208,22,9,69,111,161,19,247,101,147,248,176,76,
+    117,16,4,250,104,211,102,185,140,249,251,52,47,105,154,154,32,202,38,69,177,24,200,20,
+    44,241,166,16,1,37,247,132,212,37,62,219,252,180,135,114,163,72,225,165,73,81,18,43,
+    239,209,39,174,120,149,132,61,28,166,233,16,143,180,42,17,171,157,46,99,114,182,106,166,
+    35,210,94,11,55,227,42,241,17,225,119,190,40,38,42,233,49,111,244,4,253,189,160,212,
+    219,222,219,51,90,52,146,219,36,143,114,237,133,114,46,130,241,122,152,27,41,4,0,187,
+    52,82,176,247,127,101,179,2,208,128,161,142,247,169,167,183,121,166,190,9,133,176,88,16,
+    33,42,113,159,23,130,198,151,243,82,230,1,175,113,56,158,14,152,74,124,100,215,176,51,
+    113,188,207,231,11,59,241,137,81,163,148,249,3,175,97,119,252,163,93,195,206,252,187,1,
+    213,41,91,44,241,42,91,100,214,246,219,52,179,136,72,226,207,52,209,135,227,175,236,106,
+    206,191,17,9,175,178,185,248,218,23,95,136,198,49,79,194,49,27,159,143,72,230,199,128,
+    177,51,35,245,177,78,229,9,79,136,158,22,70,145,31,12,10,121,59,197,251,118,156,166,
+    61,154,200,75,157,32,168,78,39,112,66,253,0,75,26,22,204,84,210,42,63,91,154,169,
+    156,96,134,249,0,246,62,51,125,159,78,239,9,36,47,178,116,223,204,57,160,77,63,207,
+    138,220,76,197,1,126,252,85,149,217,219,19,183,53,239,179,222,152,175,120,157,215,214,121,
+    180,32,204,188,125,142,55,98,19,112,94,93,194,177,200,215,196,129,183,88,169,181,71,230,
+    9,215,215,206,99,1,202,199,95,203,185,181,3,34,57,149,93,106,253,7,194,29,62,250,
+    125,154,73,116,158,16,122,112,187,250,80,160,116,166,115,246,104,220,175,135,104,211,151,165,
+    110,189,61,26,249,27,30,47,79,60,151,67,226,129,78,124,61,156,66,215,165,18,143,220,
+    18,124,142,117,129,199,106,222,117,218,19,149,86,209,234,15,78,1,183,129,31,137,60,208,
+    70,10,118,229,171,69,134,202,135,152,142,139,202,248,166,101,116,58,40,102,11,153,208,54,
+    42,90,25,251,124,195,150,159,7,70,57,35,249,145,20,75,100,2,142,78,219,139,136,196,
+    39,110,39,143,224,127,50,243,7,55,243,241,227,199,109,153,249,35,114,124,59,247,201,99,
+    153,249,119,27,166,253,71,63,138,156,125,206,30,144,31,241,103,81,72,162,133,245,243,145,
+    78,216,231,9,135,58,5,199,248,106,57,25,230,40,232,233,228,71,102,178,211,234,99,222,
+    200,137,221,8,177,10,157,244,68,38,157,46,178,60,25,142,117,206,15,188,250,103,180,208,
+    248,252,252,183,15,237,207,34,239,224,224,135,31,158,8,0,253,185,63,184,185,7,102,238,
+    143,110,238,99,51,247,239,162,91,50,152,248,252,232,232,221,187,95,117,219,143,127,124,180,
+    103,229,239,151,242,219,178,245,170,6,246,237,2,229,22,14,68,15,39,31,142,117,250,147,
+    246,223,213,152,15,79,177,225,203,71,50,179,118,240,195,143,123,63,90,185,143,117,46,102,
+    254,221,201,124,108,100,182,247,172,204,39,118,102,219,201,124,98,102,238,91,153,63,218,53,
+    15,156,76,171,230,35,39,243,71,51,243,177,149,217,222,179,219,125,226,230,90,13,255,224,
+    230,90,45,255,232,230,182,247,204,108,27,77,237,125,59,123,127,175,148,189,111,102,211,62,
+    91,20,211,183,176,20,162,125,46,140,224,55,103,159,152,34,75,188,3,54,250,174,192,157,
+    139,75,35,234,2,116,145,201,171,211,104,159,239,75,70,22,231,107,152,209,182,51,184,144,
+    8,146,0,223,146,80,34,66,33,27,229,132,236,68,8,117,143,168,53,204,58,29,23,83,
+    35,25,219,250,164,236,203,117,250,190,113,15,59,71,255,19,175,11,33,191,202,84,124,65,
+    152,170,156,182,145,243,130,229,42,125,95,113,231,147,60,41,184,36,73,27,207,28,121,131,
+    74,226,59,206,207,108,50,97,102,162,152,206,19,51,141,90,44,250,175,150,23,102,170,32,
+    183,215,63,152,137,130,204,94,183,159,152,169,130,190,158,155,105,79,164,124,79,204,232,29,
+    136,232,148,193,103,17,39,221,77,151,130,129,125,109,128,2,249,163,200,23,68,41,236,251,
+    31,159,169,134,71,53,245,176,174,243,15,234,95,135,227,49,197,90,39,9,44,245,57,150,
+    193,119,252,79,76,116,201,59,92,201,247,89,156,41,37,84,189,27,102,73,54,167,9,195,
+    51,58,118,160,142,217,27,35,100,57,21,42,236,194,89,94,167,231,46,95,12,161,149,148,
+    18,189,157,58,129,34,207,206,43,162,68,154,13,220,2,8,214,26,206,237,206,239,237,65,
+    226,68,124,205,35,6,95,201,184,48,67,68,41,59,8,214,154,143,135,73,134,250,6,230,
+    96,232,2,231,120,92,44,211,109,188,0,170,194,94,47,31,70,161,185,227,132,225,127,99,
+    165,100,240,14,36,221,97,50,206,162,218,198,56,86,162,228,154,206,248,245,149,211,217,97,
+    66,78,1,117,87,167,87,128,195,201,54,3,180,42,124,203,32,21,166,182,166,206,114,149,
+    141,253,43,237,111,27,142,95,152,51,126,251,106,106,91,180,91,181,190,27,44,28,181,250,
+    154,111,91,104,236,122,223,12,14,191,108,136,182,115,66,142,69,215,58,145,16,239,103,21,
+    97,78,166,50,72,8,138,139,220,21,141,123,49,182,153,52,253,21,55,186,153,43,187,67,
+    159,103,11,209,86,179,190,152,45,189,110,154,73,175,234,3,1,99,85,184,183,71,131,192,
+    251,190,219,192,110,149,223,8,178,231,54,177,25,84,109,26,179,68,173,57,186,159,188,13,
+    88,118,133,141,112,249,238,63,43,67,219,204,29,184,196,197,234,173,193,115,235,109,7,165,
+    255,26,183,18,216,133,6,150,238,135,111,57,183,70,133,109,38,183,116,255,92,9,215,210,
+    70,162,9,88,109,59,252,221,6,52,239,173,121,37,108,163,216,196,217,193,254,45,113,102,
+    84,216,6,103,165,139,254,234,152,74,54,206,110,7,152,83,99,43,148,109,15,218,88,163,
+    76,188,120,220,6,54,183,202,70,224,252,175,42,213,172,228,79,27,186,39,143,110,13,157,
+    81,101,59,232,74,239,65,149,184,251,170,167,21,100,132,121,150,26,239,17,7,209,188,103,
+    191,80,28,68,11,157,18,93,146,210,208,229,80,106,23,108,84,210,85,69,215,108,179,90,
+    91,193,93,24,169,216,98,143,240,76,134,143,192,74,49,98,51,26,75,117,252,74,194,199,
+    120,146,64,205,100,38,183,57,85,222,143,190,23,154,244,232,41,87,106,155,108,134,200,40,
+    190,86,4,176,94,136,43,160,96,140,54,214,4,230,178,213,23,69,131,16,147,62,54,161,
+    243,113,49,235,104,7,216,207,226,78,251,201,15,63,252,176,223,126,188,10,184,122,174,212,
+    212,216,26,157,78,141,181,3,40,233,129,172,31,196,105,124,183,65,252,246,203,123,169,231,
+    185,129,12,85,201,53,84,168,181,61,29,40,255,41,5,189,163,97,206,102,87,182,130,235,
+    70,161,211,83,105,13,16,37,93,91,7,150,56,19,176,72,204,114,237,155,235,73,54,235,
+    111,23,7,199,170,72,110,205,160,166,105,251,175,124,114,201,146,124,102,229,252,136,10,234,
+    123,63,20,225,159,233,47,9,202,47,181,91,81,91,34,28,246,154,49,30,60,225,240,140,
+    74,245,188,222,225,114,81,112,191,134,247,239,199,66,141,92,198,180,234,162,130,126,26,201,
+    162,221,24,126,202,142,87,76,128,66,17,143,209,249,102,134,87,65,27,205,42,92,4,240,
+    106,183,193,128,170,225,141,144,46,115,87,43,169,105,44,230,136,34,178,191,157,13,209,231,
+    4,39,235,16,109,13,196,116,111,25,252,82,55,216,50,42,111,178,127,176,72,202,6,28,
+    49,156,69,72,91,151,105,151,252,248,31,107,56,185,223,124,3,240,160,203,162,76,154,72,
+    36,161,24,70,26,116,209,201,62,222,31,240,167,145,216,184,230,48,7,137,23,69,223,52,
+    80,108,96,211,96,75,138,233,85,3,78,178,239,54,224,90,105,196,37,149,250,141,206,34,
+    157,17,151,26,88,203,114,159,63,63,45,217,183,84,0,98,79,194,29,129,177,39,98,91,
+    128,86,92,185,249,15,58,227,70,155,96,80,37,61,75,243,97,118,9,231,146,113,54,127,
+    248,199,252,225,76,88,141,204,31,170,42,173,63,180,241,211,148,39,254,234,244,90,125,117,
+    35,27,193,176,188,102,93,109,6,35,2,135,139,92,225,46,142,169,111,20,15,184,85,76,
+    254,45,157,59,181,75,221,171,124,14,0,51,18,20,4,211,33,93,213,162,190,239,214,248,
+    198,113,171,106,186,215,153,212,160,150,1,3,185,230,42,117,78,83,203,237,78,148,13,207,
+    166,254,236,226,219,79,178,93,15,102,90,78,116,90,76,78,198,25,154,224,68,105,145,44,
+    241,71,139,223,20,139,228,55,167,205,198,96,177,152,118,30,62,252,250,245,107,235,235,65,
+    171,152,245,31,182,255,254,247,191,63,188,28,44,38,227,70,216,72,168,113,203,141,180,57,
+    16,129,85,14,140,157,81,147,238,146,142,177,18,215,111,46,215,68,119,74,195,63,173,107,
+    85,194,29,153,36,169,157,2,97,182,238,103,185,86,244,198,101,171,91,217,132,206,37,22,
+    122,168,203,19,26,87,97,154,45,88,50,248,207,247,131,129,233,254,130,126,232,230,63,203,
+    231,47,198,108,150,109,36,72,85,114,83,103,34,152,210,67,172,208,195,10,188,55,191,131,
+    140,171,230,8,195,7,101,243,215,69,186,28,99,88,36,238,247,249,222,222,10,109,9,107,
+    255,47,201,239,195,56,97,38,8,0,
+};
+
+// js/inflate.min.js: 6980 bytes, 2906 gzipped
+static const char NotModified2[] =
+    "HTTP/1.0 304 Not Modified\r\n"
+    "ETag: \"d0eebcecf8098d41\"\r\n"
+    "\r\n";
+
+// The 200 header, followed by the body
+/*
+HTTP/1.0 200 OK
+Content-Type: application/javascript
+Content-Length: 2906
+Content-Encoding: gzip
+Vary: Accept-Encoding
+ETag: "d0eebcecf8098d41"
+Cache-Control: no-cache
+
+*/
+static const uint8_t Response2[3083] = {
+    72,84,84,80,47,49,46,48,32,50,48,48,32,79,75,13,10,67,111,110,116,101,110,116,
+    45,84,121,112,101,58,32,97,112,112,108,105,99,97,116,105,111,110,47,106,97,118,97,115,
+    99,114,105,112,116,13,10,67,111,110,116,101,110,116,45,76,101,110,103,116,104,58,32,50,
+    57,48,54,13,10,67,111,110,116,101,110,116,45,69,110,99,111,100,105,110,103,58,32,103,
+    122,105,112,13,10,86,97,114,121,58,32,65,99,99,101,112,116,45,69,110,99,111,100,105,
+    110,103,13,10,69,84,97,103,58,32,34,100,48,101,101,98,99,101,99,102,56,48,57,56,
+    100,52,49,34,13,10,67,97,99,104,101,45,67,111,110,116,114,111,108,58,32,110,111,45,
+    99,97,99,104,101,13,10,13,10,31,139,8,0,0,0,0,0,2,3,189,25,107,115,218,
+    72,242,187,127,133,76,101,89,77,52,96,73,24,131,53,26,124,206,115,189,155,216,78,226,
+    100,99,83,212,213,72,26,33,5,16,24,132,223,220,111,191,158,135,64,16,59,251,170,187,
+    146,101,205,163,167,167,187,167,187,167,187,217,121,254,220,248,215,48,13,121,54,227,198,221,
+    48,13,234,223,102,134,107,59,174,81,51,210,17,187,101,70,215,72,242,124,50,243,118,118,
+    250,105,158,204,131,122,56,30,237,200,169,157,2,190,103,156,37,220,120,127,116,102,188,211,
+    152,158,239,152,241,60,11,243,116,156,153,200,184,255,121,14,99,179,124,154,134,249,207,228,
+    138,77,141,33,189,26,167,145,97,99,198,104,158,164,51,82,64,27,83,51,196,17,186,23,
+    64,140,134,245,217,100,152,230,102,165,94,65,56,160,140,145,109,147,117,237,94,154,25,1,
+    170,86,131,58,191,225,225,167,112,154,78,242,245,158,89,17,8,42,150,0,70,36,30,79,
+    77,209,231,132,213,135,60,235,231,73,181,106,114,202,234,179,36,141,115,19,33,130,182,87,
+    51,209,54,165,195,131,160,203,123,52,242,2,42,26,178,231,201,161,251,197,66,114,144,211,
+    202,60,139,120,156,102,60,170,192,138,252,118,194,199,177,241,57,205,242,246,225,116,202,110,
+    171,213,39,1,156,189,63,130,104,184,63,130,120,197,114,246,37,229,215,43,169,93,153,161,
+    146,89,4,50,83,140,96,70,109,144,217,241,124,20,240,105,253,244,228,211,209,217,209,151,
+    215,255,62,58,126,115,116,124,116,118,142,57,142,113,31,39,120,128,71,56,195,19,60,195,
+    55,82,80,19,106,147,137,31,17,203,154,160,176,59,233,117,24,8,11,142,2,154,8,139,
+    255,126,0,3,129,26,32,156,58,190,207,72,76,51,126,109,152,249,65,137,120,79,254,71,
+    38,71,164,79,29,146,0,94,129,127,64,93,210,247,41,35,232,126,115,187,52,54,5,86,
+    74,105,31,221,143,96,34,163,137,92,51,131,246,204,239,3,208,12,141,232,200,247,157,135,
+    172,234,224,172,211,1,196,55,180,15,3,123,15,19,13,58,2,80,78,102,22,29,160,184,
+    59,235,209,27,88,150,44,44,171,79,18,223,7,248,129,248,191,152,242,124,62,205,186,49,
+    102,56,232,45,86,146,188,86,250,39,148,178,222,167,221,30,145,173,132,54,220,214,94,91,
+    117,34,169,178,245,88,125,148,2,215,135,64,162,108,164,217,100,158,211,252,64,8,100,165,
+    13,112,62,94,168,0,70,116,219,209,160,244,86,53,166,98,8,184,143,30,30,182,205,8,
+    116,12,161,8,16,69,252,6,68,173,119,209,3,8,71,245,96,30,199,124,250,41,189,227,
+    197,116,66,203,163,43,152,51,80,152,2,38,165,229,81,1,51,229,179,18,142,41,45,70,
+    16,153,93,167,121,152,232,117,232,62,100,96,191,135,158,236,6,101,81,132,229,115,111,175,
+    29,187,132,178,20,117,150,219,108,35,18,76,57,27,16,137,235,182,192,101,255,33,30,133,
+    1,41,56,174,132,125,167,122,153,234,93,169,222,55,213,187,214,251,128,217,176,249,48,135,
+    141,166,227,107,227,245,116,10,202,81,73,179,43,54,4,199,147,102,241,144,229,220,24,141,
+    35,94,65,100,107,177,16,198,115,8,22,115,75,29,252,130,222,231,222,33,158,121,183,11,
+    178,117,93,159,76,199,249,88,152,94,125,64,87,94,77,106,47,217,86,71,74,148,245,133,
+    244,165,164,23,55,16,9,171,78,33,89,56,113,27,6,58,82,93,181,104,67,45,85,219,
+    83,102,187,210,29,172,53,10,20,83,53,66,172,217,14,112,12,103,164,205,187,79,135,56,
+    129,119,64,131,98,104,68,135,27,26,106,11,173,98,150,211,161,49,122,84,16,192,206,120,
+    52,129,99,159,241,200,8,134,227,112,96,36,156,69,124,234,25,239,94,31,87,132,233,70,
+    93,102,89,189,7,245,241,253,246,63,64,121,172,112,38,143,226,236,131,221,255,39,249,203,
+    56,21,239,198,21,159,166,241,45,32,151,212,245,59,133,156,54,241,129,128,13,101,5,70,
+    58,51,130,233,120,192,179,202,83,10,47,143,152,91,91,253,78,33,99,34,28,211,160,198,
+    73,191,6,142,6,246,202,81,80,159,241,220,140,234,179,121,192,164,169,51,204,172,17,194,
+    96,98,220,162,35,232,0,36,31,2,66,137,110,84,171,17,4,87,9,48,174,197,64,180,
+    45,112,162,15,156,155,194,177,170,209,197,154,213,104,130,202,244,44,215,220,79,60,119,129,
+    254,134,246,47,158,102,163,95,176,209,23,108,244,75,108,244,159,96,131,129,103,95,242,163,
+    109,59,40,155,190,163,76,255,155,25,48,28,178,53,175,224,122,197,77,157,21,134,212,68,
+    224,59,90,120,82,234,59,120,86,244,118,145,181,139,111,158,246,29,175,10,37,192,159,192,
+    82,206,224,253,12,239,28,222,247,240,190,129,247,14,222,75,120,191,200,175,77,46,253,25,
+    92,23,151,232,166,251,170,123,217,235,209,173,149,65,131,148,182,115,116,127,73,103,250,162,
+    185,41,206,96,115,145,189,248,68,175,204,27,68,230,79,147,150,193,125,71,46,245,157,248,
+    133,66,23,208,124,33,72,43,226,123,250,90,109,252,9,225,247,90,31,157,61,41,159,59,
+    218,176,52,85,46,34,119,226,28,230,221,75,113,14,111,214,228,220,218,132,110,172,67,219,
+    228,13,188,229,21,109,189,194,113,138,37,173,167,151,20,26,246,134,234,201,247,139,51,184,
+    246,174,204,249,74,133,108,156,33,228,201,33,17,99,170,62,249,188,9,182,14,36,64,180,
+    138,156,225,207,63,84,232,121,54,200,198,215,153,241,226,236,252,244,181,7,241,94,8,218,
+    172,175,118,67,93,17,38,2,31,46,84,234,45,237,58,123,216,105,97,167,141,109,220,198,
+    45,188,143,161,111,227,38,118,28,188,139,29,23,55,176,211,192,46,118,160,131,157,102,15,
+    191,42,93,227,58,102,51,223,34,239,45,254,133,118,27,176,164,9,8,90,128,106,95,160,
+    1,36,176,218,105,202,45,246,177,11,152,90,184,225,224,70,19,239,54,112,211,193,77,216,
+    15,160,27,120,31,224,5,28,76,58,123,176,100,191,137,93,128,133,59,178,120,123,248,232,
+    145,173,127,65,222,47,248,87,218,181,241,250,227,232,199,213,79,67,63,187,250,105,234,71,
+    66,247,240,111,223,7,39,191,34,239,87,252,14,4,36,87,139,21,66,58,130,29,65,22,
+    110,192,24,16,223,196,251,192,154,11,19,251,192,28,88,101,163,13,104,1,170,181,39,36,
+    0,128,78,179,1,11,108,0,110,216,45,88,100,195,130,61,103,183,137,219,98,137,227,186,
+    237,125,193,50,44,115,119,155,173,86,15,71,236,17,62,223,33,239,29,230,108,197,104,193,
+    92,193,84,83,74,94,200,94,72,95,200,95,157,128,58,4,71,28,37,252,109,9,250,27,
+    61,124,252,61,191,156,33,143,51,124,242,180,121,186,237,54,194,167,56,102,228,84,219,104,
+    204,232,73,97,240,167,62,76,88,214,41,58,233,158,246,168,179,219,232,208,211,131,182,231,
+    54,155,162,177,239,185,173,125,209,104,121,109,153,43,4,12,220,193,9,194,31,126,16,45,
+    217,8,127,196,125,70,62,234,237,250,140,126,40,182,251,232,247,197,118,31,209,135,238,199,
+    30,109,74,156,161,192,249,1,173,2,215,151,42,112,45,60,168,72,158,98,136,32,194,122,
+    4,225,67,168,67,139,24,90,12,66,7,94,132,12,9,9,32,248,70,247,224,220,226,14,
+    132,221,127,238,182,100,15,148,119,99,121,117,131,111,183,104,123,145,80,86,53,33,21,136,
+    80,205,33,176,51,101,16,237,68,208,138,104,80,19,95,70,99,162,13,51,89,108,45,169,
+    126,253,247,168,134,43,7,52,121,0,31,167,39,242,23,224,98,80,173,110,43,30,8,42,
+    211,135,5,125,100,68,147,174,162,112,0,20,246,32,179,24,1,129,206,158,240,234,89,39,
+    120,60,234,8,225,126,212,241,133,112,46,25,42,56,203,52,99,217,58,99,163,234,94,179,
+    217,104,46,214,98,198,111,171,152,177,148,217,234,192,78,95,222,129,114,120,99,26,174,114,
+    85,90,100,164,53,225,20,116,174,70,220,230,30,228,129,102,92,92,15,161,72,94,129,7,
+    24,239,196,40,232,208,101,56,15,153,107,17,73,66,60,177,220,9,97,214,13,132,187,142,
+    229,101,126,223,167,49,108,208,34,3,122,212,237,247,136,237,255,6,31,192,49,176,138,75,
+    86,12,192,46,203,45,35,25,192,177,110,44,160,143,225,3,208,201,18,90,12,0,244,159,
+    161,68,242,74,6,226,126,1,154,122,84,18,86,75,122,11,57,222,246,21,28,104,167,250,
+    214,104,27,171,16,3,86,20,136,55,2,244,235,127,42,236,191,38,232,18,87,43,20,255,
+    47,9,91,131,206,211,52,252,15,100,203,203,201,143,202,118,126,156,180,5,53,153,3,66,
+    166,73,203,125,145,113,23,25,77,168,66,232,80,198,158,124,21,17,40,192,162,148,1,220,
+    74,73,50,237,27,131,101,145,131,48,112,64,150,197,80,216,101,61,176,121,102,201,149,189,
+    133,202,223,235,147,249,76,164,90,138,165,161,181,90,39,183,229,155,219,70,56,82,8,244,
+    142,50,212,21,187,202,193,14,147,91,113,181,85,100,177,101,228,174,50,98,237,5,248,134,
+    220,238,74,58,169,139,52,133,57,72,247,166,73,218,81,242,183,156,7,91,200,71,40,98,
+    57,41,76,10,129,133,112,230,149,76,86,117,42,116,89,18,10,235,19,85,166,169,79,16,
+    126,108,122,46,166,133,0,230,192,155,219,97,7,32,69,179,95,184,24,181,55,82,52,140,
+    187,110,15,124,46,184,157,231,102,176,227,34,32,8,206,222,79,52,240,65,209,176,98,175,
+    104,250,190,3,55,42,45,186,207,33,7,56,48,35,186,121,237,138,162,131,16,57,156,168,
+    23,209,132,148,35,181,144,70,27,130,203,190,87,56,187,208,165,176,16,97,95,42,211,143,
+    21,113,104,173,43,36,90,90,57,168,129,13,82,90,154,77,65,208,129,218,100,83,33,181,
+    227,242,138,89,25,175,174,77,145,184,184,191,151,72,73,44,43,87,49,186,15,168,180,233,
+    85,37,108,153,197,37,254,64,84,169,64,183,66,225,57,130,174,176,84,173,86,10,155,118,
+    93,5,46,13,24,9,124,171,90,85,89,158,234,218,166,155,218,120,245,157,80,151,230,73,
+    52,219,211,3,51,220,60,186,8,97,101,164,155,130,129,19,65,112,154,33,125,108,194,43,
+    192,21,155,157,168,184,18,138,17,42,240,234,165,232,49,242,195,82,105,238,247,146,79,199,
+    65,185,218,22,22,185,167,253,23,170,104,170,98,80,76,29,210,98,4,194,27,26,118,181,
+    53,66,90,27,172,245,116,126,198,170,78,83,167,101,9,83,250,48,226,121,50,6,173,102,
+    63,206,88,102,243,201,100,60,205,185,8,47,84,73,67,240,166,22,235,100,220,22,55,143,
+    201,124,191,141,172,0,253,212,112,30,15,79,226,48,225,225,192,128,92,190,239,85,172,245,
+    5,66,14,65,181,225,174,175,140,163,52,204,229,2,17,206,101,227,220,88,82,83,209,78,
+    242,82,158,188,168,130,222,75,73,121,69,45,106,89,93,244,202,165,70,188,170,40,122,229,
+    242,34,86,149,68,175,40,41,46,208,98,235,247,167,42,105,202,182,75,206,14,28,36,209,
+    90,121,89,31,152,136,148,43,173,151,117,38,221,183,60,53,4,151,130,89,58,31,223,119,
+    119,31,214,250,206,222,122,191,93,238,34,8,2,109,21,163,211,72,96,173,136,95,41,178,
+    126,201,117,6,138,62,14,198,170,127,140,168,72,255,81,178,116,94,182,116,8,59,193,58,
+    227,30,53,197,255,122,152,176,233,75,136,35,15,115,211,70,85,200,16,212,150,1,24,102,
+    17,125,36,212,129,80,214,198,163,85,37,47,195,162,46,110,251,162,176,152,81,200,173,118,
+    253,209,129,248,120,35,50,170,209,140,68,99,3,34,130,160,59,1,38,48,68,18,9,185,
+    78,210,33,55,107,53,136,82,147,159,40,4,162,174,67,6,186,33,148,138,9,165,26,72,
+    121,36,146,134,199,149,138,69,67,62,5,63,105,72,229,154,205,71,66,39,181,97,70,234,
+    167,143,132,65,64,13,75,46,196,207,63,71,170,150,84,193,191,163,205,177,210,113,71,188,
+    80,118,0,44,171,1,146,24,191,210,251,195,87,135,167,226,7,10,239,69,125,134,95,188,
+    59,121,249,27,180,242,5,62,199,23,248,25,78,229,145,159,4,223,120,152,215,7,252,118,
+    134,206,105,169,103,126,45,221,215,23,70,154,25,231,224,14,241,51,16,234,87,116,222,125,
+    38,92,229,5,121,166,15,44,101,244,188,56,177,103,126,42,110,245,103,232,130,2,92,15,
+    111,178,240,98,169,209,245,138,117,129,191,118,47,122,32,15,84,15,217,112,40,85,16,145,
+    173,255,2,78,24,188,81,68,27,0,0,
+};
+
+// js/GLTFLoader.js: 80066 bytes, 18639 gzipped
+static const char NotModified3[] =
+    "HTTP/1.0 304 Not Modified\r\n"
+    "ETag: \"93600fea4438b5fd\"\r\n"
+    "\r\n";
+
+// The 200 header, followed by the body
+/*
+HTTP/1.0 200 OK
+Content-Type: application/javascript
+Content-Length: 18639
+Content-Encoding: gzip
+Vary: Accept-Encoding
+ETag: "93600fea4438b5fd"
+Cache-Control: no-cache
+
+*/
+static const uint8_t Response3[18817] = {
+    72,84,84,80,47,49,46,48,32,50,48,48,32,79,75,13,10,67,111,110,116,101,110,116,
+    45,84,121,112,101,58,32,97,112,112,108,105,99,97,116,105,111,110,47,106,97,118,97,115,
+    99,114,105,112,116,13,10,67,111,110,116,101,110,116,45,76,101,110,103,116,104,58,32,49,
+    56,54,51,57,13,10,67,111,110,116,101,110,116,45,69,110,99,111,100,105,110,103,58,32,
+    103,122,105,112,13,10,86,97,114,121,58,32,65,99,99,101,112,116,45,69,110,99,111,100,
+    105,110,103,13,10,69,84,97,103,58,32,34,57,51,54,48,48,102,101,97,52,52,51,56,
+    98,53,102,100,34,13,10,67,97,99,104,101,45,67,111,110,116,114,111,108,58,32,110,111,
+    45,99,97,99,104,101,13,10,13,10,31,139,8,0,0,0,0,0,2,3,205,125,123,127,
+    219,54,178,232,223,206,167,96,187,247,86,82,162,208,175,52,109,165,166,61,178,173,36,222,
+    245,107,37,185,221,214,39,199,135,150,104,155,141,68,106,73,202,169,187,245,119,191,152,193,
+    107,240,32,41,39,237,238,237,239,236,137,5,14,6,3,96,48,24,12,6,51,155,79,159,
+    62,9,158,6,255,21,173,202,219,44,15,70,201,244,54,152,36,87,87,113,89,6,155,193,
+    109,89,46,139,222,230,230,77,82,222,174,174,194,105,182,216,204,25,68,153,211,58,139,124,
+    150,101,87,2,154,1,243,223,8,76,193,38,89,122,31,156,69,121,82,36,26,246,195,135,
+    15,97,201,62,44,177,220,173,19,189,143,110,147,60,243,147,82,138,175,191,210,42,7,89,
+    26,28,79,247,87,249,236,158,212,130,118,102,89,186,152,78,225,3,212,102,117,54,159,60,
+    153,188,29,13,135,225,155,163,201,235,163,44,154,197,121,240,42,104,7,215,171,116,90,38,
+    12,79,187,19,252,235,201,147,13,245,91,195,181,131,69,148,70,55,172,2,7,217,40,111,
+    147,34,148,101,128,68,254,253,217,171,87,193,42,157,197,215,73,26,207,24,244,247,234,75,
+    47,224,173,31,196,215,209,106,94,2,226,36,189,57,230,95,251,18,231,44,143,166,153,34,
+    46,93,205,231,125,214,222,3,251,159,166,38,92,230,89,153,149,247,203,152,129,32,57,211,
+    44,45,202,124,53,45,179,188,71,200,238,226,183,60,43,138,211,60,185,73,210,94,208,138,
+    82,54,252,139,108,85,180,240,227,156,193,245,200,8,4,171,124,222,13,178,20,234,195,191,
+    103,121,118,147,199,69,1,127,15,243,60,83,3,176,113,23,229,65,49,205,144,6,160,188,
+    175,74,151,81,121,43,10,67,252,219,28,147,239,201,23,57,38,156,220,243,50,153,23,97,
+    252,107,201,198,160,60,207,231,123,81,17,35,69,65,71,99,159,171,177,137,63,136,218,175,
+    147,121,44,231,9,73,82,51,35,234,241,58,97,17,151,163,184,88,178,177,138,39,108,240,
+    218,108,52,242,60,186,191,90,93,95,199,121,203,2,134,127,196,112,144,225,153,69,101,164,
+    134,96,163,204,239,229,159,27,188,97,198,216,64,51,128,117,113,32,232,96,138,1,228,205,
+    108,60,4,211,168,100,203,175,29,196,26,227,70,114,205,10,36,168,205,76,18,104,67,0,
+    96,85,129,142,225,139,231,69,172,97,202,219,60,251,16,196,234,179,104,21,255,121,168,152,
+    91,4,126,64,206,96,131,181,79,57,135,12,194,93,52,95,105,154,113,54,9,147,177,169,
+    65,0,96,233,141,60,46,87,121,170,25,68,225,62,99,99,211,132,84,48,210,26,216,14,
+    70,131,253,83,206,2,6,82,186,154,12,212,230,50,35,191,106,218,193,185,237,217,220,80,
+    57,205,100,157,176,229,89,198,105,217,151,191,25,139,199,105,193,112,20,176,128,31,248,20,
+    225,204,195,162,206,174,57,155,189,98,179,223,98,203,154,73,137,150,158,124,129,11,168,102,
+    64,188,170,57,245,208,194,34,186,73,166,12,198,93,94,179,120,154,205,226,9,35,161,141,
+    75,232,60,73,203,175,7,176,14,100,127,182,186,193,11,214,158,100,44,164,75,224,99,20,
+    237,29,158,12,70,63,93,14,255,49,25,158,140,15,79,79,46,223,14,7,7,195,209,229,
+    241,224,205,225,62,225,81,186,54,54,116,135,47,2,85,115,28,254,237,237,232,82,224,3,
+    161,21,188,19,203,26,126,236,37,105,148,223,15,101,69,185,244,52,183,171,213,99,12,183,
+    189,132,58,129,94,43,146,199,57,24,159,100,107,121,144,225,93,151,230,80,205,238,19,207,
+    50,212,248,30,63,21,100,18,196,178,85,28,245,75,145,193,66,251,235,248,244,68,202,28,
+    217,82,135,176,19,128,133,81,193,86,8,206,157,150,37,191,255,78,190,133,119,113,14,29,
+    189,8,182,216,20,124,27,236,232,209,172,26,75,32,87,252,217,178,55,213,94,112,158,22,
+    171,229,50,203,75,214,18,111,33,184,153,179,177,18,237,20,193,119,175,118,194,173,32,202,
+    227,64,1,134,193,57,27,182,163,248,38,154,222,147,13,58,97,27,91,28,205,194,22,31,
+    12,123,226,30,172,190,234,73,99,216,136,200,188,102,228,131,140,97,8,217,176,109,245,217,
+    63,223,250,106,132,243,56,189,41,111,251,193,179,103,12,68,51,149,177,106,79,162,5,236,
+    122,158,234,23,172,210,187,190,167,74,49,138,255,185,74,114,70,146,83,79,125,97,115,114,
+    241,78,242,99,241,33,17,236,109,180,74,216,124,202,118,71,155,49,143,14,223,188,157,140,
+    47,207,206,79,246,39,231,131,163,158,0,53,214,159,137,144,46,185,163,228,230,182,44,200,
+    146,67,46,83,11,102,227,42,143,163,247,253,186,246,143,7,147,225,232,112,112,52,190,60,
+    63,57,58,156,60,178,253,227,168,140,243,36,154,23,231,233,60,41,255,24,58,206,246,70,
+    151,227,179,225,254,249,209,96,196,22,236,233,120,124,120,50,28,143,63,150,178,179,171,124,
+    188,140,167,171,121,148,191,153,179,45,143,45,166,130,140,216,99,104,196,61,235,242,120,56,
+    126,123,185,127,122,124,54,98,84,177,111,143,36,236,0,118,174,227,184,184,221,207,22,75,
+    216,204,25,144,53,112,221,192,217,241,214,37,243,120,252,122,114,57,97,5,231,163,225,229,
+    193,129,127,212,106,224,13,82,65,206,173,242,152,21,127,220,120,225,72,253,253,124,112,50,
+    57,252,121,48,161,67,181,185,25,28,50,217,7,10,95,84,178,253,242,106,85,198,69,16,
+    165,51,214,243,56,72,179,124,17,205,147,223,216,10,187,158,71,55,40,117,110,217,199,57,
+    43,184,186,71,144,104,58,101,67,151,73,229,210,79,211,140,235,237,61,249,155,75,29,119,
+    29,135,9,147,178,191,158,94,187,75,247,59,38,121,232,10,230,122,123,54,143,195,15,81,
+    158,86,72,210,247,105,246,33,213,168,130,207,91,193,51,11,243,179,160,245,121,216,210,123,
+    163,222,205,30,252,187,7,238,24,57,153,155,51,44,144,252,162,251,212,149,196,46,81,93,
+    67,133,140,137,41,173,157,177,31,45,118,146,192,190,80,109,209,86,10,57,136,80,203,197,
+    103,241,75,104,48,130,122,78,154,220,211,136,174,85,76,227,52,238,242,127,24,93,83,214,
+    241,60,98,127,68,105,178,136,74,78,44,151,19,84,15,194,109,7,14,73,66,71,103,149,
+    123,2,21,41,42,122,18,175,216,180,57,242,158,106,133,23,235,166,122,180,89,241,17,246,
+    185,30,217,85,69,57,239,80,79,140,185,40,92,177,63,15,216,14,223,99,218,31,159,33,
+    49,119,209,108,38,166,92,45,146,98,146,157,11,240,182,49,53,208,183,174,146,141,79,248,
+    185,224,8,143,45,216,109,81,248,224,232,247,112,160,132,191,54,159,226,228,143,134,111,14,
+    199,147,209,79,120,66,54,79,191,163,248,38,97,26,232,189,56,25,227,144,102,87,191,196,
+    211,146,104,174,124,63,222,224,163,126,3,131,64,166,237,125,124,175,103,68,232,213,2,195,
+    5,126,124,39,169,196,127,88,255,237,234,93,1,175,209,152,245,25,33,188,192,64,148,199,
+    139,236,46,174,38,101,22,207,227,50,174,35,133,99,24,204,231,61,199,66,160,105,32,250,
+    59,46,175,7,121,90,223,124,218,244,223,166,1,68,164,93,80,9,84,137,233,9,206,12,
+    65,193,89,222,210,85,217,241,31,74,174,80,179,190,4,30,193,165,91,179,25,241,10,184,
+    117,92,46,216,46,115,57,213,219,140,170,107,43,29,188,210,28,149,137,203,37,12,221,42,
+    154,43,232,230,173,153,215,95,200,45,247,114,233,219,115,61,248,184,202,97,215,94,129,46,
+    161,161,157,77,68,192,67,231,254,185,138,210,50,249,13,151,53,214,112,246,191,160,133,69,
+    37,223,202,46,103,179,162,165,214,210,211,39,27,193,211,0,118,61,177,211,5,106,9,195,
+    23,252,10,253,72,174,147,41,54,209,195,34,143,161,235,111,236,228,158,102,197,155,60,91,
+    45,55,97,154,54,203,60,142,55,23,17,83,133,243,77,45,2,54,153,18,189,249,67,156,
+    206,178,124,211,166,75,54,185,105,173,104,239,46,204,153,26,247,179,207,164,149,234,96,236,
+    156,155,193,158,80,175,248,15,202,50,94,44,75,118,98,13,202,12,119,211,32,100,196,4,
+    130,176,128,41,181,183,217,170,12,146,5,40,253,0,102,181,214,34,50,138,159,212,83,174,
+    108,215,104,25,218,118,54,43,142,92,235,144,194,221,238,144,197,137,99,207,21,222,198,121,
+    10,206,134,39,7,135,39,111,124,227,89,161,51,19,43,161,219,1,207,162,233,43,112,190,
+    110,88,5,113,22,48,142,17,104,106,180,206,15,193,23,95,216,69,23,13,173,49,161,217,
+    129,173,27,68,151,176,170,65,171,7,241,117,65,15,190,146,22,125,48,241,30,163,84,93,
+    117,120,74,224,248,68,13,32,18,132,85,82,208,250,172,164,32,78,216,113,184,79,172,38,
+    243,204,156,202,125,40,105,7,91,191,94,227,127,66,143,69,190,149,104,67,94,203,182,156,
+    97,105,120,157,103,11,113,190,182,224,137,129,49,143,210,155,152,16,26,242,2,219,136,105,
+    125,238,177,209,64,20,234,224,166,0,208,80,171,237,55,160,218,182,102,76,83,68,38,98,
+    146,81,232,177,106,4,76,238,213,128,200,106,237,64,17,108,214,10,203,40,103,155,111,184,
+    204,138,4,224,193,218,217,6,91,14,251,191,109,15,56,219,105,219,129,93,91,193,81,213,
+    151,83,188,204,146,180,172,167,245,12,64,26,168,156,49,125,34,74,167,80,17,7,174,178,
+    189,98,153,53,52,55,102,16,31,215,26,59,48,188,197,19,64,0,173,32,120,176,204,179,
+    101,204,100,82,92,132,4,11,204,31,192,80,126,192,223,106,245,216,144,76,253,79,227,124,
+    63,75,227,65,122,51,143,237,138,246,231,74,182,242,1,35,147,121,154,100,34,181,174,73,
+    235,115,125,147,22,112,47,96,103,223,219,240,236,48,216,12,94,132,91,46,27,173,209,162,
+    83,105,25,167,171,197,85,30,177,122,219,225,86,240,188,190,215,155,143,67,254,167,173,3,
+    117,0,36,230,245,38,59,88,252,43,219,73,192,12,198,153,12,68,65,151,31,225,76,241,
+    96,30,225,248,73,141,176,113,60,141,238,217,96,237,16,211,158,170,159,164,40,174,203,123,
+    71,232,105,4,26,230,149,167,98,223,106,78,236,88,10,16,127,51,134,103,125,196,178,75,
+    160,63,145,196,146,93,43,92,174,138,91,50,154,244,192,65,182,93,52,239,4,202,166,162,
+    247,223,160,205,56,3,110,197,58,106,39,62,27,245,214,83,145,150,171,249,124,115,123,251,
+    229,174,111,151,110,176,44,53,238,214,150,146,73,175,228,42,80,235,59,186,144,241,147,4,
+    154,240,59,59,114,40,145,138,170,36,66,28,145,56,47,129,97,103,47,42,146,169,172,223,
+    151,71,183,245,90,198,157,124,198,14,247,209,162,240,55,203,191,117,213,239,174,180,13,144,
+    3,159,152,19,173,146,152,149,195,202,125,154,173,237,174,250,127,124,73,89,85,179,101,52,
+    229,92,185,29,110,41,117,103,17,151,209,124,158,76,71,217,234,230,22,148,125,246,93,86,
+    12,217,105,224,216,254,222,87,234,171,91,85,110,188,248,25,55,255,48,41,132,18,224,64,
+    135,87,108,239,65,234,95,71,112,153,10,70,103,106,78,192,251,66,160,166,169,162,16,25,
+    190,145,162,90,8,199,39,132,77,229,216,32,212,69,176,171,14,168,186,67,53,132,200,83,
+    72,197,37,162,152,85,177,100,133,217,37,98,167,171,155,84,212,116,185,164,181,136,150,173,
+    238,26,141,114,27,152,190,191,120,80,58,189,224,239,51,54,6,73,193,164,239,124,222,86,
+    12,214,233,19,203,4,63,183,234,133,24,168,99,174,115,3,181,119,254,250,245,112,116,121,
+    50,56,30,178,209,106,209,243,109,191,162,138,113,105,197,234,172,3,124,52,60,121,51,121,
+    11,188,186,83,5,185,255,246,252,228,111,151,147,159,206,134,120,4,199,251,25,182,105,255,
+    250,98,248,226,245,151,187,47,6,93,168,2,5,91,91,172,232,155,23,59,1,118,215,144,
+    85,21,23,95,141,50,138,28,244,213,137,72,223,62,113,79,2,81,124,149,205,238,137,119,
+    1,246,229,54,134,61,235,135,132,45,98,190,148,193,224,4,63,201,181,96,195,200,116,244,
+    41,134,99,147,150,55,188,61,236,125,196,13,88,88,48,54,139,219,234,74,50,232,160,1,
+    77,220,35,245,8,209,32,101,161,246,238,78,59,120,209,13,202,28,46,147,17,152,31,74,
+    170,96,191,150,176,210,120,35,238,97,117,39,66,126,247,249,217,218,119,159,235,105,6,250,
+    134,12,120,239,57,159,117,65,164,210,4,196,101,162,67,146,24,0,184,171,11,183,30,213,
+    48,191,96,11,248,26,9,174,19,166,95,205,226,18,117,148,230,27,56,125,52,199,243,217,
+    237,42,125,95,195,48,205,220,66,240,28,162,192,120,37,78,81,31,110,129,176,54,253,244,
+    173,110,47,188,186,47,227,35,156,86,243,154,29,0,68,249,43,2,78,166,91,35,148,243,
+    142,178,151,180,243,236,85,240,162,111,162,20,187,246,39,35,196,105,36,24,125,28,69,36,
+    72,8,210,195,220,127,196,122,30,136,109,200,127,127,223,48,238,207,12,154,233,152,137,125,
+    200,146,28,245,171,214,160,168,99,184,35,60,182,187,236,163,217,91,152,230,211,235,107,188,
+    189,126,76,175,72,55,132,164,163,178,68,99,237,210,22,158,217,67,161,119,90,118,92,220,
+    159,39,172,151,69,176,88,21,101,192,182,200,140,109,172,8,95,160,77,139,109,176,252,158,
+    6,212,46,118,128,116,89,128,32,215,171,72,175,107,53,220,175,184,88,126,212,154,70,62,
+    145,24,82,118,56,189,206,216,134,111,44,88,170,126,163,173,55,0,221,50,32,183,134,205,
+    86,176,245,213,240,175,191,122,225,211,194,215,186,172,244,184,236,8,195,164,223,153,167,121,
+    120,78,178,128,248,7,161,60,67,155,0,211,147,239,146,89,108,73,182,154,29,214,111,36,
+    87,187,170,240,201,128,127,42,220,249,12,63,35,125,132,168,29,23,162,206,243,117,119,150,
+    39,11,118,178,189,179,14,18,75,89,236,83,225,5,105,138,76,41,122,77,242,108,138,37,
+    20,119,144,3,201,39,165,180,106,204,48,58,234,161,123,23,234,58,18,203,205,188,188,30,
+    200,235,217,227,104,185,22,26,125,159,43,209,176,25,143,99,11,143,182,99,42,248,19,117,
+    235,91,9,2,82,73,127,52,172,155,26,13,144,145,164,46,241,198,177,226,51,246,63,167,
+    202,96,50,25,29,238,157,79,152,42,216,65,11,100,90,38,233,42,150,135,102,171,23,23,
+    4,254,194,66,246,14,47,185,108,18,28,40,205,195,188,35,14,69,122,184,201,53,185,121,
+    62,170,161,193,60,71,124,241,69,51,65,85,71,15,28,97,113,229,206,141,194,252,214,84,
+    20,49,22,240,81,234,25,149,62,217,24,23,203,44,101,242,79,236,213,63,14,247,222,28,
+    225,42,61,61,25,158,76,248,14,115,65,91,13,205,42,210,241,198,230,142,230,121,49,240,
+    244,77,36,6,23,54,163,162,228,17,183,5,216,20,64,183,168,56,75,137,179,27,83,74,
+    14,98,56,74,197,233,148,233,2,45,189,2,217,145,205,94,194,157,176,188,141,83,227,130,
+    93,131,168,153,18,13,128,120,21,7,54,163,6,19,85,217,252,142,216,182,137,236,16,194,
+    10,69,27,248,231,82,252,134,71,237,77,156,177,243,100,78,174,102,107,215,161,128,246,113,
+    240,134,181,190,97,205,184,224,158,101,163,235,210,65,15,170,102,209,183,236,148,63,8,193,
+    96,115,191,170,103,204,45,169,97,251,34,138,241,165,99,36,221,1,187,174,28,236,186,146,
+    77,233,99,242,52,65,79,216,122,143,135,155,213,231,250,106,245,15,210,4,106,238,44,5,
+    240,230,26,247,188,181,214,188,38,111,44,195,164,198,153,4,246,149,222,163,221,197,184,71,
+    64,225,180,197,13,35,189,224,2,103,165,133,246,29,225,14,195,109,37,252,79,52,136,30,
+    187,191,15,165,5,86,126,136,50,2,133,63,28,144,152,45,195,130,73,70,251,119,37,32,
+    193,120,181,90,44,173,159,227,105,52,87,184,56,43,18,136,89,82,44,231,209,52,94,48,
+    241,86,81,108,32,160,31,246,146,168,144,229,114,228,8,14,89,36,127,223,168,65,37,64,
+    55,230,125,63,12,202,124,121,27,17,136,56,189,115,126,57,67,145,199,215,240,164,128,241,
+    196,8,56,152,23,191,235,74,135,21,106,157,245,58,123,24,70,217,241,45,200,55,106,145,
+    85,46,35,212,222,106,184,158,44,27,204,172,194,208,234,99,103,106,251,172,208,146,250,26,
+    69,113,43,116,57,74,235,81,114,117,1,158,228,81,58,139,242,89,203,168,176,74,19,38,
+    110,209,60,204,171,156,139,2,126,212,155,206,217,214,214,22,104,67,5,220,161,77,234,185,
+    5,55,178,215,121,116,3,211,191,15,7,30,176,25,115,89,214,250,75,114,205,68,97,112,
+    62,30,170,5,118,60,56,19,51,180,209,218,16,184,131,34,90,44,231,113,190,115,64,17,
+    247,21,220,95,192,86,120,221,194,95,239,194,95,178,4,252,230,254,59,109,25,36,25,188,
+    180,38,81,122,177,55,144,101,32,127,36,97,164,75,85,36,221,197,211,93,5,39,172,208,
+    175,84,1,105,175,97,60,25,158,23,224,119,17,207,37,79,129,134,207,205,179,59,7,109,
+    74,74,55,184,59,191,99,116,234,202,118,189,98,244,102,111,146,29,177,94,71,236,140,101,
+    126,165,245,216,73,57,143,163,89,193,142,187,81,154,198,243,128,213,235,162,134,196,214,221,
+    213,156,59,128,4,17,247,79,243,109,61,109,86,97,208,145,116,106,196,214,128,60,125,101,
+    18,17,230,55,87,159,194,35,85,147,113,61,207,162,146,128,170,249,208,69,222,25,169,96,
+    38,61,39,198,250,38,179,98,80,229,206,139,51,190,131,63,100,116,157,14,202,241,213,117,
+    195,232,145,227,139,123,220,217,237,125,193,180,134,121,213,248,202,239,82,154,42,81,167,27,
+    83,194,143,53,121,189,18,215,12,112,150,38,63,205,233,87,53,36,211,208,123,164,233,156,
+    45,228,182,184,118,182,251,221,13,182,194,173,23,242,186,170,26,161,164,193,228,74,74,69,
+    229,176,92,139,145,24,75,65,45,68,171,89,206,27,14,243,24,119,83,134,70,138,33,206,
+    144,185,186,248,98,170,189,250,102,72,142,126,11,77,218,117,88,240,26,199,193,98,179,188,
+    23,209,95,146,116,58,95,205,226,224,91,69,10,83,119,46,97,83,187,148,61,249,142,97,
+    173,221,27,234,208,42,218,188,104,27,228,251,218,244,86,144,250,145,100,86,82,184,62,62,
+    233,52,41,150,133,129,178,102,65,117,250,134,83,171,220,166,67,205,39,222,207,154,1,234,
+    107,195,62,87,143,0,33,16,68,125,43,244,238,241,47,254,132,175,231,220,16,119,192,57,
+    227,109,252,43,184,116,109,227,127,76,33,18,94,53,10,209,13,21,149,10,213,86,248,165,
+    3,73,166,208,104,21,236,169,213,88,43,160,133,219,59,94,197,222,197,57,19,135,246,146,
+    165,165,125,10,238,172,113,179,192,128,37,250,151,252,211,248,206,143,143,188,235,173,241,100,
+    112,114,48,24,29,180,122,65,171,101,19,249,152,107,120,85,201,189,128,175,184,243,247,95,
+    160,123,53,86,41,169,221,43,116,227,14,125,141,186,242,64,188,92,231,250,220,237,146,125,
+    111,46,15,214,216,147,218,230,27,238,206,215,186,60,95,154,151,230,235,180,103,95,155,75,
+    130,69,207,228,137,206,235,19,9,243,43,255,159,53,201,198,10,242,211,225,104,0,182,147,
+    216,154,213,122,156,143,72,227,68,14,52,115,230,35,25,205,210,10,41,167,89,173,83,174,
+    89,15,215,218,44,227,90,5,154,184,71,158,4,176,134,50,169,63,14,57,103,149,254,71,
+    176,163,117,208,182,41,233,232,245,244,24,172,198,9,223,139,147,14,103,163,23,136,58,82,
+    79,153,190,11,230,45,174,129,121,14,213,122,92,153,114,204,182,147,213,82,251,84,105,159,
+    206,0,60,84,102,1,4,139,136,139,219,177,56,10,43,181,19,44,142,30,133,153,190,167,
+    22,144,134,3,170,97,9,104,203,87,70,66,100,247,2,83,132,11,109,146,238,26,10,132,
+    22,10,56,115,207,80,144,102,177,124,78,36,118,14,5,37,11,36,174,236,166,135,22,228,
+    46,241,126,44,140,34,33,53,21,6,241,187,43,31,115,71,105,193,190,176,134,21,4,41,
+    19,15,159,59,150,215,19,91,190,96,174,115,217,250,88,143,166,182,107,235,106,114,39,163,
+    98,223,134,89,240,11,36,14,129,63,44,129,133,251,120,143,64,216,24,164,17,142,56,199,
+    120,190,30,18,207,73,189,69,42,48,180,209,105,66,196,207,90,82,16,166,239,65,211,208,
+    20,145,254,214,126,208,247,3,58,248,188,80,6,253,70,97,109,47,8,164,77,168,176,50,
+    106,172,170,160,22,163,128,234,187,200,208,196,8,157,176,91,82,246,74,221,22,41,170,109,
+    77,193,245,137,124,167,159,120,163,157,192,106,76,210,226,194,218,196,89,182,83,63,155,57,
+    150,84,222,205,74,24,48,170,42,47,25,2,99,170,190,214,230,215,60,26,212,212,230,71,
+    236,98,181,73,176,53,106,71,249,104,38,195,52,173,85,161,247,225,118,214,165,48,19,83,
+    47,55,202,252,104,39,38,124,47,126,215,179,60,2,245,125,152,26,150,174,101,127,134,9,
+    12,191,249,218,33,74,89,119,217,150,145,39,119,17,92,128,22,166,140,20,27,231,194,103,
+    125,198,43,157,13,184,174,217,7,171,109,17,68,65,131,248,149,174,16,97,48,185,141,3,
+    115,59,99,98,119,9,239,62,217,25,239,54,155,5,211,40,21,200,161,156,109,164,243,123,
+    186,189,38,101,0,14,48,172,205,43,120,223,149,129,155,197,45,195,83,226,11,221,89,0,
+    210,130,129,45,162,212,168,86,222,70,101,240,33,91,205,103,2,57,95,79,12,247,21,248,
+    165,241,121,184,186,247,110,218,33,175,34,42,78,110,147,66,210,202,16,0,41,245,157,47,
+    224,133,26,107,5,45,220,51,184,91,132,151,224,140,54,184,130,13,178,107,129,119,206,195,
+    52,73,171,218,34,99,103,96,184,78,45,177,34,124,153,3,194,160,29,135,55,161,124,79,
+    14,207,123,59,188,95,65,206,159,133,67,121,17,163,221,238,38,46,4,114,118,154,99,196,
+    22,89,176,90,206,34,124,14,247,191,97,150,238,197,108,239,142,71,112,147,155,255,47,168,
+    44,72,24,110,180,1,188,83,52,59,254,95,200,157,65,240,47,159,78,242,16,20,217,42,
+    159,198,18,86,94,133,121,97,57,208,38,106,93,48,40,94,165,139,227,51,239,45,196,155,
+    137,87,226,163,184,52,144,218,128,120,143,241,56,93,64,188,82,231,126,235,120,213,81,117,
+    249,214,247,6,248,232,6,201,92,47,111,253,46,237,91,86,110,189,79,147,20,94,8,104,
+    124,151,134,215,241,188,59,86,185,87,145,229,24,204,213,184,25,188,141,243,184,69,84,79,
+    16,3,108,254,228,13,203,126,182,88,224,45,37,44,16,235,155,100,118,246,149,113,230,143,
+    241,213,155,35,206,16,76,5,231,55,243,6,120,207,188,150,231,128,93,249,102,158,191,98,
+    239,170,107,100,122,15,117,3,23,182,86,188,151,245,245,183,207,132,103,2,25,76,35,172,
+    206,131,247,162,73,225,55,45,30,232,144,164,204,29,122,251,227,69,182,125,73,40,168,33,
+    143,27,69,224,197,7,27,94,156,180,57,60,23,110,129,165,113,118,44,27,145,212,113,252,
+    117,148,62,214,9,23,171,121,153,44,231,247,176,131,71,185,7,70,239,15,29,155,46,166,
+    153,186,125,88,200,125,198,103,219,114,193,157,237,91,85,147,251,160,91,71,126,177,233,145,
+    138,175,91,67,126,233,251,43,168,62,86,215,60,52,95,28,17,50,51,63,141,153,167,71,
+    89,125,91,230,247,190,58,26,174,238,216,194,88,178,195,36,46,183,140,59,125,178,255,161,
+    216,93,230,73,198,54,171,132,75,102,0,223,14,197,163,66,54,21,178,108,39,84,86,98,
+    90,188,27,138,109,139,22,190,96,155,1,83,93,105,209,151,97,128,131,78,203,94,134,129,
+    226,35,40,214,203,229,14,213,65,61,65,230,202,92,16,23,52,54,56,10,216,97,34,26,
+    147,202,68,65,181,195,38,84,6,131,85,163,180,85,222,38,180,22,124,29,106,173,215,55,
+    33,37,154,125,53,58,121,36,105,66,166,14,37,213,168,76,5,183,9,161,165,226,86,163,
+    85,26,108,19,70,107,33,123,145,209,115,93,19,62,247,100,71,109,96,164,78,149,121,139,
+    177,245,85,52,125,255,129,109,95,133,186,157,76,230,108,53,146,16,135,26,15,219,101,200,
+    254,54,17,239,47,181,79,151,65,37,169,38,110,49,109,167,41,27,59,235,87,158,252,58,
+    88,149,217,57,40,89,177,242,166,243,183,17,162,42,6,186,15,171,213,238,216,216,149,24,
+    90,221,77,192,254,1,63,140,237,193,105,217,54,125,233,221,5,79,14,174,0,163,199,12,
+    11,184,70,236,89,0,86,245,235,121,178,28,154,237,181,237,186,224,210,105,21,177,169,217,
+    95,93,41,107,56,68,51,125,30,108,131,145,215,22,224,214,9,199,165,207,2,168,186,45,
+    242,111,181,133,246,53,168,186,197,113,91,116,14,135,254,187,159,186,138,158,237,145,172,14,
+    207,36,208,165,99,84,19,114,196,173,98,88,61,20,184,146,97,110,5,91,188,17,5,199,
+    16,166,110,77,71,218,86,86,71,22,174,71,32,76,30,149,40,192,80,81,143,1,32,232,
+    222,86,59,61,159,201,119,17,140,73,133,66,24,58,142,22,214,249,93,175,239,154,26,65,
+    171,165,131,2,128,74,0,48,163,211,243,55,111,37,8,59,38,198,105,4,238,21,119,231,
+    119,46,62,3,150,163,115,133,102,45,231,173,213,181,207,42,187,134,87,178,149,21,251,149,
+    96,148,112,55,202,228,199,7,50,58,60,153,12,71,103,167,71,24,94,39,120,116,32,35,
+    54,13,227,229,156,81,137,49,221,242,101,54,71,167,83,241,225,241,110,168,87,243,236,74,
+    186,161,22,180,62,122,162,142,134,131,131,227,97,184,152,253,37,90,226,5,196,175,207,167,
+    207,11,108,255,121,98,182,111,184,160,50,177,152,76,57,157,138,204,180,20,38,68,54,210,
+    249,153,8,63,80,116,133,235,216,15,48,217,234,215,56,249,141,29,204,216,17,142,157,28,
+    246,208,49,90,206,41,63,154,19,164,225,20,175,71,224,16,220,253,36,252,244,201,137,159,
+    126,35,176,244,41,70,184,10,249,5,76,59,112,233,210,192,32,150,215,193,26,146,56,213,
+    172,133,234,42,253,53,201,12,245,28,197,151,230,123,152,100,187,27,148,91,236,127,236,255,
+    182,233,91,24,62,40,210,172,64,135,72,190,16,193,117,169,13,15,100,120,37,4,68,229,
+    157,201,200,215,124,29,195,136,171,199,180,252,251,14,216,16,56,228,83,136,221,64,191,237,
+    210,111,187,170,98,9,30,225,140,222,231,140,118,85,184,196,237,186,196,66,214,147,77,6,
+    37,145,45,209,136,201,80,44,117,9,22,137,50,25,179,13,143,59,219,236,67,178,205,62,
+    8,18,250,198,215,45,8,164,38,224,158,107,16,73,53,124,222,1,164,12,245,243,96,23,
+    255,10,158,113,99,53,2,108,99,179,240,113,71,126,84,68,21,48,20,207,85,253,103,162,
+    190,250,188,171,234,46,57,209,108,177,31,69,247,104,74,188,134,216,108,215,192,246,1,251,
+    189,100,69,98,126,192,228,179,127,190,119,184,63,62,59,98,226,142,132,228,235,113,12,65,
+    112,17,36,233,4,44,110,105,121,185,13,215,146,192,73,63,224,101,27,252,102,248,200,87,
+    13,186,99,129,178,223,97,24,6,239,252,17,144,64,52,243,225,242,68,62,90,110,201,8,
+    214,197,133,26,104,136,158,241,76,78,255,187,126,0,91,15,109,239,189,172,189,104,170,189,
+    19,188,99,35,201,248,1,112,144,238,188,103,165,109,246,207,51,100,165,203,247,29,69,207,
+    182,131,113,187,153,158,103,219,138,162,170,250,132,14,61,144,208,190,77,8,55,95,193,170,
+    227,22,181,87,192,91,79,97,160,158,1,19,61,133,78,63,3,142,121,10,196,62,3,230,
+    96,101,219,125,251,217,11,199,65,31,52,124,196,62,117,50,56,50,226,237,61,98,159,122,
+    26,236,159,158,128,71,206,100,172,99,19,200,119,71,242,3,127,0,255,250,232,116,48,233,
+    5,95,110,239,188,236,34,107,98,1,60,59,216,233,5,187,95,190,252,234,69,87,66,65,
+    225,46,47,252,210,40,124,193,11,95,234,194,31,134,251,188,250,203,23,70,33,175,254,242,
+    75,163,144,87,127,137,213,97,181,12,70,189,224,155,175,118,190,129,223,163,225,217,16,232,
+    219,222,122,241,205,87,80,48,30,28,159,29,13,71,151,59,7,188,209,175,161,240,236,148,
+    141,216,184,23,108,73,20,236,239,109,249,247,229,209,233,233,89,47,216,81,191,199,147,209,
+    33,43,216,133,2,246,231,224,228,205,17,84,120,65,127,75,160,47,141,194,215,131,147,94,
+    128,116,158,159,140,15,223,156,12,15,46,247,126,154,12,113,248,182,141,226,241,219,211,17,
+    31,214,93,193,4,122,10,224,193,151,24,125,24,246,94,112,178,90,92,241,11,243,205,77,
+    28,114,25,143,128,31,245,144,114,28,117,179,124,87,150,191,52,203,95,136,242,151,10,207,
+    15,49,108,107,18,207,203,47,205,114,137,231,229,75,179,92,226,249,234,107,89,46,78,91,
+    78,143,172,199,108,186,115,91,61,80,149,248,27,240,46,47,218,238,145,119,225,162,108,7,
+    193,182,95,210,178,93,14,103,22,126,201,11,119,119,104,33,35,251,53,120,134,138,82,135,
+    186,215,135,71,108,57,73,170,24,103,169,254,156,196,17,91,170,229,235,100,94,242,241,7,
+    182,83,193,32,208,165,156,124,251,230,235,23,86,197,227,4,14,72,46,150,111,190,254,210,
+    196,82,13,248,210,139,210,211,246,87,62,140,20,206,233,247,143,163,193,217,217,225,201,27,
+    217,243,221,221,173,175,182,37,150,125,112,54,158,100,195,217,77,252,99,206,20,204,36,189,
+    193,233,222,125,249,66,13,207,113,2,15,151,227,217,8,141,147,20,12,151,163,4,51,63,
+    59,100,140,15,15,20,75,108,111,233,193,223,139,166,239,199,76,170,119,65,46,239,179,83,
+    6,88,59,175,153,142,92,114,64,53,17,175,161,12,32,41,32,152,113,112,193,108,111,237,
+    238,168,49,204,16,44,112,48,162,97,21,170,116,131,15,112,175,199,14,78,179,236,123,135,
+    212,131,225,217,228,237,229,235,243,147,125,194,195,122,130,238,226,252,32,94,150,183,156,239,
+    118,213,132,176,51,19,41,87,76,50,252,231,42,154,147,15,95,210,10,246,71,197,7,111,
+    80,169,205,237,239,95,233,62,150,246,183,175,27,234,170,145,28,204,63,68,247,156,86,167,
+    239,123,71,195,147,131,203,225,223,207,241,112,164,120,102,231,43,45,142,6,179,25,160,6,
+    61,166,43,190,169,166,199,171,43,204,141,98,3,124,163,185,4,34,131,196,54,92,5,29,
+    116,14,182,36,138,159,227,60,19,222,240,192,34,178,248,52,141,117,233,87,47,53,73,249,
+    148,132,61,226,31,191,33,149,142,147,116,85,120,128,190,218,34,24,6,96,194,164,31,183,
+    61,24,28,32,197,52,7,69,233,124,220,181,49,248,128,94,16,12,14,129,95,122,48,56,
+    64,47,237,94,140,35,38,188,25,127,112,32,174,135,194,229,250,117,6,151,210,108,173,20,
+    24,128,28,162,52,232,8,48,87,247,12,38,143,227,240,151,34,184,143,75,190,71,237,224,
+    64,74,85,130,137,255,163,211,81,87,126,130,225,99,155,193,229,241,225,201,249,248,178,10,
+    104,155,212,31,28,157,189,29,232,79,59,213,245,189,123,41,147,48,63,43,9,211,26,239,
+    15,142,6,163,150,80,0,90,160,137,180,196,238,15,63,118,91,98,231,135,31,47,90,98,
+    219,111,129,190,67,127,0,216,55,242,7,128,109,191,36,109,147,247,243,188,213,179,211,241,
+    161,8,217,43,131,251,225,107,139,147,211,209,49,134,29,230,166,49,44,155,12,255,177,127,
+    122,58,58,184,100,227,212,90,221,25,101,178,8,4,216,44,94,230,241,148,205,215,140,0,
+    52,125,191,220,70,136,29,196,138,67,134,205,232,215,159,88,70,138,28,76,8,80,243,253,
+    199,33,15,216,10,56,138,247,73,250,99,12,55,104,136,155,127,178,202,29,4,127,69,101,
+    77,213,71,55,76,172,142,31,140,82,187,174,154,128,179,1,147,211,103,163,211,179,225,104,
+    114,168,102,161,0,195,31,32,80,239,62,209,17,112,46,108,50,230,212,176,115,186,44,7,
+    81,20,231,169,252,242,33,22,62,136,173,69,150,47,111,185,217,255,48,189,102,7,139,116,
+    26,171,176,202,64,135,105,80,226,84,144,115,95,207,54,77,148,241,120,145,101,144,147,135,
+    245,236,71,244,198,8,166,171,162,204,22,129,97,210,169,180,63,224,71,235,116,9,183,238,
+    193,90,255,177,70,255,38,14,172,19,38,132,223,135,217,178,76,22,201,111,113,187,3,94,
+    52,173,82,100,31,224,14,37,216,190,180,120,153,231,219,57,30,128,187,143,105,120,85,232,
+    152,202,206,120,96,151,12,210,132,3,80,153,240,46,179,13,155,177,193,29,248,153,8,154,
+    177,252,81,93,31,199,113,117,247,129,0,112,102,153,197,101,148,160,3,143,60,138,56,36,
+    115,165,11,15,35,147,225,153,7,224,32,41,166,236,36,72,245,100,38,195,152,180,184,28,
+    158,12,216,254,38,249,117,231,107,208,40,91,251,231,71,76,73,29,236,15,145,251,118,190,
+    1,205,167,197,85,17,86,103,130,165,187,91,47,152,88,108,225,230,40,10,190,6,176,241,
+    254,225,120,204,22,185,6,220,249,26,84,231,22,99,202,159,222,156,158,92,158,190,126,61,
+    30,78,64,7,62,18,223,191,1,133,185,197,207,81,92,244,94,78,78,153,120,253,97,56,
+    26,188,25,82,238,230,31,143,79,181,254,118,122,54,248,251,57,99,235,22,255,131,71,34,
+    31,140,255,6,209,199,217,63,248,27,105,84,180,234,168,121,231,147,195,163,195,201,79,1,
+    108,237,92,197,48,131,250,139,144,2,231,163,35,145,219,12,179,56,8,131,5,230,209,96,
+    204,151,204,2,6,240,196,76,73,5,105,216,62,163,25,169,126,255,29,203,48,75,21,100,
+    231,17,199,114,97,0,103,184,6,87,172,45,136,195,192,144,201,4,128,93,105,179,237,110,
+    110,202,6,54,255,167,141,165,223,247,58,223,255,247,230,127,111,110,38,97,201,148,116,145,
+    249,77,99,102,63,37,106,8,53,198,208,30,106,20,16,225,169,23,62,237,134,79,255,207,
+    26,245,247,230,217,21,237,227,230,255,128,153,184,183,94,229,81,60,71,215,60,129,64,69,
+    225,96,3,249,76,194,61,88,33,22,254,44,171,181,136,73,251,92,222,176,216,225,18,184,
+    245,86,164,28,84,158,234,102,96,4,237,208,238,115,179,19,110,237,184,83,65,228,194,215,
+    248,31,250,133,203,235,46,30,208,16,254,195,98,245,42,76,168,7,27,234,33,153,44,48,
+    220,201,175,163,121,193,189,208,103,160,51,79,216,232,19,207,244,130,157,53,156,51,10,137,
+    101,65,153,187,41,121,134,245,73,38,150,144,255,66,40,26,189,18,152,30,174,162,122,161,
+    164,38,17,215,153,160,140,100,26,139,86,17,200,108,30,161,25,68,40,21,49,75,20,118,
+    26,180,221,8,187,99,17,118,193,171,190,171,186,207,226,8,67,213,44,4,226,25,210,148,
+    114,13,0,36,118,117,61,164,38,196,219,9,249,217,138,75,67,121,95,120,39,10,135,67,
+    126,165,176,123,240,187,178,164,32,139,137,159,220,8,255,70,56,169,61,136,38,13,52,176,
+    99,115,135,48,212,49,30,224,66,203,102,121,254,66,101,8,89,36,141,217,151,147,13,93,
+    36,83,141,19,32,202,120,238,201,162,226,178,141,74,67,171,2,10,65,193,15,149,243,36,
+    98,56,233,106,190,228,125,141,25,129,14,33,248,156,240,89,18,113,192,240,14,70,224,236,
+    6,16,156,217,34,175,83,51,67,127,166,116,66,213,238,57,119,142,84,25,41,44,158,176,
+    103,93,58,41,26,160,104,115,250,22,103,159,107,138,223,61,4,4,173,5,71,17,171,8,
+    57,172,134,10,48,229,176,204,108,118,172,181,208,162,77,60,37,69,43,93,93,153,222,37,
+    221,70,5,86,148,183,113,112,5,5,226,172,111,125,231,17,132,244,215,39,85,14,171,162,
+    185,122,143,85,195,231,86,212,16,217,20,52,159,114,175,91,121,102,114,88,218,67,57,119,
+    191,181,16,240,195,85,101,117,213,49,237,187,139,181,29,244,95,124,97,215,233,4,58,184,
+    250,3,9,243,231,171,250,153,91,153,248,153,226,189,4,173,34,211,103,144,79,188,30,201,
+    171,241,231,140,191,29,131,74,164,10,164,135,28,12,158,94,55,84,244,65,155,50,11,32,
+    130,64,30,174,130,4,60,237,133,122,197,93,102,132,149,33,95,172,230,17,251,44,17,4,
+    232,126,44,113,235,210,128,81,193,207,96,112,249,210,54,199,15,98,35,208,106,226,205,186,
+    85,113,219,173,184,93,91,49,12,67,249,147,7,120,133,179,0,238,173,25,59,252,176,46,
+    229,66,179,122,28,241,128,193,36,191,138,90,7,114,187,130,60,8,142,198,234,49,213,136,
+    113,59,219,237,153,84,134,39,122,96,231,92,40,42,81,13,144,147,112,27,231,113,72,92,
+    62,154,214,31,113,150,219,23,15,9,192,38,4,71,176,108,142,24,51,76,156,198,120,93,
+    74,30,253,120,84,178,193,128,132,58,67,167,123,75,230,181,3,18,83,207,166,232,157,126,
+    232,105,163,147,241,47,13,54,238,63,113,9,240,135,88,83,185,23,250,78,64,183,95,248,
+    90,251,5,157,243,157,102,167,217,42,45,251,12,232,91,6,1,255,26,110,250,30,58,139,
+    184,252,199,79,63,183,101,218,187,95,186,242,47,23,148,245,253,31,109,134,178,3,247,210,
+    50,55,132,42,172,175,248,147,175,226,79,107,84,252,217,87,145,23,138,122,182,135,161,149,
+    62,214,55,211,107,140,184,64,102,10,69,249,144,215,65,217,113,194,202,59,210,150,62,177,
+    141,109,86,106,161,155,39,248,116,105,255,101,110,139,83,109,244,221,165,81,177,179,208,71,
+    210,22,146,71,112,185,64,174,121,220,66,213,200,225,169,220,216,124,163,205,63,214,115,183,
+    221,96,3,111,219,224,149,156,109,3,82,190,230,223,60,92,237,169,244,147,91,233,167,198,
+    74,63,187,149,30,195,205,238,124,54,142,46,229,100,177,135,11,62,182,145,57,169,6,170,
+    118,87,213,38,34,29,184,139,8,60,22,141,149,211,127,82,181,46,42,113,41,254,161,148,
+    247,107,79,71,112,250,126,192,23,94,238,153,71,127,59,112,79,60,194,101,217,208,96,1,
+    180,43,43,72,70,195,215,99,30,232,14,77,160,129,53,66,97,159,173,88,158,126,229,201,
+    170,219,240,236,10,137,241,26,127,165,95,136,133,143,168,184,122,146,153,68,146,167,28,54,
+    57,120,20,127,46,169,229,225,208,11,182,125,223,198,211,247,252,177,161,0,22,121,126,96,
+    213,23,168,76,165,60,90,72,104,143,131,192,205,116,80,39,119,8,5,48,240,117,60,154,
+    34,255,242,170,166,90,159,102,245,168,26,26,49,166,220,137,93,215,149,197,149,131,123,144,
+    240,36,98,249,61,201,88,89,171,3,83,188,149,47,231,170,155,185,160,104,244,147,186,196,
+    244,52,125,228,209,87,24,39,61,67,206,233,12,245,233,56,69,242,91,222,163,175,90,56,
+    73,161,130,105,227,117,46,219,73,186,193,149,97,25,136,32,208,70,194,70,30,87,194,149,
+    250,101,133,200,213,231,58,234,162,148,20,220,226,33,145,19,41,199,218,49,98,216,246,93,
+    218,204,186,54,97,194,61,243,125,124,207,86,123,20,116,36,11,0,153,198,183,43,253,77,
+    89,51,125,199,80,200,128,154,164,65,100,218,59,34,153,101,21,187,47,127,120,16,209,126,
+    203,195,160,213,33,92,57,213,3,77,58,112,181,22,197,148,105,163,122,86,149,125,73,116,
+    79,146,143,236,7,227,185,253,136,73,148,153,180,89,180,131,41,252,238,130,33,85,7,103,
+    23,45,251,169,197,10,205,135,76,4,155,73,120,251,136,239,114,47,135,15,73,40,120,139,
+    36,213,95,5,137,1,88,156,142,203,55,243,254,142,239,103,139,43,16,176,206,0,136,221,
+    48,209,235,227,79,237,62,229,39,221,116,87,118,14,206,142,111,40,69,118,239,229,230,253,
+    200,238,31,195,107,207,179,168,40,170,250,127,223,213,198,185,127,199,72,168,240,208,176,43,
+    184,157,191,135,221,203,28,45,77,94,215,97,154,79,31,169,10,37,93,107,106,116,217,43,
+    245,50,41,240,118,111,30,71,119,241,204,170,109,14,6,104,210,84,119,23,186,181,252,158,
+    148,241,2,188,177,13,16,89,168,77,52,34,12,153,6,225,10,128,206,56,196,219,121,170,
+    241,137,189,196,155,4,85,168,247,207,48,49,158,220,209,68,0,50,174,205,68,150,202,158,
+    200,179,9,231,102,217,200,119,224,102,221,9,84,213,103,193,182,91,253,167,186,234,187,102,
+    245,29,183,250,207,117,213,95,152,213,119,221,234,63,182,117,246,191,7,59,80,188,215,248,
+    42,66,181,117,85,67,93,127,52,244,142,195,96,100,146,117,84,1,170,67,239,131,110,87,
+    192,123,199,15,49,220,175,7,87,171,100,62,99,219,24,92,133,207,99,158,231,4,3,163,
+    226,186,213,33,159,192,148,35,30,110,199,100,65,132,136,117,132,173,23,252,161,32,195,29,
+    205,231,116,77,131,75,1,24,175,10,56,69,234,109,124,211,58,5,108,66,184,8,196,7,
+    174,113,24,233,225,150,113,119,128,177,187,194,224,148,161,200,63,48,249,43,86,91,193,183,
+    161,208,177,148,19,243,183,146,230,223,61,16,130,158,24,209,29,246,50,166,70,69,233,131,
+    125,78,72,10,143,232,114,37,21,143,133,163,7,68,108,197,223,34,95,58,251,37,154,131,
+    36,240,22,77,234,193,212,190,173,64,89,97,133,157,212,128,216,18,58,28,77,49,108,182,
+    190,165,20,46,251,46,172,65,47,216,150,17,32,236,126,212,72,217,37,201,172,66,123,97,
+    74,91,66,27,76,47,170,19,58,95,5,22,217,212,57,85,215,236,149,206,47,98,105,131,
+    132,6,170,82,86,36,248,240,12,22,157,18,35,17,139,59,33,212,104,83,108,81,45,205,
+    52,150,123,155,241,219,70,44,100,85,86,17,127,223,101,229,11,6,253,174,171,237,239,191,
+    160,62,231,35,226,161,78,175,219,124,138,126,64,193,217,96,52,30,142,44,119,9,248,114,
+    134,129,239,100,122,162,152,94,31,47,75,122,151,107,39,1,210,247,172,248,37,166,55,180,
+    177,231,54,22,161,36,206,87,10,187,248,206,207,186,115,158,171,135,223,44,242,221,89,229,
+    250,131,31,34,62,29,208,61,138,111,146,2,150,120,71,121,61,24,87,109,88,27,125,137,
+    121,125,197,3,251,2,17,191,65,193,111,82,78,42,233,83,84,1,81,225,66,97,36,144,
+    120,181,237,201,211,62,161,95,68,90,44,49,6,225,34,74,163,155,88,188,255,117,241,128,
+    181,108,63,207,138,226,20,109,230,86,229,169,254,66,83,20,66,238,59,15,25,175,85,113,
+    35,13,26,3,16,48,138,139,37,131,195,228,27,236,248,138,27,30,207,121,210,50,223,222,
+    113,134,34,143,216,48,180,162,249,122,45,75,1,49,99,177,20,243,90,213,231,114,122,34,
+    174,17,226,136,187,87,9,38,113,185,35,204,227,69,118,23,15,230,115,205,20,199,81,254,
+    158,239,101,112,145,203,54,198,148,73,48,182,115,177,109,19,76,35,41,111,15,214,113,124,
+    125,157,76,33,13,26,143,5,169,166,157,33,128,124,238,26,229,107,17,239,40,128,151,139,
+    224,16,14,193,111,32,16,192,28,253,181,120,53,200,187,0,12,163,114,214,48,29,189,29,
+    92,224,130,109,97,224,26,30,74,187,165,158,117,137,223,60,154,77,11,0,223,249,242,216,
+    204,8,66,67,188,35,82,88,89,20,34,20,165,66,222,81,80,120,153,132,31,47,120,126,
+    34,94,200,0,183,232,77,159,122,116,102,35,38,95,76,228,188,3,14,188,44,38,146,151,
+    115,65,91,198,241,225,212,200,120,62,24,89,75,54,209,21,153,140,101,158,23,134,173,156,
+    222,182,53,255,56,137,95,96,222,139,143,154,248,80,232,21,94,94,150,220,96,176,51,225,
+    94,104,68,124,87,28,28,98,203,122,148,112,6,222,39,169,3,7,133,22,156,176,167,153,
+    112,162,15,122,36,37,228,40,102,203,17,13,105,70,74,48,248,116,94,168,66,206,197,39,
+    89,9,226,81,70,6,3,26,3,237,122,18,224,14,30,193,6,251,225,54,6,69,14,98,
+    160,129,37,49,216,131,219,204,12,88,131,35,146,94,47,60,191,38,142,56,244,163,21,64,
+    136,248,18,34,63,73,154,202,44,128,241,11,174,32,124,91,104,232,52,202,95,151,111,163,
+    240,83,101,186,148,99,165,182,83,13,252,45,129,164,229,150,230,131,148,20,4,213,5,129,
+    229,177,236,203,162,95,99,250,229,16,13,230,66,57,247,23,2,92,152,5,217,201,15,135,
+    204,159,228,10,68,20,159,78,80,238,219,160,72,23,183,16,89,173,3,209,219,242,120,85,
+    112,7,122,165,202,115,102,66,75,22,222,45,179,13,41,46,195,96,146,113,100,209,93,150,
+    204,64,13,135,185,93,100,40,169,192,153,139,17,160,205,240,252,192,160,52,124,48,38,138,
+    243,32,71,66,230,140,7,239,18,190,94,60,156,94,193,40,155,103,31,66,132,229,21,134,
+    191,226,43,226,94,176,31,23,201,106,113,156,204,223,79,242,21,147,140,252,117,49,143,43,
+    199,123,83,4,159,255,120,27,199,243,207,3,206,198,38,31,64,239,8,31,192,79,197,7,
+    114,124,213,52,104,224,111,9,36,45,183,248,64,96,32,184,46,8,48,213,7,197,119,92,
+    106,85,119,120,202,150,173,151,221,133,89,177,210,197,109,163,169,154,90,179,158,79,91,214,
+    221,81,61,170,103,207,116,144,40,107,205,35,68,243,154,151,181,163,96,204,22,13,235,7,
+    178,16,155,50,248,87,175,122,104,183,85,112,164,138,129,148,199,129,88,250,20,3,27,63,
+    148,58,112,177,1,203,49,124,178,97,15,63,20,87,94,161,74,217,104,119,153,45,56,218,
+    140,17,120,239,193,90,126,166,80,53,228,167,89,208,119,128,133,68,149,127,58,59,208,40,
+    254,231,42,46,74,178,9,93,39,112,107,163,146,216,177,165,123,159,78,209,251,108,85,204,
+    239,187,124,85,10,181,53,52,78,200,220,41,249,1,93,225,140,15,41,62,251,124,224,71,
+    110,243,152,44,162,79,127,203,229,243,119,15,117,219,154,145,92,207,84,213,224,123,55,144,
+    145,219,213,70,135,10,215,223,98,0,70,255,188,103,65,171,135,174,63,50,110,55,15,119,
+    71,112,18,61,141,53,215,214,24,200,245,220,103,180,138,156,233,130,141,203,244,86,144,162,
+    231,127,26,49,198,19,170,84,79,134,1,177,219,3,93,113,12,32,109,217,5,113,97,174,
+    157,179,36,38,228,223,90,68,39,12,162,25,15,48,68,61,30,96,203,102,60,242,214,191,
+    30,215,64,64,53,227,35,9,19,107,49,238,41,184,117,113,174,131,111,141,113,19,166,171,
+    134,177,83,126,219,77,248,100,26,160,90,116,42,210,123,19,54,144,68,13,108,246,30,142,
+    102,141,179,170,212,253,250,105,149,96,205,24,197,129,161,22,221,62,194,212,225,18,158,246,
+    2,139,155,119,248,156,100,128,238,161,19,174,12,141,162,205,164,100,133,71,179,153,94,225,
+    93,99,85,59,54,80,253,177,90,134,130,129,210,56,249,100,215,150,92,69,114,62,69,162,
+    218,114,147,91,37,133,244,92,95,124,38,113,225,10,80,42,57,103,38,164,45,22,201,176,
+    218,34,209,62,241,137,36,123,28,135,58,127,205,172,227,194,133,20,208,2,55,58,115,163,
+    144,10,190,15,90,49,83,212,225,185,27,248,117,191,163,135,51,139,76,35,151,1,52,1,
+    241,23,173,131,233,181,181,79,52,164,112,53,118,22,149,202,83,254,105,51,19,135,54,199,
+    162,154,149,146,186,13,25,152,73,233,211,205,92,85,60,130,173,56,211,112,230,250,142,115,
+    87,81,183,45,91,92,214,200,102,142,77,193,229,181,194,141,6,100,30,7,69,38,138,102,
+    103,97,76,246,222,236,42,204,227,41,33,180,233,38,44,227,163,73,131,136,105,11,161,242,
+    67,66,114,95,95,199,230,241,30,100,8,135,33,172,133,61,147,87,246,162,174,96,163,240,
+    138,177,149,12,42,181,46,251,43,214,147,3,36,60,177,68,195,14,179,249,210,123,20,30,
+    147,141,229,75,33,8,175,77,89,251,103,189,88,224,251,117,241,156,157,234,158,243,191,159,
+    223,177,141,190,240,234,148,28,224,176,90,179,68,222,229,219,123,61,227,106,53,192,100,87,
+    210,2,101,90,94,204,15,106,90,231,22,180,95,24,181,148,161,100,110,100,121,215,166,75,
+    45,72,21,214,16,249,224,139,47,236,18,124,254,103,218,53,197,204,185,219,161,235,189,3,
+    91,162,133,144,233,196,162,136,179,94,82,152,15,227,149,255,142,180,4,28,94,195,11,213,
+    34,78,203,110,240,230,104,15,147,170,71,236,212,147,115,239,113,140,180,62,19,129,221,65,
+    78,93,39,121,81,138,38,66,183,159,171,60,177,14,160,170,211,226,140,205,62,110,217,190,
+    62,146,173,85,122,102,203,188,127,97,167,23,222,59,60,25,140,126,186,196,107,134,119,225,
+    85,54,51,54,121,140,192,165,172,254,212,228,220,183,30,233,213,228,224,134,88,111,120,37,
+    32,105,229,211,141,140,213,54,94,125,26,189,87,119,24,33,127,7,218,213,248,212,152,116,
+    253,25,113,161,181,118,195,148,191,142,24,155,225,124,0,29,114,170,63,55,57,1,38,129,
+    49,194,231,97,75,11,152,166,140,213,255,31,45,127,149,83,253,15,19,1,152,130,253,149,
+    63,53,123,133,40,128,79,126,113,0,95,148,72,208,24,222,81,222,114,182,31,157,62,222,
+    72,29,15,179,37,230,176,50,127,188,177,243,93,221,151,218,58,101,225,209,159,192,162,222,
+    167,85,78,121,112,110,95,21,241,73,85,17,61,16,43,92,248,110,104,192,46,197,247,140,
+    210,243,159,225,47,227,5,154,195,80,242,107,13,59,121,189,43,126,39,143,227,189,238,51,
+    205,156,39,79,201,38,223,25,4,81,174,115,20,235,202,139,41,188,35,17,104,108,14,37,
+    110,251,102,75,196,19,128,212,37,28,237,74,109,10,87,136,11,53,175,89,12,118,17,112,
+    18,141,131,120,177,44,239,245,219,1,136,90,148,76,111,131,69,132,217,71,208,174,12,33,
+    140,226,233,28,34,182,228,171,180,76,22,177,64,145,164,240,212,138,135,77,224,41,79,200,
+    141,59,227,17,17,20,105,17,68,108,67,3,67,161,200,155,193,211,132,28,228,209,52,19,
+    152,224,94,140,9,93,216,57,244,173,112,39,164,94,53,50,129,141,218,46,132,46,165,197,
+    5,81,85,235,70,205,111,40,116,177,9,189,174,70,46,160,149,164,91,213,78,71,45,47,
+    226,223,91,217,12,6,191,237,88,239,0,61,243,249,167,82,207,219,144,126,25,78,103,254,
+    240,134,120,140,15,239,160,53,104,208,116,214,43,197,176,248,76,101,49,221,91,140,189,97,
+    75,26,246,45,231,57,59,248,207,133,209,15,84,216,244,81,6,110,189,103,3,225,83,231,
+    13,88,103,86,7,182,207,82,166,200,77,4,30,177,28,94,51,25,196,99,24,42,74,152,
+    106,183,219,101,156,196,163,70,223,151,220,99,255,5,119,38,83,191,183,119,66,73,139,1,
+    250,138,144,22,66,32,193,241,229,217,112,116,57,60,26,30,51,210,12,167,65,89,193,168,
+    175,253,255,252,123,148,177,4,60,59,148,172,48,150,33,99,221,205,185,98,21,189,11,117,
+    189,254,19,227,93,18,58,203,153,109,211,15,175,200,99,94,229,235,40,119,114,235,77,150,
+    136,79,37,118,111,161,129,39,122,43,129,91,8,60,242,115,250,19,110,174,135,49,9,10,
+    156,157,20,187,135,215,84,66,191,214,189,5,117,90,255,130,5,172,199,217,72,33,148,92,
+    237,107,123,121,203,217,201,208,114,94,49,76,210,176,94,201,93,125,210,10,207,9,4,251,
+    31,177,40,145,198,141,28,164,159,65,5,227,169,166,188,202,185,6,145,37,135,236,154,117,
+    170,85,208,49,227,23,53,27,210,197,20,157,75,20,19,210,37,170,218,227,177,87,202,24,
+    28,76,84,140,103,188,16,62,220,219,60,220,27,96,208,176,68,60,82,145,12,90,116,113,
+    178,244,240,51,186,175,12,103,22,103,32,149,35,38,153,150,77,147,225,59,36,235,174,30,
+    40,52,49,233,129,234,226,208,152,247,108,22,123,213,19,66,92,67,147,43,234,23,74,214,
+    144,73,88,55,112,28,69,173,7,36,228,116,167,148,4,190,185,168,57,172,154,18,147,121,
+    252,126,191,246,107,182,230,233,237,26,170,232,122,109,52,143,101,179,111,173,103,160,228,90,
+    255,67,213,89,190,151,61,39,90,237,99,119,111,99,207,57,148,78,145,206,214,19,242,128,
+    115,122,37,235,241,182,43,213,238,58,214,46,239,221,132,44,17,175,241,215,169,11,30,193,
+    111,225,249,65,6,21,175,81,6,108,44,79,116,182,96,128,211,164,152,44,39,202,219,230,
+    182,190,13,222,145,78,63,188,202,136,205,141,178,161,78,223,162,64,117,162,154,231,89,203,
+    59,102,203,50,50,253,26,13,155,242,215,210,92,173,165,12,49,122,208,151,99,145,205,146,
+    235,123,208,184,65,52,171,103,243,228,228,221,149,155,24,193,248,33,42,32,22,27,94,237,
+    139,181,130,86,235,223,226,60,83,226,212,90,134,224,230,103,116,120,224,125,60,224,164,59,
+    246,155,143,141,73,109,122,105,135,149,133,223,135,81,145,184,39,123,233,253,135,184,212,234,
+    26,83,8,181,200,176,235,119,210,222,199,8,30,180,63,173,131,150,191,93,168,68,189,235,
+    71,253,243,122,168,119,234,80,191,240,163,254,113,61,212,187,117,168,191,100,168,215,177,119,
+    158,167,58,192,167,214,101,83,209,114,96,73,113,253,84,145,186,96,152,246,13,83,115,251,
+    163,108,23,101,30,199,149,194,254,47,226,146,216,111,176,16,31,27,237,21,226,18,185,217,
+    12,33,51,13,153,119,54,164,149,143,48,66,212,91,88,197,21,141,229,149,236,186,24,43,
+    99,6,4,179,123,197,68,69,58,203,62,132,240,131,137,106,241,235,67,124,245,62,41,89,
+    153,78,231,192,81,112,195,7,42,254,114,60,47,204,110,189,179,171,24,241,188,52,154,208,
+    117,28,151,14,147,104,96,208,38,0,7,143,97,150,62,30,191,102,27,36,43,56,31,13,
+    47,15,14,198,232,59,47,188,73,184,165,66,208,155,44,162,27,66,237,218,232,66,129,230,
+    157,107,8,168,109,0,55,7,163,170,217,193,243,209,161,78,52,186,202,19,57,131,242,145,
+    0,159,30,237,252,143,99,33,192,27,45,33,144,117,2,13,213,9,190,148,70,210,240,21,
+    57,183,229,80,197,46,129,155,136,236,142,233,207,179,144,244,138,147,231,191,206,53,109,2,
+    46,77,181,135,121,226,85,103,244,84,157,243,184,186,1,113,13,249,238,12,33,14,219,1,
+    181,252,194,174,252,47,225,159,32,90,95,36,11,244,87,15,30,164,188,163,221,96,45,136,
+    244,47,170,197,54,111,66,0,139,213,174,234,88,198,123,143,33,67,221,153,232,118,60,221,
+    38,31,173,153,145,2,2,240,96,15,148,225,66,221,111,137,240,223,252,254,227,45,134,90,
+    205,11,126,208,35,120,137,43,227,103,178,174,26,98,125,87,246,72,174,231,91,198,247,146,
+    1,226,181,87,203,108,86,112,138,57,134,94,224,10,31,247,169,221,99,238,131,170,47,132,
+    212,160,172,119,25,36,241,58,23,53,238,52,150,42,111,156,154,68,120,164,0,1,43,212,
+    4,114,7,218,105,150,94,39,55,0,43,38,56,164,239,124,9,191,59,185,251,128,71,243,
+    248,46,123,79,121,212,153,103,225,126,35,112,67,54,188,159,12,41,97,136,76,180,166,128,
+    63,175,45,36,100,125,17,59,198,2,215,54,52,238,211,155,23,82,196,169,223,58,240,34,
+    1,3,113,38,0,76,41,40,62,191,35,130,94,117,129,73,38,158,144,64,157,123,68,2,
+    134,11,137,140,128,32,6,55,223,66,223,64,152,164,141,8,21,136,131,208,77,148,96,32,
+    255,144,71,203,177,66,172,82,38,104,212,28,128,160,53,211,29,56,200,38,77,200,38,117,
+    200,200,50,162,73,36,125,10,213,192,112,108,17,177,37,193,201,95,242,118,153,241,40,102,
+    201,93,172,211,178,19,19,142,233,253,194,121,244,65,1,242,20,214,126,191,43,222,0,132,
+    183,248,56,221,171,86,217,226,29,241,170,91,38,109,93,74,72,215,171,139,213,221,34,74,
+    31,67,187,102,179,176,48,201,184,160,100,160,55,75,211,204,253,169,113,45,101,14,121,239,
+    204,200,175,141,106,177,116,213,108,214,139,73,146,116,207,76,125,154,102,108,188,75,180,92,
+    25,212,3,25,209,146,125,131,167,6,226,194,34,134,60,187,17,229,210,18,75,203,206,100,
+    134,119,242,20,71,124,50,244,95,210,124,181,2,44,174,71,172,155,48,23,159,227,158,113,
+    60,96,114,238,112,112,52,190,60,219,27,93,142,207,134,251,231,71,131,17,73,163,72,148,
+    99,148,219,55,10,153,241,146,243,99,16,247,41,171,79,184,163,24,193,143,30,109,228,107,
+    219,152,9,227,94,74,92,70,209,202,72,218,140,15,178,187,174,9,166,174,228,24,235,226,
+    238,241,35,120,126,114,116,56,177,198,235,253,98,245,232,1,19,120,124,195,67,209,61,126,
+    124,140,218,159,60,64,74,175,49,165,205,99,108,173,245,199,111,140,165,61,79,166,207,85,
+    12,109,29,234,219,51,54,213,97,188,181,118,34,81,142,36,70,107,129,45,175,242,99,7,
+    132,168,32,230,48,133,60,75,58,181,79,99,146,148,118,176,29,110,117,213,255,19,115,97,
+    213,205,150,209,52,41,193,134,206,64,136,34,230,132,218,178,200,193,232,38,36,23,11,137,
+    184,101,196,246,104,172,40,44,46,190,46,133,112,228,147,183,3,136,79,28,122,42,251,32,
+    130,102,236,26,65,202,228,35,168,74,66,228,30,92,97,31,55,185,87,156,43,140,221,219,
+    101,220,214,34,90,182,186,107,52,26,74,111,100,67,77,182,58,168,194,185,123,7,84,150,
+    136,137,48,123,241,125,115,133,30,159,122,183,217,156,178,167,131,69,125,93,187,93,187,70,
+    207,226,185,106,74,85,73,195,84,17,235,141,124,161,183,62,210,80,189,11,250,216,57,151,
+    211,116,140,147,111,41,106,157,79,192,172,70,174,10,179,39,236,34,21,40,179,108,117,5,
+    25,105,103,228,106,186,66,205,11,11,126,71,46,178,50,169,138,166,37,136,103,188,207,102,
+    177,37,185,116,57,19,87,36,175,70,200,19,105,16,247,24,141,128,209,67,33,49,159,70,
+    21,113,36,109,1,125,52,103,236,5,181,85,236,3,103,53,29,144,232,131,68,243,51,145,
+    98,53,200,147,224,235,255,254,170,204,174,175,221,5,81,1,215,11,182,194,47,27,167,144,
+    95,40,250,249,159,164,141,159,72,47,97,189,15,237,69,69,50,85,234,171,229,180,243,56,
+    62,84,153,207,91,221,106,226,108,145,102,13,29,135,197,228,229,198,158,37,146,55,182,33,
+    110,204,182,97,29,170,110,9,51,32,85,9,131,234,118,225,30,162,17,109,183,177,221,230,
+    117,151,77,167,243,21,232,57,255,225,121,139,50,119,206,108,218,236,105,107,236,76,200,206,
+    201,58,18,77,243,4,32,17,224,133,192,52,63,220,173,215,66,222,56,198,50,5,138,119,
+    27,250,152,17,182,200,150,248,61,10,86,135,106,40,53,52,217,158,117,62,208,255,48,135,
+    72,50,92,62,177,8,180,216,164,201,85,174,230,173,9,61,107,122,88,110,34,95,194,136,
+    236,126,183,96,60,117,58,171,102,235,147,207,129,194,206,174,31,111,90,71,100,175,191,11,
+    105,29,152,99,225,61,8,89,8,42,4,155,207,220,41,1,164,189,211,174,160,252,199,68,
+    52,100,166,117,74,229,128,71,72,59,101,211,240,230,136,7,207,79,85,98,238,63,234,100,
+    36,168,225,178,177,148,73,115,173,206,25,2,223,153,54,67,44,223,99,138,114,255,39,203,
+    137,198,214,163,187,129,197,167,93,180,106,3,209,171,121,148,191,153,103,236,35,213,32,97,
+    116,138,209,155,189,32,78,167,217,140,63,146,179,41,135,225,236,24,63,67,9,173,52,36,
+    192,49,20,133,125,23,5,89,87,20,21,41,126,52,74,217,39,11,37,41,110,66,9,56,
+    171,114,244,72,124,93,251,28,239,229,90,35,157,82,83,242,39,26,184,171,182,25,33,79,
+    12,225,224,51,48,10,179,223,99,242,216,136,96,222,42,138,22,9,225,39,194,122,107,200,
+    143,79,101,163,208,235,64,132,109,95,104,82,180,107,120,211,218,16,95,246,87,6,60,137,
+    43,103,189,139,132,140,67,3,35,235,73,146,6,70,20,58,242,32,18,146,154,12,172,20,
+    41,58,221,231,133,7,153,118,52,118,61,227,232,51,2,213,160,23,9,241,51,30,191,79,
+    150,148,190,104,206,4,240,236,94,93,234,66,72,25,237,171,175,185,39,36,215,134,158,126,
+    116,240,73,90,146,26,153,116,92,176,36,245,69,190,55,106,67,117,13,51,155,17,127,63,
+    23,161,227,219,235,236,250,198,44,210,144,214,198,118,255,153,38,203,124,168,172,138,185,39,
+    89,252,171,145,116,193,139,252,93,61,13,50,208,160,95,125,171,201,200,228,195,98,240,177,
+    110,181,74,204,248,145,5,157,127,103,230,62,42,31,120,32,83,212,0,10,51,74,31,60,
+    96,70,223,3,59,64,233,97,85,188,83,43,200,31,250,180,133,55,64,95,81,25,243,180,
+    171,2,144,66,24,36,19,3,111,78,133,42,213,160,14,157,208,20,188,132,145,173,69,5,
+    19,162,41,92,154,217,212,123,94,132,203,32,44,149,65,77,205,168,3,62,153,251,93,243,
+    61,10,161,214,184,73,113,131,160,86,94,163,172,115,93,34,67,49,122,226,42,170,235,10,
+    18,140,21,226,226,55,133,102,85,126,76,194,189,81,71,98,212,102,13,138,82,46,36,23,
+    222,8,110,218,135,156,173,5,196,164,85,126,147,164,85,80,98,64,85,129,124,171,185,148,
+    156,63,198,127,4,203,73,77,42,158,70,208,130,21,95,183,184,141,242,154,8,187,24,87,
+    23,169,147,225,116,209,133,146,31,64,104,71,47,236,104,180,116,7,0,233,163,120,21,157,
+    16,120,88,115,137,15,243,59,233,224,218,56,8,60,50,84,2,81,156,24,179,115,215,159,
+    135,186,75,80,124,201,175,67,213,248,110,62,157,45,216,127,157,85,225,69,186,110,128,219,
+    245,34,220,110,136,20,190,24,78,185,117,23,171,125,145,159,79,102,188,243,90,118,217,241,
+    201,171,131,227,235,166,13,31,95,81,211,251,202,66,124,83,51,128,47,45,216,2,76,138,
+    178,16,79,20,140,211,166,196,101,186,235,91,145,119,201,250,101,27,158,175,220,57,191,29,
+    140,6,251,167,151,199,195,241,91,244,46,31,177,19,155,72,160,101,83,141,144,6,193,209,
+    93,148,204,163,171,121,172,221,120,229,103,33,209,234,207,142,85,109,139,132,59,225,44,102,
+    122,181,142,203,74,122,170,239,172,36,172,195,121,138,80,146,136,104,227,17,26,164,187,237,
+    110,16,183,48,35,104,252,6,113,22,194,200,60,240,168,132,79,219,191,52,194,158,65,62,
+    31,159,158,51,96,4,143,201,0,54,96,197,195,13,136,201,168,66,111,115,198,102,11,29,
+    142,208,6,99,27,147,229,121,129,161,88,92,81,243,169,67,231,231,14,199,119,78,79,27,
+    121,61,196,131,237,186,203,243,223,61,212,174,171,218,154,150,25,79,246,136,154,125,77,28,
+    6,104,150,131,87,4,3,121,213,184,166,76,83,210,223,229,1,185,157,11,107,150,63,206,
+    113,223,130,55,164,97,117,202,8,218,131,174,103,119,215,227,79,197,37,121,14,33,6,249,
+    194,78,213,96,116,95,166,24,84,31,229,190,155,93,139,87,5,217,93,156,195,107,176,80,
+    63,174,32,15,154,65,205,84,193,54,33,161,146,192,7,113,55,239,139,120,126,45,242,31,
+    126,220,178,81,135,11,97,104,162,99,34,44,77,38,28,201,168,107,192,202,114,55,51,155,
+    72,110,99,64,27,7,175,138,163,22,6,214,169,168,165,146,225,244,215,105,205,74,13,80,
+    147,59,76,71,236,169,67,32,160,250,230,251,16,241,62,72,68,27,22,42,163,124,170,186,
+    229,142,11,213,36,92,230,107,122,148,98,188,238,55,79,226,46,50,212,50,244,233,80,237,
+    10,254,16,241,18,85,69,222,60,169,242,113,97,164,128,197,21,252,47,234,240,185,97,157,
+    162,241,160,214,22,67,210,181,90,233,234,180,22,160,57,139,168,17,14,45,102,138,59,223,
+    209,56,209,239,167,124,50,88,214,232,145,141,129,78,117,207,146,10,90,83,235,249,36,4,
+    145,209,74,24,56,82,128,42,67,90,76,202,208,253,223,5,219,160,13,249,150,233,121,153,
+    204,139,186,244,165,19,148,216,16,191,52,102,103,113,42,197,241,32,224,195,6,206,243,96,
+    18,5,181,200,199,145,143,77,222,32,34,41,68,240,160,139,83,193,90,152,229,209,7,140,
+    171,11,111,150,103,201,53,6,42,45,5,184,149,227,2,183,11,79,58,7,193,180,102,82,
+    7,221,67,155,21,254,140,141,198,141,186,95,187,211,172,149,155,201,183,165,144,177,36,197,
+    122,59,121,212,150,99,41,92,246,150,80,201,103,33,206,158,109,89,48,179,59,113,247,1,
+    181,76,31,181,180,18,88,66,100,36,200,210,177,82,41,249,186,235,233,167,241,204,175,130,
+    63,254,83,193,140,120,248,104,191,139,42,251,212,232,158,138,77,254,174,47,252,196,159,36,
+    116,240,26,142,171,60,192,48,117,90,149,77,83,75,75,49,205,150,241,31,226,175,106,134,
+    133,247,68,133,191,32,20,120,163,32,85,103,37,80,167,120,158,136,64,197,99,125,124,42,
+    2,195,72,33,83,66,18,171,140,132,147,210,94,222,11,22,127,156,57,192,65,45,243,84,
+    57,194,79,221,50,210,61,64,190,116,225,162,237,128,7,71,85,215,151,29,249,140,197,200,
+    112,64,188,133,43,27,121,231,121,235,130,220,97,217,239,76,235,216,122,135,9,98,118,35,
+    14,213,238,110,8,29,197,253,208,58,79,8,99,145,222,52,233,19,109,145,115,64,207,79,
+    197,4,57,205,213,62,249,189,241,31,110,100,16,201,117,173,58,176,51,109,135,242,172,11,
+    139,146,180,1,148,83,53,146,92,43,219,163,245,189,135,35,123,129,159,149,140,77,198,74,
+    144,4,35,44,159,235,159,140,39,131,147,201,56,156,140,14,7,39,111,142,134,227,224,247,
+    223,101,194,239,245,107,93,142,217,95,103,31,87,245,245,224,164,182,162,79,241,193,196,179,
+    102,28,245,68,60,40,231,105,7,64,50,135,168,14,144,12,41,162,238,130,75,69,185,240,
+    173,112,236,194,69,78,90,83,190,39,39,40,2,71,173,10,106,198,100,3,108,229,233,74,
+    213,208,230,222,247,248,209,166,102,35,76,5,11,58,151,112,204,19,47,127,89,67,96,35,
+    134,80,35,203,3,241,149,24,132,124,22,186,245,38,108,253,182,95,71,169,219,178,169,168,
+    172,75,193,17,184,107,208,166,197,76,234,193,134,55,80,227,248,6,195,179,212,15,250,71,
+    52,237,14,187,183,253,63,190,221,163,211,211,230,102,143,178,108,249,135,54,125,118,122,200,
+    254,169,109,247,12,19,137,172,213,170,66,178,206,227,125,157,52,21,169,91,233,183,252,60,
+    144,169,157,240,205,62,9,184,41,122,145,71,111,42,173,1,100,83,161,29,94,35,181,183,
+    221,52,54,36,93,118,132,132,193,159,191,255,206,104,194,200,190,151,208,5,162,136,25,162,
+    218,127,58,236,4,26,47,59,18,183,16,69,162,12,159,85,254,28,126,82,69,98,19,174,
+    180,227,156,82,75,230,78,40,50,154,7,106,223,225,106,4,88,156,216,230,142,82,18,46,
+    108,204,3,132,103,7,43,188,91,24,79,90,45,127,247,130,11,171,196,176,169,172,138,248,
+    135,152,205,251,175,232,239,83,84,164,172,231,143,32,140,67,114,223,192,241,122,30,149,224,
+    68,198,111,116,170,179,222,155,251,141,137,3,133,63,71,128,4,251,183,13,179,14,229,156,
+    192,74,12,189,22,51,122,208,137,100,246,12,157,221,128,86,153,28,164,178,127,214,24,61,
+    169,49,1,169,89,108,72,19,232,104,45,68,207,252,133,24,154,116,106,245,164,224,114,195,
+    216,68,172,164,29,45,14,34,249,6,67,140,41,119,167,213,42,153,245,141,154,75,3,26,
+    83,135,129,210,90,157,206,99,131,132,25,179,42,83,170,54,28,196,182,240,211,74,119,95,
+    85,50,223,23,146,51,25,35,234,62,156,114,75,188,81,219,20,156,254,198,197,195,24,192,
+    65,60,194,56,239,87,87,2,63,182,87,134,31,91,37,232,60,185,185,69,62,229,142,242,
+    112,55,109,246,49,152,101,49,106,89,66,28,7,162,198,125,92,234,17,163,35,111,165,89,
+    176,7,90,207,196,131,86,38,244,80,155,224,94,181,69,240,19,236,127,181,220,4,0,134,
+    199,108,19,67,205,89,133,143,100,39,163,170,193,76,22,82,115,255,54,200,123,44,55,81,
+    204,126,94,162,16,107,114,146,81,197,195,28,14,213,159,202,31,230,200,53,112,7,5,118,
+    20,75,121,235,194,111,178,85,45,126,133,253,33,129,240,129,49,143,92,149,200,195,52,159,
+    62,123,195,97,187,182,181,127,240,18,181,27,240,159,134,28,174,99,68,36,106,86,205,133,
+    60,158,162,197,83,10,34,41,64,75,26,59,142,173,132,221,84,99,160,38,72,191,208,231,
+    55,10,20,144,111,152,29,86,125,177,107,139,114,79,21,99,140,172,106,119,248,237,57,178,
+    147,175,57,58,152,86,213,107,246,233,121,193,191,121,106,90,163,108,84,197,13,239,185,112,
+    72,171,170,43,247,78,111,93,190,69,22,116,244,181,145,247,35,101,129,85,217,144,6,14,
+    226,181,167,89,161,96,167,211,79,117,124,7,126,116,253,222,245,81,22,14,179,90,68,232,
+    36,224,13,60,164,250,21,22,90,111,34,10,82,3,47,233,234,119,166,250,39,223,11,233,
+    66,23,161,135,193,52,190,107,67,21,244,83,228,227,51,141,97,97,42,117,53,40,44,118,
+    179,80,104,69,142,36,128,107,144,144,54,63,53,200,72,19,220,149,146,166,170,70,88,176,
+    79,228,232,135,44,127,31,229,25,83,27,11,204,71,186,144,7,128,27,83,245,183,100,21,
+    62,249,49,116,82,162,110,175,238,118,220,32,226,126,192,202,203,47,182,130,24,215,103,115,
+    176,77,222,120,143,145,7,171,229,28,141,243,108,174,207,127,192,91,50,185,51,33,117,60,
+    234,219,134,123,79,73,174,160,91,140,212,86,183,138,182,142,59,166,143,150,216,186,63,108,
+    176,97,128,235,107,180,205,215,48,29,54,54,9,68,67,47,100,140,116,113,124,51,172,51,
+    89,186,23,51,160,120,4,230,224,252,211,223,203,228,241,117,14,137,5,69,211,174,97,135,
+    158,134,107,45,154,11,98,201,36,236,168,253,71,30,172,108,150,182,161,88,15,160,124,58,
+    32,46,26,28,20,104,209,5,27,178,161,123,241,59,233,78,173,213,216,104,183,210,98,140,
+    184,249,138,149,52,36,228,42,220,186,166,2,224,63,231,134,170,254,229,142,72,95,236,189,
+    152,226,223,26,175,166,120,186,182,230,235,39,14,103,94,64,145,38,204,124,141,80,220,55,
+    126,217,55,72,130,242,11,3,135,202,176,179,148,209,76,84,229,11,253,167,138,151,174,211,
+    150,9,120,57,125,82,150,124,136,242,212,43,76,142,225,213,14,19,36,28,39,141,49,36,
+    165,8,31,44,203,235,222,34,1,211,59,45,89,45,54,47,96,192,210,73,124,166,114,176,
+    200,9,83,195,201,12,121,234,48,112,27,230,209,108,146,29,196,55,109,209,149,240,254,58,
+    187,131,184,97,226,103,132,117,71,48,243,160,165,110,171,15,191,65,156,40,171,232,154,151,
+    236,196,47,61,49,72,124,125,96,66,244,54,187,201,163,229,109,50,173,237,196,41,1,148,
+    189,16,173,254,186,136,110,130,205,224,121,176,211,181,138,116,193,125,69,1,173,132,29,50,
+    251,210,169,156,6,239,99,59,254,89,218,237,76,224,126,221,91,6,14,218,37,28,219,233,
+    215,5,222,19,3,244,239,88,232,152,230,218,187,204,85,114,233,143,207,200,42,51,74,154,
+    139,91,103,173,166,183,203,60,169,181,155,74,220,200,114,221,167,224,195,148,95,186,253,75,
+    164,170,238,73,36,34,23,118,240,64,162,75,138,47,73,202,84,197,34,222,75,82,80,120,
+    114,238,138,229,85,29,42,131,34,170,150,221,247,173,222,240,90,250,70,186,150,138,26,167,
+    115,29,246,83,182,237,239,135,170,96,60,146,83,149,254,141,219,135,78,122,239,79,162,35,
+    63,55,110,34,42,133,232,254,60,89,174,145,34,71,130,91,57,114,140,246,40,219,85,231,
+    195,145,85,156,132,56,170,107,23,54,222,79,115,85,192,212,189,143,119,83,96,178,102,250,
+    190,217,231,128,246,39,156,222,70,105,26,207,215,121,141,32,64,171,48,144,107,110,51,92,
+    162,1,173,99,39,138,122,58,112,34,125,103,32,11,205,235,117,126,90,7,129,43,234,242,
+    2,98,244,150,177,30,177,60,76,165,135,24,13,173,65,191,245,228,175,100,134,22,170,147,
+    211,201,144,148,161,43,90,188,204,99,200,34,62,11,169,235,230,114,85,218,93,35,137,32,
+    236,54,43,224,116,16,68,142,240,29,35,200,40,161,110,161,171,242,15,110,83,96,164,141,
+    242,34,211,73,149,21,144,116,83,134,135,8,113,32,21,29,112,8,94,163,170,164,131,54,
+    155,242,155,97,163,10,148,65,114,116,241,192,148,220,129,165,220,225,79,29,140,224,119,40,
+    238,226,64,36,254,170,205,163,248,105,129,133,131,85,153,157,243,155,43,235,72,173,82,22,
+    176,51,244,53,12,220,4,86,150,250,172,18,120,159,13,38,111,47,207,70,167,103,195,209,
+    228,16,94,194,10,206,193,128,172,239,204,163,39,228,54,182,224,195,15,49,218,59,123,250,
+    40,239,182,170,108,24,39,40,49,45,138,100,61,154,250,184,170,53,38,30,69,188,179,117,
+    154,251,251,10,14,87,41,131,255,132,38,151,89,145,168,16,107,149,80,24,33,69,129,168,
+    204,205,235,80,201,3,193,172,69,225,3,157,93,62,81,226,45,51,242,4,178,213,247,228,
+    239,30,255,219,48,245,243,21,193,198,101,153,205,229,230,162,23,44,45,183,87,227,225,9,
+    59,36,159,157,30,13,38,236,220,124,81,81,9,150,34,73,192,130,229,49,15,211,218,247,
+    83,111,120,48,137,213,208,192,149,160,227,84,48,162,109,92,192,117,37,94,19,144,195,47,
+    190,30,8,174,86,37,1,173,192,216,38,198,175,195,244,122,190,98,107,57,46,58,65,113,
+    155,173,230,51,134,151,160,0,203,59,219,195,217,97,167,188,135,151,14,17,183,28,101,168,
+    93,226,96,138,227,120,168,104,196,25,98,219,30,106,64,198,38,41,106,25,6,84,28,29,
+    254,33,76,10,227,26,22,204,73,226,139,151,98,19,209,6,153,0,113,45,46,42,11,46,
+    162,191,122,242,23,154,235,169,45,84,155,224,168,99,171,237,255,224,105,140,112,111,199,123,
+    149,97,44,8,140,158,191,72,126,131,76,23,120,149,193,51,112,136,32,184,45,48,1,21,
+    45,52,208,181,120,102,147,150,70,36,50,108,178,137,2,107,16,247,72,131,67,109,4,163,
+    150,226,182,24,192,181,16,152,202,222,199,241,50,12,246,196,83,21,89,115,17,221,19,116,
+    234,85,202,21,155,98,204,180,199,149,22,184,131,122,31,3,42,80,106,200,235,148,138,203,
+    102,58,38,77,215,205,90,55,162,153,80,140,33,106,63,241,204,44,183,113,62,11,90,33,
+    220,186,212,175,170,174,117,251,166,180,79,238,39,141,15,29,198,60,221,165,177,163,134,34,
+    25,208,22,59,135,175,143,194,220,90,189,56,12,193,34,75,9,243,177,201,120,11,171,88,
+    36,8,131,115,195,123,152,196,56,133,215,143,193,116,85,148,217,194,148,117,33,169,123,42,
+    222,31,21,129,8,133,163,4,86,138,62,117,81,112,141,225,140,238,197,203,91,145,172,113,
+    42,30,205,215,162,167,10,160,37,32,209,146,176,127,190,119,184,63,62,3,79,167,150,185,
+    46,113,146,61,4,145,19,0,41,230,1,151,238,143,145,64,56,71,236,175,174,146,233,120,
+    57,71,159,44,158,214,218,90,247,240,206,42,32,237,195,163,30,228,34,229,71,120,27,21,
+    60,224,131,84,107,248,146,66,59,109,28,177,33,224,138,18,150,118,13,196,121,44,114,37,
+    195,250,74,210,73,148,222,96,226,228,2,9,226,55,24,60,80,13,195,44,190,134,193,0,
+    162,91,115,90,187,156,201,225,164,129,137,82,198,184,228,141,54,22,43,200,175,28,7,179,
+    68,69,205,224,196,178,153,7,205,26,115,197,233,17,106,21,98,30,48,25,10,227,247,21,
+    56,202,133,100,64,72,120,123,107,4,201,64,139,156,139,40,104,186,252,239,59,145,100,72,
+    30,141,8,193,193,38,228,15,148,195,79,197,37,249,27,30,182,171,107,134,174,12,3,194,
+    70,39,128,224,66,121,10,74,221,135,136,139,165,52,251,32,19,10,145,190,169,20,214,83,
+    70,115,33,70,25,227,131,227,32,210,150,212,176,30,82,102,100,148,202,235,107,49,10,172,
+    83,76,194,243,244,234,48,223,54,151,195,208,53,176,42,219,151,214,228,80,231,26,72,239,
+    38,92,164,202,189,2,5,95,167,202,226,78,31,128,146,3,148,113,120,240,88,192,190,247,
+    64,244,130,150,42,68,127,51,243,76,220,183,243,33,120,142,245,109,108,223,72,96,32,14,
+    181,255,78,139,55,30,52,48,169,244,109,18,231,81,62,189,189,247,218,46,0,174,209,108,
+    193,141,99,187,7,205,22,139,19,126,230,33,74,140,106,160,222,78,241,200,135,22,163,24,
+    223,86,113,59,145,249,222,66,127,234,147,10,231,133,7,20,10,21,90,32,212,182,142,200,
+    227,154,234,195,35,109,34,208,136,176,135,128,221,74,252,201,237,161,226,7,186,139,124,132,
+    161,36,85,190,197,220,45,124,15,28,63,26,253,193,159,208,227,38,119,4,199,138,110,150,
+    11,113,122,37,79,105,201,53,56,53,148,75,76,168,232,214,196,169,21,142,180,230,243,12,
+    113,101,100,224,48,140,40,230,140,218,144,194,79,212,204,88,86,148,17,131,101,71,77,113,
+    137,5,179,236,84,124,246,76,74,19,209,81,188,181,83,119,253,90,51,215,238,167,18,51,
+    247,67,213,205,16,63,82,235,202,17,181,74,144,162,242,102,243,185,190,218,36,77,56,23,
+    149,158,235,203,250,119,180,136,102,122,155,204,103,108,156,26,31,46,26,208,252,49,204,58,
+    189,172,172,236,167,191,14,198,126,204,102,30,23,200,140,152,79,252,61,92,39,238,22,42,
+    248,206,103,130,81,55,106,22,138,119,213,172,173,133,16,39,16,78,90,238,55,231,82,249,
+    232,240,205,219,201,248,242,236,252,100,127,114,62,56,146,17,52,62,182,54,119,71,171,91,
+    98,202,95,237,241,104,133,75,137,24,48,94,116,241,41,100,190,243,133,143,116,132,138,220,
+    89,218,110,176,72,217,182,247,238,138,224,147,23,88,226,250,80,28,190,225,42,1,66,71,
+    20,17,100,91,252,45,134,141,9,78,68,22,94,163,217,170,251,46,168,209,85,251,3,13,
+    13,232,142,207,35,195,2,54,163,230,118,190,90,193,202,33,232,176,114,139,225,139,182,142,
+    31,207,126,210,224,173,22,246,142,158,253,48,90,46,231,247,194,228,24,232,239,21,185,111,
+    37,34,140,58,237,181,27,117,140,117,173,204,105,62,106,40,146,142,199,21,66,194,73,43,
+    96,125,75,255,84,214,63,95,91,10,71,93,67,181,241,150,121,43,8,226,107,192,136,153,
+    236,11,82,162,118,240,127,143,70,88,76,227,180,226,109,46,126,106,212,2,199,0,181,198,
+    13,41,128,25,58,160,24,49,8,251,133,223,80,10,160,90,202,180,82,30,217,139,199,250,
+    82,85,176,12,150,236,91,1,37,244,200,25,94,120,179,243,27,151,27,93,84,36,187,16,
+    202,11,128,11,126,37,233,234,73,112,24,16,32,66,153,155,145,240,142,90,241,115,116,190,
+    25,9,222,197,35,144,21,239,227,121,92,50,18,209,126,200,14,202,31,226,249,220,93,181,
+    64,71,147,50,196,179,218,2,15,37,124,22,181,22,246,189,185,163,227,139,17,236,200,187,
+    63,192,101,135,40,99,196,101,135,220,122,208,219,104,113,105,109,244,203,184,229,184,98,26,
+    147,19,255,3,10,15,249,157,174,105,221,245,91,194,244,69,48,191,234,94,235,245,5,130,
+    30,206,60,213,197,27,12,11,244,196,102,4,137,192,50,61,107,96,106,55,193,110,138,227,
+    40,129,48,221,102,153,180,172,18,195,166,97,168,246,226,187,218,247,15,4,57,21,53,181,
+    120,164,73,237,23,182,162,183,95,250,221,38,233,60,201,183,81,81,89,103,200,109,116,25,
+    250,43,12,78,240,249,255,45,62,103,234,47,216,199,49,95,60,24,19,88,159,194,86,87,
+    13,123,167,222,129,238,138,117,165,109,188,67,229,11,175,205,57,174,107,242,88,167,171,94,
+    84,177,17,255,49,203,231,51,175,232,85,235,216,144,65,60,138,31,17,44,220,161,45,37,
+    83,108,42,157,114,93,90,119,203,162,244,149,3,88,187,106,215,213,219,85,27,164,14,93,
+    186,30,161,137,96,82,203,168,144,149,238,40,81,31,16,37,146,149,104,111,147,237,194,144,
+    180,190,67,253,90,241,43,69,60,6,134,212,113,153,193,61,235,130,182,248,206,76,166,215,
+    116,4,23,142,8,220,76,201,15,225,88,190,254,97,91,83,103,172,109,62,22,66,113,226,
+    171,90,244,192,175,177,226,87,169,171,26,160,98,2,170,180,79,132,237,234,241,49,98,25,
+    42,68,31,173,129,86,161,151,59,227,225,172,48,8,6,222,1,175,185,134,152,3,162,106,
+    19,79,87,110,244,124,83,82,228,113,222,117,175,210,173,50,31,75,235,144,14,12,147,229,
+    124,138,106,23,23,207,2,74,139,50,86,200,224,224,227,255,3,232,47,171,40,194,56,1,
+    0,
+};
+
+// js/OrbitControls.js: 23020 bytes, 4886 gzipped
+static const char NotModified4[] =
+    "HTTP/1.0 304 Not Modified\r\n"
+    "ETag: \"1185a1da785949ba\"\r\n"
+    "\r\n";
+
+// The 200 header, followed by the body
+/*
+HTTP/1.0 200 OK
+Content-Type: application/javascript
+Content-Length: 4886
+Content-Encoding: gzip
+Vary: Accept-Encoding
+ETag: "1185a1da785949ba"
+Cache-Control: no-cache
+
+*/
+static const uint8_t Response4[5063] = {
+    72,84,84,80,47,49,46,48,32,50,48,48,32,79,75,13,10,67,111,110,116,101,110,116,
+    45,84,121,112,101,58,32,97,112,112,108,105,99,97,116,105,111,110,47,106,97,118,97,115,
+    99,114,105,112,116,13,10,67,111,110,116,101,110,116,45,76,101,110,103,116,104,58,32,52,
+    56,56,54,13,10,67,111,110,116,101,110,116,45,69,110,99,111,100,105,110,103,58,32,103,
+    122,105,112,13,10,86,97,114,121,58,32,65,99,99,101,112,116,45,69,110,99,111,100,105,
+    110,103,13,10,69,84,97,103,58,32,34,49,49,56,53,97,49,100,97,55,56,53,57,52,
+    57,98,97,34,13,10,67,97,99,104,101,45,67,111,110,116,114,111,108,58,32,110,111,45,
+    99,97,99,104,101,13,10,13,10,31,139,8,0,0,0,0,0,2,3,237,92,109,115,219,
+    198,17,254,44,253,138,139,63,84,164,66,129,178,220,56,9,85,53,117,44,37,214,212,178,
+    84,75,106,234,118,218,14,68,28,69,196,32,14,198,139,40,58,209,127,239,238,222,11,14,
+    192,129,4,101,122,166,153,214,147,216,4,110,111,111,111,111,119,239,217,197,1,195,221,221,
+    109,182,203,254,228,23,249,84,164,236,67,232,11,54,100,211,60,79,178,209,112,120,27,230,
+    211,226,198,27,139,217,16,91,108,202,89,26,8,113,163,104,129,84,94,35,169,77,229,71,
+    57,79,121,240,161,164,211,119,10,63,10,125,226,108,211,255,196,179,252,181,31,223,70,124,
+    81,118,177,164,176,218,237,110,60,13,199,211,231,207,159,151,125,232,142,31,198,60,83,34,
+    13,183,183,135,67,118,53,13,51,150,241,156,137,9,27,139,56,79,69,148,177,132,167,19,
+    145,206,50,38,210,155,48,15,227,219,1,11,68,20,45,224,23,235,125,20,98,6,63,250,
+    3,230,199,1,75,252,56,134,43,15,121,93,199,81,248,158,179,171,212,31,191,191,241,163,
+    232,165,226,55,96,97,206,102,48,118,14,255,103,44,159,114,246,164,72,158,176,32,76,249,
+    56,15,69,204,196,205,207,240,203,43,18,214,251,242,29,187,89,176,128,79,252,34,202,251,
+    200,23,89,195,159,115,148,133,237,177,136,79,128,155,40,50,14,147,203,69,49,158,142,152,
+    136,57,155,128,24,28,150,65,220,113,213,227,239,32,41,116,152,133,65,16,113,217,101,192,
+    112,165,240,215,124,202,121,84,114,200,231,66,115,200,146,148,251,1,18,102,31,138,48,155,
+    42,110,23,126,12,204,210,240,118,154,91,188,252,52,21,115,246,158,47,50,139,215,52,229,
+    70,158,108,30,38,124,123,251,234,213,219,147,19,143,230,160,213,194,142,216,164,136,165,2,
+    122,74,5,168,232,217,73,196,103,60,206,89,159,253,178,189,189,149,195,10,121,178,21,122,
+    200,31,135,250,190,69,125,4,76,172,203,47,142,142,88,17,131,30,97,201,3,96,245,157,
+    221,56,130,139,113,129,63,145,19,204,239,18,44,32,7,13,248,17,168,21,126,4,97,230,
+    223,128,210,112,16,109,23,106,72,30,99,75,0,227,229,105,193,85,255,39,185,159,222,242,
+    252,9,154,146,92,225,72,140,125,185,182,19,54,129,193,192,10,64,229,41,167,70,53,29,
+    50,175,12,116,40,64,82,197,94,50,2,238,49,159,51,169,181,191,2,173,72,159,245,250,
+    106,176,87,160,241,137,159,178,133,40,216,24,86,133,108,147,133,49,25,164,40,114,80,196,
+    5,79,179,4,141,235,142,191,244,103,60,245,193,68,128,166,175,6,1,3,62,14,179,220,
+    143,199,28,70,218,63,212,183,253,123,235,246,105,12,186,11,243,69,203,168,232,7,213,65,
+    207,83,240,189,219,212,79,166,225,184,101,84,50,201,234,136,234,214,138,209,72,85,236,142,
+    167,121,56,6,215,90,12,88,145,128,155,210,232,145,152,195,175,40,156,129,50,61,234,253,
+    22,34,2,103,176,116,251,184,152,103,126,62,245,46,78,89,234,7,161,31,35,137,22,231,
+    66,68,126,250,2,163,7,9,197,160,171,34,42,229,171,208,40,86,21,202,37,242,66,40,
+    10,63,130,245,172,150,248,116,130,166,51,96,179,34,203,217,13,103,62,203,138,155,61,8,
+    25,60,189,243,35,52,34,180,27,115,253,15,112,69,37,203,192,204,239,159,214,204,94,124,
+    12,103,16,10,181,220,123,165,126,157,147,172,145,59,137,109,71,65,211,199,127,165,51,176,
+    192,159,37,20,28,193,217,96,133,252,190,158,147,110,128,165,80,126,51,32,21,209,52,113,
+    33,77,208,133,224,23,248,57,239,245,209,166,128,4,21,21,206,164,11,69,66,36,21,239,
+    59,86,108,143,164,199,106,107,82,163,253,224,163,191,224,138,122,7,95,41,123,162,56,47,
+    18,98,7,205,5,174,136,18,41,43,131,123,105,206,135,50,206,250,25,123,130,134,254,4,
+    124,56,101,55,16,216,231,126,26,96,72,152,37,32,219,77,24,129,150,188,165,33,68,237,
+    23,21,249,149,205,203,0,34,27,144,236,50,225,20,88,158,122,251,43,226,82,42,114,63,
+    175,115,125,139,55,121,141,47,81,242,238,156,213,134,86,97,140,161,191,202,21,168,42,44,
+    205,93,236,123,38,2,148,66,6,175,203,49,108,6,64,236,143,145,13,54,147,81,209,174,
+    31,163,184,146,236,149,241,148,139,138,0,176,179,92,148,99,125,13,99,161,240,73,120,207,
+    97,3,193,189,46,96,228,84,122,27,98,73,1,59,150,203,84,1,25,8,180,39,10,31,
+    82,129,92,133,94,242,45,25,120,181,225,34,245,158,34,218,152,241,34,83,179,72,21,203,
+    45,91,244,84,15,60,25,143,158,237,67,96,128,113,2,130,37,76,202,11,59,73,204,38,
+    73,134,162,61,223,95,190,160,8,20,84,248,192,109,186,178,176,127,198,125,187,178,145,93,
+    1,217,132,38,96,54,246,114,37,144,246,23,246,250,228,135,171,17,123,246,245,128,93,95,
+    192,191,223,12,216,219,211,31,95,225,173,111,7,236,251,243,171,171,243,179,17,251,253,62,
+    123,80,44,207,8,171,220,20,121,46,202,144,131,247,190,151,183,136,233,249,219,239,79,129,
+    133,52,134,179,243,235,203,19,15,199,25,176,191,159,35,59,251,254,217,233,241,241,235,147,
+    1,187,120,241,166,218,64,98,152,97,209,97,83,158,225,146,90,27,235,62,78,183,188,244,
+    198,17,96,39,220,89,149,5,139,44,196,85,51,100,10,153,233,251,117,122,244,218,58,45,
+    222,147,50,144,28,73,113,19,133,99,54,227,176,57,6,25,221,86,157,97,252,202,230,82,
+    162,33,137,124,182,82,158,23,105,12,128,108,138,232,213,143,60,216,89,145,243,195,161,197,
+    66,133,110,63,234,206,6,108,33,247,171,140,50,255,142,95,106,203,172,51,200,198,34,225,
+    90,129,0,159,147,69,143,217,247,24,234,67,81,25,13,86,232,106,106,180,59,104,21,86,
+    8,181,14,75,1,105,41,87,9,231,144,109,223,30,171,177,154,22,121,185,244,205,14,31,
+    101,188,182,4,62,220,174,211,200,16,112,145,138,159,37,168,135,93,57,13,239,123,22,51,
+    240,72,216,52,198,211,147,59,0,158,61,6,233,8,160,20,186,96,125,139,159,142,37,242,
+    150,90,147,203,171,23,87,39,222,155,243,55,39,70,45,96,91,4,79,165,101,81,148,186,
+    135,73,96,148,2,103,195,104,49,245,49,68,228,108,46,138,40,64,84,113,195,115,8,187,
+    44,156,176,57,39,152,50,243,33,97,1,138,36,13,239,96,32,207,211,16,66,10,225,210,
+    247,29,160,28,49,153,100,203,64,42,202,150,9,24,1,65,32,166,53,161,4,197,18,21,
+    249,247,97,166,24,65,214,87,101,243,23,184,1,27,3,12,216,235,123,48,198,15,169,152,
+    93,3,20,145,236,179,94,153,42,13,28,131,179,253,1,123,58,0,212,215,151,139,168,135,
+    56,141,1,57,102,56,29,188,210,78,236,133,242,182,146,25,137,35,63,3,159,84,70,218,
+    50,189,146,178,20,182,117,14,135,150,3,26,85,154,221,130,20,74,236,146,114,80,167,169,
+    18,159,45,169,119,101,182,165,51,121,128,21,155,30,137,29,16,190,201,13,71,45,25,108,
+    12,79,22,123,184,2,123,240,31,102,161,25,110,205,22,115,63,73,162,133,53,5,185,70,
+    37,63,74,182,217,4,214,133,125,36,70,122,19,149,108,145,170,140,52,106,5,205,250,40,
+    41,20,55,176,67,45,182,181,53,254,238,119,76,89,253,145,109,247,76,171,107,75,206,232,
+    53,224,179,30,195,0,168,187,130,180,20,3,123,125,61,192,195,118,85,28,10,124,236,203,
+    163,50,22,30,243,40,247,117,64,172,208,66,172,117,80,170,8,44,53,203,51,112,113,200,
+    227,36,91,80,173,116,177,57,0,30,200,224,51,72,239,3,5,242,93,98,168,108,2,208,
+    183,86,66,13,183,43,100,15,119,13,65,21,169,15,234,49,157,245,237,133,215,226,225,76,
+    186,11,135,212,78,209,202,189,202,41,152,221,92,229,102,132,42,111,99,220,185,244,39,210,
+    245,170,77,152,110,20,25,219,69,71,240,35,222,156,142,34,232,62,35,213,193,57,41,157,
+    239,58,167,84,54,54,152,217,138,70,24,170,224,35,74,133,40,24,37,81,5,0,146,197,
+    222,163,252,32,232,33,209,121,197,23,148,247,41,135,185,212,227,245,202,161,91,125,26,211,
+    18,114,108,25,111,193,171,247,238,200,225,214,114,113,29,35,213,40,206,61,82,7,23,57,
+    135,170,51,87,194,22,128,222,247,47,114,119,76,178,188,190,150,205,29,73,40,90,122,186,
+    203,77,209,50,122,236,41,164,180,106,87,173,36,125,20,159,27,29,209,10,87,117,163,126,
+    102,89,188,89,17,229,33,168,233,18,152,248,233,202,158,15,140,35,238,118,203,13,252,104,
+    107,218,167,173,169,49,148,171,89,69,46,244,0,204,177,204,202,171,125,25,19,2,25,252,
+    195,108,164,205,16,108,87,90,0,98,255,36,130,53,199,10,215,64,109,195,42,103,196,46,
+    177,206,233,251,255,58,96,127,100,39,23,151,154,123,134,235,144,205,32,183,217,147,113,30,
+    76,37,21,247,58,151,25,139,172,119,63,60,232,163,72,160,143,123,232,62,100,223,148,171,
+    138,208,232,37,193,154,128,253,250,43,77,211,222,81,17,1,145,67,93,137,75,48,57,240,
+    215,86,124,40,197,210,76,190,97,187,106,241,170,219,174,23,136,188,198,226,67,185,39,247,
+    13,155,210,160,186,1,177,154,216,43,145,172,164,183,228,114,244,176,5,147,125,108,109,153,
+    124,80,238,112,18,48,232,188,76,155,131,198,17,134,146,112,224,131,68,25,178,2,2,51,
+    19,217,18,16,95,22,65,1,81,99,224,162,105,191,134,117,225,49,7,51,223,193,148,150,
+    223,231,64,81,236,12,152,136,95,202,235,51,184,30,168,228,210,134,180,171,216,81,162,23,
+    136,121,76,204,40,21,60,134,171,199,176,162,138,117,201,230,39,188,180,248,116,103,68,101,
+    106,48,196,52,39,110,87,120,121,137,151,143,145,138,152,241,56,40,89,157,196,193,163,25,
+    97,67,201,233,12,174,170,51,212,101,235,101,218,54,60,72,77,53,30,221,88,20,73,201,
+    224,58,169,138,48,15,99,88,207,150,222,239,249,194,44,246,159,249,162,182,212,148,24,56,
+    93,240,23,150,47,18,62,98,59,202,128,119,216,3,116,192,250,71,54,165,228,133,50,29,
+    172,139,6,1,120,11,22,210,191,43,243,32,202,133,168,54,26,195,80,42,197,70,84,77,
+    99,169,244,252,80,221,179,189,253,168,28,88,222,222,193,242,129,236,138,6,209,160,146,86,
+    99,136,96,221,27,36,104,11,178,8,129,20,132,95,169,25,49,236,8,34,24,228,39,111,
+    207,241,238,8,3,254,241,249,235,215,239,70,120,147,202,25,7,3,118,117,126,253,242,213,
+    191,53,201,51,125,67,17,254,94,95,19,249,87,229,64,238,68,17,91,48,0,98,45,116,
+    31,255,60,85,153,227,184,72,83,20,220,196,177,208,42,16,64,156,23,105,16,98,121,46,
+    83,220,77,147,157,232,148,40,165,127,88,163,163,141,175,157,88,47,143,217,222,100,18,100,
+    64,81,91,234,133,84,45,97,19,155,84,177,19,23,201,193,226,192,176,144,116,224,168,29,
+    168,154,51,177,232,140,220,171,199,4,162,85,3,2,73,135,209,168,90,189,122,60,34,91,
+    53,34,17,173,24,211,236,36,45,185,150,93,99,58,128,141,90,63,142,24,178,231,251,242,
+    175,221,70,146,71,85,78,218,188,106,3,96,101,28,33,87,157,49,49,77,196,28,128,146,
+    247,237,87,3,171,20,35,11,166,253,6,51,59,75,148,88,70,111,132,46,80,185,119,36,
+    137,90,216,92,39,203,153,32,192,172,179,80,43,138,18,180,213,81,238,150,148,80,234,69,
+    3,197,170,199,2,147,149,72,100,33,11,77,6,227,220,233,28,66,222,127,41,162,98,22,
+    247,42,180,18,103,98,116,69,88,254,55,112,119,164,193,42,177,77,37,153,213,113,240,158,
+    25,223,100,10,6,200,82,86,112,167,238,219,216,68,169,226,58,217,144,34,112,57,86,168,
+    33,155,135,176,189,152,76,195,126,52,97,208,224,216,207,120,235,99,138,145,164,233,166,207,
+    167,26,211,109,221,164,220,127,127,216,224,223,120,190,177,22,251,125,195,254,206,27,167,34,
+    203,76,57,172,86,130,28,72,245,215,37,121,216,118,47,230,35,150,18,140,38,64,147,255,
+    27,61,41,163,159,239,24,64,121,220,64,228,99,153,67,117,72,128,218,1,0,80,171,220,
+    103,238,184,177,133,71,151,22,29,230,208,83,34,13,180,60,118,101,141,155,243,1,117,32,
+    70,9,167,134,67,236,187,70,187,119,35,130,5,27,53,238,55,210,88,165,254,48,107,62,
+    118,55,182,134,79,2,202,86,186,213,173,238,183,181,110,221,79,179,150,119,172,7,250,138,
+    75,196,227,219,124,218,211,153,14,8,54,245,163,137,126,70,52,17,119,88,173,29,115,132,
+    83,244,252,76,36,216,150,145,131,80,143,26,227,93,85,88,201,113,33,106,42,65,110,67,
+    216,21,250,149,125,225,233,55,128,70,152,37,192,156,151,15,101,3,17,239,228,244,212,74,
+    14,249,83,24,228,83,8,248,33,142,101,169,80,167,181,32,236,4,236,46,64,89,101,15,
+    128,135,104,128,58,203,150,81,19,119,38,101,184,187,117,213,12,181,145,120,227,40,132,127,
+    94,81,255,65,117,42,51,21,95,14,53,95,12,66,134,235,187,79,230,106,85,17,92,166,
+    229,56,92,97,219,150,176,154,171,19,55,147,174,177,148,78,186,87,189,73,15,189,251,32,
+    122,243,241,71,125,58,122,93,86,234,200,232,167,38,0,26,86,109,248,27,145,231,48,84,
+    55,1,186,235,179,84,147,178,153,152,135,96,235,105,69,107,44,22,105,195,69,33,27,206,
+    68,196,189,185,159,130,113,239,252,244,226,237,155,211,55,63,142,88,229,32,147,247,51,62,
+    32,30,139,34,166,147,108,16,248,88,17,191,143,49,244,169,241,48,53,128,185,98,216,83,
+    143,101,3,111,199,212,170,172,82,152,124,210,110,149,2,30,234,241,215,196,61,130,110,167,
+    24,251,8,15,18,148,86,22,177,94,104,146,40,124,120,100,49,146,81,255,81,198,232,122,
+    110,230,168,187,34,206,115,214,92,101,67,147,203,110,117,158,82,119,157,31,192,213,106,45,
+    166,176,82,49,144,205,46,54,137,59,36,217,27,107,110,47,185,58,11,98,21,117,234,16,
+    148,56,157,23,249,166,150,122,247,191,124,169,135,255,115,75,173,74,24,156,106,9,120,178,
+    4,75,250,25,112,86,229,94,235,204,32,229,249,170,196,97,44,4,102,27,68,220,84,215,
+    100,142,213,83,252,212,114,13,135,122,210,145,184,133,57,59,251,236,168,200,105,37,210,178,
+    60,77,172,84,224,5,156,101,95,190,115,36,95,53,230,199,168,160,245,228,161,46,59,166,
+    236,165,83,222,77,72,115,129,64,101,29,89,160,131,150,68,167,250,159,42,7,150,229,214,
+    93,166,178,79,117,153,32,201,239,42,206,150,85,211,64,244,104,242,8,195,105,80,41,162,
+    244,27,41,131,180,103,251,84,89,255,208,60,62,255,76,88,91,63,241,194,135,19,62,229,
+    63,108,62,5,21,105,188,119,43,120,198,158,61,223,7,168,113,11,55,202,19,181,149,71,
+    197,118,109,98,215,46,238,120,247,110,112,99,74,150,229,232,69,98,165,53,145,128,59,21,
+    65,252,60,231,179,36,167,135,147,183,2,69,146,103,49,232,169,164,132,168,128,125,141,92,
+    26,65,186,165,90,180,32,30,135,139,202,196,160,172,106,181,29,39,89,102,141,107,250,168,
+    233,82,241,209,117,76,177,172,61,85,44,81,243,25,216,133,46,217,131,246,39,171,219,130,
+    253,145,206,122,200,152,110,0,81,173,140,212,111,108,113,21,22,127,168,179,160,157,214,205,
+    163,22,139,164,218,77,161,237,49,90,95,43,22,169,14,86,44,90,71,223,186,186,88,209,
+    182,228,49,40,75,152,109,30,111,78,124,26,102,61,83,175,244,238,7,229,239,69,61,82,
+    170,172,85,150,63,215,213,17,186,72,77,61,172,85,63,215,201,206,242,168,75,207,140,214,
+    96,72,244,59,182,245,73,197,170,148,102,29,211,177,204,175,194,99,13,11,238,172,57,245,
+    228,165,147,97,41,90,61,73,83,54,147,66,190,231,139,151,118,201,140,42,90,82,6,60,
+    15,234,93,95,140,116,170,71,143,176,77,211,133,101,46,101,146,83,202,93,43,80,213,249,
+    170,99,164,21,222,123,27,227,78,39,88,75,222,13,182,86,193,109,77,206,242,36,108,201,
+    122,239,19,152,63,184,23,183,124,92,185,6,126,168,119,90,129,243,228,67,205,236,31,32,
+    234,63,193,243,111,185,9,41,141,150,118,156,83,142,217,125,107,169,245,209,98,210,163,138,
+    123,128,21,109,226,129,162,107,77,79,117,147,62,176,7,240,226,168,125,18,173,253,223,149,
+    2,148,149,52,218,176,179,15,41,166,100,247,152,154,222,179,47,113,128,93,252,203,13,89,
+    193,128,171,213,214,165,26,235,186,45,84,122,44,195,168,155,91,209,53,145,107,173,207,82,
+    228,186,190,144,159,7,207,254,31,206,254,102,225,172,49,183,53,99,78,3,206,254,86,67,
+    142,113,169,70,192,249,60,128,187,27,228,89,142,184,151,67,158,141,0,110,179,200,107,69,
+    214,149,128,251,17,17,235,183,6,195,245,153,166,238,90,59,193,19,48,134,93,165,182,37,
+    169,82,44,109,253,112,121,54,130,72,130,71,135,232,93,29,34,200,40,30,201,119,61,156,
+    149,46,235,12,89,77,160,198,177,210,128,130,180,58,124,196,228,99,67,154,182,92,160,36,
+    165,127,143,229,155,214,61,39,252,149,47,45,185,208,175,253,2,147,39,95,94,146,15,25,
+    26,98,232,23,190,220,178,108,109,45,175,221,41,162,234,233,30,121,56,72,53,185,209,104,
+    69,62,122,135,170,69,60,89,147,236,40,92,53,168,58,101,163,115,74,221,69,195,99,76,
+    45,146,209,179,144,142,130,217,94,237,20,11,198,105,8,245,80,154,13,209,126,225,126,223,
+    192,28,152,243,131,224,49,7,238,86,51,88,118,220,206,125,100,213,58,157,214,119,39,11,
+    150,52,159,213,81,164,234,42,30,98,27,233,6,188,194,1,56,91,236,203,178,192,79,54,
+    247,38,134,88,58,232,6,236,184,190,59,57,237,213,181,198,141,26,73,247,21,118,87,90,
+    254,91,142,154,58,77,223,156,185,92,250,130,156,67,77,174,226,207,82,77,253,250,235,50,
+    211,129,214,150,192,97,94,96,42,239,75,103,160,19,233,29,252,75,183,100,185,72,46,82,
+    1,232,129,14,220,245,150,104,165,17,16,90,171,94,93,53,91,83,161,187,166,180,142,254,
+    228,203,198,109,173,75,188,196,93,212,114,200,88,102,195,143,118,136,26,0,80,40,78,157,
+    153,169,134,185,167,35,58,120,17,243,61,249,169,19,74,136,232,3,40,50,115,249,164,200,
+    215,90,229,113,238,110,246,153,225,150,48,117,64,210,230,115,209,144,150,224,244,39,132,203,
+    182,58,207,18,73,151,129,132,103,35,70,111,182,66,6,218,16,21,208,235,227,131,172,187,
+    186,178,68,74,23,102,216,82,95,230,25,185,186,233,232,211,21,89,60,122,107,55,201,201,
+    198,183,246,21,161,103,29,239,96,27,246,142,146,190,166,83,219,250,75,122,28,158,94,59,
+    134,191,98,200,152,120,240,29,190,222,92,55,136,238,232,226,64,26,230,166,60,104,197,116,
+    200,69,30,53,155,78,168,101,179,94,182,98,46,224,72,143,154,201,82,52,212,221,19,93,
+    206,211,76,104,215,5,77,13,54,155,133,44,214,123,87,159,1,191,171,196,124,187,249,114,
+    146,35,71,233,246,74,88,55,94,29,222,7,235,194,102,229,187,96,93,152,116,122,15,172,
+    51,163,101,239,128,117,102,178,226,253,47,245,238,149,163,247,170,23,175,228,7,81,198,156,
+    14,49,201,67,69,126,46,247,154,237,202,39,31,200,62,240,192,161,227,139,109,96,74,34,
+    23,116,232,233,136,157,203,163,88,99,112,72,140,157,146,156,196,58,86,214,207,83,171,3,
+    176,93,202,209,195,114,82,158,22,234,211,77,14,90,144,73,141,41,191,234,134,219,19,126,
+    109,138,103,61,182,148,245,128,252,70,158,104,30,73,31,186,229,249,168,121,254,188,126,44,
+    204,193,117,196,60,117,52,122,234,227,11,105,60,6,135,139,253,153,172,134,171,83,216,250,
+    236,151,126,141,179,252,222,76,25,147,6,114,81,244,39,165,170,95,148,130,182,88,224,206,
+    177,1,113,37,163,82,220,128,67,64,24,195,154,5,30,187,6,243,176,247,169,16,150,128,
+    251,229,225,53,53,129,47,88,237,219,85,114,26,3,10,102,85,209,216,157,31,89,111,112,
+    127,118,9,155,31,213,250,66,138,80,213,116,172,222,59,218,136,62,21,70,89,37,175,34,
+    235,162,83,73,186,105,173,126,154,156,174,15,139,181,232,22,246,233,141,40,22,225,197,42,
+    105,145,166,139,74,129,110,211,250,124,172,120,141,47,169,181,168,17,19,228,141,232,145,50,
+    237,85,146,18,81,23,77,34,225,166,85,249,120,9,155,95,47,115,106,19,49,86,56,134,
+    13,20,95,181,250,116,157,218,236,86,202,173,191,103,209,69,185,138,118,179,250,221,136,180,
+    206,207,45,58,117,29,44,96,3,12,199,199,246,119,49,54,160,115,23,219,198,174,171,166,
+    82,253,38,71,139,226,155,223,136,220,172,218,55,39,176,243,107,150,53,205,3,74,35,104,
+    215,246,254,162,252,204,106,203,219,135,242,165,235,255,0,39,190,19,195,236,89,0,0,
+};
+
+// assets/GadgetPainted.glb: 45504 bytes, 23145 gzipped
+static const char NotModified5[] =
+    "HTTP/1.0 304 Not Modified\r\n"
+    "ETag: \"fcefb51dfe0662c1\"\r\n"
+    "\r\n";
+
+// The 200 header, followed by the body
+/*
+HTTP/1.0 200 OK
+Content-Type: model/gltf-binary
+Content-Length: 23145
+Content-Encoding: gzip
+Vary: Accept-Encoding
+ETag: "fcefb51dfe0662c1"
+Cache-Control: no-cache
+
+*/
+static const uint8_t Response5[23318] = {
+    72,84,84,80,47,49,46,48,32,50,48,48,32,79,75,13,10,67,111,110,116,101,110,116,
+    45,84,121,112,101,58,32,109,111,100,101,108,47,103,108,116,102,45,98,105,110,97,114,121,
+    13,10,67,111,110,116,101,110,116,45,76,101,110,103,116,104,58,32,50,51,49,52,53,13,
+    10,67,111,110,116,101,110,116,45,69,110,99,111,100,105,110,103,58,32,103,122,105,112,13,
+    10,86,97,114,121,58,32,65,99,99,101,112,116,45,69,110,99,111,100,105,110,103,13,10,
+    69,84,97,103,58,32,34,102,99,101,102,98,53,49,100,102,101,48,54,54,50,99,49,34,
+    13,10,67,97,99,104,101,45,67,111,110,116,114,111,108,58,32,110,111,45,99,97,99,104,
+    101,13,10,13,10,31,139,8,0,0,0,0,0,2,3,237,189,9,88,77,93,251,63,190,
+    246,62,77,104,162,36,66,33,202,35,52,107,210,96,136,136,50,139,232,52,157,138,230,66,
+    105,56,167,226,225,17,226,49,117,164,129,204,164,72,100,104,30,76,81,162,146,52,16,210,
+    28,141,202,233,252,239,181,183,243,200,243,190,223,247,247,190,255,235,247,187,174,223,239,251,
+    117,221,215,218,247,103,237,125,79,235,94,107,221,107,239,244,244,184,184,175,54,39,17,66,
+    217,215,17,18,19,67,104,201,42,171,229,65,147,237,29,29,157,253,252,188,124,253,38,27,
+    108,12,154,236,176,141,197,114,246,93,235,230,188,99,178,129,134,218,100,71,47,15,111,47,
+    79,103,79,255,213,129,222,206,147,13,116,52,52,181,240,205,109,158,254,147,13,180,180,244,
+    117,213,38,251,83,15,38,175,154,111,102,105,182,114,114,136,218,207,38,212,255,153,9,205,
+    191,76,232,169,131,5,15,251,0,112,173,161,55,71,83,91,77,91,95,119,142,154,150,230,
+    28,221,57,155,224,129,155,39,60,152,73,63,153,73,61,154,41,120,246,221,237,218,133,243,
+    181,254,193,169,230,63,115,170,254,179,211,161,250,106,147,61,189,124,61,236,221,221,118,58,
+    59,77,54,240,247,221,230,252,119,139,90,255,58,19,127,179,168,249,207,44,66,204,246,126,
+    126,206,32,29,52,217,197,217,211,217,215,222,223,203,23,39,110,155,131,159,191,189,167,163,
+    179,146,181,189,155,167,191,179,175,146,166,186,134,222,44,205,89,26,96,101,187,179,175,159,
+    155,23,100,97,178,230,44,117,24,231,144,160,134,78,23,149,103,135,64,127,103,43,22,139,
+    114,241,189,107,233,236,233,226,239,58,217,64,87,91,91,143,190,179,202,223,215,205,9,194,
+    132,174,191,189,175,11,150,213,130,196,106,254,24,240,63,216,250,161,252,151,185,57,250,154,
+    63,235,107,253,11,125,13,45,77,237,191,197,163,165,9,19,250,83,60,218,255,126,60,26,
+    186,218,186,218,255,204,222,191,109,64,95,87,239,111,35,210,208,214,213,210,253,23,42,90,
+    218,90,154,127,243,169,173,163,253,47,53,244,96,213,254,19,141,77,130,57,252,62,127,67,
+    159,107,105,107,170,99,1,55,15,123,23,231,127,220,142,218,120,71,120,56,211,235,143,22,
+    154,237,237,233,242,15,203,95,231,223,148,211,253,175,228,240,214,179,135,149,232,102,239,78,
+    71,97,239,238,237,106,191,204,11,79,212,100,43,107,179,21,107,22,226,21,110,239,129,251,
+    26,234,234,26,127,173,247,213,206,1,254,219,124,157,241,26,119,243,116,114,134,125,13,19,
+    49,217,203,209,209,125,27,94,199,255,248,88,3,30,123,59,248,46,115,246,183,119,119,119,
+    115,92,233,181,205,197,213,19,202,17,22,113,176,247,115,158,239,229,238,229,251,143,106,234,
+    160,230,241,93,199,220,222,145,218,73,234,179,96,82,125,5,6,126,220,213,1,89,103,15,
+    55,63,63,183,237,206,130,187,27,213,103,169,235,168,253,117,217,68,13,217,217,207,245,123,
+    214,191,15,205,219,203,61,112,213,54,95,150,189,163,179,166,221,247,113,122,251,186,121,184,
+    249,131,169,239,153,241,135,5,236,176,205,223,153,138,120,185,213,202,101,102,150,84,1,178,
+    182,90,101,177,218,194,106,57,85,69,87,47,92,63,223,202,106,229,2,59,117,88,24,16,
+    14,140,194,205,17,171,168,255,200,52,221,161,114,172,29,66,5,228,9,29,218,139,163,171,
+    155,187,147,175,51,174,134,26,155,254,202,188,175,151,151,63,68,228,231,104,239,238,76,13,
+    73,111,142,182,190,158,158,174,134,14,20,39,61,216,180,255,198,29,92,73,125,237,61,253,
+    220,237,253,169,58,131,19,67,165,68,79,87,71,93,95,95,83,79,67,125,142,166,174,38,
+    190,181,9,175,159,33,145,104,254,136,100,104,162,168,101,134,115,73,13,232,95,100,242,111,
+    126,213,230,204,210,214,1,191,234,186,206,51,213,245,213,212,55,253,24,153,22,196,163,161,
+    7,241,104,195,35,29,181,127,217,165,50,231,103,239,225,237,46,216,98,176,174,205,221,220,
+    253,241,30,213,159,163,169,79,29,43,127,221,208,215,131,221,178,195,215,222,123,21,76,148,
+    186,182,254,28,186,183,250,123,143,50,230,8,213,154,26,12,133,126,90,33,171,168,103,63,
+    166,74,157,114,239,79,175,87,90,242,123,44,180,1,175,109,190,142,206,212,242,253,231,15,
+    52,254,171,7,154,216,46,152,117,246,196,251,200,111,141,31,62,87,54,78,94,186,120,165,
+    29,206,181,157,207,54,123,79,127,183,157,116,54,127,18,93,233,236,179,205,205,247,95,138,
+    135,40,41,41,157,186,132,208,60,139,229,232,107,227,116,137,12,91,132,170,154,167,75,120,
+    50,17,90,80,59,93,98,183,19,66,226,13,211,37,74,108,16,218,88,63,93,162,109,29,
+    125,127,241,186,159,251,88,110,102,21,221,15,174,160,229,5,253,131,47,105,187,73,165,180,
+    93,209,82,90,30,247,79,185,210,207,151,185,211,122,6,94,180,222,120,31,218,110,174,15,
+    237,7,247,113,28,248,57,142,19,203,227,56,177,62,167,133,182,87,213,252,96,20,182,47,
+    136,95,48,158,175,141,15,70,97,46,24,135,120,195,131,81,67,199,179,177,254,193,168,161,
+    227,90,80,251,96,20,230,130,248,103,86,209,207,5,227,10,174,160,245,5,227,58,248,146,
+    182,47,24,95,82,41,29,135,96,156,162,208,31,58,94,252,124,232,184,177,254,208,241,99,
+    251,67,243,128,253,15,205,7,142,111,104,94,112,252,67,243,131,199,55,52,79,120,252,67,
+    243,133,243,52,52,111,156,22,58,62,65,222,4,121,52,107,118,145,73,0,190,189,209,69,
+    102,252,38,236,215,69,134,26,199,71,23,153,85,27,16,154,94,239,34,179,119,61,125,191,
+    9,242,99,87,69,247,171,42,232,231,35,203,104,189,69,47,104,59,151,74,105,125,220,223,
+    226,74,63,111,219,74,203,167,123,210,250,225,222,180,61,37,31,218,62,238,99,127,248,57,
+    142,3,203,227,184,176,126,109,51,109,111,100,139,29,197,189,155,237,100,14,129,31,227,150,
+    197,84,63,166,121,177,76,4,244,29,90,166,82,253,140,230,169,50,59,152,63,238,11,228,
+    94,52,247,141,242,134,126,96,75,31,149,135,248,70,59,25,62,204,103,94,227,98,153,247,
+    67,184,64,79,96,167,174,113,170,76,177,237,15,253,206,198,190,81,185,208,127,252,209,78,
+    230,55,24,255,251,143,139,101,68,134,240,254,143,83,101,26,97,221,136,54,244,141,42,7,
+    174,87,111,39,99,3,249,50,175,95,44,51,107,8,95,81,63,85,70,28,184,77,125,223,
+    168,30,106,61,218,201,164,175,251,241,124,65,237,98,153,200,33,247,127,244,167,202,184,80,
+    188,111,148,53,112,171,42,218,190,128,155,85,209,250,2,174,91,69,251,153,93,69,251,201,
+    172,160,227,22,60,79,172,160,227,22,240,131,21,116,252,97,21,116,252,141,47,233,60,229,
+    191,164,243,35,224,23,94,210,121,57,246,146,206,135,252,11,122,94,90,75,233,252,9,248,
+    147,82,58,143,105,165,116,254,118,148,210,243,184,164,116,241,79,124,90,41,61,127,82,165,
+    244,252,96,123,59,93,105,59,123,135,112,108,239,136,43,109,239,164,43,29,223,8,119,58,
+    174,105,67,56,142,207,208,157,142,111,177,59,61,238,58,79,122,156,194,94,63,56,30,239,
+    36,47,122,188,218,94,116,30,175,123,211,249,121,51,132,227,60,14,122,211,121,148,245,161,
+    231,101,165,15,61,47,236,159,248,84,153,68,31,122,126,238,250,208,243,143,237,225,121,125,
+    51,132,227,249,199,246,240,252,99,123,120,61,225,248,240,58,194,113,9,56,94,79,56,62,
+    188,158,112,124,120,221,226,241,226,245,58,109,8,199,235,20,143,23,175,79,60,94,188,79,
+    112,254,240,122,222,59,132,227,117,141,243,135,215,51,206,159,169,22,93,223,38,235,208,117,
+    33,82,149,174,23,171,212,233,58,120,70,141,174,143,248,62,174,151,67,251,88,206,95,153,
+    238,231,41,209,242,130,126,217,4,218,110,151,2,109,119,185,2,45,143,251,184,46,225,231,
+    184,94,97,61,92,199,176,30,174,111,216,46,174,123,216,15,238,227,56,240,115,28,39,150,
+    199,113,98,253,7,58,180,189,201,58,116,29,19,196,47,24,143,169,22,93,175,5,227,88,
+    165,78,215,115,65,252,103,212,232,122,47,24,87,164,42,125,30,8,226,247,87,166,159,11,
+    198,149,167,68,235,11,198,85,54,129,182,47,24,95,151,2,29,135,96,156,203,21,232,122,
+    43,24,47,126,62,116,220,88,127,232,248,177,253,161,121,192,254,135,230,3,199,55,52,47,
+    56,254,161,249,193,227,27,154,39,60,254,161,249,194,121,26,154,183,7,58,116,124,130,188,
+    9,242,184,87,155,174,227,25,154,116,93,143,84,165,235,111,231,108,186,222,123,171,209,245,
+    31,223,199,231,193,121,101,186,63,121,18,253,124,253,68,90,239,224,120,218,78,135,2,173,
+    143,251,184,158,227,231,184,190,99,121,92,239,177,62,174,255,216,30,62,15,176,125,220,199,
+    254,240,115,28,7,150,199,113,97,253,105,58,180,189,245,58,116,29,185,173,77,215,157,221,
+    58,116,29,121,167,77,215,157,75,58,116,61,17,210,161,235,143,224,190,64,110,156,14,93,
+    143,178,117,232,122,243,81,147,174,115,195,181,232,250,38,224,2,61,129,29,21,45,186,238,
+    9,244,13,180,232,250,55,82,157,174,171,51,212,233,58,42,224,166,234,116,61,93,174,78,
+    215,83,182,26,93,167,15,168,209,245,87,192,163,213,232,58,157,160,70,215,233,72,85,186,
+    238,11,158,71,170,210,245,95,112,255,71,159,62,15,34,85,233,243,224,184,50,109,95,192,
+    247,42,211,250,2,30,162,76,251,217,174,76,251,17,158,68,199,45,120,222,164,68,199,45,
+    224,101,74,116,252,15,149,232,248,213,39,210,121,26,49,145,206,143,128,183,77,160,243,242,
+    102,2,157,143,205,227,233,121,209,30,79,231,79,192,71,142,167,243,248,77,129,206,95,166,
+    2,61,143,135,21,22,255,196,61,20,232,249,91,171,64,207,15,182,135,235,25,182,179,119,
+    8,199,246,112,61,195,246,112,61,195,241,225,250,136,227,154,54,132,227,248,112,125,196,241,
+    225,250,136,199,141,235,45,30,39,174,179,2,142,199,139,235,45,30,47,174,183,56,143,184,
+    126,227,252,188,25,194,113,30,113,253,198,121,148,245,161,231,101,165,15,61,47,236,159,56,
+    125,30,224,249,193,231,1,158,127,108,15,207,235,155,33,28,207,63,182,135,231,31,219,195,
+    235,9,199,135,215,17,142,75,192,241,122,194,241,225,245,132,227,195,235,22,143,23,175,215,
+    105,67,56,94,167,120,188,120,125,226,241,226,125,130,243,135,215,243,222,33,28,175,107,156,
+    63,188,158,113,254,130,11,184,45,8,209,92,59,0,161,222,236,130,127,224,130,231,152,11,
+    250,245,247,23,180,226,231,67,185,224,62,230,23,238,12,111,195,247,135,114,193,253,161,207,
+    143,220,22,106,255,59,31,42,247,230,214,216,14,124,31,115,220,223,101,48,182,131,207,198,
+    241,8,184,80,123,44,27,223,167,121,112,193,240,182,240,80,220,255,153,11,238,7,23,44,
+    104,125,20,140,239,255,204,5,247,131,11,10,90,98,119,254,224,187,12,4,92,32,47,120,
+    78,231,107,151,1,205,223,220,146,19,167,227,31,219,129,159,31,185,45,39,142,249,133,59,
+    99,59,176,222,133,59,114,226,152,215,223,31,219,129,227,168,191,47,39,142,121,111,54,200,
+    179,49,7,121,42,126,57,113,60,46,101,11,122,188,152,99,187,30,139,233,252,96,142,239,
+    219,152,211,249,195,28,247,39,204,167,231,1,115,65,127,232,253,97,38,244,124,98,78,231,
+    145,251,157,211,254,134,153,208,113,12,51,161,227,152,48,159,142,115,194,124,58,78,27,115,
+    122,28,54,230,244,56,60,22,211,227,244,88,76,143,83,217,130,30,255,46,131,99,82,152,
+    7,23,8,248,22,41,58,127,52,15,46,104,146,164,243,72,243,224,2,101,73,122,158,104,
+    30,92,48,67,130,158,79,1,63,38,149,134,112,92,91,164,232,248,183,72,225,184,107,13,
+    247,82,60,197,112,191,212,70,224,26,134,135,165,98,169,241,54,73,210,121,104,146,164,243,
+    164,44,73,231,73,249,175,254,208,251,30,139,103,72,8,56,157,111,57,113,122,157,211,126,
+    48,47,218,131,231,171,73,82,192,233,245,169,76,245,49,23,244,135,222,63,114,123,134,132,
+    128,211,235,88,78,28,247,49,23,228,157,224,208,243,77,243,25,18,142,28,122,220,142,28,
+    58,47,161,97,116,94,48,199,121,155,19,65,231,13,115,156,87,199,221,116,94,49,199,251,
+    131,246,39,39,142,251,120,29,98,142,215,29,150,199,235,240,103,78,223,199,235,16,219,199,
+    235,18,115,188,14,177,127,188,46,233,56,198,118,16,28,122,223,97,142,215,135,35,135,94,
+    47,152,227,245,129,245,240,122,193,28,175,15,108,23,175,151,159,57,125,31,175,23,28,23,
+    94,63,152,227,124,227,184,241,58,199,28,175,75,204,241,254,162,121,65,11,61,78,154,227,
+    125,74,231,129,230,120,95,211,121,162,57,174,7,116,30,105,142,215,33,94,63,120,30,232,
+    58,68,207,187,128,227,249,164,235,28,189,190,138,243,233,117,100,157,79,175,171,73,249,244,
+    58,195,235,3,199,131,215,205,80,142,215,25,230,120,93,210,249,23,106,167,215,197,240,182,
+    161,28,215,69,204,113,253,164,229,105,142,247,39,109,143,150,19,236,103,65,31,239,119,204,
+    39,167,203,181,251,195,254,233,184,163,212,38,187,243,71,223,56,99,109,171,236,144,251,11,
+    114,26,90,240,253,190,156,181,173,209,193,152,43,181,109,12,253,209,95,144,35,215,190,130,
+    253,131,11,234,167,160,158,10,234,145,113,134,89,251,198,208,31,245,170,227,142,89,123,116,
+    240,143,122,38,118,111,115,155,4,240,249,153,220,86,137,33,125,65,28,130,251,243,51,55,
+    183,21,134,252,232,223,55,166,227,203,157,71,199,45,109,78,203,11,250,53,139,232,113,73,
+    155,211,254,114,231,209,113,220,55,166,227,21,51,166,199,35,102,76,143,231,239,253,12,179,
+    127,238,71,112,191,111,1,29,167,160,159,97,70,199,39,232,47,200,89,36,69,231,181,82,
+    146,206,171,164,36,157,111,121,9,255,33,253,142,59,173,226,216,159,113,70,171,56,246,191,
+    32,71,94,2,199,215,151,35,41,73,231,187,82,50,154,26,255,113,73,58,63,37,18,116,
+    62,74,36,176,191,154,69,180,61,105,115,218,94,238,60,218,159,160,127,223,152,142,67,204,
+    152,182,35,102,76,219,189,111,76,251,201,157,71,251,149,54,167,227,232,91,64,219,207,48,
+    163,253,101,152,209,126,112,220,251,119,211,113,183,236,166,199,213,50,164,143,199,139,159,227,
+    120,93,35,232,248,207,133,209,227,73,230,208,227,195,125,60,94,252,92,192,241,120,58,35,
+    232,241,117,254,212,47,145,48,8,167,199,131,237,227,113,96,251,120,92,184,143,199,61,180,
+    143,227,199,246,240,120,176,31,65,31,143,19,251,199,227,198,247,113,30,240,125,60,62,236,
+    7,143,119,40,199,227,197,126,241,250,223,191,155,222,23,244,56,149,218,48,199,251,101,255,
+    144,62,94,207,216,30,94,231,244,248,232,62,222,23,216,47,222,55,248,62,222,55,174,17,
+    244,250,165,199,185,185,109,40,199,235,27,251,197,235,150,30,23,109,31,175,187,150,33,125,
+    188,30,241,115,188,78,169,252,25,211,246,241,186,198,254,240,58,167,199,79,199,33,224,120,
+    189,210,227,163,253,255,232,211,126,131,11,230,74,210,239,103,90,84,29,178,44,168,149,188,
+    129,235,75,193,85,234,254,227,252,245,82,30,208,63,150,63,142,170,99,10,249,65,82,82,
+    84,157,21,232,9,120,138,164,17,117,46,209,60,184,96,138,84,32,213,167,185,160,142,10,
+    206,227,15,134,180,157,155,6,180,63,129,95,65,28,187,12,104,174,107,72,251,23,112,65,
+    60,2,121,129,126,175,1,29,175,160,47,208,23,196,185,213,144,142,127,108,1,41,165,57,
+    36,94,65,252,130,241,94,206,183,148,154,59,164,126,15,43,88,46,229,129,126,212,245,6,
+    3,90,95,224,79,96,95,48,238,94,3,90,94,240,62,177,214,144,182,39,120,207,184,90,
+    104,47,229,185,151,230,155,249,8,173,214,255,193,241,253,224,2,191,97,67,243,250,195,62,
+    125,255,7,23,220,23,140,211,111,216,80,142,237,252,204,105,185,31,243,69,219,217,104,80,
+    37,214,4,254,207,21,208,124,181,254,124,49,28,207,213,66,154,203,22,186,139,37,3,111,
+    209,255,153,11,238,99,253,183,123,126,216,193,250,120,28,88,110,194,223,184,64,190,105,136,
+    30,246,43,208,199,28,251,197,250,216,254,132,33,92,96,71,16,167,64,79,16,135,64,78,
+    144,87,65,252,130,241,12,205,243,207,247,105,127,130,252,255,224,244,125,65,60,67,231,237,
+    231,251,130,124,209,118,17,34,16,137,24,192,73,36,4,156,68,194,72,4,137,34,49,224,
+    162,104,24,26,14,119,70,0,39,145,56,112,18,73,0,39,145,36,112,18,73,1,39,145,
+    52,112,18,141,4,78,162,81,192,73,36,3,156,68,178,192,73,52,26,56,137,228,128,147,
+    104,12,112,18,252,141,129,171,60,26,139,198,1,41,0,82,0,62,30,104,2,160,9,192,
+    39,2,41,2,82,4,174,4,52,9,208,36,224,147,129,166,0,154,2,92,25,104,42,160,
+    169,192,167,1,169,0,82,1,174,10,52,29,208,116,224,191,1,205,0,52,3,184,26,208,
+    76,64,51,129,207,2,154,13,104,54,112,117,32,13,64,26,192,53,129,180,0,105,1,215,
+    6,210,1,164,3,92,23,104,14,160,57,192,245,128,244,1,233,3,55,0,50,4,100,8,
+    220,8,104,46,160,185,192,141,129,76,0,153,0,55,5,50,3,52,15,205,71,11,160,45,
+    132,235,66,100,14,87,115,180,8,174,139,208,98,184,46,70,22,112,181,64,75,224,186,4,
+    45,133,235,82,100,9,87,75,180,12,174,203,208,114,184,46,71,86,112,181,66,214,112,181,
+    70,43,224,186,2,173,132,235,74,180,10,174,171,208,106,184,174,70,107,224,186,6,173,133,
+    235,90,240,185,0,173,67,235,129,207,131,222,58,100,131,54,64,111,61,133,54,34,91,180,
+    9,104,51,32,19,136,208,14,136,9,136,9,220,22,104,35,160,249,160,135,229,237,1,217,
+    3,223,0,228,0,200,17,57,33,103,32,22,32,22,112,23,32,87,64,174,192,229,169,249,
+    116,133,49,98,29,123,228,6,200,13,184,3,208,22,64,91,41,29,22,114,7,228,78,233,
+    184,34,15,64,30,192,21,168,249,247,128,204,96,29,55,228,9,200,19,248,22,32,47,64,
+    222,148,142,59,242,1,228,67,233,120,32,95,64,190,192,39,80,235,197,23,242,137,117,60,
+    145,31,32,63,224,94,200,31,109,67,219,209,14,74,199,7,5,0,10,160,116,124,81,32,
+    160,64,224,138,212,250,10,132,89,192,58,126,104,39,160,32,208,217,6,20,12,40,132,210,
+    9,64,161,128,66,41,157,64,196,6,196,6,62,137,90,143,108,152,187,197,160,183,19,113,
+    0,113,128,135,1,133,3,138,160,116,66,209,46,64,187,40,29,54,218,13,104,55,240,41,
+    212,250,221,13,51,142,117,56,232,119,64,191,3,15,7,218,3,104,47,165,179,11,253,1,
+    232,15,74,103,55,218,7,104,31,240,169,212,122,223,7,235,4,235,252,142,34,1,69,2,
+    223,3,180,31,208,1,74,231,15,116,16,208,65,74,103,31,138,2,20,5,92,133,218,31,
+    81,176,186,176,78,36,58,4,232,16,240,253,64,135,1,253,73,233,28,68,71,0,29,161,
+    116,162,208,81,64,71,129,79,167,246,211,81,88,147,88,231,16,58,6,232,24,240,195,64,
+    199,1,157,160,116,142,160,104,64,209,148,206,81,196,5,196,5,62,131,218,127,92,88,201,
+    88,231,24,58,9,232,36,240,227,64,49,128,78,81,58,209,40,22,80,44,165,195,69,113,
+    128,226,128,207,164,246,107,28,172,127,172,115,18,197,3,138,7,30,3,148,0,232,52,165,
+    19,139,206,0,58,67,233,196,161,68,64,137,192,103,83,251,59,17,118,13,214,137,71,103,
+    1,157,5,158,0,116,14,208,121,74,231,12,186,0,232,2,165,147,136,46,2,186,8,92,
+    131,170,7,23,97,175,97,157,179,232,18,160,75,192,207,1,93,6,116,133,210,185,128,174,
+    2,186,74,233,92,68,73,128,146,128,107,81,245,35,9,118,40,214,185,132,174,1,186,6,
+    252,50,80,50,160,20,74,231,42,186,14,232,58,165,147,132,110,0,186,1,92,135,170,55,
+    55,96,95,99,157,107,40,21,80,42,240,100,160,155,128,210,40,157,235,232,22,160,91,148,
+    206,13,116,27,208,109,224,115,168,250,116,27,170,1,214,73,69,233,128,210,129,223,4,186,
+    3,232,46,165,115,11,221,3,116,143,210,185,141,238,3,186,15,92,159,170,103,247,161,134,
+    96,157,116,148,1,40,3,248,29,160,76,64,89,148,206,61,148,13,40,155,210,185,143,114,
+    0,229,0,55,164,234,95,14,212,26,172,147,1,117,6,87,157,12,208,203,132,138,179,14,
+    106,13,214,201,134,218,130,171,14,214,201,129,42,131,43,77,14,232,205,165,170,79,46,202,
+    67,249,168,0,120,62,42,4,158,143,30,160,135,232,17,122,12,252,17,122,130,138,224,206,
+    83,224,249,232,25,240,124,84,12,60,31,149,0,207,71,207,129,231,163,82,224,249,232,5,
+    240,124,244,18,120,62,42,3,158,143,202,129,231,163,10,224,249,232,21,240,124,84,9,60,
+    31,252,85,194,245,53,170,66,111,128,170,1,85,3,175,1,170,5,84,11,188,14,232,45,
+    160,183,192,223,1,213,3,170,7,254,30,232,3,160,15,192,63,2,53,0,106,0,254,9,
+    168,17,80,35,240,38,160,102,64,205,192,91,128,90,1,181,2,111,3,106,7,212,14,188,
+    3,232,51,160,207,192,191,0,117,2,234,4,222,5,212,13,168,27,120,15,80,47,160,94,
+    224,125,64,95,1,125,5,222,15,52,0,104,0,248,55,32,30,32,30,240,65,32,62,32,
+    62,112,56,114,9,130,224,195,5,17,36,16,3,122,66,132,48,33,2,77,20,174,162,132,
+    24,92,197,136,97,112,29,70,12,135,235,112,98,4,92,71,16,226,112,21,39,36,224,42,
+    65,72,194,85,146,144,130,171,20,33,13,87,105,98,36,92,71,18,163,224,58,138,144,129,
+    171,12,33,11,87,89,98,52,92,71,19,114,112,149,35,198,192,117,12,33,15,87,121,240,
+    41,66,140,37,198,1,23,130,222,88,66,129,24,15,189,113,20,154,64,76,36,20,129,148,
+    0,17,16,225,36,160,201,128,38,3,159,8,52,1,144,48,232,97,249,41,128,166,0,31,
+    15,164,12,104,42,49,141,80,1,82,5,164,10,124,58,208,111,128,126,3,254,154,154,207,
+    223,96,140,88,103,10,49,3,208,12,224,202,64,106,128,102,82,58,170,196,44,64,179,40,
+    157,223,136,217,128,102,3,175,166,230,127,54,100,6,235,204,32,212,1,169,3,87,3,210,
+    0,164,73,233,204,34,180,0,105,81,58,179,9,109,64,218,192,107,169,245,162,13,249,196,
+    58,234,132,14,32,29,224,26,132,46,49,135,208,35,244,41,29,45,194,0,144,1,165,163,
+    77,24,2,50,4,254,150,90,95,134,48,11,88,71,135,48,2,52,23,116,230,0,25,3,
+    50,161,116,12,8,83,64,166,148,142,33,97,6,200,12,120,61,181,30,205,96,238,134,131,
+    158,17,49,15,208,60,224,243,129,22,0,90,72,233,152,18,230,128,204,41,29,51,98,17,
+    160,69,192,63,80,235,119,17,204,56,214,153,71,44,6,180,24,248,2,32,11,64,75,40,
+    29,115,98,41,160,165,148,206,34,194,18,144,37,240,6,106,189,91,194,58,193,58,139,137,
+    101,128,150,1,183,0,90,14,200,138,210,89,74,88,3,178,166,116,44,137,21,128,86,0,
+    111,164,246,199,10,88,93,88,103,25,177,18,208,74,224,203,129,86,1,90,77,233,88,19,
+    107,0,173,161,116,86,16,107,1,173,5,222,76,237,167,181,176,38,177,206,74,98,29,160,
+    117,192,87,1,173,7,100,67,233,172,33,54,0,218,64,233,172,37,54,2,218,8,188,149,
+    218,127,27,97,37,99,157,117,132,45,32,91,224,235,129,54,1,218,76,233,108,32,236,0,
+    217,81,58,27,9,38,32,38,240,118,106,191,50,97,253,99,29,91,194,30,144,61,240,77,
+    64,14,128,28,41,29,59,194,9,144,19,165,195,36,156,1,57,3,255,76,237,111,103,216,
+    53,88,199,158,96,1,98,1,119,0,114,1,228,74,233,56,17,110,128,220,40,29,103,98,
+    11,160,45,192,59,169,122,176,5,246,26,214,97,17,91,1,109,5,238,2,228,14,200,131,
+    210,113,35,60,1,121,82,58,91,8,47,64,94,192,187,169,250,225,5,59,20,235,108,37,
+    188,1,121,3,119,7,242,1,228,75,233,120,18,126,128,252,40,29,47,194,31,144,63,240,
+    94,170,222,248,195,190,198,58,222,196,54,64,219,128,251,0,109,7,180,131,210,241,35,2,
+    0,5,80,58,254,68,32,160,64,224,95,169,250,20,8,213,0,235,108,35,118,2,218,9,
+    124,59,80,16,160,96,74,39,128,8,1,20,66,233,4,18,161,128,66,129,15,80,245,44,
+    20,106,8,214,217,73,176,1,177,129,7,1,113,0,133,81,58,33,68,56,160,112,74,39,
+    148,136,0,20,1,156,71,213,191,8,168,53,88,135,13,117,6,87,29,54,232,113,160,226,
+    140,133,90,131,117,194,161,182,224,170,131,117,34,160,202,224,74,19,1,213,18,215,203,201,
+    196,46,98,55,241,59,177,135,216,75,252,65,236,3,20,73,236,39,14,64,239,32,160,40,
+    226,16,113,24,122,127,18,71,136,163,196,49,226,56,113,2,218,49,34,26,136,11,232,36,
+    17,67,156,2,138,5,20,11,60,14,40,30,80,2,113,154,56,3,148,8,232,44,113,142,
+    56,79,92,32,46,18,151,136,203,128,118,19,87,136,171,208,75,2,27,215,128,146,1,37,
+    3,79,1,186,14,232,58,240,27,64,169,128,82,129,223,4,74,3,148,6,60,6,232,22,
+    160,219,68,58,113,7,232,46,160,187,192,239,1,221,7,116,31,120,6,80,38,160,44,34,
+    155,200,1,202,5,148,11,252,42,80,30,160,124,136,181,0,168,16,80,33,240,7,64,15,
+    1,61,4,254,8,232,49,160,199,192,159,0,21,1,42,2,158,14,244,20,208,51,162,152,
+    40,1,122,14,232,57,240,82,160,23,128,94,0,127,9,84,6,168,12,120,57,80,5,160,
+    10,224,183,128,242,1,189,2,157,74,160,215,68,21,92,171,136,55,112,125,67,84,195,181,
+    26,158,189,6,94,3,84,11,168,22,120,29,208,91,64,239,136,122,226,61,208,7,64,31,
+    128,63,5,250,8,168,129,248,68,52,2,53,1,106,2,222,12,212,2,168,149,104,35,218,
+    129,58,0,117,0,255,12,244,5,80,39,209,69,116,3,245,0,234,1,222,11,212,7,168,
+    15,248,87,160,126,64,253,192,7,128,190,1,226,129,222,32,16,31,16,31,56,124,208,194,
+    193,202,39,72,146,65,10,1,9,147,36,52,33,82,4,72,20,144,40,240,46,240,33,6,
+    104,24,217,73,12,39,135,147,35,0,141,0,46,14,36,1,72,2,184,36,144,20,32,105,
+    114,36,57,10,72,6,144,12,112,89,160,209,128,228,200,49,164,60,208,88,64,99,129,143,
+    3,82,0,164,0,124,60,208,4,64,19,128,79,4,82,4,164,8,92,12,104,24,160,91,
+    176,58,78,2,229,67,198,197,32,154,78,160,97,240,236,15,98,12,88,147,35,243,96,133,
+    203,146,31,97,205,220,38,70,131,191,207,48,54,46,208,23,24,171,18,89,12,243,243,12,
+    102,66,137,124,10,179,141,101,62,66,174,175,128,78,30,208,85,64,73,32,137,229,163,41,
+    148,68,76,34,39,145,29,84,118,39,145,147,129,112,198,91,136,41,164,50,80,19,53,27,
+    202,228,84,160,6,106,150,166,130,135,98,176,62,13,248,52,82,5,174,42,164,42,92,85,
+    225,249,71,136,107,58,208,7,106,110,167,147,191,1,225,249,126,75,204,32,213,128,106,169,
+    181,160,70,206,4,194,235,131,11,145,207,34,103,145,199,169,93,56,139,156,13,132,119,230,
+    97,66,157,212,0,58,64,237,90,13,82,19,104,47,181,155,53,33,175,99,32,19,123,97,
+    44,114,164,22,80,46,181,27,180,72,109,160,44,106,151,104,147,58,64,186,208,187,79,204,
+    33,245,128,238,82,187,74,15,102,102,52,137,119,154,62,121,141,218,251,199,0,25,144,134,
+    228,81,168,10,71,8,3,210,136,156,75,70,65,181,136,36,140,72,99,232,69,2,250,157,
+    48,6,252,59,236,247,221,176,235,141,73,19,232,157,7,116,142,48,33,77,73,51,18,215,
+    135,211,132,41,57,15,122,167,161,110,156,34,230,3,94,64,46,4,50,7,180,8,154,57,
+    208,98,64,22,208,22,3,45,1,100,8,109,9,153,2,21,67,159,92,74,245,13,33,150,
+    165,164,37,185,140,92,14,113,24,145,86,64,56,14,236,211,138,180,38,87,128,55,51,240,
+    98,13,132,253,97,219,214,160,97,13,28,219,94,10,180,2,122,43,201,139,84,149,200,33,
+    86,146,171,160,135,171,71,54,177,138,92,77,174,33,113,85,185,71,172,38,215,66,15,87,
+    155,59,196,90,192,119,168,202,240,4,240,58,232,225,138,241,136,88,71,174,135,30,174,36,
+    15,136,245,164,13,244,112,133,41,32,108,0,23,80,235,51,22,240,6,232,197,2,138,39,
+    54,144,27,73,91,50,1,42,101,34,177,17,188,110,34,47,65,165,188,8,49,108,6,188,
+    146,180,35,153,164,61,233,64,58,66,20,107,192,187,3,16,142,3,251,116,32,157,160,173,
+    35,177,79,39,32,236,15,219,118,2,105,39,224,182,96,219,25,48,150,99,145,37,4,94,
+    129,83,1,185,64,195,43,83,25,144,43,52,188,98,167,0,114,35,183,80,43,121,18,32,
+    55,184,38,81,181,217,141,220,10,189,100,170,54,111,37,221,161,119,157,170,205,238,164,7,
+    244,82,169,218,236,1,56,141,170,117,229,128,61,161,135,107,224,75,194,147,244,130,30,174,
+    141,165,132,23,120,245,34,113,205,44,33,88,164,55,137,251,56,22,111,210,7,154,11,21,
+    139,15,208,22,202,251,86,64,190,208,182,146,216,167,47,16,246,135,109,251,130,180,47,112,
+    108,219,155,210,246,37,253,200,34,170,54,190,39,252,72,127,232,225,154,89,79,248,147,219,
+    200,237,36,174,165,53,196,54,114,7,244,112,141,173,36,118,0,174,164,246,251,115,192,1,
+    208,123,78,85,241,0,50,16,122,47,168,42,30,72,238,132,94,25,85,197,119,2,174,128,
+    186,130,79,140,157,100,16,244,10,169,19,35,136,12,134,222,67,234,196,8,6,175,193,228,
+    99,234,196,240,35,67,72,220,199,177,132,144,161,208,182,3,109,3,20,74,226,56,176,207,
+    80,146,13,45,128,196,62,217,64,216,31,182,205,6,105,54,112,108,59,132,210,102,147,28,
+    114,144,170,228,237,4,135,12,131,30,174,240,109,68,24,25,78,70,144,184,242,55,18,225,
+    228,46,232,225,19,225,19,177,139,220,13,61,92,201,191,18,187,201,223,161,135,43,124,47,
+    241,59,185,7,122,184,242,119,19,123,0,119,19,184,98,139,0,218,11,13,87,114,33,64,
+    127,64,195,21,158,1,136,67,238,35,113,229,31,4,191,145,128,57,36,246,31,73,238,39,
+    15,128,231,8,240,184,31,8,251,198,62,247,147,7,161,237,38,177,207,131,64,216,31,182,
+    125,16,164,15,2,199,182,15,0,97,185,40,242,16,85,205,212,0,29,134,134,171,220,12,
+    64,127,146,71,168,234,55,29,208,159,112,197,231,194,40,64,71,161,225,243,98,36,160,99,
+    228,113,234,28,17,7,116,2,26,62,95,134,3,58,1,215,78,234,124,59,65,70,67,175,
+    135,58,223,162,73,46,244,250,168,243,141,11,94,185,100,63,160,111,196,33,242,36,137,251,
+    135,192,251,73,50,6,90,20,21,75,12,121,10,98,248,147,242,121,138,140,133,254,113,160,
+    99,128,98,41,127,216,118,44,72,199,2,199,182,79,82,218,177,100,28,156,86,184,198,106,
+    2,138,135,134,107,175,6,160,4,104,184,38,171,3,58,77,158,161,106,245,44,64,167,225,
+    202,163,78,215,211,100,34,244,248,128,8,64,103,201,115,36,73,157,174,103,201,243,208,132,
+    169,211,245,60,144,40,117,210,77,4,116,1,26,62,1,199,3,186,8,13,159,140,227,0,
+    197,65,195,39,166,60,160,75,84,31,199,114,137,188,12,45,158,138,229,50,121,5,98,192,
+    222,19,1,93,133,254,57,160,179,128,174,82,254,176,237,171,32,125,21,56,182,125,137,210,
+    190,74,38,193,217,140,79,1,61,64,215,160,225,211,97,14,160,100,50,133,58,53,180,1,
+    93,135,134,79,19,45,64,215,225,42,71,157,225,215,201,27,208,198,82,103,248,13,50,21,
+    154,2,117,134,167,146,55,161,77,160,206,240,155,64,138,112,134,227,247,133,155,100,26,180,
+    17,212,251,66,26,121,11,154,4,144,20,160,36,242,54,188,45,224,247,133,36,50,29,112,
+    18,21,75,58,121,135,188,11,81,164,128,247,59,64,201,148,247,27,128,238,65,187,65,249,
+    188,7,148,74,121,73,3,116,23,90,26,101,251,46,16,150,187,79,102,144,153,64,89,128,
+    178,128,103,3,229,0,202,1,158,11,164,10,40,143,204,39,11,128,10,1,21,2,127,0,
+    244,16,208,67,224,143,128,30,3,82,5,217,79,176,3,27,224,84,255,6,251,15,235,62,
+    1,244,154,152,9,252,9,89,5,104,23,72,224,251,3,128,14,193,51,124,127,38,160,34,
+    242,41,249,12,168,24,208,19,120,142,99,40,1,244,156,44,37,95,0,189,4,84,70,150,
+    147,21,64,175,0,85,129,102,9,80,37,160,74,224,229,64,101,208,123,77,86,145,111,128,
+    170,1,213,64,171,6,202,1,84,3,87,85,160,90,64,117,208,106,129,222,2,170,131,43,
+    142,255,1,160,215,208,240,184,170,0,189,166,228,222,145,245,228,123,160,15,128,62,66,251,
+    0,244,16,208,71,184,62,6,106,0,244,9,90,3,80,35,160,79,112,173,194,111,184,128,
+    222,65,171,4,170,7,244,142,146,107,34,155,201,22,160,86,64,109,100,59,217,1,244,25,
+    208,23,178,147,236,2,234,6,212,3,25,192,121,232,5,212,71,126,37,251,129,6,0,125,
+    35,121,32,217,6,242,223,200,65,146,143,255,73,135,65,48,6,225,133,148,193,224,193,179,
+    111,128,132,24,194,140,47,96,163,155,20,98,136,192,51,2,36,68,1,137,49,134,49,134,
+    3,141,0,36,206,144,96,244,128,237,94,82,156,33,9,207,68,129,164,0,73,51,70,194,
+    19,9,120,46,205,232,3,143,163,24,163,24,50,128,100,128,203,2,141,134,158,20,248,228,
+    131,111,73,64,114,140,49,12,121,160,177,128,198,49,20,24,227,129,38,0,154,200,80,100,
+    40,1,77,2,52,153,49,133,161,12,52,21,16,10,67,232,255,100,11,36,42,81,32,170,
+    68,46,40,13,185,16,105,104,41,226,162,165,4,23,169,160,61,72,133,216,67,11,17,97,
+    32,177,7,85,66,63,13,158,167,17,248,39,208,128,64,126,15,126,2,54,40,115,4,194,
+    90,208,87,193,86,224,249,82,108,21,228,93,16,229,133,192,255,130,204,6,123,108,144,10,
+    4,251,129,32,229,2,254,240,191,148,0,2,249,64,252,4,244,217,88,18,236,225,216,112,
+    140,4,173,134,232,7,252,127,104,248,119,86,254,222,40,3,127,107,2,59,184,77,15,64,
+    72,37,160,19,45,101,33,180,152,213,136,92,150,32,228,176,164,142,194,248,158,159,74,21,
+    10,84,65,104,82,192,39,52,151,245,146,106,248,25,150,89,181,36,143,122,238,160,114,7,
+    201,7,212,34,53,86,30,213,230,46,73,66,139,84,226,144,68,64,37,26,195,74,167,154,
+    210,146,56,52,85,229,0,66,1,21,84,31,177,210,40,76,241,37,92,8,98,15,234,4,
+    121,220,26,225,57,110,117,160,83,5,58,159,192,54,238,191,4,219,184,229,129,253,59,96,
+    191,22,98,202,131,120,112,75,130,88,226,32,142,74,24,75,58,196,135,91,28,196,120,0,
+    226,171,128,49,166,177,232,198,133,241,237,129,241,84,6,72,128,204,24,170,197,45,81,2,
+    185,169,96,79,30,108,169,81,45,105,201,92,176,183,8,124,79,2,159,115,169,150,183,100,
+    21,248,117,128,24,85,32,158,197,84,171,91,226,0,49,250,193,88,166,195,88,150,210,109,
+    137,11,140,39,16,198,175,2,99,93,76,53,37,144,155,10,114,242,96,79,13,108,225,54,
+    23,236,45,2,123,147,192,239,92,240,137,219,42,240,235,0,126,85,32,190,197,16,27,110,
+    14,16,159,31,196,247,107,31,252,218,7,191,246,193,143,125,208,51,164,9,250,77,17,63,
+    183,87,123,254,177,165,157,252,209,112,63,140,71,64,3,27,131,108,186,221,114,161,219,209,
+    249,63,55,156,176,161,45,124,212,143,38,232,127,143,37,140,65,160,35,131,243,208,17,114,
+    30,74,27,100,161,52,146,133,74,249,219,81,41,177,29,53,241,67,80,19,17,130,16,201,
+    70,108,240,203,6,255,75,33,22,220,84,247,208,77,46,226,231,54,60,140,110,148,125,208,
+    147,3,27,114,96,99,22,216,156,5,54,151,130,143,165,224,195,3,124,122,128,79,54,131,
+    248,190,63,160,133,142,162,27,94,192,184,185,207,167,27,158,31,220,64,102,248,247,134,177,
+    240,247,38,23,66,55,213,192,159,27,222,15,184,177,25,144,115,54,221,154,66,232,246,42,
+    240,231,38,88,111,97,12,62,52,28,123,24,221,240,90,199,205,61,131,110,129,149,116,11,
+    237,160,90,24,143,15,185,203,132,28,102,66,238,78,66,14,191,55,192,165,196,62,200,229,
+    62,200,97,4,228,18,146,51,24,70,53,57,232,203,65,127,22,60,159,5,207,151,130,236,
+    210,193,239,13,176,7,216,243,0,123,108,136,133,13,246,255,170,125,225,109,116,219,83,73,
+    183,163,25,116,187,197,165,27,155,30,131,96,76,120,156,120,204,3,223,27,126,142,243,33,
+    200,15,206,25,206,165,96,125,225,134,215,98,207,247,57,196,243,41,152,103,220,240,188,223,
+    76,156,129,42,246,141,165,120,211,46,25,10,247,70,140,68,189,176,174,186,143,45,160,120,
+    251,93,55,170,81,107,19,214,41,94,71,175,211,237,169,117,149,159,188,156,90,103,175,15,
+    107,162,214,189,83,41,142,109,96,252,41,122,1,197,135,129,61,57,176,61,29,238,99,110,
+    9,190,140,64,111,26,216,24,9,118,71,128,159,97,224,71,192,101,134,232,96,60,13,108,
+    98,46,15,246,48,239,13,25,137,154,130,33,214,237,16,247,166,25,20,207,95,177,28,189,
+    94,108,143,218,205,221,80,247,86,136,27,214,91,107,0,196,227,165,137,62,185,46,64,150,
+    32,55,29,228,228,64,15,243,97,96,99,24,200,140,0,217,145,160,51,13,116,141,192,198,
+    52,144,151,1,61,121,208,185,185,169,12,108,55,128,175,86,138,247,132,180,129,221,74,176,
+    127,31,252,156,0,127,241,224,247,6,213,94,123,61,3,127,85,20,255,228,122,31,252,180,
+    162,225,32,63,29,244,44,193,14,230,70,32,55,13,116,48,31,9,250,35,192,206,48,176,
+    39,3,122,211,64,15,55,121,208,237,141,104,135,185,0,159,251,26,96,94,202,40,158,159,
+    12,62,210,227,41,222,126,247,4,204,13,200,193,154,105,221,11,62,15,63,163,218,167,232,
+    251,144,91,240,5,242,114,160,143,249,48,176,53,12,228,70,128,252,72,208,155,6,54,140,
+    192,6,110,211,64,71,6,244,49,151,7,93,79,83,68,53,251,21,8,57,90,33,164,225,
+    47,133,44,92,17,98,224,181,102,120,232,95,54,30,150,145,9,165,27,86,128,86,12,250,
+    200,196,243,167,22,11,118,227,193,254,159,166,116,187,13,246,53,76,98,145,150,222,73,164,
+    173,195,69,90,250,39,145,214,154,20,164,183,225,30,154,180,52,30,41,173,58,135,138,225,
+    249,83,184,95,4,207,159,130,92,45,220,175,131,251,79,65,238,33,200,253,85,111,4,141,
+    28,242,114,1,24,239,255,191,238,48,232,58,70,213,64,198,16,53,124,127,226,110,170,181,
+    4,125,66,178,208,198,5,119,162,143,208,144,209,33,170,69,25,32,170,181,4,201,195,125,
+    9,116,126,3,162,154,224,62,154,24,68,53,89,120,62,14,158,35,35,111,170,249,192,51,
+    220,54,108,160,219,223,3,254,123,248,127,127,65,250,251,43,147,109,66,120,251,240,243,27,
+    223,35,14,183,50,252,196,198,62,219,253,195,7,17,7,238,83,156,91,153,232,55,124,48,
+    196,117,99,31,230,137,118,225,237,221,54,32,187,158,95,209,109,147,248,36,209,46,56,59,
+    196,53,241,118,162,95,215,117,196,225,39,219,238,239,186,30,126,34,241,182,109,66,112,246,
+    240,243,137,79,248,23,248,21,136,233,96,131,152,252,100,45,71,220,28,108,88,44,126,50,
+    139,229,96,195,117,227,39,115,221,28,108,138,220,249,201,69,238,32,227,205,79,70,222,14,
+    54,90,126,32,231,7,114,219,65,110,59,200,5,130,92,32,200,5,131,92,176,131,13,159,
+    205,79,230,179,65,46,2,228,34,64,238,119,144,251,29,228,254,0,185,63,64,110,63,200,
+    237,7,185,40,144,139,2,185,35,32,119,4,228,142,131,220,113,144,227,130,28,23,228,78,
+    129,220,41,144,139,7,185,120,7,27,253,179,203,199,151,196,165,140,132,49,79,119,60,62,
+    127,88,65,228,107,6,226,124,35,12,252,95,51,78,185,205,31,54,219,62,101,100,225,198,
+    229,227,27,109,100,84,11,55,86,106,205,182,223,97,124,202,237,189,185,129,255,50,75,196,
+    249,109,121,65,228,50,75,199,227,239,205,75,226,118,24,235,159,173,212,146,59,15,114,231,
+    197,85,235,206,142,28,207,191,128,84,135,159,63,171,80,116,106,219,74,126,188,23,180,92,
+    171,162,83,185,86,252,248,204,53,192,215,108,142,159,55,210,54,33,68,90,203,49,215,10,
+    49,113,243,90,169,229,184,109,37,98,102,174,129,123,107,30,31,191,38,22,126,226,172,40,
+    139,149,107,197,98,109,91,9,124,205,64,164,26,195,118,127,55,193,117,203,181,226,186,109,
+    91,9,124,13,226,152,19,248,30,204,5,31,227,34,119,240,227,190,109,37,240,53,66,254,
+    106,12,220,18,253,224,185,55,248,240,6,251,222,185,107,116,220,174,137,225,123,33,174,103,
+    69,181,252,114,173,180,252,182,173,4,190,230,52,115,222,200,68,187,16,105,214,118,240,185,
+    29,124,110,207,93,163,184,113,228,248,110,155,179,10,220,64,240,25,8,62,3,115,215,232,
+    219,136,171,162,245,72,181,40,24,124,5,131,175,96,44,39,166,221,109,99,171,205,103,195,
+    24,217,48,102,54,182,87,97,156,104,23,97,162,21,1,62,34,192,71,4,246,189,117,81,
+    136,171,237,98,214,239,224,227,119,240,241,59,142,179,213,50,209,111,196,114,238,31,224,227,
+    15,240,241,7,30,215,139,229,176,38,173,139,246,131,143,253,224,99,63,30,127,171,165,237,
+    254,17,203,249,81,224,35,10,124,68,225,60,109,93,20,126,194,118,177,214,17,240,113,4,
+    124,28,193,185,173,48,182,77,136,48,97,29,7,31,199,193,199,241,220,53,117,103,197,180,
+    135,159,183,213,230,114,193,7,23,124,112,115,215,252,218,7,191,246,193,175,125,144,187,134,
+    197,66,74,44,86,39,81,224,94,59,12,55,107,167,17,74,248,30,230,190,62,74,210,184,
+    169,59,72,42,225,166,184,205,123,52,110,136,137,148,144,41,159,127,205,14,161,170,205,203,
+    190,225,134,76,139,190,225,123,18,155,185,95,145,41,247,43,151,203,253,202,98,113,191,250,
+    178,132,251,239,157,36,190,237,102,25,126,203,142,209,26,196,13,227,24,120,247,60,118,10,
+    161,244,88,101,226,126,224,100,153,62,143,36,49,220,116,99,206,16,248,30,230,56,46,46,
+    183,147,144,216,236,92,88,189,185,185,175,106,179,77,161,18,243,109,239,120,230,146,194,119,
+    246,55,123,106,237,231,23,138,57,41,246,138,58,89,22,178,88,206,133,252,44,238,215,47,
+    167,185,95,243,79,95,31,8,201,126,242,45,234,244,115,30,47,155,207,183,58,205,231,147,
+    89,124,62,63,158,161,200,143,183,38,58,78,93,37,138,78,133,43,114,185,72,137,203,117,
+    46,20,59,117,250,107,95,204,242,66,141,184,51,95,149,226,204,11,219,226,227,190,214,199,
+    91,22,78,63,29,243,85,249,244,134,194,47,167,157,11,185,92,137,76,22,75,34,211,137,
+    245,42,51,134,251,42,147,201,26,157,29,199,149,203,222,196,42,203,57,195,45,203,217,204,
+    226,231,157,230,242,243,184,220,153,9,215,98,230,102,222,139,225,199,207,61,201,143,159,118,
+    82,46,161,137,171,146,240,52,214,43,179,58,22,118,93,252,185,76,124,229,103,241,179,54,
+    156,230,103,157,63,173,155,199,207,210,132,230,92,184,192,137,31,191,194,169,48,76,195,225,
+    104,216,100,7,126,60,98,110,8,131,26,18,15,121,205,218,56,137,159,117,113,210,216,60,
+    100,170,153,215,57,201,185,16,153,226,152,184,129,144,227,192,77,44,177,224,51,92,177,224,
+    77,44,141,208,51,92,141,80,38,171,141,29,207,109,99,59,177,166,135,197,112,167,135,117,
+    78,226,126,85,159,180,172,64,125,210,141,126,164,20,157,135,148,92,190,33,102,244,124,196,
+    116,9,126,98,159,16,244,196,158,185,128,231,120,121,39,207,113,205,66,22,139,101,206,229,
+    178,204,201,83,151,119,146,167,214,44,212,142,139,15,210,142,99,46,224,199,187,4,243,227,
+    163,231,243,107,93,190,241,107,163,243,138,107,150,21,20,215,220,232,23,175,113,46,20,175,
+    193,243,45,97,12,249,49,118,98,149,27,199,112,43,140,153,172,145,166,241,220,81,166,155,
+    88,207,204,206,112,159,153,109,98,245,206,63,195,237,157,207,98,205,76,88,191,89,39,239,
+    220,102,126,22,98,158,203,212,112,240,204,92,225,100,148,57,154,165,146,80,233,44,151,144,
+    235,204,143,95,87,51,54,239,108,13,100,40,126,67,216,179,216,163,97,201,49,133,97,23,
+    39,125,248,6,57,224,131,142,177,134,195,86,227,21,78,6,198,215,99,140,140,159,199,122,
+    27,243,227,83,160,241,148,146,107,248,252,77,53,31,190,249,216,221,255,170,199,132,247,38,
+    224,199,253,142,143,220,185,109,254,232,14,239,133,18,231,3,146,100,118,59,245,190,233,119,
+    66,72,214,41,178,22,55,188,62,241,58,197,235,168,219,158,81,141,215,149,27,243,85,39,
+    94,103,163,237,17,218,182,99,161,172,196,246,175,178,216,6,198,69,246,194,187,213,29,225,
+    157,45,214,140,224,199,23,163,241,167,99,121,207,18,248,252,89,167,35,7,102,37,88,14,
+    196,198,109,27,40,56,245,118,192,33,118,194,160,110,28,66,152,63,139,227,34,152,113,190,
+    64,7,99,219,4,83,30,230,29,113,199,41,190,205,233,85,166,147,67,83,38,98,254,150,
+    213,183,121,109,222,111,118,252,44,49,102,98,222,23,251,15,121,147,156,30,230,237,119,58,
+    158,147,234,244,62,43,199,33,19,242,198,207,178,119,176,201,17,62,109,155,87,150,192,207,
+    58,25,219,10,107,234,183,172,63,98,94,103,46,137,105,200,242,139,137,203,121,19,83,148,
+    55,42,238,117,94,123,252,205,60,188,218,140,99,243,179,142,196,122,230,140,152,116,35,183,
+    92,137,159,229,228,160,4,107,171,140,179,221,105,118,216,77,167,89,156,125,78,39,67,39,
+    58,101,4,191,179,183,14,65,204,137,161,72,233,109,14,2,185,108,7,91,14,236,119,142,
+    155,67,115,104,76,172,82,216,190,152,217,97,252,248,50,78,87,205,245,220,233,181,48,71,
+    181,111,115,198,196,45,11,225,199,79,12,125,23,147,25,188,45,134,27,186,44,102,38,199,
+    36,214,150,3,43,151,195,7,153,211,177,159,67,183,57,149,24,59,57,212,25,195,248,76,
+    70,76,90,198,131,24,248,72,105,194,224,39,251,27,243,16,243,173,217,4,167,121,243,247,
+    57,177,204,110,56,149,154,100,59,156,197,191,58,107,10,254,249,155,29,36,205,122,107,150,
+    241,212,107,249,252,184,216,247,48,207,26,38,145,49,165,198,150,49,165,38,219,98,88,102,
+    111,99,230,207,159,24,151,60,143,31,255,214,140,95,59,97,16,252,241,205,98,207,153,224,
+    93,115,34,118,180,25,156,187,241,44,214,151,48,83,86,85,152,33,171,47,94,136,149,29,
+    38,202,234,141,207,115,190,30,6,103,98,60,126,238,202,18,79,56,193,21,79,112,99,41,
+    36,28,231,42,36,224,53,138,247,177,209,201,235,97,217,220,42,74,23,219,224,114,191,132,
+    125,227,102,83,13,219,193,247,241,243,124,110,95,60,230,248,57,182,217,199,237,141,183,102,
+    9,37,96,187,216,62,246,59,157,69,80,235,123,29,75,34,1,175,245,100,174,80,2,214,
+    195,242,216,247,69,174,4,85,39,202,185,68,2,174,25,205,44,133,240,102,86,69,188,44,
+    23,55,133,112,122,28,124,74,254,231,246,37,76,208,112,140,63,26,45,159,0,50,145,172,
+    22,202,14,182,151,206,170,141,95,197,253,64,53,140,19,64,15,203,96,31,171,184,18,223,
+    219,7,74,15,63,139,100,9,135,99,142,227,73,103,141,162,26,150,193,54,241,51,108,3,
+    223,195,182,127,196,59,180,41,132,15,109,244,184,134,54,90,239,15,235,229,139,36,134,143,
+    27,14,159,40,18,22,139,23,172,68,72,8,225,38,134,255,64,106,7,251,254,75,132,244,
+    58,45,22,152,173,14,120,221,90,189,113,191,109,111,200,171,207,250,46,158,65,147,238,60,
+    49,92,184,193,247,161,242,141,216,87,163,95,236,93,248,98,242,129,41,183,204,94,231,171,
+    31,186,77,10,171,202,134,62,90,117,216,248,188,84,160,219,196,126,107,249,16,139,195,147,
+    165,74,183,134,221,20,179,78,88,54,226,81,70,194,129,9,211,135,109,122,95,179,222,223,
+    253,240,13,119,11,229,169,155,183,239,96,61,107,228,114,171,223,250,238,96,233,167,26,158,
+    240,27,108,232,252,188,203,102,243,130,37,252,234,41,188,204,6,77,254,167,200,172,126,5,
+    56,1,51,141,119,132,242,82,27,172,226,76,2,223,241,14,148,239,254,80,216,59,209,139,
+    247,192,235,219,37,103,238,53,187,157,141,143,139,109,121,150,227,23,94,40,63,216,205,86,
+    174,254,122,137,253,197,107,48,163,251,244,77,135,165,8,117,250,116,127,41,72,14,253,240,
+    36,57,243,203,141,115,120,160,187,218,11,187,183,218,48,156,106,67,91,43,216,119,214,94,
+    250,86,54,176,67,241,246,235,227,194,209,169,39,167,34,78,160,37,63,249,254,169,101,252,
+    136,246,184,245,158,78,181,131,101,177,138,70,175,182,216,5,124,22,110,102,136,33,164,154,
+    146,115,181,150,95,119,110,198,137,237,86,124,110,153,121,72,71,142,104,175,226,234,113,18,
+    145,34,248,105,81,186,201,150,18,197,169,129,95,140,182,124,104,203,91,180,131,237,93,172,
+    73,66,90,37,245,247,22,63,56,208,92,33,201,171,56,111,113,119,224,94,243,210,238,172,
+    192,198,46,197,154,193,18,149,145,210,8,21,68,11,251,125,80,141,152,222,121,248,108,99,
+    156,162,205,198,203,118,25,1,77,31,99,163,212,36,149,16,138,123,91,182,110,179,238,151,
+    149,41,104,241,239,223,234,54,164,126,46,245,187,144,249,53,78,4,177,30,86,113,200,108,
+    210,255,79,167,79,205,1,137,61,187,59,85,146,164,64,94,233,42,146,231,25,220,90,205,
+    255,220,217,124,92,12,172,75,31,84,182,144,10,152,176,245,165,201,14,207,167,191,17,16,
+    15,121,120,90,99,78,114,125,119,191,75,241,169,20,107,120,23,231,72,43,87,63,224,196,
+    127,54,40,191,26,98,142,255,83,46,68,150,88,20,238,76,122,185,213,100,103,127,250,7,
+    18,18,39,187,201,224,99,243,250,249,212,195,125,198,131,23,100,238,175,109,78,83,212,63,
+    71,32,2,161,115,62,87,79,83,96,247,232,133,50,89,7,231,108,53,121,183,89,201,20,
+    33,83,51,153,58,233,228,250,3,119,27,8,206,148,203,54,36,138,206,106,178,183,202,73,
+    154,89,102,226,247,49,223,46,184,227,186,142,144,228,131,209,8,173,127,200,230,212,207,207,
+    42,63,121,160,56,46,205,74,29,134,145,160,119,70,207,224,241,86,143,75,159,29,27,202,
+    103,78,241,22,243,36,72,142,240,197,194,231,35,217,123,186,63,20,54,20,39,243,63,15,
+    244,170,77,83,31,185,14,33,230,72,62,113,240,124,199,227,113,117,35,198,44,223,96,201,
+    156,124,13,161,108,114,117,98,227,169,8,195,180,55,247,251,223,92,138,105,15,113,178,32,
+    32,66,125,73,206,22,237,164,218,166,151,91,58,85,102,197,14,38,86,41,110,88,195,28,
+    79,25,223,123,190,233,229,146,78,21,147,109,133,151,201,122,111,97,132,228,18,198,45,124,
+    193,147,176,74,214,78,158,203,238,73,106,31,204,126,141,167,211,87,229,224,5,246,200,193,
+    174,166,210,218,157,111,223,180,179,27,6,142,143,129,60,31,186,141,246,178,62,87,197,233,
+    223,234,186,109,18,210,214,204,78,162,82,114,103,56,71,245,228,243,246,224,143,175,190,88,
+    241,74,190,214,14,244,12,200,141,197,211,18,138,156,158,77,220,56,120,239,196,236,111,237,
+    27,107,83,159,225,121,176,189,248,76,19,105,54,28,156,201,239,58,54,130,223,60,65,2,
+    181,124,240,48,37,152,196,153,74,195,32,247,15,23,216,125,103,206,137,244,80,177,141,68,
+    62,218,123,76,62,188,249,252,33,254,235,225,72,126,125,114,219,122,111,72,121,246,228,130,
+    21,218,241,38,159,222,124,62,54,123,240,211,57,254,32,223,115,163,31,158,138,62,226,144,
+    62,59,248,131,11,187,171,180,66,27,225,12,139,19,135,238,120,59,116,247,71,198,239,172,
+    159,93,155,246,133,179,135,67,48,71,158,9,204,122,22,187,254,206,32,183,97,166,81,29,
+    84,9,181,236,83,201,168,107,147,222,245,47,82,198,3,223,216,3,157,237,27,216,210,148,
+    189,146,173,156,178,248,129,55,35,248,221,197,153,245,171,208,7,94,111,20,108,161,175,79,
+    62,242,23,102,204,58,181,254,235,29,197,160,156,11,104,201,19,60,191,156,133,155,136,79,
+    247,2,28,186,27,216,45,47,248,31,172,248,175,85,200,199,125,237,138,176,73,71,164,100,
+    47,69,25,21,187,211,202,226,249,159,21,191,4,226,164,21,185,12,218,221,111,40,95,203,
+    127,219,160,131,96,107,49,37,97,130,125,63,223,77,191,213,31,165,77,221,40,63,243,38,
+    61,61,180,101,76,166,119,165,139,16,172,79,235,125,232,211,156,236,217,161,111,247,89,13,
+    199,207,89,196,161,212,138,130,238,50,187,111,10,227,96,227,155,142,180,205,8,254,12,123,
+    191,156,16,246,206,175,8,234,157,104,124,251,86,147,22,35,39,85,10,89,247,53,242,175,
+    216,125,189,177,45,129,211,201,62,186,39,235,128,73,95,115,111,170,87,109,91,200,8,176,
+    244,194,164,72,13,201,221,28,249,42,54,72,234,110,242,128,84,170,87,136,28,228,51,122,
+    208,126,249,59,253,103,252,219,237,198,233,30,159,68,133,16,179,127,207,238,147,30,196,253,
+    238,214,118,137,76,97,105,196,105,84,148,155,59,88,204,28,100,55,175,221,241,134,31,50,
+    223,68,9,27,123,63,27,157,183,70,183,219,67,75,179,50,26,110,5,5,193,104,163,7,
+    39,85,16,222,159,78,155,40,244,182,135,126,105,219,244,93,82,246,18,154,182,152,211,230,
+    54,120,47,62,184,190,60,232,184,4,101,115,159,62,63,234,243,214,204,207,207,130,110,183,
+    111,179,234,217,56,11,98,57,207,86,13,64,251,103,113,146,93,252,248,155,252,104,237,93,
+    178,104,224,26,113,63,168,247,136,123,87,113,102,154,30,172,46,75,190,52,147,16,15,230,
+    109,108,15,225,197,26,30,23,194,246,106,187,172,178,59,217,93,109,213,86,161,237,27,119,
+    156,250,2,3,225,52,198,119,240,106,219,51,249,133,241,236,10,3,212,57,102,35,153,221,
+    37,213,57,166,163,43,203,246,74,220,6,40,139,253,106,243,141,239,192,102,30,12,187,116,
+    96,240,66,234,243,172,205,203,94,44,113,190,244,229,98,217,157,206,186,235,206,176,205,32,
+    25,135,22,241,219,174,252,25,18,51,171,236,221,140,230,43,59,38,186,187,223,52,60,46,
+    134,205,43,134,79,224,137,154,196,132,4,216,159,251,154,94,125,39,171,242,245,39,229,227,
+    35,4,79,94,196,182,207,46,187,92,217,92,195,154,241,4,53,139,144,8,156,231,28,28,
+    172,50,41,229,77,61,38,115,96,67,79,255,96,226,211,101,39,72,24,247,155,244,208,167,
+    147,77,47,38,178,249,123,74,107,118,20,95,213,190,129,250,234,158,31,47,16,34,208,209,
+    138,178,39,99,82,79,108,227,164,44,226,231,88,233,188,235,187,83,246,81,101,99,172,104,
+    210,173,221,194,240,244,240,11,190,245,159,207,77,142,40,87,101,245,173,79,60,153,97,252,
+    218,213,227,206,20,136,206,250,183,229,252,249,54,230,252,155,95,186,102,183,27,164,173,46,
+    38,235,204,174,76,97,128,51,231,183,93,38,66,38,253,46,38,113,45,10,60,209,113,101,
+    125,171,117,66,235,14,42,73,35,211,177,122,60,169,156,168,65,55,131,157,61,181,31,214,
+    39,190,190,104,62,75,24,210,77,54,116,153,200,243,68,251,79,144,16,150,107,222,118,66,
+    9,234,172,62,79,202,156,127,122,172,183,125,90,227,91,38,232,114,78,13,238,145,94,196,
+    207,48,9,208,227,237,137,216,52,156,99,179,119,38,145,34,189,156,95,47,189,190,239,19,
+    255,82,253,147,120,131,235,247,87,95,233,89,196,87,14,209,108,221,161,88,181,172,212,169,
+    162,43,222,179,33,123,187,138,114,21,159,255,232,83,124,87,92,87,236,227,174,218,138,44,
+    217,67,33,205,87,132,133,144,52,121,129,239,35,182,75,187,255,66,227,138,182,126,253,135,
+    151,206,237,236,249,34,204,32,145,170,238,5,190,253,164,69,57,45,230,124,255,227,236,170,
+    234,61,17,39,154,112,172,28,219,189,106,57,167,97,24,126,198,210,231,141,251,47,248,141,
+    229,245,106,115,146,199,70,15,151,34,242,86,92,224,127,122,196,158,61,54,242,5,63,101,
+    96,125,122,96,243,179,171,139,248,141,198,31,239,241,214,61,253,92,27,40,117,203,160,218,
+    203,67,70,100,213,187,225,104,188,91,127,109,231,148,195,91,73,71,239,126,197,143,126,122,
+    69,239,175,178,157,31,91,245,79,52,234,117,73,110,159,251,166,200,156,253,194,196,242,240,
+    12,164,30,219,200,254,84,124,119,90,74,60,24,229,239,141,238,95,200,225,158,234,78,54,
+    226,221,43,242,109,75,214,171,149,74,125,63,28,89,6,130,181,25,155,100,94,229,53,178,
+    163,27,205,52,34,83,7,121,143,216,229,183,7,12,107,165,252,234,135,163,162,45,253,138,
+    253,235,142,125,59,201,121,193,87,111,74,215,3,35,54,96,164,104,112,59,148,100,251,65,
+    91,130,195,181,226,7,133,238,209,180,147,129,112,88,62,174,69,77,87,249,106,94,189,59,
+    50,21,229,30,142,70,209,47,62,153,52,205,81,43,214,33,46,240,223,214,37,214,75,143,
+    33,88,219,202,179,52,175,84,241,98,219,247,24,65,145,149,83,231,181,127,125,186,212,119,
+    89,54,4,240,142,208,76,76,29,60,86,249,166,173,61,216,228,253,190,25,40,229,33,140,
+    65,81,246,61,214,183,63,229,232,116,42,18,105,25,52,219,113,115,90,7,159,245,82,27,
+    228,78,244,96,239,183,211,111,55,97,247,7,67,163,139,58,174,242,87,83,238,125,159,141,
+    70,15,43,186,76,186,188,18,62,85,8,193,18,248,28,117,116,197,24,226,238,11,254,31,
+    31,26,227,187,147,45,91,241,16,78,171,194,16,78,45,231,7,13,178,134,135,224,24,244,
+    250,115,190,164,87,7,190,108,178,252,12,121,93,66,37,130,132,109,189,164,110,58,126,193,
+    129,44,156,111,97,62,146,228,174,48,25,120,91,159,212,120,96,240,216,123,215,68,246,164,
+    143,131,252,175,73,189,193,43,194,16,135,180,226,11,207,196,241,110,216,83,100,126,175,51,
+    189,154,91,250,137,253,240,109,214,250,134,1,147,128,142,190,248,140,193,248,44,94,206,92,
+    187,117,74,40,225,213,11,118,216,146,58,142,31,55,123,146,228,169,123,81,183,229,52,251,
+    199,244,27,199,179,121,241,131,197,241,25,3,12,44,164,180,171,209,132,63,181,174,203,196,
+    178,55,187,242,147,178,66,235,179,73,230,252,188,140,2,23,245,222,94,254,147,218,193,215,
+    236,190,194,248,190,82,146,64,65,23,26,14,13,218,124,233,136,170,239,50,41,122,215,113,
+    231,118,165,65,254,39,147,231,93,138,239,253,50,178,120,221,38,143,52,179,79,200,137,161,
+    87,113,209,140,107,39,133,7,95,192,70,73,213,11,214,189,55,134,248,211,102,255,96,78,
+    86,60,246,25,97,87,1,39,87,221,7,171,216,175,3,179,55,223,245,237,15,224,159,19,
+    58,95,0,179,83,109,230,159,181,99,100,93,221,243,172,149,99,123,227,226,87,102,68,93,
+    16,225,180,49,59,10,236,120,18,87,76,245,99,109,61,51,191,125,195,137,121,182,71,177,
+    61,184,195,34,128,223,226,247,202,166,101,107,214,224,147,204,194,186,189,161,61,118,223,170,
+    86,152,108,99,157,123,126,181,48,168,230,161,95,197,179,204,98,227,199,173,85,194,231,156,
+    85,152,75,154,186,150,232,242,226,151,153,103,141,232,57,246,66,165,39,88,122,229,168,162,
+    157,81,246,84,30,75,183,122,101,206,237,186,96,92,227,30,111,227,217,162,200,139,215,231,
+    197,12,16,132,233,216,140,128,237,51,131,36,50,99,156,77,75,179,108,107,120,9,182,22,
+    234,137,163,188,123,77,44,155,173,199,141,70,27,99,157,82,143,180,220,17,243,206,254,228,
+    213,6,85,247,67,247,170,120,99,246,206,180,59,3,139,222,169,238,75,188,240,241,237,168,
+    105,57,178,75,241,202,59,195,152,69,6,223,40,243,84,211,145,140,27,124,202,227,64,69,
+    204,218,209,175,120,185,200,194,187,107,20,44,173,243,159,234,34,81,229,21,246,77,221,203,
+    135,239,40,74,163,142,163,47,102,60,29,83,124,45,74,139,183,52,60,241,40,222,29,219,
+    68,109,133,250,188,29,155,215,103,108,191,186,66,167,23,74,65,143,112,118,83,169,63,59,
+    239,139,114,206,2,106,2,171,137,49,68,17,24,231,28,30,252,34,218,59,227,216,64,149,
+    70,74,233,248,174,236,198,99,231,230,219,201,169,110,28,181,160,248,49,130,17,155,75,166,
+    139,49,113,196,70,85,123,162,116,83,43,158,245,178,214,11,19,96,165,151,15,5,68,235,
+    75,81,36,254,139,0,190,27,132,119,47,13,119,109,145,199,59,175,137,67,221,219,183,90,
+    88,120,73,120,132,23,225,11,247,30,47,196,255,133,123,202,154,67,123,148,23,135,156,36,
+    160,192,70,94,14,255,170,98,166,109,47,5,39,245,243,10,84,180,97,123,66,245,253,109,
+    15,12,64,243,241,122,97,191,229,225,46,153,50,23,241,127,146,40,134,152,215,214,168,119,
+    43,167,15,184,54,39,62,136,49,182,131,53,193,113,88,157,179,226,72,93,87,207,142,172,
+    238,183,15,20,77,106,238,102,93,63,22,242,198,98,198,124,126,238,137,107,182,95,44,118,
+    217,52,79,116,141,99,136,8,161,139,225,54,42,57,82,237,182,99,3,6,238,41,190,153,
+    224,179,44,123,166,169,186,168,164,182,41,226,252,166,183,101,244,248,67,66,237,213,236,148,
+    134,49,89,41,153,190,21,203,204,176,241,67,151,153,135,132,138,227,141,226,66,130,218,63,
+    127,172,94,180,177,118,240,83,61,99,112,148,203,84,123,79,35,81,113,8,232,214,154,148,
+    204,55,69,155,79,88,41,22,47,169,139,170,225,153,226,31,113,67,37,94,61,122,188,215,
+    203,69,188,180,173,79,158,238,73,90,84,46,141,239,173,28,237,191,38,241,226,235,123,35,
+    47,218,28,16,53,73,231,190,82,146,71,195,103,223,18,202,14,141,213,174,94,114,55,217,
+    106,67,236,162,86,229,129,132,81,11,159,239,181,11,174,239,215,153,33,210,249,214,155,113,
+    16,138,70,93,165,70,73,227,89,143,11,124,98,187,205,165,117,235,182,84,235,255,214,154,
+    121,216,247,131,207,189,35,25,106,35,72,36,246,27,67,141,180,254,98,99,146,106,155,60,
+    171,226,242,177,154,158,233,65,131,105,1,3,71,30,140,131,196,237,106,135,79,137,91,98,
+    234,13,17,109,58,3,68,177,115,185,93,227,211,126,222,116,118,47,124,183,84,229,47,125,
+    112,66,7,191,221,39,200,167,134,246,60,22,25,152,91,63,24,61,198,68,116,91,199,155,
+    235,231,212,80,77,80,138,125,224,72,248,68,212,63,217,29,180,106,96,85,253,96,159,149,
+    129,68,33,239,52,59,199,55,233,164,51,71,4,102,48,231,75,156,178,58,63,226,217,76,
+    211,35,207,250,131,10,121,127,212,148,213,213,249,100,157,33,224,125,17,69,198,118,239,136,
+    26,136,117,186,177,67,93,47,63,221,228,50,113,237,106,114,77,96,202,245,183,135,241,119,
+    89,182,172,11,47,39,61,254,236,252,26,174,139,113,253,160,234,152,168,153,110,56,87,71,
+    175,156,152,189,65,104,253,195,211,59,58,203,99,125,159,245,243,124,178,216,35,172,106,192,
+    239,172,171,186,181,65,41,215,43,45,130,171,39,227,85,113,116,46,138,211,111,94,215,51,
+    247,114,76,3,8,221,94,241,122,32,168,45,36,133,167,18,191,209,195,243,214,145,118,147,
+    215,93,231,34,241,223,121,113,56,101,147,101,90,63,88,247,40,60,167,62,191,49,140,237,
+    155,42,23,191,209,109,11,120,179,14,152,189,233,142,211,72,166,198,158,205,7,107,197,92,
+    139,108,178,84,235,7,153,229,86,59,158,246,53,190,103,223,192,67,156,228,61,66,250,232,
+    183,18,5,118,249,236,252,244,172,160,242,90,222,131,115,171,250,143,164,138,4,12,230,127,
+    233,85,244,220,169,140,95,95,223,87,47,72,13,29,124,192,155,155,58,168,86,200,91,241,
+    44,73,23,103,86,85,25,182,207,117,209,186,150,56,70,156,127,121,241,215,244,44,118,121,
+    124,67,122,50,164,7,22,139,175,44,218,19,221,221,105,212,38,21,219,61,198,184,45,106,
+    11,103,32,166,53,106,206,198,204,104,200,122,246,200,193,123,19,23,150,233,141,235,78,125,
+    160,208,109,225,194,123,115,112,32,145,197,11,62,56,48,63,73,103,235,210,178,87,142,57,
+    240,170,90,215,241,218,237,117,155,17,119,103,177,218,28,134,124,175,84,116,247,8,237,54,
+    169,15,73,97,240,162,113,152,122,89,202,38,165,178,43,204,179,100,92,117,123,199,116,213,
+    240,34,92,120,103,162,6,240,210,64,150,181,35,84,214,14,191,254,180,92,203,133,167,244,
+    32,68,2,34,66,231,91,120,123,20,34,162,78,108,41,251,176,97,142,200,65,157,105,125,
+    179,7,95,62,224,249,176,120,95,246,15,36,142,203,150,35,138,150,185,15,227,204,15,232,
+    62,118,98,38,249,190,83,189,104,218,67,189,125,240,93,216,96,117,245,212,38,55,86,34,
+    63,231,5,251,238,148,202,192,115,25,54,223,188,181,250,234,230,52,42,91,109,174,158,33,
+    213,120,104,199,199,198,172,63,151,188,102,183,126,187,124,243,102,252,11,191,43,79,89,101,
+    238,133,69,112,104,34,51,155,107,107,102,79,176,51,102,190,81,44,170,93,164,253,49,144,
+    55,151,109,203,109,24,208,80,200,222,134,151,138,122,88,210,242,47,177,3,82,162,181,115,
+    239,188,124,152,153,180,174,190,112,228,242,153,86,218,205,10,189,58,72,191,65,83,198,91,
+    190,134,20,243,13,146,223,94,234,63,195,98,157,66,26,84,67,171,216,245,143,140,31,110,
+    174,183,226,215,215,230,165,6,189,217,161,85,252,82,33,59,195,180,232,224,12,248,18,59,
+    9,31,92,221,241,188,144,143,87,179,230,230,88,105,94,52,188,103,114,91,196,123,2,78,
+    203,254,15,17,246,94,170,119,106,90,60,25,182,201,133,221,1,225,171,158,20,82,201,185,
+    136,171,212,100,211,229,146,133,49,183,219,90,248,159,215,222,152,123,53,89,167,121,105,89,
+    192,37,221,30,221,108,16,50,29,150,158,33,46,141,164,235,114,2,66,207,125,109,148,153,
+    209,108,131,246,199,13,86,223,179,59,42,210,97,132,94,124,128,143,171,93,172,115,107,91,
+    207,54,230,173,13,234,149,146,244,28,212,168,29,115,157,176,21,101,238,19,154,170,126,29,
+    202,214,13,177,67,13,17,159,87,220,235,204,169,79,106,233,126,180,54,104,134,197,137,230,
+    178,150,53,145,83,92,122,71,84,163,107,12,245,153,240,165,43,227,55,66,250,61,159,89,
+    244,123,129,187,211,205,5,97,58,156,102,234,11,105,1,122,121,185,119,78,85,249,164,251,
+    86,91,123,146,240,226,245,251,208,101,242,190,245,208,248,126,115,83,69,175,91,106,146,234,
+    71,99,30,193,32,37,45,18,22,216,18,117,135,54,175,223,152,38,150,51,240,140,183,103,
+    128,221,145,54,167,54,211,135,119,178,32,236,212,67,73,139,72,48,200,242,244,184,52,248,
+    237,46,18,123,163,152,197,174,152,140,255,238,68,91,23,255,107,167,74,210,252,139,153,65,
+    237,111,121,79,147,6,20,218,38,138,128,193,243,124,83,149,193,150,170,63,126,31,172,168,
+    13,120,178,201,244,144,104,101,142,235,72,68,192,151,133,75,212,64,181,84,79,117,173,98,
+    235,64,193,45,40,88,248,158,105,33,143,17,61,0,71,0,179,127,14,79,212,176,77,209,
+    225,93,22,188,101,74,60,145,208,87,247,23,69,88,166,54,157,47,254,124,151,7,243,35,
+    85,254,45,249,178,172,55,138,71,20,194,16,214,81,121,229,195,46,61,205,255,152,100,216,
+    163,184,187,0,206,22,105,248,50,57,48,176,72,103,80,129,8,233,140,173,34,145,220,12,
+    67,241,153,164,18,82,231,41,244,94,40,156,105,138,48,148,105,73,55,105,44,105,63,192,
+    97,190,125,67,10,97,163,133,188,196,125,133,215,200,35,162,98,96,87,122,111,67,197,218,
+    153,243,44,10,121,46,190,240,117,47,134,200,222,175,157,205,91,151,74,52,91,63,243,169,
+    45,193,127,185,230,69,150,79,109,186,73,105,179,215,253,109,80,164,237,126,75,145,174,36,
+    232,97,194,237,43,54,138,136,14,132,21,2,230,172,77,103,95,77,250,125,46,111,207,220,
+    182,217,222,229,236,214,167,183,171,73,161,17,70,8,135,165,183,63,237,92,127,103,179,89,
+    70,171,85,118,125,102,103,63,164,182,238,226,11,246,243,218,47,38,47,125,106,175,74,81,
+    35,182,63,56,176,59,174,59,99,164,180,90,83,73,170,24,7,41,101,55,154,220,247,169,
+    13,196,198,83,228,245,79,13,50,20,122,159,98,85,37,147,23,252,187,160,102,50,122,142,
+    87,245,157,183,123,195,23,142,223,41,7,37,198,82,157,87,252,117,153,137,73,205,171,187,
+    89,207,31,27,167,103,221,233,246,105,103,164,102,78,23,242,254,68,144,28,211,243,124,230,
+    242,214,152,110,2,17,166,215,147,102,150,93,48,228,137,250,109,169,189,202,150,197,102,118,
+    126,61,179,141,19,56,209,31,27,218,175,195,83,252,156,83,171,142,165,47,180,197,180,191,
+    145,67,112,162,60,155,140,72,206,116,43,120,19,126,61,167,153,129,196,56,127,26,4,244,
+    75,213,189,204,180,97,135,221,31,41,93,196,79,192,81,215,213,53,242,31,197,132,138,120,
+    131,101,47,57,66,52,118,33,236,232,41,224,46,213,140,111,85,147,229,82,46,138,148,100,
+    54,134,115,22,86,175,26,76,154,247,230,213,17,201,160,21,178,207,22,133,231,193,199,47,
+    179,124,246,200,118,11,82,114,78,130,233,27,82,246,170,234,156,122,99,120,171,224,160,11,
+    236,84,99,100,58,120,71,248,97,23,187,207,167,214,195,168,43,163,231,99,149,28,49,222,
+    211,116,69,58,201,236,87,220,10,86,97,66,63,118,121,189,17,69,98,209,27,57,225,127,
+    46,175,23,222,211,209,175,224,101,35,228,157,128,127,34,134,240,9,5,187,122,223,19,195,
+    35,28,134,196,247,30,185,173,179,124,66,36,146,212,160,62,255,120,22,217,147,68,196,80,
+    194,2,207,154,187,245,226,83,245,50,241,161,179,87,235,104,93,29,9,71,199,228,229,43,
+    195,167,140,128,66,123,71,207,106,152,228,12,208,152,250,110,245,84,189,243,88,40,50,245,
+    88,29,135,22,90,31,158,56,140,18,114,25,38,57,149,18,186,57,85,239,32,37,164,117,
+    162,78,137,22,218,28,62,69,140,18,98,15,147,84,164,132,100,167,233,109,167,45,69,215,
+    101,19,148,144,83,120,162,8,37,116,98,152,228,88,74,200,127,154,222,102,218,210,201,58,
+    38,45,180,37,124,138,48,37,148,60,76,82,134,18,122,57,77,207,156,182,20,83,135,40,
+    33,152,95,141,119,217,23,27,107,27,217,32,65,236,132,181,57,147,212,211,166,70,23,137,
+    234,18,240,193,56,249,153,127,120,4,73,89,170,29,38,41,74,89,10,86,209,27,79,91,
+    138,171,51,165,133,118,134,51,8,74,168,247,143,249,217,147,241,145,55,178,193,216,71,76,
+    156,247,121,231,248,153,21,151,203,69,169,47,94,162,96,12,63,52,77,111,243,181,130,11,
+    199,155,52,33,245,166,174,182,66,217,112,175,85,185,145,173,196,0,155,66,15,23,162,224,
+    202,246,231,75,74,163,116,55,68,85,81,50,123,65,230,4,207,58,170,106,194,88,216,16,
+    74,150,179,200,186,17,155,69,40,31,99,136,14,225,217,12,42,150,72,212,183,242,4,254,
+    243,155,75,242,193,196,165,39,48,241,232,195,187,201,40,243,161,51,126,145,27,21,8,163,
+    243,170,185,235,56,65,108,77,207,135,185,221,51,54,81,182,175,243,30,123,241,14,138,40,
+    189,108,52,25,248,18,247,220,107,22,54,230,138,84,159,116,205,254,142,170,187,216,166,34,
+    167,92,95,54,249,188,151,33,160,62,48,76,93,95,240,75,196,47,22,60,255,108,190,12,
+    71,81,130,23,24,200,164,79,17,251,20,25,250,185,34,244,197,111,226,254,165,55,143,156,
+    53,84,220,145,181,117,25,51,44,179,255,216,108,59,56,51,12,152,253,38,103,220,187,236,
+    174,21,24,218,31,114,242,168,243,19,114,94,27,242,57,210,238,198,112,134,143,236,154,250,
+    214,117,115,15,142,43,75,231,63,206,140,225,69,166,158,228,185,203,58,151,41,143,96,26,
+    135,246,74,241,223,53,29,91,58,102,249,196,219,178,209,131,81,103,98,207,102,44,37,170,
+    249,55,187,55,251,252,121,254,15,126,52,20,67,121,142,8,167,227,60,159,55,182,228,106,
+    97,229,82,17,14,125,135,121,129,191,98,236,161,144,18,57,66,9,73,139,36,16,74,240,
+    221,202,22,81,171,120,87,147,151,163,9,243,150,139,180,145,144,1,79,234,41,218,33,244,
+    221,200,161,11,252,185,99,15,241,78,184,166,109,62,38,208,122,223,200,118,197,163,163,21,
+    118,25,241,218,31,113,118,142,143,119,125,233,4,211,177,139,112,69,98,129,253,39,8,235,
+    147,127,104,24,222,216,147,33,118,185,243,140,138,70,138,109,100,84,217,21,222,186,30,159,
+    41,205,187,106,174,84,136,88,203,87,214,29,59,96,87,78,188,224,183,24,121,238,48,126,
+    237,234,172,232,52,214,58,138,55,135,36,135,115,86,152,76,18,223,21,166,14,201,117,187,
+    192,175,30,219,241,121,237,189,242,123,227,148,24,74,29,16,66,174,169,124,2,145,240,254,
+    5,127,80,252,147,199,56,116,84,13,129,168,180,136,43,212,198,15,71,157,77,123,30,143,
+    51,133,17,127,151,83,231,225,153,23,99,216,43,137,151,64,17,142,120,198,217,217,190,172,
+    225,42,108,95,123,14,216,103,246,207,222,189,246,79,214,236,177,136,52,149,167,69,150,158,
+    32,202,9,33,120,72,105,51,254,18,132,37,155,11,88,36,187,75,74,9,134,153,139,36,
+    56,141,138,216,244,46,98,28,122,97,130,61,138,49,180,209,121,54,34,148,196,165,69,198,
+    253,208,73,32,64,7,167,38,151,186,39,22,168,249,181,104,76,150,211,232,93,68,100,99,
+    187,234,229,194,170,228,157,223,148,71,221,104,47,204,112,255,180,198,204,105,199,83,183,175,
+    213,38,223,34,221,205,146,55,223,113,154,254,170,190,123,78,77,255,186,44,158,78,51,58,
+    234,252,236,91,105,50,239,252,26,49,206,216,235,226,6,110,175,45,74,99,163,238,213,166,
+    77,219,211,217,52,99,118,45,188,216,25,148,40,242,236,130,58,61,64,118,201,211,81,66,
+    43,125,115,19,132,238,86,8,93,62,172,174,119,215,189,238,94,96,243,242,114,180,110,182,
+    221,205,113,231,142,133,72,56,189,200,82,200,227,104,62,59,96,215,159,198,118,177,86,155,
+    20,223,174,249,106,130,200,198,63,138,191,74,219,160,135,40,209,196,212,141,145,157,176,183,
+    120,199,157,203,166,163,112,159,131,212,85,223,117,110,42,157,40,205,208,204,254,4,137,16,
+    223,215,23,124,226,154,208,196,219,50,205,74,140,253,131,232,173,104,246,24,118,247,156,147,
+    159,143,84,163,113,101,99,91,197,153,214,178,34,69,33,231,227,59,238,135,206,88,86,53,
+    75,152,178,58,150,100,190,44,30,198,8,206,204,59,116,182,177,46,41,108,67,226,162,111,
+    45,39,250,132,30,225,135,151,24,120,42,194,173,194,171,231,42,33,39,206,115,58,201,102,
+    54,14,74,51,8,130,114,66,205,213,146,163,68,212,220,33,125,50,101,107,124,157,246,216,
+    12,43,239,170,47,143,168,80,97,66,34,148,210,254,108,51,12,101,109,42,169,44,99,60,
+    227,63,249,235,254,202,124,211,44,33,33,142,184,122,63,158,97,28,164,243,245,231,22,70,
+    164,247,81,241,190,166,117,153,238,19,62,214,173,11,109,222,33,48,46,89,26,178,35,62,
+    54,171,125,48,214,36,143,205,221,200,57,216,2,31,80,248,181,104,91,244,97,120,181,105,
+    134,151,164,91,146,223,69,143,8,233,18,135,8,115,88,7,28,245,132,253,241,94,49,136,
+    206,156,169,188,245,93,245,148,97,223,125,238,34,194,118,133,45,163,198,135,23,140,234,54,
+    249,87,66,166,34,242,60,168,196,185,156,63,127,135,71,31,227,9,158,212,230,187,190,143,
+    218,8,168,204,95,63,26,222,30,80,84,224,225,165,41,45,82,212,222,233,33,195,17,126,
+    172,153,96,71,230,168,228,48,223,20,27,119,108,134,88,145,125,182,165,242,189,229,173,85,
+    66,9,166,34,99,134,239,11,170,40,129,183,146,50,126,246,165,16,28,14,243,176,72,20,
+    233,85,41,148,16,109,113,40,111,132,112,219,123,40,210,98,140,125,178,140,141,186,132,234,
+    249,133,213,134,239,151,79,196,114,210,34,187,139,81,12,18,58,46,116,172,177,218,80,59,
+    253,200,131,116,41,188,251,115,19,208,107,144,204,248,99,162,138,119,189,49,30,146,88,68,
+    73,151,162,112,219,43,161,132,252,237,118,170,23,245,210,164,172,141,117,150,102,79,140,185,
+    87,51,131,213,251,96,149,68,196,98,121,181,37,25,189,129,87,219,243,179,227,70,37,136,
+    91,126,131,40,119,153,5,58,42,205,8,123,16,171,252,28,225,95,108,145,151,173,238,139,
+    161,254,128,224,46,179,183,5,43,100,219,175,90,207,188,182,214,220,11,14,100,49,112,75,
+    92,54,95,209,115,217,223,107,48,240,198,48,78,178,5,20,106,37,241,199,163,24,62,47,
+    171,225,36,80,164,68,118,75,69,104,204,33,188,135,81,255,128,25,33,157,155,112,171,83,
+    200,212,163,65,209,233,211,52,234,4,183,151,102,65,130,241,241,46,22,65,101,23,170,2,
+    71,93,76,69,220,157,242,161,186,226,251,83,235,38,152,34,28,83,194,89,123,166,12,190,
+    99,106,109,95,82,243,53,149,150,19,51,17,223,98,152,85,92,167,84,91,41,164,212,93,
+    30,143,143,146,142,60,102,237,52,180,4,123,182,62,168,254,10,178,235,72,43,190,205,83,
+    106,202,148,112,117,238,248,172,26,199,23,198,159,221,74,173,53,205,252,151,81,226,154,74,
+    175,71,11,61,27,100,64,96,225,203,194,115,74,20,91,103,16,248,128,58,253,128,243,130,
+    143,109,150,58,35,100,173,121,125,42,245,199,21,177,99,28,47,149,160,191,222,80,232,127,
+    174,85,66,127,19,249,175,159,252,115,229,127,211,236,95,34,255,166,217,191,68,164,255,195,
+    152,172,255,216,186,194,105,52,66,9,202,91,174,116,55,213,25,182,42,123,92,112,227,215,
+    63,187,22,69,32,142,41,89,119,169,61,127,69,210,13,63,179,58,139,49,98,12,48,164,
+    129,204,7,39,219,227,63,175,58,12,97,6,123,16,91,147,22,193,222,118,17,216,213,255,
+    234,182,18,117,91,140,186,77,226,219,166,26,12,37,5,235,167,241,185,160,114,67,200,116,
+    218,56,94,167,185,53,190,239,74,120,115,22,203,99,191,143,101,80,46,173,11,135,15,162,
+    143,24,218,65,46,30,162,146,56,101,204,148,146,165,118,44,229,81,73,28,143,118,168,162,
+    52,173,168,68,43,194,7,9,86,164,54,22,3,113,200,162,121,207,95,104,185,109,145,29,
+    45,66,233,16,197,70,3,34,207,93,243,149,182,124,26,73,223,201,17,206,254,100,182,90,
+    30,31,66,200,250,36,101,196,254,187,39,112,201,249,233,134,222,78,121,119,255,81,107,16,
+    146,53,198,190,153,150,240,137,106,53,186,235,136,169,20,66,147,168,24,247,199,8,149,181,
+    202,91,147,240,110,70,141,96,138,99,194,134,192,87,77,174,48,27,178,248,134,217,43,3,
+    183,147,45,150,61,27,13,165,24,45,39,214,79,71,9,239,169,219,242,151,87,28,205,232,
+    87,172,168,79,143,23,138,221,60,202,189,173,137,112,225,19,84,22,96,158,74,246,214,135,
+    138,187,111,183,69,223,51,113,238,143,176,150,238,148,178,207,101,4,29,215,112,190,85,249,
+    146,237,186,196,226,23,203,53,191,196,63,56,49,129,154,161,73,187,204,248,153,252,54,209,
+    99,173,189,188,55,77,83,205,12,43,241,127,154,130,243,60,79,50,194,124,246,176,113,159,
+    183,139,171,18,212,141,199,163,68,108,196,157,166,118,92,172,182,208,166,167,87,88,34,66,
+    163,125,64,177,99,162,41,149,3,89,61,241,158,218,94,59,253,142,114,246,95,113,185,218,
+    167,12,148,243,247,221,195,125,142,186,234,26,249,174,246,193,98,163,45,59,94,107,210,69,
+    2,229,38,232,20,202,101,117,235,109,153,106,188,149,154,17,89,187,140,187,33,15,138,235,
+    220,234,158,30,84,9,165,212,196,54,233,236,187,92,214,118,33,225,249,210,240,80,169,189,
+    4,53,129,75,94,50,232,112,202,174,43,209,138,155,117,223,168,56,190,121,19,95,192,217,
+    148,141,40,119,247,115,60,76,184,73,53,213,198,173,246,3,225,99,7,105,99,203,248,229,
+    252,194,103,59,82,39,186,70,221,182,80,167,84,119,149,48,120,242,159,60,201,146,195,244,
+    170,144,173,93,31,131,22,172,120,178,112,20,229,138,20,99,208,101,243,177,188,136,46,44,
+    184,131,178,168,87,119,99,68,187,218,154,43,86,161,147,15,222,56,33,60,79,254,189,17,
+    85,227,44,229,208,189,172,212,231,149,58,115,91,250,83,20,24,43,212,96,129,68,14,143,
+    56,27,116,146,125,85,30,151,60,117,51,180,191,116,121,105,143,146,152,249,30,179,185,7,
+    247,79,20,139,176,217,101,54,126,225,231,103,221,250,216,137,150,20,103,254,46,179,185,251,
+    94,108,178,47,81,248,195,84,222,242,173,30,86,75,73,65,122,182,242,93,142,76,105,145,
+    215,200,222,251,40,85,62,83,250,144,158,191,252,234,158,185,142,204,83,102,242,171,239,198,
+    32,163,1,235,135,146,103,214,22,204,207,70,166,113,36,115,159,125,130,4,228,92,251,114,
+    149,226,205,120,119,146,9,31,102,195,21,208,11,9,134,135,233,195,69,238,178,101,59,53,
+    74,90,230,14,43,169,169,17,50,133,45,99,38,148,253,50,207,84,65,218,73,202,73,163,
+    164,13,178,113,11,206,140,104,66,61,82,189,68,228,253,90,149,101,71,174,235,18,123,143,
+    188,12,5,219,92,146,105,14,182,215,95,173,217,156,85,165,232,213,163,75,124,58,107,81,
+    69,157,1,209,155,228,199,167,116,95,63,29,25,216,84,219,111,119,41,63,98,162,252,56,
+    216,157,36,115,154,189,245,165,213,55,137,200,182,176,182,138,247,137,219,239,57,203,224,133,
+    166,166,46,126,147,120,161,89,51,13,149,37,237,219,195,129,41,58,244,4,252,89,158,245,
+    164,30,239,26,39,242,154,19,33,185,142,202,127,130,17,248,148,127,205,192,115,32,100,218,
+    152,107,170,32,84,52,141,46,7,50,187,194,116,85,13,40,41,78,35,198,227,105,204,197,
+    120,185,20,125,234,20,105,138,223,204,57,85,73,225,247,218,128,213,232,251,178,179,1,203,
+    30,92,67,171,64,225,80,24,127,78,148,62,137,114,135,49,60,152,50,232,251,138,163,102,
+    31,222,28,18,206,254,117,115,154,156,165,130,224,196,203,219,99,102,92,149,77,69,196,9,
+    220,147,67,10,240,248,221,57,111,94,127,199,182,123,114,44,5,247,115,119,229,228,120,164,
+    232,188,149,201,160,237,202,234,136,107,30,8,233,229,185,232,154,215,182,58,82,14,76,197,
+    236,213,211,219,179,190,116,37,241,69,123,41,37,211,92,102,111,98,54,15,215,15,232,173,
+    220,101,102,34,114,217,167,139,249,4,166,28,250,239,246,152,233,236,92,73,230,184,51,197,
+    241,207,237,211,159,101,62,8,26,24,43,189,176,92,4,159,186,36,79,233,211,14,179,179,
+    66,248,116,56,183,47,236,170,144,50,44,200,75,175,70,153,158,214,250,235,160,152,55,18,
+    190,112,222,203,41,33,166,67,28,193,121,103,17,223,207,166,150,254,17,8,241,136,55,124,
+    113,255,39,199,36,37,34,120,194,121,119,197,134,84,146,135,247,226,162,205,229,97,151,240,
+    91,114,207,13,73,80,126,184,137,250,167,101,3,245,16,175,251,83,17,135,153,46,44,246,
+    31,29,174,148,8,249,31,158,130,255,218,172,250,8,157,165,234,143,125,147,12,250,210,99,
+    149,147,148,211,96,194,196,56,204,185,158,59,150,107,111,233,78,103,31,126,111,33,126,115,
+    123,1,135,58,147,118,213,215,39,245,92,19,121,117,60,228,246,224,123,81,234,68,82,234,
+    18,145,95,66,29,63,143,203,16,117,84,73,47,102,92,149,216,202,73,44,106,161,186,135,
+    236,122,247,232,152,106,191,27,51,2,159,92,166,209,18,234,71,41,91,71,175,16,244,145,
+    198,160,143,52,17,250,72,147,160,143,180,113,244,145,166,77,251,45,74,36,78,90,205,49,
+    245,153,182,153,58,218,162,239,19,186,241,158,28,155,253,101,180,135,90,145,232,170,245,51,
+    41,189,175,30,244,161,72,217,163,14,64,215,255,229,141,162,43,196,51,181,57,251,122,123,
+    103,226,179,82,9,233,185,51,110,150,159,236,54,29,180,167,78,84,33,36,250,164,48,51,
+    1,34,178,212,17,159,120,219,240,224,72,218,136,245,113,245,245,151,214,244,174,14,83,254,
+    110,236,45,95,70,252,114,66,188,16,15,62,102,32,191,37,176,123,100,249,208,123,8,31,
+    26,97,81,183,95,103,194,97,66,88,191,20,9,120,217,116,245,229,149,227,243,228,157,94,
+    195,7,87,60,175,184,228,98,225,198,216,252,117,216,247,240,198,21,247,86,37,155,223,169,
+    25,111,42,95,212,250,42,242,76,75,25,63,32,241,69,163,138,67,80,109,140,240,185,75,
+    183,165,72,72,226,225,209,204,8,117,123,245,29,75,203,182,180,87,61,78,16,253,189,16,
+    161,236,231,99,231,143,121,129,146,242,151,77,136,20,139,56,157,108,219,147,253,121,103,171,
+    83,234,230,200,41,241,115,16,243,174,45,177,126,61,35,93,242,80,162,186,252,150,194,134,
+    218,219,133,123,179,89,58,53,93,212,242,9,119,227,104,61,145,104,182,126,173,238,218,242,
+    222,206,208,162,202,109,199,99,246,27,221,102,6,204,111,135,72,71,97,66,110,194,202,200,
+    196,13,231,248,226,166,219,74,24,14,8,69,143,188,157,160,182,146,237,135,154,165,151,203,
+    91,214,143,141,184,42,122,99,148,94,229,85,197,228,102,63,196,236,183,148,191,227,138,42,
+    8,82,42,34,196,224,17,28,48,80,101,27,3,102,43,81,121,27,126,109,220,162,178,88,
+    205,87,174,85,84,45,249,176,149,179,246,207,128,85,9,190,27,46,119,79,68,175,190,122,
+    150,83,69,143,245,32,159,59,70,87,148,89,194,120,160,144,118,100,41,117,43,119,52,39,
+    88,135,243,148,32,117,63,134,240,191,151,70,155,113,204,14,201,207,109,228,176,71,131,3,
+    131,51,166,120,242,68,193,230,212,47,23,203,220,180,111,51,152,102,65,47,53,253,120,240,
+    192,170,182,63,25,255,188,215,218,188,82,44,192,43,53,45,180,46,134,28,22,97,125,132,
+    233,166,34,114,20,246,192,20,207,57,197,94,140,241,239,102,159,42,93,187,90,205,88,228,
+    224,156,45,19,73,17,196,202,25,205,177,157,147,221,127,84,87,212,187,64,105,221,118,19,
+    137,111,1,13,246,28,30,245,234,97,218,56,174,206,254,74,234,134,228,103,109,81,210,34,
+    35,174,15,184,213,153,167,5,141,190,86,157,241,86,165,177,59,251,200,109,222,245,17,242,
+    144,220,37,13,43,238,189,184,104,222,201,118,180,182,87,111,175,87,63,184,197,167,125,44,
+    103,67,154,34,227,222,82,132,152,251,140,24,135,118,244,126,185,105,22,237,34,254,81,134,
+    193,115,65,239,229,144,250,17,251,188,81,178,103,136,242,206,12,179,232,25,34,50,149,175,
+    43,107,174,164,249,53,68,149,49,96,61,6,41,212,181,248,38,122,179,171,114,153,23,7,
+    67,248,25,82,55,188,238,242,93,168,42,154,146,69,156,239,57,111,154,171,228,133,171,122,
+    209,1,23,52,188,190,36,134,33,59,67,220,200,17,23,114,230,121,91,66,117,51,67,200,
+    111,2,243,140,186,252,229,189,42,143,60,168,234,175,109,250,71,46,93,171,153,239,68,92,
+    167,90,100,240,149,46,77,191,222,71,125,178,48,227,140,24,214,139,171,159,18,253,94,83,
+    27,175,125,29,150,167,212,112,5,31,105,204,143,157,191,79,85,245,100,248,207,17,189,88,
+    56,101,81,245,233,162,99,145,155,103,210,71,75,37,236,220,135,206,223,191,129,198,215,228,
+    173,117,201,48,56,48,144,190,43,231,221,218,39,224,38,219,40,80,36,225,213,93,175,225,
+    55,53,158,60,37,140,28,213,107,203,110,224,87,134,173,215,144,80,41,106,94,218,25,226,
+    104,189,78,92,50,109,131,7,109,238,140,46,71,93,47,255,179,220,162,180,88,157,45,61,
+    109,213,91,232,163,109,252,53,98,226,45,131,43,221,91,150,243,7,119,229,136,117,235,93,
+    238,213,37,214,95,91,179,145,90,47,197,90,232,45,236,181,155,6,11,99,38,204,117,236,
+    240,23,87,195,75,46,90,99,29,10,247,141,158,35,242,212,67,94,124,77,199,243,87,212,
+    168,77,25,71,85,197,123,188,200,18,182,108,122,236,217,153,86,131,36,120,157,63,39,187,
+    242,152,249,157,65,238,8,5,145,39,105,42,81,30,78,26,9,66,136,99,211,41,110,154,
+    32,145,242,252,203,242,47,85,246,214,167,92,196,143,227,28,22,197,205,64,246,6,125,7,
+    204,98,237,55,63,28,29,241,44,32,6,249,7,239,132,53,151,61,201,253,128,39,106,127,
+    116,231,144,250,197,194,21,219,26,164,92,191,159,209,169,196,71,99,222,240,136,73,212,76,
+    197,187,160,92,47,78,162,151,100,221,211,254,134,20,109,60,128,143,121,163,57,29,213,213,
+    238,241,238,229,59,50,52,62,189,156,102,185,78,124,218,134,147,73,183,150,225,170,151,125,
+    106,92,66,218,21,130,101,124,123,68,196,233,113,105,177,203,208,221,218,46,93,194,149,206,
+    12,84,76,57,45,120,50,247,120,243,189,239,55,163,69,139,209,209,135,121,107,27,82,252,
+    6,220,21,137,142,253,112,158,30,156,67,133,126,106,6,154,122,227,152,178,76,198,244,18,
+    121,191,1,235,107,242,226,207,171,133,148,174,83,223,173,170,219,25,98,17,62,219,230,16,
+    175,244,239,213,178,229,19,6,84,189,31,80,41,83,218,5,53,175,184,199,73,134,179,19,
+    214,50,21,112,182,22,250,224,193,121,243,173,53,160,48,225,246,48,211,246,177,168,129,79,
+    112,108,252,132,19,238,75,148,52,41,139,102,78,183,158,8,107,118,222,102,13,250,155,120,
+    125,138,70,141,252,106,121,203,86,41,186,95,130,206,73,82,47,160,35,222,142,69,18,37,
+    91,182,229,134,246,220,68,197,212,50,138,86,88,135,62,121,74,223,218,60,211,126,248,179,
+    246,125,102,23,130,106,179,168,68,152,26,171,181,29,48,123,50,74,228,222,28,194,213,56,
+    99,88,246,148,24,100,89,246,116,227,142,223,188,238,59,79,136,126,116,66,14,98,189,47,
+    162,87,185,21,205,255,52,62,151,201,159,134,162,220,73,245,115,211,159,38,136,32,209,78,
+    113,100,53,174,206,211,203,143,243,45,107,107,232,96,110,221,226,17,229,181,66,117,187,192,
+    52,231,142,183,48,231,194,184,58,179,43,126,238,21,247,94,180,112,253,246,104,222,58,40,
+    25,225,17,99,5,31,23,244,91,147,239,123,251,43,213,123,19,11,149,139,133,70,68,184,
+    108,105,115,39,75,222,220,249,8,22,148,154,9,47,222,48,144,144,187,154,165,111,90,255,
+    176,125,132,178,184,100,73,173,16,51,208,101,145,250,84,122,107,202,215,160,141,90,85,227,
+    179,181,68,6,28,235,22,164,226,247,64,166,177,45,193,116,98,156,178,115,123,214,105,37,
+    222,178,47,39,186,151,247,253,157,78,237,46,177,189,70,222,255,250,240,113,34,3,237,3,
+    201,227,3,154,233,241,103,135,119,215,202,119,57,109,158,35,54,195,65,190,37,179,59,235,
+    93,27,27,49,71,26,49,178,83,21,18,214,179,139,133,119,22,38,176,123,249,141,31,204,
+    171,225,160,205,190,159,78,102,175,151,56,84,213,140,100,118,231,88,167,26,243,50,245,225,
+    179,228,233,150,109,137,142,42,248,23,246,15,197,136,188,106,82,94,196,118,44,241,253,61,
+    167,206,30,170,243,173,160,85,131,137,219,31,140,25,13,51,244,48,205,205,67,210,250,163,
+    250,197,7,43,230,182,205,101,148,4,141,74,168,165,14,4,173,98,120,225,103,184,223,89,
+    230,188,179,88,222,105,238,161,99,217,141,31,10,255,96,85,95,38,17,254,141,170,35,58,
+    166,83,14,54,27,86,16,227,124,86,95,222,74,22,139,71,240,94,91,188,158,88,207,155,
+    155,42,255,233,149,24,245,158,106,221,27,200,137,245,72,154,216,214,239,99,175,254,13,69,
+    38,190,94,62,206,232,198,48,250,99,246,195,245,149,237,89,60,54,28,63,130,55,211,213,
+    115,75,14,132,13,84,239,153,225,68,75,20,72,69,60,213,152,24,179,249,114,229,247,151,
+    84,165,220,4,155,144,27,195,76,159,208,239,160,127,238,202,97,202,112,142,193,70,217,64,
+    155,56,170,44,222,63,247,80,129,233,90,178,119,206,70,227,40,234,61,117,143,153,161,133,
+    225,95,143,191,255,44,199,77,240,179,156,154,239,63,203,81,186,9,9,120,174,197,86,164,
+    63,150,224,40,9,187,120,131,167,106,42,187,240,184,24,200,73,167,223,236,109,10,57,42,
+    185,19,127,107,192,11,229,75,134,219,201,209,166,106,240,82,240,117,223,76,66,45,69,200,
+    160,134,33,251,191,233,229,78,8,253,255,127,77,253,223,250,194,249,123,168,207,162,114,88,
+    192,201,39,167,42,49,159,164,181,230,47,43,93,162,178,108,135,241,242,35,47,95,227,231,
+    185,127,46,251,90,121,133,61,65,105,64,247,160,200,58,161,51,213,89,230,242,84,242,174,
+    87,90,156,44,235,227,4,133,81,47,95,9,182,212,27,32,129,198,49,111,168,187,78,189,
+    140,61,31,82,72,82,118,43,204,171,233,220,178,164,93,118,117,84,239,90,51,147,97,93,
+    56,10,38,113,99,122,176,159,43,99,255,201,103,81,227,69,12,45,164,187,29,77,97,130,
+    244,237,21,241,219,104,253,96,147,127,126,115,138,134,122,82,208,33,248,148,125,56,26,45,
+    169,64,121,237,194,227,76,196,123,248,183,42,165,218,141,198,26,5,44,8,120,104,215,52,
+    156,50,54,40,81,178,164,180,127,117,113,225,142,32,135,134,71,117,91,218,35,204,70,221,
+    92,198,195,235,162,224,241,239,95,182,140,123,218,245,251,41,179,81,78,115,75,162,8,216,
+    193,239,119,185,32,213,196,167,202,220,170,41,119,124,102,51,154,174,59,74,160,135,194,235,
+    144,170,23,67,187,190,209,40,122,192,105,107,202,38,41,70,75,195,40,106,201,236,18,185,
+    40,57,17,93,116,175,253,250,194,42,252,236,187,36,19,252,59,220,129,165,75,142,176,180,
+    121,49,126,253,22,214,73,11,42,249,55,168,31,150,132,166,207,230,174,140,113,247,227,228,
+    21,154,206,189,1,239,45,135,198,92,67,9,196,193,155,250,217,209,49,40,157,254,193,225,
+    105,226,251,234,116,98,56,37,95,122,115,9,127,69,41,21,27,49,80,21,235,186,62,7,
+    151,175,251,62,194,40,110,11,199,162,86,254,37,189,3,70,233,112,168,138,129,62,108,225,
+    156,182,192,71,187,82,252,155,147,226,243,111,150,54,186,75,82,93,47,91,130,51,73,50,
+    212,177,68,163,125,160,150,119,15,255,64,69,117,11,163,37,171,61,235,93,57,27,127,164,
+    101,75,168,95,30,222,127,123,176,55,8,175,109,253,247,99,81,128,57,227,166,164,78,65,
+    111,251,160,201,227,188,124,132,82,235,134,35,163,249,134,203,174,52,118,168,4,26,58,26,
+    33,233,117,103,110,121,80,110,133,53,155,14,152,137,74,49,196,227,68,60,47,80,255,120,
+    109,154,46,81,82,145,113,226,26,188,88,182,87,81,63,240,80,218,3,67,144,209,206,142,
+    142,98,228,103,140,122,24,126,122,162,97,62,226,4,195,80,166,149,64,174,110,206,125,17,
+    117,7,78,150,77,97,182,195,169,15,201,146,182,57,34,19,222,244,172,210,247,150,65,189,
+    4,245,87,111,221,56,4,222,151,11,223,138,56,235,57,49,198,119,140,192,137,122,127,124,
+    6,242,126,40,226,122,161,81,235,65,208,247,109,251,124,73,233,160,126,40,221,89,242,246,
+    209,71,132,55,254,240,92,45,228,253,82,228,85,103,74,50,78,162,145,159,48,58,120,249,
+    216,180,180,199,29,15,190,103,92,108,217,159,44,137,67,107,235,247,209,201,60,119,168,71,
+    51,33,139,78,185,145,95,148,166,229,3,166,31,194,70,3,63,14,71,150,169,196,118,47,
+    73,250,19,218,180,110,131,69,83,190,9,58,228,226,73,132,79,247,235,53,193,203,221,95,
+    162,164,86,86,28,63,157,238,127,159,161,138,14,45,133,111,81,174,247,20,88,245,86,215,
+    254,27,252,248,85,236,191,65,76,255,113,189,204,30,245,107,226,254,159,156,184,255,71,98,
+    154,214,115,167,179,89,142,192,255,64,52,60,171,235,200,236,208,158,111,143,90,34,102,184,
+    56,99,139,74,182,235,102,219,125,107,200,234,216,97,188,163,209,150,127,239,68,113,82,86,
+    255,227,39,199,133,241,111,61,38,60,113,169,200,194,191,47,176,189,92,17,177,206,179,134,
+    113,140,250,90,10,180,248,125,237,188,252,15,169,91,143,227,255,227,150,116,38,187,95,107,
+    93,188,97,144,230,50,153,165,184,162,162,220,57,93,62,39,42,106,130,171,30,67,143,153,
+    126,216,74,103,225,49,229,52,163,247,213,7,154,43,10,191,229,196,220,110,11,238,140,173,
+    26,96,171,7,217,152,227,223,224,192,191,95,170,88,76,42,237,16,46,41,62,118,179,55,
+    252,15,219,140,96,141,160,214,101,187,237,179,124,93,127,91,109,187,30,70,150,61,50,118,
+    147,199,121,139,126,230,149,234,37,165,207,82,29,166,132,94,94,211,51,248,110,254,133,37,
+    227,215,220,229,43,76,75,58,123,45,108,241,238,11,91,236,95,237,222,93,81,27,176,213,
+    117,94,122,10,120,231,76,26,231,115,127,117,228,86,139,113,139,86,24,90,84,89,148,238,
+    236,191,59,255,37,251,64,186,165,134,168,79,215,106,150,229,109,177,208,0,222,43,222,129,
+    167,73,203,75,175,249,111,157,82,57,157,235,212,80,60,118,180,110,229,236,232,242,15,220,
+    121,181,12,93,127,203,248,212,183,189,74,18,3,199,218,204,72,136,228,5,223,243,64,98,
+    11,155,167,97,88,173,227,55,123,173,174,208,131,21,19,79,108,181,146,153,224,121,250,204,
+    243,49,166,95,2,165,214,75,50,152,103,178,170,52,218,205,46,239,79,79,169,155,168,12,
+    51,82,116,137,248,237,216,18,167,73,209,83,164,240,255,5,149,153,99,36,105,106,28,152,
+    62,22,230,72,104,234,74,187,84,203,221,251,246,196,216,27,241,21,167,175,76,216,84,113,
+    51,179,1,79,160,197,194,229,11,174,205,99,134,255,27,255,173,228,200,63,190,255,183,146,
+    21,102,248,125,52,219,244,102,137,137,234,220,244,200,148,90,205,157,32,213,119,90,25,68,
+    241,159,173,129,215,40,148,141,141,139,224,31,231,225,165,130,215,13,254,95,220,50,209,223,
+    68,254,235,39,255,92,249,223,52,251,151,200,191,105,246,47,17,245,255,6,49,201,255,135,
+    49,137,255,55,136,73,228,191,65,76,255,135,183,206,255,141,49,253,231,91,231,87,141,249,
+    85,99,126,213,152,95,53,230,87,141,249,85,99,126,213,152,95,53,230,87,141,249,85,99,
+    126,213,152,95,53,230,127,80,141,73,119,38,238,40,14,147,183,92,168,159,62,244,39,56,
+    8,253,71,63,195,209,32,144,186,88,118,138,70,125,221,248,96,211,201,167,237,18,111,40,
+    34,228,157,119,226,127,94,49,254,191,243,128,248,85,139,255,39,156,15,255,35,107,241,161,
+    95,53,230,87,141,249,85,99,126,213,152,95,53,230,87,141,249,85,99,126,213,152,95,53,
+    230,87,141,249,85,99,126,213,152,255,57,53,134,121,130,168,144,24,54,120,205,51,229,224,
+    207,63,195,249,255,0,98,96,174,45,192,177,0,0,
+};
+
+const EmbeddedAsset EmbeddedAssets[] = {
+    {"index.html", (const char *)Response0, 164, NotModified0, sizeof(NotModified0) - 1,
+     "\"a3f5bbdee7695852\"", Response0 + 164, 3219, 9529, 0xa3f5bbdee7695852ull, true},
+    {"js/three.min.js", (const char *)Response1, 179, NotModified1, sizeof(NotModified1) - 1,
+     "\"36f0601d2fe05236\"", Response1 + 179, 134255, 534113, 0x36f0601d2fe05236ull, true},
+    {"js/inflate.min.js", (const char *)Response2, 177, NotModified2, sizeof(NotModified2) - 1,
+     "\"d0eebcecf8098d41\"", Response2 + 177, 2906, 6980, 0xd0eebcecf8098d41ull, true},
+    {"js/GLTFLoader.js", (const char *)Response3, 178, NotModified3, sizeof(NotModified3) - 1,
+     "\"93600fea4438b5fd\"", Response3 + 178, 18639, 80066, 0x93600fea4438b5fdull, true},
+    {"js/OrbitControls.js", (const char *)Response4, 177, NotModified4, sizeof(NotModified4) - 1,
+     "\"1185a1da785949ba\"", Response4 + 177, 4886, 23020, 0x1185a1da785949baull, true},
+    {"assets/GadgetPainted.glb", (const char *)Response5, 173, NotModified5, sizeof(NotModified5) - 1,
+     "\"fcefb51dfe0662c1\"", Response5 + 173, 23145, 45504, 0xfcefb51dfe0662c1ull, true},
+};
+
+const int EmbeddedAssetCount = 6;
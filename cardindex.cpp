@@ -0,0 +1,349 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+
+/**
+ * Flash card index task.
+ */
+
+// NB Constants
+#include <constants.h>
+
+// NB Libs
+#include <stdlib.h>
+#include <string.h>
+#include <ucos.h>
+
+// EFFS Files
+#include <effs_fat/fat.h>
+
+#include "FileSystemUtils.h"
+#include "cardindex.h"
+#include "embedded.h"
+#include "log.h"
+#include "mount.h"
+#include "stats.h"
+#include "timing.h"
+#include "web.h"
+
+// A path's key. Entries are sorted on all three fields, and a lookup must match all three.
+struct PathKey
+{
+    uint32_t hash;    // FNV-1a
+    uint32_t check;   // djb2, so that a collision in one hash alone is not taken for a match
+    uint16_t len;
+};
+
+struct IndexEntry
+{
+    PathKey key;
+    int16_t header;   // Slot in Headers, or -1
+};
+
+// Two tables: lookups read the live one while the task fills the other
+static IndexEntry Tables[2][CARD_INDEX_MAX];
+static CardIndexHeader Headers[2][CARD_INDEX_HEADERS];
+static uint32_t TableCount[2];
+static int Live = -1;            // -1 while there is no usable index
+static uint32_t LiveCard;        // CardGeneration() the live table was built from
+
+static volatile bool Started = false;   // Lookups answer CARD_INDEX_UNKNOWN without the task
+static OS_CRIT IndexCrit;
+static OS_SEM IndexSem;
+static volatile uint32_t Dirty = 0;   // Bumped by CardIndexInvalidate()
+
+static CardIndexStatus Status;
+
+// Only used by the index task
+static char WalkPath[CARD_INDEX_PATH_MAX];
+static IndexEntry *pWalkTable;
+static CardIndexHeader *pWalkHeaders;
+static uint32_t WalkCount;
+static uint32_t WalkHeaders;
+static bool WalkComplete;
+static uint8_t CompareBuf[FS_SECTOR_SIZE];
+
+/**
+ * @brief Returns true if the file in the current directory has the same content as the asset
+ * compiled into the image, so the asset can be served in its place.
+ */
+static bool SameAsEmbedded(const char *name, unsigned long size, const EmbeddedAsset *asset)
+{
+    if (size != asset->rawLen) { return false; }
+    F_FILE *f = f_open((char *)name, "r");
+    if (f == nullptr) { return false; }
+    uint64_t h = EMBEDDED_HASH_INIT;
+    long n;
+    while ((n = f_read(CompareBuf, 1, sizeof(CompareBuf), f)) > 0) { h = EmbeddedHash(h, CompareBuf, n); }
+    f_close(f);
+    return (h == asset->contentHash);
+}
+
+/**
+ * @brief Two independent hashes and the length of the path, ignoring case and slash direction,
+ * as FAT does
+ */
+static PathKey MakePathKey(const char *path)
+{
+    PathKey k;
+    k.hash = 2166136261u;
+    k.check = 5381;
+    const char *p = path;
+    for (; *p; p++)
+    {
+        char c = *p;
+        if (c == '\\') { c = '/'; }
+        else if ((c >= 'A') && (c <= 'Z')) { c += 'a' - 'A'; }
+        k.hash = (k.hash ^ (uint8_t)c) * 16777619u;
+        k.check = (k.check * 33) ^ (uint8_t)c;
+    }
+    k.len = p - path;
+    return k;
+}
+
+static int CompareKey(const PathKey &x, const PathKey &y)
+{
+    if (x.hash != y.hash) { return (x.hash < y.hash) ? -1 : 1; }
+    if (x.check != y.check) { return (x.check < y.check) ? -1 : 1; }
+    if (x.len != y.len) { return (x.len < y.len) ? -1 : 1; }
+    return 0;
+}
+
+/**
+ * @brief Builds the response header for a file in the current directory, as MyDoGet() would
+ * send it. Returns its slot, or -1 if the slots are used up or the type is unknown.
+ */
+static int BuildHeader(const F_FIND &finder)
+{
+    if (WalkHeaders >= CARD_INDEX_HEADERS) { return -1; }
+    const char *ext = strrchr(finder.filename, '.');
+    char mime[64];
+    if ((ext == nullptr) || !LookupMimeType(ext + 1, mime, sizeof(mime))) { return -1; }
+
+    CardIndexHeader &h = pWalkHeaders[WalkHeaders];
+    sniprintf(h.etag, sizeof(h.etag), "\"%lx-%04x%04x\"", (unsigned long)finder.filesize, (unsigned)finder.cdate,
+              (unsigned)finder.ctime);
+    h.len = FormatFileHeader(h.text, CARD_INDEX_HEADER_MAX, mime, finder.filesize, h.etag);
+    if (h.len == 0) { return -1; }
+    h.fileLen = finder.filesize;
+    return WalkHeaders++;
+}
+
+/**
+ * @brief Adds every file below the current directory. len is the length of WalkPath,
+ * which holds the current directory relative to the root, ending in '/' unless empty.
+ */
+static void WalkDir(int len, int depth)
+{
+    F_FIND finder;
+    int rc = f_findfirst("*.*", &finder);
+    while ((rc == F_NO_ERROR) && WalkComplete)
+    {
+        int nameLen = strlen(finder.filename);
+        if (finder.filename[0] == '.') {}   // "." and ".."
+        else if ((len + nameLen + 2) > CARD_INDEX_PATH_MAX) { WalkComplete = false; }
+        else if (finder.attr & F_ATTR_DIR)
+        {
+            if ((depth >= CARD_INDEX_DEPTH) || (f_chdir(finder.filename) != F_NO_ERROR)) { WalkComplete = false; }
+            else
+            {
+                memcpy(WalkPath + len, finder.filename, nameLen);
+                WalkPath[len + nameLen] = '/';
+                WalkPath[len + nameLen + 1] = 0;
+                WalkDir(len + nameLen + 1, depth + 1);
+                WalkPath[len] = 0;
+                f_chdir("..");
+            }
+        }
+        else if (WalkCount >= CARD_INDEX_MAX) { WalkComplete = false; }
+        else
+        {
+            memcpy(WalkPath + len, finder.filename, nameLen + 1);
+            const EmbeddedAsset *asset = FindEmbeddedAsset(WalkPath);
+            if ((asset != nullptr) && SameAsEmbedded(finder.filename, finder.filesize, asset))
+            {
+                // Left out, so lookups answer CARD_INDEX_MISSING and the image's copy is served
+                LOG_DEBUG("Indexed %s : same as the image\r\n", WalkPath);
+            }
+            else
+            {
+                IndexEntry &e = pWalkTable[WalkCount++];
+                e.key = MakePathKey(WalkPath);
+                e.header = BuildHeader(finder);
+                LOG_DEBUG("Indexed %s : %lu Bytes\r\n", WalkPath, (unsigned long)finder.filesize);
+            }
+            WalkPath[len] = 0;
+        }
+        rc = f_findnext(&finder);
+    }
+}
+
+static int CompareEntry(const void *a, const void *b)
+{
+    return CompareKey(((const IndexEntry *)a)->key, ((const IndexEntry *)b)->key);
+}
+
+/**
+ * @brief Builds a table for the mounted card and publishes it, unless the card changed or was
+ * written to meanwhile. Returns true when the result is final, published or not.
+ */
+static bool Build()
+{
+    uint32_t card = CardGeneration();
+    uint32_t dirty = Dirty;
+    if (!CardSelectDrive()) { return true; }
+
+    uint32_t startUs = TimingNowUs();
+    int spare = (Live == 0) ? 1 : 0;
+    pWalkTable = Tables[spare];
+    pWalkHeaders = Headers[spare];
+    WalkCount = 0;
+    WalkHeaders = 0;
+    WalkComplete = true;
+    WalkPath[0] = 0;
+    f_chdir("\\");
+    WalkDir(0, 0);
+    qsort(pWalkTable, WalkCount, sizeof(IndexEntry), CompareEntry);
+    uint32_t ms = (TimingNowUs() - startUs) / 1000;
+
+    if ((card != CardGeneration()) || (dirty != Dirty)) { return false; }
+    if (!WalkComplete)
+    {
+        LOG_WARN("Card index incomplete after %lu files, not used\r\n", (unsigned long)WalkCount);
+        return true;
+    }
+
+    OSCritEnter(&IndexCrit, 0);
+    TableCount[spare] = WalkCount;
+    Live = spare;
+    LiveCard = card;
+    Status.files = WalkCount;
+    Status.headers = WalkHeaders;
+    Status.builds++;
+    Status.lastBuildMs = ms;
+    OSCritLeave(&IndexCrit);
+
+    StatsBootMark(BOOT_CARD_INDEXED);
+    LOG_INFO("Indexed %lu files on the flash card in %lu ms\r\n", (unsigned long)WalkCount, (unsigned long)ms);
+    return true;
+}
+
+static void IndexTask(void *pd)
+{
+    f_enterFS();
+
+    uint32_t builtCard = 0;
+    uint32_t builtDirty = 0;
+    while (1)
+    {
+        // Woken by invalidations, and checks for a new card once a second
+        OSSemPend(&IndexSem, TICKS_PER_SECOND);
+
+        if (!CardMounted() || ((builtCard == CardGeneration()) && (builtDirty == Dirty))) { continue; }
+
+        // Let a burst of writes (an FTP upload of a whole directory, say) finish first
+        while (builtDirty != Dirty)
+        {
+            builtDirty = Dirty;
+            OSTimeDly(CARD_INDEX_SETTLE_TICKS);
+        }
+
+        builtCard = CardGeneration();
+        if (!Build()) { builtCard = 0; }   // Changed underneath us, go again
+    }
+}
+
+void InitCardIndex(int prio)
+{
+    OSCritInit(&IndexCrit);
+    OSSemInit(&IndexSem, 0);
+    memset(&Status, 0, sizeof(Status));
+    Started = true;
+    OSSimpleTaskCreatewName(IndexTask, prio, "Index");
+}
+
+CardIndexAnswer CardIndexLookup(const char *path, CardIndexHeader *header)
+{
+    if (header != nullptr) { header->len = 0; }
+    if (!Started) { return CARD_INDEX_UNKNOWN; }
+
+    // The index holds plain paths, so leave anything with "." or ".." segments to the card
+    if ((path[0] == '.') || (strstr(path, "/.") != nullptr) || (strstr(path, "\\.") != nullptr))
+    {
+        return CARD_INDEX_UNKNOWN;
+    }
+
+    PathKey k = MakePathKey(path);
+    CardIndexAnswer answer = CARD_INDEX_UNKNOWN;
+
+    OSCritEnter(&IndexCrit, 0);
+    if ((Live >= 0) && (LiveCard == CardGeneration()))
+    {
+        const IndexEntry *t = Tables[Live];
+        int lo = 0;
+        int hi = (int)TableCount[Live] - 1;
+        answer = CARD_INDEX_MISSING;
+        while (lo <= hi)
+        {
+            int mid = (lo + hi) / 2;
+            int cmp = CompareKey(t[mid].key, k);
+            if (cmp == 0)
+            {
+                answer = CARD_INDEX_MAYBE;
+                if ((header != nullptr) && (t[mid].header >= 0)) { *header = Headers[Live][t[mid].header]; }
+                break;
+            }
+            if (cmp < 0) { lo = mid + 1; }
+            else { hi = mid - 1; }
+        }
+    }
+    OSCritLeave(&IndexCrit);
+    return answer;
+}
+
+void CardIndexInvalidate()
+{
+    if (!Started) { return; }
+    OSCritEnter(&IndexCrit, 0);
+    Live = -1;
+    Dirty++;
+    OSCritLeave(&IndexCrit);
+    OSSemPost(&IndexSem);
+}
+
+void CardIndexGetStatus(CardIndexStatus &status)
+{
+    if (!Started)
+    {
+        memset(&status, 0, sizeof(status));
+        return;
+    }
+    OSCritEnter(&IndexCrit, 0);
+    status = Status;
+    status.ready = (Live >= 0) && (LiveCard == CardGeneration());
+    OSCritLeave(&IndexCrit);
+}
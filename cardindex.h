@@ -0,0 +1,100 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+#ifndef _CARDINDEX_H_
+#define _CARDINDEX_H_
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Background index of the files on the flash card.
+ *
+ * A low priority task walks the card after each mount and keeps a sorted
+ * table of path keys: two independent hashes and the length. The web server
+ * uses it to skip the card for URLs the card does not have, such as the
+ * compiled-in pages, without a directory search. A key match only means
+ * "maybe", so a found path is still opened on the card as before.
+ *
+ * The first CARD_INDEX_HEADERS files of a known MIME type also get their
+ * complete response header built while indexing, with Content-Length and an
+ * ETag made from the file's size and timestamp.
+ *
+ * Card files with the same content as an asset compiled into the image (see
+ * embedded.h) are left out, so the image's copy is served instead.
+ *
+ * Anything that creates, renames or deletes files must call
+ * CardIndexInvalidate(). Lookups answer CARD_INDEX_UNKNOWN until the task
+ * has rebuilt the table, which it does once writes have settled for
+ * CARD_INDEX_SETTLE_TICKS.
+ */
+
+#define CARD_INDEX_MAX (1024)       // Files beyond this leave the index incomplete, and unused
+#define CARD_INDEX_DEPTH (6)        // Directory levels walked below the root
+#define CARD_INDEX_PATH_MAX (256)
+#define CARD_INDEX_SETTLE_TICKS (TICKS_PER_SECOND)
+#define CARD_INDEX_HEADERS (64)
+#define CARD_INDEX_HEADER_MAX (200)
+
+enum CardIndexAnswer
+{
+    CARD_INDEX_UNKNOWN,   // No usable index, look on the card
+    CARD_INDEX_MISSING,   // Certainly not on the card
+    CARD_INDEX_MAYBE,     // Probably on the card
+};
+
+// A response header built when the file was indexed. Fits in a POOL_PATH block.
+struct CardIndexHeader
+{
+    uint32_t fileLen;   // The Content-Length it carries, only valid while the file is this size
+    uint16_t len;       // 0 when the file has no prebuilt header
+    char etag[24];      // Quoted, as sent
+    char text[CARD_INDEX_HEADER_MAX];
+};
+
+struct CardIndexStatus
+{
+    bool ready;
+    uint32_t files;
+    uint32_t headers;
+    uint32_t builds;
+    uint32_t lastBuildMs;
+};
+
+// Starts the index task. The task enters the file system itself.
+void InitCardIndex(int prio);
+
+// Looks up a card path relative to the root, such as "js/three.min.js", and copies out its
+// prebuilt header if header is given. Safe to call from any task.
+CardIndexAnswer CardIndexLookup(const char *path, CardIndexHeader *header = nullptr);
+
+// Drops the index and schedules a rebuild. Safe to call from any task.
+void CardIndexInvalidate();
+
+void CardIndexGetStatus(CardIndexStatus &status);
+
+#endif /* _CARDINDEX_H_ */
@@ -0,0 +1,390 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+/**
+ * Per-client telemetry delivery with adaptive send rates.
+ */
+
+// NB Libs
+#include <iosys.h>
+#include <string.h>
+#include <tcp.h>
+#include <ucos.h>
+
+#include "clients.h"
+#include "control.h"
+#include "events.h"
+#include "log.h"
+#include "pool.h"
+#include "stats.h"
+#include "telemetry.h"
+#include "timing.h"
+#include "trace.h"
+
+static TelemetryClient Clients[MAX_TELEMETRY_CLIENTS];
+
+// Connections waiting to be adopted by the telemetry task
+static OS_CRIT IncomingCrit;
+static int IncomingFd[MAX_TELEMETRY_CLIENTS];
+static int IncomingSock[MAX_TELEMETRY_CLIENTS];
+static bool IncomingBinary[MAX_TELEMETRY_CLIENTS];
+static int IncomingCount = 0;
+
+// The newest pose of each object, for keyframes
+static FusedPose LatestPose[CLIENT_MAX_OBJECTS];
+static uint32_t LatestMask = 0;
+
+// The event holding each object's newest pose, whose JSON frame JSON clients send as it is
+static uint32_t LatestEventId[CLIENT_MAX_OBJECTS];
+
+/**
+ * @brief Sets up the client table. Must be called before the web server starts.
+ */
+void InitTelemetryClients()
+{
+    for (int i = 0; i < MAX_TELEMETRY_CLIENTS; i++)
+    {
+        Clients[i].fd = -1;
+    }
+    IncomingCount = 0;
+    LatestMask = 0;
+    OSCritInit(&IncomingCrit);
+}
+
+/**
+ * @brief Closes a client's connection and frees its slot.
+ */
+static void DropClient(TelemetryClient &c)
+{
+    LOG_INFO("Closing telemetry client fd %d\r\n", c.fd);
+    ControlRelease(&c - Clients, c.fd);
+    c.fd = -1;
+}
+
+/**
+ * @brief Moves any connections handed over by the HTTP task into the table. When the table is
+ * full, the client that has been connected longest is replaced, since that is most often a
+ * page that was reloaded or closed. A dropped client's slot only comes free once the control
+ * task has closed its socket, so the newcomer waits in the queue until then.
+ */
+static void AdoptIncoming()
+{
+    if (IncomingCount == 0) { return; }
+
+    uint32_t now = TimingNowUs();
+    int freeSlots[MAX_TELEMETRY_CLIENTS];
+    int freeCount = 0;
+    int closing = 0;
+    for (int i = 0; i < MAX_TELEMETRY_CLIENTS; i++)
+    {
+        if (Clients[i].fd >= 0) { continue; }
+        if (ControlSlotFree(i)) { freeSlots[freeCount++] = i; }
+        else { closing++; }
+    }
+
+    int fds[MAX_TELEMETRY_CLIENTS];
+    int socks[MAX_TELEMETRY_CLIENTS];
+    bool binary[MAX_TELEMETRY_CLIENTS];
+    int count;
+
+    OSCritEnter(&IncomingCrit, 0);
+    count = (IncomingCount < freeCount) ? IncomingCount : freeCount;
+    memcpy(fds, IncomingFd, sizeof(int) * count);
+    memcpy(socks, IncomingSock, sizeof(int) * count);
+    memcpy(binary, IncomingBinary, sizeof(bool) * count);
+    IncomingCount -= count;
+    memmove(IncomingFd, IncomingFd + count, sizeof(int) * IncomingCount);
+    memmove(IncomingSock, IncomingSock + count, sizeof(int) * IncomingCount);
+    memmove(IncomingBinary, IncomingBinary + count, sizeof(bool) * IncomingCount);
+    int waiting = IncomingCount;
+    OSCritLeave(&IncomingCrit);
+
+    for (int n = 0; n < count; n++)
+    {
+        int slot = freeSlots[n];
+        TelemetryClient &c = Clients[slot];
+        memset(&c, 0, sizeof(c));
+        c.fd = fds[n];
+        c.sock = socks[n];
+        c.binary = binary[n];
+        c.connectedUs = now;
+        c.intervalUs = CLIENT_MIN_INTERVAL_US;
+        c.floorUs = CLIENT_MIN_INTERVAL_US;
+        c.nextDueUs = now;
+        c.objectMask = 1;
+        ControlWatch(slot, c.fd);
+    }
+
+    // Make room for whoever is still waiting, counting slots that are already on their way
+    while (closing < waiting)
+    {
+        int oldest = -1;
+        for (int i = 0; i < MAX_TELEMETRY_CLIENTS; i++)
+        {
+            if (Clients[i].fd < 0) { continue; }
+            if ((oldest < 0) || ((now - Clients[i].connectedUs) > (now - Clients[oldest].connectedUs)))
+            {
+                oldest = i;
+            }
+        }
+        if (oldest < 0) { break; }
+        DropClient(Clients[oldest]);
+        closing++;
+    }
+}
+
+/**
+ * @brief Slows a client down after a sign that its connection is not keeping up.
+ */
+static void BackOff(TelemetryClient &c)
+{
+    c.intervalUs = (c.intervalUs >= CLIENT_MAX_INTERVAL_US / 2) ? CLIENT_MAX_INTERVAL_US : c.intervalUs * 2;
+    c.goodStreak = 0;
+    c.backoffs++;
+}
+
+/**
+ * @brief Speeds a client up by an eighth after a run of quick writes.
+ */
+static void SpeedUp(TelemetryClient &c)
+{
+    if (++c.goodStreak < CLIENT_SPEEDUP_STREAK) { return; }
+    c.goodStreak = 0;
+    uint32_t faster = c.intervalUs - c.intervalUs / 8;
+    c.intervalUs = (faster < c.floorUs) ? c.floorUs : faster;
+}
+
+/**
+ * @brief Applies any commands the client sent on the control channel. Returns false if the
+ * client has gone away.
+ */
+static bool ApplyControl(TelemetryClient &c, int slot)
+{
+    ControlCommand cmd;
+    if (!ControlTake(slot, c.fd, cmd)) { return true; }
+
+    if (cmd.flags & CONTROL_CLOSED)
+    {
+        DropClient(c);
+        return false;
+    }
+
+    if (cmd.flags & CONTROL_SET_RATE)
+    {
+        uint32_t floor = cmd.intervalUs;
+        floor = (floor < CLIENT_MIN_INTERVAL_US) ? CLIENT_MIN_INTERVAL_US : floor;
+        floor = (floor > CLIENT_MAX_INTERVAL_US) ? CLIENT_MAX_INTERVAL_US : floor;
+        c.floorUs = floor;
+        c.intervalUs = floor;
+        c.goodStreak = 0;
+    }
+
+    // JSON frames carry no object number, so JSON clients only ever get object 0
+    if ((cmd.flags & CONTROL_SET_OBJECTS) && c.binary)
+    {
+        c.objectMask = cmd.objectMask & ((1u << CLIENT_MAX_OBJECTS) - 1);
+        c.pendingMask &= c.objectMask;
+    }
+
+    if (cmd.flags & CONTROL_KEYFRAME)
+    {
+        uint32_t mask = LatestMask & c.objectMask;
+        for (int obj = 0; obj < CLIENT_MAX_OBJECTS; obj++)
+        {
+            if (mask & (1u << obj)) { c.pending[obj] = LatestPose[obj]; }
+        }
+        c.pendingMask |= mask;
+        c.nextDueUs = TimingNowUs();
+    }
+
+    LOG_DEBUG("Client fd %d: interval %lu us, objects 0x%lx\r\n", c.fd, (unsigned long)c.intervalUs,
+              (unsigned long)c.objectMask);
+    return true;
+}
+
+/**
+ * @brief Queues a WebSocket for the telemetry task. Returns false if too many are already waiting.
+ */
+bool AddTelemetryClient(int fd, int sock, bool binary)
+{
+    bool added = false;
+    OSCritEnter(&IncomingCrit, 0);
+    if (IncomingCount < MAX_TELEMETRY_CLIENTS)
+    {
+        IncomingFd[IncomingCount] = fd;
+        IncomingSock[IncomingCount] = sock;
+        IncomingBinary[IncomingCount] = binary;
+        IncomingCount++;
+        added = true;
+    }
+    OSCritLeave(&IncomingCrit);
+    return added;
+}
+
+/**
+ * @brief Replaces each client's pending pose with the newest one.
+ */
+void PublishPose(const FusedPose &pose)
+{
+    if (pose.object >= CLIENT_MAX_OBJECTS) { return; }
+
+    uint32_t bit = 1u << pose.object;
+    LatestPose[pose.object] = pose;
+    LatestMask |= bit;
+    LatestEventId[pose.object] = EventPublish(pose);
+
+    for (int i = 0; i < MAX_TELEMETRY_CLIENTS; i++)
+    {
+        TelemetryClient &c = Clients[i];
+        if ((c.fd < 0) || !(c.objectMask & bit)) { continue; }
+        if (c.pendingMask & bit)
+        {
+            c.framesDropped++;
+            StatsAdd(STAT_TASK_MAIN, STAT_FRAMES_DROPPED);
+        }
+        c.pending[pose.object] = pose;
+        c.pendingMask |= bit;
+    }
+}
+
+/**
+ * @brief Sends the pending poses to each client that is due, as far as its send window can take
+ * them without blocking.
+ */
+void ServiceTelemetryClients()
+{
+    AdoptIncoming();
+
+    // Taken when the first frame is encoded, so an idle pass holds no buffer
+    PoolBlock frame;
+
+    uint32_t now = TimingNowUs();
+    for (int i = 0; i < MAX_TELEMETRY_CLIENTS; i++)
+    {
+        TelemetryClient &c = Clients[i];
+        if (c.fd < 0) { continue; }
+        if (!ApplyControl(c, i) || (c.pendingMask == 0)) { continue; }
+        if (TimingDiffUs(now, c.nextDueUs) < 0) { continue; }
+
+        if (!frame.Acquire(POOL_FRAME)) { return; }
+
+        // One frame per pending object, oldest object number first. A frame is only written
+        // when the send window can take all of it, so writeall() never waits on the peer.
+        uint32_t start = TimingNowUs();
+        int sent = 0;
+        int bytes = 0;
+        bool failed = false;
+        bool full = false;
+        for (int obj = 0; (obj < CLIENT_MAX_OBJECTS) && !failed; obj++)
+        {
+            if (!(c.pendingMask & (1u << obj))) { continue; }
+
+            // The pending pose is always the newest one, so a JSON client sends the frame
+            // already encoded for the event stream, unless it has left the history
+            int len;
+            const char *data = frame.Data();
+            if (c.binary)
+            {
+                len = EncodeBinaryFrame(c.pending[obj], (uint8_t *)frame.Data(), POOL_FRAME_SIZE);
+            }
+            else if ((data = EventJson(LatestEventId[obj], len)) == nullptr)
+            {
+                data = frame.Data();
+                len = EncodeJsonFrame(c.pending[obj], frame.Data(), POOL_FRAME_SIZE);
+            }
+
+            if (TcpGetTxBufferAvailSpace(c.sock) < len + WS_FRAME_HEADER_MAX)
+            {
+                full = true;
+                break;
+            }
+
+            failed = (writeall(c.fd, data, len) < 0);
+            c.pendingMask &= ~(1u << obj);
+            sent++;
+            bytes += len;
+        }
+        uint32_t end = TimingNowUs();
+
+        if (failed)
+        {
+            DropClient(c);
+            continue;
+        }
+
+        if (sent > 0)
+        {
+            c.framesSent += sent;
+            c.lastWriteUs = end - start;
+            StatsAdd(STAT_TASK_MAIN, STAT_FRAMES_SENT, sent);
+            StatsAdd(STAT_TASK_MAIN, STAT_TELEMETRY_BYTES, bytes);
+            StatsRecordUs(STAT_TASK_MAIN, STAT_HIST_WRITEALL, c.lastWriteUs);
+            TRACE_RECORD(TRACE_WRITEALL, start, c.lastWriteUs, bytes);
+        }
+
+        // The send window filled up. The rest stays pending, and is replaced by newer poses
+        // if the client is still behind when it is next due.
+        if (full)
+        {
+            BackOff(c);
+            c.nextDueUs = now + c.intervalUs;
+            continue;
+        }
+
+        if (c.lastWriteUs > CLIENT_SLOW_WRITE_US) { BackOff(c); }
+        else
+        {
+            SpeedUp(c);
+        }
+
+        // Schedule from the due time rather than from now, so the rate does not drift
+        c.nextDueUs += c.intervalUs;
+        if (TimingDiffUs(end, c.nextDueUs) > 0) { c.nextDueUs = end + c.intervalUs; }
+    }
+}
+
+/**
+ * @brief Returns the number of connected telemetry clients.
+ */
+int TelemetryClientCount()
+{
+    int count = 0;
+    for (int i = 0; i < MAX_TELEMETRY_CLIENTS; i++)
+    {
+        if (Clients[i].fd >= 0) { count++; }
+    }
+    return count;
+}
+
+/**
+ * @brief Returns a client slot for reporting, or nullptr if the slot is free.
+ */
+const TelemetryClient *GetTelemetryClient(int index)
+{
+    if ((index < 0) || (index >= MAX_TELEMETRY_CLIENTS) || (Clients[index].fd < 0)) { return nullptr; }
+    return &Clients[index];
+}
@@ -0,0 +1,103 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+#ifndef _CLIENTS_H_
+#define _CLIENTS_H_
+#pragma once
+
+#include <stdint.h>
+
+#include "fusion.h"
+
+/**
+ * Telemetry clients.
+ *
+ * Each WebSocket client gets its own send interval, adjusted from what its
+ * connection can take: when the TCP send window is full or a write takes
+ * too long, the interval doubles; after a run of quick writes it shrinks
+ * again, down to the fastest rate we offer or the rate the client asked
+ * for, whichever is slower.
+ *
+ * Each client holds only the newest pose of each object it has selected
+ * (latest value wins). A pose that is replaced before the client was due
+ * is counted as dropped, never queued, so a slow client sees fewer updates
+ * rather than older ones. Clients change their rate and objects, and ask
+ * for keyframes, through the control channel (see control.h).
+ *
+ * JSON clients send the frame already encoded for the event stream history
+ * (see events.h), so each pose is written as JSON once however many
+ * WebSocket and event stream clients receive it.
+ *
+ * Connections are handed over from the HTTP task with AddTelemetryClient(),
+ * but the table itself is only changed by the task that calls
+ * ServiceTelemetryClients(), so sending needs no locking.
+ */
+
+#define MAX_TELEMETRY_CLIENTS (4)
+#define CLIENT_MIN_INTERVAL_US (1000000 / 20)   // Fastest rate offered to a client, 20 Hz
+#define CLIENT_MAX_INTERVAL_US (1000000)        // Slowest rate before giving up on keeping up, 1 Hz
+#define CLIENT_SLOW_WRITE_US (5000)             // A write that takes longer than this means back off
+#define CLIENT_SPEEDUP_STREAK (20)              // Quick writes in a row before speeding up
+#define CLIENT_MAX_OBJECTS (8)                  // Objects a client can select
+#define WS_FRAME_HEADER_MAX (10)                // Bytes a server WebSocket frame adds to a message
+
+struct TelemetryClient
+{
+    int fd;                  // WebSocket fd from WSUpgrade(), -1 when the slot is free
+    int sock;                // The TCP socket under fd, whose send space limits writes
+    bool binary;             // Binary frames instead of JSON
+    uint32_t connectedUs;    // When the client was adopted
+    uint32_t intervalUs;     // Current send interval
+    uint32_t floorUs;        // Shortest interval the client asked for
+    uint32_t nextDueUs;      // When the next frame may be sent
+    uint32_t goodStreak;     // Quick writes since the last back off
+    uint32_t objectMask;     // Objects the client has selected, bit n for object n
+    uint32_t pendingMask;    // Objects whose pending pose has not been sent
+    FusedPose pending[CLIENT_MAX_OBJECTS];
+    uint32_t lastWriteUs;    // Duration of the last pass of writes
+    uint32_t framesSent;
+    uint32_t framesDropped;  // Poses replaced before they could be sent
+    uint32_t backoffs;
+};
+
+// Must be called once before the web server starts
+void InitTelemetryClients();
+
+// Hands a freshly upgraded WebSocket, and the TCP socket it was upgraded from, to the telemetry
+// task. Safe to call from any task.
+bool AddTelemetryClient(int fd, int sock, bool binary);
+
+// Offers the newest pose to every client
+void PublishPose(const FusedPose &pose);
+
+// Adopts new connections and sends to every client that is due. Call often from one task.
+void ServiceTelemetryClients();
+
+int TelemetryClientCount();
+const TelemetryClient *GetTelemetryClient(int index);
+
+#endif /* _CLIENTS_H_ */
@@ -0,0 +1,467 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+/**
+ * Telemetry control channel: command reader task and in-place JSON tokenizer.
+ */
+
+// NB Constants
+#include <constants.h>
+
+// NB Libs
+#include <iosys.h>
+#include <string.h>
+#include <ucos.h>
+
+#include "clients.h"
+#include "control.h"
+#include "log.h"
+
+#define CONTROL_POLL_TICKS (TICKS_PER_SECOND / 4)   // How soon new and released sockets are noticed
+
+// Read state for each watched socket. Only the control task touches these.
+struct ControlSlot
+{
+    int fd;   // -1 when not watching
+    int len;  // Bytes waiting in rx
+    char rx[CONTROL_RX_SIZE];
+};
+
+static ControlSlot Slots[MAX_TELEMETRY_CLIENTS];
+static bool ControlRunning = false;
+
+// Sockets handed over by the main task. A slot is not reused until its ReleaseFd has been
+// closed, so one entry per slot is always enough.
+static OS_CRIT HandoverCrit;
+static int WatchFd[MAX_TELEMETRY_CLIENTS];
+static volatile int ReleaseFd[MAX_TELEMETRY_CLIENTS];
+
+// Commands waiting for the main task. A set bit in MailPending means Mail[slot] holds something.
+static OS_CRIT MailCrit;
+static ControlCommand Mail[MAX_TELEMETRY_CLIENTS];
+static volatile uint32_t MailPending = 0;
+
+/*-----------------------------------------------------------------------------
+ * In-place tokenizer
+ *---------------------------------------------------------------------------*/
+enum TokenType
+{
+    TOK_END,
+    TOK_ERROR,
+    TOK_LBRACE,
+    TOK_RBRACE,
+    TOK_LBRACKET,
+    TOK_RBRACKET,
+    TOK_COLON,
+    TOK_COMMA,
+    TOK_STRING,   // text points into the message, without the quotes
+    TOK_NUMBER,   // value holds the integer part
+    TOK_TRUE,
+    TOK_FALSE,
+    TOK_NULL
+};
+
+struct Token
+{
+    TokenType type;
+    const char *text;
+    int len;
+    int32_t value;
+};
+
+static bool MatchWord(const char *p, const char *end, const char *word, int len)
+{
+    return ((end - p) >= len) && (memcmp(p, word, len) == 0);
+}
+
+/**
+ * @brief Reads the token at p and advances p past it. Strings are not unescaped, so a key
+ * written with escapes will not match; none of ours need them.
+ */
+static TokenType NextToken(const char *&p, const char *end, Token &tok)
+{
+    while ((p < end) && ((*p == ' ') || (*p == '\t') || (*p == '\r') || (*p == '\n')))
+    {
+        p++;
+    }
+
+    tok.text = p;
+    tok.len = 0;
+    tok.value = 0;
+    if (p >= end) { return tok.type = TOK_END; }
+
+    switch (*p)
+    {
+        case '{': p++; return tok.type = TOK_LBRACE;
+        case '}': p++; return tok.type = TOK_RBRACE;
+        case '[': p++; return tok.type = TOK_LBRACKET;
+        case ']': p++; return tok.type = TOK_RBRACKET;
+        case ':': p++; return tok.type = TOK_COLON;
+        case ',': p++; return tok.type = TOK_COMMA;
+        case '"':
+        {
+            const char *start = ++p;
+            while ((p < end) && (*p != '"'))
+            {
+                if ((*p == '\\') && (p + 1 < end)) { p++; }
+                p++;
+            }
+            if (p >= end) { return tok.type = TOK_ERROR; }
+            tok.text = start;
+            tok.len = p - start;
+            p++;
+            return tok.type = TOK_STRING;
+        }
+        case 't':
+            if (!MatchWord(p, end, "true", 4)) { return tok.type = TOK_ERROR; }
+            p += 4;
+            return tok.type = TOK_TRUE;
+        case 'f':
+            if (!MatchWord(p, end, "false", 5)) { return tok.type = TOK_ERROR; }
+            p += 5;
+            return tok.type = TOK_FALSE;
+        case 'n':
+            if (!MatchWord(p, end, "null", 4)) { return tok.type = TOK_ERROR; }
+            p += 4;
+            return tok.type = TOK_NULL;
+        default: break;
+    }
+
+    // Numbers. Only the integer part is kept; a fraction or exponent is skipped.
+    bool negative = (*p == '-');
+    if (negative) { p++; }
+    if ((p >= end) || (*p < '0') || (*p > '9')) { return tok.type = TOK_ERROR; }
+
+    int32_t v = 0;
+    while ((p < end) && (*p >= '0') && (*p <= '9'))
+    {
+        if (v < 100000000) { v = v * 10 + (*p - '0'); }
+        p++;
+    }
+    while ((p < end) && (((*p >= '0') && (*p <= '9')) || (*p == '.') || (*p == 'e') || (*p == 'E') || (*p == '+') ||
+                         (*p == '-')))
+    {
+        p++;
+    }
+    tok.len = p - tok.text;
+    tok.value = negative ? -v : v;
+    return tok.type = TOK_NUMBER;
+}
+
+static bool KeyIs(const Token &tok, const char *key)
+{
+    int len = strlen(key);
+    return (tok.len == len) && (memcmp(tok.text, key, len) == 0);
+}
+
+/**
+ * @brief Parses one message, a flat JSON object, into cmd. Unknown keys are skipped so newer
+ * viewers can talk to older firmware. Returns false if the message is malformed.
+ */
+static bool ParseCommand(const char *msg, int len, ControlCommand &cmd)
+{
+    const char *p = msg;
+    const char *end = msg + len;
+    Token tok;
+
+    if (NextToken(p, end, tok) != TOK_LBRACE) { return false; }
+
+    while (true)
+    {
+        if (NextToken(p, end, tok) == TOK_RBRACE) { return true; }
+        if (tok.type != TOK_STRING) { return false; }
+        Token key = tok;
+        if (NextToken(p, end, tok) != TOK_COLON) { return false; }
+
+        NextToken(p, end, tok);
+        if (tok.type == TOK_LBRACKET)
+        {
+            // Arrays hold numbers only
+            uint32_t mask = 0;
+            while (NextToken(p, end, tok) != TOK_RBRACKET)
+            {
+                if (tok.type == TOK_COMMA) { continue; }
+                if (tok.type != TOK_NUMBER) { return false; }
+                if ((tok.value >= 0) && (tok.value < 32)) { mask |= (uint32_t)1 << tok.value; }
+            }
+            if (KeyIs(key, "objects"))
+            {
+                cmd.objectMask = mask;
+                cmd.flags |= CONTROL_SET_OBJECTS;
+            }
+        }
+        else if ((tok.type == TOK_NUMBER) && KeyIs(key, "rate"))
+        {
+            if (tok.value > 0)
+            {
+                cmd.intervalUs = 1000000 / (uint32_t)tok.value;
+                cmd.flags |= CONTROL_SET_RATE;
+            }
+        }
+        else if ((tok.type == TOK_TRUE) && KeyIs(key, "keyframe"))
+        {
+            cmd.flags |= CONTROL_KEYFRAME;
+        }
+        else if ((tok.type != TOK_NUMBER) && (tok.type != TOK_STRING) && (tok.type != TOK_TRUE) &&
+                 (tok.type != TOK_FALSE) && (tok.type != TOK_NULL))
+        {
+            return false;
+        }
+
+        if (NextToken(p, end, tok) == TOK_RBRACE) { return true; }
+        if (tok.type != TOK_COMMA) { return false; }
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ * Control task
+ *---------------------------------------------------------------------------*/
+static void Post(int slot, const ControlCommand &cmd)
+{
+    OSCritEnter(&MailCrit, 0);
+    ControlCommand &m = Mail[slot];
+    if (!(MailPending & (1u << slot)) || (m.fd != cmd.fd))
+    {
+        memset(&m, 0, sizeof(m));
+        m.fd = cmd.fd;
+    }
+    m.flags |= cmd.flags;
+    if (cmd.flags & CONTROL_SET_RATE) { m.intervalUs = cmd.intervalUs; }
+    if (cmd.flags & CONTROL_SET_OBJECTS) { m.objectMask = cmd.objectMask; }
+    MailPending |= (1u << slot);
+    OSCritLeave(&MailCrit);
+}
+
+/**
+ * @brief Finds each complete top-level object in the slot's buffer, parses it, and keeps any
+ * partial message for the next read. Data before a '{' is discarded.
+ */
+static void ExtractMessages(int slot)
+{
+    ControlSlot &s = Slots[slot];
+    int start = -1;
+    int depth = 0;
+    bool inString = false;
+    int consumed = 0;
+
+    for (int i = 0; i < s.len; i++)
+    {
+        char ch = s.rx[i];
+        if (inString)
+        {
+            if (ch == '\\') { i++; }
+            else if (ch == '"') { inString = false; }
+            continue;
+        }
+
+        if (ch == '"') { inString = (depth > 0); }
+        else if (ch == '{')
+        {
+            if (depth++ == 0) { start = i; }
+        }
+        else if ((ch == '}') && (depth > 0) && (--depth == 0))
+        {
+            ControlCommand cmd;
+            memset(&cmd, 0, sizeof(cmd));
+            cmd.fd = s.fd;
+            if (ParseCommand(s.rx + start, i + 1 - start, cmd) && (cmd.flags != 0)) { Post(slot, cmd); }
+            else
+            {
+                LOG_DEBUG("Ignored control message on fd %d\r\n", s.fd);
+            }
+        }
+
+        // Everything up to the end of the last complete message, or junk outside one, is done
+        if (depth == 0) { consumed = i + 1; }
+    }
+
+    if ((consumed == 0) && (s.len == CONTROL_RX_SIZE))
+    {
+        // A message longer than the buffer. Drop it and resynchronize on the next '{'.
+        LOG_WARN("Control message too long on fd %d\r\n", s.fd);
+        consumed = s.len;
+    }
+
+    memmove(s.rx, s.rx + consumed, s.len - consumed);
+    s.len -= consumed;
+}
+
+static void ReadSlot(int slot)
+{
+    ControlSlot &s = Slots[slot];
+    int n = read(s.fd, s.rx + s.len, CONTROL_RX_SIZE - s.len);
+    if (n <= 0)
+    {
+        // Stop reading; the main task drops the client and hands the socket back to be closed
+        ControlCommand cmd;
+        memset(&cmd, 0, sizeof(cmd));
+        cmd.fd = s.fd;
+        cmd.flags = CONTROL_CLOSED;
+        Post(slot, cmd);
+        s.fd = -1;
+        return;
+    }
+
+    s.len += n;
+    ExtractMessages(slot);
+}
+
+/**
+ * @brief Applies the main task's handovers: closes released sockets, then starts watching
+ * new ones.
+ */
+static void ApplyHandover()
+{
+    int release[MAX_TELEMETRY_CLIENTS];
+    int watch[MAX_TELEMETRY_CLIENTS];
+
+    OSCritEnter(&HandoverCrit, 0);
+    for (int i = 0; i < MAX_TELEMETRY_CLIENTS; i++)
+    {
+        release[i] = ReleaseFd[i];
+        watch[i] = WatchFd[i];
+        WatchFd[i] = -1;
+    }
+    OSCritLeave(&HandoverCrit);
+
+    for (int i = 0; i < MAX_TELEMETRY_CLIENTS; i++)
+    {
+        if (release[i] < 0) { continue; }
+        if (Slots[i].fd == release[i]) { Slots[i].fd = -1; }
+        close(release[i]);
+    }
+
+    // Only now may the main task reuse the released slots
+    OSCritEnter(&HandoverCrit, 0);
+    for (int i = 0; i < MAX_TELEMETRY_CLIENTS; i++)
+    {
+        if (release[i] >= 0) { ReleaseFd[i] = -1; }
+    }
+    OSCritLeave(&HandoverCrit);
+
+    for (int i = 0; i < MAX_TELEMETRY_CLIENTS; i++)
+    {
+        if (watch[i] < 0) { continue; }
+        Slots[i].fd = watch[i];
+        Slots[i].len = 0;
+    }
+}
+
+static void ControlTask(void *pd)
+{
+    while (1)
+    {
+        ApplyHandover();
+
+        fd_set readFds;
+        FD_ZERO(&readFds);
+        int watched = 0;
+        for (int i = 0; i < MAX_TELEMETRY_CLIENTS; i++)
+        {
+            if (Slots[i].fd < 0) { continue; }
+            FD_SET(Slots[i].fd, &readFds);
+            watched++;
+        }
+
+        if (watched == 0)
+        {
+            OSTimeDly(CONTROL_POLL_TICKS);
+            continue;
+        }
+
+        if (select(FD_SETSIZE, &readFds, nullptr, nullptr, CONTROL_POLL_TICKS) <= 0) { continue; }
+
+        for (int i = 0; i < MAX_TELEMETRY_CLIENTS; i++)
+        {
+            if ((Slots[i].fd >= 0) && FD_ISSET(Slots[i].fd, &readFds)) { ReadSlot(i); }
+        }
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ * Main task interface
+ *---------------------------------------------------------------------------*/
+void InitControl(int prio)
+{
+    for (int i = 0; i < MAX_TELEMETRY_CLIENTS; i++)
+    {
+        Slots[i].fd = -1;
+        Slots[i].len = 0;
+        WatchFd[i] = -1;
+        ReleaseFd[i] = -1;
+    }
+    MailPending = 0;
+    OSCritInit(&HandoverCrit);
+    OSCritInit(&MailCrit);
+    ControlRunning = true;
+    OSSimpleTaskCreatewName(ControlTask, prio, "Control");
+}
+
+void ControlWatch(int slot, int fd)
+{
+    if (!ControlRunning) { return; }
+
+    // Anything still in the mailbox belongs to the previous connection
+    OSCritEnter(&MailCrit, 0);
+    MailPending &= ~(1u << slot);
+    OSCritLeave(&MailCrit);
+
+    OSCritEnter(&HandoverCrit, 0);
+    WatchFd[slot] = fd;
+    OSCritLeave(&HandoverCrit);
+}
+
+void ControlRelease(int slot, int fd)
+{
+    if (!ControlRunning)
+    {
+        close(fd);
+        return;
+    }
+
+    OSCritEnter(&HandoverCrit, 0);
+    if (WatchFd[slot] == fd) { WatchFd[slot] = -1; }
+    ReleaseFd[slot] = fd;
+    OSCritLeave(&HandoverCrit);
+}
+
+bool ControlSlotFree(int slot)
+{
+    return !ControlRunning || ReleaseFd[slot] < 0;
+}
+
+bool ControlTake(int slot, int fd, ControlCommand &cmd)
+{
+    if (!(MailPending & (1u << slot))) { return false; }
+
+    OSCritEnter(&MailCrit, 0);
+    cmd = Mail[slot];
+    MailPending &= ~(1u << slot);
+    OSCritLeave(&MailCrit);
+
+    return cmd.fd == fd;
+}
@@ -0,0 +1,87 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+#ifndef _CONTROL_H_
+#define _CONTROL_H_
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Telemetry control channel.
+ *
+ * Viewers send commands on the same WebSocket they receive telemetry on,
+ * as flat JSON objects, one or more keys per message:
+ *
+ *     {"rate":10}            Send at most 10 frames per second
+ *     {"objects":[0,2]}      Send these objects (binary clients only)
+ *     {"keyframe":true}      Send the latest pose of every selected object now
+ *
+ * Incoming data is read by its own task, below the main task's priority, so
+ * reading and parsing never delay a frame. Each connection has a fixed RX
+ * buffer; messages are tokenized in place in that buffer, with no tree and
+ * no allocation. The control task only posts the result to a per-client
+ * mailbox, which the main task checks with a single flag test each pass.
+ *
+ * The control task also owns closing telemetry sockets, so a socket number
+ * can never be reused while it is still being read. The main task hands a
+ * socket back with ControlRelease() instead of calling close(), and does not
+ * reuse that slot until ControlSlotFree() says the close has happened.
+ */
+
+#define CONTROL_RX_SIZE (256)   // Longest command message
+
+// ControlCommand::flags
+#define CONTROL_SET_RATE (0x01)
+#define CONTROL_SET_OBJECTS (0x02)
+#define CONTROL_KEYFRAME (0x04)
+#define CONTROL_CLOSED (0x08)   // The peer closed the connection
+
+struct ControlCommand
+{
+    int fd;                // The connection the command arrived on
+    uint8_t flags;
+    uint32_t intervalUs;   // With CONTROL_SET_RATE
+    uint32_t objectMask;   // With CONTROL_SET_OBJECTS, bit n selects object n
+};
+
+// Starts the control task. Must be called before the web server starts.
+void InitControl(int prio);
+
+// Starts reading commands from the telemetry client in slot. Main task only.
+void ControlWatch(int slot, int fd);
+
+// Stops reading from fd and closes it. Main task only.
+void ControlRelease(int slot, int fd);
+
+// True once the socket last released from slot has been closed, so the slot may take a new one.
+bool ControlSlotFree(int slot);
+
+// Takes the commands received for slot since the last call, if they came from fd. Main task only.
+bool ControlTake(int slot, int fd, ControlCommand &cmd);
+
+#endif /* _CONTROL_H_ */
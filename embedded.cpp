@@ -0,0 +1,73 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+
+/**
+ * Serving of the assets compiled into the image.
+ */
+
+// NB Constants
+#include <constants.h>
+
+// NB Libs
+#include <iosys.h>
+#include <string.h>
+
+#include "embedded.h"
+#include "stats.h"
+#include "timing.h"
+#include "trace.h"
+#include "web.h"
+
+const EmbeddedAsset *FindEmbeddedAsset(const char *path)
+{
+    if (*path == 0) { path = "index.html"; }
+    for (int i = 0; i < EmbeddedAssetCount; i++)
+    {
+        if (strcasecmp(EmbeddedAssets[i].path, path) == 0) { return &EmbeddedAssets[i]; }
+    }
+    return nullptr;
+}
+
+bool SendEmbeddedAsset(int sock, const EmbeddedAsset *asset, const char *headers)
+{
+    if (RequestHeaderHas(headers, "If-None-Match", asset->etag))
+    {
+        writeall(sock, asset->notModified, asset->notModifiedLen);
+        StatsAdd(STAT_TASK_HTTP, STAT_HTTP_NOT_MODIFIED);
+        return true;
+    }
+    if (asset->gzip && !RequestHeaderHas(headers, "Accept-Encoding", "gzip")) { return false; }
+
+    uint32_t start = TimingNowUs();
+    writeall(sock, asset->header, asset->headerLen + asset->bodyLen);
+    uint32_t written = TimingNowUs();
+    StatsRecordUs(STAT_TASK_HTTP, STAT_HIST_WRITEALL, written - start);
+    TRACE_RECORD(TRACE_WRITEALL, start, written - start, asset->bodyLen);
+    StatsAdd(STAT_TASK_HTTP, STAT_HTTP_EMBEDDED_BYTES, asset->bodyLen);
+    return true;
+}
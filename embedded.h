@@ -0,0 +1,88 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+#ifndef _EMBEDDED_H_
+#define _EMBEDDED_H_
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Viewer assets compiled into the firmware image.
+ *
+ * The viewer page, its scripts and the model are gzip compressed by
+ * host/assetembed into the checked-in assetdata.cpp ("make embedded-assets",
+ * see EMBEDDED_ASSETS in the makefile). Each asset comes with complete 200 and 304 header blocks,
+ * including an ETag of its uncompressed content. The 200 header and the
+ * body are stored back to back, so serving an asset is a single write
+ * straight from flash, with no card access and no formatting.
+ *
+ * A file on the flash card overrides the asset with the same path, as long
+ * as its content differs. The card index compares the two in the background
+ * (see cardindex.h), so the stock card contents do not shadow the bundle.
+ */
+
+struct EmbeddedAsset
+{
+    const char *path;              // Relative to the root, e.g. "js/three.min.js"
+    const char *header;            // Complete 200 response header, immediately followed by the body
+    uint16_t headerLen;
+    const char *notModified;       // Complete 304 response header
+    uint16_t notModifiedLen;
+    const char *etag;              // Quoted, as sent and as compared with If-None-Match
+    const uint8_t *body;           // header + headerLen
+    uint32_t bodyLen;
+    uint32_t rawLen;               // Uncompressed size
+    uint64_t contentHash;          // EmbeddedHash() of the uncompressed content
+    bool gzip;                     // The body is gzip encoded
+};
+
+// Generated into assetdata.cpp
+extern const EmbeddedAsset EmbeddedAssets[];
+extern const int EmbeddedAssetCount;
+
+#define EMBEDDED_HASH_INIT (14695981039346656037ull)
+
+// 64-bit FNV-1a over content, continued from h. host/assetembed computes the same value.
+inline uint64_t EmbeddedHash(uint64_t h, const void *data, uint32_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    for (uint32_t i = 0; i < len; i++) { h = (h ^ p[i]) * 1099511628211ull; }
+    return h;
+}
+
+// Returns the asset for a path relative to the root, or nullptr. An empty path finds index.html.
+const EmbeddedAsset *FindEmbeddedAsset(const char *path);
+
+/**
+ * Sends the asset, or a 304 when the request's If-None-Match carries its
+ * ETag. headers points at the request headers. Clients that do not accept
+ * gzip get false back and nothing sent, so the caller can try elsewhere.
+ */
+bool SendEmbeddedAsset(int sock, const EmbeddedAsset *asset, const char *headers);
+
+#endif /* _EMBEDDED_H_ */
@@ -0,0 +1,445 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+
+/**
+ * Server-Sent Events history and listeners.
+ */
+
+// NB Libs
+#include <iosys.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <tcp.h>
+#include <ucos.h>
+
+#include "events.h"
+#include "log.h"
+#include "pool.h"
+#include "stats.h"
+#include "telemetry.h"
+#include "timing.h"
+#include "web.h"
+
+// How long a new connection may take to send its request
+#define EVENT_REQUEST_TICKS (2 * TICKS_PER_SECOND)
+
+static const char Keepalive[] = ": keepalive\n\n";
+
+struct EventRecord
+{
+    uint32_t id;
+    uint16_t len;        // The whole record
+    uint16_t jsonStart;  // The JSON frame within it
+    uint16_t jsonLen;
+    char text[EVENT_RECORD_MAX];
+};
+
+// The id and event lines take at most 36 bytes, and the record ends with a blank line
+static_assert(EVENT_RECORD_MAX - 36 - 2 >= TELEMETRY_JSON_FRAME_MAX, "EVENT_RECORD_MAX too small for a JSON frame");
+static_assert((EVENT_HISTORY & (EVENT_HISTORY - 1)) == 0, "EVENT_HISTORY must be a power of two");
+
+static EventRecord History[EVENT_HISTORY];
+static uint32_t NextId = 1;   // Ids start at 1, so 0 can mean "none"
+
+static EventClient Clients[MAX_EVENT_CLIENTS];
+
+// Listeners waiting to be adopted by the main task
+static OS_CRIT IncomingCrit;
+static int IncomingFd[MAX_EVENT_CLIENTS];
+static uint32_t IncomingLastId[MAX_EVENT_CLIENTS];
+static int IncomingCount = 0;
+
+static int ListenPort = EVENTS_PORT;
+
+/*-----------------------------------------------------------------------------
+ * History
+ *---------------------------------------------------------------------------*/
+uint32_t EventPublish(const FusedPose &pose)
+{
+    uint32_t id = NextId++;
+    EventRecord &r = History[id & (EVENT_HISTORY - 1)];
+
+    int n = sniprintf(r.text, EVENT_RECORD_MAX, "id: %lu\nevent: pose%d\ndata: ", (unsigned long)id, pose.object);
+    int json = EncodeJsonFrame(pose, r.text + n, EVENT_RECORD_MAX - n - 2);
+    r.id = id;
+    r.jsonStart = n;
+    r.jsonLen = json;
+    r.text[n + json] = '\n';
+    r.text[n + json + 1] = '\n';
+    r.len = n + json + 2;
+    return id;
+}
+
+/**
+ * @brief Returns the record for event id, or nullptr if it has not been published or has been
+ * overwritten.
+ */
+static const EventRecord *FindRecord(uint32_t id)
+{
+    const EventRecord &r = History[id & (EVENT_HISTORY - 1)];
+    return ((id != 0) && (r.id == id)) ? &r : nullptr;
+}
+
+const char *EventJson(uint32_t id, int &len)
+{
+    const EventRecord *r = FindRecord(id);
+    if (r == nullptr) { return nullptr; }
+    len = r->jsonLen;
+    return r->text + r->jsonStart;
+}
+
+/*-----------------------------------------------------------------------------
+ * Listener task
+ *---------------------------------------------------------------------------*/
+
+/**
+ * @brief Reads the request into buf until the blank line that ends its headers, the buffer is
+ * full, or the client stops sending. Returns false if nothing usable arrived.
+ */
+static bool ReadRequest(int fd, char *buf, int size)
+{
+    int len = 0;
+    while (len < size - 1)
+    {
+        int n = ReadWithTimeout(fd, buf + len, size - 1 - len, EVENT_REQUEST_TICKS);
+        if (n <= 0) { break; }
+        len += n;
+        buf[len] = 0;
+        if (strstr(buf, "\r\n\r\n") != nullptr) { return true; }
+    }
+    buf[len] = 0;
+    return (len > 0) && (strstr(buf, "\r\n") != nullptr);
+}
+
+/**
+ * @brief Returns the event id the request wants to resume after, from the Last-Event-ID header
+ * or the lastEventId query parameter, or 0 if it names none.
+ */
+static uint32_t RequestedLastId(const char *target, const char *headers)
+{
+    char value[16];
+    if (RequestHeaderValue(headers, "Last-Event-ID", value, sizeof(value)) > 0)
+    {
+        return strtoul(value, nullptr, 10);
+    }
+
+    const char *query = strchr(target, '?');
+    const char *p = (query != nullptr) ? strstr(query, "lastEventId=") : nullptr;
+    return (p != nullptr) ? strtoul(p + 12, nullptr, 10) : 0;
+}
+
+/**
+ * @brief Answers one request on the event stream port. A stream request is answered with the
+ * stream header and handed to the main task; anything else is answered and closed.
+ */
+static void ServeRequest(int fd)
+{
+    PoolBlock request(POOL_FRAME, TICKS_PER_SECOND);
+    if ((request.Data() == nullptr) || !ReadRequest(fd, request.Data(), POOL_FRAME_SIZE))
+    {
+        close(fd);
+        return;
+    }
+
+    // Request line: METHOD /target HTTP/1.x
+    char *line = request.Data();
+    char *lineEnd = strstr(line, "\r\n");
+    *lineEnd = 0;
+    const char *headers = lineEnd + 2;
+    char *target = strchr(line, ' ');
+    if (target != nullptr)
+    {
+        *target++ = 0;
+        char *end = strchr(target, ' ');
+        if (end != nullptr) { *end = 0; }
+    }
+
+    if (strcmp(line, "OPTIONS") == 0)
+    {
+        // CORS preflight, for pages that send Last-Event-ID themselves
+        writestring(fd, "HTTP/1.1 204 No Content\r\n"
+                        "Access-Control-Allow-Origin: *\r\n"
+                        "Access-Control-Allow-Methods: GET\r\n"
+                        "Access-Control-Allow-Headers: Last-Event-ID, Cache-Control\r\n"
+                        "Access-Control-Max-Age: 86400\r\n"
+                        "Content-Length: 0\r\n\r\n");
+        close(fd);
+        return;
+    }
+
+    if ((strcmp(line, "GET") != 0) || (target == nullptr) || (strncasecmp(target, "/events", 7) != 0) ||
+        ((target[7] != 0) && (target[7] != '?')))
+    {
+        writestring(fd, "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n");
+        close(fd);
+        return;
+    }
+
+    uint32_t lastId = RequestedLastId(target, headers);
+
+    bool added = false;
+    OSCritEnter(&IncomingCrit, 0);
+    if (IncomingCount < MAX_EVENT_CLIENTS)
+    {
+        IncomingFd[IncomingCount] = fd;
+        IncomingLastId[IncomingCount] = lastId;
+        IncomingCount++;
+        added = true;
+    }
+    OSCritLeave(&IncomingCrit);
+
+    if (!added)
+    {
+        LOG_WARN("Too many pending event stream listeners.\r\n");
+        writestring(fd, "HTTP/1.1 503 Service Unavailable\r\nRetry-After: 1\r\nContent-Length: 0\r\n\r\n");
+        close(fd);
+    }
+}
+
+static void EventsTask(void *pd)
+{
+    while (1)
+    {
+        // A port still held by an earlier run comes free after a while, so keep trying
+        int listener = listen(INADDR_ANY, ListenPort, 5);
+        if (listener < 0)
+        {
+            LOG_ERROR("Event stream: unable to listen on port %d\r\n", ListenPort);
+            OSTimeDly(5 * TICKS_PER_SECOND);
+            continue;
+        }
+        LOG_INFO("Event stream listening on port %d\r\n", ListenPort);
+
+        while (1)
+        {
+            IPADDR address;
+            WORD port;
+            int fd = accept(listener, &address, &port, 0);
+            if (fd >= 0) { ServeRequest(fd); }
+        }
+    }
+}
+
+/**
+ * @brief Sets up the listener table and starts the listener task.
+ */
+void InitEventStream(int port, int prio)
+{
+    for (int i = 0; i < MAX_EVENT_CLIENTS; i++)
+    {
+        Clients[i].fd = -1;
+    }
+    IncomingCount = 0;
+    ListenPort = port;
+    OSCritInit(&IncomingCrit);
+    OSSimpleTaskCreatewName(EventsTask, prio, "Events");
+}
+
+/*-----------------------------------------------------------------------------
+ * Main task interface
+ *---------------------------------------------------------------------------*/
+
+/**
+ * @brief Closes a listener's connection and frees its slot.
+ */
+static void DropClient(EventClient &c)
+{
+    LOG_INFO("Closing event stream listener fd %d\r\n", c.fd);
+    close(c.fd);
+    c.fd = -1;
+}
+
+/**
+ * @brief Picks the first event to send a new listener. A resumable id continues after that
+ * event. An id that has left the history continues at the oldest event kept. No id, or one
+ * from before a restart, starts with the newest event.
+ */
+static uint32_t FirstEvent(uint32_t lastId)
+{
+    uint32_t newest = NextId - 1;
+    uint32_t oldest = (NextId > EVENT_HISTORY) ? NextId - EVENT_HISTORY : 1;
+
+    if ((lastId == 0) || ((int32_t)(lastId - newest) > 0)) { return (newest != 0) ? newest : NextId; }
+    if ((int32_t)(lastId + 1 - oldest) < 0) { return oldest; }
+    return lastId + 1;
+}
+
+/**
+ * @brief Moves the listeners handed over by the listener task into the table, and sends each
+ * its stream header. When the table is full the new listener is turned away, since an open
+ * stream is a dashboard that is still being watched.
+ */
+static void AdoptIncoming()
+{
+    int fds[MAX_EVENT_CLIENTS];
+    uint32_t lastIds[MAX_EVENT_CLIENTS];
+    int count;
+
+    OSCritEnter(&IncomingCrit, 0);
+    count = IncomingCount;
+    memcpy(fds, IncomingFd, sizeof(int) * count);
+    memcpy(lastIds, IncomingLastId, sizeof(uint32_t) * count);
+    IncomingCount = 0;
+    OSCritLeave(&IncomingCrit);
+
+    for (int n = 0; n < count; n++)
+    {
+        int slot = -1;
+        for (int i = 0; i < MAX_EVENT_CLIENTS; i++)
+        {
+            if (Clients[i].fd < 0)
+            {
+                slot = i;
+                break;
+            }
+        }
+        if (slot < 0)
+        {
+            writestring(fds[n], "HTTP/1.1 503 Service Unavailable\r\nRetry-After: 5\r\nContent-Length: 0\r\n\r\n");
+            close(fds[n]);
+            continue;
+        }
+
+        char header[224];
+        int len = sniprintf(header, sizeof(header),
+                            "HTTP/1.1 200 OK\r\n"
+                            "Content-Type: text/event-stream\r\n"
+                            "Cache-Control: no-cache\r\n"
+                            "Access-Control-Allow-Origin: *\r\n"
+                            "X-Accel-Buffering: no\r\n"
+                            "Connection: close\r\n\r\n"
+                            "retry: %d\n\n",
+                            EVENT_RETRY_MS);
+        if (writeall(fds[n], header, len) < 0)
+        {
+            close(fds[n]);
+            continue;
+        }
+
+        EventClient &c = Clients[slot];
+        memset(&c, 0, sizeof(c));
+        c.fd = fds[n];
+        c.nextId = FirstEvent(lastIds[n]);
+        c.lastSendUs = TimingNowUs();
+        LOG_INFO("Event stream listener fd %d, from event %lu\r\n", c.fd, (unsigned long)c.nextId);
+    }
+}
+
+/**
+ * @brief Sends each listener the events it has not seen, as far as its send window allows.
+ * A listener that falls further behind than the history skips ahead to the oldest event.
+ */
+void ServiceEventClients()
+{
+    AdoptIncoming();
+
+    uint32_t now = TimingNowUs();
+    uint32_t oldest = (NextId > EVENT_HISTORY) ? NextId - EVENT_HISTORY : 1;
+    for (int i = 0; i < MAX_EVENT_CLIENTS; i++)
+    {
+        EventClient &c = Clients[i];
+        if (c.fd < 0) { continue; }
+
+        if ((int32_t)(c.nextId - oldest) < 0)
+        {
+            uint32_t skipped = oldest - c.nextId;
+            c.eventsSkipped += skipped;
+            StatsAdd(STAT_TASK_MAIN, STAT_FRAMES_DROPPED, skipped);
+            c.nextId = oldest;
+        }
+
+        uint32_t start = TimingNowUs();
+        int sent = 0;
+        int bytes = 0;
+        bool failed = false;
+        while (c.nextId != NextId)
+        {
+            // Only whole records, so a slow listener never blocks the main task
+            const EventRecord *r = FindRecord(c.nextId);
+            if (TcpGetTxBufferAvailSpace(c.fd) < r->len) { break; }
+            failed = (writeall(c.fd, r->text, r->len) < 0);
+            if (failed) { break; }
+            c.nextId++;
+            sent++;
+            bytes += r->len;
+        }
+
+        // An idle stream gets a keepalive, under the same rule as a record
+        if (!failed && (c.nextId == NextId) && (TimingDiffUs(now, c.lastSendUs) > EVENT_KEEPALIVE_US) &&
+            (TcpGetTxBufferAvailSpace(c.fd) >= (int)sizeof(Keepalive) - 1))
+        {
+            failed = (writeall(c.fd, Keepalive, sizeof(Keepalive) - 1) < 0);
+            c.lastSendUs = now;
+        }
+
+        // Nothing written for this long, though records or a keepalive were due: the listener
+        // has stopped reading
+        if (!failed && (sent == 0) && (TimingDiffUs(now, c.lastSendUs) > EVENT_STALL_US))
+        {
+            LOG_WARN("Event stream listener fd %d stopped reading\r\n", c.fd);
+            failed = true;
+        }
+
+        if (failed)
+        {
+            DropClient(c);
+            continue;
+        }
+        if (sent == 0) { continue; }
+
+        uint32_t us = TimingNowUs() - start;
+        c.eventsSent += sent;
+        c.lastSendUs = now;
+        StatsAdd(STAT_TASK_MAIN, STAT_FRAMES_SENT, sent);
+        StatsAdd(STAT_TASK_MAIN, STAT_TELEMETRY_BYTES, bytes);
+        StatsRecordUs(STAT_TASK_MAIN, STAT_HIST_WRITEALL, us);
+    }
+}
+
+/**
+ * @brief Returns the number of connected event stream listeners.
+ */
+int EventClientCount()
+{
+    int count = 0;
+    for (int i = 0; i < MAX_EVENT_CLIENTS; i++)
+    {
+        if (Clients[i].fd >= 0) { count++; }
+    }
+    return count;
+}
+
+/**
+ * @brief Returns a listener slot for reporting, or nullptr if the slot is free.
+ */
+const EventClient *GetEventClient(int index)
+{
+    if ((index < 0) || (index >= MAX_EVENT_CLIENTS) || (Clients[index].fd < 0)) { return nullptr; }
+    return &Clients[index];
+}
@@ -0,0 +1,100 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+
+#ifndef _EVENTS_H_
+#define _EVENTS_H_
+#pragma once
+
+#include <stdint.h>
+
+#include "fusion.h"
+
+/**
+ * Server-Sent Events telemetry.
+ *
+ * A one-way alternative to the WebSocket telemetry, for dashboards behind
+ * proxies that do not pass WebSocket upgrades. Each fused pose becomes one
+ * event in a short history ring. The record is complete, including its id
+ * and event lines, and is encoded once in EventPublish(). Every event
+ * stream listener writes the record as it is. JSON WebSocket clients write
+ * the JSON frame inside it (see clients.h), so no pose is encoded twice.
+ *
+ *     id: 1234
+ *     event: pose0
+ *     data: {"PosUpdate":{...},"RotUpdate":{...},...}
+ *
+ * The event type names the object, "pose0" to "pose7". The data is the JSON
+ * frame described in telemetry.h.
+ *
+ * The web server closes a connection once its GET handler returns, so the
+ * streams are served by a task of their own on EVENTS_PORT. GET /EVENTS on
+ * the web server redirects there. The stream is sent with a permissive CORS
+ * header, since the page, or an external dashboard, is on another origin.
+ * A listener that reconnects with Last-Event-ID, or ?lastEventId=N, resumes
+ * after that event while it is still in the history. An older id resumes at
+ * the oldest event kept. A new listener starts with the newest event.
+ *
+ * The history is written and streamed by the main task only, so neither
+ * needs locking. The listener task only hands new connections over.
+ */
+
+#ifndef EVENTS_PORT
+#define EVENTS_PORT (8081)            // The host build may move it, e.g. make EVENTS_PORT=18081
+#endif
+#define EVENT_HISTORY (64)            // Events kept for resuming, a power of two
+#define EVENT_RECORD_MAX (240)        // Longest record, with its id and event lines
+#define MAX_EVENT_CLIENTS (16)
+#define EVENT_RETRY_MS (1000)         // Reconnect delay suggested to browsers
+#define EVENT_KEEPALIVE_US (15000000) // Idle streams get a comment this often, so proxies keep them
+#define EVENT_STALL_US (30000000)     // A listener whose window stays closed this long is dropped
+
+struct EventClient
+{
+    int fd;               // -1 when the slot is free
+    uint32_t nextId;      // The next event to send
+    uint32_t lastSendUs;  // When anything was last written
+    uint32_t eventsSent;
+    uint32_t eventsSkipped; // Events that left the history before they could be sent
+};
+
+// Starts the task that accepts event stream listeners on port
+void InitEventStream(int port, int prio);
+
+// Adds a pose to the history and returns its event id
+uint32_t EventPublish(const FusedPose &pose);
+
+// The JSON frame of event id, or nullptr once it has left the history
+const char *EventJson(uint32_t id, int &len);
+
+// Adopts new listeners and sends them the events they have not seen. Call often from the main task.
+void ServiceEventClients();
+
+int EventClientCount();
+const EventClient *GetEventClient(int index);
+
+#endif /* _EVENTS_H_ */
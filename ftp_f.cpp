@@ -42,63 +42,164 @@
 #include <effs_fat/cfc_mcf.h>
 #endif
 
+#include "cardindex.h"
 #include "cardtype.h"
 #include "FileSystemUtils.h"
 #include "ftp_f.h"
+#include "mount.h"
+#include "pool.h"
+#include "stats.h"
+#include "timing.h"
+#include "trace.h"
 
 #define LOGME iprintf("We made it to line %d of file %s.\r\n", __LINE__, __FILE__);
 
-#define FTP_BUFFER_SIZE (32 * 1024)
-
 static int FileSysRetryLimit = 10;
 static int NetworkRetryLimit = 10;
 
-static char FTP_buffer[FTP_BUFFER_SIZE] __attribute__((aligned(16)));
 static const char mstr[12][4] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
 
+/*-----------------------------------------------------------------------------
+ * Metadata cache
+ *
+ * Sync clients probe with long bursts of CWD and SIZE, and every probe
+ * otherwise costs an f_chdir() walk from the root plus an f_open() or
+ * f_stat(). Each session keeps a small hash table of what it has learned,
+ * keyed by the full path, so repeated probes are answered from memory.
+ *
+ * Any FTP command that changes the card bumps MetaGeneration, which
+ * invalidates every session's entries at once. Entries also expire after
+ * FTP_META_TTL_TICKS so that files written outside FTP (the sensor
+ * recorder, for one) are never reported stale for long.
+ *---------------------------------------------------------------------------*/
+#define FTP_MAX_SESSIONS (4)
+#define FTP_META_SLOTS (32)                         // Per session, must be a power of two
+#define FTP_META_PATH_MAX (96)                      // Longer paths are not cached
+#define FTP_META_TTL_TICKS (2 * TICKS_PER_SECOND)
+
+enum MetaKind
+{
+    META_EMPTY,
+    META_MISSING,
+    META_FILE,
+    META_DIR
+};
+
+struct MetaEntry
+{
+    uint32_t generation;
+    uint32_t card;    // CardGeneration() when filled, so a swapped card never answers from cache
+    DWORD filledTick;
+    long size;        // -1 until a SIZE probe or listing has seen it
+    uint8_t kind;
+    char path[FTP_META_PATH_MAX];
+};
+
+struct FtpSessionState
+{
+    bool inUse;
+    MetaEntry meta[FTP_META_SLOTS];
+};
+
+static FtpSessionState Sessions[FTP_MAX_SESSIONS];
+static FtpSessionState NoCacheSession;   // Handed out when every slot is taken, never caches
+static volatile uint32_t MetaGeneration = 1;
+
+// FTPD_GetFileSize() is not given a session, so it uses the one seen last. All
+// callbacks run on the FTP task; a wrong guess only costs a miss, never a stale answer.
+static FtpSessionState *CurrentSession = &NoCacheSession;
+
+static FtpSessionState *UseSession(void *pSession)
+{
+    if (pSession != nullptr) { CurrentSession = (FtpSessionState *)pSession; }
+    return CurrentSession;
+}
+
+static void MetaInvalidate()
+{
+    MetaGeneration++;
+    CardIndexInvalidate();
+}
+
 /**
- * @brief Set the date.
+ * @brief Builds the key for a file in dir. Returns false if it does not fit.
  */
-static void settimedate(F_FIND *f)
+static bool MetaKey(char *key, const char *dir, const char *name)
 {
-    int nret = f_settimedate(f->filename, f_gettime(), f_getdate());
-    if (nret == F_NO_ERROR)
-    {
-        // iprintf( "Time stamping successful\r\n" );
-    }
-    else
+    int len = sniprintf(key, FTP_META_PATH_MAX, "%s/%s", dir, name);
+    return (len < FTP_META_PATH_MAX);
+}
+
+/**
+ * @brief Builds the key for directory name in parent, or for parent itself when
+ * name is nullptr. Directory keys end in '/' so they never collide with files.
+ */
+static bool MetaDirKey(char *key, const char *parent, const char *name)
+{
+    int len;
+    if (name == nullptr) { len = sniprintf(key, FTP_META_PATH_MAX, "%s/", parent); }
+    else if (*parent == 0) { len = sniprintf(key, FTP_META_PATH_MAX, "%s/", name); }
+    else { len = sniprintf(key, FTP_META_PATH_MAX, "%s/%s/", parent, name); }
+    return (len < FTP_META_PATH_MAX);
+}
+
+static MetaEntry &MetaSlot(FtpSessionState *session, const char *key)
+{
+    uint32_t h = 2166136261u;   // FNV-1a
+    for (const char *p = key; *p; p++) { h = (h ^ (uint8_t)*p) * 16777619u; }
+    return session->meta[h & (FTP_META_SLOTS - 1)];
+}
+
+/**
+ * @brief Returns the live entry for key, or nullptr. Counts the lookup as a hit or a miss.
+ */
+static MetaEntry *MetaFind(FtpSessionState *session, const char *key)
+{
+    if (session == &NoCacheSession) { return nullptr; }
+    MetaEntry &e = MetaSlot(session, key);
+    if ((e.kind != META_EMPTY) && (e.generation == MetaGeneration) && (e.card == CardGeneration()) &&
+        ((DWORD)(TimeTick - e.filledTick) < FTP_META_TTL_TICKS) &&
+        (strcmp(e.path, key) == 0))
     {
-        iprintf("Time stamping failed: %d\r\n", nret);
+        StatsAdd(STAT_TASK_FTP, STAT_CACHE_HITS);
+        return &e;
     }
+    StatsAdd(STAT_TASK_FTP, STAT_CACHE_MISSES);
+    return nullptr;
+}
+
+static void MetaStore(FtpSessionState *session, const char *key, MetaKind kind, long size)
+{
+    if (session == &NoCacheSession) { return; }
+    MetaEntry &e = MetaSlot(session, key);
+    e.generation = MetaGeneration;
+    e.card = CardGeneration();
+    e.filledTick = TimeTick;
+    e.kind = kind;
+    e.size = size;
+    strcpy(e.path, key);
 }
 
 /**
- * @brief This function displays information in MTTTY of subdirectories
- * and files in a current directory.  The information displayed is: the
- * filename, modified time stamp, modified date stamp, and file size.
+ * @brief Set the date.
  */
-static void gettimedate(F_FIND *f)
+static void settimedate(F_FIND *f)
 {
-    unsigned short t, d;
-
-    int nret = f_gettimedate(f->filename, &t, &d);
+    int nret = f_settimedate(f->filename, f_gettime(), f_getdate());
     if (nret == F_NO_ERROR)
     {
-        iprintf("%15s   |", f->filename);
-        iprintf("%2.2d:%2.2d:%2.2d   |", ((t & 0xF800) >> 11), ((t & 0x07E0) >> 5), 2 * (t & 0x001F));
-        iprintf("%2.2d/%2.2d/%4d   |", ((d & 0x01E0) >> 5), (d & 0x001F), (1980 + ((d & 0xFE00) >> 9)));
-        iprintf("%9ld Bytes\r\n", f->filesize);
+        // iprintf( "Time stamping successful\r\n" );
     }
     else
     {
-        iprintf("Time stamp retrieval failed: %d\r\n", nret);
+        iprintf("Time stamping failed: %d\r\n", nret);
     }
 }
 
 /**
- * @brief Generate date string.
+ * @brief Generate date string. thisYear is read once per listing, not per entry.
  */
-static void getdatestring(F_FIND *f, char *tmp)
+static void getdatestring(F_FIND *f, char *tmp, unsigned short thisYear)
 {
     // Converts file time and date stamp to a value that can be interpreted by the user.
     // unsigned short sec = 2 * ( ( f->ctime ) & 0x1F );
@@ -107,49 +208,89 @@ static void getdatestring(F_FIND *f, char *tmp)
     unsigned short day = (f->cdate) & 0x1F;
     unsigned short month = ((f->cdate) & 0x01E0) >> 5;
     unsigned short year = 1980 + (((f->cdate) & 0xFE00) >> 9);
+    if ((month < 1) || (month > 12)) { month = 1; }   // Unset stamps would index outside mstr
 
     // For FTP file properties: If the current year matches the year stamp of the
     // associated file, then the hour and minutes are displayed.  Otherwise, the
     // year is used in place of hour and minutes.
-    if ((1980 + (((f_getdate()) & 0xFE00) >> 9)) == year)
+    if (thisYear == year)
     {
-        siprintf(tmp, "%3s %2d %2.2d:%2.2d", mstr[month - 1], day, hour, minute);
+        siprintf(tmp, "%.3s %2d %2.2d:%2.2d", mstr[month - 1], day, hour, minute);
     }
     else
     {
-        siprintf(tmp, "%3s %2d  %4d", mstr[month - 1], day, year);
+        siprintf(tmp, "%.3s %2d  %4d", mstr[month - 1], day, year);
     }
 }
 
 /**
- * @brief Generate directory entry string.
+ * @brief Generate directory entry string from the F_FIND data alone.
  */
-static void getdirstring(F_FIND *f, char *dst)
+static void getdirstring(F_FIND *f, char *dst, int size, unsigned short thisYear)
 {
-    char tmp[256];
+    char date[16];
+    getdatestring(f, date, thisYear);
+
+    int len = sniprintf(dst, size, "%c-rw-rw-rw-   1 none %9ld %s %s", ((f->attr) & F_ATTR_DIR) ? 'd' : '-',
+                        f->filesize, date, f->filename);
+    if (len >= size) { StatsAdd(STAT_TASK_FTP, STAT_FTP_LIST_CUT); }
+}
 
-    if ((f->attr) & F_ATTR_DIR)
+/**
+ * @brief Reports every directory (dirs true) or file (dirs false) in current_directory.
+ *
+ * Each line is built from the F_FIND entry already in hand: there is no
+ * per-entry lookup by name and nothing is written to the console, so a
+ * listing costs one directory scan. Entry counts and truncated lines go to
+ * the statistics counters and the scan time to the trace ring.
+ *
+ * The entries seen also warm the metadata cache, since clients tend to
+ * follow a listing with a SIZE probe for each file in it.
+ */
+static int ListEntries(const char *current_directory, void *pSession, FTPDCallBackReportFunct *pFunc, int socket, bool dirs)
+{
+    F_FIND find;
+    FtpSessionState *session = UseSession(pSession);
+    char key[FTP_META_PATH_MAX];
+    PoolBlock line(POOL_PATH, TICKS_PER_SECOND);
+    char *s = line.Data();
+    if (s == nullptr) { return (FTPD_FAIL); }
+
+    f_chdir("/");
+
+    if (*current_directory)
     {
-        dst[0] = 'd';
+        if (f_chdir((char *)current_directory)) { return (FTPD_FAIL); }
     }
-    else
+
+    TRACE_SPAN(span, TRACE_FTP_LIST);
+    unsigned short thisYear = 1980 + ((f_getdate() & 0xFE00) >> 9);
+    uint32_t entries = 0;
+    if (f_findfirst("*.*", &find) == 0)
     {
-        dst[0] = '-';
+        do
+        {
+            if (((find.attr & F_ATTR_DIR) != 0) == dirs)
+            {
+                getdirstring(&find, s, POOL_PATH_SIZE, thisYear);
+                pFunc(socket, s);
+                entries++;
+                if (find.filename[0] == '.') { /* . and .. are not worth a slot */ }
+                else if (dirs)
+                {
+                    if (MetaDirKey(key, current_directory, find.filename)) { MetaStore(session, key, META_DIR, 0); }
+                }
+                else if (MetaKey(key, current_directory, find.filename))
+                {
+                    MetaStore(session, key, META_FILE, find.filesize);
+                }
+            }
+        } while (!f_findnext(&find));
     }
+    StatsAdd(STAT_TASK_FTP, STAT_FTP_LIST_ENTRIES, entries);
+    TRACE_SPAN_ARG(span, entries);
 
-    dst[1] = 0;
-    strcat(dst, "-rw-rw-rw-   1 none");
-    strcat(dst, " ");
-
-    sniprintf(tmp, 256, "%9ld", f->filesize);
-    strcat(dst, tmp);
-    strcat(dst, " ");
-
-    getdatestring(f, tmp);
-    strcat(dst, tmp);
-    strcat(dst, " ");
-
-    strcat(dst, f->filename);
+    return (FTPD_OK);
 }
 
 /**
@@ -159,6 +300,13 @@ void *FTPDSessionStart(const char *user, const char *passwd, const IPADDR4 hi_ip
 {
     iprintf(" Starting FTP session\r\n");
 
+    // Everything FTP serves lives on the flash card, so refuse the login until one is mounted
+    if (!CardMounted())
+    {
+        iprintf(" No flash card mounted, refusing FTP session\r\n");
+        return nullptr;
+    }
+
 #ifdef USE_MMC
     f_chdrive(MMC_DRV_NUM);
 #endif /* USE_MMC */
@@ -169,13 +317,28 @@ void *FTPDSessionStart(const char *user, const char *passwd, const IPADDR4 hi_ip
 
     f_chdir("\\");
 
-    return ((void *)1);
+    for (int i = 0; i < FTP_MAX_SESSIONS; i++)
+    {
+        if (!Sessions[i].inUse)
+        {
+            memset(&Sessions[i], 0, sizeof(Sessions[i]));
+            Sessions[i].inUse = true;
+            return &Sessions[i];
+        }
+    }
+    return &NoCacheSession;   // Still log in, just without a cache
 }
 
 /**
  * @brief Finish the FTP session.
  */
-void FTPDSessionEnd(void *pSession) {}
+void FTPDSessionEnd(void *pSession)
+{
+    FtpSessionState *session = (FtpSessionState *)pSession;
+    if (session == nullptr) { return; }
+    session->inUse = false;
+    if (CurrentSession == session) { CurrentSession = &NoCacheSession; }
+}
 
 /**
  * @brief Check for a directory.
@@ -184,14 +347,22 @@ int FTPD_DirectoryExists(const char *full_directory, void *pSession)
 {
     if (*full_directory == 0) { return (FTPD_OK); }
 
+    FtpSessionState *session = UseSession(pSession);
+    char key[FTP_META_PATH_MAX];
+    bool cacheable = MetaDirKey(key, full_directory, nullptr);
+    MetaEntry *e = cacheable ? MetaFind(session, key) : nullptr;
+    if (e != nullptr) { return (e->kind == META_DIR) ? FTPD_OK : FTPD_FAIL; }
+
     f_chdir("\\");
 
     if (f_chdir((char *)full_directory))
     {
+        if (cacheable) { MetaStore(session, key, META_MISSING, 0); }
         return (FTPD_FAIL);
     }
     else
     {
+        if (cacheable) { MetaStore(session, key, META_DIR, 0); }
         return (FTPD_OK);
     }
 
@@ -213,6 +384,7 @@ int FTPD_CreateSubDirectory(const char *current_directory, const char *new_dir,
     }
 
     rc = f_mkdir((char *)new_dir);
+    MetaInvalidate();
     if (rc == 0) { return (FTPD_OK); }
 
     return (FTPD_FAIL);
@@ -234,6 +406,7 @@ int FTPD_DeleteSubDirectory(const char *current_directory, const char *sub_dir,
     }
 
     rc = f_rmdir((char *)sub_dir);
+    MetaInvalidate();
 
     if (rc == 0) { return (FTPD_OK); }
 
@@ -245,31 +418,7 @@ int FTPD_DeleteSubDirectory(const char *current_directory, const char *sub_dir,
  */
 int FTPD_ListSubDirectories(const char *current_directory, void *pSession, FTPDCallBackReportFunct *pFunc, int socket)
 {
-    F_FIND find;
-    long rc;
-    char s[256];
-
-    f_chdir("/");
-
-    if (*current_directory)
-    {
-        if (f_chdir((char *)current_directory)) { return (FTPD_FAIL); }
-    }
-
-    rc = f_findfirst("*.*", &find);
-    if (!rc)
-    {
-        do
-        {
-            if (find.attr & F_ATTR_DIR)
-            {
-                getdirstring(&find, s);
-                pFunc(socket, s);
-            }
-        } while (!f_findnext(&find));
-    }
-
-    return (FTPD_OK);
+    return ListEntries(current_directory, pSession, pFunc, socket, true);
 }
 
 /**
@@ -308,6 +457,12 @@ int FTPD_FileExists(const char *full_directory, const char *file_name, void *pSe
         return (FTPD_OK);
     }
 
+    FtpSessionState *session = UseSession(pSession);
+    char key[FTP_META_PATH_MAX];
+    bool cacheable = MetaKey(key, full_directory, file_name);
+    MetaEntry *e = cacheable ? MetaFind(session, key) : nullptr;
+    if (e != nullptr) { return (e->kind == META_FILE) ? FTPD_OK : FTPD_FAIL; }
+
     f_chdir("/");
 
     if (*full_directory)
@@ -320,9 +475,11 @@ int FTPD_FileExists(const char *full_directory, const char *file_name, void *pSe
     if (t)
     {
         f_close(t);
+        if (cacheable) { MetaStore(session, key, META_FILE, -1); }
         return (FTPD_OK);
     }
 
+    if (cacheable) { MetaStore(session, key, META_MISSING, 0); }   // Directories land here too
     return (FTPD_FAIL);
 }
 
@@ -332,28 +489,31 @@ int FTPD_FileExists(const char *full_directory, const char *file_name, void *pSe
 int FTPD_GetFileSize(const char *full_directory, const char *file_name)
 {
     F_STAT stat;
-    f_chdir("/");
-
     uint32_t len = strlen(file_name);
-    if ((file_name[len - 1] != '/') && (FTPD_FileExists(full_directory, file_name, nullptr) == FTPD_FAIL))
-    {
-        return FTPD_FILE_SIZE_NOSUCH_FILE;
-    }
+    if ((len != 0) && (file_name[len - 1] == '/')) { return 0; }
+
+    FtpSessionState *session = UseSession(nullptr);
+    char key[FTP_META_PATH_MAX];
+    bool cacheable = MetaKey(key, full_directory, file_name);
+    MetaEntry *e = cacheable ? MetaFind(session, key) : nullptr;
+    if ((e != nullptr) && (e->kind != META_FILE)) { return FTPD_FILE_SIZE_NOSUCH_FILE; }
+    if ((e != nullptr) && (e->size >= 0)) { return e->size; }
+
+    f_chdir("/");
 
     if (*full_directory)
     {
         if (f_chdir((char *)full_directory)) { return FTPD_FILE_SIZE_NOSUCH_FILE; }
     }
 
-    if (file_name[len - 1] == '/')
-    {
-        stat.filesize = 0;
-    }
-    else if (f_stat(file_name, &stat))
+    // f_stat() alone answers both questions. Like FTPD_FileExists(), treat a directory as missing.
+    if (f_stat(file_name, &stat) || (stat.attr & F_ATTR_DIR))
     {
+        if (cacheable) { MetaStore(session, key, META_MISSING, 0); }
         return FTPD_FILE_SIZE_NOSUCH_FILE;
     }
 
+    if (cacheable) { MetaStore(session, key, META_FILE, stat.filesize); }
     return stat.filesize;
 }
 
@@ -366,6 +526,9 @@ int FTPD_SendFileToClient(const char *full_directory, const char *file_name, voi
 
     int TotalBytesWritten = 0, BytesWritten = 0, BytesRead = 0, RetryAttempts = 0, TransferError = 0;
 
+    UseSession(pSession);
+    if (file_name[0] == '_') { MetaInvalidate(); }   // Drive changes and formats below
+
 #ifdef USE_NOR
     if (strcmp(file_name, "_nor") == 0)
     {
@@ -440,7 +603,17 @@ int FTPD_SendFileToClient(const char *full_directory, const char *file_name, voi
     /* Return with error if not successful. */
     if (!rfile) { return (FTPD_FAIL); }
 
+    PoolBlock buffer(POOL_TRANSFER, TICKS_PER_SECOND);
+    if (buffer.Data() == nullptr)
+    {
+        f_close(rfile);
+        return (FTPD_FAIL);
+    }
+    char *FTP_buffer = buffer.Data();
+
     SetSocketTxBuffers(fd, 20);
+    uint32_t transferStart = TimingNowUs();
+    uint32_t transferBytes = 0;
 
     while (!f_eof(rfile))
     {
@@ -449,7 +622,11 @@ int FTPD_SendFileToClient(const char *full_directory, const char *file_name, voi
 
         while ((RetryAttempts < FileSysRetryLimit) && (BytesRead == 0))
         {
-            BytesRead = f_read(FTP_buffer, 1, FTP_BUFFER_SIZE, rfile);   // Read from file
+            uint32_t readStart = TimingNowUs();
+            BytesRead = f_read(FTP_buffer, 1, POOL_TRANSFER_SIZE, rfile);   // Read from file
+            uint32_t readEnd = TimingNowUs();
+            StatsRecordUs(STAT_TASK_FTP, STAT_HIST_SD_READ, readEnd - readStart);
+            TRACE_RECORD(TRACE_F_READ, readStart, readEnd - readStart, BytesRead);
 
             // retry if busy
             if ((BytesRead == 0) && (!f_eof(rfile)))
@@ -470,6 +647,7 @@ int FTPD_SendFileToClient(const char *full_directory, const char *file_name, voi
         BytesWritten = 0;
         TotalBytesWritten = 0;
         RetryAttempts = 0;
+        TRACE_NOW(writeStart);
 
         while ((RetryAttempts < NetworkRetryLimit) && (TotalBytesWritten != BytesRead))
         {
@@ -486,9 +664,15 @@ int FTPD_SendFileToClient(const char *full_directory, const char *file_name, voi
         }
 
         if (RetryAttempts >= NetworkRetryLimit) { TransferError = 2; }
+        TRACE_RECORD(TRACE_WRITEALL, writeStart, TimingNowUs() - writeStart, TotalBytesWritten);
+        StatsAdd(STAT_TASK_FTP, STAT_FTP_RETR_BYTES, TotalBytesWritten);
+        transferBytes += TotalBytesWritten;
     }
 
     f_close(rfile);   // Close the file
+    uint32_t transferUs = TimingNowUs() - transferStart;
+    StatsAdd(STAT_TASK_FTP, STAT_FTP_TRANSFER_MS, transferUs / 1000);
+    TRACE_RECORD(TRACE_FTP_RETR, transferStart, transferUs, transferBytes);
 
     if (TransferError)
     {
@@ -537,6 +721,7 @@ int FTPD_GetFileFromClient(const char *full_directory, const char *file_name, vo
     // if ( strlen( ( char * ) file_name ) > 12 ) return( FTPD_FAIL );
 
     wfile = f_open((char *)file_name, "w");   // Open it for write
+    MetaInvalidate();
 
     int rc = f_findfirst(file_name, &find);
     if (rc == 0)
@@ -551,7 +736,17 @@ int FTPD_GetFileFromClient(const char *full_directory, const char *file_name, vo
     /* Return error if not successful. */
     if (!wfile) { return (FTPD_FAIL); }
 
+    PoolBlock buffer(POOL_TRANSFER, TICKS_PER_SECOND);
+    if (buffer.Data() == nullptr)
+    {
+        f_close(wfile);
+        return (FTPD_FAIL);
+    }
+    char *FTP_buffer = buffer.Data();
+
     SetSocketRxBuffers(fd, 20);
+    uint32_t transferStart = TimingNowUs();
+    uint32_t transferBytes = 0;
 
     while (1)
     {
@@ -562,7 +757,9 @@ int FTPD_GetFileFromClient(const char *full_directory, const char *file_name, vo
 
         while ((BytesRead == 0) && (RetryAttempts < NetworkRetryLimit))
         {
-            BytesRead = ReadWithTimeout(fd, FTP_buffer, FTP_BUFFER_SIZE, TICKS_PER_SECOND);
+            TRACE_NOW(readStart);
+            BytesRead = ReadWithTimeout(fd, FTP_buffer, POOL_TRANSFER_SIZE, TICKS_PER_SECOND);
+            TRACE_RECORD(TRACE_NET_READ, readStart, TimingNowUs() - readStart, (BytesRead > 0) ? BytesRead : 0);
             RetryAttempts++;
         }
 
@@ -575,6 +772,7 @@ int FTPD_GetFileFromClient(const char *full_directory, const char *file_name, vo
         BytesWritten = 0;
         LastBytesWritten = 0;
         RetryAttempts = 0;
+        TRACE_NOW(writeStart);
 
         while ((RetryAttempts < FileSysRetryLimit) && (BytesWritten < BytesRead))
         {
@@ -591,11 +789,18 @@ int FTPD_GetFileFromClient(const char *full_directory, const char *file_name, vo
         }
 
         if (RetryAttempts >= FileSysRetryLimit) { TransferError = 1; }
+        TRACE_RECORD(TRACE_F_WRITE, writeStart, TimingNowUs() - writeStart, BytesWritten);
+        StatsAdd(STAT_TASK_FTP, STAT_FTP_STOR_BYTES, BytesWritten);
+        transferBytes += BytesWritten;
 
         if (BytesRead < 1) { break; }
     }
 
     f_close(wfile);
+    MetaInvalidate();   // The size seen while the transfer ran is out of date
+    uint32_t transferUs = TimingNowUs() - transferStart;
+    StatsAdd(STAT_TASK_FTP, STAT_FTP_TRANSFER_MS, transferUs / 1000);
+    TRACE_RECORD(TRACE_FTP_STOR, transferStart, transferUs, transferBytes);
 
     if (TransferError)
     {
@@ -628,6 +833,7 @@ int FTPD_DeleteFile(const char *current_directory, const char *file_name, void *
         if (f_chdir((char *)current_directory)) { return (FTPD_FAIL); }
     }
 
+    MetaInvalidate();
     if (f_delete((char *)file_name)) { return (FTPD_FAIL); }
 
     return (FTPD_OK);
@@ -638,40 +844,7 @@ int FTPD_DeleteFile(const char *current_directory, const char *file_name, void *
  */
 int FTPD_ListFile(const char *current_directory, void *pSession, FTPDCallBackReportFunct *pFunc, int socket)
 {
-    F_FIND find;
-    char s[256];
-    int rc;
-
-    f_chdir("/");
-
-    if (*current_directory)
-    {
-        if (f_chdir((char *)current_directory)) { return (FTPD_FAIL); }
-    }
-
-    rc = f_findfirst("*.*", &find);
-
-    if (rc == 0)
-    {
-        // iprintf("\r\nDisplaying time/date information\r\n");
-        do
-        {
-            if (!(find.attr & F_ATTR_DIR))
-            {
-                getdirstring(&find, s);
-                gettimedate(&find);
-                pFunc(socket, s);
-            }
-        } while (!f_findnext(&find));
-        // iprintf("\r\n");
-    }
-    // else
-    //{
-    //   sniprintf( s, 256, "Card error: %d", rc );
-    //   pFunc( socket, s );
-    //}
-
-    return (FTPD_OK);
+    return ListEntries(current_directory, pSession, pFunc, socket, false);
 }
 
 /**
@@ -686,6 +859,7 @@ int FTPD_Rename(const char *full_directory, const char *old_file_name, const cha
         if (f_chdir((char *)full_directory)) { return (FTPD_FAIL); }
     }
 
+    MetaInvalidate();
     if (f_rename(old_file_name, new_file_name)) { return FTPD_FAIL; }
 
     return FTPD_OK;
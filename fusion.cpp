@@ -0,0 +1,244 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+/**
+ * Mahony style complementary filter producing orientation quaternions.
+ */
+
+// NB Libs
+#include <math.h>
+#include <string.h>
+
+#include "fusion.h"
+#include "timing.h"
+
+// World frame reference directions: the accelerometer reads +Y (up) at rest, north is -Z
+static const float GravityRef[3] = {0.0f, 1.0f, 0.0f};
+
+/**
+ * @brief Normalizes a 3 vector in place. Returns false for a zero vector.
+ */
+static bool Normalize3(float v[3])
+{
+    float n = sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    if (n <= 0.0f) { return false; }
+    n = 1.0f / n;
+    v[0] *= n;
+    v[1] *= n;
+    v[2] *= n;
+    return true;
+}
+
+static void Cross3(const float a[3], const float b[3], float out[3])
+{
+    out[0] = a[1] * b[2] - a[2] * b[1];
+    out[1] = a[2] * b[0] - a[0] * b[2];
+    out[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+MahonyFilter::MahonyFilter()
+{
+    Reset();
+}
+
+/**
+ * @brief Forgets the current estimate. The next update starts from the accel/mag reference.
+ */
+void MahonyFilter::Reset()
+{
+    m_q = QuatIdentity();
+    memset(m_integral, 0, sizeof(m_integral));
+    m_initialized = false;
+}
+
+/**
+ * @brief Sets the orientation directly from the gravity and magnetic field vectors, so the
+ * filter does not have to slew from identity on the first samples.
+ */
+void MahonyFilter::InitFromReference(const float accel[3], const float mag[3])
+{
+    // Build the world axes as seen from the body: up from gravity, east and north from the field
+    float up[3] = {accel[0], accel[1], accel[2]};
+    float north[3] = {mag[0], mag[1], mag[2]};
+    float east[3];
+
+    if (!Normalize3(up)) { return; }
+    Cross3(north, up, east);
+    if (!Normalize3(east))
+    {
+        // No usable field, keep the heading at zero
+        m_q = QuatIdentity();
+        m_initialized = true;
+        return;
+    }
+    Cross3(up, east, north);
+
+    // Rows of the body to world matrix are the world axes (X east, Y up, Z south) in body coordinates
+    float m00 = east[0], m01 = east[1], m02 = east[2];
+    float m10 = up[0], m11 = up[1], m12 = up[2];
+    float m20 = -north[0], m21 = -north[1], m22 = -north[2];
+
+    float trace = m00 + m11 + m22;
+    if (trace > 0.0f)
+    {
+        float s = 0.5f / sqrtf(trace + 1.0f);
+        m_q.w = 0.25f / s;
+        m_q.x = (m21 - m12) * s;
+        m_q.y = (m02 - m20) * s;
+        m_q.z = (m10 - m01) * s;
+    }
+    else if ((m00 > m11) && (m00 > m22))
+    {
+        float s = 2.0f * sqrtf(1.0f + m00 - m11 - m22);
+        m_q.w = (m21 - m12) / s;
+        m_q.x = 0.25f * s;
+        m_q.y = (m01 + m10) / s;
+        m_q.z = (m02 + m20) / s;
+    }
+    else if (m11 > m22)
+    {
+        float s = 2.0f * sqrtf(1.0f + m11 - m00 - m22);
+        m_q.w = (m02 - m20) / s;
+        m_q.x = (m01 + m10) / s;
+        m_q.y = 0.25f * s;
+        m_q.z = (m12 + m21) / s;
+    }
+    else
+    {
+        float s = 2.0f * sqrtf(1.0f + m22 - m00 - m11);
+        m_q.w = (m10 - m01) / s;
+        m_q.x = (m02 + m20) / s;
+        m_q.y = (m12 + m21) / s;
+        m_q.z = 0.25f * s;
+    }
+    QuatNormalize(m_q);
+    m_initialized = true;
+}
+
+/**
+ * @brief Advances the estimate by dt seconds.
+ *
+ * gyro is in rad/s in the body frame. accel and mag only contribute their
+ * direction; either may be all zeros if the sensor is missing.
+ */
+void MahonyFilter::Update(const float gyro[3], const float accel[3], const float mag[3], float dt)
+{
+    if (!m_initialized)
+    {
+        InitFromReference(accel, mag);
+        if (!m_initialized) { return; }
+    }
+
+    float a[3] = {accel[0], accel[1], accel[2]};
+    float m[3] = {mag[0], mag[1], mag[2]};
+    float err[3] = {0.0f, 0.0f, 0.0f};
+
+    if (Normalize3(a))
+    {
+        // Gravity direction predicted by the current estimate, compared with the measured one
+        float v[3];
+        QuatRotateToBody(m_q, GravityRef, v);
+        float e[3];
+        Cross3(a, v, e);
+        err[0] += e[0];
+        err[1] += e[1];
+        err[2] += e[2];
+
+        if (Normalize3(m))
+        {
+            // Put the measured field into the world frame, flatten it onto north, and bring it back
+            float h[3];
+            QuatRotateToWorld(m_q, m, h);
+            float b[3] = {0.0f, h[1], -sqrtf(h[0] * h[0] + h[2] * h[2])};
+            float w[3];
+            QuatRotateToBody(m_q, b, w);
+            Cross3(m, w, e);
+            err[0] += e[0];
+            err[1] += e[1];
+            err[2] += e[2];
+        }
+    }
+
+    float g[3];
+    for (int i = 0; i < 3; i++)
+    {
+        m_integral[i] += FUSION_KI * err[i] * dt;
+        g[i] = gyro[i] + FUSION_KP * err[i] + m_integral[i];
+    }
+
+    // q' = q + 0.5 * q * (0, g) * dt
+    Quat omega = {0.0f, g[0] * 0.5f * dt, g[1] * 0.5f * dt, g[2] * 0.5f * dt};
+    Quat dq = QuatMul(m_q, omega);
+    m_q.w += dq.w;
+    m_q.x += dq.x;
+    m_q.y += dq.y;
+    m_q.z += dq.z;
+    QuatNormalize(m_q);
+}
+
+FusionStage::FusionStage()
+{
+    memset(m_lastUs, 0, sizeof(m_lastUs));
+}
+
+/**
+ * @brief Fuses one sample. The sample's acquisition time carries through to the output.
+ */
+bool FusionStage::Update(const SensorSample &sample, FusedPose &out)
+{
+    if (sample.object >= POSE_MAX_OBJECTS) { return false; }
+
+    out.seq = 0;
+    out.timeUs = sample.timeUs;
+    out.object = sample.object;
+    memcpy(out.pos, sample.pos, sizeof(out.pos));
+
+    if (sample.flags & SAMPLE_HAS_IMU)
+    {
+        MahonyFilter &filter = m_filters[sample.object];
+        float dt = TimingDiffUs(sample.timeUs, m_lastUs[sample.object]) / 1000000.0f;
+        m_lastUs[sample.object] = sample.timeUs;
+
+        if ((dt <= 0.0f) || (dt > FUSION_MAX_DT))
+        {
+            filter.Reset();
+            dt = 0.0f;
+        }
+        filter.Update(sample.gyro, sample.accel, sample.mag, dt);
+        if (!filter.Initialized()) { return false; }
+        out.q = filter.Orientation();
+        return true;
+    }
+
+    if (sample.flags & SAMPLE_HAS_POSE)
+    {
+        out.q = QuatFromEulerXYZ(sample.rot);
+        return true;
+    }
+
+    return false;
+}
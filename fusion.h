@@ -0,0 +1,99 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+#ifndef _FUSION_H_
+#define _FUSION_H_
+#pragma once
+
+#include <stdint.h>
+
+#include "pose.h"
+#include "quat.h"
+#include "sensor.h"
+
+/**
+ * Sensor fusion.
+ *
+ * A Mahony style complementary filter integrates the gyro and pulls the
+ * estimate towards the gravity direction measured by the accelerometer and
+ * the heading measured by the magnetometer. The result is a normalized
+ * quaternion, which unlike Euler angles has no gimbal lock and can be
+ * interpolated smoothly by the viewer.
+ *
+ * The filter should run on every sample; telemetry can be sent at a lower
+ * rate from the latest fused result.
+ */
+
+#define FUSION_KP (2.0f)     // Proportional gain, how hard to pull towards the accel/mag reference
+#define FUSION_KI (0.005f)   // Integral gain, corrects gyro bias
+#define FUSION_MAX_DT (0.5f) // Larger gaps restart the filter from the reference vectors
+
+struct FusedPose
+{
+    uint32_t seq;      // Telemetry frame counter, set when the pose is queued for sending
+    uint32_t timeUs;   // Acquisition time of the sample it was fused from
+    uint8_t object;
+    float pos[3];
+    Quat q;
+};
+
+class MahonyFilter
+{
+  public:
+    MahonyFilter();
+
+    void Reset();
+    void Update(const float gyro[3], const float accel[3], const float mag[3], float dt);
+    const Quat &Orientation() const { return m_q; }
+    bool Initialized() const { return m_initialized; }
+
+  private:
+    void InitFromReference(const float accel[3], const float mag[3]);
+
+    Quat m_q;
+    float m_integral[3];
+    bool m_initialized;
+};
+
+/**
+ * Keeps one filter per object and turns raw samples into fused poses.
+ * Samples that carry no IMU data but do carry a pose are converted directly.
+ */
+class FusionStage
+{
+  public:
+    FusionStage();
+
+    // Returns false if the sample could not produce an orientation
+    bool Update(const SensorSample &sample, FusedPose &out);
+
+  private:
+    MahonyFilter m_filters[POSE_MAX_OBJECTS];
+    uint32_t m_lastUs[POSE_MAX_OBJECTS];
+};
+
+#endif /* _FUSION_H_ */
@@ -0,0 +1,217 @@
+/******************************************************************************
+* Host build support for the WebGL example: embedded asset generator.
+*
+* Writes a C++ source file holding the given files as EmbeddedAssets (see
+* embedded.h), ready to be linked into the firmware:
+*
+*   - each body is gzip compressed, unless that saves less than an eighth,
+*     in which case it is stored as is
+*   - the 200 and 304 response headers are written out in full, with the
+*     MIME type, Content-Length and an ETag of the uncompressed content
+*   - the 200 header and the body are one array, so the server answers with
+*     a single write
+*
+*   assetembed -o assetdata.cpp -C ../SdCardFiles index.html js/three.min.js
+******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <zlib.h>
+
+#include <string>
+#include <vector>
+
+#include "../embedded.h"
+
+typedef std::vector<uint8_t> Bytes;
+
+static bool ReadFile(const std::string &path, Bytes &data)
+{
+    FILE *fp = fopen(path.c_str(), "rb");
+    if (fp == nullptr) { return false; }
+    uint8_t buf[65536];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) { data.insert(data.end(), buf, buf + n); }
+    fclose(fp);
+    return true;
+}
+
+static bool Gzip(const Bytes &in, Bytes &out)
+{
+    z_stream zs;
+    memset(&zs, 0, sizeof(zs));
+    // 15 + 16 selects the gzip wrapper rather than zlib's own
+    if (deflateInit2(&zs, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY) != Z_OK) { return false; }
+    out.resize(deflateBound(&zs, in.size()) + 32);
+    zs.next_in = (Bytef *)in.data();
+    zs.avail_in = in.size();
+    zs.next_out = out.data();
+    zs.avail_out = out.size();
+    int rv = deflate(&zs, Z_FINISH);
+    out.resize(zs.total_out);
+    deflateEnd(&zs);
+    return rv == Z_STREAM_END;
+}
+
+static const char *MimeFor(const std::string &path)
+{
+    static const char *types[][2] = {
+        {"html", "text/html"},          {"htm", "text/html"},      {"js", "application/javascript"},
+        {"css", "text/css"},            {"json", "application/json"}, {"png", "image/png"},
+        {"jpg", "image/jpeg"},          {"glb", "model/gltf-binary"}, {"gltf", "model/gltf+json"},
+    };
+    size_t dot = path.rfind('.');
+    if (dot != std::string::npos)
+    {
+        for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); i++)
+        {
+            if (strcasecmp(path.c_str() + dot + 1, types[i][0]) == 0) { return types[i][1]; }
+        }
+    }
+    return "application/octet-stream";
+}
+
+/**
+ * @brief Writes s as a C string literal, one header line per source line.
+ */
+static void WriteLiteral(FILE *out, const std::string &s)
+{
+    fputs("    \"", out);
+    for (size_t i = 0; i < s.size(); i++)
+    {
+        char c = s[i];
+        if (c == '\r') { fputs("\\r", out); }
+        else if (c == '\n') { fputs((i + 1 < s.size()) ? "\\n\"\n    \"" : "\\n", out); }
+        else if ((c == '"') || (c == '\\')) { fprintf(out, "\\%c", c); }
+        else { fputc(c, out); }
+    }
+    fputs("\"", out);
+}
+
+static void Usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s -o OUT.cpp [-C DIR] FILE...\n"
+            "  -o OUT.cpp   source file to write\n"
+            "  -C DIR       directory FILEs are relative to; FILE is also the URL path\n",
+            argv0);
+}
+
+int main(int argc, char **argv)
+{
+    std::string outName;
+    std::string root = ".";
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-o") == 0) && (i + 1 < argc)) { outName = argv[++i]; }
+        else if ((strcmp(argv[i], "-C") == 0) && (i + 1 < argc)) { root = argv[++i]; }
+        else if (argv[i][0] == '-')
+        {
+            Usage(argv[0]);
+            return 1;
+        }
+        else { files.push_back(argv[i]); }
+    }
+    if (outName.empty() || files.empty())
+    {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    // Written to a temporary name first, so a failed run never leaves a partial source behind
+    std::string tmpName = outName + ".tmp";
+    FILE *out = fopen(tmpName.c_str(), "w");
+    if (out == nullptr)
+    {
+        fprintf(stderr, "unable to create %s\n", tmpName.c_str());
+        return 1;
+    }
+
+    fprintf(out, "/* Generated by host/assetembed from %s. Do not edit. */\n\n", root.c_str());
+    fprintf(out, "#include \"embedded.h\"\n");
+
+    struct Entry
+    {
+        std::string path;
+        size_t rawLen;
+        size_t headerLen;
+        size_t bodyLen;
+        uint64_t hash;
+        bool gzip;
+    };
+    std::vector<Entry> entries;
+
+    size_t rawTotal = 0;
+    size_t bodyTotal = 0;
+    for (size_t n = 0; n < files.size(); n++)
+    {
+        const std::string &path = files[n];
+        Bytes raw;
+        if (!ReadFile(root + "/" + path, raw))
+        {
+            fprintf(stderr, "unable to read %s/%s\n", root.c_str(), path.c_str());
+            fclose(out);
+            remove(tmpName.c_str());
+            return 1;
+        }
+
+        Bytes gz;
+        bool gzip = Gzip(raw, gz) && (gz.size() < raw.size() - raw.size() / 8);
+        const Bytes &body = gzip ? gz : raw;
+        uint64_t hash = EmbeddedHash(EMBEDDED_HASH_INIT, raw.data(), raw.size());
+
+        char etag[24];
+        snprintf(etag, sizeof(etag), "\"%016llx\"", (unsigned long long)hash);
+
+        // no-cache lets browsers keep the asset but revalidate it, which costs one 304
+        std::string header = "HTTP/1.0 200 OK\r\n";
+        header += std::string("Content-Type: ") + MimeFor(path) + "\r\n";
+        header += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+        if (gzip) { header += "Content-Encoding: gzip\r\nVary: Accept-Encoding\r\n"; }
+        header += std::string("ETag: ") + etag + "\r\n";
+        header += "Cache-Control: no-cache\r\n\r\n";
+        std::string notModified = std::string("HTTP/1.0 304 Not Modified\r\nETag: ") + etag + "\r\n\r\n";
+
+        fprintf(out, "\n// %s: %zu bytes, %zu %s\n", path.c_str(), raw.size(), body.size(), gzip ? "gzipped" : "stored");
+        fprintf(out, "static const char NotModified%zu[] =\n", n);
+        WriteLiteral(out, notModified);
+        fprintf(out, ";\n\n// The 200 header, followed by the body\n/*\n%s*/\n", header.c_str());
+        fprintf(out, "static const uint8_t Response%zu[%zu] = {", n, header.size() + body.size());
+        for (size_t i = 0; i < header.size() + body.size(); i++)
+        {
+            if ((i % 24) == 0) { fputs("\n    ", out); }
+            fprintf(out, "%u,", (i < header.size()) ? (uint8_t)header[i] : body[i - header.size()]);
+        }
+        fputs("\n};\n", out);
+
+        entries.push_back({path, raw.size(), header.size(), body.size(), hash, gzip});
+        rawTotal += raw.size();
+        bodyTotal += body.size();
+        fprintf(stderr, "%-32s %8zu -> %8zu %s\n", path.c_str(), raw.size(), body.size(), gzip ? "gzip" : "stored");
+    }
+
+    fprintf(out, "\nconst EmbeddedAsset EmbeddedAssets[] = {\n");
+    for (size_t n = 0; n < entries.size(); n++)
+    {
+        const Entry &e = entries[n];
+        fprintf(out, "    {\"%s\", (const char *)Response%zu, %zu, NotModified%zu, sizeof(NotModified%zu) - 1,\n",
+                e.path.c_str(), n, e.headerLen, n, n);
+        fprintf(out, "     \"\\\"%016llx\\\"\", Response%zu + %zu, %zu, %zu, 0x%016llxull, %s},\n",
+                (unsigned long long)e.hash, n, e.headerLen, e.bodyLen, e.rawLen, (unsigned long long)e.hash,
+                e.gzip ? "true" : "false");
+    }
+    fprintf(out, "};\n\nconst int EmbeddedAssetCount = %zu;\n", files.size());
+    fclose(out);
+
+    fprintf(stderr, "%zu assets, %zu bytes -> %zu bytes\n", files.size(), rawTotal, bodyTotal);
+    if (rename(tmpName.c_str(), outName.c_str()) != 0)
+    {
+        fprintf(stderr, "unable to write %s\n", outName.c_str());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,1356 @@
+/******************************************************************************
+* Host build support for the WebGL example: glTF asset packer.
+*
+* Turns the viewer model (a .gltf document with external buffers and PNG
+* textures) into a single binary glTF file so the page loads it with one
+* request:
+*
+*   - every buffer and image is moved into the GLB binary chunk
+*   - PNG textures are box filtered down to --max-texture pixels, reduced to
+*     8 bits per channel and re-encoded (normal maps are renormalized)
+*   - vertex attributes are quantized per KHR_mesh_quantization: positions to
+*     int16 with the dequantization folded into the node transform, normals
+*     and tangents to normalized int8, texture coordinates to normalized
+*     uint16, and 32-bit indices to 16-bit where the vertex count allows
+*
+* Only the subset of glTF 2.0 used by exported models is handled: sparse
+* accessors, morph targets and skins are copied through unquantized.
+******************************************************************************/
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+typedef std::vector<uint8_t> Bytes;
+
+/*-----------------------------------------------------------------------------
+ * Minimal JSON document model. Numbers keep their source text so that values
+ * the packer does not touch are written back exactly as they were read.
+ *---------------------------------------------------------------------------*/
+struct Json
+{
+    enum Type { NUL, BOOL, NUM, STR, ARR, OBJ };
+
+    Type type = NUL;
+    bool b = false;
+    std::string text;   // Number text or string value
+    std::vector<Json> arr;
+    std::vector<std::pair<std::string, Json>> obj;
+
+    static Json Number(double v)
+    {
+        Json j;
+        j.type = NUM;
+        char buf[32];
+        if ((v == floor(v)) && (fabs(v) < 1e15)) { snprintf(buf, sizeof(buf), "%.0f", v); }
+        else { snprintf(buf, sizeof(buf), "%.9g", v); }
+        j.text = buf;
+        return j;
+    }
+
+    static Json String(const std::string &s)
+    {
+        Json j;
+        j.type = STR;
+        j.text = s;
+        return j;
+    }
+
+    static Json Bool(bool v)
+    {
+        Json j;
+        j.type = BOOL;
+        j.b = v;
+        return j;
+    }
+
+    static Json Array()
+    {
+        Json j;
+        j.type = ARR;
+        return j;
+    }
+
+    static Json Object()
+    {
+        Json j;
+        j.type = OBJ;
+        return j;
+    }
+
+    double Num(double def = 0.0) const { return (type == NUM) ? atof(text.c_str()) : def; }
+
+    const Json *Find(const char *key) const
+    {
+        for (size_t i = 0; i < obj.size(); i++)
+        {
+            if (obj[i].first == key) { return &obj[i].second; }
+        }
+        return nullptr;
+    }
+
+    Json *Find(const char *key)
+    {
+        for (size_t i = 0; i < obj.size(); i++)
+        {
+            if (obj[i].first == key) { return &obj[i].second; }
+        }
+        return nullptr;
+    }
+
+    double Get(const char *key, double def) const
+    {
+        const Json *j = Find(key);
+        return (j != nullptr) ? j->Num(def) : def;
+    }
+
+    Json &Set(const char *key, const Json &value)
+    {
+        Json *j = Find(key);
+        if (j != nullptr)
+        {
+            *j = value;
+            return *j;
+        }
+        obj.push_back(std::make_pair(std::string(key), value));
+        return obj.back().second;
+    }
+
+    void Remove(const char *key)
+    {
+        for (size_t i = 0; i < obj.size(); i++)
+        {
+            if (obj[i].first == key)
+            {
+                obj.erase(obj.begin() + i);
+                return;
+            }
+        }
+    }
+};
+
+struct JsonParser
+{
+    const char *p;
+    const char *end;
+    bool ok = true;
+
+    void SkipSpace()
+    {
+        while ((p < end) && ((*p == ' ') || (*p == '\t') || (*p == '\r') || (*p == '\n'))) { p++; }
+    }
+
+    bool Expect(char c)
+    {
+        SkipSpace();
+        if ((p < end) && (*p == c))
+        {
+            p++;
+            return true;
+        }
+        ok = false;
+        return false;
+    }
+
+    std::string ParseString()
+    {
+        std::string s;
+        if (!Expect('"')) { return s; }
+        while ((p < end) && (*p != '"'))
+        {
+            if ((*p == '\\') && (p + 1 < end))
+            {
+                p++;
+                switch (*p)
+                {
+                    case 'n': s += '\n'; break;
+                    case 't': s += '\t'; break;
+                    case 'r': s += '\r'; break;
+                    case 'b': s += '\b'; break;
+                    case 'f': s += '\f'; break;
+                    case 'u':
+                    {   // Names in exported models are ASCII, anything else becomes UTF-8
+                        unsigned cp = (p + 4 < end) ? (unsigned)strtoul(std::string(p + 1, 4).c_str(), nullptr, 16) : 0;
+                        p += 4;
+                        if (cp < 0x80) { s += (char)cp; }
+                        else if (cp < 0x800)
+                        {
+                            s += (char)(0xC0 | (cp >> 6));
+                            s += (char)(0x80 | (cp & 0x3F));
+                        }
+                        else
+                        {
+                            s += (char)(0xE0 | (cp >> 12));
+                            s += (char)(0x80 | ((cp >> 6) & 0x3F));
+                            s += (char)(0x80 | (cp & 0x3F));
+                        }
+                        break;
+                    }
+                    default: s += *p; break;
+                }
+            }
+            else
+            {
+                s += *p;
+            }
+            p++;
+        }
+        if (p >= end) { ok = false; }
+        else { p++; }
+        return s;
+    }
+
+    Json ParseValue()
+    {
+        Json j;
+        SkipSpace();
+        if (p >= end)
+        {
+            ok = false;
+            return j;
+        }
+        if (*p == '{')
+        {
+            p++;
+            j.type = Json::OBJ;
+            SkipSpace();
+            if ((p < end) && (*p == '}'))
+            {
+                p++;
+                return j;
+            }
+            while (ok)
+            {
+                SkipSpace();
+                std::string key = ParseString();
+                if (!Expect(':')) { break; }
+                Json v = ParseValue();
+                j.obj.push_back(std::make_pair(key, v));
+                SkipSpace();
+                if ((p < end) && (*p == ','))
+                {
+                    p++;
+                    continue;
+                }
+                Expect('}');
+                break;
+            }
+        }
+        else if (*p == '[')
+        {
+            p++;
+            j.type = Json::ARR;
+            SkipSpace();
+            if ((p < end) && (*p == ']'))
+            {
+                p++;
+                return j;
+            }
+            while (ok)
+            {
+                j.arr.push_back(ParseValue());
+                SkipSpace();
+                if ((p < end) && (*p == ','))
+                {
+                    p++;
+                    continue;
+                }
+                Expect(']');
+                break;
+            }
+        }
+        else if (*p == '"')
+        {
+            j.type = Json::STR;
+            j.text = ParseString();
+        }
+        else if ((end - p >= 4) && (strncmp(p, "true", 4) == 0))
+        {
+            j = Json::Bool(true);
+            p += 4;
+        }
+        else if ((end - p >= 5) && (strncmp(p, "false", 5) == 0))
+        {
+            j = Json::Bool(false);
+            p += 5;
+        }
+        else if ((end - p >= 4) && (strncmp(p, "null", 4) == 0))
+        {
+            p += 4;
+        }
+        else
+        {
+            const char *start = p;
+            while ((p < end) && (strchr("+-0123456789.eE", *p) != nullptr)) { p++; }
+            if (p == start) { ok = false; }
+            j.type = Json::NUM;
+            j.text.assign(start, p - start);
+        }
+        return j;
+    }
+};
+
+static void WriteJson(const Json &j, std::string &out)
+{
+    switch (j.type)
+    {
+        case Json::NUL: out += "null"; break;
+        case Json::BOOL: out += j.b ? "true" : "false"; break;
+        case Json::NUM: out += j.text; break;
+        case Json::STR:
+            out += '"';
+            for (size_t i = 0; i < j.text.size(); i++)
+            {
+                char c = j.text[i];
+                if ((c == '"') || (c == '\\'))
+                {
+                    out += '\\';
+                    out += c;
+                }
+                else if ((unsigned char)c < 0x20)
+                {
+                    char esc[8];
+                    snprintf(esc, sizeof(esc), "\\u%04x", c);
+                    out += esc;
+                }
+                else
+                {
+                    out += c;
+                }
+            }
+            out += '"';
+            break;
+        case Json::ARR:
+            out += '[';
+            for (size_t i = 0; i < j.arr.size(); i++)
+            {
+                if (i != 0) { out += ','; }
+                WriteJson(j.arr[i], out);
+            }
+            out += ']';
+            break;
+        case Json::OBJ:
+            out += '{';
+            for (size_t i = 0; i < j.obj.size(); i++)
+            {
+                if (i != 0) { out += ','; }
+                WriteJson(Json::String(j.obj[i].first), out);
+                out += ':';
+                WriteJson(j.obj[i].second, out);
+            }
+            out += '}';
+            break;
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ * File helpers
+ *---------------------------------------------------------------------------*/
+static bool ReadFile(const std::string &path, Bytes &data)
+{
+    FILE *f = fopen(path.c_str(), "rb");
+    if (f == nullptr)
+    {
+        fprintf(stderr, "assetpack: cannot open %s\n", path.c_str());
+        return false;
+    }
+    data.clear();
+    uint8_t chunk[16384];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) { data.insert(data.end(), chunk, chunk + n); }
+    fclose(f);
+    return true;
+}
+
+static std::string DirName(const std::string &path)
+{
+    size_t slash = path.find_last_of('/');
+    return (slash == std::string::npos) ? std::string() : path.substr(0, slash + 1);
+}
+
+static void PutU32(Bytes &out, uint32_t v)
+{
+    out.push_back(v & 0xFF);
+    out.push_back((v >> 8) & 0xFF);
+    out.push_back((v >> 16) & 0xFF);
+    out.push_back((v >> 24) & 0xFF);
+}
+
+static void PutU32BE(Bytes &out, uint32_t v)
+{
+    out.push_back((v >> 24) & 0xFF);
+    out.push_back((v >> 16) & 0xFF);
+    out.push_back((v >> 8) & 0xFF);
+    out.push_back(v & 0xFF);
+}
+
+static uint32_t GetU32BE(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+/*-----------------------------------------------------------------------------
+ * PNG textures
+ *---------------------------------------------------------------------------*/
+struct Image
+{
+    int width = 0;
+    int height = 0;
+    int channels = 0;              // 1 gray, 2 gray+alpha, 3 RGB, 4 RGBA
+    std::vector<uint16_t> pixels;  // 16-bit samples, row major
+};
+
+static int Paeth(int a, int b, int c)
+{
+    int p = a + b - c;
+    int pa = abs(p - a);
+    int pb = abs(p - b);
+    int pc = abs(p - c);
+    if ((pa <= pb) && (pa <= pc)) { return a; }
+    return (pb <= pc) ? b : c;
+}
+
+/**
+ * @brief Decodes a non-interlaced 8 or 16-bit gray, gray+alpha, RGB or RGBA PNG.
+ */
+static bool DecodePng(const Bytes &png, Image &img, std::string &why)
+{
+    static const uint8_t sig[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    if ((png.size() < 8) || (memcmp(png.data(), sig, 8) != 0))
+    {
+        why = "not a PNG";
+        return false;
+    }
+
+    int depth = 0;
+    int colorType = 0;
+    Bytes idat;
+    size_t pos = 8;
+    while (pos + 12 <= png.size())
+    {
+        uint32_t len = GetU32BE(&png[pos]);
+        const uint8_t *type = &png[pos + 4];
+        const uint8_t *data = &png[pos + 8];
+        if (pos + 12 + len > png.size()) { break; }
+        if (memcmp(type, "IHDR", 4) == 0)
+        {
+            img.width = GetU32BE(data);
+            img.height = GetU32BE(data + 4);
+            depth = data[8];
+            colorType = data[9];
+            if (data[12] != 0)
+            {
+                why = "interlaced";
+                return false;
+            }
+        }
+        else if (memcmp(type, "IDAT", 4) == 0)
+        {
+            idat.insert(idat.end(), data, data + len);
+        }
+        else if (memcmp(type, "IEND", 4) == 0)
+        {
+            break;
+        }
+        pos += 12 + len;
+    }
+
+    switch (colorType)
+    {
+        case 0: img.channels = 1; break;
+        case 2: img.channels = 3; break;
+        case 4: img.channels = 2; break;
+        case 6: img.channels = 4; break;
+        default:
+            why = "palette or unknown color type";
+            return false;
+    }
+    if ((depth != 8) && (depth != 16))
+    {
+        why = "unsupported bit depth";
+        return false;
+    }
+
+    int bpp = img.channels * depth / 8;
+    size_t stride = (size_t)img.width * bpp;
+    Bytes raw((stride + 1) * img.height);
+    uLongf rawLen = raw.size();
+    if ((uncompress(raw.data(), &rawLen, idat.data(), idat.size()) != Z_OK) || (rawLen != raw.size()))
+    {
+        why = "bad image data";
+        return false;
+    }
+
+    Bytes prev(stride, 0);
+    Bytes cur(stride);
+    img.pixels.resize((size_t)img.width * img.height * img.channels);
+    for (int y = 0; y < img.height; y++)
+    {
+        const uint8_t *line = &raw[y * (stride + 1)];
+        int filter = line[0];
+        line++;
+        for (size_t x = 0; x < stride; x++)
+        {
+            int a = (x >= (size_t)bpp) ? cur[x - bpp] : 0;
+            int b = prev[x];
+            int c = (x >= (size_t)bpp) ? prev[x - bpp] : 0;
+            int v = line[x];
+            switch (filter)
+            {
+                case 0: break;
+                case 1: v += a; break;
+                case 2: v += b; break;
+                case 3: v += (a + b) / 2; break;
+                case 4: v += Paeth(a, b, c); break;
+                default:
+                    why = "bad filter type";
+                    return false;
+            }
+            cur[x] = (uint8_t)v;
+        }
+        uint16_t *dst = &img.pixels[(size_t)y * img.width * img.channels];
+        size_t samples = (size_t)img.width * img.channels;
+        for (size_t s = 0; s < samples; s++)
+        {   // 8-bit samples are widened so both depths share one path
+            dst[s] = (depth == 16) ? (uint16_t)((cur[2 * s] << 8) | cur[2 * s + 1]) : (uint16_t)(cur[s] * 257);
+        }
+        prev.swap(cur);
+    }
+    return true;
+}
+
+/**
+ * @brief Halves the image with a 2x2 box filter until neither side exceeds maxSide.
+ */
+static void Downsize(Image &img, int maxSide)
+{
+    while (((img.width > maxSide) || (img.height > maxSide)) && (img.width > 1) && (img.height > 1))
+    {
+        int w = img.width / 2;
+        int h = img.height / 2;
+        int ch = img.channels;
+        std::vector<uint16_t> out((size_t)w * h * ch);
+        for (int y = 0; y < h; y++)
+        {
+            const uint16_t *r0 = &img.pixels[(size_t)(2 * y) * img.width * ch];
+            const uint16_t *r1 = r0 + (size_t)img.width * ch;
+            for (int x = 0; x < w; x++)
+            {
+                for (int c = 0; c < ch; c++)
+                {
+                    uint32_t sum = r0[2 * x * ch + c] + r0[(2 * x + 1) * ch + c] + r1[2 * x * ch + c] + r1[(2 * x + 1) * ch + c];
+                    out[((size_t)y * w + x) * ch + c] = (uint16_t)((sum + 2) / 4);
+                }
+            }
+        }
+        img.width = w;
+        img.height = h;
+        img.pixels.swap(out);
+    }
+}
+
+/**
+ * @brief Restores unit length to tangent space normals after filtering shortened them.
+ */
+static void RenormalizeNormals(Image &img)
+{
+    if (img.channels < 3) { return; }
+    size_t count = (size_t)img.width * img.height;
+    for (size_t i = 0; i < count; i++)
+    {
+        uint16_t *px = &img.pixels[i * img.channels];
+        double n[3];
+        double len = 0.0;
+        for (int c = 0; c < 3; c++)
+        {
+            n[c] = px[c] / 65535.0 * 2.0 - 1.0;
+            len += n[c] * n[c];
+        }
+        len = sqrt(len);
+        if (len < 1e-6) { continue; }
+        for (int c = 0; c < 3; c++)
+        {
+            double v = (n[c] / len + 1.0) * 0.5 * 65535.0 + 0.5;
+            px[c] = (uint16_t)((v < 0.0) ? 0.0 : ((v > 65535.0) ? 65535.0 : v));
+        }
+    }
+}
+
+static void PutPngChunk(Bytes &out, const char *type, const Bytes &data)
+{
+    PutU32BE(out, data.size());
+    size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    PutU32BE(out, crc32(0L, &out[start], out.size() - start));
+}
+
+/**
+ * @brief Encodes the image as an 8-bit PNG. Each row uses the filter with the
+ * smallest sum of absolute residuals, the usual heuristic for photographic data.
+ */
+static void EncodePng(const Image &img, Bytes &png)
+{
+    static const uint8_t sig[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    static const uint8_t colorTypes[5] = {0, 0, 4, 2, 6};
+
+    int bpp = img.channels;
+    size_t stride = (size_t)img.width * bpp;
+    Bytes raw;
+    raw.reserve((stride + 1) * img.height);
+    Bytes prev(stride, 0);
+    Bytes cur(stride);
+    Bytes trial[5];
+    for (int f = 0; f < 5; f++) { trial[f].resize(stride); }
+
+    for (int y = 0; y < img.height; y++)
+    {
+        const uint16_t *src = &img.pixels[(size_t)y * stride];
+        for (size_t x = 0; x < stride; x++) { cur[x] = (uint8_t)((src[x] + 128) / 257); }
+
+        int best = 0;
+        unsigned long bestCost = ~0UL;
+        for (int f = 0; f < 5; f++)
+        {
+            unsigned long cost = 0;
+            for (size_t x = 0; x < stride; x++)
+            {
+                int a = (x >= (size_t)bpp) ? cur[x - bpp] : 0;
+                int b = prev[x];
+                int c = (x >= (size_t)bpp) ? prev[x - bpp] : 0;
+                int pred = 0;
+                switch (f)
+                {
+                    case 1: pred = a; break;
+                    case 2: pred = b; break;
+                    case 3: pred = (a + b) / 2; break;
+                    case 4: pred = Paeth(a, b, c); break;
+                    default: break;
+                }
+                uint8_t v = (uint8_t)(cur[x] - pred);
+                trial[f][x] = v;
+                cost += (v < 128) ? v : 256 - v;
+            }
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                best = f;
+            }
+        }
+        raw.push_back((uint8_t)best);
+        raw.insert(raw.end(), trial[best].begin(), trial[best].end());
+        prev.swap(cur);
+    }
+
+    Bytes ihdr;
+    PutU32BE(ihdr, img.width);
+    PutU32BE(ihdr, img.height);
+    ihdr.push_back(8);
+    ihdr.push_back(colorTypes[img.channels]);
+    ihdr.push_back(0);
+    ihdr.push_back(0);
+    ihdr.push_back(0);
+
+    uLongf zlen = compressBound(raw.size());
+    Bytes idat(zlen);
+    compress2(idat.data(), &zlen, raw.data(), raw.size(), Z_BEST_COMPRESSION);
+    idat.resize(zlen);
+
+    png.assign(sig, sig + 8);
+    PutPngChunk(png, "IHDR", ihdr);
+    PutPngChunk(png, "IDAT", idat);
+    PutPngChunk(png, "IEND", Bytes());
+}
+
+/*-----------------------------------------------------------------------------
+ * Accessors
+ *---------------------------------------------------------------------------*/
+enum
+{
+    GL_BYTE = 5120,
+    GL_UNSIGNED_BYTE = 5121,
+    GL_SHORT = 5122,
+    GL_UNSIGNED_SHORT = 5123,
+    GL_UNSIGNED_INT = 5125,
+    GL_FLOAT = 5126,
+    GL_ARRAY_BUFFER = 34962,
+    GL_ELEMENT_ARRAY_BUFFER = 34963,
+};
+
+static int ComponentSize(int componentType)
+{
+    switch (componentType)
+    {
+        case GL_BYTE:
+        case GL_UNSIGNED_BYTE: return 1;
+        case GL_SHORT:
+        case GL_UNSIGNED_SHORT: return 2;
+        default: return 4;
+    }
+}
+
+static int ComponentCount(const std::string &type)
+{
+    if (type == "SCALAR") { return 1; }
+    if (type == "VEC2") { return 2; }
+    if (type == "VEC3") { return 3; }
+    if (type == "VEC4") { return 4; }
+    if (type == "MAT2") { return 4; }
+    if (type == "MAT3") { return 9; }
+    if (type == "MAT4") { return 16; }
+    return 0;
+}
+
+struct Packer
+{
+    Json doc;
+    std::vector<Bytes> buffers;
+    Bytes bin;                   // Output binary chunk
+    Json views = Json::Array();  // Output bufferViews
+    int maxTexture = 1024;
+    bool quantize = true;
+
+    /**
+     * @brief Appends data to the binary chunk as a new bufferView, 4-byte aligned.
+     */
+    int AddView(const Bytes &data, int target, int byteStride)
+    {
+        while (bin.size() % 4 != 0) { bin.push_back(0); }
+        Json view = Json::Object();
+        view.Set("buffer", Json::Number(0));
+        view.Set("byteOffset", Json::Number(bin.size()));
+        view.Set("byteLength", Json::Number(data.size()));
+        if (byteStride != 0) { view.Set("byteStride", Json::Number(byteStride)); }
+        if (target != 0) { view.Set("target", Json::Number(target)); }
+        bin.insert(bin.end(), data.begin(), data.end());
+        views.arr.push_back(view);
+        return views.arr.size() - 1;
+    }
+
+    /**
+     * @brief Returns the raw bytes of one element of an accessor, or nullptr if they fall outside the buffer.
+     */
+    const uint8_t *Element(const Json &acc, size_t index, int elemSize) const
+    {
+        const Json *views = doc.Find("bufferViews");
+        int viewIndex = (int)acc.Get("bufferView", -1);
+        if ((views == nullptr) || (viewIndex < 0) || (viewIndex >= (int)views->arr.size())) { return nullptr; }
+        const Json &view = views->arr[viewIndex];
+        int buffer = (int)view.Get("buffer", 0);
+        if ((buffer < 0) || (buffer >= (int)buffers.size())) { return nullptr; }
+        size_t stride = (size_t)view.Get("byteStride", elemSize);
+        size_t offset = (size_t)view.Get("byteOffset", 0) + (size_t)acc.Get("byteOffset", 0) + index * stride;
+        if (offset + elemSize > buffers[buffer].size()) { return nullptr; }
+        return &buffers[buffer][offset];
+    }
+
+    /**
+     * @brief Reads an accessor as floats, applying the normalization rules of the glTF spec.
+     */
+    bool ReadFloats(const Json &acc, std::vector<float> &out) const
+    {
+        int ct = (int)acc.Get("componentType", 0);
+        const Json *typeJson = acc.Find("type");
+        int n = ComponentCount(typeJson ? typeJson->text : std::string());
+        const Json *norm = acc.Find("normalized");
+        bool normalized = (norm != nullptr) && norm->b;
+        size_t count = (size_t)acc.Get("count", 0);
+        int cs = ComponentSize(ct);
+        out.resize(count * n);
+        for (size_t i = 0; i < count; i++)
+        {
+            const uint8_t *p = Element(acc, i, n * cs);
+            if (p == nullptr) { return false; }
+            for (int c = 0; c < n; c++, p += cs)
+            {
+                float v;
+                switch (ct)
+                {
+                    case GL_BYTE: v = normalized ? fmaxf(*(const int8_t *)p / 127.0f, -1.0f) : *(const int8_t *)p; break;
+                    case GL_UNSIGNED_BYTE: v = normalized ? *p / 255.0f : *p; break;
+                    case GL_SHORT:
+                    {
+                        int16_t s;
+                        memcpy(&s, p, 2);
+                        v = normalized ? fmaxf(s / 32767.0f, -1.0f) : s;
+                        break;
+                    }
+                    case GL_UNSIGNED_SHORT:
+                    {
+                        uint16_t s;
+                        memcpy(&s, p, 2);
+                        v = normalized ? s / 65535.0f : s;
+                        break;
+                    }
+                    case GL_UNSIGNED_INT:
+                    {
+                        uint32_t u;
+                        memcpy(&u, p, 4);
+                        v = (float)u;
+                        break;
+                    }
+                    default: memcpy(&v, p, 4); break;
+                }
+                out[i * n + c] = v;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Copies an accessor unchanged into its own tightly packed bufferView.
+     */
+    bool CopyAccessor(Json &acc, int target)
+    {
+        if (acc.Find("bufferView") == nullptr) { return true; }   // All zeros or sparse only
+        const Json *typeJson = acc.Find("type");
+        int n = ComponentCount(typeJson ? typeJson->text : std::string());
+        int cs = ComponentSize((int)acc.Get("componentType", 0));
+        size_t count = (size_t)acc.Get("count", 0);
+        int elem = n * cs;
+        int stride = (target == GL_ARRAY_BUFFER) ? (elem + 3) & ~3 : elem;   // Vertex attributes keep 4-byte alignment
+        Bytes data(count * stride, 0);
+        for (size_t i = 0; i < count; i++)
+        {
+            const uint8_t *p = Element(acc, i, elem);
+            if (p == nullptr) { return false; }
+            memcpy(&data[i * stride], p, elem);
+        }
+        acc.Set("bufferView", Json::Number(AddView(data, target, (stride != elem) ? stride : 0)));
+        acc.Remove("byteOffset");
+        return true;
+    }
+
+    /**
+     * @brief Stores an accessor as 16-bit indices when every index fits.
+     */
+    bool PackIndices(Json &acc)
+    {
+        std::vector<float> v;
+        if (!ReadFloats(acc, v)) { return false; }
+        bool narrow = (int)acc.Get("componentType", 0) != GL_UNSIGNED_INT;
+        for (size_t i = 0; !narrow && (i < v.size()); i++)
+        {
+            if (v[i] >= 65535.0f) { return CopyAccessor(acc, GL_ELEMENT_ARRAY_BUFFER); }
+        }
+        if (narrow) { return CopyAccessor(acc, GL_ELEMENT_ARRAY_BUFFER); }
+
+        // Indices above 2^24 cannot come through a float unchanged, but those were rejected above
+        Bytes data(v.size() * 2);
+        for (size_t i = 0; i < v.size(); i++)
+        {
+            uint16_t s = (uint16_t)v[i];
+            memcpy(&data[i * 2], &s, 2);
+        }
+        acc.Set("componentType", Json::Number(GL_UNSIGNED_SHORT));
+        acc.Set("bufferView", Json::Number(AddView(data, GL_ELEMENT_ARRAY_BUFFER, 0)));
+        acc.Remove("byteOffset");
+        return true;
+    }
+
+    /**
+     * @brief Writes floats as signed or unsigned normalized integers, padding each element to 4 bytes.
+     */
+    void PackNormalized(Json &acc, const std::vector<float> &v, int n, int componentType)
+    {
+        int cs = ComponentSize(componentType);
+        int stride = (n * cs + 3) & ~3;
+        size_t count = v.size() / n;
+        Bytes data(count * stride, 0);
+        for (size_t i = 0; i < count; i++)
+        {
+            for (int c = 0; c < n; c++)
+            {
+                float f = v[i * n + c];
+                uint8_t *dst = &data[i * stride + c * cs];
+                switch (componentType)
+                {
+                    case GL_BYTE:
+                    {
+                        int8_t q = (int8_t)lrintf(fmaxf(-1.0f, fminf(1.0f, f)) * 127.0f);
+                        memcpy(dst, &q, 1);
+                        break;
+                    }
+                    case GL_SHORT:
+                    {
+                        int16_t q = (int16_t)lrintf(fmaxf(-1.0f, fminf(1.0f, f)) * 32767.0f);
+                        memcpy(dst, &q, 2);
+                        break;
+                    }
+                    default:
+                    {
+                        uint16_t q = (uint16_t)lrintf(fmaxf(0.0f, fminf(1.0f, f)) * 65535.0f);
+                        memcpy(dst, &q, 2);
+                        break;
+                    }
+                }
+            }
+        }
+        acc.Set("componentType", Json::Number(componentType));
+        acc.Set("normalized", Json::Bool(true));
+        acc.Set("bufferView", Json::Number(AddView(data, GL_ARRAY_BUFFER, (stride != n * cs) ? stride : 0)));
+        acc.Remove("byteOffset");
+        acc.Remove("min");
+        acc.Remove("max");
+    }
+
+    /**
+     * @brief Stores positions as int16 relative to offset in units of scale,
+     * and rewrites min and max in the quantized space as the spec requires.
+     */
+    bool PackPositions(Json &acc, const float offset[3], float scale)
+    {
+        std::vector<float> v;
+        if (!ReadFloats(acc, v)) { return false; }
+        size_t count = v.size() / 3;
+        Bytes data(count * 8, 0);
+        int lo[3] = {32767, 32767, 32767};
+        int hi[3] = {-32768, -32768, -32768};
+        for (size_t i = 0; i < count; i++)
+        {
+            for (int c = 0; c < 3; c++)
+            {
+                long q = lrintf((v[i * 3 + c] - offset[c]) / scale);
+                q = (q < -32767) ? -32767 : ((q > 32767) ? 32767 : q);
+                int16_t s = (int16_t)q;
+                memcpy(&data[i * 8 + c * 2], &s, 2);
+                lo[c] = (q < lo[c]) ? q : lo[c];
+                hi[c] = (q > hi[c]) ? q : hi[c];
+            }
+        }
+        Json min = Json::Array();
+        Json max = Json::Array();
+        for (int c = 0; c < 3; c++)
+        {
+            min.arr.push_back(Json::Number(lo[c]));
+            max.arr.push_back(Json::Number(hi[c]));
+        }
+        acc.Set("componentType", Json::Number(GL_SHORT));
+        acc.Remove("normalized");
+        acc.Set("min", min);
+        acc.Set("max", max);
+        acc.Set("bufferView", Json::Number(AddView(data, GL_ARRAY_BUFFER, 8)));
+        acc.Remove("byteOffset");
+        return true;
+    }
+
+    bool LoadBuffers(const std::string &baseDir);
+    bool PackAccessors();
+    void AttachDequantization(int mesh, const float offset[3], float scale);
+    bool PackImages(const std::string &baseDir);
+    bool WriteGlb(const char *path);
+};
+
+bool Packer::LoadBuffers(const std::string &baseDir)
+{
+    Json *list = doc.Find("buffers");
+    if (list == nullptr) { return true; }
+    for (size_t i = 0; i < list->arr.size(); i++)
+    {
+        Bytes data;
+        const Json *uri = list->arr[i].Find("uri");
+        if (uri == nullptr)
+        {
+            fprintf(stderr, "assetpack: buffer %zu has no uri (input is already a GLB?)\n", i);
+            return false;
+        }
+        if (uri->text.compare(0, 5, "data:") == 0)
+        {
+            fprintf(stderr, "assetpack: data URIs are not supported\n");
+            return false;
+        }
+        if (!ReadFile(baseDir + uri->text, data)) { return false; }
+        buffers.push_back(data);
+    }
+    return true;
+}
+
+/**
+ * @brief Moves the mesh under a node that carries its dequantization transform.
+ * A node with no transform or children of its own takes the transform directly.
+ */
+void Packer::AttachDequantization(int mesh, const float offset[3], float scale)
+{
+    Json *nodes = doc.Find("nodes");
+    if (nodes == nullptr) { return; }
+    size_t original = nodes->arr.size();
+    for (size_t i = 0; i < original; i++)
+    {
+        Json &node = nodes->arr[i];
+        if ((int)node.Get("mesh", -1) != mesh) { continue; }
+
+        Json translation = Json::Array();
+        Json scaling = Json::Array();
+        for (int c = 0; c < 3; c++)
+        {
+            translation.arr.push_back(Json::Number(offset[c]));
+            scaling.arr.push_back(Json::Number(scale));
+        }
+
+        bool bare = (node.Find("translation") == nullptr) && (node.Find("rotation") == nullptr) &&
+                    (node.Find("scale") == nullptr) && (node.Find("matrix") == nullptr) &&
+                    (node.Find("children") == nullptr);
+        if (bare)
+        {
+            node.Set("translation", translation);
+            node.Set("scale", scaling);
+            continue;
+        }
+
+        Json child = Json::Object();
+        const Json *name = node.Find("name");
+        if (name != nullptr) { child.Set("name", Json::String(name->text + "_mesh")); }
+        child.Set("mesh", Json::Number(mesh));
+        child.Set("translation", translation);
+        child.Set("scale", scaling);
+        node.Remove("mesh");
+        Json *children = node.Find("children");
+        if (children == nullptr) { children = &node.Set("children", Json::Array()); }
+        children->arr.push_back(Json::Number(nodes->arr.size()));
+        nodes->arr.push_back(child);   // May reallocate, node is not used after this
+    }
+}
+
+bool Packer::PackAccessors()
+{
+    Json *accessors = doc.Find("accessors");
+    if (accessors == nullptr) { return true; }
+    std::vector<bool> done(accessors->arr.size(), false);
+    bool used = false;
+
+    // Meshes that are skinned or morphed keep float positions
+    std::vector<bool> plain;
+    Json *meshes = doc.Find("meshes");
+    if (meshes != nullptr)
+    {
+        plain.assign(meshes->arr.size(), true);
+        const Json *nodes = doc.Find("nodes");
+        for (size_t i = 0; (nodes != nullptr) && (i < nodes->arr.size()); i++)
+        {
+            int mesh = (int)nodes->arr[i].Get("mesh", -1);
+            if ((mesh >= 0) && (mesh < (int)plain.size()) && (nodes->arr[i].Find("skin") != nullptr)) { plain[mesh] = false; }
+        }
+    }
+
+    for (size_t m = 0; quantize && (meshes != nullptr) && (m < meshes->arr.size()); m++)
+    {
+        Json *prims = meshes->arr[m].Find("primitives");
+        if (prims == nullptr) { continue; }
+
+        // One dequantization transform per mesh, so it has to cover every primitive
+        float lo[3] = {INFINITY, INFINITY, INFINITY};
+        float hi[3] = {-INFINITY, -INFINITY, -INFINITY};
+        std::vector<int> positions;
+        for (size_t p = 0; p < prims->arr.size(); p++)
+        {
+            const Json &prim = prims->arr[p];
+            if (prim.Find("targets") != nullptr) { plain[m] = false; }
+            const Json *attrs = prim.Find("attributes");
+            int pos = attrs ? (int)attrs->Get("POSITION", -1) : -1;
+            if ((pos < 0) || (pos >= (int)accessors->arr.size())) { continue; }
+            std::vector<float> v;
+            if (!ReadFloats(accessors->arr[pos], v)) { return false; }
+            for (size_t i = 0; i < v.size(); i++)
+            {
+                lo[i % 3] = fminf(lo[i % 3], v[i]);
+                hi[i % 3] = fmaxf(hi[i % 3], v[i]);
+            }
+            positions.push_back(pos);
+        }
+        if (plain[m] && !positions.empty())
+        {
+            float offset[3];
+            float extent = 0.0f;
+            for (int c = 0; c < 3; c++)
+            {
+                offset[c] = (lo[c] + hi[c]) * 0.5f;
+                extent = fmaxf(extent, (hi[c] - lo[c]) * 0.5f);
+            }
+            float scale = (extent > 0.0f) ? extent / 32767.0f : 1.0f;
+            for (size_t i = 0; i < positions.size(); i++)
+            {
+                if (done[positions[i]]) { continue; }
+                if (!PackPositions(accessors->arr[positions[i]], offset, scale)) { return false; }
+                done[positions[i]] = true;
+            }
+            AttachDequantization(m, offset, scale);
+            used = true;
+        }
+
+        for (size_t p = 0; p < prims->arr.size(); p++)
+        {
+            Json &prim = prims->arr[p];
+            int indices = (int)prim.Get("indices", -1);
+            if ((indices >= 0) && (indices < (int)accessors->arr.size()) && !done[indices])
+            {
+                if (!PackIndices(accessors->arr[indices])) { return false; }
+                done[indices] = true;
+            }
+
+            Json *attrs = prim.Find("attributes");
+            for (size_t a = 0; (attrs != nullptr) && (a < attrs->obj.size()); a++)
+            {
+                const std::string &name = attrs->obj[a].first;
+                int index = (int)attrs->obj[a].second.Num(-1);
+                if ((index < 0) || (index >= (int)accessors->arr.size()) || done[index]) { continue; }
+                Json &acc = accessors->arr[index];
+                if ((int)acc.Get("componentType", 0) != GL_FLOAT) { continue; }   // Already compact
+                const Json *typeJson = acc.Find("type");
+                int n = ComponentCount(typeJson ? typeJson->text : std::string());
+
+                std::vector<float> v;
+                if (!ReadFloats(acc, v)) { return false; }
+                if ((name == "NORMAL") || (name == "TANGENT"))
+                {
+                    PackNormalized(acc, v, n, GL_BYTE);
+                    done[index] = used = true;
+                }
+                else if (name.compare(0, 9, "TEXCOORD_") == 0)
+                {
+                    bool unit = true;
+                    for (size_t i = 0; unit && (i < v.size()); i++) { unit = (v[i] >= 0.0f) && (v[i] <= 1.0f); }
+                    if (unit)
+                    {   // Wrapped coordinates outside 0..1 would need a texture transform, so they stay float
+                        PackNormalized(acc, v, n, GL_UNSIGNED_SHORT);
+                        done[index] = used = true;
+                    }
+                }
+            }
+        }
+    }
+
+    // Everything else, including animation data, is copied as it was
+    for (size_t i = 0; i < accessors->arr.size(); i++)
+    {
+        if (done[i]) { continue; }
+        if (accessors->arr[i].Find("sparse") != nullptr)
+        {
+            fprintf(stderr, "assetpack: sparse accessors are not supported\n");
+            return false;
+        }
+        bool isIndex = false;
+        for (size_t m = 0; (meshes != nullptr) && (m < meshes->arr.size()); m++)
+        {
+            const Json *prims = meshes->arr[m].Find("primitives");
+            for (size_t p = 0; (prims != nullptr) && (p < prims->arr.size()); p++)
+            {
+                isIndex = isIndex || ((int)prims->arr[p].Get("indices", -1) == (int)i);
+            }
+        }
+        bool isVertex = false;
+        for (size_t m = 0; (meshes != nullptr) && (m < meshes->arr.size()); m++)
+        {
+            const Json *prims = meshes->arr[m].Find("primitives");
+            for (size_t p = 0; (prims != nullptr) && (p < prims->arr.size()); p++)
+            {
+                const Json *attrs = prims->arr[p].Find("attributes");
+                for (size_t a = 0; (attrs != nullptr) && (a < attrs->obj.size()); a++)
+                {
+                    isVertex = isVertex || ((int)attrs->obj[a].second.Num(-1) == (int)i);
+                }
+            }
+        }
+        if (isIndex)
+        {
+            if (!PackIndices(accessors->arr[i])) { return false; }
+        }
+        else if (!CopyAccessor(accessors->arr[i], isVertex ? GL_ARRAY_BUFFER : 0))
+        {
+            return false;
+        }
+    }
+
+    if (used)
+    {
+        const char *ext = "KHR_mesh_quantization";
+        const char *lists[2] = {"extensionsUsed", "extensionsRequired"};
+        for (int l = 0; l < 2; l++)
+        {
+            Json *list = doc.Find(lists[l]);
+            if (list == nullptr) { list = &doc.Set(lists[l], Json::Array()); }
+            bool present = false;
+            for (size_t i = 0; i < list->arr.size(); i++) { present = present || (list->arr[i].text == ext); }
+            if (!present) { list->arr.push_back(Json::String(ext)); }
+        }
+    }
+    return true;
+}
+
+bool Packer::PackImages(const std::string &baseDir)
+{
+    Json *images = doc.Find("images");
+    if (images == nullptr) { return true; }
+
+    // Normal maps are renormalized after filtering
+    std::vector<bool> isNormal(images->arr.size(), false);
+    const Json *textures = doc.Find("textures");
+    const Json *materials = doc.Find("materials");
+    for (size_t m = 0; (materials != nullptr) && (textures != nullptr) && (m < materials->arr.size()); m++)
+    {
+        const Json *normal = materials->arr[m].Find("normalTexture");
+        int tex = normal ? (int)normal->Get("index", -1) : -1;
+        if ((tex < 0) || (tex >= (int)textures->arr.size())) { continue; }
+        int source = (int)textures->arr[tex].Get("source", -1);
+        if ((source >= 0) && (source < (int)isNormal.size())) { isNormal[source] = true; }
+    }
+
+    std::map<Bytes, int> seen;   // Identical outputs share one bufferView
+    for (size_t i = 0; i < images->arr.size(); i++)
+    {
+        Json &image = images->arr[i];
+        Bytes data;
+        std::string mime;
+        const Json *uri = image.Find("uri");
+        if (uri != nullptr)
+        {
+            if (!ReadFile(baseDir + uri->text, data)) { return false; }
+            size_t dot = uri->text.find_last_of('.');
+            std::string ext = (dot == std::string::npos) ? std::string() : uri->text.substr(dot + 1);
+            mime = ((ext == "jpg") || (ext == "jpeg")) ? "image/jpeg" : "image/png";
+        }
+        else
+        {   // Already in a buffer, copy it across
+            const Json *views = doc.Find("bufferViews");
+            int v = (int)image.Get("bufferView", -1);
+            if ((views == nullptr) || (v < 0) || (v >= (int)views->arr.size())) { return false; }
+            const Json &view = views->arr[v];
+            int buffer = (int)view.Get("buffer", 0);
+            size_t offset = (size_t)view.Get("byteOffset", 0);
+            size_t length = (size_t)view.Get("byteLength", 0);
+            if ((buffer >= (int)buffers.size()) || (offset + length > buffers[buffer].size())) { return false; }
+            data.assign(buffers[buffer].begin() + offset, buffers[buffer].begin() + offset + length);
+            const Json *m = image.Find("mimeType");
+            mime = m ? m->text : "image/png";
+        }
+
+        size_t before = data.size();
+        Image img;
+        std::string why;
+        if ((mime == "image/png") && DecodePng(data, img, why))
+        {
+            int w = img.width;
+            int h = img.height;
+            Downsize(img, maxTexture);
+            if (isNormal[i] && ((img.width != w) || (img.height != h))) { RenormalizeNormals(img); }
+            Bytes png;
+            EncodePng(img, png);
+            if (png.size() < data.size() || (img.width != w)) { data.swap(png); }
+            printf("  image %zu: %dx%d -> %dx%d, %zu -> %zu bytes\n", i, w, h, img.width, img.height, before, data.size());
+        }
+        else
+        {
+            printf("  image %zu: copied (%s), %zu bytes\n", i, why.empty() ? mime.c_str() : why.c_str(), before);
+        }
+
+        std::map<Bytes, int>::iterator it = seen.find(data);
+        int view = (it != seen.end()) ? it->second : AddView(data, 0, 0);
+        seen[data] = view;
+        image.Remove("uri");
+        image.Set("bufferView", Json::Number(view));
+        image.Set("mimeType", Json::String(mime));
+    }
+    return true;
+}
+
+bool Packer::WriteGlb(const char *path)
+{
+    doc.Set("bufferViews", views);
+    while (bin.size() % 4 != 0) { bin.push_back(0); }
+    Json buffer = Json::Object();
+    buffer.Set("byteLength", Json::Number(bin.size()));
+    Json list = Json::Array();
+    list.arr.push_back(buffer);
+    doc.Set("buffers", list);
+
+    std::string json;
+    WriteJson(doc, json);
+    while (json.size() % 4 != 0) { json += ' '; }
+
+    Bytes out;
+    PutU32(out, 0x46546C67);   // "glTF"
+    PutU32(out, 2);
+    PutU32(out, 12 + 8 + json.size() + 8 + bin.size());
+    PutU32(out, json.size());
+    PutU32(out, 0x4E4F534A);   // "JSON"
+    out.insert(out.end(), json.begin(), json.end());
+    PutU32(out, bin.size());
+    PutU32(out, 0x004E4942);   // "BIN"
+    out.insert(out.end(), bin.begin(), bin.end());
+
+    FILE *f = fopen(path, "wb");
+    if ((f == nullptr) || (fwrite(out.data(), 1, out.size(), f) != out.size()))
+    {
+        fprintf(stderr, "assetpack: cannot write %s\n", path);
+        if (f != nullptr) { fclose(f); }
+        return false;
+    }
+    fclose(f);
+    printf("  %s: %zu bytes (json %zu, bin %zu)\n", path, out.size(), json.size(), bin.size());
+    return true;
+}
+
+static void Usage(const char *prog)
+{
+    fprintf(stderr,
+            "usage: %s [--max-texture N] [--no-quantize] IN.gltf OUT.glb\n"
+            "  --max-texture N  largest texture side after downsizing (default 1024)\n"
+            "  --no-quantize    keep float vertex attributes\n",
+            prog);
+}
+
+/**
+ * @brief Packs one .gltf file and everything it references into a .glb file.
+ */
+int main(int argc, char **argv)
+{
+    Packer packer;
+    const char *in = nullptr;
+    const char *out = nullptr;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--max-texture") == 0) && (i + 1 < argc)) { packer.maxTexture = atoi(argv[++i]); }
+        else if (strcmp(argv[i], "--no-quantize") == 0) { packer.quantize = false; }
+        else if ((argv[i][0] != '-') && (in == nullptr)) { in = argv[i]; }
+        else if ((argv[i][0] != '-') && (out == nullptr)) { out = argv[i]; }
+        else
+        {
+            Usage(argv[0]);
+            return 1;
+        }
+    }
+    if ((in == nullptr) || (out == nullptr) || (packer.maxTexture < 1))
+    {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    Bytes text;
+    if (!ReadFile(in, text)) { return 1; }
+    JsonParser parser;
+    parser.p = (const char *)text.data();
+    parser.end = parser.p + text.size();
+    packer.doc = parser.ParseValue();
+    if (!parser.ok || (packer.doc.type != Json::OBJ))
+    {
+        fprintf(stderr, "assetpack: %s is not a glTF document\n", in);
+        return 1;
+    }
+
+    std::string baseDir = DirName(in);
+    printf("assetpack: %s\n", in);
+    if (!packer.LoadBuffers(baseDir) || !packer.PackAccessors() || !packer.PackImages(baseDir) || !packer.WriteGlb(out))
+    {
+        fprintf(stderr, "assetpack: failed\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,738 @@
+/******************************************************************************
+* Host build support for the WebGL example: benchmark suite.
+*
+* Runs fixed-seed workloads against the application code and prints one
+* JSON object per line, so results can be compared between builds:
+*
+*   encode   JSON (tree and template) vs binary telemetry frame encoding
+*   mime     SendEFFSCustomHeaderResponse() with and without a MIME.txt
+*   url      ParseUrl() over typical and hostile request paths
+*   http     MyDoGet() throughput and latency under N concurrent clients
+*   ftp      RETR/STOR throughput and LIST of a large directory through
+*            the FTPD_* callbacks
+*
+* The card tree is copied to a temporary directory first, so the FTP and
+* MIME workloads never modify the source tree. Application log output goes
+* to /dev/null unless --verbose is given.
+******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <dirent.h>
+#include <ftw.h>
+#include <netinet/in.h>
+
+#include "nbhost_internal.h"
+#include "webclient/json_lexer.h"
+
+#include "../cardindex.h"
+#include "../fusion.h"
+#include "../mount.h"
+#include "../pool.h"
+#include "../telemetry.h"
+#include "../timing.h"
+#include "../urlparse.h"
+#include "../web.h"
+
+static FILE *Out = stdout;
+static uint32_t Seed = 1;
+
+/**
+ * @brief xorshift32, so workloads are the same on every C library.
+ */
+class BenchRandom
+{
+  public:
+    explicit BenchRandom(uint32_t seed) : m_state(seed ? seed : 1) {}
+
+    uint32_t Next()
+    {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 17;
+        m_state ^= m_state << 5;
+        return m_state;
+    }
+
+    float Uniform(float lo, float hi) { return lo + (hi - lo) * (float)(Next() & 0xFFFFFF) / (float)0x1000000; }
+
+  private:
+    uint32_t m_state;
+};
+
+static double NowUs()
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Writes one result line: {"bench":name,"seed":N,<fields>}
+ */
+static void Report(const char *bench, const char *fields, ...)
+{
+    char text[1024];
+    va_list ap;
+    va_start(ap, fields);
+    vsnprintf(text, sizeof(text), fields, ap);
+    va_end(ap);
+    fprintf(Out, "{\"bench\":\"%s\",\"seed\":%u,%s}\n", bench, Seed, text);
+    fflush(Out);
+}
+
+struct LatencySummary
+{
+    double p50, p90, p99, max;
+};
+
+static LatencySummary Summarize(std::vector<double> &us)
+{
+    LatencySummary s = {0, 0, 0, 0};
+    if (us.empty()) { return s; }
+    std::sort(us.begin(), us.end());
+    s.p50 = us[us.size() * 50 / 100];
+    s.p90 = us[us.size() * 90 / 100];
+    s.p99 = us[us.size() * 99 / 100];
+    s.max = us.back();
+    return s;
+}
+
+/*-----------------------------------------------------------------------------
+ * Temporary card tree
+ *---------------------------------------------------------------------------*/
+static bool CopyTree(const std::string &from, const std::string &to)
+{
+    DIR *d = opendir(from.c_str());
+    if (d == nullptr) { return false; }
+    mkdir(to.c_str(), 0777);
+
+    bool ok = true;
+    while (struct dirent *e = readdir(d))
+    {
+        if ((strcmp(e->d_name, ".") == 0) || (strcmp(e->d_name, "..") == 0)) { continue; }
+        std::string src = from + "/" + e->d_name;
+        std::string dst = to + "/" + e->d_name;
+        struct stat st;
+        if (stat(src.c_str(), &st) != 0) { continue; }
+        if (S_ISDIR(st.st_mode))
+        {
+            ok = CopyTree(src, dst) && ok;
+            continue;
+        }
+
+        FILE *in = fopen(src.c_str(), "rb");
+        FILE *out = fopen(dst.c_str(), "wb");
+        if (in && out)
+        {
+            char buf[65536];
+            size_t n;
+            while ((n = fread(buf, 1, sizeof(buf), in)) > 0) { fwrite(buf, 1, n, out); }
+        }
+        else
+        {
+            ok = false;
+        }
+        if (in) { fclose(in); }
+        if (out) { fclose(out); }
+    }
+    closedir(d);
+    return ok;
+}
+
+static void ListFiles(const std::string &root, const std::string &rel, std::vector<std::string> &files)
+{
+    DIR *d = opendir((root + "/" + rel).c_str());
+    if (d == nullptr) { return; }
+    while (struct dirent *e = readdir(d))
+    {
+        if (e->d_name[0] == '.') { continue; }
+        std::string path = rel.empty() ? std::string(e->d_name) : (rel + "/" + e->d_name);
+        struct stat st;
+        if (stat((root + "/" + path).c_str(), &st) != 0) { continue; }
+        if (S_ISDIR(st.st_mode)) { ListFiles(root, path, files); }
+        else { files.push_back(path); }
+    }
+    closedir(d);
+}
+
+static int RemoveEntry(const char *path, const struct stat *, int, struct FTW *)
+{
+    return remove(path);
+}
+
+static void WriteTestFile(const std::string &path, int size, BenchRandom &rng)
+{
+    FILE *fp = fopen(path.c_str(), "wb");
+    if (fp == nullptr) { return; }
+    for (int i = 0; i < size; i++) { fputc((int)(rng.Next() & 0xFF), fp); }
+    fclose(fp);
+}
+
+/*-----------------------------------------------------------------------------
+ * Client side sockets
+ *---------------------------------------------------------------------------*/
+static int Connect(int port)
+{
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons((uint16_t)port);
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+    {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Reads until the peer closes, returns the byte count
+static long Drain(int fd)
+{
+    char buf[65536];
+    long total = 0;
+    ssize_t n;
+    while ((n = recv(fd, buf, sizeof(buf), 0)) > 0) { total += n; }
+    return total;
+}
+
+/*-----------------------------------------------------------------------------
+ * Telemetry encoding
+ *---------------------------------------------------------------------------*/
+static void BenchEncode(int iterations)
+{
+    BenchRandom rng(Seed);
+    std::vector<FusedPose> poses(256);
+    for (size_t i = 0; i < poses.size(); i++)
+    {
+        FusedPose &p = poses[i];
+        p.seq = (uint32_t)i;
+        p.timeUs = rng.Next();
+        p.object = 0;
+        for (int a = 0; a < 3; a++) { p.pos[a] = rng.Uniform(-2.0f, 2.0f); }
+        p.q.w = rng.Uniform(-1.0f, 1.0f);
+        p.q.x = rng.Uniform(-1.0f, 1.0f);
+        p.q.y = rng.Uniform(-1.0f, 1.0f);
+        p.q.z = rng.Uniform(-1.0f, 1.0f);
+        QuatNormalize(p.q);
+    }
+
+    char json[TELEMETRY_JSON_MAX];
+    uint8_t bin[TELEMETRY_BINARY_SIZE];
+    uint32_t check = 0;
+    long bytes = 0;
+
+    // The generic tree builder the template encoder replaced, for comparison
+    double start = NowUs();
+    for (int i = 0; i < iterations; i++)
+    {
+        const FusedPose &pose = poses[i & 255];
+        float rot[3];
+        QuatToEulerXYZ(pose.q, rot);
+
+        ParsedJsonDataSet tree;
+        tree.StartBuilding();
+        tree.Add("seq", (int)pose.seq);
+        tree.Add("t", (int)pose.timeUs);
+        tree.AddObjectStart("PosUpdate");
+        tree.Add("x", pose.pos[0]);
+        tree.Add("y", pose.pos[1]);
+        tree.Add("z", pose.pos[2]);
+        tree.EndObject();
+        tree.AddObjectStart("RotUpdate");
+        tree.Add("x", rot[0]);
+        tree.Add("y", rot[1]);
+        tree.Add("z", rot[2]);
+        tree.EndObject();
+        tree.DoneBuilding();
+        int n = tree.PrintObjectToBuffer(json, sizeof(json));
+        bytes += n;
+        check += (uint8_t)json[n / 2];
+    }
+    double treeUs = NowUs() - start;
+    Report("encode", "\"format\":\"json_tree\",\"frames\":%d,\"ns_per_frame\":%.1f,\"bytes_per_frame\":%.1f,\"check\":%u",
+           iterations, treeUs * 1000.0 / iterations, (double)bytes / iterations, check);
+
+    check = 0;
+    bytes = 0;
+    start = NowUs();
+    for (int i = 0; i < iterations; i++)
+    {
+        int n = EncodeJsonFrame(poses[i & 255], json, sizeof(json));
+        bytes += n;
+        check += (uint8_t)json[n / 2];
+    }
+    double jsonUs = NowUs() - start;
+    Report("encode", "\"format\":\"json\",\"frames\":%d,\"ns_per_frame\":%.1f,\"bytes_per_frame\":%.1f,\"check\":%u",
+           iterations, jsonUs * 1000.0 / iterations, (double)bytes / iterations, check);
+
+    check = 0;
+    bytes = 0;
+    start = NowUs();
+    for (int i = 0; i < iterations; i++)
+    {
+        int n = EncodeBinaryFrame(poses[i & 255], bin, sizeof(bin));
+        bytes += n;
+        check += bin[n - 1];
+    }
+    double binUs = NowUs() - start;
+    Report("encode", "\"format\":\"binary\",\"frames\":%d,\"ns_per_frame\":%.1f,\"bytes_per_frame\":%.1f,\"check\":%u",
+           iterations, binUs * 1000.0 / iterations, (double)bytes / iterations, check);
+}
+
+/*-----------------------------------------------------------------------------
+ * MIME lookup
+ *---------------------------------------------------------------------------*/
+static void BenchMime(const std::string &root, int iterations, bool withFile)
+{
+    static const char *exts[] = {"html", "js", "png", "glb", "gltf", "bin", "css", "jpg", "json", "txt"};
+    const int extCount = sizeof(exts) / sizeof(exts[0]);
+
+    std::string mimeFile = root + "/MIME.txt";
+    if (withFile)
+    {
+        // The types the example serves, most common first, as web.cpp recommends
+        FILE *fp = fopen(mimeFile.c_str(), "w");
+        fprintf(fp, "# Generated by the benchmark\n"
+                    "js      application/javascript\n"
+                    "html    text/html\n"
+                    "png     image/png\n"
+                    "gltf    model/gltf+json\n"
+                    "bin     application/octet-stream\n"
+                    "glb     model/gltf-binary\n"
+                    "json    application/json\n"
+                    "css     text/css\n"
+                    "jpg     image/jpeg\n"
+                    "gif     image/gif\n");
+        fclose(fp);
+    }
+
+    int sv[2];
+    socketpair(AF_UNIX, SOCK_STREAM, 0, sv);
+    std::thread drain([&] { Drain(sv[1]); });
+
+    f_chdir("/");
+    BenchRandom rng(Seed);
+    std::vector<double> lat;
+    lat.reserve(iterations);
+    double start = NowUs();
+    for (int i = 0; i < iterations; i++)
+    {
+        char ext[16];
+        snprintf(ext, sizeof(ext), "%s", exts[rng.Next() % extCount]);
+        double t0 = NowUs();
+        SendEFFSCustomHeaderResponse(sv[0], ext);
+        lat.push_back(NowUs() - t0);
+    }
+    double total = NowUs() - start;
+
+    shutdown(sv[0], SHUT_WR);
+    drain.join();
+    ::close(sv[0]);
+    ::close(sv[1]);
+    if (withFile) { remove(mimeFile.c_str()); }
+
+    LatencySummary s = Summarize(lat);
+    Report("mime", "\"mime_txt\":%s,\"lookups\":%d,\"ns_per_lookup\":%.1f,\"p50_us\":%.1f,\"p99_us\":%.1f,\"max_us\":%.1f",
+           withFile ? "true" : "false", iterations, total * 1000.0 / iterations, s.p50, s.p99, s.max);
+}
+
+/*-----------------------------------------------------------------------------
+ * URL parsing
+ *---------------------------------------------------------------------------*/
+static void BenchUrl(int iterations)
+{
+    static const char *urls[] = {
+        "",
+        "index.html",
+        "js/three.min.js",
+        "assets/GadgetPainted.glb?v=3",
+        "js/../js/./GLTFLoader.js",
+        "assets%2FGadget.glb",
+        "a/b/c/d/e/f/g/h/../../../../model.gltf",
+        "..%2f..%2fetc/passwd",
+        "%2e%2e/%2e%2e/secret.txt",
+        "DIR",
+    };
+    const int urlCount = sizeof(urls) / sizeof(urls[0]);
+
+    BenchRandom rng(Seed);
+    char buf[POOL_PATH_SIZE];
+    int refused = 0;
+    std::vector<double> lat;
+    lat.reserve(iterations);
+    double start = NowUs();
+    for (int i = 0; i < iterations; i++)
+    {
+        ParsedUrl parsed;
+        const char *url = urls[rng.Next() % urlCount];
+        double t0 = NowUs();
+        if (ParseUrl(url, buf, sizeof(buf), parsed) != URL_OK) { refused++; }
+        lat.push_back(NowUs() - t0);
+    }
+    double total = NowUs() - start;
+
+    LatencySummary s = Summarize(lat);
+    Report("url", "\"parses\":%d,\"refused\":%d,\"ns_per_parse\":%.1f,\"p50_us\":%.1f,\"p99_us\":%.1f,\"max_us\":%.1f",
+           iterations, refused, total * 1000.0 / iterations, s.p50, s.p99, s.max);
+}
+
+/*-----------------------------------------------------------------------------
+ * HTTP GET through MyDoGet
+ *---------------------------------------------------------------------------*/
+static void BenchHttp(const std::vector<std::string> &files, int port, int clients, int requests)
+{
+    std::vector<std::vector<double> > lat(clients);
+    std::atomic<long> bytes(0);
+    std::atomic<int> errors(0);
+
+    double start = NowUs();
+    std::vector<std::thread> threads;
+    for (int c = 0; c < clients; c++)
+    {
+        threads.push_back(std::thread([&, c] {
+            BenchRandom rng(Seed + 7919 * (c + 1));
+            for (int r = 0; r < requests; r++)
+            {
+                const std::string &file = files[rng.Next() % files.size()];
+                std::string req = "GET /" + file + " HTTP/1.0\r\n\r\n";
+                double t0 = NowUs();
+                int fd = Connect(port);
+                if (fd < 0)
+                {
+                    errors++;
+                    continue;
+                }
+                NbHostSendAll(fd, req.data(), (int)req.size());
+                long n = Drain(fd);
+                ::close(fd);
+                lat[c].push_back(NowUs() - t0);
+                if (n <= 0) { errors++; }
+                bytes += n;
+            }
+        }));
+    }
+    for (size_t i = 0; i < threads.size(); i++) { threads[i].join(); }
+    double total = NowUs() - start;
+
+    std::vector<double> all;
+    for (int c = 0; c < clients; c++) { all.insert(all.end(), lat[c].begin(), lat[c].end()); }
+    LatencySummary s = Summarize(all);
+    Report("http",
+           "\"clients\":%d,\"requests\":%d,\"errors\":%d,\"req_per_s\":%.1f,\"mb_per_s\":%.2f,"
+           "\"p50_us\":%.0f,\"p90_us\":%.0f,\"p99_us\":%.0f,\"max_us\":%.0f",
+           clients, clients * requests, (int)errors, (clients * requests) / (total / 1e6),
+           (double)bytes / total, s.p50, s.p90, s.p99, s.max);
+}
+
+/*-----------------------------------------------------------------------------
+ * FTP RETR/STOR/LIST
+ *---------------------------------------------------------------------------*/
+static int FtpReply(int fd, std::string &pending)
+{
+    char buf[512];
+    while (1)
+    {
+        size_t eol = pending.find("\r\n");
+        if (eol != std::string::npos)
+        {
+            int code = atoi(pending.c_str());
+            bool last = (pending.size() > 3) && (pending[3] == ' ');
+            pending.erase(0, eol + 2);
+            if (last) { return code; }
+            continue;
+        }
+        ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n <= 0) { return -1; }
+        pending.append(buf, n);
+    }
+}
+
+static int FtpCommand(int fd, std::string &pending, const std::string &cmd)
+{
+    std::string line = cmd + "\r\n";
+    NbHostSendAll(fd, line.data(), (int)line.size());
+    return FtpReply(fd, pending);
+}
+
+static int FtpPassive(int fd, std::string &pending)
+{
+    NbHostSendAll(fd, "EPSV\r\n", 6);
+    char buf[256];
+    std::string reply;
+    while (reply.find("\r\n") == std::string::npos)
+    {
+        ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n <= 0) { return -1; }
+        reply.append(buf, n);
+    }
+    size_t bar = reply.find("|||");
+    if (bar == std::string::npos) { return -1; }
+    return Connect(atoi(reply.c_str() + bar + 3));
+}
+
+static void BenchFtp(const std::string &root, int port, int size, int repeats)
+{
+    BenchRandom rng(Seed + (uint32_t)size);
+    mkdir((root + "/ftpbench").c_str(), 0777);
+    WriteTestFile(root + "/ftpbench/source.bin", size, rng);
+    std::vector<char> payload(size);
+    for (int i = 0; i < size; i++) { payload[i] = (char)(rng.Next() & 0xFF); }
+
+    int ctrl = Connect(port);
+    if (ctrl < 0)
+    {
+        Report("ftp", "\"error\":\"connect\"");
+        return;
+    }
+    std::string pending;
+    FtpReply(ctrl, pending);
+    FtpCommand(ctrl, pending, "USER bench");
+    FtpCommand(ctrl, pending, "PASS bench");
+    FtpCommand(ctrl, pending, "TYPE I");
+    FtpCommand(ctrl, pending, "CWD /ftpbench");
+
+    int errors = 0;
+    std::vector<double> lat;
+    double start = NowUs();
+    for (int r = 0; r < repeats; r++)
+    {
+        double t0 = NowUs();
+        int data = FtpPassive(ctrl, pending);
+        if ((data < 0) || (FtpCommand(ctrl, pending, "RETR source.bin") != 150))
+        {
+            errors++;
+            if (data >= 0) { ::close(data); }
+            continue;
+        }
+        long n = Drain(data);
+        ::close(data);
+        if ((FtpReply(ctrl, pending) != 226) || (n != size)) { errors++; }
+        lat.push_back(NowUs() - t0);
+    }
+    double total = NowUs() - start;
+    LatencySummary s = Summarize(lat);
+    Report("ftp", "\"op\":\"retr\",\"bytes\":%d,\"transfers\":%d,\"errors\":%d,\"mb_per_s\":%.2f,\"p50_us\":%.0f,\"max_us\":%.0f",
+           size, repeats, errors, ((double)size * repeats) / total, s.p50, s.max);
+
+    errors = 0;
+    lat.clear();
+    start = NowUs();
+    for (int r = 0; r < repeats; r++)
+    {
+        double t0 = NowUs();
+        int data = FtpPassive(ctrl, pending);
+        if ((data < 0) || (FtpCommand(ctrl, pending, "STOR upload.bin") != 150))
+        {
+            errors++;
+            if (data >= 0) { ::close(data); }
+            continue;
+        }
+        NbHostSendAll(data, payload.data(), size);
+        ::close(data);
+        if (FtpReply(ctrl, pending) != 226) { errors++; }
+        lat.push_back(NowUs() - t0);
+    }
+    total = NowUs() - start;
+
+    struct stat st;
+    if ((stat((root + "/ftpbench/upload.bin").c_str(), &st) != 0) || (st.st_size != size)) { errors++; }
+    s = Summarize(lat);
+    Report("ftp", "\"op\":\"stor\",\"bytes\":%d,\"transfers\":%d,\"errors\":%d,\"mb_per_s\":%.2f,\"p50_us\":%.0f,\"max_us\":%.0f",
+           size, repeats, errors, ((double)size * repeats) / total, s.p50, s.max);
+
+    FtpCommand(ctrl, pending, "QUIT");
+    ::close(ctrl);
+}
+
+static void BenchFtpList(const std::string &root, int port, int entries, int repeats)
+{
+    BenchRandom rng(Seed);
+    mkdir((root + "/ftplist").c_str(), 0777);
+    for (int i = 0; i < entries; i++)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "/ftplist/LOG%05d.TXT", i);
+        WriteTestFile(root + name, 64, rng);
+    }
+
+    int ctrl = Connect(port);
+    if (ctrl < 0)
+    {
+        Report("ftp", "\"error\":\"connect\"");
+        return;
+    }
+    std::string pending;
+    FtpReply(ctrl, pending);
+    FtpCommand(ctrl, pending, "USER bench");
+    FtpCommand(ctrl, pending, "PASS bench");
+    FtpCommand(ctrl, pending, "CWD /ftplist");
+
+    int errors = 0;
+    std::vector<double> lat;
+    for (int r = 0; r < repeats; r++)
+    {
+        double t0 = NowUs();
+        int data = FtpPassive(ctrl, pending);
+        if ((data < 0) || (FtpCommand(ctrl, pending, "LIST") != 150))
+        {
+            errors++;
+            if (data >= 0) { ::close(data); }
+            continue;
+        }
+        std::string listing;
+        char buf[4096];
+        ssize_t n;
+        while ((n = recv(data, buf, sizeof(buf), 0)) > 0) { listing.append(buf, n); }
+        ::close(data);
+        // A subdirectory also lists . and ..
+        if ((FtpReply(ctrl, pending) != 226) || (std::count(listing.begin(), listing.end(), '\n') != entries + 2)) { errors++; }
+        lat.push_back(NowUs() - t0);
+    }
+    LatencySummary s = Summarize(lat);
+    Report("ftp", "\"op\":\"list\",\"entries\":%d,\"listings\":%d,\"errors\":%d,\"p50_us\":%.0f,\"max_us\":%.0f", entries,
+           repeats, errors, s.p50, s.max);
+
+    // A sync client follows the listing with a SIZE probe per file
+    errors = 0;
+    lat.clear();
+    int probes = std::min(entries, 500);
+    for (int i = 0; i < probes; i++)
+    {
+        char cmd[32];
+        snprintf(cmd, sizeof(cmd), "SIZE LOG%05d.TXT", i);
+        double t0 = NowUs();
+        if (FtpCommand(ctrl, pending, cmd) != 213) { errors++; }
+        lat.push_back(NowUs() - t0);
+    }
+    s = Summarize(lat);
+    Report("ftp", "\"op\":\"size\",\"probes\":%d,\"errors\":%d,\"p50_us\":%.0f,\"max_us\":%.0f", probes, errors, s.p50,
+           s.max);
+
+    FtpCommand(ctrl, pending, "QUIT");
+    ::close(ctrl);
+}
+
+/*-----------------------------------------------------------------------------
+ * Entry point
+ *---------------------------------------------------------------------------*/
+static void Usage(const char *prog)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --tree DIR        card contents to serve (default ../SdCardFiles)\n"
+            "  --html DIR        compiled-in pages (default ../html)\n"
+            "  --seed N          workload seed (default 1)\n"
+            "  --iterations N    encode, URL and MIME iterations (default 200000, 200000, 20000)\n"
+            "  --clients LIST    concurrent HTTP clients, comma separated (default 1,4,16)\n"
+            "  --requests N      HTTP requests per client (default 200)\n"
+            "  --ftp-repeats N   transfers per FTP file size (default 20)\n"
+            "  --http-port N     (default 18080)\n"
+            "  --ftp-port N      (default 12121)\n"
+            "  --only NAME       run one of encode, url, mime, http, ftp\n"
+            "  --verbose         keep the application's log output\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    std::string tree = "../SdCardFiles";
+    const char *html = "../html";
+    int iterations = 200000;
+    std::vector<int> clients = {1, 4, 16};
+    int requests = 200;
+    int ftpRepeats = 20;
+    int httpPort = 18080;
+    int ftpPort = 12121;
+    std::string only;
+    bool verbose = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool more = (i + 1 < argc);
+        if ((strcmp(argv[i], "--tree") == 0) && more) { tree = argv[++i]; }
+        else if ((strcmp(argv[i], "--html") == 0) && more) { html = argv[++i]; }
+        else if ((strcmp(argv[i], "--seed") == 0) && more) { Seed = (uint32_t)strtoul(argv[++i], nullptr, 0); }
+        else if ((strcmp(argv[i], "--iterations") == 0) && more) { iterations = atoi(argv[++i]); }
+        else if ((strcmp(argv[i], "--requests") == 0) && more) { requests = atoi(argv[++i]); }
+        else if ((strcmp(argv[i], "--ftp-repeats") == 0) && more) { ftpRepeats = atoi(argv[++i]); }
+        else if ((strcmp(argv[i], "--http-port") == 0) && more) { httpPort = atoi(argv[++i]); }
+        else if ((strcmp(argv[i], "--ftp-port") == 0) && more) { ftpPort = atoi(argv[++i]); }
+        else if ((strcmp(argv[i], "--only") == 0) && more) { only = argv[++i]; }
+        else if (strcmp(argv[i], "--verbose") == 0) { verbose = true; }
+        else if ((strcmp(argv[i], "--clients") == 0) && more)
+        {
+            clients.clear();
+            for (char *p = strtok(argv[++i], ","); p; p = strtok(nullptr, ",")) { clients.push_back(atoi(p)); }
+        }
+        else
+        {
+            Usage(argv[0]);
+            return 1;
+        }
+    }
+
+    // Results keep the real stdout, the application's iprintf output does not
+    Out = fdopen(dup(STDOUT_FILENO), "w");
+    if (!verbose) { freopen("/dev/null", "w", stdout); }
+
+    char root[] = "/tmp/webgl_bench.XXXXXX";
+    if ((mkdtemp(root) == nullptr) || !CopyTree(tree, root))
+    {
+        fprintf(stderr, "unable to copy %s to a temporary directory\n", tree.c_str());
+        return 1;
+    }
+    std::vector<std::string> files;
+    ListFiles(root, "", files);
+    std::sort(files.begin(), files.end());
+
+    NbHostSetFsRoot(root);
+    NbHostSetHtmlRoot(html);
+    NbHostSetPorts(httpPort, ftpPort);
+    NbHostStartTicker();
+    f_enterFS();
+    InitTiming();
+    InitPools();
+    InitMountManager(MAIN_PRIO + 3);
+    while (!CardMounted()) { OSTimeDly(1); }
+    InitCardIndex(MAIN_PRIO + 4);
+    CardIndexStatus indexStatus;
+    do
+    {
+        OSTimeDly(1);
+        CardIndexGetStatus(indexStatus);
+    } while (!indexStatus.ready);
+
+    if (only.empty() || (only == "encode")) { BenchEncode(iterations); }
+    if (only.empty() || (only == "url")) { BenchUrl(iterations); }
+    if (only.empty() || (only == "mime"))
+    {
+        BenchMime(root, iterations / 10, false);
+        BenchMime(root, iterations / 10, true);
+    }
+    if (only.empty() || (only == "http") || (only == "ftp"))
+    {
+        StartHTTP();
+        RegisterWebFuncs();
+        FTPDStart(21, MAIN_PRIO - 2);
+        OSTimeDly(TICKS_PER_SECOND / 4);
+    }
+    if (only.empty() || (only == "http"))
+    {
+        for (size_t i = 0; i < clients.size(); i++) { BenchHttp(files, httpPort, clients[i], requests); }
+    }
+    if (only.empty() || (only == "ftp"))
+    {
+        BenchFtp(root, ftpPort, 64 * 1024, ftpRepeats);
+        BenchFtp(root, ftpPort, 1024 * 1024, ftpRepeats);
+        BenchFtpList(root, ftpPort, 2000, ftpRepeats);
+    }
+
+    nftw(root, RemoveEntry, 16, FTW_DEPTH | FTW_PHYS);
+    return 0;
+}
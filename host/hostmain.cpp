@@ -0,0 +1,53 @@
+/******************************************************************************
+* Host build support for the WebGL example: program entry point.
+******************************************************************************/
+
+#include "include/nbhost.h"
+
+static void Usage(const char *prog)
+{
+    fprintf(stderr,
+            "usage: %s [--root DIR] [--html DIR] [--http-port N] [--ftp-port N]\n"
+            "          [--multicast-if ADDR]\n"
+            "  --root DIR       directory that stands in for the flash card (default ../SdCardFiles)\n"
+            "  --html DIR       compiled-in pages served when the card has no match (default ../html)\n"
+            "  --http-port N    HTTP and WebSocket port (default 8080)\n"
+            "  --ftp-port N     FTP control port (default 2121)\n"
+            "  --multicast-if ADDR  interface for multicast telemetry, e.g. 127.0.0.1 (default: routing table)\n",
+            prog);
+}
+
+/**
+ * @brief Host entry point. Applies the command line settings and runs UserMain() as the main task.
+ */
+int main(int argc, char **argv)
+{
+    const char *root = "../SdCardFiles";
+    const char *html = "../html";
+    int httpPort = 8080;
+    int ftpPort = 2121;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--root") == 0) && (i + 1 < argc)) { root = argv[++i]; }
+        else if ((strcmp(argv[i], "--html") == 0) && (i + 1 < argc)) { html = argv[++i]; }
+        else if ((strcmp(argv[i], "--http-port") == 0) && (i + 1 < argc)) { httpPort = atoi(argv[++i]); }
+        else if ((strcmp(argv[i], "--ftp-port") == 0) && (i + 1 < argc)) { ftpPort = atoi(argv[++i]); }
+        else if ((strcmp(argv[i], "--multicast-if") == 0) && (i + 1 < argc)) { NbHostSetMulticastIf(argv[++i]); }
+        else
+        {
+            Usage(argv[0]);
+            return 1;
+        }
+    }
+
+    setvbuf(stdout, nullptr, _IOLBF, 0);
+    NbHostSetFsRoot(root);
+    NbHostSetHtmlRoot(html);
+    NbHostSetPorts(httpPort, ftpPort);
+
+    NbHostStartTicker();
+    UserMain(nullptr);
+    return 0;
+}
+
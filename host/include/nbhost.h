@@ -0,0 +1,389 @@
+/******************************************************************************
+* Host build support for the WebGL example.
+*
+* Declares POSIX stand-ins for the parts of the NetBurner NNDK API that the
+* application uses, so the unmodified application sources can be built and
+* profiled on a Linux workstation. The NNDK header names in this directory
+* all include this file.
+*
+* The stand-ins mirror NNDK behavior where the application depends on it
+* (per-task EFFS working directories, case insensitive FAT names, one HTTP
+* task serving requests in turn, WebSocket framing on write/read), and are
+* otherwise kept as thin as possible so that profiles show the application.
+******************************************************************************/
+
+#ifndef _NBHOST_H_
+#define _NBHOST_H_
+#pragma once
+
+// System headers must come before the renaming macros below
+#include <ctype.h>
+#include <fcntl.h>
+#include <math.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+/*-----------------------------------------------------------------------------
+ * Basic types and constants
+ *---------------------------------------------------------------------------*/
+typedef unsigned char BYTE;
+typedef unsigned short WORD;
+typedef unsigned long DWORD;
+typedef char *PSTR;
+typedef unsigned char *PBYTE;
+typedef uint32_t IPADDR4;
+typedef uint32_t IPADDR;
+
+#ifndef TICKS_PER_SECOND
+#define TICKS_PER_SECOND (20)
+#endif
+
+#define OS_LO_PRIO (63)
+#define MAIN_PRIO (50)
+#define HTTP_PRIO (45)
+#define USER_TASK_STK_SIZE (2048)
+
+#define OS_NO_ERR (0)
+#define OS_TIMEOUT (10)
+
+// NNDK printf family: the integer-only variants map onto the standard ones
+#define iprintf printf
+#define siprintf sprintf
+#define sniprintf snprintf
+#define vsniprintf vsnprintf
+
+/*-----------------------------------------------------------------------------
+ * RTOS
+ *---------------------------------------------------------------------------*/
+extern volatile DWORD TimeTick;
+extern volatile DWORD Secs;
+
+struct OS_SEM
+{
+    void *impl;
+};
+
+struct OS_CRIT
+{
+    void *impl;
+};
+
+BYTE OSTaskCreate(void (*task)(void *), void *data, void *pstktop, void *pstkbot, BYTE prio);
+#define OSSimpleTaskCreate(x, p) OSTaskCreate(x, NULL, NULL, NULL, p)
+#define OSSimpleTaskCreatewName(x, p, n) OSTaskCreatewName(x, NULL, NULL, NULL, p, n)
+BYTE OSTaskCreatewName(void (*task)(void *), void *data, void *pstktop, void *pstkbot, BYTE prio, const char *name);
+BYTE OSChangePrio(BYTE newp);
+void OSTimeDly(WORD ticks);
+DWORD OSTimeGet();
+const char *OSTaskName();
+int OSTaskID();
+void OSLock();
+void OSUnlock();
+
+BYTE OSSemInit(OS_SEM *psem, long value);
+BYTE OSSemPost(OS_SEM *psem);
+BYTE OSSemPend(OS_SEM *psem, WORD timeout);
+BYTE OSSemPendNoWait(OS_SEM *psem);
+
+BYTE OSCritInit(OS_CRIT *pCrit);
+BYTE OSCritEnter(OS_CRIT *pCrit, WORD timeout);
+BYTE OSCritEnterNoWait(OS_CRIT *pCrit);
+BYTE OSCritLeave(OS_CRIT *pCrit);
+
+/**
+ * HiResTimer stand-in. Only what the application uses: a free-running time
+ * since start() and a blocking delay, both from the monotonic clock.
+ */
+class HiResTimer
+{
+  public:
+    static HiResTimer *getHiResTimer(int timer = 0);
+    void init(double interruptTime = 0);
+    void start();
+    void stop();
+    double readTime();
+    void delay(double seconds);
+
+  private:
+    double m_startSeconds;
+};
+
+void init();
+
+/*-----------------------------------------------------------------------------
+ * I/O system. NNDK names that collide with POSIX are renamed.
+ *---------------------------------------------------------------------------*/
+#define read NbRead
+#define write NbWrite
+#define close NbClose
+#define select NbSelect
+#define listen NbListen
+#define accept NbAccept
+#define sendto NbSendTo
+
+int NbRead(int fd, char *buf, int nbytes);
+int NbWrite(int fd, const char *buf, int nbytes);
+int NbClose(int fd);
+int NbSelect(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds, DWORD timeout);
+int writeall(int fd, const char *buf, int nbytes);
+int writestring(int fd, const char *str);
+int ReadWithTimeout(int fd, char *buf, int nbytes, DWORD timeout);
+int dataavail(int fd);
+int writeavail(int fd);   // 1 if the socket can take any data, like NNDK
+int TcpGetTxBufferAvailSpace(int fd);
+int charavail();
+
+// NNDK TCP listen and accept. A timeout of 0 waits forever.
+int NbListen(IPADDR addr, WORD port, BYTE maxpend = 5);
+int NbAccept(int listening_socket, IPADDR *address, WORD *port, WORD timeout);
+
+// NNDK UDP transmit sockets. IPADDR is in host byte order.
+IPADDR AsciiToIp(const char *p);
+int CreateTxUdpSocket(IPADDR send_to_addr, WORD remote_port, WORD local_port);
+int NbSendTo(int sock, PBYTE what_to_send, int len_to_send, IPADDR to_addr, WORD remote_port);
+
+#define TCP_ERR_TIMEOUT (-1)
+#define TCP_ERR_CLOSING (-3)
+
+void SetSocketTxBuffers(int fd, int n);
+void SetSocketRxBuffers(int fd, int n);
+
+/*-----------------------------------------------------------------------------
+ * HTTP server
+ *---------------------------------------------------------------------------*/
+struct HTTP_Request
+{
+    char *pHeaders;   // Raw request headers, NUL terminated
+};
+
+typedef int(http_gethandler)(int sock, PSTR url, PSTR rxBuffer);
+typedef int(http_wshandler)(HTTP_Request *req, int sock, PSTR url, PSTR rxBuffer);
+
+extern http_wshandler *TheWSHandler;
+
+void StartHTTP(WORD port = 80);
+http_gethandler *SetNewGetHandler(http_gethandler *newhandler);
+void RedirectResponse(int sock, const char *new_page);
+void NotFoundResponse(int sock, const char *new_page);
+int httpstricmp(const char *s1, const char *sisupper2);
+
+/*-----------------------------------------------------------------------------
+ * WebSockets
+ *---------------------------------------------------------------------------*/
+#define WS_SO_TEXT (0x01)
+
+int WSUpgrade(HTTP_Request *req, int sock);
+
+namespace NB
+{
+namespace WebSocket
+{
+int ws_setoption(int fd, int option);
+int ws_clroption(int fd, int option);
+}   // namespace WebSocket
+}   // namespace NB
+
+/*-----------------------------------------------------------------------------
+ * FTP server. The application supplies the FTPD_* callbacks.
+ *---------------------------------------------------------------------------*/
+#define FTPD_OK (0)
+#define FTPD_RUNNING (1)
+#define FTPD_FAIL (2)
+#define FTPD_FILE_SIZE_NOSUCH_FILE (-1)
+
+typedef void(FTPDCallBackReportFunct)(int fd, const char *line);
+
+int FTPDStart(WORD port, BYTE server_priority);
+
+void *FTPDSessionStart(const char *user, const char *passwd, const IPADDR4 hi_ip);
+void FTPDSessionEnd(void *pSession);
+int FTPD_DirectoryExists(const char *full_directory, void *pSession);
+int FTPD_CreateSubDirectory(const char *current_directory, const char *new_dir, void *pSession);
+int FTPD_DeleteSubDirectory(const char *current_directory, const char *sub_dir, void *pSession);
+int FTPD_ListSubDirectories(const char *current_directory, void *pSession, FTPDCallBackReportFunct *pFunc, int socket);
+int FTPD_FileExists(const char *full_directory, const char *file_name, void *pSession);
+int FTPD_GetFileSize(const char *full_directory, const char *file_name);
+int FTPD_SendFileToClient(const char *full_directory, const char *file_name, void *pSession, int fd);
+int FTPD_AbleToCreateFile(const char *full_directory, const char *file_name, void *pSession);
+int FTPD_GetFileFromClient(const char *full_directory, const char *file_name, void *pSession, int fd);
+int FTPD_DeleteFile(const char *current_directory, const char *file_name, void *pSession);
+int FTPD_ListFile(const char *current_directory, void *pSession, FTPDCallBackReportFunct *pFunc, int socket);
+int FTPD_Rename(const char *full_directory, const char *old_file_name, const char *new_file_name, void *pSession);
+
+/*-----------------------------------------------------------------------------
+ * EFFS FAT file system, backed by a host directory
+ *---------------------------------------------------------------------------*/
+#define F_LONGFILENAME (1)
+#define F_MAXPATH (256)
+
+#define MMC_DRV_NUM (1)
+#define CFC_DRV_NUM (2)
+#define F_RAM_DRIVE0 (0)
+#define F_MMC_DRIVE0 (0)
+#define F_CFC_DRIVE0 (0)
+
+#define F_FAT12_MEDIA (1)
+#define F_FAT16_MEDIA (2)
+#define F_FAT32_MEDIA (3)
+
+#define F_ATTR_ARC (0x20)
+#define F_ATTR_DIR (0x10)
+#define F_ATTR_VOLUME (0x08)
+#define F_ATTR_SYSTEM (0x04)
+#define F_ATTR_HIDDEN (0x02)
+#define F_ATTR_READONLY (0x01)
+
+#define F_SEEK_SET (0)
+#define F_SEEK_CUR (1)
+#define F_SEEK_END (2)
+
+enum
+{
+    F_NO_ERROR,
+    F_ERR_INVALIDDRIVE,
+    F_ERR_NOTFORMATTED,
+    F_ERR_INVALIDDIR,
+    F_ERR_INVALIDNAME,
+    F_ERR_NOTFOUND,
+    F_ERR_DUPLICATED,
+    F_ERR_NOMOREENTRY,
+    F_ERR_NOTOPEN,
+    F_ERR_EOF,
+    F_ERR_RESERVED,
+    F_ERR_NOTUSEABLE,
+    F_ERR_LOCKED,
+    F_ERR_ACCESSDENIED,
+    F_ERR_NOTEMPTY,
+    F_ERR_INITFUNC,
+    F_ERR_CARDREMOVED,
+    F_ERR_ONDRIVE,
+    F_ERR_INVALIDSECTOR,
+    F_ERR_READ,
+    F_ERR_WRITE,
+    F_ERR_INVALIDMEDIA,
+    F_ERR_BUSY,
+    F_ERR_WRITEPROTECT,
+    F_ERR_INVFATTYPE,
+    F_ERR_MEDIATOOSMALL,
+    F_ERR_MEDIATOOLARGE,
+    F_ERR_NOTSUPPSECTORSIZE,
+    F_ERR_DELFUNC,
+    F_ERR_MOUNTED,
+    F_ERR_TOOLONGNAME,
+    F_ERR_NOTFORREAD,
+    F_ERR_DELFUNC2,
+    F_ERR_ALLOCATION,
+    F_ERR_INVALIDPOS,
+    F_ERR_NOMORETASK,
+    F_ERR_NOTAVAILABLE,
+    F_ERR_TASKNOTFOUND,
+    F_ERR_UNUSABLE
+};
+
+struct F_FILE;
+
+typedef struct
+{
+    char filename[F_MAXPATH];
+    char name[F_MAXPATH];
+    char ext[F_MAXPATH];
+    unsigned char attr;
+    unsigned short ctime;
+    unsigned short cdate;
+    long filesize;
+    // Host search state
+    int slot;
+    int pos;
+    char pattern[F_MAXPATH];
+} F_FIND;
+
+typedef struct
+{
+    long filesize;
+    unsigned short createdate;
+    unsigned short createtime;
+    unsigned short modifieddate;
+    unsigned short modifiedtime;
+    unsigned short lastaccessdate;
+    unsigned char attr;
+    int drivenum;
+} F_STAT;
+
+typedef struct
+{
+    unsigned long total, free, used, bad;
+    unsigned long total_high, free_high, used_high, bad_high;
+} F_SPACE;
+
+typedef int (*F_DRIVERINIT)(unsigned long driver_param);
+
+int f_enterFS();
+void f_releaseFS();
+int f_mountfat(int drivenum, F_DRIVERINIT driver_init, unsigned long driver_param);
+int f_delvolume(int drivenum);
+int f_format(int drivenum, long fattype);
+int f_getfreespace(int drivenum, F_SPACE *pspace);
+int f_chdrive(int drivenum);
+int f_getdrive();
+int f_getlasterror();
+
+int f_chdir(const char *dirname);
+int f_mkdir(const char *dirname);
+int f_rmdir(const char *dirname);
+int f_delete(const char *filename);
+int f_rename(const char *filename, const char *newname);
+int f_findfirst(const char *filename, F_FIND *find);
+int f_findnext(F_FIND *find);
+int f_stat(const char *filename, F_STAT *stat);
+long f_filelength(const char *filename);
+int f_gettimedate(const char *filename, unsigned short *pctime, unsigned short *pcdate);
+int f_settimedate(const char *filename, unsigned short ctime, unsigned short cdate);
+unsigned short f_gettime();
+unsigned short f_getdate();
+
+F_FILE *f_open(const char *filename, const char *mode);
+int f_close(F_FILE *filehandle);
+long f_read(void *buf, long size, long size_st, F_FILE *filehandle);
+long f_write(const void *buf, long size, long size_st, F_FILE *filehandle);
+int f_eof(F_FILE *filehandle);
+int f_seek(F_FILE *filehandle, long offset, long whence);
+long f_tell(F_FILE *filehandle);
+int f_rewind(F_FILE *filehandle);
+int f_flush(F_FILE *filehandle);
+char *f_fgets(char *buffer, int len, F_FILE *filehandle);
+int f_fputs(const char *s, F_FILE *filehandle);
+int f_fprintf(F_FILE *filehandle, const char *format, ...);
+
+// Card detect, write protect and driver entry points
+int get_cd();
+int get_wp();
+int mmc_initfunc(unsigned long driver_param);
+int cfc_initfunc(unsigned long driver_param);
+
+/*-----------------------------------------------------------------------------
+ * Host configuration, set from the command line before UserMain() runs
+ *---------------------------------------------------------------------------*/
+void NbHostSetFsRoot(const char *path);
+void NbHostSetHtmlRoot(const char *path);
+void NbHostSetPorts(int httpPort, int ftpPort);
+// Sends multicast telemetry from the interface with this address, e.g. 127.0.0.1 to keep it on this machine
+void NbHostSetMulticastIf(const char *address);
+void NbHostStartTicker();   // Only needed by programs with their own main()
+
+extern "C"
+{
+    void UserMain(void *pd);
+}
+
+#endif /* _NBHOST_H_ */
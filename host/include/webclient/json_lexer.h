@@ -0,0 +1,41 @@
+/* Host build stand-in for the NNDK header of the same name. See nbhost.h. */
+#ifndef _NBHOST_JSON_LEXER_H_
+#define _NBHOST_JSON_LEXER_H_
+#pragma once
+
+#include "../nbhost.h"
+
+/**
+ * Builder half of the NNDK JSON data set, enough to produce the telemetry
+ * frames. Like the NNDK class it builds a heap allocated tree and then
+ * prints it, so host profiles show a comparable cost. Output is compact
+ * JSON with floats printed to six significant digits.
+ */
+class ParsedJsonDataSet
+{
+  public:
+    ParsedJsonDataSet();
+    ~ParsedJsonDataSet();
+
+    void StartBuilding();
+    void AddObjectStart(const char *name);
+    void EndObject();
+    void Add(const char *name, int i);
+    void Add(const char *name, float f);
+    void Add(const char *name, double d);
+    void Add(const char *name, const char *str);
+    void Add(const char *name, bool b);
+    void DoneBuilding();
+
+    int PrintObjectToBuffer(char *buffer, int maxlen, bool pretty = false);
+    void PrintObject(bool pretty = false);
+
+  private:
+    ParsedJsonDataSet(const ParsedJsonDataSet &);
+    ParsedJsonDataSet &operator=(const ParsedJsonDataSet &);
+
+    struct Impl;
+    Impl *m_impl;
+};
+
+#endif /* _NBHOST_JSON_LEXER_H_ */
@@ -0,0 +1,2 @@
+/* Host build stand-in for the NNDK header of the same name. See nbhost.h. */
+#include "nbhost.h"
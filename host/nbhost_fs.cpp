@@ -0,0 +1,514 @@
+/******************************************************************************
+* Host build support for the WebGL example: EFFS FAT stand-in.
+*
+* A host directory plays the part of the flash card. As with EFFS, every
+* task has its own working directory, and names are matched without regard
+* to case. Paths can never resolve outside the root directory.
+******************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <errno.h>
+#include <fnmatch.h>
+#include <sys/statvfs.h>
+#include <time.h>
+#include <utime.h>
+
+#include "include/nbhost.h"
+
+struct F_FILE
+{
+    FILE *fp;
+};
+
+static std::string FsRoot = ".";
+static thread_local std::string FsCwd = "/";   // Always starts and ends with '/'
+static thread_local int FsLastError = F_NO_ERROR;
+
+void NbHostSetFsRoot(const char *path)
+{
+    FsRoot = path;
+    while ((FsRoot.size() > 1) && (FsRoot[FsRoot.size() - 1] == '/'))
+    {
+        FsRoot.erase(FsRoot.size() - 1);
+    }
+}
+
+static int Fail(int code)
+{
+    FsLastError = code;
+    return code;
+}
+
+/**
+ * @brief Splits a path on '/' and '\', applying it to the working directory and collapsing
+ * "." and ".." (which cannot climb above the root).
+ */
+static std::vector<std::string> Components(const char *path)
+{
+    std::vector<std::string> parts;
+    std::string base = ((path[0] == '/') || (path[0] == '\\')) ? std::string("/") : FsCwd;
+    std::string all = base + path;
+
+    std::string cur;
+    for (size_t i = 0; i <= all.size(); i++)
+    {
+        char c = (i < all.size()) ? all[i] : '/';
+        if ((c == '/') || (c == '\\'))
+        {
+            if (cur == "..")
+            {
+                if (!parts.empty()) { parts.pop_back(); }
+            }
+            else if (!cur.empty() && (cur != "."))
+            {
+                parts.push_back(cur);
+            }
+            cur.clear();
+        }
+        else
+        {
+            cur += c;
+        }
+    }
+    return parts;
+}
+
+/**
+ * @brief Finds the entry in dir whose name matches name without regard to case.
+ */
+static bool MatchCase(const std::string &dir, std::string &name)
+{
+    struct stat st;
+    if (lstat((dir + "/" + name).c_str(), &st) == 0) { return true; }
+
+    DIR *d = opendir(dir.c_str());
+    if (d == nullptr) { return false; }
+    bool found = false;
+    while (struct dirent *e = readdir(d))
+    {
+        if (strcasecmp(e->d_name, name.c_str()) == 0)
+        {
+            name = e->d_name;
+            found = true;
+            break;
+        }
+    }
+    closedir(d);
+    return found;
+}
+
+/**
+ * @brief Maps an EFFS path to a host path. If the last component does not exist yet it is kept
+ * as given, so it can be created. virt receives the normalized EFFS path.
+ */
+static std::string HostPath(const char *path, std::string *virt = nullptr)
+{
+    std::vector<std::string> parts = Components(path);
+    std::string host = FsRoot;
+    std::string v = "/";
+    for (size_t i = 0; i < parts.size(); i++)
+    {
+        MatchCase(host, parts[i]);
+        host += "/" + parts[i];
+        v += parts[i] + "/";
+    }
+    if (virt) { *virt = v; }
+    return host;
+}
+
+static unsigned short FatTime(time_t t)
+{
+    struct tm tm;
+    localtime_r(&t, &tm);
+    return (unsigned short)((tm.tm_hour << 11) | (tm.tm_min << 5) | (tm.tm_sec / 2));
+}
+
+static unsigned short FatDate(time_t t)
+{
+    struct tm tm;
+    localtime_r(&t, &tm);
+    int year = tm.tm_year + 1900 - 1980;
+    if (year < 0) { year = 0; }
+    return (unsigned short)((year << 9) | ((tm.tm_mon + 1) << 5) | tm.tm_mday);
+}
+
+static time_t FromFat(unsigned short t, unsigned short d)
+{
+    struct tm tm;
+    memset(&tm, 0, sizeof(tm));
+    tm.tm_year = ((d >> 9) & 0x7F) + 80;
+    tm.tm_mon = ((d >> 5) & 0x0F) - 1;
+    tm.tm_mday = d & 0x1F;
+    tm.tm_hour = (t >> 11) & 0x1F;
+    tm.tm_min = (t >> 5) & 0x3F;
+    tm.tm_sec = (t & 0x1F) * 2;
+    tm.tm_isdst = -1;
+    return mktime(&tm);
+}
+
+int f_enterFS()
+{
+    return F_NO_ERROR;
+}
+
+void f_releaseFS() {}
+
+int f_mountfat(int, F_DRIVERINIT, unsigned long)
+{
+    struct stat st;
+    if ((stat(FsRoot.c_str(), &st) != 0) || !S_ISDIR(st.st_mode)) { return Fail(F_ERR_NOTFORMATTED); }
+    return F_NO_ERROR;
+}
+
+int f_delvolume(int)
+{
+    return F_NO_ERROR;
+}
+
+int f_format(int, long)
+{
+    // Never wipe a host directory
+    return Fail(F_ERR_NOTUSEABLE);
+}
+
+int f_getfreespace(int, F_SPACE *pspace)
+{
+    struct statvfs vfs;
+    memset(pspace, 0, sizeof(*pspace));
+    if (statvfs(FsRoot.c_str(), &vfs) != 0) { return Fail(F_ERR_INVALIDDRIVE); }
+
+    unsigned long long total = (unsigned long long)vfs.f_blocks * vfs.f_frsize;
+    unsigned long long freeb = (unsigned long long)vfs.f_bavail * vfs.f_frsize;
+    unsigned long long used = total - freeb;
+    pspace->total = (unsigned long)(total & 0xFFFFFFFF);
+    pspace->total_high = (unsigned long)(total >> 32);
+    pspace->free = (unsigned long)(freeb & 0xFFFFFFFF);
+    pspace->free_high = (unsigned long)(freeb >> 32);
+    pspace->used = (unsigned long)(used & 0xFFFFFFFF);
+    pspace->used_high = (unsigned long)(used >> 32);
+    return F_NO_ERROR;
+}
+
+int f_chdrive(int)
+{
+    return F_NO_ERROR;
+}
+
+int f_getdrive()
+{
+    return MMC_DRV_NUM;
+}
+
+int f_getlasterror()
+{
+    return FsLastError;
+}
+
+int f_chdir(const char *dirname)
+{
+    std::string virt;
+    std::string host = HostPath(dirname, &virt);
+    struct stat st;
+    if ((stat(host.c_str(), &st) != 0) || !S_ISDIR(st.st_mode)) { return Fail(F_ERR_INVALIDDIR); }
+    FsCwd = virt;
+    return F_NO_ERROR;
+}
+
+int f_mkdir(const char *dirname)
+{
+    if (mkdir(HostPath(dirname).c_str(), 0777) != 0) { return Fail((errno == EEXIST) ? F_ERR_DUPLICATED : F_ERR_INVALIDDIR); }
+    return F_NO_ERROR;
+}
+
+int f_rmdir(const char *dirname)
+{
+    if (rmdir(HostPath(dirname).c_str()) != 0) { return Fail((errno == ENOTEMPTY) ? F_ERR_NOTEMPTY : F_ERR_NOTFOUND); }
+    return F_NO_ERROR;
+}
+
+int f_delete(const char *filename)
+{
+    if (unlink(HostPath(filename).c_str()) != 0) { return Fail(F_ERR_NOTFOUND); }
+    return F_NO_ERROR;
+}
+
+int f_rename(const char *filename, const char *newname)
+{
+    // EFFS renames within the directory of the original file
+    std::string from = HostPath(filename);
+    std::string to = from.substr(0, from.rfind('/') + 1) + newname;
+    if (rename(from.c_str(), to.c_str()) != 0) { return Fail(F_ERR_NOTFOUND); }
+    return F_NO_ERROR;
+}
+
+static void FillFind(F_FIND *find, const char *name, const struct stat &st)
+{
+    snprintf(find->filename, sizeof(find->filename), "%s", name);
+    const char *dot = strrchr(name, '.');
+    if ((dot != nullptr) && (dot != name))
+    {
+        snprintf(find->name, sizeof(find->name), "%.*s", (int)(dot - name), name);
+        snprintf(find->ext, sizeof(find->ext), "%s", dot + 1);
+    }
+    else
+    {
+        snprintf(find->name, sizeof(find->name), "%s", name);
+        find->ext[0] = 0;
+    }
+    find->attr = S_ISDIR(st.st_mode) ? F_ATTR_DIR : F_ATTR_ARC;
+    find->filesize = S_ISDIR(st.st_mode) ? 0 : (long)st.st_size;
+    find->ctime = FatTime(st.st_mtime);
+    find->cdate = FatDate(st.st_mtime);
+}
+
+/**
+ * @brief Directory snapshots for f_findfirst()/f_findnext(). Searches may be abandoned before the
+ * last entry, and F_FIND has no destructor, so each task reuses a small ring of snapshots instead
+ * of holding directory handles open.
+ */
+#define FIND_SLOTS (8)
+
+struct FindSlot
+{
+    std::string dir;
+    std::vector<std::string> names;
+};
+
+static thread_local FindSlot FindSlots[FIND_SLOTS];
+static thread_local int FindNextSlot;
+
+int f_findnext(F_FIND *find)
+{
+    if ((find->slot < 0) || (find->slot >= FIND_SLOTS)) { return Fail(F_ERR_NOTFOUND); }
+    FindSlot &slot = FindSlots[find->slot];
+
+    while (find->pos < (int)slot.names.size())
+    {
+        const std::string &name = slot.names[find->pos++];
+        if (fnmatch(find->pattern, name.c_str(), FNM_CASEFOLD) != 0)
+        {
+            // "*.*" also matches names without a dot on FAT
+            if (strcmp(find->pattern, "*.*") != 0) { continue; }
+        }
+
+        struct stat st;
+        if (stat((slot.dir + "/" + name).c_str(), &st) != 0) { continue; }
+        FillFind(find, name.c_str(), st);
+        return F_NO_ERROR;
+    }
+
+    find->slot = -1;
+    return Fail(F_ERR_NOTFOUND);
+}
+
+int f_findfirst(const char *filename, F_FIND *find)
+{
+    memset(find, 0, sizeof(*find));
+    find->slot = -1;
+
+    // The pattern applies to the last component, anything before it is a directory
+    const char *slash = strrchr(filename, '/');
+    const char *bslash = strrchr(filename, '\\');
+    if ((slash == nullptr) || ((bslash != nullptr) && (bslash > slash))) { slash = bslash; }
+
+    std::string dir;
+    if (slash != nullptr)
+    {
+        dir = HostPath(std::string(filename, slash - filename + 1).c_str());
+        snprintf(find->pattern, sizeof(find->pattern), "%s", slash + 1);
+    }
+    else
+    {
+        dir = HostPath(".");
+        snprintf(find->pattern, sizeof(find->pattern), "%s", filename);
+    }
+
+    DIR *d = opendir(dir.c_str());
+    if (d == nullptr) { return Fail(F_ERR_INVALIDDIR); }
+
+    find->slot = FindNextSlot;
+    FindNextSlot = (FindNextSlot + 1) % FIND_SLOTS;
+    FindSlot &slot = FindSlots[find->slot];
+    slot.dir = dir;
+    slot.names.clear();
+
+    // EFFS reports "." and ".." everywhere but the root
+    bool atRoot = (dir == FsRoot);
+    while (struct dirent *e = readdir(d))
+    {
+        bool dots = (strcmp(e->d_name, ".") == 0) || (strcmp(e->d_name, "..") == 0);
+        if (atRoot && dots) { continue; }
+        slot.names.push_back(e->d_name);
+    }
+    closedir(d);
+
+    return f_findnext(find);
+}
+
+int f_stat(const char *filename, F_STAT *pstat)
+{
+    struct stat st;
+    if (stat(HostPath(filename).c_str(), &st) != 0) { return Fail(F_ERR_NOTFOUND); }
+    memset(pstat, 0, sizeof(*pstat));
+    pstat->filesize = S_ISDIR(st.st_mode) ? 0 : (long)st.st_size;
+    pstat->createdate = pstat->modifieddate = pstat->lastaccessdate = FatDate(st.st_mtime);
+    pstat->createtime = pstat->modifiedtime = FatTime(st.st_mtime);
+    pstat->attr = S_ISDIR(st.st_mode) ? F_ATTR_DIR : F_ATTR_ARC;
+    pstat->drivenum = MMC_DRV_NUM;
+    return F_NO_ERROR;
+}
+
+long f_filelength(const char *filename)
+{
+    struct stat st;
+    if (stat(HostPath(filename).c_str(), &st) != 0)
+    {
+        Fail(F_ERR_NOTFOUND);
+        return 0;
+    }
+    return (long)st.st_size;
+}
+
+int f_gettimedate(const char *filename, unsigned short *pctime, unsigned short *pcdate)
+{
+    struct stat st;
+    if (stat(HostPath(filename).c_str(), &st) != 0) { return Fail(F_ERR_NOTFOUND); }
+    *pctime = FatTime(st.st_mtime);
+    *pcdate = FatDate(st.st_mtime);
+    return F_NO_ERROR;
+}
+
+int f_settimedate(const char *filename, unsigned short ctime, unsigned short cdate)
+{
+    struct utimbuf t;
+    t.actime = t.modtime = FromFat(ctime, cdate);
+    if (utime(HostPath(filename).c_str(), &t) != 0) { return Fail(F_ERR_NOTFOUND); }
+    return F_NO_ERROR;
+}
+
+unsigned short f_gettime()
+{
+    return FatTime(time(nullptr));
+}
+
+unsigned short f_getdate()
+{
+    return FatDate(time(nullptr));
+}
+
+F_FILE *f_open(const char *filename, const char *mode)
+{
+    std::string host = HostPath(filename);
+    struct stat st;
+    if ((stat(host.c_str(), &st) == 0) && S_ISDIR(st.st_mode))
+    {
+        Fail(F_ERR_ACCESSDENIED);
+        return nullptr;
+    }
+
+    FILE *fp = fopen(host.c_str(), mode);
+    if (fp == nullptr)
+    {
+        Fail(F_ERR_NOTFOUND);
+        return nullptr;
+    }
+    F_FILE *f = new F_FILE;
+    f->fp = fp;
+    return f;
+}
+
+int f_close(F_FILE *f)
+{
+    if (f == nullptr) { return Fail(F_ERR_NOTOPEN); }
+    fclose(f->fp);
+    delete f;
+    return F_NO_ERROR;
+}
+
+long f_read(void *buf, long size, long size_st, F_FILE *f)
+{
+    if (f == nullptr) { return 0; }
+    return (long)fread(buf, size, size_st, f->fp);
+}
+
+long f_write(const void *buf, long size, long size_st, F_FILE *f)
+{
+    if (f == nullptr) { return 0; }
+    return (long)fwrite(buf, size, size_st, f->fp);
+}
+
+int f_eof(F_FILE *f)
+{
+    if (f == nullptr) { return 1; }
+    struct stat st;
+    fflush(f->fp);
+    if (fstat(fileno(f->fp), &st) != 0) { return 1; }
+    return ftell(f->fp) >= st.st_size;
+}
+
+int f_seek(F_FILE *f, long offset, long whence)
+{
+    int w = (whence == F_SEEK_CUR) ? SEEK_CUR : ((whence == F_SEEK_END) ? SEEK_END : SEEK_SET);
+    return (fseek(f->fp, offset, w) == 0) ? F_NO_ERROR : Fail(F_ERR_INVALIDPOS);
+}
+
+long f_tell(F_FILE *f)
+{
+    return ftell(f->fp);
+}
+
+int f_rewind(F_FILE *f)
+{
+    rewind(f->fp);
+    return F_NO_ERROR;
+}
+
+int f_flush(F_FILE *f)
+{
+    fflush(f->fp);
+    return F_NO_ERROR;
+}
+
+char *f_fgets(char *buffer, int len, F_FILE *f)
+{
+    return fgets(buffer, len, f->fp);
+}
+
+int f_fputs(const char *s, F_FILE *f)
+{
+    int n = fputs(s, f->fp);
+    return (n < 0) ? 0 : (int)strlen(s);
+}
+
+int f_fprintf(F_FILE *f, const char *format, ...)
+{
+    va_list ap;
+    va_start(ap, format);
+    int n = vfprintf(f->fp, format, ap);
+    va_end(ap);
+    return n;
+}
+
+int get_cd()
+{
+    struct stat st;
+    return ((stat(FsRoot.c_str(), &st) == 0) && S_ISDIR(st.st_mode)) ? 1 : 0;
+}
+
+int get_wp()
+{
+    return (access(FsRoot.c_str(), W_OK) == 0) ? 0 : 1;
+}
+
+int mmc_initfunc(unsigned long)
+{
+    return F_NO_ERROR;
+}
+
+int cfc_initfunc(unsigned long)
+{
+    return F_NO_ERROR;
+}
@@ -0,0 +1,374 @@
+/******************************************************************************
+* Host build support for the WebGL example: FTP server stand-in.
+*
+* Speaks enough of RFC 959 for command line clients and scripts (passive
+* mode only) and calls the application's FTPD_* functions for every file
+* system operation. Each control connection has its own thread, but the
+* callbacks are serialized as they are by the single NNDK FTP task, since
+* the application shares one transfer buffer between them.
+******************************************************************************/
+
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include "nbhost_internal.h"
+
+static std::mutex FtpCallbackLock;
+
+static void Reply(int fd, const char *text)
+{
+    std::string line = std::string(text) + "\r\n";
+    NbHostSendAll(fd, line.data(), (int)line.size());
+}
+
+static void ReportLine(int fd, const char *line)
+{
+    std::string s = std::string(line) + "\r\n";
+    NbHostSendAll(fd, s.data(), (int)s.size());
+}
+
+/**
+ * @brief Applies an FTP path argument to the current directory. The root directory is an empty
+ * string and others are absolute without a trailing '/', which is how the application's
+ * callbacks expect them.
+ */
+static std::string Resolve(const std::string &cwd, const std::string &arg)
+{
+    std::string all = (!arg.empty() && (arg[0] == '/')) ? arg : (cwd + "/" + arg);
+    std::string out;
+    std::string cur;
+    for (size_t i = 0; i <= all.size(); i++)
+    {
+        char c = (i < all.size()) ? all[i] : '/';
+        if (c != '/')
+        {
+            cur += c;
+            continue;
+        }
+        if (cur == "..")
+        {
+            size_t slash = out.rfind('/');
+            out = (slash == std::string::npos) ? std::string() : out.substr(0, slash);
+        }
+        else if (!cur.empty() && (cur != "."))
+        {
+            out = out.empty() ? cur : (out + "/" + cur);
+        }
+        cur.clear();
+    }
+    return out.empty() ? out : ("/" + out);
+}
+
+static void SplitPath(const std::string &path, std::string &dir, std::string &name)
+{
+    size_t slash = path.rfind('/');
+    dir = (slash == std::string::npos) ? std::string() : path.substr(0, slash);
+    name = (slash == std::string::npos) ? path : path.substr(slash + 1);
+}
+
+struct FtpSession
+{
+    int ctrl;
+    int pasv;   // Listening data socket after PASV/EPSV, or -1
+    void *session;
+    std::string cwd;
+    std::string user;
+    std::string renameFrom;
+};
+
+static int OpenPassive(FtpSession &s, bool extended)
+{
+    if (s.pasv >= 0) { ::close(s.pasv); }
+    s.pasv = NbHostListen(0);
+    if (s.pasv < 0) { return -1; }
+
+    struct sockaddr_in addr;
+    socklen_t alen = sizeof(addr);
+    getsockname(s.pasv, (struct sockaddr *)&addr, &alen);
+    int port = ntohs(addr.sin_port);
+
+    char text[128];
+    if (extended)
+    {
+        snprintf(text, sizeof(text), "229 Entering Extended Passive Mode (|||%d|)", port);
+    }
+    else
+    {
+        // Answer with the address the client reached us on
+        struct sockaddr_in local;
+        socklen_t llen = sizeof(local);
+        getsockname(s.ctrl, (struct sockaddr *)&local, &llen);
+        uint32_t ip = ntohl(local.sin_addr.s_addr);
+        snprintf(text, sizeof(text), "227 Entering Passive Mode (%u,%u,%u,%u,%d,%d)", (ip >> 24) & 0xFF,
+                 (ip >> 16) & 0xFF, (ip >> 8) & 0xFF, ip & 0xFF, port >> 8, port & 0xFF);
+    }
+    Reply(s.ctrl, text);
+    return 0;
+}
+
+static int AcceptData(FtpSession &s)
+{
+    if (s.pasv < 0)
+    {
+        Reply(s.ctrl, "425 Use PASV first");
+        return -1;
+    }
+    int fd = accept(s.pasv, nullptr, nullptr);
+    ::close(s.pasv);
+    s.pasv = -1;
+    if (fd < 0) { Reply(s.ctrl, "425 Can't open data connection"); }
+    return fd;
+}
+
+static void Command(FtpSession &s, const std::string &cmd, const std::string &arg)
+{
+    std::string dir, name;
+    char text[512];
+
+    if (cmd == "USER")
+    {
+        s.user = arg;
+        Reply(s.ctrl, "331 Password required");
+    }
+    else if (cmd == "PASS")
+    {
+        std::lock_guard<std::mutex> guard(FtpCallbackLock);
+        s.session = FTPDSessionStart(s.user.c_str(), arg.c_str(), 0);
+        Reply(s.ctrl, s.session ? "230 Logged in" : "530 Login incorrect");
+    }
+    else if (s.session == nullptr)
+    {
+        Reply(s.ctrl, "530 Not logged in");
+    }
+    else if (cmd == "SYST")
+    {
+        Reply(s.ctrl, "215 UNIX Type: L8");
+    }
+    else if ((cmd == "TYPE") || (cmd == "MODE") || (cmd == "STRU"))
+    {
+        Reply(s.ctrl, "200 OK");
+    }
+    else if ((cmd == "PWD") || (cmd == "XPWD"))
+    {
+        snprintf(text, sizeof(text), "257 \"%s\"", s.cwd.empty() ? "/" : s.cwd.c_str());
+        Reply(s.ctrl, text);
+    }
+    else if ((cmd == "CWD") || (cmd == "CDUP"))
+    {
+        std::string target = Resolve(s.cwd, (cmd == "CDUP") ? std::string("..") : arg);
+        std::lock_guard<std::mutex> guard(FtpCallbackLock);
+        if (FTPD_DirectoryExists(target.c_str(), s.session) == FTPD_OK)
+        {
+            s.cwd = target;
+            Reply(s.ctrl, "250 OK");
+        }
+        else
+        {
+            Reply(s.ctrl, "550 No such directory");
+        }
+    }
+    else if (cmd == "PASV")
+    {
+        if (OpenPassive(s, false) < 0) { Reply(s.ctrl, "425 Can't open passive socket"); }
+    }
+    else if (cmd == "EPSV")
+    {
+        if (OpenPassive(s, true) < 0) { Reply(s.ctrl, "425 Can't open passive socket"); }
+    }
+    else if ((cmd == "LIST") || (cmd == "NLST"))
+    {
+        // Options such as "-la" are ignored, a path lists that directory
+        std::string target = ((arg.empty() || (arg[0] == '-')) ? s.cwd : Resolve(s.cwd, arg));
+        int fd = AcceptData(s);
+        if (fd < 0) { return; }
+        Reply(s.ctrl, "150 Listing");
+        {
+            std::lock_guard<std::mutex> guard(FtpCallbackLock);
+            FTPD_ListSubDirectories(target.c_str(), s.session, ReportLine, fd);
+            FTPD_ListFile(target.c_str(), s.session, ReportLine, fd);
+        }
+        ::close(fd);
+        Reply(s.ctrl, "226 Done");
+    }
+    else if (cmd == "SIZE")
+    {
+        SplitPath(Resolve(s.cwd, arg), dir, name);
+        int size;
+        {
+            std::lock_guard<std::mutex> guard(FtpCallbackLock);
+            size = FTPD_GetFileSize(dir.c_str(), name.c_str());
+        }
+        if (size == FTPD_FILE_SIZE_NOSUCH_FILE) { Reply(s.ctrl, "550 No such file"); }
+        else
+        {
+            snprintf(text, sizeof(text), "213 %d", size);
+            Reply(s.ctrl, text);
+        }
+    }
+    else if (cmd == "RETR")
+    {
+        SplitPath(Resolve(s.cwd, arg), dir, name);
+        {
+            std::lock_guard<std::mutex> guard(FtpCallbackLock);
+            if (FTPD_FileExists(dir.c_str(), name.c_str(), s.session) != FTPD_OK)
+            {
+                Reply(s.ctrl, "550 No such file");
+                return;
+            }
+        }
+        int fd = AcceptData(s);
+        if (fd < 0) { return; }
+        Reply(s.ctrl, "150 Sending");
+        int rv;
+        {
+            std::lock_guard<std::mutex> guard(FtpCallbackLock);
+            rv = FTPD_SendFileToClient(dir.c_str(), name.c_str(), s.session, fd);
+        }
+        ::close(fd);
+        Reply(s.ctrl, (rv == FTPD_OK) ? "226 Transfer complete" : "451 Transfer failed");
+    }
+    else if (cmd == "STOR")
+    {
+        SplitPath(Resolve(s.cwd, arg), dir, name);
+        {
+            std::lock_guard<std::mutex> guard(FtpCallbackLock);
+            if (FTPD_AbleToCreateFile(dir.c_str(), name.c_str(), s.session) != FTPD_OK)
+            {
+                Reply(s.ctrl, "553 Can't create file");
+                return;
+            }
+        }
+        int fd = AcceptData(s);
+        if (fd < 0) { return; }
+        Reply(s.ctrl, "150 Receiving");
+        int rv;
+        {
+            std::lock_guard<std::mutex> guard(FtpCallbackLock);
+            rv = FTPD_GetFileFromClient(dir.c_str(), name.c_str(), s.session, fd);
+        }
+        ::close(fd);
+        Reply(s.ctrl, (rv == FTPD_OK) ? "226 Transfer complete" : "451 Transfer failed");
+    }
+    else if (cmd == "DELE")
+    {
+        SplitPath(Resolve(s.cwd, arg), dir, name);
+        std::lock_guard<std::mutex> guard(FtpCallbackLock);
+        Reply(s.ctrl, (FTPD_DeleteFile(dir.c_str(), name.c_str(), s.session) == FTPD_OK) ? "250 Deleted" : "550 Failed");
+    }
+    else if ((cmd == "MKD") || (cmd == "XMKD"))
+    {
+        SplitPath(Resolve(s.cwd, arg), dir, name);
+        std::lock_guard<std::mutex> guard(FtpCallbackLock);
+        Reply(s.ctrl, (FTPD_CreateSubDirectory(dir.c_str(), name.c_str(), s.session) == FTPD_OK) ? "257 Created" : "550 Failed");
+    }
+    else if ((cmd == "RMD") || (cmd == "XRMD"))
+    {
+        SplitPath(Resolve(s.cwd, arg), dir, name);
+        std::lock_guard<std::mutex> guard(FtpCallbackLock);
+        Reply(s.ctrl, (FTPD_DeleteSubDirectory(dir.c_str(), name.c_str(), s.session) == FTPD_OK) ? "250 Removed" : "550 Failed");
+    }
+    else if (cmd == "RNFR")
+    {
+        s.renameFrom = Resolve(s.cwd, arg);
+        Reply(s.ctrl, "350 Ready for RNTO");
+    }
+    else if (cmd == "RNTO")
+    {
+        std::string newDir, newName;
+        SplitPath(s.renameFrom, dir, name);
+        SplitPath(Resolve(s.cwd, arg), newDir, newName);
+        std::lock_guard<std::mutex> guard(FtpCallbackLock);
+        int rv = FTPD_Rename(dir.c_str(), name.c_str(), newName.c_str(), s.session);
+        Reply(s.ctrl, (rv == FTPD_OK) ? "250 Renamed" : "550 Failed");
+    }
+    else if (cmd == "NOOP")
+    {
+        Reply(s.ctrl, "200 OK");
+    }
+    else
+    {
+        Reply(s.ctrl, "502 Command not implemented");
+    }
+}
+
+static void FtpSessionThread(int ctrl)
+{
+    FtpSession s;
+    s.ctrl = ctrl;
+    s.pasv = -1;
+    s.session = nullptr;
+
+    // Replies are small and often back to back, keep Nagle from holding them for the peer's delayed ACK
+    int one = 1;
+    setsockopt(ctrl, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    Reply(ctrl, "220 NetBurner host FTP");
+
+    std::string pending;
+    char buf[1024];
+    while (1)
+    {
+        size_t eol = pending.find("\r\n");
+        if (eol == std::string::npos)
+        {
+            ssize_t n = recv(ctrl, buf, sizeof(buf), 0);
+            if (n <= 0) { break; }
+            pending.append(buf, n);
+            continue;
+        }
+
+        std::string line = pending.substr(0, eol);
+        pending.erase(0, eol + 2);
+        size_t sp = line.find(' ');
+        std::string cmd = line.substr(0, sp);
+        std::string arg = (sp == std::string::npos) ? std::string() : line.substr(sp + 1);
+        for (size_t i = 0; i < cmd.size(); i++) { cmd[i] = (char)toupper((unsigned char)cmd[i]); }
+
+        if (cmd == "QUIT")
+        {
+            Reply(ctrl, "221 Bye");
+            break;
+        }
+        Command(s, cmd, arg);
+    }
+
+    if (s.session != nullptr)
+    {
+        std::lock_guard<std::mutex> guard(FtpCallbackLock);
+        FTPDSessionEnd(s.session);
+    }
+    if (s.pasv >= 0) { ::close(s.pasv); }
+    ::close(ctrl);
+}
+
+static void FtpTask(void *pd)
+{
+    int port = (int)(intptr_t)pd;
+    int listener = NbHostListen(port);
+    if (listener < 0)
+    {
+        iprintf("FTP: unable to listen on port %d\r\n", port);
+        return;
+    }
+    iprintf("FTP listening on port %d\r\n", port);
+
+    while (1)
+    {
+        int ctrl = accept(listener, nullptr, nullptr);
+        if (ctrl < 0) { continue; }
+        std::thread(FtpSessionThread, ctrl).detach();
+    }
+}
+
+int FTPDStart(WORD port, BYTE server_priority)
+{
+    // The standard port means "whatever the host was told to use"
+    int p = (port == 21) ? NbHostFtpPort() : port;
+    OSTaskCreatewName(FtpTask, (void *)(intptr_t)p, nullptr, nullptr, server_priority, "FTPD");
+    return FTPD_OK;
+}
@@ -0,0 +1,341 @@
+/******************************************************************************
+* Host build support for the WebGL example: HTTP server stand-in.
+*
+* One task accepts connections and serves requests in turn, like the NNDK
+* server. GET requests go to the registered handler with the URL minus its
+* leading '/', and the connection is closed when the handler returns,
+* whatever it returns. Only an upgrade request, which goes to TheWSHandler,
+* can keep the socket open for the application, by returning 2. The default handler serves the html
+* directory in place of the compiled-in pages.
+******************************************************************************/
+
+#include <string>
+#include <thread>
+
+#include <netinet/in.h>
+
+#include "nbhost_internal.h"
+
+#define HTTP_RX_BUFFER_SIZE (4096)
+
+static std::string HtmlRoot = "../html";
+static int HttpPort = 8080;
+static int FtpPort = 2121;
+static IPADDR MulticastIf = 0;
+
+void NbHostSetHtmlRoot(const char *path)
+{
+    HtmlRoot = path;
+}
+
+void NbHostSetPorts(int httpPort, int ftpPort)
+{
+    HttpPort = httpPort;
+    FtpPort = ftpPort;
+}
+
+const char *NbHostHtmlRoot()
+{
+    return HtmlRoot.c_str();
+}
+
+int NbHostHttpPort()
+{
+    return HttpPort;
+}
+
+int NbHostFtpPort()
+{
+    return FtpPort;
+}
+
+void NbHostSetMulticastIf(const char *address)
+{
+    MulticastIf = AsciiToIp(address);
+}
+
+IPADDR NbHostMulticastIf()
+{
+    return MulticastIf;
+}
+
+/*-----------------------------------------------------------------------------
+ * Responses
+ *---------------------------------------------------------------------------*/
+int httpstricmp(const char *s1, const char *sisupper2)
+{
+    // Non-zero when s1 starts with sisupper2, ignoring case
+    while (*sisupper2)
+    {
+        if (toupper((unsigned char)*s1) != toupper((unsigned char)*sisupper2)) { return 0; }
+        s1++;
+        sisupper2++;
+    }
+    return 1;
+}
+
+void RedirectResponse(int sock, const char *new_page)
+{
+    char buffer[512];
+    snprintf(buffer, sizeof(buffer),
+             "HTTP/1.0 302 Found\r\n"
+             "Location: %s\r\n"
+             "Content-Length: 0\r\n\r\n",
+             new_page);
+    writestring(sock, buffer);
+}
+
+void NotFoundResponse(int sock, const char *new_page)
+{
+    char buffer[512];
+    snprintf(buffer, sizeof(buffer),
+             "HTTP/1.0 404 Not Found\r\n"
+             "Content-Type: text/html\r\n\r\n"
+             "<html><body><h1>404 Not Found</h1>%s</body></html>",
+             new_page);
+    writestring(sock, buffer);
+}
+
+static const char *MimeFor(const std::string &path)
+{
+    static const char *types[][2] = {{"html", "text/html"}, {"htm", "text/html"}, {"js", "application/javascript"},
+                                     {"css", "text/css"},   {"gif", "image/gif"},  {"jpg", "image/jpeg"},
+                                     {"png", "image/png"},  {"xml", "text/xml"},   {"gltf", "model/gltf+json"},
+                                     {"bin", "application/octet-stream"},          {"glb", "model/gltf-binary"}};
+    size_t dot = path.rfind('.');
+    if (dot == std::string::npos) { return "application/octet-stream"; }
+    std::string ext = path.substr(dot + 1);
+    for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); i++)
+    {
+        if (strcasecmp(ext.c_str(), types[i][0]) == 0) { return types[i][1]; }
+    }
+    return "application/octet-stream";
+}
+
+/**
+ * @brief Serves the html directory, standing in for the pages compiled into the image.
+ */
+static int DefaultGetHandler(int sock, PSTR url, PSTR rxBuffer)
+{
+    std::string name = url;
+    size_t q = name.find_first_of("?#");
+    if (q != std::string::npos) { name.erase(q); }
+    if (name.empty()) { name = "index.html"; }
+    if (name.find("..") != std::string::npos)
+    {
+        NotFoundResponse(sock, url);
+        return 0;
+    }
+
+    std::string path = HtmlRoot + "/" + name;
+    FILE *fp = fopen(path.c_str(), "rb");
+    if (fp == nullptr)
+    {
+        NotFoundResponse(sock, url);
+        return 0;
+    }
+
+    char buffer[8192];
+    snprintf(buffer, sizeof(buffer), "HTTP/1.0 200 OK\r\nContent-Type: %s\r\n\r\n", MimeFor(path));
+    writestring(sock, buffer);
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+    {
+        if (writeall(sock, buffer, (int)n) < 0) { break; }
+    }
+    fclose(fp);
+    return 0;
+}
+
+static http_gethandler *GetHandler = DefaultGetHandler;
+
+http_gethandler *SetNewGetHandler(http_gethandler *newhandler)
+{
+    http_gethandler *old = GetHandler;
+    GetHandler = newhandler;
+    return old;
+}
+
+/*-----------------------------------------------------------------------------
+ * WebSocket handshake
+ *---------------------------------------------------------------------------*/
+static uint32_t Rol(uint32_t v, int n)
+{
+    return (v << n) | (v >> (32 - n));
+}
+
+static void Sha1(const uint8_t *data, size_t len, uint8_t out[20])
+{
+    uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+    std::string msg((const char *)data, len);
+    msg += (char)0x80;
+    while ((msg.size() % 64) != 56) { msg += (char)0; }
+    uint64_t bits = (uint64_t)len * 8;
+    for (int i = 7; i >= 0; i--) { msg += (char)(bits >> (8 * i)); }
+
+    for (size_t chunk = 0; chunk < msg.size(); chunk += 64)
+    {
+        uint32_t w[80];
+        for (int i = 0; i < 16; i++)
+        {
+            const uint8_t *p = (const uint8_t *)msg.data() + chunk + 4 * i;
+            w[i] = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+        }
+        for (int i = 16; i < 80; i++) { w[i] = Rol(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1); }
+
+        uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+        for (int i = 0; i < 80; i++)
+        {
+            uint32_t f, k;
+            if (i < 20) { f = (b & c) | (~b & d), k = 0x5A827999; }
+            else if (i < 40) { f = b ^ c ^ d, k = 0x6ED9EBA1; }
+            else if (i < 60) { f = (b & c) | (b & d) | (c & d), k = 0x8F1BBCDC; }
+            else { f = b ^ c ^ d, k = 0xCA62C1D6; }
+            uint32_t t = Rol(a, 5) + f + e + k + w[i];
+            e = d;
+            d = c;
+            c = Rol(b, 30);
+            b = a;
+            a = t;
+        }
+        h[0] += a;
+        h[1] += b;
+        h[2] += c;
+        h[3] += d;
+        h[4] += e;
+    }
+    for (int i = 0; i < 20; i++) { out[i] = (uint8_t)(h[i / 4] >> (24 - 8 * (i % 4))); }
+}
+
+static std::string Base64(const uint8_t *data, size_t len)
+{
+    static const char tbl[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    for (size_t i = 0; i < len; i += 3)
+    {
+        uint32_t v = (uint32_t)data[i] << 16;
+        if (i + 1 < len) { v |= (uint32_t)data[i + 1] << 8; }
+        if (i + 2 < len) { v |= data[i + 2]; }
+        out += tbl[(v >> 18) & 0x3F];
+        out += tbl[(v >> 12) & 0x3F];
+        out += (i + 1 < len) ? tbl[(v >> 6) & 0x3F] : '=';
+        out += (i + 2 < len) ? tbl[v & 0x3F] : '=';
+    }
+    return out;
+}
+
+/**
+ * @brief Finds a request header value, ignoring case in the name.
+ */
+static std::string HeaderValue(const char *headers, const char *name)
+{
+    size_t nlen = strlen(name);
+    for (const char *line = headers; line && *line;)
+    {
+        if ((strncasecmp(line, name, nlen) == 0) && (line[nlen] == ':'))
+        {
+            const char *v = line + nlen + 1;
+            while (*v == ' ') { v++; }
+            const char *end = strpbrk(v, "\r\n");
+            return end ? std::string(v, end - v) : std::string(v);
+        }
+        line = strchr(line, '\n');
+        if (line) { line++; }
+    }
+    return std::string();
+}
+
+int WSUpgrade(HTTP_Request *req, int sock)
+{
+    std::string key = HeaderValue(req->pHeaders, "Sec-WebSocket-Key");
+    if (key.empty()) { return -1; }
+
+    key += "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+    uint8_t digest[20];
+    Sha1((const uint8_t *)key.data(), key.size(), digest);
+
+    std::string response = "HTTP/1.1 101 Switching Protocols\r\n"
+                           "Upgrade: websocket\r\n"
+                           "Connection: Upgrade\r\n"
+                           "Sec-WebSocket-Accept: " +
+                           Base64(digest, sizeof(digest)) + "\r\n\r\n";
+    if (NbHostSendAll(sock, response.data(), (int)response.size()) < 0) { return -1; }
+
+    return NbHostOpenWebSocket(sock);
+}
+
+/*-----------------------------------------------------------------------------
+ * Server task
+ *---------------------------------------------------------------------------*/
+static void ServeConnection(int sock)
+{
+    char rxBuffer[HTTP_RX_BUFFER_SIZE + 1];
+    int len = 0;
+    char *end = nullptr;
+    while (len < HTTP_RX_BUFFER_SIZE)
+    {
+        int n = ReadWithTimeout(sock, rxBuffer + len, HTTP_RX_BUFFER_SIZE - len, 5 * TICKS_PER_SECOND);
+        if (n <= 0) { break; }
+        len += n;
+        rxBuffer[len] = 0;
+        end = strstr(rxBuffer, "\r\n\r\n");
+        if (end) { break; }
+    }
+    if (end == nullptr)
+    {
+        ::close(sock);
+        return;
+    }
+
+    // Request line: METHOD /url HTTP/1.x
+    char *url = strchr(rxBuffer, ' ');
+    char *lineEnd = strstr(rxBuffer, "\r\n");
+    if ((url == nullptr) || (url > lineEnd))
+    {
+        ::close(sock);
+        return;
+    }
+    *url++ = 0;
+    while (*url == '/') { url++; }
+    char *urlEnd = strchr(url, ' ');
+    if ((urlEnd == nullptr) || (urlEnd > lineEnd)) { urlEnd = lineEnd; }
+
+    HTTP_Request req;
+    req.pHeaders = lineEnd + 2;
+
+    bool upgrade = strcasecmp(HeaderValue(req.pHeaders, "Upgrade").c_str(), "websocket") == 0;
+    *urlEnd = 0;
+
+    int rv = 0;
+    if (upgrade && (TheWSHandler != nullptr)) { rv = TheWSHandler(&req, sock, url, rxBuffer); }
+    else if (strcmp(rxBuffer, "GET") == 0) { GetHandler(sock, url, rxBuffer); }
+    else { NotFoundResponse(sock, url); }
+
+    if (rv != 2) { ::close(sock); }
+}
+
+static void HttpTask(void *pd)
+{
+    int port = (int)(intptr_t)pd;
+    int listener = NbHostListen(port);
+    if (listener < 0)
+    {
+        iprintf("HTTP: unable to listen on port %d\r\n", port);
+        return;
+    }
+    iprintf("HTTP listening on port %d\r\n", port);
+
+    while (1)
+    {
+        int sock = accept(listener, nullptr, nullptr);
+        if (sock < 0) { continue; }
+        ServeConnection(sock);
+    }
+}
+
+void StartHTTP(WORD port)
+{
+    // The default port means "whatever the host was told to use"
+    int p = (port == 80) ? HttpPort : port;
+    OSTaskCreatewName(HttpTask, (void *)(intptr_t)p, nullptr, nullptr, HTTP_PRIO, "HTTP");
+}
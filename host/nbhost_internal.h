@@ -0,0 +1,38 @@
+/******************************************************************************
+* Host build support for the WebGL example: shared internals of the stand-ins.
+******************************************************************************/
+
+#ifndef _NBHOST_INTERNAL_H_
+#define _NBHOST_INTERNAL_H_
+#pragma once
+
+#include "include/nbhost.h"
+
+// The stand-ins need the POSIX calls that nbhost.h renames
+#undef read
+#undef write
+#undef close
+#undef select
+#undef listen
+#undef accept
+#undef sendto
+
+#define NBHOST_WS_TEXT (0x01)
+
+// Returns a new WebSocket fd for a connected socket, or -1. Reads and writes on it carry frames,
+// and closing it closes the socket.
+int NbHostOpenWebSocket(int sock);
+
+// Sends or receives exactly n bytes on a plain socket, returns n or a negative value
+int NbHostSendAll(int fd, const void *buf, int n);
+int NbHostRecvAll(int fd, void *buf, int n);
+
+// Creates a listening TCP socket on port, or returns -1
+int NbHostListen(int port);
+
+const char *NbHostHtmlRoot();
+int NbHostHttpPort();
+int NbHostFtpPort();
+IPADDR NbHostMulticastIf();   // 0 for the routing table's choice
+
+#endif /* _NBHOST_INTERNAL_H_ */
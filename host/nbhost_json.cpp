@@ -0,0 +1,151 @@
+/******************************************************************************
+* Host build support for the WebGL example: JSON builder stand-in.
+******************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include "include/webclient/json_lexer.h"
+
+struct JsonNode
+{
+    std::string name;
+    std::string value;   // Literal text of a leaf
+    bool object;
+    JsonNode *parent;
+    std::vector<JsonNode *> children;
+};
+
+struct ParsedJsonDataSet::Impl
+{
+    JsonNode *root;
+    JsonNode *current;
+};
+
+static void FreeNode(JsonNode *node)
+{
+    for (size_t i = 0; i < node->children.size(); i++) { FreeNode(node->children[i]); }
+    delete node;
+}
+
+static JsonNode *NewNode(JsonNode *parent, const char *name, bool object)
+{
+    JsonNode *node = new JsonNode;
+    node->name = name ? name : "";
+    node->object = object;
+    node->parent = parent;
+    if (parent) { parent->children.push_back(node); }
+    return node;
+}
+
+static std::string Quote(const char *s)
+{
+    std::string out = "\"";
+    for (; *s; s++)
+    {
+        if ((*s == '"') || (*s == '\\')) { out += '\\'; }
+        out += *s;
+    }
+    return out + "\"";
+}
+
+static void PrintNode(const JsonNode *node, std::string &out, bool pretty, int depth)
+{
+    if (!node->object)
+    {
+        out += node->value;
+        return;
+    }
+    out += "{";
+    for (size_t i = 0; i < node->children.size(); i++)
+    {
+        if (i) { out += ","; }
+        if (pretty) { out += "\n" + std::string(2 * (depth + 1), ' '); }
+        out += Quote(node->children[i]->name.c_str());
+        out += pretty ? " : " : ":";
+        PrintNode(node->children[i], out, pretty, depth + 1);
+    }
+    if (pretty) { out += "\n" + std::string(2 * depth, ' '); }
+    out += "}";
+}
+
+ParsedJsonDataSet::ParsedJsonDataSet()
+{
+    m_impl = new Impl;
+    m_impl->root = nullptr;
+    m_impl->current = nullptr;
+}
+
+ParsedJsonDataSet::~ParsedJsonDataSet()
+{
+    if (m_impl->root) { FreeNode(m_impl->root); }
+    delete m_impl;
+}
+
+void ParsedJsonDataSet::StartBuilding()
+{
+    if (m_impl->root) { FreeNode(m_impl->root); }
+    m_impl->root = NewNode(nullptr, nullptr, true);
+    m_impl->current = m_impl->root;
+}
+
+void ParsedJsonDataSet::AddObjectStart(const char *name)
+{
+    m_impl->current = NewNode(m_impl->current, name, true);
+}
+
+void ParsedJsonDataSet::EndObject()
+{
+    if (m_impl->current->parent) { m_impl->current = m_impl->current->parent; }
+}
+
+void ParsedJsonDataSet::Add(const char *name, int i)
+{
+    NewNode(m_impl->current, name, false)->value = std::to_string(i);
+}
+
+void ParsedJsonDataSet::Add(const char *name, float f)
+{
+    Add(name, (double)f);
+}
+
+void ParsedJsonDataSet::Add(const char *name, double d)
+{
+    char text[32];
+    snprintf(text, sizeof(text), "%.6g", d);
+    NewNode(m_impl->current, name, false)->value = text;
+}
+
+void ParsedJsonDataSet::Add(const char *name, const char *str)
+{
+    NewNode(m_impl->current, name, false)->value = Quote(str);
+}
+
+void ParsedJsonDataSet::Add(const char *name, bool b)
+{
+    NewNode(m_impl->current, name, false)->value = b ? "true" : "false";
+}
+
+void ParsedJsonDataSet::DoneBuilding()
+{
+    m_impl->current = m_impl->root;
+}
+
+int ParsedJsonDataSet::PrintObjectToBuffer(char *buffer, int maxlen, bool pretty)
+{
+    if ((m_impl->root == nullptr) || (maxlen <= 0)) { return 0; }
+    std::string out;
+    PrintNode(m_impl->root, out, pretty, 0);
+    int n = ((int)out.size() < maxlen - 1) ? (int)out.size() : (maxlen - 1);
+    memcpy(buffer, out.data(), n);
+    buffer[n] = 0;
+    return n;
+}
+
+void ParsedJsonDataSet::PrintObject(bool pretty)
+{
+    if (m_impl->root == nullptr) { return; }
+    std::string out;
+    PrintNode(m_impl->root, out, pretty, 0);
+    printf("%s\n", out.c_str());
+}
@@ -0,0 +1,467 @@
+/******************************************************************************
+* Host build support for the WebGL example: NNDK I/O system stand-ins.
+*
+* File descriptors are POSIX sockets, except WebSockets. As on NNDK,
+* WSUpgrade() returns a new fd of its own, from a range just below
+* FD_SETSIZE, and TCP calls such as TcpGetTxBufferAvailSpace() do not work
+* on it. Each write() to it is sent on the socket as one unmasked frame, and
+* read() returns the unmasked payload of incoming frames, answering pings
+* and reporting a close frame as end of stream.
+******************************************************************************/
+
+#include <mutex>
+
+#include <arpa/inet.h>
+#include <linux/sockios.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/ioctl.h>
+
+#include "nbhost_internal.h"
+
+#define TCP_SEGMENT_SIZE (1460)   // Per NNDK buffer, used to size SO_SNDBUF/SO_RCVBUF
+#define WS_FDS (64)
+#define WS_FD_BASE (FD_SETSIZE - WS_FDS)   // Sockets are assumed to stay below this
+
+struct WsState
+{
+    bool open;
+    int sock;
+    int options;
+    uint64_t remaining;   // Payload bytes left in the current incoming frame
+    uint8_t mask[4];
+    int maskPos;
+};
+
+static WsState WsStates[WS_FDS];
+static std::mutex WsWriteLock[WS_FDS];   // Keeps frames from different tasks whole
+static std::mutex WsOpenLock;
+
+static WsState *WsFor(int fd)
+{
+    if ((fd < WS_FD_BASE) || (fd >= WS_FD_BASE + WS_FDS) || !WsStates[fd - WS_FD_BASE].open) { return nullptr; }
+    return &WsStates[fd - WS_FD_BASE];
+}
+
+/**
+ * @brief Returns the socket an fd reads and writes through: the fd itself, or a WebSocket's socket
+ */
+static int SocketFor(int fd)
+{
+    WsState *s = WsFor(fd);
+    return (s != nullptr) ? s->sock : fd;
+}
+
+int NbHostOpenWebSocket(int sock)
+{
+    std::lock_guard<std::mutex> guard(WsOpenLock);
+    for (int i = 0; i < WS_FDS; i++)
+    {
+        if (WsStates[i].open) { continue; }
+        memset(&WsStates[i], 0, sizeof(WsStates[i]));
+        WsStates[i].sock = sock;
+        WsStates[i].open = true;
+        return WS_FD_BASE + i;
+    }
+    return -1;
+}
+
+int NbHostSendAll(int fd, const void *buf, int n)
+{
+    const char *p = (const char *)buf;
+    int sent = 0;
+    while (sent < n)
+    {
+        ssize_t rv = send(fd, p + sent, n - sent, MSG_NOSIGNAL);
+        if (rv < 0)
+        {
+            if (errno == EINTR) { continue; }
+            return TCP_ERR_CLOSING;
+        }
+        sent += (int)rv;
+    }
+    return n;
+}
+
+int NbHostRecvAll(int fd, void *buf, int n)
+{
+    char *p = (char *)buf;
+    int got = 0;
+    while (got < n)
+    {
+        ssize_t rv = recv(fd, p + got, n - got, 0);
+        if (rv == 0) { return 0; }
+        if (rv < 0)
+        {
+            if (errno == EINTR) { continue; }
+            return TCP_ERR_CLOSING;
+        }
+        got += (int)rv;
+    }
+    return n;
+}
+
+int NbHostListen(int port)
+{
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) { return -1; }
+
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons((uint16_t)port);
+    if ((bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) || (listen(fd, 16) != 0))
+    {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int NbListen(IPADDR addr, WORD port, BYTE maxpend)
+{
+    return NbHostListen(port);
+}
+
+int NbAccept(int listening_socket, IPADDR *address, WORD *port, WORD timeout)
+{
+    struct pollfd p = {listening_socket, POLLIN, 0};
+    int ms = (timeout == 0) ? -1 : (int)(timeout * (1000 / TICKS_PER_SECOND));
+    if (poll(&p, 1, ms) <= 0) { return TCP_ERR_TIMEOUT; }
+
+    struct sockaddr_in from;
+    socklen_t len = sizeof(from);
+    int fd = accept(listening_socket, (struct sockaddr *)&from, &len);
+    if (fd < 0) { return TCP_ERR_CLOSING; }
+    if (address != nullptr) { *address = ntohl(from.sin_addr.s_addr); }
+    if (port != nullptr) { *port = ntohs(from.sin_port); }
+    return fd;
+}
+
+IPADDR AsciiToIp(const char *p)
+{
+    struct in_addr a;
+    return (inet_aton(p, &a) != 0) ? ntohl(a.s_addr) : 0;
+}
+
+int CreateTxUdpSocket(IPADDR send_to_addr, WORD remote_port, WORD local_port)
+{
+    // The local port is left to the host, so a receiver on this machine can bind it
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) { return -1; }
+
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_BROADCAST, &one, sizeof(one));
+    unsigned char loop = 1;
+    setsockopt(fd, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop));
+    if (NbHostMulticastIf() != 0)
+    {
+        struct in_addr iface;
+        iface.s_addr = htonl(NbHostMulticastIf());
+        setsockopt(fd, IPPROTO_IP, IP_MULTICAST_IF, &iface, sizeof(iface));
+    }
+    return fd;
+}
+
+int NbSendTo(int sock, PBYTE what_to_send, int len_to_send, IPADDR to_addr, WORD remote_port)
+{
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(to_addr);
+    addr.sin_port = htons(remote_port);
+    ssize_t rv = sendto(sock, what_to_send, len_to_send, MSG_NOSIGNAL, (struct sockaddr *)&addr, sizeof(addr));
+    return (rv < 0) ? -1 : (int)rv;
+}
+
+static int WsSendFrame(WsState *s, int opcode, const char *buf, int nbytes)
+{
+    uint8_t hdr[10];
+    int hlen;
+    hdr[0] = (uint8_t)(0x80 | opcode);
+    if (nbytes < 126)
+    {
+        hdr[1] = (uint8_t)nbytes;
+        hlen = 2;
+    }
+    else if (nbytes <= 0xFFFF)
+    {
+        hdr[1] = 126;
+        hdr[2] = (uint8_t)(nbytes >> 8);
+        hdr[3] = (uint8_t)nbytes;
+        hlen = 4;
+    }
+    else
+    {
+        hdr[1] = 127;
+        for (int i = 0; i < 8; i++)
+        {
+            hdr[2 + i] = (uint8_t)((uint64_t)nbytes >> (56 - 8 * i));
+        }
+        hlen = 10;
+    }
+
+    std::lock_guard<std::mutex> guard(WsWriteLock[s - WsStates]);
+    if (NbHostSendAll(s->sock, hdr, hlen) < 0) { return TCP_ERR_CLOSING; }
+    if ((nbytes > 0) && (NbHostSendAll(s->sock, buf, nbytes) < 0)) { return TCP_ERR_CLOSING; }
+    return nbytes;
+}
+
+/**
+ * @brief Reads frame headers until a data frame with payload is current. Control frames are
+ * handled here. Returns 1 when payload is available, 0 at close, negative on error.
+ */
+static int WsNextFrame(WsState *s)
+{
+    while (s->remaining == 0)
+    {
+        uint8_t hdr[2];
+        int rv = NbHostRecvAll(s->sock, hdr, 2);
+        if (rv <= 0) { return rv; }
+
+        int opcode = hdr[0] & 0x0F;
+        uint64_t len = hdr[1] & 0x7F;
+        if (len == 126)
+        {
+            uint8_t ext[2];
+            if (NbHostRecvAll(s->sock, ext, 2) <= 0) { return TCP_ERR_CLOSING; }
+            len = ((uint64_t)ext[0] << 8) | ext[1];
+        }
+        else if (len == 127)
+        {
+            uint8_t ext[8];
+            if (NbHostRecvAll(s->sock, ext, 8) <= 0) { return TCP_ERR_CLOSING; }
+            len = 0;
+            for (int i = 0; i < 8; i++) { len = (len << 8) | ext[i]; }
+        }
+
+        if (hdr[1] & 0x80)
+        {
+            if (NbHostRecvAll(s->sock, s->mask, 4) <= 0) { return TCP_ERR_CLOSING; }
+        }
+        else
+        {
+            memset(s->mask, 0, sizeof(s->mask));
+        }
+        s->maskPos = 0;
+
+        if (opcode >= 0x8)
+        {
+            // Control frames are at most 125 bytes
+            char payload[125];
+            if ((len > sizeof(payload)) || ((len > 0) && (NbHostRecvAll(s->sock, payload, (int)len) <= 0)))
+            {
+                return TCP_ERR_CLOSING;
+            }
+            for (uint64_t i = 0; i < len; i++) { payload[i] ^= s->mask[i & 3]; }
+
+            if (opcode == 0x8)
+            {
+                WsSendFrame(s, 0x8, payload, (int)len);
+                return 0;
+            }
+            if (opcode == 0x9) { WsSendFrame(s, 0xA, payload, (int)len); }
+            continue;
+        }
+
+        s->remaining = len;
+    }
+    return 1;
+}
+
+int NbRead(int fd, char *buf, int nbytes)
+{
+    WsState *s = WsFor(fd);
+    if (s == nullptr)
+    {
+        ssize_t rv;
+        do
+        {
+            rv = recv(fd, buf, nbytes, 0);
+        } while ((rv < 0) && (errno == EINTR));
+        return (rv <= 0) ? TCP_ERR_CLOSING : (int)rv;
+    }
+
+    if (WsNextFrame(s) <= 0) { return TCP_ERR_CLOSING; }
+
+    int n = (s->remaining < (uint64_t)nbytes) ? (int)s->remaining : nbytes;
+    ssize_t got = recv(s->sock, buf, n, 0);
+    if (got <= 0) { return TCP_ERR_CLOSING; }
+    for (ssize_t i = 0; i < got; i++)
+    {
+        buf[i] ^= s->mask[s->maskPos];
+        s->maskPos = (s->maskPos + 1) & 3;
+    }
+    s->remaining -= got;
+    return (int)got;
+}
+
+int NbWrite(int fd, const char *buf, int nbytes)
+{
+    WsState *s = WsFor(fd);
+    if (s != nullptr) { return WsSendFrame(s, (s->options & NBHOST_WS_TEXT) ? 0x1 : 0x2, buf, nbytes); }
+
+    ssize_t rv;
+    do
+    {
+        rv = send(fd, buf, nbytes, MSG_NOSIGNAL);
+    } while ((rv < 0) && (errno == EINTR));
+    return (rv < 0) ? TCP_ERR_CLOSING : (int)rv;
+}
+
+int NbClose(int fd)
+{
+    WsState *s = WsFor(fd);
+    if (s != nullptr)
+    {
+        WsSendFrame(s, 0x8, nullptr, 0);
+        int sock = s->sock;
+        std::lock_guard<std::mutex> guard(WsOpenLock);
+        s->open = false;
+        return ::close(sock);
+    }
+    return ::close(fd);
+}
+
+int NbSelect(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds, DWORD timeout)
+{
+    struct timeval tv;
+    struct timeval *ptv = nullptr;
+    if (timeout != 0)
+    {
+        tv.tv_sec = timeout / TICKS_PER_SECOND;
+        tv.tv_usec = (timeout % TICKS_PER_SECOND) * (1000000 / TICKS_PER_SECOND);
+        ptv = &tv;
+    }
+
+    // WebSocket fds are watched through their sockets, and reported back as themselves
+    fd_set *sets[3] = {readfds, writefds, errorfds};
+    fd_set socks[3];
+    int maxSock = -1;
+    for (int k = 0; k < 3; k++)
+    {
+        if (sets[k] == nullptr) { continue; }
+        FD_ZERO(&socks[k]);
+        for (int fd = 0; fd < nfds; fd++)
+        {
+            if (!FD_ISSET(fd, sets[k])) { continue; }
+            int sock = SocketFor(fd);
+            FD_SET(sock, &socks[k]);
+            if (sock > maxSock) { maxSock = sock; }
+        }
+    }
+
+    int rv = ::select(maxSock + 1, readfds ? &socks[0] : nullptr, writefds ? &socks[1] : nullptr,
+                      errorfds ? &socks[2] : nullptr, ptv);
+    if (rv <= 0) { return 0; }
+
+    int ready = 0;
+    for (int k = 0; k < 3; k++)
+    {
+        if (sets[k] == nullptr) { continue; }
+        for (int fd = 0; fd < nfds; fd++)
+        {
+            if (!FD_ISSET(fd, sets[k])) { continue; }
+            if (FD_ISSET(SocketFor(fd), &socks[k])) { ready++; }
+            else { FD_CLR(fd, sets[k]); }
+        }
+    }
+    return ready;
+}
+
+int writeall(int fd, const char *buf, int nbytes)
+{
+    // A WebSocket write is always sent whole as one frame
+    if (WsFor(fd) != nullptr) { return NbWrite(fd, buf, nbytes); }
+    return NbHostSendAll(fd, buf, nbytes);
+}
+
+int writestring(int fd, const char *str)
+{
+    return writeall(fd, str, (int)strlen(str));
+}
+
+int ReadWithTimeout(int fd, char *buf, int nbytes, DWORD timeout)
+{
+    // Data already buffered in a WebSocket frame is not visible to poll()
+    WsState *s = WsFor(fd);
+    if ((s == nullptr) || (s->remaining == 0))
+    {
+        struct pollfd p = {SocketFor(fd), POLLIN, 0};
+        int ms = (timeout == 0) ? -1 : (int)(timeout * (1000 / TICKS_PER_SECOND));
+        int rv = poll(&p, 1, ms);
+        if (rv == 0) { return 0; }
+        if (rv < 0) { return TCP_ERR_CLOSING; }
+    }
+    return NbRead(fd, buf, nbytes);
+}
+
+int dataavail(int fd)
+{
+    WsState *s = WsFor(fd);
+    if ((s != nullptr) && (s->remaining > 0)) { return 1; }
+
+    struct pollfd p = {SocketFor(fd), POLLIN, 0};
+    return (poll(&p, 1, 0) > 0) ? 1 : 0;
+}
+
+int TcpGetTxBufferAvailSpace(int fd)
+{
+    // Not a TCP socket, as on NNDK; ask about the socket under it
+    if (WsFor(fd) != nullptr) { return 0; }
+
+    int sndbuf = 0;
+    socklen_t len = sizeof(sndbuf);
+    int queued = 0;
+    if ((getsockopt(fd, SOL_SOCKET, SO_SNDBUF, &sndbuf, &len) != 0) || (ioctl(fd, SIOCOUTQ, &queued) != 0))
+    {
+        return 0;
+    }
+    // Linux reports twice the requested SO_SNDBUF to account for its bookkeeping
+    int space = (sndbuf / 2) - queued;
+    return (space > 0) ? space : 0;
+}
+
+// Like NNDK, only says whether some data can be written; ask TcpGetTxBufferAvailSpace() how much
+int writeavail(int fd)
+{
+    return (TcpGetTxBufferAvailSpace(fd) > 0) ? 1 : 0;
+}
+
+void SetSocketTxBuffers(int fd, int n)
+{
+    int size = n * TCP_SEGMENT_SIZE;
+    setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+}
+
+void SetSocketRxBuffers(int fd, int n)
+{
+    int size = n * TCP_SEGMENT_SIZE;
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+}
+
+namespace NB
+{
+namespace WebSocket
+{
+int ws_setoption(int fd, int option)
+{
+    WsState *s = WsFor(fd);
+    if (s == nullptr) { return -1; }
+    s->options |= option;
+    return s->options;
+}
+
+int ws_clroption(int fd, int option)
+{
+    WsState *s = WsFor(fd);
+    if (s == nullptr) { return -1; }
+    s->options &= ~option;
+    return s->options;
+}
+}   // namespace WebSocket
+}   // namespace NB
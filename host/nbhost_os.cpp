@@ -0,0 +1,223 @@
+/******************************************************************************
+* Host build support for the WebGL example: RTOS stand-ins and entry point.
+*
+* Tasks are threads, ticks run at TICKS_PER_SECOND from a ticker thread, and
+* semaphores and critical sections map onto the C++ standard library. Task
+* priorities are ignored.
+******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "include/nbhost.h"
+
+volatile DWORD TimeTick = 0;
+volatile DWORD Secs = 0;
+
+static std::atomic<int> NextTaskId(1);
+static thread_local int TaskId = 0;
+static thread_local const char *TaskName = nullptr;
+static std::recursive_mutex LockMutex;
+
+struct SemImpl
+{
+    std::mutex m;
+    std::condition_variable cv;
+    long count;
+};
+
+/**
+ * @brief Advances TimeTick and Secs from the monotonic clock.
+ */
+static void TickerThread()
+{
+    auto start = std::chrono::steady_clock::now();
+    auto tick = std::chrono::microseconds(1000000 / TICKS_PER_SECOND);
+    for (DWORD n = 1;; n++)
+    {
+        std::this_thread::sleep_until(start + tick * n);
+        TimeTick = n;
+        Secs = n / TICKS_PER_SECOND;
+    }
+}
+
+static void RunTask(void (*task)(void *), void *data, const char *name)
+{
+    TaskId = NextTaskId++;
+    TaskName = name;
+    task(data);
+}
+
+BYTE OSTaskCreatewName(void (*task)(void *), void *data, void *, void *, BYTE, const char *name)
+{
+    std::thread(RunTask, task, data, name).detach();
+    return OS_NO_ERR;
+}
+
+BYTE OSTaskCreate(void (*task)(void *), void *data, void *pstktop, void *pstkbot, BYTE prio)
+{
+    return OSTaskCreatewName(task, data, pstktop, pstkbot, prio, nullptr);
+}
+
+BYTE OSChangePrio(BYTE)
+{
+    return OS_NO_ERR;
+}
+
+void OSTimeDly(WORD ticks)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds((1000000 / TICKS_PER_SECOND) * (ticks ? ticks : 1)));
+}
+
+DWORD OSTimeGet()
+{
+    return TimeTick;
+}
+
+const char *OSTaskName()
+{
+    return TaskName;
+}
+
+int OSTaskID()
+{
+    return TaskId;
+}
+
+void OSLock()
+{
+    LockMutex.lock();
+}
+
+void OSUnlock()
+{
+    LockMutex.unlock();
+}
+
+BYTE OSSemInit(OS_SEM *psem, long value)
+{
+    SemImpl *s = new SemImpl;
+    s->count = value;
+    psem->impl = s;
+    return OS_NO_ERR;
+}
+
+BYTE OSSemPost(OS_SEM *psem)
+{
+    SemImpl *s = (SemImpl *)psem->impl;
+    {
+        std::lock_guard<std::mutex> lock(s->m);
+        s->count++;
+    }
+    s->cv.notify_one();
+    return OS_NO_ERR;
+}
+
+BYTE OSSemPend(OS_SEM *psem, WORD timeout)
+{
+    SemImpl *s = (SemImpl *)psem->impl;
+    std::unique_lock<std::mutex> lock(s->m);
+    if (timeout == 0) { s->cv.wait(lock, [s] { return s->count > 0; }); }
+    else if (!s->cv.wait_for(lock, std::chrono::microseconds((1000000 / TICKS_PER_SECOND) * timeout),
+                             [s] { return s->count > 0; }))
+    {
+        return OS_TIMEOUT;
+    }
+    s->count--;
+    return OS_NO_ERR;
+}
+
+BYTE OSSemPendNoWait(OS_SEM *psem)
+{
+    SemImpl *s = (SemImpl *)psem->impl;
+    std::lock_guard<std::mutex> lock(s->m);
+    if (s->count <= 0) { return OS_TIMEOUT; }
+    s->count--;
+    return OS_NO_ERR;
+}
+
+BYTE OSCritInit(OS_CRIT *pCrit)
+{
+    pCrit->impl = new std::recursive_timed_mutex;
+    return OS_NO_ERR;
+}
+
+BYTE OSCritEnter(OS_CRIT *pCrit, WORD timeout)
+{
+    std::recursive_timed_mutex *m = (std::recursive_timed_mutex *)pCrit->impl;
+    if (timeout == 0)
+    {
+        m->lock();
+        return OS_NO_ERR;
+    }
+    return m->try_lock_for(std::chrono::microseconds((1000000 / TICKS_PER_SECOND) * timeout)) ? OS_NO_ERR : OS_TIMEOUT;
+}
+
+BYTE OSCritEnterNoWait(OS_CRIT *pCrit)
+{
+    return ((std::recursive_timed_mutex *)pCrit->impl)->try_lock() ? OS_NO_ERR : OS_TIMEOUT;
+}
+
+BYTE OSCritLeave(OS_CRIT *pCrit)
+{
+    ((std::recursive_timed_mutex *)pCrit->impl)->unlock();
+    return OS_NO_ERR;
+}
+
+void init()
+{
+    iprintf("Host build: %d ticks per second\r\n", TICKS_PER_SECOND);
+}
+
+int charavail()
+{
+    struct pollfd p = {STDIN_FILENO, POLLIN, 0};
+    return poll(&p, 1, 0) > 0;
+}
+
+/**
+ * @brief Starts the tick thread for programs that provide their own main().
+ */
+void NbHostStartTicker()
+{
+    static std::once_flag once;
+    std::call_once(once, [] { std::thread(TickerThread).detach(); });
+}
+
+static double MonotonicSeconds()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+HiResTimer *HiResTimer::getHiResTimer(int timer)
+{
+    static HiResTimer timers[4];
+    if ((timer < 0) || (timer >= 4)) { return nullptr; }
+    return &timers[timer];
+}
+
+void HiResTimer::init(double)
+{
+    m_startSeconds = MonotonicSeconds();
+}
+
+void HiResTimer::start()
+{
+    m_startSeconds = MonotonicSeconds();
+}
+
+void HiResTimer::stop() {}
+
+double HiResTimer::readTime()
+{
+    return MonotonicSeconds() - m_startSeconds;
+}
+
+void HiResTimer::delay(double seconds)
+{
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+}
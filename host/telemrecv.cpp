@@ -0,0 +1,232 @@
+/******************************************************************************
+* Host build support for the WebGL example: multicast telemetry receiver.
+*
+* Joins the group the device publishes binary telemetry frames to (see
+* multicast.h) and reports the running totals once a second, one JSON
+* object per line, and once more when it stops. Loss is
+* found from gaps in each object's frame counter, so the numbers hold even
+* with several devices' worth of objects in one group:
+*
+*   datagrams, frames   received
+*   lost                frames missing from an object's sequence
+*   late                frames older than one already seen, reordered or repeated
+*   resyncs             counters that went back and then kept counting up for
+*                       RESYNC_RUN frames, taken as the device restarting
+*   bad                 datagrams that are not whole binary frames
+*
+*   telemrecv --group 239.255.0.42 --port 5042 --interface 127.0.0.1
+******************************************************************************/
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../multicast.h"
+#include "../telemetry.h"
+
+// The application headers pull in the NNDK stand-ins, which rename close()
+#undef close
+
+#define MAX_OBJECTS (256)   // Every value of the frame's object byte
+#define RESYNC_RUN (3)      // Late frames in sequence that mean a restart
+
+struct Totals
+{
+    unsigned long datagrams;
+    unsigned long frames;
+    unsigned long lost;
+    unsigned long late;
+    unsigned long resyncs;
+    unsigned long bad;
+};
+
+static uint32_t LastSeq[MAX_OBJECTS];
+static bool Seen[MAX_OBJECTS];
+static uint32_t LateSeq[MAX_OBJECTS];   // The last late frame, and how many led up to it in sequence
+static int LateRun[MAX_OBJECTS];
+
+static uint32_t GetU32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static int16_t GetI16(const uint8_t *p)
+{
+    return (int16_t)(uint16_t)(p[0] | (p[1] << 8));
+}
+
+static double NowSeconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Checks one frame's counter against the last one seen for its object.
+ */
+static void CountFrame(const uint8_t *f, Totals &t, bool verbose)
+{
+    int object = f[2];
+    uint32_t seq = GetU32(f + 4);
+    if (Seen[object])
+    {
+        int32_t step = (int32_t)(seq - LastSeq[object]);
+        if (step <= 0)
+        {
+            LateRun[object] = ((LateRun[object] > 0) && (seq == LateSeq[object] + 1)) ? LateRun[object] + 1 : 1;
+            LateSeq[object] = seq;
+            t.late++;
+            if (LateRun[object] < RESYNC_RUN) { return; }
+
+            // The device restarted: those frames were not late after all
+            t.late -= RESYNC_RUN;
+            t.frames += RESYNC_RUN - 1;
+            t.resyncs++;
+        }
+        else { t.lost += step - 1; }
+        LateRun[object] = 0;
+    }
+    Seen[object] = true;
+    LastSeq[object] = seq;
+    t.frames++;
+
+    if (verbose)
+    {
+        printf("object %d seq %lu t %lu pos %.4f %.4f %.4f\n", object, (unsigned long)seq,
+               (unsigned long)GetU32(f + 8), GetI16(f + 12) / TELEMETRY_POS_SCALE, GetI16(f + 14) / TELEMETRY_POS_SCALE,
+               GetI16(f + 16) / TELEMETRY_POS_SCALE);
+    }
+}
+
+static void Report(const char *kind, const Totals &t)
+{
+    int objects = 0;
+    for (int i = 0; i < MAX_OBJECTS; i++)
+    {
+        if (Seen[i]) { objects++; }
+    }
+    printf("{\"report\":\"%s\",\"datagrams\":%lu,\"frames\":%lu,\"objects\":%d,\"lost\":%lu,\"late\":%lu,\"resyncs\":%lu,"
+           "\"bad\":%lu}\n",
+           kind, t.datagrams, t.frames, objects, t.lost, t.late, t.resyncs, t.bad);
+    fflush(stdout);
+}
+
+static void Usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --group ADDR      multicast group, or a broadcast address (default 239.255.0.42)\n"
+            "  --port N          (default %d)\n"
+            "  --interface ADDR  local interface to join on (default: the one the routing table picks)\n"
+            "  --seconds N       stop after N seconds (default: run until interrupted)\n"
+            "  --verbose         print every frame\n",
+            argv0, MULTICAST_PORT);
+}
+
+int main(int argc, char **argv)
+{
+    const char *group = "239.255.0.42";
+    const char *iface = "0.0.0.0";
+    int port = MULTICAST_PORT;
+    double seconds = 0;
+    bool verbose = false;
+    for (int i = 1; i < argc; i++)
+    {
+        bool more = (i + 1 < argc);
+        if ((strcmp(argv[i], "--group") == 0) && more) { group = argv[++i]; }
+        else if ((strcmp(argv[i], "--port") == 0) && more) { port = atoi(argv[++i]); }
+        else if ((strcmp(argv[i], "--interface") == 0) && more) { iface = argv[++i]; }
+        else if ((strcmp(argv[i], "--seconds") == 0) && more) { seconds = atof(argv[++i]); }
+        else if (strcmp(argv[i], "--verbose") == 0) { verbose = true; }
+        else
+        {
+            Usage(argv[0]);
+            return 1;
+        }
+    }
+
+    struct in_addr groupAddr, ifaceAddr;
+    if ((inet_aton(group, &groupAddr) == 0) || (inet_aton(iface, &ifaceAddr) == 0))
+    {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    // Bound to the port on any address, so broadcast datagrams arrive as well
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons((uint16_t)port);
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+    {
+        perror("bind");
+        return 1;
+    }
+
+    if (IN_MULTICAST(ntohl(groupAddr.s_addr)))
+    {
+        struct ip_mreq mreq;
+        mreq.imr_multiaddr = groupAddr;
+        mreq.imr_interface = ifaceAddr;
+        if (setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) != 0)
+        {
+            perror("IP_ADD_MEMBERSHIP");
+            return 1;
+        }
+    }
+    fprintf(stderr, "listening for %s port %d\n", group, port);
+
+    Totals total;
+    memset(&total, 0, sizeof(total));
+    double start = NowSeconds();
+    double nextReport = start + 1;
+    while ((seconds <= 0) || (NowSeconds() - start < seconds))
+    {
+        struct pollfd p = {fd, POLLIN, 0};
+        if (poll(&p, 1, 100) > 0)
+        {
+            uint8_t buf[MULTICAST_BATCH_MAX * TELEMETRY_BINARY_SIZE + 1];
+            ssize_t n = recv(fd, buf, sizeof(buf), 0);
+            if (n <= 0) { continue; }
+
+            total.datagrams++;
+            if ((n % TELEMETRY_BINARY_SIZE) != 0)
+            {
+                total.bad++;
+                continue;
+            }
+            for (ssize_t off = 0; off < n; off += TELEMETRY_BINARY_SIZE)
+            {
+                if ((buf[off] != TELEMETRY_MAGIC) || (buf[off + 1] != TELEMETRY_VERSION))
+                {
+                    total.bad++;
+                    break;
+                }
+                CountFrame(buf + off, total, verbose);
+            }
+        }
+
+        if (NowSeconds() >= nextReport)
+        {
+            Report("running", total);
+            nextReport += 1;
+        }
+    }
+
+    Report("final", total);
+    close(fd);
+    return 0;
+}
@@ -0,0 +1,120 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+/**
+ * Ring buffer backend for the logging macros in log.h.
+ */
+
+// NB Libs
+#include <constants.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <ucos.h>
+
+#include "log.h"
+
+#define LOG_DRAIN_CHUNK (256)
+
+static char LogRing[LOG_RING_SIZE];
+static uint32_t LogHead = 0;   // Total bytes written, the ring index is LogHead % LOG_RING_SIZE
+static uint32_t LogTail = 0;   // Total bytes drained
+static uint32_t LogDropped = 0;
+
+/**
+ * @brief Formats a message into the ring. Never blocks on the serial port.
+ */
+void LogWrite(const char *format, ...)
+{
+    char line[LOG_LINE_MAX];
+    va_list ap;
+    va_start(ap, format);
+    int n = vsniprintf(line, LOG_LINE_MAX, format, ap);
+    va_end(ap);
+    if (n <= 0) { return; }
+    if (n > LOG_LINE_MAX - 1) { n = LOG_LINE_MAX - 1; }
+
+    // The scheduler lock only covers the copy, formatting happens outside it
+    OSLock();
+    if ((LOG_RING_SIZE - (LogHead - LogTail)) < (uint32_t)n) { LogDropped++; }
+    else
+    {
+        uint32_t at = LogHead % LOG_RING_SIZE;
+        uint32_t first = ((uint32_t)n < LOG_RING_SIZE - at) ? (uint32_t)n : (LOG_RING_SIZE - at);
+        memcpy(LogRing + at, line, first);
+        memcpy(LogRing, line + first, n - first);
+        LogHead += n;
+    }
+    OSUnlock();
+}
+
+uint32_t LogDroppedCount()
+{
+    return LogDropped;
+}
+
+/**
+ * @brief Writes the ring to stdio. Runs below every other task, so the time spent waiting on
+ * the serial port only ever comes out of idle time.
+ */
+static void LogTask(void *pd)
+{
+    char chunk[LOG_DRAIN_CHUNK];
+    uint32_t reportedDropped = 0;
+
+    while (1)
+    {
+        OSLock();
+        uint32_t at = LogTail % LOG_RING_SIZE;
+        uint32_t n = LogHead - LogTail;
+        if (n > LOG_RING_SIZE - at) { n = LOG_RING_SIZE - at; }
+        if (n > LOG_DRAIN_CHUNK) { n = LOG_DRAIN_CHUNK; }
+        memcpy(chunk, LogRing + at, n);
+        LogTail += n;
+        uint32_t dropped = LogDropped;
+        OSUnlock();
+
+        if (n > 0)
+        {
+            fwrite(chunk, 1, n, stdout);
+            continue;
+        }
+
+        if (dropped != reportedDropped)
+        {
+            iprintf("[log] %lu messages dropped\r\n", (unsigned long)(dropped - reportedDropped));
+            reportedDropped = dropped;
+        }
+        fflush(stdout);
+        OSTimeDly(1);
+    }
+}
+
+void InitLog(int prio)
+{
+    OSSimpleTaskCreatewName(LogTask, prio, "Log");
+}
@@ -0,0 +1,94 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+#ifndef _LOG_H_
+#define _LOG_H_
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Leveled logging.
+ *
+ * Messages below LOG_LEVEL are removed at compile time, arguments and all,
+ * so a release build pays nothing for debug traces. Messages that are kept
+ * are formatted into a RAM ring buffer and return immediately; a low
+ * priority task writes the ring to stdio. When the ring is full, messages
+ * are dropped and counted rather than blocking the caller.
+ *
+ * Formatting uses the integer-only printf family, so as with iprintf,
+ * floating point values cannot be logged directly.
+ *
+ * Set the level for a build with, for example, -DLOG_LEVEL=LOG_LEVEL_DEBUG.
+ */
+
+#define LOG_LEVEL_NONE (0)
+#define LOG_LEVEL_ERROR (1)
+#define LOG_LEVEL_WARN (2)
+#define LOG_LEVEL_INFO (3)
+#define LOG_LEVEL_DEBUG (4)
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#define LOG_RING_SIZE (4096)   // Bytes of formatted text waiting for the serial port
+#define LOG_LINE_MAX (160)     // Longer messages are truncated
+
+// Starts the task that drains the ring. Messages logged before this are kept until it runs.
+void InitLog(int prio);
+
+void LogWrite(const char *format, ...) __attribute__((format(printf, 1, 2)));
+
+// Messages dropped because the ring was full
+uint32_t LogDroppedCount();
+
+#if (LOG_LEVEL >= LOG_LEVEL_ERROR)
+#define LOG_ERROR(...) LogWrite(__VA_ARGS__)
+#else
+#define LOG_ERROR(...) do {} while (0)
+#endif
+
+#if (LOG_LEVEL >= LOG_LEVEL_WARN)
+#define LOG_WARN(...) LogWrite(__VA_ARGS__)
+#else
+#define LOG_WARN(...) do {} while (0)
+#endif
+
+#if (LOG_LEVEL >= LOG_LEVEL_INFO)
+#define LOG_INFO(...) LogWrite(__VA_ARGS__)
+#else
+#define LOG_INFO(...) do {} while (0)
+#endif
+
+#if (LOG_LEVEL >= LOG_LEVEL_DEBUG)
+#define LOG_DEBUG(...) LogWrite(__VA_ARGS__)
+#else
+#define LOG_DEBUG(...) do {} while (0)
+#endif
+
+#endif /* _LOG_H_ */
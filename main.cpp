@@ -45,7 +45,6 @@
 #include <init.h>
 #include <iosys.h>
 #include <stdlib.h>
-#include <webclient/json_lexer.h>
 
 // NB FTP
 #include <ftpd.h>
@@ -60,27 +59,108 @@
 #endif
 
 #include "FileSystemUtils.h"
+#include "cardindex.h"
 #include "cardtype.h"
+#include "clients.h"
+#include "control.h"
+#include "events.h"
+#include "log.h"
+#include "mount.h"
+#include "multicast.h"
+#include "pool.h"
+#include "pose.h"
+#include "scheduler.h"
+#include "sensor.h"
+#include "stats.h"
+#include "timing.h"
 #include "web.h"
 
 // The FTP task priority
 #define FTP_PRIO (MAIN_PRIO - 2)
 
+// Event stream listeners are accepted below the main task; the main task sends their events
+#define EVENTS_PRIO (MAIN_PRIO + 1)
+
+// Telemetry commands are read below the main task, so they never delay a frame
+#define CONTROL_PRIO (MAIN_PRIO + 2)
+
+// The flash card is mounted below the main task, so a slow or missing card never delays a frame
+#define MOUNT_PRIO (MAIN_PRIO + 3)
+
+// The card index is built from idle time, after everything but logging
+#define INDEX_PRIO (MAIN_PRIO + 4)
+
+// The log task runs below everything else, so serial output only uses idle time
+#define LOG_PRIO (MAIN_PRIO + 5)
+
 const char *AppName = "WebGL Example";
 
-// Our WebSocket file descriptor
-extern int ws_fd;
+// Uncomment to replay a recording from the flash card instead of running the simulation.
+// See ReplaySensorSource in sensor.h for the file format.
+// #define SENSOR_REPLAY_FILE "replay.csv"
+
+// Uncomment to also publish every pose as binary frames to a UDP multicast group, or a broadcast
+// address, for LAN consumers that do not need the viewer. See multicast.h.
+// #define TELEMETRY_MULTICAST_GROUP "239.255.0.42"
+
+// Comment out to look for every requested file on the flash card instead of indexing it in the
+// background. See cardindex.h.
+#define CARD_INDEX
+
+// Uncomment to record every sample to the flash card, in the format the replay source reads
+// #define SENSOR_RECORD_FILE "record.csv"
+
+// Stage rates for the main loop. Samples are taken exactly SAMPLE_PERIOD_US apart and every one
+// is fused; only the newest pose of each object is sent, at TRANSMIT_PERIOD_US. The record stage
+// must drain the recorder before RECORD_QUEUE_DEPTH samples pile up.
+#define SAMPLE_PERIOD_US (1000000 / 100)
+#define FUSE_PERIOD_US (1000000 / 100)
+#define TRANSMIT_PERIOD_US (1000000 / 20)
+#define RECORD_PERIOD_US (1000000 / 4)
+
+// Samples waiting for the fuse stage. Must be a power of 2.
+#define SAMPLE_QUEUE_DEPTH (2 * SENSOR_READ_MAX)
+
+// Uncomment to time the scalar and batched pose updates at startup
+// #define RUN_POSE_BENCHMARK
+
+// The source of our position and rotation data
+#ifdef SENSOR_REPLAY_FILE
+ReplaySensorSource SensorInput(SENSOR_REPLAY_FILE, true);
+#else
+SimSensorSource SensorInput(1);
+#endif
+
+// Turns raw samples into position and orientation quaternions
+FusionStage Fusion;
+
+#ifdef SENSOR_RECORD_FILE
+SensorRecorder Recorder(SENSOR_RECORD_FILE);
+#endif
+
+// Runs the sample, fuse, transmit, record and stats stages on fixed deadlines
+PeriodicScheduler MainScheduler;
+
+// Samples handed from the sample stage to the fuse stage. Both run in the main task.
+static SensorSample SampleQueue[SAMPLE_QUEUE_DEPTH];
+static uint32_t SampleHead = 0;
+static uint32_t SampleTail = 0;
 
-// These are buffers that we use to send JSON data to clients
-const int ReportBufSize = 512;
-char ReportBuffer[ReportBufSize];
+// The flash card generation the file based stages last opened their files for
+#ifdef SENSOR_REPLAY_FILE
+static uint32_t ReplayCardGen = 0;
+#endif
+#ifdef SENSOR_RECORD_FILE
+static uint32_t RecordCardGen = 0;
+static bool RecordStarted = false;
+#endif
+
+// Telemetry frame counter for each object
+uint32_t FrameSeq[CLIENT_MAX_OBJECTS];
 
-// These are the global values that we will use managing the position and rotation
-// of the model.
-float Pos[3] = {0.0, 0.0, 0.0};
-float GoalPos[3] = {0.0, 0.0, 0.0};
-float Rot[3] = {0.0, 0.0, 0.0};       // Rotations are stored/sent as radians
-float GoalRot[3] = {0.0, 0.0, 0.0};   // Rotations are stored/sent as radians
+// The newest fused pose of each object, and which of them the transmit stage has yet to send
+static FusedPose NewestPose[CLIENT_MAX_OBJECTS];
+static uint32_t FreshPoses = 0;
 
 extern "C"
 {
@@ -88,100 +168,115 @@ extern "C"
 }
 
 /**
- * @brief Determines how much to change a position or rotation value for one
- * step.
+ * @brief Sample stage. Pulls any new samples from the sensor source, stamped with the
+ * deadline being served, and queues them for the fuse stage.
+ *
+ * To use an actual sensor, implement a SensorSource for it (see sensor.h) and use it for
+ * SensorInput.
  */
-inline float GetMovVal(float dif)
+void SampleStage(uint32_t deadlineUs)
 {
-    float difSign = dif < 0.0 ? -1 : 1;
-    return ((dif * difSign) >= 0.025) ? 0.025 * difSign : dif;
+    SensorSample samples[SENSOR_READ_MAX];
+
+#ifdef SENSOR_REPLAY_FILE
+    // The recording lives on the flash card, so restart it whenever a card comes or goes
+    if (ReplayCardGen != CardGeneration())
+    {
+        ReplayCardGen = CardGeneration();
+        SensorInput.Stop();
+        if (CardSelectDrive() && !SensorInput.Start())
+        {
+            iprintf("** Error: Could not start sensor source %s\r\n", SensorInput.Name());
+        }
+    }
+#endif
+
+    SensorInput.SetPollTime(deadlineUs);
+    int n = SensorInput.Read(samples, SENSOR_READ_MAX);
+
+    for (int i = 0; i < n; i++)
+    {
+        // The fuse stage has fallen behind, so make room by dropping the oldest sample
+        if ((SampleHead - SampleTail) >= SAMPLE_QUEUE_DEPTH) { SampleTail++; }
+        SampleQueue[SampleHead & (SAMPLE_QUEUE_DEPTH - 1)] = samples[i];
+        SampleHead++;
+
+#ifdef SENSOR_RECORD_FILE
+        Recorder.Add(samples[i]);
+#endif
+    }
 }
 
 /**
- * @brief This function manages the goal positions and rotations for our model to move to.
- * Once we get within a certain distance of the goal value, we pick new ones.
- *
- * When using an actual sensor, this is the function that should get updated to use real values.
- * The rotation values are expected to be in radians.
+ * @brief Fuse stage. Runs every queued sample through the fusion stage, keeping the latest
+ * pose of each object for the transmit stage.
  */
-void UpdatePosAndRot()
+void FuseStage(uint32_t deadlineUs)
 {
-    // Pick new goal position
-    // Find the distance between the two
-    float xDif = GoalPos[0] - Pos[0];
-    float yDif = GoalPos[1] - Pos[1];
-    float zDif = GoalPos[2] - Pos[2];
-    float dist = sqrt((xDif * xDif) + (yDif * yDif) + (zDif * zDif));
-
-    // Close enough, pick new points
-    if (dist < 0.01)
+    while (SampleTail != SampleHead)
     {
-        for (int i = 0; i < 3; i++)
+        FusedPose pose;
+        if (Fusion.Update(SampleQueue[SampleTail & (SAMPLE_QUEUE_DEPTH - 1)], pose) &&
+            (pose.object < CLIENT_MAX_OBJECTS))
         {
-            float posSign = ((rand() % 2) == 0) ? -1 : 1;
-            GoalPos[i] = (rand() % 2) * posSign;   // The 2 here is an arbitrary value to keep the model on the screen
+            NewestPose[pose.object] = pose;
+            FreshPoses |= (1u << pose.object);
+            StatsBootMark(BOOT_FIRST_POSE);
         }
+        SampleTail++;
     }
-    else
+}
+
+/**
+ * @brief Transmit stage. Publishes the newest pose of each object fused since the last run,
+ * then sends to each connected client that is due, at the rate its connection can take, to
+ * each event stream listener, and to the multicast group.
+ */
+void TransmitStage(uint32_t deadlineUs)
+{
+    for (int obj = 0; (obj < CLIENT_MAX_OBJECTS) && FreshPoses; obj++)
     {
-        Pos[0] += GetMovVal(xDif);
-        Pos[1] += GetMovVal(yDif);
-        Pos[2] += GetMovVal(zDif);
+        if (!(FreshPoses & (1u << obj))) { continue; }
+        FreshPoses &= ~(1u << obj);
+
+        FusedPose &pose = NewestPose[obj];
+        pose.seq = FrameSeq[obj]++;
+        PublishPose(pose);
+#ifdef TELEMETRY_MULTICAST_GROUP
+        MulticastPose(pose);
+#endif
     }
 
-    // Pick new goal rotation
-    // Find the distance between the two
-    xDif = GoalRot[0] - Rot[0];
-    yDif = GoalRot[1] - Rot[1];
-    zDif = GoalRot[2] - Rot[2];
-    dist = sqrt((xDif * xDif) + (yDif * yDif) + (zDif * zDif));
+    ServiceTelemetryClients();
+    ServiceEventClients();
+#ifdef TELEMETRY_MULTICAST_GROUP
+    ServiceMulticast();
+#endif
+}
 
-    // Close enough, pick new rotation values
-    if (dist < 0.01)
-    {
-        for (int i = 0; i < 3; i++)
-        {
-            float rotSign = ((rand() % 2) == 0) ? -1 : 1;
-            GoalRot[i] = ((rand() % 7855) / 10000.0) * rotSign;   // .7855 is a hair over 45 degrees
-        }
-    }
-    else
+#ifdef SENSOR_RECORD_FILE
+/**
+ * @brief Record stage. Writes the samples queued since the last run to the flash card.
+ */
+void RecordStage(uint32_t deadlineUs)
+{
+    // Reopen the recording whenever a card comes or goes. A reinserted card continues the file.
+    if (RecordCardGen != CardGeneration())
     {
-        Rot[0] += GetMovVal(xDif);
-        Rot[1] += GetMovVal(yDif);
-        Rot[2] += GetMovVal(zDif);
+        RecordCardGen = CardGeneration();
+        Recorder.Close();
+        if (CardSelectDrive() && Recorder.Open(RecordStarted)) { RecordStarted = true; }
     }
+    Recorder.Flush();
 }
+#endif
 
 /**
- * @brief This function packages up our rotation and position data, and sends it out the
- * file descriptor used by the WebSocket connection.
+ * @brief Stats stage. Publishes the performance counters.
  */
-void SendWebSocketData()
+void StatsStage(uint32_t deadlineUs)
 {
-    // Our JSON blob that we will send
-    ParsedJsonDataSet jsonOutObj;
-
-    // Build the JSON blob
-    jsonOutObj.StartBuilding();
-    jsonOutObj.AddObjectStart("PosUpdate");
-    jsonOutObj.Add("x", Pos[0]);
-    jsonOutObj.Add("y", Pos[1]);
-    jsonOutObj.Add("z", Pos[2]);
-    jsonOutObj.EndObject();
-    jsonOutObj.AddObjectStart("RotUpdate");
-    jsonOutObj.Add("x", Rot[0]);
-    jsonOutObj.Add("y", Rot[1]);
-    jsonOutObj.Add("z", Rot[2]);
-    jsonOutObj.EndObject();
-    jsonOutObj.DoneBuilding();
-
-    // If you would like to print the JSON object to serial to see the format, uncomment the next line
-    // JsonOutObject.PrintObject(true);
-
-    // Print JSON object to a buffer and write the buffer to the WebSocket file descriptor
-    int dataLen = jsonOutObj.PrintObjectToBuffer(ReportBuffer, ReportBufSize);
-    writeall(ws_fd, ReportBuffer, dataLen);
+    StatsService();
 }
 
 /**
@@ -191,6 +286,7 @@ void UserMain(void *pd)
 {
     init();
     OSChangePrio(MAIN_PRIO);
+    InitLog(LOG_PRIO);
 
     /**
      * The following call to f_enterFS() must be called in every task that accesses
@@ -211,8 +307,24 @@ void UserMain(void *pd)
 
     OSChangePrio(MAIN_PRIO);
 
-    // Initialize the CFC or SD/MMC external flash drive
-    InitExtFlash();
+    InitTiming();
+    StatsBootStart();
+
+    // Mount the CFC or SD/MMC external flash drive in the background. Until it is mounted the
+    // compiled-in pages are served, and live telemetry runs either way.
+    InitMountManager(MOUNT_PRIO);
+
+    InitPools();
+    InitTelemetryClients();
+    InitControl(CONTROL_PRIO);
+    InitEventStream(EVENTS_PORT, EVENTS_PRIO);
+#ifdef TELEMETRY_MULTICAST_GROUP
+    if (!InitMulticast(TELEMETRY_MULTICAST_GROUP, MULTICAST_PORT))
+    {
+        iprintf("** Error: Could not start multicast telemetry\r\n");
+    }
+#endif
+    InitStats();
 
     // Initialize the stack, set up the web server, etc.
     StartHTTP();
@@ -235,20 +347,48 @@ void UserMain(void *pd)
         iprintf("** Error: %d. Could not start FTP Server\r\n", status);
     }
 
+    StatsBootMark(BOOT_NETWORK_UP);
     iprintf("Starting WebGL Example\r\n");
 
-    DumpDir();
+#ifdef RUN_POSE_BENCHMARK
+    RunPoseBenchmark(1, 200000);
+    RunPoseBenchmark(POSE_MAX_OBJECTS, 20000);
+#endif
+
+#ifndef SENSOR_REPLAY_FILE
+    // A replay source is started by the sample stage once the flash card is mounted
+    if (!SensorInput.Start())
+    {
+        iprintf("** Error: Could not start sensor source %s\r\n", SensorInput.Name());
+    }
+#endif
+
+    // Stages run in this order whenever several are due at once, so fusion always sees the
+    // samples taken for the same deadline. Every slot should produce a sample, so missed sample
+    // deadlines are caught up; the other stages only care about the newest data.
+    MainScheduler.AddStage("sample", SampleStage, SAMPLE_PERIOD_US, SCHED_CATCHUP_BURST);
+    MainScheduler.AddStage("fuse", FuseStage, FUSE_PERIOD_US);
+    MainScheduler.AddStage("transmit", TransmitStage, TRANSMIT_PERIOD_US);
+#ifdef SENSOR_RECORD_FILE
+    MainScheduler.AddStage("record", RecordStage, RECORD_PERIOD_US);
+#endif
+    MainScheduler.AddStage("stats", StatsStage, STATS_PERIOD_US);
+    StatsSetScheduler(&MainScheduler);
+
+    MainScheduler.Start();
+
+#ifdef CARD_INDEX
+    // Started last, so walking the card never competes with the first telemetry frames
+    InitCardIndex(INDEX_PRIO);
+#endif
+
     while (1)
     {
-        // Update the simulations position and rotation values
-        UpdatePosAndRot();
+        uint32_t passStart = TimingNowUs();
+        uint32_t nextUs = MainScheduler.RunDue();
+        StatsTickDone(passStart);
 
-        // If we have a valid WebSocket file descriptor
-        if (ws_fd > 0)
-        {
-            // Send our data
-            SendWebSocketData();
-        }
-        OSTimeDly(1);
+        // Sleep until the earliest next deadline, however long this pass took
+        SchedWaitUntil(nextUs);
     }
 }
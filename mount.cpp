@@ -0,0 +1,167 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+
+/**
+ * Flash card mount manager task.
+ */
+
+// NB Constants
+#include <constants.h>
+
+// NB Libs
+#include <string.h>
+#include <ucos.h>
+
+// EFFS Files
+#include <effs_fat/fat.h>
+
+#include "cardtype.h"
+#include "FileSystemUtils.h"
+#include "log.h"
+#include "mount.h"
+#include "stats.h"
+
+static volatile bool Mounted = false;
+static volatile uint32_t Generation = 0;
+
+// Written by the mount task only, copied out under StatusCrit
+static OS_CRIT StatusCrit;
+static MountStatus Status;
+
+static void SetStatus(MountState state, bool writeProtected)
+{
+    OSCritEnter(&StatusCrit, 0);
+    Status.state = state;
+    Status.writeProtected = writeProtected;
+    Status.generation = Generation;
+    OSCritLeave(&StatusCrit);
+}
+
+/**
+ * @brief Polls card detect and mounts or unmounts to match.
+ */
+static void MountTask(void *pd)
+{
+    f_enterFS();
+
+    DWORD retryTicks = MOUNT_POLL_TICKS;
+    DWORD waitTicks = 0;   // Until the next mount attempt after a failure
+    while (1)
+    {
+        bool present = (ExtFlashPresent() != 0);
+
+        if (Mounted && !present)
+        {
+            Mounted = false;
+            Generation++;
+            UnmountExtFlash();   // Releases the volume so the next card starts clean
+            StatsAdd(STAT_TASK_MOUNT, STAT_CARD_REMOVALS);
+            SetStatus(MOUNT_NO_CARD, false);
+            LOG_WARN("Flash card removed, serving compiled-in pages\r\n");
+        }
+        else if (!Mounted && !present)
+        {
+            retryTicks = MOUNT_POLL_TICKS;
+            waitTicks = 0;
+            SetStatus(MOUNT_NO_CARD, false);
+        }
+        else if (!Mounted && (waitTicks == 0))
+        {
+            bool writeProtected = (ExtFlashWriteProtected() != 0);
+            if (MountExtFlash() == F_NO_ERROR)
+            {
+                Mounted = true;
+                Generation++;
+                retryTicks = MOUNT_POLL_TICKS;
+                StatsAdd(STAT_TASK_MOUNT, STAT_CARD_MOUNTS);
+                SetStatus(MOUNT_MOUNTED, writeProtected);
+                LOG_INFO("Flash card mounted%s\r\n", writeProtected ? " (write protected)" : "");
+                StatsBootMark(BOOT_CARD_MOUNTED);
+            }
+            else
+            {
+                UnmountExtFlash();
+                StatsAdd(STAT_TASK_MOUNT, STAT_CARD_MOUNT_FAILURES);
+                SetStatus(MOUNT_FAILED, writeProtected);
+                LOG_WARN("Flash card mount failed, retrying in %lu ticks\r\n", (unsigned long)retryTicks);
+                waitTicks = retryTicks;
+                retryTicks = (retryTicks * 2 > MOUNT_RETRY_MAX_TICKS) ? MOUNT_RETRY_MAX_TICKS : retryTicks * 2;
+            }
+        }
+        else if (!Mounted)
+        {
+            waitTicks = (waitTicks > MOUNT_POLL_TICKS) ? waitTicks - MOUNT_POLL_TICKS : 0;
+        }
+
+        OSTimeDly(MOUNT_POLL_TICKS);
+    }
+}
+
+void InitMountManager(int prio)
+{
+    OSCritInit(&StatusCrit);
+    memset(&Status, 0, sizeof(Status));
+    Status.state = MOUNT_NO_CARD;
+    OSSimpleTaskCreatewName(MountTask, prio, "Mount");
+}
+
+bool CardMounted()
+{
+    return Mounted;
+}
+
+uint32_t CardGeneration()
+{
+    return Generation;
+}
+
+bool CardSelectDrive()
+{
+    if (!Mounted) { return false; }
+    return (f_chdrive(EXT_FLASH_DRV_NUM) == F_NO_ERROR);
+}
+
+void MountGetStatus(MountStatus &status)
+{
+    OSCritEnter(&StatusCrit, 0);
+    status = Status;
+    OSCritLeave(&StatusCrit);
+    status.mounts = StatCounters[STAT_TASK_MOUNT][STAT_CARD_MOUNTS];
+    status.removals = StatCounters[STAT_TASK_MOUNT][STAT_CARD_REMOVALS];
+    status.failures = StatCounters[STAT_TASK_MOUNT][STAT_CARD_MOUNT_FAILURES];
+}
+
+const char *MountStateName(MountState state)
+{
+    switch (state)
+    {
+        case MOUNT_MOUNTED: return "mounted";
+        case MOUNT_FAILED: return "failed";
+        default: return "no_card";
+    }
+}
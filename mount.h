@@ -0,0 +1,88 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+#ifndef _MOUNT_H_
+#define _MOUNT_H_
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Background flash card mounting.
+ *
+ * The card is mounted by a low priority task rather than during startup,
+ * so networking and live telemetry come up at once whether or not a card
+ * is present. The task checks card detect every MOUNT_POLL_TICKS. It
+ * mounts a card when one appears and unmounts it when it is pulled, so a
+ * card can be swapped while the application runs. A failed mount is
+ * retried with a doubling delay of up to MOUNT_RETRY_MAX_TICKS.
+ *
+ * While no card is mounted, the web server serves the compiled-in html/
+ * pages and FTP logins are refused. A write-protected card is still
+ * mounted and can be read; writes to it fail.
+ *
+ * Code that keeps files open across calls (the sensor recorder, a replay
+ * source) should watch CardGeneration() and reopen its files when it
+ * changes.
+ */
+
+#define MOUNT_POLL_TICKS (TICKS_PER_SECOND / 2)
+#define MOUNT_RETRY_MAX_TICKS (8 * TICKS_PER_SECOND)
+
+enum MountState
+{
+    MOUNT_NO_CARD,
+    MOUNT_MOUNTED,
+    MOUNT_FAILED,   // A card is present but would not mount, retrying
+};
+
+struct MountStatus
+{
+    MountState state;
+    bool writeProtected;
+    uint32_t generation;
+    uint32_t mounts;
+    uint32_t removals;
+    uint32_t failures;
+};
+
+// Starts the mount task. The task enters the file system itself.
+void InitMountManager(int prio);
+
+// True while a card is mounted. Safe to call from any task.
+bool CardMounted();
+
+// Changes every time a card is mounted or unmounted. Safe to call from any task.
+uint32_t CardGeneration();
+
+// Makes the card the calling task's current drive. Returns false if no card is mounted.
+bool CardSelectDrive();
+
+void MountGetStatus(MountStatus &status);
+const char *MountStateName(MountState state);
+
+#endif /* _MOUNT_H_ */
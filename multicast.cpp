@@ -0,0 +1,101 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+
+/**
+ * UDP multicast telemetry publisher.
+ */
+
+// NB Libs
+#include <udp.h>
+#include <utils.h>
+
+#include "log.h"
+#include "multicast.h"
+#include "stats.h"
+#include "telemetry.h"
+
+static int Socket = -1;
+static IPADDR Address;
+static WORD Port;
+
+// Only the main task queues and sends, so the batch needs no locking
+static uint8_t Batch[MULTICAST_BATCH_MAX * TELEMETRY_BINARY_SIZE];
+static int BatchFrames = 0;
+
+static MulticastStatus Status;
+
+bool InitMulticast(const char *address, int port)
+{
+    Address = AsciiToIp(address);
+    Port = port;
+    Socket = CreateTxUdpSocket(Address, Port, Port);
+    if (Socket < 0)
+    {
+        LOG_ERROR("Multicast: unable to open a UDP socket\r\n");
+        return false;
+    }
+
+    Status.enabled = true;
+    LOG_INFO("Publishing telemetry to %s port %d\r\n", address, port);
+    return true;
+}
+
+void ServiceMulticast()
+{
+    if (BatchFrames == 0) { return; }
+
+    int len = BatchFrames * TELEMETRY_BINARY_SIZE;
+    if (sendto(Socket, Batch, len, Address, Port) == len)
+    {
+        Status.datagrams++;
+        Status.frames += BatchFrames;
+        StatsAdd(STAT_TASK_MAIN, STAT_FRAMES_SENT, BatchFrames);
+        StatsAdd(STAT_TASK_MAIN, STAT_TELEMETRY_BYTES, len);
+    }
+    else
+    {
+        // Most often no route yet, or no buffers. Consumers see the gap in seq.
+        Status.errors++;
+        StatsAdd(STAT_TASK_MAIN, STAT_FRAMES_DROPPED, BatchFrames);
+    }
+    BatchFrames = 0;
+}
+
+void MulticastPose(const FusedPose &pose)
+{
+    if (Socket < 0) { return; }
+    if (BatchFrames == MULTICAST_BATCH_MAX) { ServiceMulticast(); }
+
+    EncodeBinaryFrame(pose, Batch + BatchFrames * TELEMETRY_BINARY_SIZE, TELEMETRY_BINARY_SIZE);
+    BatchFrames++;
+}
+
+void MulticastGetStatus(MulticastStatus &status)
+{
+    status = Status;
+}
@@ -0,0 +1,74 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+
+#ifndef _MULTICAST_H_
+#define _MULTICAST_H_
+#pragma once
+
+#include <stdint.h>
+
+#include "fusion.h"
+
+/**
+ * UDP multicast telemetry.
+ *
+ * For historians and other LAN consumers that do not need the viewer. Each
+ * pose is encoded once as a binary frame (see telemetry.h). The frames
+ * fused in one pass are sent together as a single datagram, to a multicast
+ * group or a broadcast address. The device cost is one datagram per pass
+ * however many consumers listen, and no connection state is kept.
+ *
+ * A datagram is 1 to MULTICAST_BATCH_MAX frames, each TELEMETRY_BINARY_SIZE
+ * bytes, one after another with no header. Every object has its own frame
+ * counter ("seq"), so a consumer detects loss as a gap in an object's
+ * counter. host/telemrecv is a receiver that reports this.
+ */
+
+#define MULTICAST_PORT (5042)
+#define MULTICAST_BATCH_MAX (32)     // Frames per datagram, 704 bytes
+
+struct MulticastStatus
+{
+    bool enabled;
+    uint32_t datagrams;
+    uint32_t frames;
+    uint32_t errors;   // Datagrams the stack would not send
+};
+
+// Opens the socket. address is a dotted multicast group or broadcast address.
+bool InitMulticast(const char *address, int port);
+
+// Encodes a pose into the next datagram, sending it first if it is full
+void MulticastPose(const FusedPose &pose);
+
+// Sends the frames queued since the last call. Call once per pass, after the poses are published.
+void ServiceMulticast();
+
+void MulticastGetStatus(MulticastStatus &status);
+
+#endif /* _MULTICAST_H_ */
@@ -0,0 +1,135 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+/**
+ * Fixed-block buffer pools.
+ */
+
+// NB Libs
+#include <string.h>
+#include <ucos.h>
+
+#include "log.h"
+#include "pool.h"
+
+static char PathBlocks[POOL_PATH_COUNT][POOL_PATH_SIZE] __attribute__((aligned(16)));
+static char FrameBlocks[POOL_FRAME_COUNT][POOL_FRAME_SIZE] __attribute__((aligned(16)));
+static char TransferBlocks[POOL_TRANSFER_COUNT][POOL_TRANSFER_SIZE] __attribute__((aligned(16)));
+
+static uint8_t PathFree[POOL_PATH_COUNT];
+static uint8_t FrameFree[POOL_FRAME_COUNT];
+static uint8_t TransferFree[POOL_TRANSFER_COUNT];
+
+struct Pool
+{
+    char *base;
+    uint32_t blockSize;
+    uint32_t blocks;
+    uint8_t *freeStack;   // Indices of free blocks, freeTop of them
+    uint32_t freeTop;
+    OS_SEM available;     // Counts free blocks, so callers can wait for one
+    PoolStats stats;
+};
+
+static Pool Pools[POOL_CLASS_COUNT] = {
+    {&PathBlocks[0][0], POOL_PATH_SIZE, POOL_PATH_COUNT, PathFree},
+    {&FrameBlocks[0][0], POOL_FRAME_SIZE, POOL_FRAME_COUNT, FrameFree},
+    {&TransferBlocks[0][0], POOL_TRANSFER_SIZE, POOL_TRANSFER_COUNT, TransferFree},
+};
+
+static const char *PoolNames[POOL_CLASS_COUNT] = {"path", "frame", "transfer"};
+
+void InitPools()
+{
+    for (int c = 0; c < POOL_CLASS_COUNT; c++)
+    {
+        Pool &p = Pools[c];
+        for (uint32_t i = 0; i < p.blocks; i++)
+        {
+            p.freeStack[i] = (uint8_t)i;
+        }
+        p.freeTop = p.blocks;
+        OSSemInit(&p.available, p.blocks);
+        memset(&p.stats, 0, sizeof(p.stats));
+        p.stats.name = PoolNames[c];
+        p.stats.blockSize = p.blockSize;
+        p.stats.blocks = p.blocks;
+    }
+}
+
+char *PoolAlloc(PoolClass cls, uint16_t timeoutTicks)
+{
+    Pool &p = Pools[cls];
+
+    // A zero timeout means wait forever to OSSemPend(), so no-wait needs its own call
+    BYTE rv = (timeoutTicks == POOL_NO_WAIT) ? OSSemPendNoWait(&p.available) : OSSemPend(&p.available, timeoutTicks);
+
+    OSLock();
+    if (rv != OS_NO_ERR)
+    {
+        p.stats.failures++;
+        OSUnlock();
+        LOG_WARN("No free %s buffer\r\n", p.stats.name);
+        return nullptr;
+    }
+
+    uint32_t index = p.freeStack[--p.freeTop];
+    p.stats.allocs++;
+    p.stats.inUse++;
+    if (p.stats.inUse > p.stats.highWater) { p.stats.highWater = p.stats.inUse; }
+    OSUnlock();
+
+    return p.base + index * p.blockSize;
+}
+
+void PoolFree(void *block)
+{
+    if (block == nullptr) { return; }
+
+    for (int c = 0; c < POOL_CLASS_COUNT; c++)
+    {
+        Pool &p = Pools[c];
+        uint32_t offset = (uint32_t)((char *)block - p.base);
+        if (((char *)block < p.base) || (offset >= p.blocks * p.blockSize)) { continue; }
+
+        OSLock();
+        p.freeStack[p.freeTop++] = (uint8_t)(offset / p.blockSize);
+        p.stats.inUse--;
+        OSUnlock();
+        OSSemPost(&p.available);
+        return;
+    }
+
+    LOG_ERROR("PoolFree of a block not from any pool\r\n");
+}
+
+void PoolGetStats(PoolClass cls, PoolStats &stats)
+{
+    OSLock();
+    stats = Pools[cls].stats;
+    OSUnlock();
+}
@@ -0,0 +1,118 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+#ifndef _POOL_H_
+#define _POOL_H_
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Fixed-block buffer pools.
+ *
+ * Working buffers come from three size classes, each a static array of
+ * equal sized blocks. Blocks are only ever handed out whole and returned
+ * whole, so the pools cannot fragment, and the SRAM they use is fixed at
+ * build time. Buffers are held only while a request or transfer is in
+ * progress, so the same memory serves more connections than one static
+ * buffer per handler would.
+ *
+ * Each class counts blocks in use, its high-water mark and failed
+ * allocations; the counts appear under "pools" in /stats and are the
+ * numbers to watch when tuning the block counts below.
+ */
+
+enum PoolClass
+{
+    POOL_PATH,       // Path names, URL parts and text lines
+    POOL_FRAME,      // Telemetry frames and small responses
+    POOL_TRANSFER,   // File transfer buffers for HTTP and FTP
+    POOL_CLASS_COUNT
+};
+
+#define POOL_PATH_SIZE (264)   // A 256 character path plus terminator, rounded up
+#define POOL_PATH_COUNT (12)
+#define POOL_FRAME_SIZE (1024)
+#define POOL_FRAME_COUNT (6)
+#define POOL_TRANSFER_SIZE (16 * 1024)
+#define POOL_TRANSFER_COUNT (4)
+
+#define POOL_NO_WAIT (0)
+
+struct PoolStats
+{
+    const char *name;
+    uint32_t blockSize;
+    uint32_t blocks;
+    uint32_t inUse;
+    uint32_t highWater;   // Most blocks in use at once
+    uint32_t allocs;
+    uint32_t failures;    // Allocations that found the class empty
+};
+
+// Must be called once before any task allocates
+void InitPools();
+
+/**
+ * Takes a block from the class, waiting up to timeoutTicks for one to be
+ * returned. POOL_NO_WAIT returns at once. Returns nullptr if the class is
+ * still empty.
+ */
+char *PoolAlloc(PoolClass cls, uint16_t timeoutTicks = POOL_NO_WAIT);
+
+// Returns a block from any class. nullptr is ignored.
+void PoolFree(void *block);
+
+void PoolGetStats(PoolClass cls, PoolStats &stats);
+
+/**
+ * Holds a pool block for the lifetime of the object.
+ */
+class PoolBlock
+{
+  public:
+    PoolBlock() : m_data(nullptr) {}
+    PoolBlock(PoolClass cls, uint16_t timeoutTicks = POOL_NO_WAIT) : m_data(PoolAlloc(cls, timeoutTicks)) {}
+    ~PoolBlock() { PoolFree(m_data); }
+
+    // Takes a block if this object does not hold one yet
+    bool Acquire(PoolClass cls, uint16_t timeoutTicks = POOL_NO_WAIT)
+    {
+        if (m_data == nullptr) { m_data = PoolAlloc(cls, timeoutTicks); }
+        return m_data != nullptr;
+    }
+
+    char *Data() const { return m_data; }
+
+  private:
+    PoolBlock(const PoolBlock &);
+    PoolBlock &operator=(const PoolBlock &);
+
+    char *m_data;
+};
+
+#endif /* _POOL_H_ */
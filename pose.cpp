@@ -0,0 +1,314 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+/**
+ * Batched position and rotation integration for the simulated model(s).
+ */
+
+// NB Constants
+#include <constants.h>
+
+// NB Libs
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucos.h>
+
+#include "pose.h"
+
+#define POSE_ARRIVE_DIST_SQ (POSE_ARRIVE_DIST * POSE_ARRIVE_DIST)
+
+/**
+ * The fixed-point distance test is done on differences reduced to Q22.10 so
+ * that the sum of three squares fits in 32 bits without a 64-bit multiply,
+ * which ColdFire would have to do in software. Differences up to 8 units are
+ * safe, and the model never strays more than 2 units from its goal.
+ */
+#define Q16_DIST_SHIFT (6)
+#define Q16_STEP FLOAT_TO_Q16(POSE_STEP)
+#define Q16_ARRIVE_DIST_SQ ((int32_t)((POSE_ARRIVE_DIST * 1024) * (POSE_ARRIVE_DIST * 1024) + 0.5f))
+
+/**
+ * @brief Limits a difference to +/- POSE_STEP. Written as two selects so the
+ * compiler emits min/max instructions instead of branches.
+ */
+static inline float ClampStep(float dif)
+{
+    dif = (dif > POSE_STEP) ? POSE_STEP : dif;
+    return (dif < -POSE_STEP) ? -POSE_STEP : dif;
+}
+
+/**
+ * @brief Branch free min/max for fixed-point values. The comparisons compile
+ * to set-on-condition instructions, which are used to build a select mask.
+ */
+static inline q16_t MinQ16(q16_t a, q16_t b)
+{
+    return b ^ ((a ^ b) & -(q16_t)(a < b));
+}
+
+static inline q16_t MaxQ16(q16_t a, q16_t b)
+{
+    return a ^ ((a ^ b) & -(q16_t)(a < b));
+}
+
+/**
+ * @brief Advances one group of xyz values (either position or rotation) for
+ * every object in the batch. Returns the arrival mask for the group.
+ */
+static uint32_t IntegrateGroup(float (*cur)[POSE_MAX_OBJECTS], float (*goal)[POSE_MAX_OBJECTS], int count)
+{
+    uint32_t arrived = 0;
+    float *cx = cur[0], *cy = cur[1], *cz = cur[2];
+    const float *gx = goal[0], *gy = goal[1], *gz = goal[2];
+
+    for (int i = 0; i < count; i++)
+    {
+        float dx = gx[i] - cx[i];
+        float dy = gy[i] - cy[i];
+        float dz = gz[i] - cz[i];
+        float distSq = (dx * dx) + (dy * dy) + (dz * dz);
+
+        // Objects that have arrived are held in place for this step, just as the scalar code does
+        uint32_t done = (distSq < POSE_ARRIVE_DIST_SQ);
+        float move = (float)(1 - done);
+        arrived |= done << i;
+
+        cx[i] += ClampStep(dx) * move;
+        cy[i] += ClampStep(dy) * move;
+        cz[i] += ClampStep(dz) * move;
+    }
+
+    return arrived;
+}
+
+static uint32_t IntegrateGroupQ16(q16_t (*cur)[POSE_MAX_OBJECTS], q16_t (*goal)[POSE_MAX_OBJECTS], int count)
+{
+    uint32_t arrived = 0;
+    q16_t *cx = cur[0], *cy = cur[1], *cz = cur[2];
+    const q16_t *gx = goal[0], *gy = goal[1], *gz = goal[2];
+
+    for (int i = 0; i < count; i++)
+    {
+        q16_t dx = gx[i] - cx[i];
+        q16_t dy = gy[i] - cy[i];
+        q16_t dz = gz[i] - cz[i];
+
+        int32_t sx = dx >> Q16_DIST_SHIFT;
+        int32_t sy = dy >> Q16_DIST_SHIFT;
+        int32_t sz = dz >> Q16_DIST_SHIFT;
+        int32_t distSq = (sx * sx) + (sy * sy) + (sz * sz);
+
+        uint32_t done = (distSq < Q16_ARRIVE_DIST_SQ);
+        q16_t keep = (q16_t)done - 1;   // All ones while moving, zero once arrived
+        arrived |= done << i;
+
+        cx[i] += MaxQ16(MinQ16(dx, Q16_STEP), -Q16_STEP) & keep;
+        cy[i] += MaxQ16(MinQ16(dy, Q16_STEP), -Q16_STEP) & keep;
+        cz[i] += MaxQ16(MinQ16(dz, Q16_STEP), -Q16_STEP) & keep;
+    }
+
+    return arrived;
+}
+
+/**
+ * @brief Clears a batch and sets the number of active objects.
+ */
+void InitPoseBatch(PoseBatch &batch, int count)
+{
+    memset(&batch, 0, sizeof(batch));
+    batch.count = (count > POSE_MAX_OBJECTS) ? POSE_MAX_OBJECTS : count;
+}
+
+void InitPoseBatchQ16(PoseBatchQ16 &batch, int count)
+{
+    memset(&batch, 0, sizeof(batch));
+    batch.count = (count > POSE_MAX_OBJECTS) ? POSE_MAX_OBJECTS : count;
+}
+
+/**
+ * @brief Moves every object in the batch one step towards its goal position and rotation.
+ */
+void IntegratePoseBatch(PoseBatch &batch, uint32_t &posArrived, uint32_t &rotArrived)
+{
+    posArrived = IntegrateGroup(batch.pos, batch.goalPos, batch.count);
+    rotArrived = IntegrateGroup(batch.rot, batch.goalRot, batch.count);
+}
+
+void IntegratePoseBatchQ16(PoseBatchQ16 &batch, uint32_t &posArrived, uint32_t &rotArrived)
+{
+    posArrived = IntegrateGroupQ16(batch.pos, batch.goalPos, batch.count);
+    rotArrived = IntegrateGroupQ16(batch.rot, batch.goalRot, batch.count);
+}
+
+/**
+ * @brief Picks a new goal position of -1, 0 or 1 on each axis.
+ */
+void PickPosGoal(PoseBatch &batch, int obj)
+{
+    for (int i = 0; i < 3; i++)
+    {
+        float posSign = ((rand() % 2) == 0) ? -1 : 1;
+        batch.goalPos[i][obj] = (rand() % 2) * posSign;   // The 2 here is an arbitrary value to keep the model on the screen
+    }
+}
+
+/**
+ * @brief Picks a new goal rotation within +/- 45 degrees on each axis.
+ */
+void PickRotGoal(PoseBatch &batch, int obj)
+{
+    for (int i = 0; i < 3; i++)
+    {
+        float rotSign = ((rand() % 2) == 0) ? -1 : 1;
+        batch.goalRot[i][obj] = ((rand() % 7855) / 10000.0) * rotSign;   // .7855 is a hair over 45 degrees
+    }
+}
+
+void PickPosGoalQ16(PoseBatchQ16 &batch, int obj)
+{
+    for (int i = 0; i < 3; i++)
+    {
+        q16_t posSign = ((rand() % 2) == 0) ? -1 : 1;
+        batch.goalPos[i][obj] = (rand() % 2) * posSign * Q16_ONE;
+    }
+}
+
+void PickRotGoalQ16(PoseBatchQ16 &batch, int obj)
+{
+    for (int i = 0; i < 3; i++)
+    {
+        q16_t rotSign = ((rand() % 2) == 0) ? -1 : 1;
+        batch.goalRot[i][obj] = (((rand() % 7855) * Q16_ONE) / 10000) * rotSign;
+    }
+}
+
+/**
+ * The original per-object update, kept here as the baseline for the benchmark.
+ */
+static inline float ScalarGetMovVal(float dif)
+{
+    float difSign = dif < 0.0 ? -1 : 1;
+    return ((dif * difSign) >= 0.025) ? 0.025 * difSign : dif;
+}
+
+static bool ScalarUpdateGroup(float (*cur)[POSE_MAX_OBJECTS], float (*goal)[POSE_MAX_OBJECTS], int obj)
+{
+    float xDif = goal[0][obj] - cur[0][obj];
+    float yDif = goal[1][obj] - cur[1][obj];
+    float zDif = goal[2][obj] - cur[2][obj];
+    float dist = sqrt((xDif * xDif) + (yDif * yDif) + (zDif * zDif));
+
+    if (dist < 0.01) { return true; }
+
+    cur[0][obj] += ScalarGetMovVal(xDif);
+    cur[1][obj] += ScalarGetMovVal(yDif);
+    cur[2][obj] += ScalarGetMovVal(zDif);
+    return false;
+}
+
+/**
+ * @brief Converts a TimeTick interval to nanoseconds per object step.
+ */
+static unsigned long NsPerStep(DWORD ticks, int objects, int iterations)
+{
+    unsigned long long ns = (unsigned long long)ticks * (1000000000ULL / TICKS_PER_SECOND);
+    return (unsigned long)(ns / ((unsigned long long)objects * iterations));
+}
+
+/**
+ * @brief Runs the scalar, float batch and fixed-point batch updates over the
+ * same seeded workload and prints the time taken by each.
+ *
+ * Timing uses TimeTick, so choose enough iterations for each run to span
+ * at least a few seconds.
+ */
+void RunPoseBenchmark(int objects, int iterations)
+{
+    static PoseBatch batch;
+    static PoseBatchQ16 batchQ16;
+    volatile uint32_t sink = 0;
+
+    if (objects > POSE_MAX_OBJECTS) { objects = POSE_MAX_OBJECTS; }
+    if (objects < 1) { objects = 1; }
+
+    iprintf("Pose benchmark: %d objects, %d iterations\r\n", objects, iterations);
+
+    // Scalar baseline
+    InitPoseBatch(batch, objects);
+    srand(1);
+    DWORD start = TimeTick;
+    for (int n = 0; n < iterations; n++)
+    {
+        for (int obj = 0; obj < objects; obj++)
+        {
+            if (ScalarUpdateGroup(batch.pos, batch.goalPos, obj)) { PickPosGoal(batch, obj); }
+            if (ScalarUpdateGroup(batch.rot, batch.goalRot, obj)) { PickRotGoal(batch, obj); }
+        }
+    }
+    DWORD scalarTicks = TimeTick - start;
+    sink += (uint32_t)batch.pos[0][0];
+
+    // Float batch kernel
+    InitPoseBatch(batch, objects);
+    srand(1);
+    start = TimeTick;
+    for (int n = 0; n < iterations; n++)
+    {
+        uint32_t posArrived, rotArrived;
+        IntegratePoseBatch(batch, posArrived, rotArrived);
+        for (int obj = 0; (posArrived | rotArrived) != 0; obj++, posArrived >>= 1, rotArrived >>= 1)
+        {
+            if (posArrived & 1) { PickPosGoal(batch, obj); }
+            if (rotArrived & 1) { PickRotGoal(batch, obj); }
+        }
+    }
+    DWORD batchTicks = TimeTick - start;
+    sink += (uint32_t)batch.pos[0][0];
+
+    // Fixed-point batch kernel
+    InitPoseBatchQ16(batchQ16, objects);
+    srand(1);
+    start = TimeTick;
+    for (int n = 0; n < iterations; n++)
+    {
+        uint32_t posArrived, rotArrived;
+        IntegratePoseBatchQ16(batchQ16, posArrived, rotArrived);
+        for (int obj = 0; (posArrived | rotArrived) != 0; obj++, posArrived >>= 1, rotArrived >>= 1)
+        {
+            if (posArrived & 1) { PickPosGoalQ16(batchQ16, obj); }
+            if (rotArrived & 1) { PickRotGoalQ16(batchQ16, obj); }
+        }
+    }
+    DWORD q16Ticks = TimeTick - start;
+    sink += (uint32_t)batchQ16.pos[0][0];
+
+    iprintf("  Scalar:      %lu ticks, %lu ns per object step\r\n", scalarTicks, NsPerStep(scalarTicks, objects, iterations));
+    iprintf("  Float batch: %lu ticks, %lu ns per object step\r\n", batchTicks, NsPerStep(batchTicks, objects, iterations));
+    iprintf("  Q16 batch:   %lu ticks, %lu ns per object step\r\n", q16Ticks, NsPerStep(q16Ticks, objects, iterations));
+    (void)sink;
+}
@@ -0,0 +1,95 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+#ifndef _POSE_H_
+#define _POSE_H_
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Batched pose integration.
+ *
+ * Poses are kept in structure-of-arrays form so that one pass over an axis
+ * touches consecutive memory for every object, and the per-object work has
+ * no data dependent branches. Two kernels are provided: a float version for
+ * targets with an FPU, and a Q16.16 fixed-point version for ColdFire parts
+ * without one.
+ */
+
+#define POSE_MAX_OBJECTS (32)        // Must not exceed the width of the arrival masks
+#define POSE_STEP (0.025f)           // Largest change applied to one axis per step
+#define POSE_ARRIVE_DIST (0.01f)     // Distance at which a goal counts as reached
+
+struct PoseBatch
+{
+    int count;
+    float pos[3][POSE_MAX_OBJECTS];
+    float goalPos[3][POSE_MAX_OBJECTS];
+    float rot[3][POSE_MAX_OBJECTS];       // Rotations are stored as radians
+    float goalRot[3][POSE_MAX_OBJECTS];   // Rotations are stored as radians
+};
+
+// Q16.16 fixed-point values
+typedef int32_t q16_t;
+
+#define Q16_ONE (65536)
+#define FLOAT_TO_Q16(f) ((q16_t)((f) * (float)Q16_ONE))
+#define Q16_TO_FLOAT(q) ((float)(q) / (float)Q16_ONE)
+
+struct PoseBatchQ16
+{
+    int count;
+    q16_t pos[3][POSE_MAX_OBJECTS];
+    q16_t goalPos[3][POSE_MAX_OBJECTS];
+    q16_t rot[3][POSE_MAX_OBJECTS];
+    q16_t goalRot[3][POSE_MAX_OBJECTS];
+};
+
+void InitPoseBatch(PoseBatch &batch, int count);
+void InitPoseBatchQ16(PoseBatchQ16 &batch, int count);
+
+/**
+ * Advance every object one step towards its goals. Objects that are already
+ * within POSE_ARRIVE_DIST of a goal are left in place and have their bit set
+ * in the matching arrival mask so the caller can pick new goals for them.
+ */
+void IntegratePoseBatch(PoseBatch &batch, uint32_t &posArrived, uint32_t &rotArrived);
+void IntegratePoseBatchQ16(PoseBatchQ16 &batch, uint32_t &posArrived, uint32_t &rotArrived);
+
+// Pick new random goals for one object, using the ranges of the original simulation
+void PickPosGoal(PoseBatch &batch, int obj);
+void PickRotGoal(PoseBatch &batch, int obj);
+void PickPosGoalQ16(PoseBatchQ16 &batch, int obj);
+void PickRotGoalQ16(PoseBatchQ16 &batch, int obj);
+
+/**
+ * Times the original per-axis scalar update against both batched kernels
+ * and prints the results to stdio.
+ */
+void RunPoseBenchmark(int objects, int iterations);
+
+#endif /* _POSE_H_ */
@@ -0,0 +1,209 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+#ifndef _QUAT_H_
+#define _QUAT_H_
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+
+/**
+ * Unit quaternion helpers. A quaternion here rotates body frame vectors into
+ * the world frame, and the world frame matches Three.js: Y up, -Z forward.
+ */
+
+struct Quat
+{
+    float w, x, y, z;
+};
+
+inline Quat QuatIdentity()
+{
+    Quat q = {1.0f, 0.0f, 0.0f, 0.0f};
+    return q;
+}
+
+inline Quat QuatMul(const Quat &a, const Quat &b)
+{
+    Quat r;
+    r.w = a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z;
+    r.x = a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y;
+    r.y = a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x;
+    r.z = a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w;
+    return r;
+}
+
+inline Quat QuatConj(const Quat &q)
+{
+    Quat r = {q.w, -q.x, -q.y, -q.z};
+    return r;
+}
+
+inline void QuatNormalize(Quat &q)
+{
+    float n = sqrtf(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z);
+    if (n > 0.0f)
+    {
+        n = 1.0f / n;
+        q.w *= n;
+        q.x *= n;
+        q.y *= n;
+        q.z *= n;
+    }
+    else
+    {
+        q = QuatIdentity();
+    }
+}
+
+/**
+ * Builds the quaternion for Euler angles in XYZ order, the default order
+ * used by Three.js for Object3D.rotation.
+ */
+inline Quat QuatFromEulerXYZ(const float rot[3])
+{
+    float c1 = cosf(rot[0] * 0.5f), s1 = sinf(rot[0] * 0.5f);
+    float c2 = cosf(rot[1] * 0.5f), s2 = sinf(rot[1] * 0.5f);
+    float c3 = cosf(rot[2] * 0.5f), s3 = sinf(rot[2] * 0.5f);
+
+    Quat q;
+    q.x = s1 * c2 * c3 + c1 * s2 * s3;
+    q.y = c1 * s2 * c3 - s1 * c2 * s3;
+    q.z = c1 * c2 * s3 + s1 * s2 * c3;
+    q.w = c1 * c2 * c3 - s1 * s2 * s3;
+    return q;
+}
+
+/**
+ * Recovers XYZ order Euler angles from a unit quaternion, for clients that
+ * still expect rotations as Euler radians.
+ */
+inline void QuatToEulerXYZ(const Quat &q, float rot[3])
+{
+    float m11 = 1.0f - 2.0f * (q.y * q.y + q.z * q.z);
+    float m12 = 2.0f * (q.x * q.y - q.w * q.z);
+    float m13 = 2.0f * (q.x * q.z + q.w * q.y);
+    float m22 = 1.0f - 2.0f * (q.x * q.x + q.z * q.z);
+    float m23 = 2.0f * (q.y * q.z - q.w * q.x);
+    float m32 = 2.0f * (q.y * q.z + q.w * q.x);
+    float m33 = 1.0f - 2.0f * (q.x * q.x + q.y * q.y);
+
+    m13 = (m13 > 1.0f) ? 1.0f : ((m13 < -1.0f) ? -1.0f : m13);
+    rot[1] = asinf(m13);
+
+    if (fabsf(m13) < 0.9999999f)
+    {
+        rot[0] = atan2f(-m23, m33);
+        rot[2] = atan2f(-m12, m11);
+    }
+    else
+    {
+        rot[0] = atan2f(m32, m22);
+        rot[2] = 0.0f;
+    }
+}
+
+/**
+ * Rotates a world frame vector into the body frame.
+ */
+inline void QuatRotateToBody(const Quat &q, const float world[3], float body[3])
+{
+    Quat v = {0.0f, world[0], world[1], world[2]};
+    Quat r = QuatMul(QuatMul(QuatConj(q), v), q);
+    body[0] = r.x;
+    body[1] = r.y;
+    body[2] = r.z;
+}
+
+/**
+ * Rotates a body frame vector into the world frame.
+ */
+inline void QuatRotateToWorld(const Quat &q, const float body[3], float world[3])
+{
+    Quat v = {0.0f, body[0], body[1], body[2]};
+    Quat r = QuatMul(QuatMul(q, v), QuatConj(q));
+    world[0] = r.x;
+    world[1] = r.y;
+    world[2] = r.z;
+}
+
+/**
+ * Smallest-three compression into 32 bits. The largest component is dropped
+ * (its index is kept in the top 2 bits) and recovered from the unit length
+ * constraint; the other three lie in +/- 1/sqrt(2) and get 10 bits each.
+ * The sign is chosen so the dropped component is positive. Worst case error
+ * is about 0.15 degrees.
+ */
+#define QUAT_ST_BITS (10)
+#define QUAT_ST_MAX ((1 << QUAT_ST_BITS) - 1)
+#define QUAT_ST_RANGE (0.70710678f)
+
+inline uint32_t QuatPackSmallestThree(const Quat &q)
+{
+    float c[4] = {q.x, q.y, q.z, q.w};
+    int largest = 0;
+    for (int i = 1; i < 4; i++)
+    {
+        if (fabsf(c[i]) > fabsf(c[largest])) { largest = i; }
+    }
+
+    float sign = (c[largest] < 0.0f) ? -1.0f : 1.0f;
+    uint32_t packed = (uint32_t)largest << (3 * QUAT_ST_BITS);
+    int shift = 2 * QUAT_ST_BITS;
+    for (int i = 0; i < 4; i++)
+    {
+        if (i == largest) { continue; }
+        float v = (c[i] * sign + QUAT_ST_RANGE) * (QUAT_ST_MAX / (2.0f * QUAT_ST_RANGE)) + 0.5f;
+        int32_t iv = (int32_t)v;
+        iv = (iv < 0) ? 0 : ((iv > QUAT_ST_MAX) ? QUAT_ST_MAX : iv);
+        packed |= (uint32_t)iv << shift;
+        shift -= QUAT_ST_BITS;
+    }
+    return packed;
+}
+
+inline Quat QuatUnpackSmallestThree(uint32_t packed)
+{
+    float c[4];
+    int largest = packed >> (3 * QUAT_ST_BITS);
+    int shift = 2 * QUAT_ST_BITS;
+    float sum = 0.0f;
+    for (int i = 0; i < 4; i++)
+    {
+        if (i == largest) { continue; }
+        c[i] = ((packed >> shift) & QUAT_ST_MAX) * (2.0f * QUAT_ST_RANGE / QUAT_ST_MAX) - QUAT_ST_RANGE;
+        sum += c[i] * c[i];
+        shift -= QUAT_ST_BITS;
+    }
+    c[largest] = (sum < 1.0f) ? sqrtf(1.0f - sum) : 0.0f;
+
+    Quat q = {c[3], c[0], c[1], c[2]};
+    return q;
+}
+
+#endif /* _QUAT_H_ */
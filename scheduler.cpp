@@ -0,0 +1,190 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+/**
+ * Deadline-based periodic scheduler.
+ */
+
+// NB Constants
+#include <constants.h>
+
+// NB Libs
+#include <string.h>
+#include <ucos.h>
+
+#if (defined(NB_HOST_BUILD) || defined(MOD5441X) || defined(NANO54415))
+#define SCHED_USE_HIRES
+#include <HiResTimer.h>
+#endif
+
+#include "scheduler.h"
+#include "timing.h"
+
+#define SCHED_TICK_US (1000000 / TICKS_PER_SECOND)
+
+// The DMA timer used for the sub-tick part of each wait. Must not be the timestamp timer.
+#define SCHED_HIRES_TIMER (1)
+
+#ifdef SCHED_USE_HIRES
+static HiResTimer *pSchedTimer = nullptr;
+#endif
+
+PeriodicScheduler::PeriodicScheduler() : m_count(0)
+{
+    memset(m_stages, 0, sizeof(m_stages));
+}
+
+int PeriodicScheduler::AddStage(const char *name, void (*run)(uint32_t deadlineUs), uint32_t periodUs,
+                                SchedCatchUp catchUp, uint8_t maxBurst)
+{
+    if ((m_count >= SCHED_MAX_STAGES) || (periodUs == 0) || (run == nullptr)) { return -1; }
+
+    SchedStage &s = m_stages[m_count];
+    memset(&s, 0, sizeof(s));
+    s.name = name;
+    s.run = run;
+    s.periodUs = periodUs;
+    s.catchUp = catchUp;
+    s.maxBurst = (maxBurst == 0) ? 1 : maxBurst;
+    s.nextUs = TimingNowUs();
+    return m_count++;
+}
+
+bool PeriodicScheduler::SetPeriod(int stage, uint32_t periodUs)
+{
+    if ((stage < 0) || (stage >= m_count) || (periodUs == 0)) { return false; }
+    m_stages[stage].periodUs = periodUs;
+    return true;
+}
+
+void PeriodicScheduler::Start()
+{
+    uint32_t now = TimingNowUs();
+    for (int i = 0; i < m_count; i++)
+    {
+        m_stages[i].nextUs = now;
+    }
+}
+
+const SchedStage *PeriodicScheduler::GetStage(int stage) const
+{
+    if ((stage < 0) || (stage >= m_count)) { return nullptr; }
+    return &m_stages[stage];
+}
+
+/**
+ * @brief Serves a stage whose deadline has passed, applying its catch-up policy to any
+ * further deadlines that have also passed.
+ */
+void PeriodicScheduler::RunStage(SchedStage &s, uint32_t now)
+{
+    uint32_t late = (uint32_t)TimingDiffUs(now, s.nextUs);
+    uint32_t missed = late / s.periodUs;   // Later deadlines that have also passed
+    uint32_t runs = 1;
+
+    if (late > s.maxLateUs) { s.maxLateUs = late; }
+
+    if (missed > 0)
+    {
+        if (s.catchUp == SCHED_CATCHUP_BURST) { runs = (missed + 1 < s.maxBurst) ? missed + 1 : s.maxBurst; }
+
+        // Drop the oldest deadlines, so the runs we do make are the most recent ones
+        uint32_t dropped = missed + 1 - runs;
+        s.skipped += dropped;
+        s.nextUs += dropped * s.periodUs;
+    }
+
+    while (runs-- > 0)
+    {
+        uint32_t start = TimingNowUs();
+        s.run(s.nextUs);
+        uint32_t work = TimingNowUs() - start;
+
+        s.runs++;
+        if (work > s.maxWorkUs) { s.maxWorkUs = work; }
+        if (work > s.periodUs) { s.overruns++; }
+        s.nextUs += s.periodUs;
+    }
+}
+
+/**
+ * @brief Runs every stage that is due, in the order they were added, and returns the
+ * earliest next deadline.
+ */
+uint32_t PeriodicScheduler::RunDue()
+{
+    for (int i = 0; i < m_count; i++)
+    {
+        SchedStage &s = m_stages[i];
+        uint32_t now = TimingNowUs();
+        if (TimingDiffUs(now, s.nextUs) >= 0) { RunStage(s, now); }
+    }
+
+    uint32_t now = TimingNowUs();
+    uint32_t next = now + SCHED_TICK_US;
+    for (int i = 0; i < m_count; i++)
+    {
+        if (TimingDiffUs(m_stages[i].nextUs, next) < 0) { next = m_stages[i].nextUs; }
+    }
+    return next;
+}
+
+/**
+ * @brief Sleeps until deadlineUs. Whole ticks are slept with OSTimeDly() so lower priority
+ * tasks get the time. With a HiResTimer the remainder is timed exactly; without one the
+ * wait ends on the first tick at or after the deadline.
+ */
+void SchedWaitUntil(uint32_t deadlineUs)
+{
+    int32_t remaining = TimingDiffUs(deadlineUs, TimingNowUs());
+
+#ifdef SCHED_USE_HIRES
+    if (pSchedTimer == nullptr)
+    {
+        pSchedTimer = HiResTimer::getHiResTimer(SCHED_HIRES_TIMER);
+        if (pSchedTimer != nullptr) { pSchedTimer->init(); }
+    }
+
+    if (pSchedTimer != nullptr)
+    {
+        // OSTimeDly(n) can end up to a tick early, so leave the last tick to the timer
+        if (remaining >= 2 * SCHED_TICK_US)
+        {
+            OSTimeDly((remaining / SCHED_TICK_US) - 1);
+            remaining = TimingDiffUs(deadlineUs, TimingNowUs());
+        }
+        if (remaining > 0) { pSchedTimer->delay(remaining / 1000000.0); }
+        return;
+    }
+#endif
+
+    while (remaining > 0)
+    {
+        OSTimeDly((remaining + SCHED_TICK_US - 1) / SCHED_TICK_US);
+        remaining = TimingDiffUs(deadlineUs, TimingNowUs());
+    }
+}
@@ -0,0 +1,120 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+#ifndef _SCHEDULER_H_
+#define _SCHEDULER_H_
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Deadline-based periodic scheduler.
+ *
+ * Each stage runs on its own absolute timeline: the k-th run is due at
+ * start + k * period, however long earlier runs took, so rates do not drift
+ * with the cost of the work. The scheduler sleeps until the earliest
+ * deadline rather than for a fixed delay.
+ *
+ * On platforms with a HiResTimer the last part of each wait uses the timer,
+ * so periods need not be a multiple of the OS tick. Elsewhere wakeups are
+ * rounded up to the next tick, which delays a run but never moves its
+ * deadline.
+ *
+ * A run that starts more than one period late has missed deadlines. The
+ * stage's catch-up policy decides what happens to them:
+ *   SCHED_CATCHUP_SKIP   run once and realign to the next future deadline.
+ *                        Right for stages that only care about the newest
+ *                        value, such as sending telemetry.
+ *   SCHED_CATCHUP_BURST  run back to back once per missed deadline, up to
+ *                        maxBurst runs, then skip the rest. Right for
+ *                        sampling, where every slot should produce a sample.
+ * A run whose own work takes longer than its period counts as an overrun.
+ *
+ * All stages run in the task that calls RunDue(), in the order they were
+ * added, so a stage always sees the work of the stages before it that were
+ * due at the same time. A typical loop is:
+ *
+ *     sched.Start();
+ *     while (1) { SchedWaitUntil(sched.RunDue()); }
+ */
+
+#define SCHED_MAX_STAGES (8)
+#define SCHED_DEFAULT_BURST (4)
+
+enum SchedCatchUp
+{
+    SCHED_CATCHUP_SKIP,
+    SCHED_CATCHUP_BURST
+};
+
+struct SchedStage
+{
+    const char *name;
+    void (*run)(uint32_t deadlineUs);   // Called with the deadline being served
+    uint32_t periodUs;
+    SchedCatchUp catchUp;
+    uint8_t maxBurst;
+    uint32_t nextUs;        // Absolute deadline of the next run
+    uint32_t runs;
+    uint32_t overruns;      // Runs whose work took longer than the period
+    uint32_t skipped;       // Deadlines dropped by the catch-up policy
+    uint32_t maxLateUs;     // Largest delay between a deadline and its run
+    uint32_t maxWorkUs;     // Longest single run
+};
+
+class PeriodicScheduler
+{
+  public:
+    PeriodicScheduler();
+
+    // Returns the stage index, or -1 when the table is full or the period is zero
+    int AddStage(const char *name, void (*run)(uint32_t deadlineUs), uint32_t periodUs,
+                 SchedCatchUp catchUp = SCHED_CATCHUP_SKIP, uint8_t maxBurst = SCHED_DEFAULT_BURST);
+
+    // Changes a stage's rate. The new timeline starts from the stage's next deadline.
+    bool SetPeriod(int stage, uint32_t periodUs);
+
+    // Aligns every stage to now. Call once before the first RunDue().
+    void Start();
+
+    // Runs every stage that is due and returns the earliest next deadline
+    uint32_t RunDue();
+
+    int StageCount() const { return m_count; }
+    const SchedStage *GetStage(int stage) const;
+
+  private:
+    void RunStage(SchedStage &s, uint32_t now);
+
+    SchedStage m_stages[SCHED_MAX_STAGES];
+    int m_count;
+};
+
+// Sleeps until TimingNowUs() reaches deadlineUs
+void SchedWaitUntil(uint32_t deadlineUs);
+
+#endif /* _SCHEDULER_H_ */
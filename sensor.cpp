@@ -0,0 +1,395 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+/**
+ * Sensor source implementations: the interrupt/DMA queue, the random-walk
+ * simulator and file replay.
+ */
+
+// NB Libs
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucos.h>
+
+#include "sensor.h"
+#include "timing.h"
+
+#define REPLAY_LINE_SIZE (256)
+
+// World frame field directions seen by the simulated IMU: gravity straight up
+// (an accelerometer at rest reads +1 g), and a magnetic field pointing north
+// and dipping down
+static const float SimGravity[3] = {0.0f, 1.0f, 0.0f};
+static const float SimField[3] = {0.0f, -0.5f, -0.866f};
+
+/**
+ * @brief Creates an empty queue for an interrupt or DMA driven source.
+ */
+QueuedSensorSource::QueuedSensorSource(SensorMode mode)
+    : m_mode(mode), m_head(0), m_tail(0), m_seq(0), m_overflows(0)
+{
+}
+
+// Keeps the compiler from moving queue slot accesses across a head or tail update. The
+// ColdFire runs the producer and consumer on one core, so no hardware barrier is needed.
+#define QUEUE_BARRIER() asm volatile("" ::: "memory")
+
+/**
+ * @brief Queues one sample from interrupt level. Returns false if the queue was full.
+ */
+bool QueuedSensorSource::PushSample(SensorSample &sample)
+{
+    uint32_t head = m_head;
+    if ((head - m_tail) >= SENSOR_QUEUE_DEPTH)
+    {
+        m_overflows++;
+        return false;
+    }
+
+    sample.timeUs = TimingNowUs();
+    sample.seq = m_seq++;
+    m_queue[head & (SENSOR_QUEUE_DEPTH - 1)] = sample;
+    QUEUE_BARRIER();
+    m_head = head + 1;   // Publish only after the slot is filled
+    return true;
+}
+
+/**
+ * @brief Drains queued samples in the order they were acquired.
+ */
+int QueuedSensorSource::Read(SensorSample *samples, int max)
+{
+    int n = 0;
+    uint32_t tail = m_tail;
+    uint32_t head = m_head;
+    QUEUE_BARRIER();   // Read slots only after seeing the head that published them
+    while ((n < max) && (tail != head))
+    {
+        samples[n++] = m_queue[tail & (SENSOR_QUEUE_DEPTH - 1)];
+        tail++;
+    }
+    QUEUE_BARRIER();   // Free the slots only after they have been copied
+    m_tail = tail;
+    return n;
+}
+
+/**
+ * @brief Creates the simulator with every object at the origin.
+ */
+SimSensorSource::SimSensorSource(int objects) : m_lastUs(0), m_seq(0)
+{
+    InitPoseBatch(m_poses, objects);
+    for (int i = 0; i < POSE_MAX_OBJECTS; i++)
+    {
+        m_lastQ[i] = QuatIdentity();
+    }
+}
+
+/**
+ * @brief Fills in the IMU readings for a sample whose pose has been set. The gyro reading is the
+ * body frame rotation since the previous step, spread over dt.
+ */
+void SimSensorSource::SynthesizeImu(SensorSample &s, float dt)
+{
+    Quat q = QuatFromEulerXYZ(s.rot);
+    QuatRotateToBody(q, SimGravity, s.accel);
+    QuatRotateToBody(q, SimField, s.mag);
+
+    Quat dq = QuatMul(QuatConj(m_lastQ[s.object]), q);
+    float scale = (dt > 0.0f) ? (2.0f / dt) : 0.0f;
+    if (dq.w < 0.0f) { scale = -scale; }
+    s.gyro[0] = dq.x * scale;
+    s.gyro[1] = dq.y * scale;
+    s.gyro[2] = dq.z * scale;
+
+    m_lastQ[s.object] = q;
+    s.flags |= SAMPLE_HAS_IMU;
+}
+
+/**
+ * @brief This function manages the goal positions and rotations for the simulated objects
+ * to move to. Once they get within a certain distance of the goal value, we pick new ones.
+ *
+ * The rotation values are in radians.
+ */
+int SimSensorSource::Read(SensorSample *samples, int max)
+{
+    uint32_t posArrived, rotArrived;
+    IntegratePoseBatch(m_poses, posArrived, rotArrived);
+    uint32_t now = PollTimeUs();
+
+    // Close enough, pick new points and rotation values for whichever objects arrived
+    for (int obj = 0; (posArrived | rotArrived) != 0; obj++, posArrived >>= 1, rotArrived >>= 1)
+    {
+        if (posArrived & 1) { PickPosGoal(m_poses, obj); }
+        if (rotArrived & 1) { PickRotGoal(m_poses, obj); }
+    }
+
+    float dt = (m_seq == 0) ? 0.0f : TimingDiffUs(now, m_lastUs) / 1000000.0f;
+    m_lastUs = now;
+
+    int n = (max < m_poses.count) ? max : m_poses.count;
+    for (int obj = 0; obj < n; obj++)
+    {
+        SensorSample &s = samples[obj];
+        memset(&s, 0, sizeof(s));
+        s.seq = m_seq;
+        s.timeUs = now;
+        s.object = obj;
+        s.flags = SAMPLE_HAS_POSE;
+        for (int i = 0; i < 3; i++)
+        {
+            s.pos[i] = m_poses.pos[i][obj];
+            s.rot[i] = m_poses.rot[i][obj];
+        }
+        SynthesizeImu(s, dt);
+    }
+    m_seq++;
+
+    return n;
+}
+
+/**
+ * @brief Creates a replay source. Nothing is opened until Start().
+ */
+ReplaySensorSource::ReplaySensorSource(const char *fileName, bool loop)
+    : m_fileName(fileName), m_loop(loop), m_file(nullptr), m_pending(false), m_firstRecUs(0), m_startUs(0), m_seq(0)
+{
+}
+
+/**
+ * @brief Opens the recording. Must be called from a task that has entered the file system.
+ */
+bool ReplaySensorSource::Start()
+{
+    m_file = f_open((char *)m_fileName, "r");
+    if (m_file == nullptr)
+    {
+        iprintf("Could not open replay file %s\r\n", m_fileName);
+        return false;
+    }
+
+    m_pending = ReadNextLine();
+    m_firstRecUs = m_next.timeUs;
+    m_startUs = TimingNowUs();
+    return m_pending;
+}
+
+/**
+ * @brief Closes the recording.
+ */
+void ReplaySensorSource::Stop()
+{
+    if (m_file != nullptr)
+    {
+        f_close(m_file);
+        m_file = nullptr;
+    }
+    m_pending = false;
+}
+
+/**
+ * @brief Parses the next sample line into m_next. Returns false at the end of the file.
+ */
+bool ReplaySensorSource::ReadNextLine()
+{
+    char line[REPLAY_LINE_SIZE];
+
+    while (f_fgets(line, REPLAY_LINE_SIZE, m_file) != nullptr)
+    {
+        if ((line[0] == '#') || (line[0] == '\r') || (line[0] == '\n') || (line[0] == '\0')) { continue; }
+
+        float v[15];
+        char *p = line;
+        char *end;
+
+        memset(&m_next, 0, sizeof(m_next));
+        m_next.timeUs = strtoul(p, &end, 10);
+        if ((end == p) || (*end != ',')) { continue; }
+        p = end + 1;
+        m_next.object = (uint8_t)strtoul(p, &end, 10);
+
+        int count = 0;
+        while ((count < 15) && (*end == ','))
+        {
+            p = end + 1;
+            v[count] = (float)strtod(p, &end);
+            if (end == p) { break; }
+            count++;
+        }
+        if (count < 6) { continue; }   // Malformed line
+
+        memcpy(m_next.pos, &v[0], sizeof(m_next.pos));
+        memcpy(m_next.rot, &v[3], sizeof(m_next.rot));
+        m_next.flags = SAMPLE_HAS_POSE;
+        if (count == 15)
+        {
+            memcpy(m_next.accel, &v[6], sizeof(m_next.accel));
+            memcpy(m_next.gyro, &v[9], sizeof(m_next.gyro));
+            memcpy(m_next.mag, &v[12], sizeof(m_next.mag));
+            m_next.flags |= SAMPLE_HAS_IMU;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Returns every recorded sample whose time has come, restamped onto the local clock.
+ */
+int ReplaySensorSource::Read(SensorSample *samples, int max)
+{
+    if (m_file == nullptr) { return 0; }
+
+    uint32_t now = PollTimeUs();
+    int n = 0;
+
+    while (n < max)
+    {
+        if (!m_pending)
+        {
+            if (!m_loop) { break; }
+
+            // Start over, keeping the local clock running so time never goes backwards
+            f_rewind(m_file);
+            if (!ReadNextLine()) { break; }
+            m_firstRecUs = m_next.timeUs;
+            m_startUs = now;
+            m_pending = true;
+        }
+
+        uint32_t offset = m_next.timeUs - m_firstRecUs;
+        if (TimingDiffUs(now, m_startUs + offset) < 0) { break; }   // Not due yet
+
+        samples[n] = m_next;
+        samples[n].timeUs = m_startUs + offset;
+        samples[n].seq = m_seq++;
+        n++;
+
+        m_pending = ReadNextLine();
+    }
+
+    return n;
+}
+
+/**
+ * @brief Creates a recorder. Nothing is opened until Open().
+ */
+SensorRecorder::SensorRecorder(const char *fileName)
+    : m_fileName(fileName), m_head(0), m_tail(0), m_dropped(0)
+{
+}
+
+/**
+ * @brief Creates or truncates the recording file, or opens it for appending. The header line
+ * is written either way; the replay source skips it wherever it appears.
+ */
+bool SensorRecorder::Open(bool append)
+{
+    if (!m_writer.Open(m_fileName, RECORD_COMMIT_TICKS, !append))
+    {
+        iprintf("Could not create recording file %s\r\n", m_fileName);
+        return false;
+    }
+
+    static const char header[] = "# timeUs,object,px,py,pz,rx,ry,rz,ax,ay,az,gx,gy,gz,mx,my,mz\n";
+    m_writer.Write(header, sizeof(header) - 1);
+    return true;
+}
+
+void SensorRecorder::Close()
+{
+    if (m_writer.IsOpen())
+    {
+        Flush();
+        m_writer.Close();
+    }
+}
+
+/**
+ * @brief Queues a sample for the next Flush().
+ */
+void SensorRecorder::Add(const SensorSample &sample)
+{
+    if (!m_writer.IsOpen()) { return; }
+    if ((m_head - m_tail) >= RECORD_QUEUE_DEPTH)
+    {
+        m_dropped++;
+        return;
+    }
+    m_queue[m_head & (RECORD_QUEUE_DEPTH - 1)] = sample;
+    m_head++;
+}
+
+/**
+ * @brief Appends ",value" with six decimals. The NNDK printf family has no floating point
+ * support, so the value is split into whole and fractional parts by hand.
+ */
+static int FormatFixed(char *buf, int size, float v)
+{
+    const char *sign = "";
+    if (v < 0.0f)
+    {
+        sign = "-";
+        v = -v;
+    }
+    uint32_t micro = (uint32_t)(v * 1000000.0f + 0.5f);
+    return sniprintf(buf, size, ",%s%lu.%06lu", sign, (unsigned long)(micro / 1000000), (unsigned long)(micro % 1000000));
+}
+
+/**
+ * @brief Formats every queued sample, one line per sample, into the writer. The
+ * writer decides when the lines reach the card.
+ */
+void SensorRecorder::Flush()
+{
+    if (!m_writer.IsOpen()) { return; }
+
+    while (m_tail != m_head)
+    {
+        const SensorSample &s = m_queue[m_tail & (RECORD_QUEUE_DEPTH - 1)];
+        char line[REPLAY_LINE_SIZE];
+        int n = sniprintf(line, sizeof(line), "%lu,%u", (unsigned long)s.timeUs, (unsigned)s.object);
+
+        const float *values[5] = {s.pos, s.rot, s.accel, s.gyro, s.mag};
+        int groups = (s.flags & SAMPLE_HAS_IMU) ? 5 : 2;
+        for (int g = 0; g < groups; g++)
+        {
+            for (int i = 0; i < 3; i++)
+            {
+                n += FormatFixed(line + n, sizeof(line) - n, values[g][i]);
+            }
+        }
+        line[n++] = '\n';
+
+        m_writer.Write(line, n);
+        m_tail++;
+    }
+    m_writer.Poll();   // Commits on time even when nothing was queued
+}
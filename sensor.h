@@ -0,0 +1,246 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+#ifndef _SENSOR_H_
+#define _SENSOR_H_
+#pragma once
+
+#include <stdint.h>
+#include <effs_fat/fat.h>
+
+#include "FileSystemUtils.h"
+#include "pose.h"
+#include "quat.h"
+#include "timing.h"
+
+/**
+ * Sensor sources.
+ *
+ * Everything downstream of the sensor (fusion, telemetry, recording) reads
+ * samples through the SensorSource interface, so the random-walk simulator,
+ * a file replay or a real IMU driver can be swapped without touching the
+ * rest of the application.
+ *
+ * Samples are timestamped when they are acquired: in Read() for polled
+ * sources, and in the interrupt or DMA completion handler for queued ones.
+ * They are never restamped when they are sent.
+ *
+ * A polled source that is read on a fixed schedule can be given the time of
+ * the slot being served with SetPollTime(), so its samples are exactly one
+ * period apart however late the reading task wakes. How late it woke is
+ * reported by the scheduler instead (see scheduler.h).
+ */
+
+#define SENSOR_READ_MAX (POSE_MAX_OBJECTS)   // Most samples returned by a single Read()
+#define SENSOR_QUEUE_DEPTH (16)              // Must be a power of 2
+
+// SensorSample::flags
+#define SAMPLE_HAS_POSE (0x01)   // pos and rot are valid
+#define SAMPLE_HAS_IMU (0x02)    // accel, gyro and mag are valid
+
+struct SensorSample
+{
+    uint32_t seq;       // Per-source sample counter
+    uint32_t timeUs;    // TimingNowUs() at acquisition
+    uint8_t object;     // Which tracked object the sample belongs to
+    uint8_t flags;
+    float accel[3];     // g
+    float gyro[3];      // rad/s
+    float mag[3];       // Any consistent unit, only the direction is used
+    float pos[3];
+    float rot[3];       // Euler radians, XYZ order
+};
+
+enum SensorMode
+{
+    SENSOR_MODE_POLL,        // Acquired synchronously inside Read()
+    SENSOR_MODE_INTERRUPT,   // Acquired by an ISR and queued
+    SENSOR_MODE_DMA          // Acquired by DMA and queued from the completion handler
+};
+
+class SensorSource
+{
+  public:
+    SensorSource() : m_pollTimeSet(false), m_pollUs(0) {}
+    virtual ~SensorSource() {}
+
+    virtual const char *Name() const = 0;
+    virtual SensorMode Mode() const = 0;
+
+    // Number of objects the source reports on
+    virtual int ObjectCount() const { return 1; }
+
+    virtual bool Start() { return true; }
+    virtual void Stop() {}
+
+    /**
+     * Copies up to max new samples into samples and returns how many were
+     * copied. Never blocks; returns 0 if nothing new is available.
+     */
+    virtual int Read(SensorSample *samples, int max) = 0;
+
+    // Polled sources stamp the next Read() with timeUs instead of the clock
+    void SetPollTime(uint32_t timeUs)
+    {
+        m_pollUs = timeUs;
+        m_pollTimeSet = true;
+    }
+
+  protected:
+    // The acquisition time for a polled Read()
+    uint32_t PollTimeUs() const { return m_pollTimeSet ? m_pollUs : TimingNowUs(); }
+
+  private:
+    bool m_pollTimeSet;
+    uint32_t m_pollUs;
+};
+
+/**
+ * Base for interrupt and DMA driven drivers. The driver calls PushSample()
+ * from its ISR or DMA completion handler; Read() drains the queue from task
+ * context. The queue has a single producer and a single consumer, so no lock
+ * is needed. When the queue is full the newest sample is dropped and counted.
+ */
+class QueuedSensorSource : public SensorSource
+{
+  public:
+    QueuedSensorSource(SensorMode mode);
+
+    virtual SensorMode Mode() const { return m_mode; }
+    virtual int Read(SensorSample *samples, int max);
+
+    uint32_t Overflows() const { return m_overflows; }
+
+  protected:
+    // Safe to call from interrupt level. Stamps timeUs and seq.
+    bool PushSample(SensorSample &sample);
+
+  private:
+    SensorMode m_mode;
+    SensorSample m_queue[SENSOR_QUEUE_DEPTH];
+    volatile uint32_t m_head;   // Written only by the producer
+    volatile uint32_t m_tail;   // Written only by the consumer
+    uint32_t m_seq;
+    uint32_t m_overflows;
+};
+
+/**
+ * The original random-walk simulation. Every Read() advances all objects
+ * one step and returns a sample for each of them. Besides the pose itself,
+ * each sample carries the accelerometer, gyro and magnetometer readings a
+ * real IMU would produce for that motion, so the fusion stage can be
+ * exercised without hardware.
+ */
+class SimSensorSource : public SensorSource
+{
+  public:
+    SimSensorSource(int objects);
+
+    virtual const char *Name() const { return "Simulator"; }
+    virtual SensorMode Mode() const { return SENSOR_MODE_POLL; }
+    virtual int ObjectCount() const { return m_poses.count; }
+    virtual int Read(SensorSample *samples, int max);
+
+  private:
+    void SynthesizeImu(SensorSample &s, float dt);
+
+    PoseBatch m_poses;
+    Quat m_lastQ[POSE_MAX_OBJECTS];
+    uint32_t m_lastUs;
+    uint32_t m_seq;
+};
+
+/**
+ * Replays samples recorded as text, one sample per line:
+ *
+ *     timeUs,object,px,py,pz,rx,ry,rz[,ax,ay,az,gx,gy,gz,mx,my,mz]
+ *
+ * Lines starting with '#' are ignored. Samples are released with the same
+ * spacing they were recorded with, and restamped onto the local clock so
+ * that the recorded spacing is preserved.
+ */
+class ReplaySensorSource : public SensorSource
+{
+  public:
+    ReplaySensorSource(const char *fileName, bool loop);
+
+    virtual const char *Name() const { return "Replay"; }
+    virtual SensorMode Mode() const { return SENSOR_MODE_POLL; }
+    virtual bool Start();
+    virtual void Stop();
+    virtual int Read(SensorSample *samples, int max);
+
+  private:
+    bool ReadNextLine();
+
+    const char *m_fileName;
+    bool m_loop;
+    F_FILE *m_file;
+    bool m_pending;           // m_next holds a parsed sample not yet returned
+    SensorSample m_next;
+    uint32_t m_firstRecUs;    // Recorded time of the first sample in the file
+    uint32_t m_startUs;       // Local time the first sample was released
+    uint32_t m_seq;
+};
+
+/**
+ * Records samples in the format ReplaySensorSource reads. Add() only queues
+ * the sample, so it is cheap enough for the sampling path; Flush() formats
+ * everything queued into a BufferedFileWriter. When the queue is full the
+ * newest samples are dropped and counted.
+ *
+ * The writer commits to the card every RECORD_COMMIT_TICKS, so a power cut
+ * loses at most that much of the recording.
+ */
+#define RECORD_QUEUE_DEPTH (64)   // Must be a power of 2
+#define RECORD_COMMIT_TICKS (5 * TICKS_PER_SECOND)
+
+class SensorRecorder
+{
+  public:
+    SensorRecorder(const char *fileName);
+
+    // Must be called from a task that has entered the file system. With append set, a new
+    // recording continues the existing file, as after the flash card is reinserted.
+    bool Open(bool append = false);
+    void Close();
+
+    void Add(const SensorSample &sample);
+    void Flush();
+
+    uint32_t Dropped() const { return m_dropped; }
+
+  private:
+    const char *m_fileName;
+    BufferedFileWriter m_writer;
+    SensorSample m_queue[RECORD_QUEUE_DEPTH];
+    uint32_t m_head;
+    uint32_t m_tail;
+    uint32_t m_dropped;
+};
+
+#endif /* _SENSOR_H_ */
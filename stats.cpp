@@ -0,0 +1,414 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+/**
+ * Runtime performance counters, /stats snapshot and diagnostics channel.
+ */
+
+// NB Libs
+#include <constants.h>
+#include <iosys.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <tcp.h>
+#include <ucos.h>
+
+#include "cardindex.h"
+#include "clients.h"
+#include "events.h"
+#include "log.h"
+#include "mount.h"
+#include "multicast.h"
+#include "pool.h"
+#include "scheduler.h"
+#include "stats.h"
+#include "timing.h"
+
+#define STATS_TICK_US (1000000 / TICKS_PER_SECOND)
+
+uint32_t StatCounters[STAT_TASK_COUNT][STAT_COUNT];
+StatHist StatHists[STAT_TASK_COUNT][STAT_HIST_COUNT];
+
+static const char *CounterNames[STAT_COUNT] = {
+    "http_requests",  "http_bytes",       "http_embedded_bytes", "http_not_modified", "http_bad_urls",
+    "telemetry_bytes", "frames_sent",     "frames_dropped",      "ftp_retr_bytes",    "ftp_stor_bytes",
+    "ftp_transfer_ms", "ftp_list_entries", "ftp_list_cut",       "cache_hits",        "cache_misses",
+    "card_mounts",    "card_removals",    "card_mount_failures", "ticks",             "tick_overruns"};
+
+static const char *HistNames[STAT_HIST_COUNT] = {"writeall_us", "sd_read_us", "tick_work_us"};
+
+static const char *BootMarkNames[BOOT_MARK_COUNT] = {"network_up_ms", "first_pose_ms", "card_mounted_ms",
+                                                     "card_indexed_ms"};
+
+// Boot milestones. Each is written once, by whichever task reaches it first.
+static uint32_t BootStartUs;
+static uint32_t BootOsMs;   // Time the OS had been running at StatsBootStart(), covers init()
+static volatile uint32_t BootMs[BOOT_MARK_COUNT];
+static volatile bool BootReached[BOOT_MARK_COUNT];
+
+// The latest snapshot, built by the main task and read by the HTTP task
+static OS_CRIT SnapshotCrit;
+static char Snapshot[STATS_JSON_MAX];
+static int SnapshotLen = 0;
+static char SnapshotBuild[STATS_JSON_MAX];   // Only used by StatsService()
+
+static const PeriodicScheduler *pStatsScheduler = nullptr;
+static uint32_t LastSnapshotUs;
+static uint32_t LastHttpBytes;
+static uint32_t LastTelemetryBytes;
+static uint32_t LastFtpBytes;
+
+// Diagnostics WebSockets, handed over by the HTTP task like telemetry clients
+static OS_CRIT DiagCrit;
+static int DiagFd[MAX_DIAG_CLIENTS];
+static int DiagSock[MAX_DIAG_CLIENTS];   // The TCP socket under each, for send space
+static int IncomingDiagFd[MAX_DIAG_CLIENTS];
+static int IncomingDiagSock[MAX_DIAG_CLIENTS];
+static int IncomingDiagCount = 0;
+
+/**
+ * @brief Clears the counters. Must be called before the web server starts.
+ */
+void InitStats()
+{
+    memset(StatCounters, 0, sizeof(StatCounters));
+    memset(StatHists, 0, sizeof(StatHists));
+    for (int i = 0; i < MAX_DIAG_CLIENTS; i++)
+    {
+        DiagFd[i] = -1;
+    }
+    IncomingDiagCount = 0;
+    SnapshotLen = 0;
+    LastSnapshotUs = TimingNowUs();
+    OSCritInit(&SnapshotCrit);
+    OSCritInit(&DiagCrit);
+}
+
+void StatsBootStart()
+{
+    BootStartUs = TimingNowUs();
+    BootOsMs = (uint32_t)(((uint64_t)TimeTick * 1000) / TICKS_PER_SECOND);
+}
+
+void StatsBootMark(BootMark mark)
+{
+    if (BootReached[mark]) { return; }
+    BootMs[mark] = (TimingNowUs() - BootStartUs) / 1000;
+    BootReached[mark] = true;
+
+    if ((mark == BOOT_FIRST_POSE) && (BootMs[mark] > BOOT_BUDGET_MS))
+    {
+        LOG_WARN("Boot: %s %lu, over the %d ms budget\r\n", BootMarkNames[mark], (unsigned long)BootMs[mark],
+                 BOOT_BUDGET_MS);
+    }
+    else
+    {
+        LOG_INFO("Boot: %s %lu\r\n", BootMarkNames[mark], (unsigned long)BootMs[mark]);
+    }
+}
+
+void StatsTickDone(uint32_t startUs)
+{
+    uint32_t us = TimingNowUs() - startUs;
+    StatsAdd(STAT_TASK_MAIN, STAT_TICKS);
+    StatsRecordUs(STAT_TASK_MAIN, STAT_HIST_TICK_WORK, us);
+    if (us > STATS_TICK_US) { StatsAdd(STAT_TASK_MAIN, STAT_TICK_OVERRUNS); }
+}
+
+void StatsSetScheduler(const PeriodicScheduler *sched)
+{
+    pStatsScheduler = sched;
+}
+
+bool AddDiagClient(int fd, int sock)
+{
+    bool added = false;
+    OSCritEnter(&DiagCrit, 0);
+    if (IncomingDiagCount < MAX_DIAG_CLIENTS)
+    {
+        IncomingDiagFd[IncomingDiagCount] = fd;
+        IncomingDiagSock[IncomingDiagCount] = sock;
+        IncomingDiagCount++;
+        added = true;
+    }
+    OSCritLeave(&DiagCrit);
+    return added;
+}
+
+static uint32_t SumCounter(StatCounter counter)
+{
+    uint32_t total = 0;
+    for (int t = 0; t < STAT_TASK_COUNT; t++)
+    {
+        total += StatCounters[t][counter];
+    }
+    return total;
+}
+
+static void SumHist(StatHistogram hist, StatHist &out)
+{
+    memset(&out, 0, sizeof(out));
+    for (int t = 0; t < STAT_TASK_COUNT; t++)
+    {
+        const StatHist &h = StatHists[t][hist];
+        out.count += h.count;
+        if (h.maxUs > out.maxUs) { out.maxUs = h.maxUs; }
+        for (int b = 0; b < STAT_HIST_BUCKETS; b++)
+        {
+            out.bucket[b] += h.bucket[b];
+        }
+    }
+}
+
+// Upper bound of the bucket holding the given percentile
+static uint32_t HistPercentile(const StatHist &h, uint32_t pct)
+{
+    if (h.count == 0) { return 0; }
+    uint32_t target = (uint32_t)(((uint64_t)h.count * pct + 99) / 100);
+    uint32_t seen = 0;
+    for (int b = 0; b < STAT_HIST_BUCKETS - 1; b++)
+    {
+        seen += h.bucket[b];
+        if (seen >= target)
+        {
+            uint32_t upper = (b == 0) ? 0 : ((1u << b) - 1);
+            return (upper < h.maxUs) ? upper : h.maxUs;
+        }
+    }
+    return h.maxUs;
+}
+
+static uint32_t PerSecond(uint32_t delta, uint32_t elapsedUs)
+{
+    if (elapsedUs == 0) { return 0; }
+    return (uint32_t)((uint64_t)delta * 1000000 / elapsedUs);
+}
+
+/**
+ * @brief Appends formatted text, never running past the end of the buffer.
+ */
+static void Append(char *buf, int size, int &len, const char *format, ...)
+{
+    if (len >= size - 1) { return; }
+    va_list ap;
+    va_start(ap, format);
+    int n = vsniprintf(buf + len, size - len, format, ap);
+    va_end(ap);
+    len += (n < 0) ? 0 : n;
+    if (len > size - 1) { len = size - 1; }
+}
+
+static int BuildSnapshot(char *buf, int size, uint32_t elapsedUs)
+{
+    int len = 0;
+
+    uint32_t httpBytes = SumCounter(STAT_HTTP_BYTES);
+    uint32_t telemetryBytes = SumCounter(STAT_TELEMETRY_BYTES);
+    uint32_t ftpBytes = SumCounter(STAT_FTP_RETR_BYTES) + SumCounter(STAT_FTP_STOR_BYTES);
+
+    Append(buf, size, len, "{\"uptime_s\":%lu,\"counters\":{", (unsigned long)Secs);
+    for (int c = 0; c < STAT_COUNT; c++)
+    {
+        Append(buf, size, len, "%s\"%s\":%lu", c ? "," : "", CounterNames[c], (unsigned long)SumCounter((StatCounter)c));
+    }
+
+    Append(buf, size, len, "},\"bytes_per_s\":{\"http\":%lu,\"telemetry\":%lu,\"ftp\":%lu}",
+           (unsigned long)PerSecond(httpBytes - LastHttpBytes, elapsedUs),
+           (unsigned long)PerSecond(telemetryBytes - LastTelemetryBytes, elapsedUs),
+           (unsigned long)PerSecond(ftpBytes - LastFtpBytes, elapsedUs));
+    LastHttpBytes = httpBytes;
+    LastTelemetryBytes = telemetryBytes;
+    LastFtpBytes = ftpBytes;
+
+    // Average rate while transfers were running, rather than over the whole uptime
+    uint32_t ftpMs = SumCounter(STAT_FTP_TRANSFER_MS);
+    Append(buf, size, len, ",\"ftp_bytes_per_s\":%lu", (unsigned long)(ftpMs ? ((uint64_t)ftpBytes * 1000 / ftpMs) : 0));
+
+    uint32_t hits = SumCounter(STAT_CACHE_HITS);
+    uint32_t lookups = hits + SumCounter(STAT_CACHE_MISSES);
+    Append(buf, size, len, ",\"cache_hit_pct\":%lu", (unsigned long)(lookups ? ((uint64_t)hits * 100 / lookups) : 0));
+
+    MountStatus ms;
+    MountGetStatus(ms);
+    Append(buf, size, len, ",\"card\":{\"state\":\"%s\",\"write_protected\":%s,\"generation\":%lu}",
+           MountStateName(ms.state), ms.writeProtected ? "true" : "false", (unsigned long)ms.generation);
+
+    Append(buf, size, len, ",\"boot\":{\"os_ms\":%lu,\"budget_ms\":%d", (unsigned long)BootOsMs, BOOT_BUDGET_MS);
+    for (int m = 0; m < BOOT_MARK_COUNT; m++)
+    {
+        if (BootReached[m]) { Append(buf, size, len, ",\"%s\":%lu", BootMarkNames[m], (unsigned long)BootMs[m]); }
+        else { Append(buf, size, len, ",\"%s\":null", BootMarkNames[m]); }
+    }
+
+    CardIndexStatus cs;
+    CardIndexGetStatus(cs);
+    Append(buf, size, len, "},\"card_index\":{\"ready\":%s,\"files\":%lu,\"headers\":%lu,\"builds\":%lu,\"last_build_ms\":%lu}",
+           cs.ready ? "true" : "false", (unsigned long)cs.files, (unsigned long)cs.headers, (unsigned long)cs.builds,
+           (unsigned long)cs.lastBuildMs);
+
+    Append(buf, size, len, ",\"histograms\":{");
+    for (int h = 0; h < STAT_HIST_COUNT; h++)
+    {
+        StatHist sum;
+        SumHist((StatHistogram)h, sum);
+        Append(buf, size, len, "%s\"%s\":{\"count\":%lu,\"p50\":%lu,\"p99\":%lu,\"max\":%lu,\"buckets\":[", h ? "," : "",
+               HistNames[h], (unsigned long)sum.count, (unsigned long)HistPercentile(sum, 50),
+               (unsigned long)HistPercentile(sum, 99), (unsigned long)sum.maxUs);
+        for (int b = 0; b < STAT_HIST_BUCKETS; b++)
+        {
+            Append(buf, size, len, "%s%lu", b ? "," : "", (unsigned long)sum.bucket[b]);
+        }
+        Append(buf, size, len, "]}");
+    }
+
+    Append(buf, size, len, "},\"stages\":[");
+    int stages = (pStatsScheduler != nullptr) ? pStatsScheduler->StageCount() : 0;
+    for (int i = 0; i < stages; i++)
+    {
+        const SchedStage *st = pStatsScheduler->GetStage(i);
+        Append(buf, size, len,
+               "%s{\"name\":\"%s\",\"period_us\":%lu,\"runs\":%lu,\"overruns\":%lu,\"skipped\":%lu,"
+               "\"max_late_us\":%lu,\"max_work_us\":%lu}",
+               i ? "," : "", st->name, (unsigned long)st->periodUs, (unsigned long)st->runs,
+               (unsigned long)st->overruns, (unsigned long)st->skipped, (unsigned long)st->maxLateUs,
+               (unsigned long)st->maxWorkUs);
+    }
+
+    Append(buf, size, len, "],\"pools\":[");
+    for (int c = 0; c < POOL_CLASS_COUNT; c++)
+    {
+        PoolStats ps;
+        PoolGetStats((PoolClass)c, ps);
+        Append(buf, size, len,
+               "%s{\"name\":\"%s\",\"block\":%lu,\"blocks\":%lu,\"in_use\":%lu,\"high_water\":%lu,\"allocs\":%lu,"
+               "\"failures\":%lu}",
+               c ? "," : "", ps.name, (unsigned long)ps.blockSize, (unsigned long)ps.blocks, (unsigned long)ps.inUse,
+               (unsigned long)ps.highWater, (unsigned long)ps.allocs, (unsigned long)ps.failures);
+    }
+
+    Append(buf, size, len, "],\"clients\":[");
+    bool first = true;
+    for (int i = 0; i < MAX_TELEMETRY_CLIENTS; i++)
+    {
+        const TelemetryClient *c = GetTelemetryClient(i);
+        if (c == nullptr) { continue; }
+        Append(buf, size, len,
+               "%s{\"fd\":%d,\"binary\":%s,\"objects\":%lu,\"interval_us\":%lu,\"floor_us\":%lu,\"sent\":%lu,"
+               "\"dropped\":%lu,\"backoffs\":%lu,\"last_write_us\":%lu}",
+               first ? "" : ",", c->fd, c->binary ? "true" : "false", (unsigned long)c->objectMask,
+               (unsigned long)c->intervalUs, (unsigned long)c->floorUs,
+               (unsigned long)c->framesSent, (unsigned long)c->framesDropped, (unsigned long)c->backoffs,
+               (unsigned long)c->lastWriteUs);
+        first = false;
+    }
+
+    Append(buf, size, len, "],\"event_clients\":[");
+    first = true;
+    for (int i = 0; i < MAX_EVENT_CLIENTS; i++)
+    {
+        const EventClient *c = GetEventClient(i);
+        if (c == nullptr) { continue; }
+        Append(buf, size, len, "%s{\"fd\":%d,\"next_id\":%lu,\"sent\":%lu,\"skipped\":%lu}", first ? "" : ",", c->fd,
+               (unsigned long)c->nextId, (unsigned long)c->eventsSent, (unsigned long)c->eventsSkipped);
+        first = false;
+    }
+
+    MulticastStatus mc;
+    MulticastGetStatus(mc);
+    Append(buf, size, len, "],\"multicast\":{\"enabled\":%s,\"datagrams\":%lu,\"frames\":%lu,\"errors\":%lu}}",
+           mc.enabled ? "true" : "false", (unsigned long)mc.datagrams, (unsigned long)mc.frames,
+           (unsigned long)mc.errors);
+    return len;
+}
+
+/**
+ * @brief Sends the snapshot to each diagnostics client. A client whose send window cannot take
+ * a whole snapshot misses this one rather than stalling the main loop.
+ */
+static void ServiceDiagClients(const char *json, int len)
+{
+    OSCritEnter(&DiagCrit, 0);
+    for (int n = 0; n < IncomingDiagCount; n++)
+    {
+        int slot = -1;
+        for (int i = 0; i < MAX_DIAG_CLIENTS; i++)
+        {
+            if (DiagFd[i] < 0)
+            {
+                slot = i;
+                break;
+            }
+        }
+        if (slot < 0)
+        {
+            close(IncomingDiagFd[n]);
+            continue;
+        }
+        DiagFd[slot] = IncomingDiagFd[n];
+        DiagSock[slot] = IncomingDiagSock[n];
+    }
+    IncomingDiagCount = 0;
+    OSCritLeave(&DiagCrit);
+
+    for (int i = 0; i < MAX_DIAG_CLIENTS; i++)
+    {
+        if (DiagFd[i] < 0) { continue; }
+        if (TcpGetTxBufferAvailSpace(DiagSock[i]) < len + WS_FRAME_HEADER_MAX) { continue; }
+        if (writeall(DiagFd[i], json, len) < 0)
+        {
+            close(DiagFd[i]);
+            DiagFd[i] = -1;
+        }
+    }
+}
+
+void StatsService()
+{
+    uint32_t now = TimingNowUs();
+    uint32_t elapsed = now - LastSnapshotUs;
+    LastSnapshotUs = now;
+
+    // Built outside the lock, so the HTTP task never waits on formatting
+    int len = BuildSnapshot(SnapshotBuild, STATS_JSON_MAX, elapsed);
+
+    OSCritEnter(&SnapshotCrit, 0);
+    memcpy(Snapshot, SnapshotBuild, len);
+    SnapshotLen = len;
+    OSCritLeave(&SnapshotCrit);
+
+    ServiceDiagClients(SnapshotBuild, len);
+}
+
+int StatsCopySnapshot(char *buf, int size)
+{
+    OSCritEnter(&SnapshotCrit, 0);
+    int len = (SnapshotLen < size) ? SnapshotLen : size;
+    memcpy(buf, Snapshot, len);
+    OSCritLeave(&SnapshotCrit);
+    return len;
+}
@@ -0,0 +1,159 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+#ifndef _STATS_H_
+#define _STATS_H_
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Runtime performance counters.
+ *
+ * Every task that records statistics has its own row of counters and
+ * histograms, and only ever writes to that row, so recording is a plain
+ * add with no locking. The main task sums the rows once per second into a
+ * JSON snapshot, which is served at /stats and pushed to clients of the
+ * DIAG WebSocket. Readers may see a value that is a moment old, never a
+ * corrupted one.
+ *
+ * Histograms count microsecond durations in power-of-two buckets: bucket 0
+ * holds 0 us, bucket n holds values from 2^(n-1) up to 2^n - 1, and the
+ * last bucket holds everything longer.
+ */
+
+enum StatTask
+{
+    STAT_TASK_MAIN,
+    STAT_TASK_HTTP,
+    STAT_TASK_FTP,
+    STAT_TASK_MOUNT,
+    STAT_TASK_COUNT
+};
+
+enum StatCounter
+{
+    STAT_HTTP_REQUESTS,
+    STAT_HTTP_BYTES,        // Response bodies sent from the flash card
+    STAT_HTTP_EMBEDDED_BYTES, // Response bodies sent from the assets compiled into the image
+    STAT_HTTP_NOT_MODIFIED, // 304 answers to If-None-Match
+    STAT_HTTP_BAD_URLS,     // Requests refused by ParseUrl()
+    STAT_TELEMETRY_BYTES,
+    STAT_FRAMES_SENT,
+    STAT_FRAMES_DROPPED,    // Poses replaced before they could be sent
+    STAT_FTP_RETR_BYTES,
+    STAT_FTP_STOR_BYTES,
+    STAT_FTP_TRANSFER_MS,   // Time spent in RETR and STOR transfers
+    STAT_FTP_LIST_ENTRIES,  // Lines sent for LIST and NLST
+    STAT_FTP_LIST_CUT,      // Listing lines truncated to fit the line buffer
+    STAT_CACHE_HITS,        // Lookups answered by the file system caches
+    STAT_CACHE_MISSES,
+    STAT_CARD_MOUNTS,
+    STAT_CARD_REMOVALS,
+    STAT_CARD_MOUNT_FAILURES,
+    STAT_TICKS,             // Main loop passes
+    STAT_TICK_OVERRUNS,     // Passes that took longer than one tick
+    STAT_COUNT
+};
+
+enum StatHistogram
+{
+    STAT_HIST_WRITEALL,    // writeall() of file data and telemetry frames
+    STAT_HIST_SD_READ,     // f_read() of file data
+    STAT_HIST_TICK_WORK,   // Main loop work per pass
+    STAT_HIST_COUNT
+};
+
+// Startup milestones, in milliseconds from StatsBootStart()
+enum BootMark
+{
+    BOOT_NETWORK_UP,      // HTTP and FTP servers started
+    BOOT_FIRST_POSE,      // First pose offered to telemetry clients
+    BOOT_CARD_MOUNTED,
+    BOOT_CARD_INDEXED,
+    BOOT_MARK_COUNT
+};
+
+#define BOOT_BUDGET_MS (1000)   // Allowed time to BOOT_FIRST_POSE, a warning is logged past it
+
+#define STAT_HIST_BUCKETS (18)   // The last bucket starts at 65 ms
+#define STATS_JSON_MAX (4096)
+#define STATS_PERIOD_US (1000000)
+#define MAX_DIAG_CLIENTS (2)
+
+struct StatHist
+{
+    uint32_t count;
+    uint32_t maxUs;
+    uint32_t bucket[STAT_HIST_BUCKETS];
+};
+
+extern uint32_t StatCounters[STAT_TASK_COUNT][STAT_COUNT];
+extern StatHist StatHists[STAT_TASK_COUNT][STAT_HIST_COUNT];
+
+inline void StatsAdd(StatTask task, StatCounter counter, uint32_t n = 1)
+{
+    StatCounters[task][counter] += n;
+}
+
+inline void StatsRecordUs(StatTask task, StatHistogram hist, uint32_t us)
+{
+    StatHist &h = StatHists[task][hist];
+    int b = (us == 0) ? 0 : (32 - __builtin_clz(us));
+    if (b >= STAT_HIST_BUCKETS) { b = STAT_HIST_BUCKETS - 1; }
+    h.bucket[b]++;
+    h.count++;
+    if (us > h.maxUs) { h.maxUs = us; }
+}
+
+// Must be called once before the web server starts
+void InitStats();
+
+// Starts the boot clock. Call right after InitTiming().
+void StatsBootStart();
+
+// Records the first time a milestone is reached and logs it. Safe to call from any task.
+void StatsBootMark(BootMark mark);
+
+// Records one main loop pass that started at startUs (from TimingNowUs())
+void StatsTickDone(uint32_t startUs);
+
+// Rebuilds the snapshot and sends it to DIAG clients. Run as a scheduler stage every STATS_PERIOD_US.
+void StatsService();
+
+// Adds the scheduler's per-stage counters to the snapshot. Only read from the task that runs it.
+class PeriodicScheduler;
+void StatsSetScheduler(const PeriodicScheduler *sched);
+
+// Copies the latest JSON snapshot, returns its length. Safe to call from any task.
+int StatsCopySnapshot(char *buf, int size);
+
+// Hands a freshly upgraded WebSocket, and the TCP socket it was upgraded from, to the main task
+// for diagnostics. Safe to call from any task.
+bool AddDiagClient(int fd, int sock);
+
+#endif /* _STATS_H_ */
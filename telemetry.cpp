@@ -0,0 +1,197 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+/**
+ * Encodes fused poses into the frames sent to viewers.
+ */
+
+// NB Libs
+#include <string.h>
+
+#include "telemetry.h"
+
+static inline void PutU32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static inline void PutPos(uint8_t *p, float v)
+{
+    float scaled = v * TELEMETRY_POS_SCALE;
+    scaled = (scaled > 32767.0f) ? 32767.0f : ((scaled < -32768.0f) ? -32768.0f : scaled);
+    int16_t s = (int16_t)((scaled < 0.0f) ? (scaled - 0.5f) : (scaled + 0.5f));
+    p[0] = (uint8_t)s;
+    p[1] = (uint8_t)((uint16_t)s >> 8);
+}
+
+/**
+ * @brief Writes the binary frame for a pose. Returns the number of bytes written, or 0 if the
+ * buffer is too small.
+ */
+int EncodeBinaryFrame(const FusedPose &pose, uint8_t *buf, int size)
+{
+    if (size < TELEMETRY_BINARY_SIZE) { return 0; }
+
+    buf[0] = TELEMETRY_MAGIC;
+    buf[1] = TELEMETRY_VERSION;
+    buf[2] = pose.object;
+    buf[3] = 0;
+    PutU32(buf + 4, pose.seq);
+    PutU32(buf + 8, pose.timeUs);
+    PutPos(buf + 12, pose.pos[0]);
+    PutPos(buf + 14, pose.pos[1]);
+    PutPos(buf + 16, pose.pos[2]);
+    PutU32(buf + 18, QuatPackSmallestThree(pose.q));
+
+    return TELEMETRY_BINARY_SIZE;
+}
+
+/**
+ * JSON frames are written from a fixed template: the constant text between
+ * the numbers is stored once, with its length, and the numbers are written
+ * into the holes. Nothing is built or allocated per frame.
+ */
+struct JsonPiece
+{
+    const char *text;
+    int len;
+};
+
+#define JSON_PIECE(s) {s, sizeof(s) - 1}
+
+// One piece before each of the eight numbers, and the closing piece
+static const JsonPiece JsonTemplate[] = {
+    JSON_PIECE("{\"seq\":"), JSON_PIECE(",\"t\":"),   JSON_PIECE(",\"PosUpdate\":{\"x\":"),
+    JSON_PIECE(",\"y\":"),    JSON_PIECE(",\"z\":"),   JSON_PIECE("},\"RotUpdate\":{\"x\":"),
+    JSON_PIECE(",\"y\":"),    JSON_PIECE(",\"z\":"),   JSON_PIECE("}}"),
+};
+
+static inline char *PutPiece(char *p, int piece)
+{
+    memcpy(p, JsonTemplate[piece].text, JsonTemplate[piece].len);
+    return p + JsonTemplate[piece].len;
+}
+
+static inline char *PutUnsigned(char *p, uint32_t v)
+{
+    char digits[10];
+    int n = 0;
+    do
+    {
+        digits[n++] = (char)('0' + (v % 10));
+        v /= 10;
+    } while (v != 0);
+
+    while (n > 0)
+    {
+        *p++ = digits[--n];
+    }
+    return p;
+}
+
+static inline char *PutSigned(char *p, int32_t v)
+{
+    if (v < 0)
+    {
+        *p++ = '-';
+        return PutUnsigned(p, (uint32_t)0 - (uint32_t)v);
+    }
+    return PutUnsigned(p, (uint32_t)v);
+}
+
+/**
+ * @brief Writes v rounded to TELEMETRY_JSON_DECIMALS places, without trailing zeros, so
+ * the output stays a valid JSON number. Values out of range, and NaN, are written as 0.
+ */
+static inline char *PutFixed(char *p, float v)
+{
+    const float scale = (float)TELEMETRY_JSON_SCALE;
+    float scaled = v * scale;
+    if (!((scaled > -2000000000.0f) && (scaled < 2000000000.0f))) { scaled = 0.0f; }
+
+    int32_t fixed = (int32_t)((scaled < 0.0f) ? (scaled - 0.5f) : (scaled + 0.5f));
+    uint32_t mag = (fixed < 0) ? ((uint32_t)0 - (uint32_t)fixed) : (uint32_t)fixed;
+    if (fixed < 0) { *p++ = '-'; }
+
+    p = PutUnsigned(p, mag / TELEMETRY_JSON_SCALE);
+
+    uint32_t frac = mag % TELEMETRY_JSON_SCALE;
+    if (frac != 0)
+    {
+        char digits[TELEMETRY_JSON_DECIMALS];
+        for (int i = TELEMETRY_JSON_DECIMALS - 1; i >= 0; i--)
+        {
+            digits[i] = (char)('0' + (frac % 10));
+            frac /= 10;
+        }
+
+        int n = TELEMETRY_JSON_DECIMALS;
+        while (digits[n - 1] == '0')
+        {
+            n--;
+        }
+
+        *p++ = '.';
+        memcpy(p, digits, n);
+        p += n;
+    }
+    return p;
+}
+
+/**
+ * @brief Writes the JSON frame for a pose. Returns the number of bytes written, or 0 if the
+ * buffer is too small.
+ */
+int EncodeJsonFrame(const FusedPose &pose, char *buf, int size)
+{
+    if (size < TELEMETRY_JSON_FRAME_MAX) { return 0; }
+
+    float rot[3];
+    QuatToEulerXYZ(pose.q, rot);
+
+    char *p = buf;
+    p = PutPiece(p, 0);
+    p = PutUnsigned(p, pose.seq);
+    p = PutPiece(p, 1);
+    p = PutSigned(p, (int32_t)pose.timeUs);
+    for (int i = 0; i < 3; i++)
+    {
+        p = PutPiece(p, 2 + i);
+        p = PutFixed(p, pose.pos[i]);
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        p = PutPiece(p, 5 + i);
+        p = PutFixed(p, rot[i]);
+    }
+    p = PutPiece(p, 8);
+
+    return (int)(p - buf);
+}
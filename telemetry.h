@@ -0,0 +1,71 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+#ifndef _TELEMETRY_H_
+#define _TELEMETRY_H_
+#pragma once
+
+#include <stdint.h>
+
+#include "fusion.h"
+
+/**
+ * Telemetry frame encodings.
+ *
+ * Binary frames are sent to clients connected to the POSE WebSocket, and are
+ * laid out as follows (all fields little-endian):
+ *
+ *     offset  size  field
+ *     0       1     magic, TELEMETRY_MAGIC
+ *     1       1     version, TELEMETRY_VERSION
+ *     2       1     object
+ *     3       1     flags, reserved
+ *     4       4     seq, frame counter per object
+ *     8       4     time, acquisition time in microseconds (wraps)
+ *     12      6     position x, y, z as int16 in 1/TELEMETRY_POS_SCALE units
+ *     18      4     orientation, smallest-three packed quaternion (see quat.h)
+ *
+ * JSON frames keep the original {"PosUpdate":{...},"RotUpdate":{...}} shape
+ * for older pages, with the rotation converted back to Euler radians. They
+ * also carry "seq" and "t" (the same counter and timestamp as binary frames,
+ * with t as a signed 32-bit value). Positions and angles are written with at
+ * most TELEMETRY_JSON_DECIMALS decimal places.
+ */
+
+#define TELEMETRY_MAGIC (0xB1)
+#define TELEMETRY_VERSION (1)
+#define TELEMETRY_BINARY_SIZE (22)
+#define TELEMETRY_POS_SCALE (4096.0f)   // Positions from -8 to +8 units
+#define TELEMETRY_JSON_MAX (512)
+#define TELEMETRY_JSON_DECIMALS (5)
+#define TELEMETRY_JSON_SCALE (100000)    // 10 ^ TELEMETRY_JSON_DECIMALS
+#define TELEMETRY_JSON_FRAME_MAX (192)   // Longest frame EncodeJsonFrame() can write
+
+int EncodeBinaryFrame(const FusedPose &pose, uint8_t *buf, int size);
+int EncodeJsonFrame(const FusedPose &pose, char *buf, int size);
+
+#endif /* _TELEMETRY_H_ */
@@ -0,0 +1,80 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+/**
+ * Microsecond timestamp source.
+ */
+
+// NB Constants
+#include <constants.h>
+
+// NB Libs
+#include <ucos.h>
+
+#if defined(NB_HOST_BUILD)
+#include <time.h>
+#elif (defined(MOD5441X) || defined(NANO54415))
+#define TIMING_USE_HIRES
+#include <HiResTimer.h>
+#endif
+
+#include "timing.h"
+
+#ifdef TIMING_USE_HIRES
+static HiResTimer *pTimingTimer = nullptr;
+#endif
+
+/**
+ * @brief Starts the timestamp source. Must be called once before any task uses TimingNowUs().
+ */
+void InitTiming()
+{
+#ifdef TIMING_USE_HIRES
+    if (pTimingTimer == nullptr)
+    {
+        pTimingTimer = HiResTimer::getHiResTimer();
+        pTimingTimer->init();
+        pTimingTimer->start();
+    }
+#endif
+}
+
+/**
+ * @brief Returns the current time in microseconds.
+ */
+uint32_t TimingNowUs()
+{
+#ifdef TIMING_USE_HIRES
+    if (pTimingTimer != nullptr) { return (uint32_t)(uint64_t)(pTimingTimer->readTime() * 1000000.0); }
+#endif
+#ifdef NB_HOST_BUILD
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+#endif
+    return (uint32_t)TimeTick * (1000000 / TICKS_PER_SECOND);
+}
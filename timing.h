@@ -0,0 +1,52 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+#ifndef _TIMING_H_
+#define _TIMING_H_
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Free-running microsecond timestamps for stamping samples and measuring
+ * short intervals. The counter wraps every ~71 minutes, so always compare
+ * timestamps by subtraction, never with < or >.
+ *
+ * On platforms with a HiResTimer the value comes from a DMA timer. Other
+ * platforms fall back to TimeTick, which limits resolution to one tick.
+ * The host build (NB_HOST_BUILD) uses the monotonic clock.
+ */
+void InitTiming();
+uint32_t TimingNowUs();
+
+// Signed difference a - b that is correct across counter wrap
+inline int32_t TimingDiffUs(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b);
+}
+
+#endif /* _TIMING_H_ */
@@ -0,0 +1,115 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+/**
+ * Trace event ring and Chrome trace-event export.
+ */
+
+// NB Libs
+#include <iosys.h>
+#include <stdio.h>
+#include <string.h>
+#include <ucos.h>
+
+#include "pool.h"
+#include "trace.h"
+
+#ifdef ENABLE_TRACE
+
+static const char *TraceNames[TRACE_NAME_COUNT] = {"http_get", "f_open",   "f_read",  "f_write", "writeall",
+                                                   "net_read", "ftp_retr", "ftp_stor", "ftp_list"};
+
+static TraceEvent TraceRing[TRACE_RING_EVENTS];
+static uint32_t TraceHead = 0;   // Total events recorded
+
+// The export copies the ring into a transfer buffer
+static_assert(sizeof(TraceRing) <= POOL_TRANSFER_SIZE, "TRACE_RING_EVENTS is too large for a transfer buffer");
+
+void TraceRecord(TraceName name, uint32_t startUs, uint32_t durUs, uint32_t arg)
+{
+    OSLock();
+    TraceEvent &e = TraceRing[TraceHead & (TRACE_RING_EVENTS - 1)];
+    TraceHead++;
+    e.startUs = startUs;
+    e.durUs = durUs;
+    e.arg = arg;
+    e.name = (uint8_t)name;
+    e.task = (uint8_t)OSTaskID();
+    OSUnlock();
+}
+
+bool SendTraceJson(int sock)
+{
+    // The ring is copied out so recording can carry on while we format it
+    PoolBlock copy(POOL_TRANSFER, TICKS_PER_SECOND);
+    PoolBlock buffer(POOL_FRAME, TICKS_PER_SECOND);
+    if ((copy.Data() == nullptr) || (buffer.Data() == nullptr)) { return false; }
+    const TraceEvent *TraceCopy = (const TraceEvent *)copy.Data();
+
+    OSLock();
+    uint32_t head = TraceHead;
+    memcpy(copy.Data(), TraceRing, sizeof(TraceRing));
+    OSUnlock();
+
+    uint32_t count = (head < TRACE_RING_EVENTS) ? head : TRACE_RING_EVENTS;
+    uint32_t first = head - count;
+
+    writestring(sock,
+                "HTTP/1.0 200 OK\r\n"
+                "Pragma: no-cache\r\n"
+                "MIME-version: 1.0\r\n"
+                "Content-Type: application/json\r\n\r\n"
+                "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+    // Events are batched into one write per buffer, not one per event
+    int len = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const TraceEvent &e = TraceCopy[(first + i) & (TRACE_RING_EVENTS - 1)];
+        if (len > POOL_FRAME_SIZE - 160)
+        {
+            writeall(sock, buffer.Data(), len);
+            len = 0;
+        }
+        len += sniprintf(buffer.Data() + len, POOL_FRAME_SIZE - len,
+                         "%s{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%lu,\"dur\":%lu,\"pid\":1,\"tid\":%d,\"args\":{\"bytes\":%lu}}",
+                         i ? "," : "", (e.name < TRACE_NAME_COUNT) ? TraceNames[e.name] : "?", (unsigned long)e.startUs,
+                         (unsigned long)e.durUs, e.task, (unsigned long)e.arg);
+    }
+    if (len > 0) { writeall(sock, buffer.Data(), len); }
+    writestring(sock, "]}");
+    return true;
+}
+
+#else
+
+bool SendTraceJson(int sock)
+{
+    return false;
+}
+
+#endif /* ENABLE_TRACE */
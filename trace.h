@@ -0,0 +1,115 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+#ifndef _TRACE_H_
+#define _TRACE_H_
+#pragma once
+
+#include <stdint.h>
+
+#include "timing.h"
+
+/**
+ * Hot path latency tracing.
+ *
+ * Spans are recorded into a fixed ring of TRACE_RING_EVENTS entries in RAM,
+ * overwriting the oldest, and can be downloaded from /trace as Chrome
+ * trace-event JSON (load it in chrome://tracing or ui.perfetto.dev). Each
+ * span costs two TimingNowUs() reads and a 16 byte store under the
+ * scheduler lock; where a statistics timer already surrounds the same code,
+ * its timestamps are reused with TraceRecord().
+ *
+ * Comment out ENABLE_TRACE to compile every span out.
+ */
+#define ENABLE_TRACE
+
+#define TRACE_RING_EVENTS (512)   // Must be a power of two
+
+enum TraceName
+{
+    TRACE_HTTP_GET,
+    TRACE_F_OPEN,
+    TRACE_F_READ,
+    TRACE_F_WRITE,
+    TRACE_WRITEALL,
+    TRACE_NET_READ,
+    TRACE_FTP_RETR,
+    TRACE_FTP_STOR,
+    TRACE_FTP_LIST,   // One directory scan, arg is the entry count
+    TRACE_NAME_COUNT
+};
+
+struct TraceEvent
+{
+    uint32_t startUs;
+    uint32_t durUs;
+    uint32_t arg;     // Byte count where it applies
+    uint8_t name;
+    uint8_t task;     // Task priority, shown as the thread
+    uint16_t reserved;
+};
+
+#ifdef ENABLE_TRACE
+
+void TraceRecord(TraceName name, uint32_t startUs, uint32_t durUs, uint32_t arg = 0);
+
+/**
+ * Records a span from construction to the end of the enclosing scope. Set
+ * arg before the scope ends to attach a byte count.
+ */
+class TraceSpan
+{
+  public:
+    explicit TraceSpan(TraceName name) : m_name(name), m_start(TimingNowUs()), arg(0) {}
+    ~TraceSpan() { TraceRecord(m_name, m_start, TimingNowUs() - m_start, arg); }
+
+  private:
+    TraceName m_name;
+    uint32_t m_start;
+
+  public:
+    uint32_t arg;
+};
+
+#define TRACE_SPAN(var, name) TraceSpan var(name)
+#define TRACE_SPAN_ARG(var, value) (var).arg = (value)
+#define TRACE_RECORD(name, startUs, durUs, arg) TraceRecord(name, startUs, durUs, arg)
+#define TRACE_NOW(var) uint32_t var = TimingNowUs()   // A timestamp that only tracing uses
+
+#else
+
+#define TRACE_SPAN(var, name) do {} while (0)
+#define TRACE_SPAN_ARG(var, value) do {} while (0)
+#define TRACE_RECORD(name, startUs, durUs, arg) do {} while (0)
+#define TRACE_NOW(var) do {} while (0)
+
+#endif /* ENABLE_TRACE */
+
+// Writes the ring as Chrome trace-event JSON. Returns false if tracing is compiled out.
+bool SendTraceJson(int sock);
+
+#endif /* _TRACE_H_ */
@@ -0,0 +1,153 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+
+/**
+ * Single pass request path parser.
+ */
+
+#include <string.h>
+
+#include "urlparse.h"
+
+static int HexValue(char c)
+{
+    if ((c >= '0') && (c <= '9')) { return c - '0'; }
+    if ((c >= 'a') && (c <= 'f')) { return c - 'a' + 10; }
+    if ((c >= 'A') && (c <= 'F')) { return c - 'A' + 10; }
+    return -1;
+}
+
+/**
+ * @brief True for characters that may appear in a card path segment
+ */
+static bool PathChar(unsigned char c)
+{
+    if ((c < 0x20) || (c == 0x7f)) { return false; }
+    switch (c)
+    {
+        case '/':
+        case '\\':
+        case ':':
+        case '*':
+        case '?':
+        case '"':
+        case '<':
+        case '>':
+        case '|': return false;
+        default: return true;
+    }
+}
+
+UrlResult ParseUrl(const char *url, char *buf, int size, ParsedUrl &out)
+{
+    uint16_t segStart[URL_MAX_DEPTH];   // Where each directory kept so far starts in buf
+    int depth = 0;
+    int n = 0;
+
+    buf[n++] = '/';
+    int seg = n;
+    const char *p = url;
+    while (1)
+    {
+        char c = *p;
+        bool end = (c == 0) || (c == '?') || (c == '#');
+
+        if (end || (c == '/') || (c == '\\'))
+        {
+            int segLen = n - seg;
+            if ((segLen == 1) && (buf[seg] == '.')) { n = seg; }
+            else if ((segLen == 2) && (buf[seg] == '.') && (buf[seg + 1] == '.'))
+            {
+                if (depth == 0) { return URL_ABOVE_ROOT; }
+                n = segStart[--depth];
+            }
+            else if ((segLen > 0) && !end)
+            {
+                if (depth >= URL_MAX_DEPTH) { return URL_TOO_DEEP; }
+                if (n >= size - 1) { return URL_TOO_LONG; }
+                segStart[depth++] = seg;
+                buf[n++] = '/';
+            }
+
+            if (end) { break; }
+            seg = n;
+            p++;
+            continue;
+        }
+
+        if (c == '%')
+        {
+            int hi = HexValue(p[1]);
+            int lo = (hi < 0) ? -1 : HexValue(p[2]);
+            if (lo < 0) { return URL_BAD_ESCAPE; }
+            c = (char)((hi << 4) | lo);
+            p += 3;
+        }
+        else { p++; }
+
+        if (!PathChar((unsigned char)c)) { return URL_BAD_CHAR; }
+        if (n >= size - 1) { return URL_TOO_LONG; }
+        buf[n++] = c;
+    }
+    buf[n] = 0;
+
+    int nameStart = n;
+    while (buf[nameStart - 1] != '/') { nameStart--; }
+    const char *dot = strrchr(buf + nameStart, '.');
+
+    out.path = buf;
+    out.len = n;
+    out.dir.str = buf;
+    out.dir.len = nameStart;
+    out.name.str = buf + nameStart;
+    out.name.len = n - nameStart;
+    out.ext.str = (dot != nullptr) ? dot + 1 : buf + n;
+    out.ext.len = buf + n - out.ext.str;
+    return URL_OK;
+}
+
+const char *UrlDirString(ParsedUrl &u)
+{
+    if (u.dir.len == 1) { return "/"; }
+    u.path[u.dir.len - 1] = 0;   // The name after it stays intact
+    return u.path;
+}
+
+const char *UrlResultName(UrlResult result)
+{
+    switch (result)
+    {
+        case URL_OK: return "ok";
+        case URL_TOO_LONG: return "too long";
+        case URL_TOO_DEEP: return "too deep";
+        case URL_BAD_ESCAPE: return "bad escape";
+        case URL_BAD_CHAR: return "bad character";
+        case URL_ABOVE_ROOT: return "above root";
+        default: return "?";
+    }
+}
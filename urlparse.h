@@ -0,0 +1,86 @@
+/* Revision: 2.8.7 */
+
+/******************************************************************************
+* Copyright 1998-2018 NetBurner, Inc.  ALL RIGHTS RESERVED
+*
+*    Permission is hereby granted to purchasers of NetBurner Hardware to use or
+*    modify this computer program for any use as long as the resultant program
+*    is only executed on NetBurner provided hardware.
+*
+*    No other rights to use this program or its derivatives in part or in
+*    whole are granted.
+*
+*    It may be possible to license this or other NetBurner software for use on
+*    non-NetBurner Hardware. Contact sales@Netburner.com for more information.
+*
+*    NetBurner makes no representation or warranties with respect to the
+*    performance of this computer program, and specifically disclaims any
+*    responsibility for any damages, special or consequential, connected with
+*    the use of this program.
+*
+* NetBurner
+* 5405 Morehouse Dr.
+* San Diego, CA 92121
+* www.netburner.com
+******************************************************************************/
+
+
+#ifndef _URLPARSE_H_
+#define _URLPARSE_H_
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Request path parsing for the web server.
+ *
+ * ParseUrl() makes one pass over the request target. It percent-decodes
+ * it, folds '\' into '/', drops empty and "." segments, and collapses ".."
+ * into the buffer given. The result always starts with '/'. A ".." that
+ * would climb above the root is an error rather than being clamped. The
+ * query string and fragment are ignored.
+ *
+ * Characters FAT cannot store, and control characters, are rejected after
+ * decoding. So is a decoded '/' or '\', so an escape can never add a path
+ * segment. This keeps drive letters, wildcards and markup out of card paths.
+ *
+ * The directory, name and extension are views into the same buffer, so
+ * nothing is copied twice. The name and extension are null terminated.
+ */
+
+#define URL_MAX_DEPTH (16)   // Directory levels below the root
+
+enum UrlResult
+{
+    URL_OK,
+    URL_TOO_LONG,     // The decoded path does not fit the buffer
+    URL_TOO_DEEP,     // More than URL_MAX_DEPTH directories
+    URL_BAD_ESCAPE,   // '%' not followed by two hex digits
+    URL_BAD_CHAR,     // A character FAT cannot store, or a control character
+    URL_ABOVE_ROOT,   // ".." past the root
+};
+
+struct UrlView
+{
+    const char *str;
+    uint16_t len;
+};
+
+struct ParsedUrl
+{
+    char *path;     // "/dir/name", in the caller's buffer
+    uint16_t len;
+    UrlView dir;    // "/dir/", always starts and ends with '/'
+    UrlView name;   // Empty for a directory URL
+    UrlView ext;    // After the last '.' in name, empty if there is none
+};
+
+// Parses url, the request target without its leading '/', into buf.
+UrlResult ParseUrl(const char *url, char *buf, int size, ParsedUrl &out);
+
+// Null terminates the directory in place for f_chdir(). path is cut short afterwards.
+const char *UrlDirString(ParsedUrl &u);
+
+const char *UrlResultName(UrlResult result);
+
+#endif /* _URLPARSE_H_ */
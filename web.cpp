@@ -33,35 +33,66 @@
 #include <iosys.h>
 #include <websockets.h>
 
+#include "cardindex.h"
 #include "cardtype.h"
-
-#define HTTP_BUFFER_SIZE (32 * 1024)   // Make a 32KB BUFFER
-static char HTTP_buffer[HTTP_BUFFER_SIZE] __attribute__((aligned(16)));
+#include "clients.h"
+#include "embedded.h"
+#include "events.h"
+#include "log.h"
+#include "mount.h"
+#include "pool.h"
+#include "stats.h"
+#include "timing.h"
+#include "trace.h"
+#include "urlparse.h"
 
 static http_gethandler *oldhand = nullptr;
-extern http_wshandler *TheWSHandler = nullptr;
 
-int ws_fd = -1;
+// MyDoGet() takes prebuilt headers from the card index in a path block
+static_assert(sizeof(CardIndexHeader) <= POOL_PATH_SIZE, "CardIndexHeader must fit a POOL_PATH block");
+extern http_wshandler *TheWSHandler = nullptr;
 
 /**
- * @brief Send a fragment of a file over a socket
+ * @brief Send the response header and a file over a socket. The header goes out in the same
+ * write as the start of the file, so a small file is one write.
  */
-void SendFragment(int sock, F_FILE *f, long len)
+void SendFragment(int sock, F_FILE *f, long len, const char *header, int headerLen)
 {
-    int lread = 0;
-    while (lread < len)
+    PoolBlock buffer(POOL_TRANSFER, TICKS_PER_SECOND);
+    if (buffer.Data() == nullptr) { return; }
+
+    memcpy(buffer.Data(), header, headerLen);
+    int fill = headerLen;
+    long lread = 0;
+    while (1)
     {
-        int ltoread = len - lread;
-        int lr;
+        long ltoread = len - lread;
+        int lr = 0;
 
-        if (ltoread > HTTP_BUFFER_SIZE) { ltoread = HTTP_BUFFER_SIZE; }
+        if (ltoread > POOL_TRANSFER_SIZE - fill) { ltoread = POOL_TRANSFER_SIZE - fill; }
 
-        lr = f_read(HTTP_buffer, 1, HTTP_BUFFER_SIZE, f);
+        if (ltoread > 0)
+        {
+            uint32_t start = TimingNowUs();
+            lr = f_read(buffer.Data() + fill, 1, ltoread, f);
+            uint32_t us = TimingNowUs() - start;
+            StatsRecordUs(STAT_TASK_HTTP, STAT_HIST_SD_READ, us);
+            TRACE_RECORD(TRACE_F_READ, start, us, lr);
+        }
+        uint32_t read = TimingNowUs();
 
-        if (lr == 0) { return; }
+        fill += lr;
+        if (fill == 0) { return; }
 
         lread += lr;
-        writeall(sock, HTTP_buffer, lr);
+        writeall(sock, buffer.Data(), fill);
+        uint32_t written = TimingNowUs();
+        StatsRecordUs(STAT_TASK_HTTP, STAT_HIST_WRITEALL, written - read);
+        TRACE_RECORD(TRACE_WRITEALL, read, written - read, fill);
+        StatsAdd(STAT_TASK_HTTP, STAT_HTTP_BYTES, lr);
+        fill = 0;
+
+        if ((lr == 0) || (lread >= len)) { return; }
     }
 }
 
@@ -113,27 +144,22 @@ void WebListDir(int sock, const char *dir)
     writestring(sock, "</html>");
 }
 
-#define tmp_buffer_size (256)
-char tmp_buffer[tmp_buffer_size];
-int tmp_buffer_end;
-int tmp_buffer_start;
-
 /**
- * @brief Reads and returns 1 line from the file FP.
+ * @brief Reads and returns 1 line from the file FP. readAhead holds POOL_PATH_SIZE bytes read from
+ * the file but not yet returned; start and end must be 0 for the first call on a file.
  */
-
-int my_f_read_line(char *buffer, int buf_siz, F_FILE *fp)
+int my_f_read_line(char *buffer, int buf_siz, F_FILE *fp, char *readAhead, int &start, int &end)
 {
     int nr = 0;
     do
     {
-        if (tmp_buffer_end <= tmp_buffer_start)
+        if (end <= start)
         {
             if (f_eof(fp)) return 0;
 
-            int n = f_read(tmp_buffer, 1, tmp_buffer_size, fp);
-            tmp_buffer_start = 0;
-            tmp_buffer_end = n;
+            int n = f_read(readAhead, 1, POOL_PATH_SIZE, fp);
+            start = 0;
+            end = n;
 
             if (n == 0)
             {
@@ -142,7 +168,7 @@ int my_f_read_line(char *buffer, int buf_siz, F_FILE *fp)
             }
         }
 
-        *(buffer + nr) = tmp_buffer[tmp_buffer_start++];
+        *(buffer + nr) = readAhead[start++];
 
         if ((buffer[nr] == '\r') || (buffer[nr] == '\n'))
         {
@@ -163,9 +189,9 @@ int my_f_read_line(char *buffer, int buf_siz, F_FILE *fp)
 }
 
 /**
- * @brief Takes a file type and sends a header response with the specified MIME type.
+ * @brief Looks up the MIME type for a file type (extension) and copies it to mime_type.
  *
- * Returns: number of bytes written to socket.
+ * Returns: true if a type was found.
  *
  * Normally the netburner http code will send the proper header response based on the MIME_magic.txt
  * file located in \nburn\pcbin. However, if the file is read from the flash card, the http server code
@@ -183,114 +209,178 @@ int my_f_read_line(char *buffer, int buf_siz, F_FILE *fp)
  * Only include the minimum number of file types you wish to support. Order matters as well, so
  * common file types should be located at the top
  *
- * If the file type is located, then the specified MIME type is sent.
- *
- * If the MIME lookup fails, a secondary MIME lookup occurs with hard-coded values.
+ * MIME.txt is read from the current directory. If the MIME lookup fails, a secondary MIME lookup
+ * occurs with hard-coded values.
  */
-
-int SendEFFSCustomHeaderResponse(int sock, char *fType)
+bool LookupMimeType(const char *fType, char *mime_type, int size)
 {
-    char mime_type[64];
     bool found = false;
 
+    PoolBlock line(POOL_PATH, TICKS_PER_SECOND);
+    if (line.Data() == nullptr) { return false; }
+    line.Data()[0] = '\0';
+
     // Check for MIME.txt file, which lists support mime types
     F_FILE *f = f_open("MIME.txt", "r");
-    if (f != nullptr)
+    PoolBlock readAhead;
+    if ((f != nullptr) && readAhead.Acquire(POOL_PATH, TICKS_PER_SECOND))
     {
-        char line[255] = "";
-        while (my_f_read_line(line, 255, f) != 0 && !found)
+        int start = 0;
+        int end = 0;
+        while (my_f_read_line(line.Data(), 255, f, readAhead.Data(), start, end) != 0 && !found)
         {
-            if (line[0] == '#' || line[0] == ' ' || line[0] == '\0')
+            if (line.Data()[0] == '#' || line.Data()[0] == ' ' || line.Data()[0] == '\0')
             {
                 continue;   // Comment
             }
-            char *pch = strtok(line, " \t\n\r");
+            char *pch = strtok(line.Data(), " \t\n\r");
             if (strcasecmp(fType, pch) == 0)
             {   // Found file type
                 pch = strtok(nullptr, " \t\n\r");
-                sniprintf(mime_type, 64, pch);
+                sniprintf(mime_type, size, "%s", pch);
                 found = true;
             }
         }
     }
+    if (f != nullptr) { f_close(f); }
     if (!found)
     {                   // no MIME.txt found or extension type not found, fall back to hard-coded list
         found = true;   // Set to true. Revert to false if not found in default else.
         if (strcasecmp(fType, "jpg") == 0)
         {
-            sniprintf(mime_type, 64, "image/jpeg");
+            sniprintf(mime_type, size, "image/jpeg");
         }
         else if (strcasecmp(fType, "gif") == 0)
         {
-            sniprintf(mime_type, 64, "image/gif");
+            sniprintf(mime_type, size, "image/gif");
         }
         else if (strcasecmp(fType, "htm") == 0)
         {
-            sniprintf(mime_type, 64, "text/html");
+            sniprintf(mime_type, size, "text/html");
         }
         else if (strcasecmp(fType, "html") == 0)
         {
-            sniprintf(mime_type, 64, "text/html");
+            sniprintf(mime_type, size, "text/html");
         }
         else if (strcasecmp(fType, "xml") == 0)
         {
-            sniprintf(mime_type, 64, "text/xml");
+            sniprintf(mime_type, size, "text/xml");
         }
         else if (strcasecmp(fType, "css") == 0)
         {
-            sniprintf(mime_type, 64, "text/css");
+            sniprintf(mime_type, size, "text/css");
         }
         else if (strcasecmp(fType, "mp4") == 0)
         {
-            sniprintf(mime_type, 64, "video/mp4");
+            sniprintf(mime_type, size, "video/mp4");
+        }
+        else if (strcasecmp(fType, "glb") == 0)
+        {
+            sniprintf(mime_type, size, "model/gltf-binary");
+        }
+        else if (strcasecmp(fType, "gltf") == 0)
+        {
+            sniprintf(mime_type, size, "model/gltf+json");
         }
         else
         {
             found = false;
         }
     }
-    char buffer[255];
-    if (found)
+    return found;
+}
+
+int FormatFileHeader(char *buf, int size, const char *mime, long len, const char *etag)
+{
+    // If the MIME type is not known, don't send any MIME type. This allows the browser to make a
+    // best guess
+    int n = sniprintf(buf, size, "HTTP/1.0 200 OK\r\nPragma: no-cache\r\n");
+    if ((mime != nullptr) && (n < size))
+    {
+        n += sniprintf(buf + n, size - n, "MIME-version: 1.0\r\nContent-Type: %s\r\n", mime);
+    }
+    if ((len >= 0) && (n < size)) { n += sniprintf(buf + n, size - n, "Content-Length: %ld\r\n", len); }
+    if ((etag != nullptr) && (n < size))
     {
-        sniprintf(buffer, 255,
-                  "HTTP/1.0 200 OK\r\n"
-                  "Pragma: no-cache\r\n"
-                  "MIME-version: 1.0\r\n"
-                  "Content-Type: %s\r\n\r\n",
-                  mime_type);
+        n += sniprintf(buf + n, size - n, "ETag: %s\r\nCache-Control: no-cache\r\n", etag);
     }
+    if (n < size) { n += sniprintf(buf + n, size - n, "\r\n"); }
+    return (n < size) ? n : 0;
+}
+
+/**
+ * @brief Takes a file type and sends a header response with the specified MIME type.
+ *
+ * Returns: number of bytes written to socket.
+ */
+int SendEFFSCustomHeaderResponse(int sock, char *fType)
+{
+    char mime_type[64];
+    bool found = LookupMimeType(fType, mime_type, sizeof(mime_type));
+
+    PoolBlock header(POOL_PATH, TICKS_PER_SECOND);
+    if (header.Data() == nullptr) { return 0; }
+    int len = FormatFileHeader(header.Data(), POOL_PATH_SIZE, found ? mime_type : nullptr, -1, nullptr);
+    return writeall(sock, header.Data(), len);
+}
+
+/**
+ * @brief Sends the latest statistics snapshot (see stats.h) as JSON
+ */
+void SendStatsResponse(int sock)
+{
+    PoolBlock statsBuffer(POOL_TRANSFER, TICKS_PER_SECOND);
+    int len = (statsBuffer.Data() != nullptr) ? StatsCopySnapshot(statsBuffer.Data(), STATS_JSON_MAX) : 0;
+
+    writestring(sock,
+                "HTTP/1.0 200 OK\r\n"
+                "Pragma: no-cache\r\n"
+                "MIME-version: 1.0\r\n"
+                "Content-Type: application/json\r\n\r\n");
+    if (len > 0) { writeall(sock, statsBuffer.Data(), len); }
     else
-    {   // If MIME type is not found, don't send any MIME type. This allows the browser to
-        // make a best guess
-        sniprintf(buffer, 255,
-                  "HTTP/1.0 200 OK\r\n"
-                  "Pragma: no-cache\r\n\r\n");
+    {
+        writestring(sock, "{}");   // No snapshot has been taken yet
     }
-    int bytes = writestring(sock, buffer);
-    return bytes;
 }
 
 /**
  * @brief Handles a WebSocket upgrade request
+ *
+ * Connecting to /POSE gets compact binary frames with quaternion orientation (see telemetry.h).
+ * Connecting to /INDEX gets the original JSON frames with Euler angles.
+ * Connecting to /DIAG gets the /stats snapshot as a text message once per second.
  */
 int MyDoWSUpgrade(HTTP_Request *req, int sock, PSTR url, PSTR rxBuffer)
 {
-    iprintf("Trying WebSocket Upgrade!\r\n");
-    if (httpstricmp(url, "INDEX"))
+    LOG_DEBUG("Trying WebSocket Upgrade!\r\n");
+    if (httpstricmp(url, "DIAG"))
     {
-        if (ws_fd > 0)
+        int rv = WSUpgrade(req, sock);
+        if (rv < 0) { return 0; }
+        NB::WebSocket::ws_setoption(rv, WS_SO_TEXT);
+        if (!AddDiagClient(rv, sock))
         {
-            iprintf("Closing prior WebSocket connection.\r\n");
-            close(ws_fd);
-            ws_fd = -1;
+            close(rv);
+            return 0;
         }
+        return 2;
+    }
 
+    bool binary = httpstricmp(url, "POSE");
+    if (binary || httpstricmp(url, "INDEX"))
+    {
         int rv = WSUpgrade(req, sock);
         if (rv >= 0)
         {
-            iprintf("WebSocket Upgrade Successful!\r\n");
-            ws_fd = rv;
-            NB::WebSocket::ws_setoption(ws_fd, WS_SO_TEXT);
+            LOG_INFO("WebSocket Upgrade Successful!\r\n");
+            if (!binary) { NB::WebSocket::ws_setoption(rv, WS_SO_TEXT); }
+            if (!AddTelemetryClient(rv, sock, binary))
+            {
+                LOG_WARN("Too many pending WebSocket connections.\r\n");
+                close(rv);
+                return 0;
+            }
             return 2;
         }
         else
@@ -303,15 +393,137 @@ int MyDoWSUpgrade(HTTP_Request *req, int sock, PSTR url, PSTR rxBuffer)
     return 0;
 }
 
+/**
+ * @brief Returns true if the request header called name contains token. headers ends
+ * at the first blank line or the terminating null.
+ */
+bool RequestHeaderHas(const char *headers, const char *name, const char *token)
+{
+    int nameLen = strlen(name);
+    int tokenLen = strlen(token);
+    const char *line = headers;
+    while ((*line != 0) && (*line != '\r') && (*line != '\n'))
+    {
+        const char *end = line;
+        while ((*end != 0) && (*end != '\r') && (*end != '\n')) { end++; }
+
+        if ((strncasecmp(line, name, nameLen) == 0) && (line[nameLen] == ':'))
+        {
+            for (const char *p = line + nameLen + 1; (end - p) >= tokenLen; p++)
+            {
+                if (strncmp(p, token, tokenLen) == 0) { return true; }
+            }
+        }
+
+        line = end;
+        if (*line == '\r') { line++; }
+        if (*line == '\n') { line++; }
+    }
+    return false;
+}
+
+/**
+ * @brief Copies the value of the request header called name. Returns its length, or -1 if
+ * the header is missing.
+ */
+int RequestHeaderValue(const char *headers, const char *name, char *buf, int size)
+{
+    int nameLen = strlen(name);
+    const char *line = headers;
+    while ((*line != 0) && (*line != '\r') && (*line != '\n'))
+    {
+        const char *end = line;
+        while ((*end != 0) && (*end != '\r') && (*end != '\n')) { end++; }
+
+        if ((strncasecmp(line, name, nameLen) == 0) && (line[nameLen] == ':'))
+        {
+            const char *p = line + nameLen + 1;
+            while ((p < end) && (*p == ' ')) { p++; }
+            while ((end > p) && (end[-1] == ' ')) { end--; }
+            int len = end - p;
+            if (len > size - 1) { len = size - 1; }
+            memcpy(buf, p, len);
+            buf[len] = 0;
+            return len;
+        }
+
+        line = end;
+        if (*line == '\r') { line++; }
+        if (*line == '\n') { line++; }
+    }
+    return -1;
+}
+
+/**
+ * @brief Returns the request headers that follow the request line in rxBuffer. The server has
+ * terminated the method and the URL in place, so the line's '\n' is found by stepping over at
+ * most those two NULs; any further NUL is the end of the request.
+ */
+static const char *RequestHeaders(PSTR rxBuffer)
+{
+    int nuls = 0;
+    for (const char *p = rxBuffer; nuls <= 2; p++)
+    {
+        if (*p == '\n') { return p + 1; }
+        if (*p == 0) { nuls++; }
+    }
+    return "";
+}
+
+/**
+ * @brief Sends a bodyless error response, such as "400 Bad Request"
+ */
+static void SendErrorResponse(int sock, const char *status)
+{
+    char buffer[80];
+    sniprintf(buffer, sizeof(buffer), "HTTP/1.0 %s\r\nContent-Length: 0\r\nConnection: close\r\n\r\n", status);
+    writestring(sock, buffer);
+}
+
+/**
+ * @brief Redirects GET /EVENTS to the event stream task, which keeps the connection open (see
+ * events.h). Last-Event-ID is carried over in the query, since a redirect drops it.
+ */
+static void SendEventsRedirect(int sock, PSTR rxBuffer)
+{
+    const char *headers = RequestHeaders(rxBuffer);
+    char host[64];
+    if (RequestHeaderValue(headers, "Host", host, sizeof(host)) <= 0)
+    {
+        SendErrorResponse(sock, "400 Bad Request");
+        return;
+    }
+    char *colon = strrchr(host, ':');
+    char *bracket = strchr(host, ']');   // Keep IPv6 literals whole
+    if ((colon != nullptr) && ((bracket == nullptr) || (colon > bracket))) { *colon = 0; }
+
+    char lastId[16];
+    bool resume = RequestHeaderValue(headers, "Last-Event-ID", lastId, sizeof(lastId)) > 0;
+
+    PoolBlock response(POOL_PATH, TICKS_PER_SECOND);
+    if (response.Data() == nullptr) { return; }
+    int n = sniprintf(response.Data(), POOL_PATH_SIZE,
+                      "HTTP/1.0 307 Temporary Redirect\r\nLocation: http://%s:%d/events%s%s\r\n"
+                      "Cache-Control: no-cache\r\nContent-Length: 0\r\n\r\n",
+                      host, EVENTS_PORT, resume ? "?lastEventId=" : "", resume ? lastId : "");
+    writeall(sock, response.Data(), n);
+}
+
+/**
+ * @brief Answers a request the flash card could not: from the assets compiled into the image
+ * when there is one, otherwise from the compiled-in pages.
+ */
+static int SendFallback(int sock, PSTR url, PSTR rxBuffer, const EmbeddedAsset *asset)
+{
+    if ((asset != nullptr) && SendEmbeddedAsset(sock, asset, RequestHeaders(rxBuffer))) { return 0; }
+    return (*oldhand)(sock, url, rxBuffer);
+}
+
 /**
  * @brief Handles our GET requests
  */
 int MyDoGet(int sock, PSTR url, PSTR rxBuffer)
 {
-    char name_buffer[257] = {};   // Reserve last byte for null character
-    char dir_buffer[256] = {};
-    char ext_buffer[10] = {};
-
 #ifdef USE_MMC
     f_chdrive(MMC_DRV_NUM);
 #endif
@@ -320,42 +532,68 @@ int MyDoGet(int sock, PSTR url, PSTR rxBuffer)
     f_chdrive(CFC_DRV_NUM);
 #endif
 
-    f_chdir("\\");
-
-    iprintf("Processing MyDoGet()\r\n");
+    TRACE_SPAN(requestSpan, TRACE_HTTP_GET);
+    StatsAdd(STAT_TASK_HTTP, STAT_HTTP_REQUESTS);
+    if (httpstricmp(url, "STATS") && ((url[5] == 0) || (url[5] == '?')))
+    {
+        SendStatsResponse(sock);
+        return 0;
+    }
+    if (httpstricmp(url, "TRACE") && ((url[5] == 0) || (url[5] == '?')) && SendTraceJson(sock)) { return 0; }
+    if (httpstricmp(url, "EVENTS") && ((url[6] == 0) || (url[6] == '?')))
+    {
+        SendEventsRedirect(sock, rxBuffer);
+        return 0;
+    }
 
-    // Parse and store file extension portion of URL
-    iprintf("  URL: \"%s\"\r\n", url);
-    char *pext = url + strlen(url);
+    // One path block holds the decoded request path; without it we can still serve the compiled-in pages
+    PoolBlock pathBlock(POOL_PATH, TICKS_PER_SECOND);
+    if (pathBlock.Data() == nullptr) { return (*oldhand)(sock, url, rxBuffer); }
 
-    while ((*pext != '.') && (*pext != '/') && (*pext != '\\') && (pext > url))
+    LOG_DEBUG("Processing MyDoGet()\r\n");
+    LOG_DEBUG("  URL: \"%s\"\r\n", url);
+    ParsedUrl parsed;
+    UrlResult result = ParseUrl(url, pathBlock.Data(), POOL_PATH_SIZE, parsed);
+    if (result != URL_OK)
     {
-        pext--;
+        LOG_DEBUG("  URL refused: %s\r\n", UrlResultName(result));
+        StatsAdd(STAT_TASK_HTTP, STAT_HTTP_BAD_URLS);
+        bool tooLong = (result == URL_TOO_LONG) || (result == URL_TOO_DEEP);
+        SendErrorResponse(sock, tooLong ? "414 URI Too Long" : "400 Bad Request");
+        return 0;
+    }
+    const char *path = parsed.path + 1;   // Card and asset paths have no leading '/'
+    const char *pName = parsed.name.str;
+    LOG_DEBUG("  URL path: \"%s\", extension: \"%s\"\r\n", parsed.path, parsed.ext.str);
+
+    // Assets compiled into the image are served unless the card holds a different copy
+    const EmbeddedAsset *asset = FindEmbeddedAsset(path);
+    if ((asset != nullptr) && (!CardMounted() || (CardIndexLookup(asset->path) == CARD_INDEX_MISSING)) &&
+        SendEmbeddedAsset(sock, asset, RequestHeaders(rxBuffer)))
+    {
+        return 0;
     }
 
-    if ((*pext == '.') || (*pext == '\\') || (*pext == '/')) { pext++; }
-
-    strncpy(ext_buffer, pext, 9);
-    iprintf("  URL extension: \"%s\"\r\n", ext_buffer);
+    // No flash card yet, or it was pulled: serve the compiled-in pages
+    if (!CardMounted()) { return (*oldhand)(sock, url, rxBuffer); }
 
-    // Parse and store file name portion of URL
-    char *pName = url + strlen(url);
+    // The cached or runtime response header is built here
+    PoolBlock headerBlock(POOL_PATH, TICKS_PER_SECOND);
+    if (headerBlock.Data() == nullptr) { return SendFallback(sock, url, rxBuffer, asset); }
 
-    while ((*pName != '/') && (*pName != '\\') && (pName > url))
+    // Skip the directory search for files the card index knows are not there, and pick up the
+    // response header it built. Directory URLs and listings still go to the card.
+    CardIndexHeader *cached = (CardIndexHeader *)headerBlock.Data();
+    cached->len = 0;
+    if ((parsed.name.len != 0) && !httpstricmp(pName, "DIR"))
     {
-        pName--;
+        CardIndexAnswer indexed = CardIndexLookup(path, cached);
+        StatsAdd(STAT_TASK_HTTP, (indexed == CARD_INDEX_UNKNOWN) ? STAT_CACHE_MISSES : STAT_CACHE_HITS);
+        if ((indexed == CARD_INDEX_MISSING) && (asset == nullptr)) { return (*oldhand)(sock, url, rxBuffer); }
     }
 
-    if ((*pName == '\\') || (*pName == '/')) { pName++; }
-
-    strncpy(name_buffer, pName, 256);
-    iprintf("  URL file name: \"%s\"\r\n", name_buffer);
-
-    // Store directory portion of URL
-    strncpy(dir_buffer + 1, url, (pName - url));
-    dir_buffer[0] = '/';
-    dir_buffer[(pName - url) + 1] = 0;
-    iprintf("  URL directory portion: \"%s\"\r\n", dir_buffer);
+    const char *dir = UrlDirString(parsed);
+    f_chdir("\\");
 
     /**
      * Try to locate the specified file on the flash card. If no file
@@ -368,11 +606,11 @@ int MyDoGet(int sock, PSTR url, PSTR rxBuffer)
      * In this way any HTML file on the flash card will override the HTML
      * files on the module internal flash memory
      */ 
-    if (f_chdir(dir_buffer) == F_NO_ERROR)
+    if (f_chdir(dir) == F_NO_ERROR)
     {
-        if (name_buffer[0] == 0)
+        if (parsed.name.len == 0)
         {
-            if (dir_buffer[1] == 0)
+            if (dir[1] == 0)
             {
                 // Root file try index.ht* first
                 F_FIND f;
@@ -398,28 +636,47 @@ int MyDoGet(int sock, PSTR url, PSTR rxBuffer)
              * a directory listing is displayed instead of the internal index.htm,
              * then uncomment the following two lines of code
              */
-             // WebListDir(sock, dir_buffer);
+             // WebListDir(sock, dir);
              // return 0;
         }
         else
         {
             // A file name was specified in the URL, so attempt to open it
-            iprintf("  Attempting to open file \"%s\"...", pName);
+            TRACE_NOW(openStart);
             F_FILE *f = f_open(pName, "r");
+            TRACE_RECORD(TRACE_F_OPEN, openStart, TimingNowUs() - openStart, 0);
 
             if (f != nullptr)
             {
                 long len = f_filelength(pName);
-                SendEFFSCustomHeaderResponse(sock, ext_buffer);
-                SendFragment(sock, f, len);
+                if ((cached->len != 0) && (cached->fileLen == (uint32_t)len))
+                {
+                    if (RequestHeaderHas(RequestHeaders(rxBuffer), "If-None-Match", cached->etag))
+                    {
+                        // Reuse the header text for the 304, it is not needed any more
+                        int n = sniprintf(cached->text, CARD_INDEX_HEADER_MAX,
+                                          "HTTP/1.0 304 Not Modified\r\nETag: %s\r\n\r\n", cached->etag);
+                        writeall(sock, cached->text, n);
+                        StatsAdd(STAT_TASK_HTTP, STAT_HTTP_NOT_MODIFIED);
+                    }
+                    else { SendFragment(sock, f, len, cached->text, cached->len); }
+                }
+                else
+                {
+                    // Not indexed, or changed since: build the header now
+                    char mime_type[64];
+                    bool found = LookupMimeType(parsed.ext.str, mime_type, sizeof(mime_type));
+                    int n = FormatFileHeader(headerBlock.Data(), POOL_PATH_SIZE, found ? mime_type : nullptr, len, nullptr);
+                    SendFragment(sock, f, len, headerBlock.Data(), n);
+                }
                 f_close(f);
-                iprintf(" File sent to browser\r\n");
+                LOG_DEBUG("  File \"%s\" sent to browser\r\n", pName);
                 return 0;
             }
             else
             {
-                iprintf(" file does not exist on flash card,");
-                iprintf(" will look in compiled application image\r\n");
+                LOG_DEBUG("  File \"%s\" does not exist on flash card, will look in compiled application image\r\n",
+                          pName);
             }
 
             /**
@@ -428,13 +685,13 @@ int MyDoGet(int sock, PSTR url, PSTR rxBuffer)
              */
             if (httpstricmp(pName, "DIR"))
             {
-                WebListDir(sock, dir_buffer);
+                WebListDir(sock, dir);
                 return 0;
             }
         }
     }
 
-    return (*oldhand)(sock, url, rxBuffer);
+    return SendFallback(sock, url, rxBuffer, asset);
 }
 
 /**
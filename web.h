@@ -29,5 +29,21 @@
 #pragma once
 
 void RegisterWebFuncs();
+int SendEFFSCustomHeaderResponse(int sock, char *fType);
+
+// MIME type for a file extension, from MIME.txt in the current directory or a built-in list
+bool LookupMimeType(const char *fType, char *mime_type, int size);
+
+// Formats a complete 200 header for a file. mime and etag may be nullptr, and a negative len
+// leaves out Content-Length. Returns the header length, or 0 if it does not fit.
+int FormatFileHeader(char *buf, int size, const char *mime, long len, const char *etag);
+
+// True if the request header called name contains token. headers follow the request line and
+// end at the first blank line.
+bool RequestHeaderHas(const char *headers, const char *name, const char *token);
+
+// Copies the value of the request header called name, without surrounding spaces. Returns its
+// length, or -1 if the header is missing. A value longer than size - 1 is cut short.
+int RequestHeaderValue(const char *headers, const char *name, char *buf, int size);
 
 #endif /* _WEB_H_ */